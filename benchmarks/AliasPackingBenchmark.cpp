@@ -0,0 +1,130 @@
+// Offline driver for the alias packing strategies. Plans pools loaded with LoadAliasPackingPools,
+// or synthetic ones, with every strategy and prints the results as JSON. It never creates a
+// device, so it runs on CI machines without a GPU.
+//
+// AliasPackingBenchmark [--pools <file>] [--seed <n>] [--pool-count <n>] [--candidates <n>]
+//                       [--iterations <n>] [--save <file>]
+
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include "Render/RenderGraph/RenderGraph.h"
+#include "Render/RenderGraph/Aliasing/RenderGraphAliasPacking.h"
+
+namespace {
+	const char* StrategyName(AutoAliasPackingStrategy strategy) {
+		switch (strategy) {
+		case AutoAliasPackingStrategy::GreedySweepLine: return "GreedySweepLine";
+		case AutoAliasPackingStrategy::BranchAndBound: return "BranchAndBound";
+		case AutoAliasPackingStrategy::IntervalBestFit: return "IntervalBestFit";
+		default: return "Unknown";
+		}
+	}
+
+	template<typename T>
+	bool ParseNumber(std::string_view text, T& out) {
+		const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), out);
+		return error == std::errc{} && end == text.data() + text.size();
+	}
+
+	int Usage() {
+		std::fprintf(stderr,
+			"usage: AliasPackingBenchmark [--pools <file>] [--seed <n>] [--pool-count <n>] "
+			"[--candidates <n>] [--iterations <n>] [--save <file>]\n");
+		return 2;
+	}
+}
+
+int main(int argc, char** argv) {
+	std::string_view poolsPath;
+	std::string_view savePath;
+	uint64_t seed = 1;
+	uint32_t poolCount = 32;
+	uint32_t candidatesPerPool = 24;
+	uint32_t iterations = 16;
+
+	for (int i = 1; i < argc; ++i) {
+		const std::string_view arg = argv[i];
+		if (i + 1 >= argc) {
+			return Usage();
+		}
+		const std::string_view value = argv[++i];
+		bool parsed = true;
+		if (arg == "--pools") {
+			poolsPath = value;
+		}
+		else if (arg == "--save") {
+			savePath = value;
+		}
+		else if (arg == "--seed") {
+			parsed = ParseNumber(value, seed);
+		}
+		else if (arg == "--pool-count") {
+			parsed = ParseNumber(value, poolCount);
+		}
+		else if (arg == "--candidates") {
+			parsed = ParseNumber(value, candidatesPerPool);
+		}
+		else if (arg == "--iterations") {
+			parsed = ParseNumber(value, iterations) && iterations > 0;
+		}
+		else {
+			parsed = false;
+		}
+		if (!parsed) {
+			return Usage();
+		}
+	}
+
+	std::vector<rg::alias::AliasPackingBenchmarkPool> pools;
+	if (!poolsPath.empty()) {
+		if (!rg::alias::LoadAliasPackingPools(std::filesystem::path(poolsPath), pools)) {
+			std::fprintf(stderr, "AliasPackingBenchmark: cannot load pools from '%.*s'\n",
+				static_cast<int>(poolsPath.size()), poolsPath.data());
+			return 1;
+		}
+	}
+	else {
+		pools = rg::alias::GenerateSyntheticAliasPackingPools(seed, poolCount, candidatesPerPool);
+	}
+	if (!savePath.empty() && !rg::alias::SaveAliasPackingPools(std::filesystem::path(savePath), pools)) {
+		std::fprintf(stderr, "AliasPackingBenchmark: cannot save pools to '%.*s'\n",
+			static_cast<int>(savePath.size()), savePath.data());
+		return 1;
+	}
+
+	size_t candidateCount = 0;
+	for (const auto& pool : pools) {
+		candidateCount += pool.candidates.size();
+	}
+
+	const auto results = rg::alias::BenchmarkAliasPackingStrategies(pools, iterations);
+	bool allValid = true;
+	std::printf("{\n  \"pools\": %zu,\n  \"candidates\": %zu,\n  \"iterations\": %u,\n  \"strategies\": [\n",
+		pools.size(), candidateCount, iterations);
+	for (size_t i = 0; i < results.size(); ++i) {
+		const auto& result = results[i];
+		allValid = allValid && result.allPlansValid;
+		std::printf(
+			"    { \"strategy\": \"%s\", \"averagePlanMs\": %.4f, \"maxPlanMs\": %.4f, "
+			"\"independentBytes\": %llu, \"actualBytes\": %llu, \"savedBytes\": %llu, "
+			"\"truncatedPools\": %zu, \"allPlansValid\": %s }%s\n",
+			StrategyName(result.strategy),
+			result.averagePlanMilliseconds,
+			result.maxPlanMilliseconds,
+			static_cast<unsigned long long>(result.pooledIndependentBytes),
+			static_cast<unsigned long long>(result.pooledActualBytes),
+			static_cast<unsigned long long>(result.pooledSavedBytes),
+			result.truncatedPools,
+			result.allPlansValid ? "true" : "false",
+			i + 1 < results.size() ? "," : "");
+	}
+	std::printf("  ]\n}\n");
+	return allValid ? EXIT_SUCCESS : 1;
+}
@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 namespace ui {
@@ -55,6 +56,15 @@ namespace ui {
         uint64_t totalBytes = 0;
     };
 
+    // Incremental update of the snapshot the widget keeps, with rows keyed by uid. Removals are
+    // applied before upserts; categories replace the held ones when non-empty, since they are few.
+    struct MemorySnapshotDelta {
+        bool reset = false; // Drop every held row first
+        std::vector<MemoryResourceRow> upserted;
+        std::vector<uint64_t> removedUids;
+        std::vector<MemoryCategorySlice> categories;
+    };
+
     // Frame-graph timeline input
     struct FrameGraphBatchRow {
         std::string label;
@@ -106,10 +116,14 @@ namespace ui {
         void PushFrameSample(double timeSeconds, uint64_t totalBytes);
 
         // Draw the window. `frameGraph` is optional; if nullptr/empty we show a dummy.
+        // Without a `snapshot`, the one built from ApplySnapshotDelta is shown, if any.
         void Draw(bool* pOpen,
             const MemorySnapshot* snapshot = nullptr,
             const FrameGraphSnapshot* frameGraph = nullptr);
 
+        // Updates the held snapshot in place instead of taking a full one every frame.
+        void ApplySnapshotDelta(const MemorySnapshotDelta& delta);
+
     private:
         enum class ViewMode : int { Pie = 0, List = 1, Timeline = 2, BatchTimeline = 3 };
         enum class TimelineMode : int { RealTime = 0, FrameGraph = 1 };
@@ -214,6 +228,10 @@ namespace ui {
         double rtLastCommittedTime_ = -1.0;
 
         int selectedBatch_ = -1;
+
+        MemorySnapshot retained_;
+        std::unordered_map<uint64_t, size_t> retainedIndexByUid_;
+        bool hasRetained_ = false;
     };
 
 } // namespace ui
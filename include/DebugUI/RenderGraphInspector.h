@@ -39,6 +39,9 @@ struct RGInspectorOptions {
 
     // Called only while the inspector's cache overlay toggle is enabled.
     RGCacheOverlayProviderFn cacheOverlayProvider;
+
+    // Passes dropped by dead-pass culling this frame (RenderGraph::GetLastCulledPassNames()).
+    const std::vector<std::string>* culledPassNames = nullptr;
 };
 
 namespace RGInspector {
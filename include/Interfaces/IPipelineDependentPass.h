@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Render/Runtime/IPipelineCompileService.h"
+
+// Opt-in readiness gate for passes whose pipelines compile asynchronously. The graph drops the
+// pass from every frame in which this reports Pending (see RenderGraph::
+// GetLastPipelinePendingSkippedPassNames); a Failed pipeline keeps it out until the pass requests a
+// new one. Passes typically return PipelinesReadiness over the PendingPipelines they requested in
+// Setup.
+struct IPipelineDependentPass {
+	virtual rg::runtime::PipelineReadiness GetPipelineReadiness() const = 0;
+	virtual ~IPipelineDependentPass() = default;
+};
+
+namespace rg::runtime {
+
+// Failed if any failed, otherwise Pending while any is not yet ready. Null entries are ignored.
+template<class Range>
+PipelineReadiness PipelinesReadiness(const Range& pipelines) {
+	PipelineReadiness readiness = PipelineReadiness::Ready;
+	for (const auto& pipeline : pipelines) {
+		if (!pipeline) {
+			continue;
+		}
+		const PipelineReadiness state = pipeline->GetReadiness();
+		if (state == PipelineReadiness::Failed) {
+			return PipelineReadiness::Failed;
+		}
+		if (state == PipelineReadiness::Pending) {
+			readiness = PipelineReadiness::Pending;
+		}
+	}
+	return readiness;
+}
+
+}
@@ -63,24 +63,13 @@ struct ResourceResolverAndRange {
 /// when a versioned resolver's content changes between frames and
 /// automatically trigger re-declaration.
 struct ResolverSnapshot {
-    std::unique_ptr<IResourceResolver> resolver;
+    // The resolver is cloned once when the snapshot is taken and never mutated afterwards
+    // (IResourceResolver is const-only), so copies of a pass entry share it instead of
+    // deep-cloning it every frame.
+    std::shared_ptr<const IResourceResolver> resolver;
     uint64_t version = 0;
 
     ResolverSnapshot() = default;
     ResolverSnapshot(std::unique_ptr<IResourceResolver> r, uint64_t v)
         : resolver(std::move(r)), version(v) {}
-    ResolverSnapshot(ResolverSnapshot&&) = default;
-    ResolverSnapshot& operator=(ResolverSnapshot&&) = default;
-
-    // Deep-copy via Clone() so that PassAndResources structs remain copyable.
-    ResolverSnapshot(const ResolverSnapshot& other)
-        : resolver(other.resolver ? other.resolver->Clone() : nullptr)
-        , version(other.version) {}
-    ResolverSnapshot& operator=(const ResolverSnapshot& other) {
-        if (this != &other) {
-            resolver = other.resolver ? other.resolver->Clone() : nullptr;
-            version = other.version;
-        }
-        return *this;
-    }
 };
\ No newline at end of file
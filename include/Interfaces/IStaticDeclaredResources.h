@@ -0,0 +1,13 @@
+#pragma once
+
+#include <cstdint>
+
+// Opt-in "declare once" contract. The graph keeps a static pass's declaration and only runs
+// DeclareResourceUsages again when a versioned resolver it used changes content version, a handle
+// it declared no longer matches the registry (the resource was re-registered), or the token below
+// changes. Passes bump the token when anything else their declaration reads changes. A pass that
+// implements this is not polled through IDynamicDeclaredResources.
+struct IStaticDeclaredResources {
+	virtual uint64_t GetDeclarationInvalidationToken() const = 0;
+	virtual ~IStaticDeclaredResources() = default;
+};
@@ -1,17 +1,30 @@
 #pragma once
 
+#include <algorithm>
 #include <vector>
 #include <memory>
 #include <mutex>
 #include <cstddef>
+#include <cstdint>
+#include <limits>
 
 #include "Resources/Buffers/Buffer.h"
 
 /// A dedicated pool of Upload-heap buffers for async copy-queue streaming uploads.
 /// Separate from UploadManager's pages to avoid thread-safety contention.
 ///
-/// Uses a simple per-frame bump allocator: each frame gets a clean slate of
-/// tail offsets (pages are reused across frames once retired).
+/// Pages form a ring that is reclaimed by copy-queue fence value rather than
+/// by frame:
+///   1. Allocate() bump-allocates from the active page. The allocation stays
+///      pending until MarkSubmitted() hands it to a copy pass, so uploads can
+///      wait in a backlog for several frames.
+///   2. CloseRegion(fence) tags every page that had submissions since the last
+///      close with the fence value the copy queue signals after that work.
+///   3. Reclaim(completed) recycles pages whose pending allocations have all
+///      been submitted and whose last region's fence has completed, and trims
+///      pages that have sat idle for kTrimIdleReclaims calls.
+/// A page is only rewound once nothing in it can still be read by the GPU, so
+/// frames in flight overlap without overwriting each other's data.
 class AsyncCopyPagePool {
 public:
     struct Allocation {
@@ -19,78 +32,187 @@ public:
         size_t offset = 0;
     };
 
+    static constexpr size_t kDefaultPageSize = 64 * 1024 * 1024; // 64 MB
+    static constexpr uint64_t kTrimIdleReclaims = 240;
+
     explicit AsyncCopyPagePool(size_t pageSize = kDefaultPageSize)
         : m_pageSize(pageSize) {
     }
 
-    /// Allocate `size` bytes with the given alignment from the current active page.
-    /// Grows by adding new pages as needed.
+    /// Allocate `size` bytes with the given alignment, from the active page or
+    /// the first recycled page that fits. Grows by adding new pages as needed.
+    /// `submitCount` is how many MarkSubmitted calls will cover the allocation.
     /// Thread-safe (internally locked).
-    Allocation Allocate(size_t size, size_t alignment = 1) {
+    Allocation Allocate(size_t size, size_t alignment = 1, uint32_t submitCount = 1) {
         std::lock_guard<std::mutex> lock(m_mutex);
-
-        if (m_pages.empty()) {
-            AddPage(std::max(size, m_pageSize));
-        }
-
-        auto* page = &m_pages[m_activePage];
-        size_t aligned = AlignUp(page->tailOffset, alignment);
-
-        // If it won't fit, try next page or allocate a new one
-        if (aligned + size > page->capacity) {
-            ++m_activePage;
-            if (m_activePage >= m_pages.size()) {
-                AddPage(std::max(size, m_pageSize));
+        ++m_stats.allocations;
+        m_stats.allocatedBytes += size;
+
+        Page* page = m_activePage < m_pages.size() ? &m_pages[m_activePage] : nullptr;
+        size_t aligned = page ? AlignUp(page->tailOffset, alignment) : 0;
+        if (!page || aligned + size > page->capacity) {
+            page = nullptr;
+            for (size_t i = 0; i < m_pages.size(); ++i) {
+                if (!m_pages[i].inUse && m_pages[i].capacity >= size) {
+                    m_activePage = i;
+                    page = &m_pages[i];
+                    break;
+                }
+            }
+            if (!page) {
+                AddPage(size);
+                page = &m_pages[m_activePage];
+                ++m_stats.pagesCreated;
+            }
+            else {
+                ++m_stats.pageSwitches;
             }
-            page = &m_pages[m_activePage];
-            page->tailOffset = 0;
             aligned = 0;
         }
 
         page->tailOffset = aligned + size;
+        page->inUse = true;
+        page->pendingAllocations += submitCount;
+        page->lastUsedReclaim = m_reclaimCount;
         return { page->buffer, aligned };
     }
 
-    /// Reset all pages for reuse. Call once per frame after the GPU is done
-    /// with the previous frame's uploads (tracked externally via fences).
-    void ResetForFrame() {
+    /// The allocation backing `buffer` is now recorded in a copy pass that
+    /// will be covered by the next CloseRegion().
+    void MarkSubmitted(const Resource* buffer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (Page* page = FindPage(buffer)) {
+            if (page->pendingAllocations > 0) {
+                --page->pendingAllocations;
+            }
+            page->inOpenRegion = true;
+        }
+    }
+
+    /// Tags the pages used by submissions since the last close with the
+    /// copy-queue fence value that signals after that work.
+    void CloseRegion(uint64_t fenceValue) {
         std::lock_guard<std::mutex> lock(m_mutex);
         for (auto& page : m_pages) {
-            page.tailOffset = 0;
+            if (page.inOpenRegion) {
+                page.fenceValue = std::max(page.fenceValue, fenceValue);
+                page.inOpenRegion = false;
+            }
         }
-        m_activePage = 0;
+    }
+
+    /// Recycle pages whose copies have completed and trim long-idle pages.
+    /// Call once per frame with the copy queue's completed fence value.
+    void Reclaim(uint64_t completedFenceValue) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_reclaimCount;
+        for (auto& page : m_pages) {
+            if (page.inUse
+                && page.pendingAllocations == 0
+                && !page.inOpenRegion
+                && page.fenceValue <= completedFenceValue) {
+                page.tailOffset = 0;
+                page.inUse = false;
+            }
+        }
+
+        const Resource* activeBuffer = m_activePage < m_pages.size() ? m_pages[m_activePage].buffer.get() : nullptr;
+        m_stats.pagesTrimmed += std::erase_if(m_pages, [&](const Page& page) {
+            return page.buffer.get() != activeBuffer
+                && !page.inUse
+                && m_reclaimCount - page.lastUsedReclaim > kTrimIdleReclaims;
+        });
+        m_activePage = FindPageIndex(activeBuffer);
+    }
+
+    /// Closes the open region and reclaims as if every copy had completed.
+    /// Only for callers that have already waited for the copy queue to idle.
+    /// Allocations that were never submitted are kept.
+    void ResetForFrame() {
+        CloseRegion(0);
+        Reclaim(std::numeric_limits<uint64_t>::max());
     }
 
     /// Release all pages.
     void Cleanup() {
         std::lock_guard<std::mutex> lock(m_mutex);
         m_pages.clear();
-        m_activePage = 0;
+        m_activePage = kNoPage;
     }
 
-    static constexpr size_t kDefaultPageSize = 64 * 1024 * 1024; // 64 MB
+    size_t GetResidentBytes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t bytes = 0;
+        for (const auto& page : m_pages) {
+            bytes += page.capacity;
+        }
+        return bytes;
+    }
+
+    struct Stats {
+        uint64_t allocations = 0;
+        uint64_t allocatedBytes = 0;
+        uint64_t pageSwitches = 0; // Allocations that moved to a recycled page
+        uint64_t pagesCreated = 0;
+        uint64_t pagesTrimmed = 0;
+    };
+
+    Stats GetStats() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_stats;
+    }
 
 private:
     struct Page {
         std::shared_ptr<Resource> buffer;
         size_t capacity = 0;
         size_t tailOffset = 0;
+        uint32_t pendingAllocations = 0; // Allocated but not yet submitted
+        bool inUse = false;              // Holds data since its last rewind
+        bool inOpenRegion = false;       // Submitted since the last CloseRegion
+        uint64_t fenceValue = 0;         // Latest closed region that read from this page
+        uint64_t lastUsedReclaim = 0;
     };
 
+    static constexpr size_t kNoPage = std::numeric_limits<size_t>::max();
+
     void AddPage(size_t minSize) {
         size_t allocSize = std::max(minSize, m_pageSize);
         auto buffer = Buffer::CreateShared(rhi::HeapType::Upload, allocSize, /*uav=*/false);
         buffer->SetName("AsyncCopyPagePool::Page");
-        m_pages.push_back({ std::move(buffer), allocSize, 0 });
+        Page page;
+        page.buffer = std::move(buffer);
+        page.capacity = allocSize;
+        m_pages.push_back(std::move(page));
         m_activePage = m_pages.size() - 1;
     }
 
+    Page* FindPage(const Resource* buffer) {
+        for (auto& page : m_pages) {
+            if (page.buffer.get() == buffer) {
+                return &page;
+            }
+        }
+        return nullptr;
+    }
+
+    size_t FindPageIndex(const Resource* buffer) const {
+        for (size_t i = 0; i < m_pages.size(); ++i) {
+            if (m_pages[i].buffer.get() == buffer) {
+                return i;
+            }
+        }
+        return kNoPage;
+    }
+
     static size_t AlignUp(size_t value, size_t alignment) noexcept {
         return (value + alignment - 1) & ~(alignment - 1);
     }
 
     size_t m_pageSize;
     std::vector<Page> m_pages;
-    size_t m_activePage = 0;
+    size_t m_activePage = kNoPage;
+    uint64_t m_reclaimCount = 0;
+    Stats m_stats{};
     std::mutex m_mutex;
 };
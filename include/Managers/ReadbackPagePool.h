@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "Resources/Buffers/Buffer.h"
+#include "Resources/ReadbackRequest.h"
+
+/// A ring of persistently mapped Readback-heap pages that capture passes
+/// sub-allocate from, so small per-frame readbacks don't create a buffer each.
+///
+/// ReadbackManager keeps one pool per queue kind. The lifetime of an
+/// allocation is:
+///   1. Allocate() bump-allocates from the active page, moving on around the
+///      ring to the next page with no live allocations when it is full.
+///   2. The capture's fence completes and ReadbackManager reads the data
+///      through the page's persistent mapping.
+///   3. Release() drops the allocation; a page with none left is rewound the
+///      next time the ring reaches it.
+/// Reclaim() trims pages that have sat empty for kTrimIdleReclaims calls.
+class ReadbackPagePool {
+public:
+    static constexpr size_t kDefaultPageSize = 4 * 1024 * 1024; // 4 MB
+    static constexpr uint64_t kTrimIdleReclaims = 240;
+
+    explicit ReadbackPagePool(size_t pageSize = kDefaultPageSize)
+        : m_pageSize(pageSize) {
+    }
+
+    ~ReadbackPagePool() {
+        Cleanup();
+    }
+
+    ReadbackPagePool(const ReadbackPagePool&) = delete;
+    ReadbackPagePool& operator=(const ReadbackPagePool&) = delete;
+
+    /// Allocate `size` bytes with the given alignment. Requests larger than
+    /// the page size get a page of their own. `shareCount` is how many
+    /// Release calls will cover the allocation. Thread-safe.
+    ReadbackAllocation Allocate(size_t size, size_t alignment, const char* pageName, uint32_t shareCount = 1) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+
+        Page* page = m_activePage < m_pages.size() ? &m_pages[m_activePage] : nullptr;
+        if (page && page->liveAllocations == 0) {
+            page->tailOffset = 0;
+        }
+        size_t aligned = page ? AlignUp(page->tailOffset, alignment) : 0;
+        if (!page || aligned + size > page->capacity) {
+            page = nullptr;
+            const size_t count = m_pages.size();
+            const size_t start = m_activePage < count ? m_activePage + 1 : 0;
+            for (size_t i = 0; i < count; ++i) {
+                const size_t index = (start + i) % count;
+                if (m_pages[index].liveAllocations == 0 && m_pages[index].capacity >= size) {
+                    m_activePage = index;
+                    page = &m_pages[index];
+                    break;
+                }
+            }
+            if (!page) {
+                if (!AddPage(size, pageName)) {
+                    return {};
+                }
+                page = &m_pages[m_activePage];
+            }
+            page->tailOffset = 0;
+            aligned = 0;
+        }
+
+        page->tailOffset = aligned + size;
+        page->liveAllocations += shareCount;
+        page->lastUsedReclaim = m_reclaimCount;
+        return { page->buffer, aligned, page->mapped + aligned };
+    }
+
+    /// The data of one allocation in `buffer` has been consumed.
+    void Release(const Resource* buffer) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& page : m_pages) {
+            if (page.buffer.get() == buffer) {
+                if (page.liveAllocations > 0) {
+                    --page.liveAllocations;
+                }
+                page.lastUsedReclaim = m_reclaimCount;
+                return;
+            }
+        }
+    }
+
+    /// Trim long-empty pages. Call once per frame.
+    void Reclaim() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ++m_reclaimCount;
+        const Resource* activeBuffer = m_activePage < m_pages.size() ? m_pages[m_activePage].buffer.get() : nullptr;
+        std::erase_if(m_pages, [&](Page& page) {
+            const bool trim = page.buffer.get() != activeBuffer
+                && page.liveAllocations == 0
+                && m_reclaimCount - page.lastUsedReclaim > kTrimIdleReclaims;
+            if (trim) {
+                Unmap(page);
+            }
+            return trim;
+        });
+        m_activePage = kNoPage;
+        for (size_t i = 0; i < m_pages.size(); ++i) {
+            if (m_pages[i].buffer.get() == activeBuffer) {
+                m_activePage = i;
+            }
+        }
+    }
+
+    /// Unmap and release all pages. Outstanding allocations keep their
+    /// buffers alive but must not be read through their mapping afterwards.
+    void Cleanup() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto& page : m_pages) {
+            Unmap(page);
+        }
+        m_pages.clear();
+        m_activePage = kNoPage;
+    }
+
+    size_t GetResidentBytes() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t bytes = 0;
+        for (const auto& page : m_pages) {
+            bytes += page.capacity;
+        }
+        return bytes;
+    }
+
+private:
+    struct Page {
+        std::shared_ptr<Resource> buffer;
+        const std::byte* mapped = nullptr;
+        size_t capacity = 0;
+        size_t tailOffset = 0;
+        uint32_t liveAllocations = 0; // Allocated and not yet released
+        uint64_t lastUsedReclaim = 0;
+    };
+
+    static constexpr size_t kNoPage = std::numeric_limits<size_t>::max();
+
+    bool AddPage(size_t minSize, const char* pageName) {
+        const size_t allocSize = std::max(minSize, m_pageSize);
+        auto buffer = Buffer::CreateShared(rhi::HeapType::Readback, allocSize);
+        buffer->SetName(pageName);
+        void* mapped = nullptr;
+        buffer->GetAPIResource().Map(&mapped);
+        if (!mapped) {
+            return false;
+        }
+        Page page;
+        page.buffer = std::move(buffer);
+        page.mapped = static_cast<const std::byte*>(mapped);
+        page.capacity = allocSize;
+        page.lastUsedReclaim = m_reclaimCount;
+        m_pages.push_back(std::move(page));
+        m_activePage = m_pages.size() - 1;
+        return true;
+    }
+
+    static void Unmap(Page& page) {
+        if (page.mapped) {
+            page.buffer->GetAPIResource().Unmap(0, 0);
+            page.mapped = nullptr;
+        }
+    }
+
+    static size_t AlignUp(size_t value, size_t alignment) noexcept {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    size_t m_pageSize;
+    std::vector<Page> m_pages;
+    size_t m_activePage = kNoPage;
+    uint64_t m_reclaimCount = 0;
+    std::mutex m_mutex;
+};
@@ -17,6 +17,7 @@
 #include <rhi_helpers.h>
 
 #include "Render/Runtime/UploadTypes.h"
+#include "Render/Runtime/ITaskService.h"
 
 namespace rg::imm { class ImmediateCommandList; }
 class Resource;
@@ -36,6 +37,7 @@ class Buffer;
 class UploadInstance {
 public:
 	using UploadTarget        = rg::runtime::UploadTarget;
+	using UploadReservation   = rg::runtime::UploadReservation;
 	using UploadResolveContext = rg::runtime::UploadResolveContext;
 
 	static constexpr size_t kDefaultPageSize = 16 * 1024 * 1024; // 16 MB
@@ -48,6 +50,11 @@ public:
 		std::string debugName = "UploadInstance";
 		std::string pageNamePrefix = "UploadInstancePage";
 		std::string usageHint = "UploadInstance page";
+		// UploadData copies at least this large are split across the task service; 0 disables.
+		size_t parallelCopyThresholdBytes = 0;
+		// Look up target names when an update is queued. When false only the global resource ID
+		// is recorded and names are resolved when DescribeQueuedTargetByGlobalResourceId asks.
+		bool captureTargetNamesOnQueue = true;
 	};
 
 	struct ResourceUpdate {
@@ -65,7 +72,8 @@ public:
 		uint8_t stackSize{};
 #endif
 		uint64_t targetGlobalResourceId = 0;
-		std::string targetDebugName;
+		const std::string* targetDebugName = nullptr; // Interned; see InternDebugName
+		uint64_t sequence = 0; // Queue order across threads; see DrainThreadLanesLocked
 	};
 
 	struct TextureUpdate {
@@ -82,11 +90,12 @@ public:
 		int line{};
 #endif
 		uint64_t targetGlobalResourceId = 0;
-		std::string targetDebugName;
+		const std::string* targetDebugName = nullptr; // Interned; see InternDebugName
 	};
 
 	using PendingWorkChangedCallback = std::function<void()>;
-	using TargetTelemetryCallback = std::function<void(const UploadTarget&, uint64_t&, std::string&)>;
+	// outName is null when only the ID is wanted; names are filled in with InternDebugName.
+	using TargetTelemetryCallback = std::function<void(const UploadTarget&, uint64_t&, const std::string** outName)>;
 	using InvalidRegistryHandleCallback = std::function<bool(const UploadTarget&, const char* reason, const char* file, int line)>;
 
 	// Construct an upload instance.
@@ -109,6 +118,17 @@ public:
 	void UploadData(const void* data, size_t size, UploadTarget target, size_t dstOffset);
 #endif
 
+	// Zero-copy buffer uploads: reserve `size` bytes of a mapped upload page, write them in place,
+	// then commit to queue the copy into `target` at `dstOffset`. Returns an empty reservation for
+	// a zero size or when the page can't be mapped. Commit may happen on any thread.
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+	UploadReservation ReserveUpload(UploadTarget target, size_t dstOffset, size_t size,
+	                                const char* file = nullptr, int line = 0);
+#else
+	UploadReservation ReserveUpload(UploadTarget target, size_t dstOffset, size_t size);
+#endif
+	void CommitUpload(UploadReservation&& reservation);
+
 	// Texture uploads
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
 	void UploadTextureSubresources(
@@ -152,6 +172,11 @@ public:
 	void SetPendingWorkChangedCallback(PendingWorkChangedCallback callback);
 	void SetTargetTelemetryCallback(TargetTelemetryCallback callback);
 	void SetInvalidRegistryHandleCallback(InvalidRegistryHandleCallback callback);
+	void SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService);
+
+	// Returns a stable pointer to a shared copy of `name`, valid for the life of the process.
+	// Upload records keep these instead of owning strings. Thread-safe.
+	static const std::string* InternDebugName(const std::string& name);
 
 	// Returns true if there are any pending buffer or texture uploads.
 	bool HasPendingWork() const;
@@ -180,19 +205,48 @@ private:
 	};
 	using UploadPagePtr = std::shared_ptr<UploadPage>;
 
+	// Per-thread staging for UploadData. The owning thread bump-allocates from a slice of the
+	// shared active page and records its updates here, so m_uploadQueueMutex is only taken once
+	// per slice. Other threads take `mutex` only to drain the updates or drop the slice.
+	struct ThreadUploadLane {
+		std::mutex mutex;
+		std::shared_ptr<Resource> sliceBuffer;
+		size_t sliceCursor = 0;
+		size_t sliceEnd = 0;
+		uint64_t sliceGeneration = 0;
+		std::vector<ResourceUpdate> updates;
+	};
+
+	static constexpr size_t kThreadSliceBytes = 1024 * 1024;
+	// Chunk size for parallel UploadData copies; a multiple of the OS page so no two workers
+	// write the same page of write-combined memory.
+	static constexpr size_t kParallelCopyChunkBytes = 4 * 1024 * 1024;
+
 	// Internal helpers
 
 	bool AllocateUploadRegion(size_t size, size_t alignment,
 	                          std::shared_ptr<Resource>& outUploadBuffer, size_t& outOffset);
 
 	static bool TryCoalesceAppend(ResourceUpdate& last, const ResourceUpdate& next) noexcept;
+	ThreadUploadLane& GetThreadUploadLane();
+	bool TryAllocateFromThreadSlice(ThreadUploadLane& lane, size_t size,
+	                                std::shared_ptr<Resource>& outUploadBuffer, size_t& outOffset) const;
+	uint64_t AllocateThreadUploadRegion(ThreadUploadLane& lane, size_t size,
+	                                    std::shared_ptr<Resource>& outUploadBuffer, size_t& outOffset);
+	void QueueThreadLaneUpdate(ThreadUploadLane& lane, ResourceUpdate&& update);
+	// Writes straight into a DirectWrite buffer's mapped memory, skipping the upload pass.
+	bool TryWriteDirect(const void* data, size_t size, const UploadTarget& target, size_t dstOffset);
+	void AppendResourceUpdateLocked(ResourceUpdate&& update);
+	void DrainThreadLanesLocked();
+	void ResetThreadLanesLocked(bool dropUpdates);
 
 	static void MapUpload(const std::shared_ptr<Resource>& uploadBuffer, size_t mapSize,
 	                       uint8_t** outMapped) noexcept;
 	static void UnmapUpload(const std::shared_ptr<Resource>& uploadBuffer) noexcept;
+	void CopyToUpload(uint8_t* destination, const void* source, size_t size);
 	void MarkPendingWorkChangedLocked();
-	void CaptureTargetTelemetryLocked(const UploadTarget& target, uint64_t& outId, std::string& outName);
-	void RefreshQueuedTargetTelemetryLocked();
+	void CaptureTargetTelemetryLocked(const UploadTarget& target, uint64_t& outId, const std::string*& outName, bool withName);
+	void RefreshQueuedTargetTelemetryLocked(bool withNames);
 	void PruneInvalidRegistryHandleUpdatesLocked(const char* reason);
 	UploadPagePtr CreatePage(size_t size, bool dedicated);
 	void TagPage(const UploadPagePtr& page);
@@ -210,6 +264,8 @@ private:
 
 	size_t                     m_pageSize;
 	size_t                     m_preallocateCapacityBytes = kDefaultPreallocateCapacity;
+	size_t                     m_parallelCopyThresholdBytes = 0;
+	bool                       m_captureTargetNamesOnQueue = true;
 	std::string                m_debugName = "UploadInstance";
 	std::string                m_pageNamePrefix = "UploadInstancePage";
 	std::string                m_usageHint = "UploadInstance page";
@@ -230,11 +286,23 @@ private:
 	std::vector<TextureUpdate>   m_textureUpdates;
 
 	UploadResolveContext m_ctx{};
+	std::shared_ptr<rg::runtime::ITaskService> m_taskService;
 	PendingWorkChangedCallback m_pendingWorkChanged;
 	TargetTelemetryCallback m_targetTelemetry;
 	InvalidRegistryHandleCallback m_invalidRegistryHandle;
 
 	mutable std::mutex m_uploadQueueMutex;
+
+	// Lock order: m_uploadQueueMutex, then m_threadLaneRegistryMutex, then a lane's mutex. A lane
+	// owner never holds its lane mutex while taking m_uploadQueueMutex.
+	uint64_t m_instanceSerial = 0;
+	std::atomic<uint64_t> m_uploadSequence = 0;
+	std::atomic<uint64_t> m_sliceGeneration = 0;
+	std::atomic_size_t m_pendingLaneUpdates = 0;
+	std::atomic<uint64_t> m_directWriteBytes = 0;
+	mutable std::mutex m_threadLaneRegistryMutex;
+	std::vector<std::unique_ptr<ThreadUploadLane>> m_threadLanes;
+
 	std::mutex m_workerMutex;
 	std::condition_variable m_workerCV;
 	std::thread m_workerThread;
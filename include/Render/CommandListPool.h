@@ -1,5 +1,6 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <condition_variable>
 #include <deque>
@@ -8,32 +9,68 @@
 #include <vector>
 #include <cstdint>
 #include <atomic>
+#include <memory>
 #include <rhi.h>
 
+namespace rg::runtime {
+class ITaskService;
+}
+
 struct CommandListPair {
     rhi::CommandAllocatorPtr allocator;
     rhi::CommandListPtr list;
+    // Largest size hint this pair has been requested for: a stand-in for the allocator's memory
+    // high-water mark, which the rhi does not report. Allocators keep their grown memory across
+    // resets, so Request matches pairs to similarly sized work.
+    uint64_t footprint = 0;
 };
 
+// Available pairs live in per-thread shards, so concurrent Request calls from recording workers
+// rarely share a lock. A shard that runs dry steals from the others before creating a new pair.
+// Completed pairs come back through the central fence-ordered in-flight queue and background
+// reset jobs on the task service, which take them in chunks and spread them across the shards.
+//
+// PrepareForRequests resets still-pending pairs on the calling thread before it creates new ones.
+// RecycleCompleted also tops the pool up ahead of time: when fewer pairs than the last frame
+// requested are available or on their way back, the jobs create the rest in the background.
+// Without a task service every reset happens in PrepareForRequests.
 class CommandListPool {
 public:
+    static constexpr size_t kShardCount = 8;
+
     struct Diagnostics {
         size_t lastRequestedCount = 0;
         size_t availableCount = 0;
+        std::array<size_t, kShardCount> availableByShard{};
         size_t inFlightCount = 0;
         size_t createdThisFrame = 0;
         size_t reusedThisFrame = 0;
+        size_t stolenThisFrame = 0; // Reused from another thread's shard
         size_t preparedDeficit = 0;
         size_t enqueuedForBackgroundResetThisFrame = 0;
         size_t backgroundResetCompletedThisFrame = 0;
         size_t backgroundResetPendingCount = 0;
+        size_t resetOnCallerThisFrame = 0; // Pending pairs PrepareForRequests reset itself
+        size_t createdAheadThisFrame = 0;  // Created by background jobs for the next frame
+        size_t backgroundResetWorkerCount = 0; // Most background jobs in flight at once
     };
 
-    CommandListPool(rhi::Device& device, rhi::QueueKind type);
+    CommandListPool(
+        rhi::Device& device,
+        rhi::QueueKind type,
+        uint32_t resetWorkerCount = 1,
+        std::shared_ptr<rg::runtime::ITaskService> taskService = nullptr);
+    // Waits for the pool's background jobs; one that never started only counts as done once the
+    // service destroys it.
     ~CommandListPool();
 
-    // Acquire a command allocator / list pair ready for recording
-    CommandListPair Request();
+    // Later background resets go to `taskService`; jobs already submitted finish where they are.
+    void SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService);
+
+    // Acquire a command allocator / list pair ready for recording. `sizeHint` estimates the
+    // recording (in the caller's units, used consistently); the pool hands out the pair with the
+    // smallest footprint that covers it, else its largest. 0 takes any pair.
+    CommandListPair Request(uint64_t sizeHint = 0);
 
     // Reclaim completed pairs and ensure at least requiredCount are available
     // for immediate Request() calls.
@@ -47,29 +84,50 @@ public:
     // Queue any completed command lists for background reset.
     void RecycleCompleted(uint64_t completedFenceValue);
 
-    Diagnostics GetDiagnostics() const {
-        std::lock_guard lock(m_mutex);
-        return m_diagnostics;
-    }
+    Diagnostics GetDiagnostics() const;
 
 private:
+    struct BackgroundJob;
+
+    struct alignas(64) Shard {
+        mutable std::mutex mutex;
+        std::vector<CommandListPair> available;
+    };
+
+    Shard& LocalShard();
+    bool TryPopAvailable(CommandListPair& pair, uint64_t sizeHint);
+    static bool TryPopBestFit(std::vector<CommandListPair>& available, uint64_t sizeHint, CommandListPair& pair);
+    // Deals pairs round-robin across the shards.
+    void DistributeAvailable(std::vector<CommandListPair>& pairs);
+    size_t CountAvailable() const;
     void PreparePairForReuse(CommandListPair& pair);
     CommandListPair CreateReadyPair();
-    void BackgroundResetMain();
+    size_t MoveCompletedToPendingLocked(uint64_t completedFenceValue);
+    void ScheduleAheadCreatesLocked();
+    // Submits background jobs until `wantedJobs` (capped at the worker count) are in flight.
+    void ScheduleBackgroundResets(size_t wantedJobs);
+    void RunBackgroundResets(BackgroundJob& job);
+    void FinishBackgroundJobLocked();
     void UpdateDiagnosticsCountsLocked();
 
     rhi::Device m_device;
     rhi::QueueKind m_type;
     std::atomic<uint64_t> m_nextDebugNameId{ 1 };
-    Diagnostics m_diagnostics{};
+    Diagnostics m_diagnostics{}; // Guarded by m_mutex; per-request counters are the atomics below
+    std::atomic<size_t> m_createdThisFrame{ 0 };
+    std::atomic<size_t> m_reusedThisFrame{ 0 };
+    std::atomic<size_t> m_stolenThisFrame{ 0 };
 
     mutable std::mutex m_mutex;
-    std::condition_variable m_backgroundResetCv;
-    std::thread m_backgroundResetThread;
+    std::shared_ptr<rg::runtime::ITaskService> m_taskService;
+    std::condition_variable m_backgroundJobsIdleCv;
+    size_t m_backgroundJobCount = 0;
     bool m_stopBackgroundReset = false;
     size_t m_backgroundResetActiveCount = 0;
+    size_t m_pendingAheadCreates = 0;
 
-    std::vector<CommandListPair> m_available;
+    std::array<Shard, kShardCount> m_shards;
+    std::atomic<size_t> m_nextDistributeShard{ 0 };
     std::deque<std::pair<uint64_t, CommandListPair>> m_inFlight;
     std::vector<CommandListPair> m_pendingBackgroundReset;
 };
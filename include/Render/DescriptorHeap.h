@@ -2,9 +2,16 @@
 
 #include <wrl/client.h>
 #include <rhi.h>
-#include <queue>
+#include <array>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <span>
 #include <vector>
 #include <mutex>
+#include <string>
+#include <unordered_map>
+#include <variant>
 
 class DescriptorHeap {
 public:
@@ -16,17 +23,95 @@ public:
     DescriptorHeap& operator=(const DescriptorHeap&) = delete;
 
     rhi::DescriptorHeap GetHeap();
+    uint32_t GetCapacity() const { return m_totalSize; }
+    UINT GetHighWaterMark();
 
+    // Swaps in a larger heap; indices stay valid but its contents start empty. Returns the old
+    // heap, which the caller keeps alive until the GPU is done with it. Frame boundaries only.
+    rhi::DescriptorHeapPtr Grow(rhi::Device& device, uint32_t newCapacity);
+
+    // For heaps that can grow: the last view written to each live slot, so a grown heap can be
+    // re-populated. Off unless enabled; releasing a slot drops its record.
+    using ViewDesc = std::variant<rhi::CbvDesc, rhi::SrvDesc, rhi::UavDesc>;
+    struct ViewRecord {
+        rhi::ResourceHandle resource;
+        ViewDesc desc;
+    };
+    void EnableViewRecords();
+    void RecordView(UINT index, rhi::ResourceHandle resource, const ViewDesc& desc);
+    std::vector<std::pair<UINT, ViewRecord>> SnapshotViewRecords();
+
+    // Single slots come from a small per-thread-shard magazine that refills from, and spills
+    // back to, the central free list in batches, so parallel callers rarely share a lock.
     UINT AllocateDescriptor();
     void ReleaseDescriptor(UINT index);
+    // Returns many single slots under one central lock, coalescing adjacent indices.
+    void ReleaseDescriptors(std::span<const UINT> indices);
+    // Bulk release of slots from mixed heaps, one ReleaseDescriptors call per heap.
+    static void ReleaseDescriptorSlots(std::span<const std::pair<std::shared_ptr<DescriptorHeap>, UINT>> slots);
+
+    // Contiguous block of `count` descriptors; returns the first index. Freed descriptors, single
+    // or ranged, coalesce with their free neighbours, so blocks can be released piecewise.
+    UINT AllocateDescriptorRange(UINT count);
+    void ReleaseDescriptorRange(UINT firstIndex, UINT count);
+
+    // Cumulative counters, kept under the locks each path already takes.
+    struct Stats {
+        uint64_t singleAllocations = 0;
+        uint64_t singleReleases = 0;
+        uint64_t magazineRefills = 0;
+        uint64_t magazineSpills = 0;
+        uint64_t magazineLockContended = 0; // Single-slot calls that found their shard locked
+        uint64_t rangeAllocations = 0;      // Including single slots that fell through to the central list
+        uint64_t rangeReleases = 0;         // ReleaseDescriptorRange and ReleaseDescriptors calls
+        uint64_t magazineDrains = 0;
+    };
+    Stats GetStats() const;
 
 private:
+    static constexpr size_t kMagazineShardCount = 16;
+    static constexpr size_t kMagazineRefillCount = 64;
+    static constexpr size_t kMagazineCapacity = 2 * kMagazineRefillCount;
+
+    struct alignas(64) MagazineShard {
+        mutable std::mutex mutex;
+        std::vector<UINT> slots; // Popped from the back
+        uint64_t allocations = 0;
+        uint64_t releases = 0;
+        uint64_t refills = 0;
+        uint64_t spills = 0;
+        uint64_t contended = 0;
+    };
+
+    static std::unique_lock<std::mutex> LockMagazine(MagazineShard& magazine);
+
+    MagazineShard& LocalMagazine();
+    bool TryAllocateRangeUnlocked(UINT count, UINT& start);
+    void RefillMagazineUnlocked(std::vector<UINT>& slots);
+    void ReleaseSortedUnlocked(std::span<const UINT> sortedIndices);
+    // Hands every magazine's stash back to the central list; used before giving up on an allocation.
+    void DrainMagazines();
+    void InsertFreeRangeUnlocked(UINT start, UINT count);
+    void EraseFreeRangeUnlocked(std::map<UINT, UINT>::iterator byStart);
+    void ForgetViews(std::span<const UINT> indices);
+    void ForgetViewRange(UINT firstIndex, UINT count);
+
     rhi::DescriptorHeapPtr m_heap;
     UINT m_descriptorSize;
-    UINT m_numDescriptorsAllocated;
+    UINT m_numDescriptorsAllocated; // High-water mark; everything above it is free
     uint32_t m_totalSize;
-    std::queue<UINT> m_freeIndices;
+    // Free ranges below the high-water mark, by start (for coalescing) and by size (best fit).
+    std::map<UINT, UINT> m_freeRangesByStart;
+    std::multimap<UINT, UINT> m_freeRangesBySize;
     rhi::DescriptorHeapType m_type;
     bool m_shaderVisible;
-    std::mutex m_allocationMutex;
+    std::string m_name;
+    mutable std::mutex m_allocationMutex; // Guards the central free list and the high-water mark
+    uint64_t m_rangeAllocations = 0;      // Guarded by m_allocationMutex, like the two below
+    uint64_t m_rangeReleases = 0;
+    uint64_t m_magazineDrains = 0;
+    std::array<MagazineShard, kMagazineShardCount> m_magazines;
+    std::atomic<bool> m_viewRecordsEnabled{ false }; // Checked first so the release paths stay lock-free when off
+    std::unordered_map<UINT, ViewRecord> m_viewRecords;
+    std::mutex m_viewRecordMutex;
 };
\ No newline at end of file
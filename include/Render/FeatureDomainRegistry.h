@@ -1,10 +1,14 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
+#include <deque>
 #include <mutex>
 #include <optional>
+#include <shared_mutex>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "Resources/ResourceIdentifier.h"
@@ -68,6 +72,13 @@ namespace std {
     };
 }
 
+// Maps resource-name prefixes to feature domains and keeps each domain's enabled state.
+//
+// A lookup probes the resource name and each of its "::" prefixes, longest first, in a hash map
+// of the registered prefixes, and remembers the answer per resource until the mappings change.
+// Disabling a domain drops the passes declared as its members (InFeatureDomain on the builder)
+// from the compiled frame without a structural rebuild; passes that only read the domain's
+// resources keep running, and missing descriptors in a disabled domain are tolerated.
 class FeatureDomainRegistry {
 public:
     struct ResourceDomainMapping {
@@ -81,50 +92,109 @@ public:
     }
 
     void RegisterResourceDomain(const ResourceIdentifier& resourcePrefix, const FeatureDomainIdentifier& domain) {
-        std::scoped_lock lock(m_mutex);
-
-        auto existing = std::find_if(
-            m_resourceDomainMappings.begin(),
-            m_resourceDomainMappings.end(),
-            [&](const ResourceDomainMapping& entry) {
-                return entry.resourcePrefix == resourcePrefix;
-            });
-
-        if (existing != m_resourceDomainMappings.end()) {
-            existing->domain = domain;
-        }
-        else {
-            m_resourceDomainMappings.push_back(ResourceDomainMapping{ resourcePrefix, domain });
-        }
+        std::unique_lock lock(m_mutex);
+        m_domainIndexByPrefix[std::string(resourcePrefix.name)] = InternDomainLocked(domain);
+        m_domainIndexByResource.clear();
     }
 
     std::optional<FeatureDomainIdentifier> FindResourceDomain(const ResourceIdentifier& resourceId) const {
-        std::scoped_lock lock(m_mutex);
-
-        const ResourceDomainMapping* bestMatch = nullptr;
-        for (const auto& entry : m_resourceDomainMappings) {
-            if (!(resourceId == entry.resourcePrefix || resourceId.hasPrefix(entry.resourcePrefix))) {
-                continue;
-            }
+        const FeatureDomainIdentifier* domain = LookupResourceDomain(resourceId);
+        if (!domain) {
+            return std::nullopt;
+        }
+        return *domain;
+    }
 
-            if (!bestMatch || entry.resourcePrefix.segments.size() > bestMatch->resourcePrefix.segments.size()) {
-                bestMatch = &entry;
+    // Like FindResourceDomain without the copy; the pointer stays valid for the registry's lifetime.
+    const FeatureDomainIdentifier* LookupResourceDomain(const ResourceIdentifier& resourceId) const {
+        {
+            std::shared_lock lock(m_mutex);
+            auto it = m_domainIndexByResource.find(resourceId);
+            if (it != m_domainIndexByResource.end()) {
+                return it->second == kNoDomain ? nullptr : &m_domains[it->second].domain;
             }
         }
 
-        if (!bestMatch) {
-            return std::nullopt;
+        std::unique_lock lock(m_mutex);
+        const size_t domainIndex = FindLongestPrefixLocked(resourceId.name);
+        m_domainIndexByResource.emplace(resourceId, domainIndex);
+        return domainIndex == kNoDomain ? nullptr : &m_domains[domainIndex].domain;
+    }
+
+    void SetDomainEnabled(const FeatureDomainIdentifier& domain, bool enabled) {
+        std::unique_lock lock(m_mutex);
+        auto& state = m_domains[InternDomainLocked(domain)];
+        if (state.enabled == enabled) {
+            return;
         }
+        state.enabled = enabled;
+        m_disabledDomainCount.fetch_add(enabled ? -1 : 1, std::memory_order_relaxed);
+        m_domainStateVersion.fetch_add(1, std::memory_order_release);
+    }
+
+    bool IsDomainEnabled(const FeatureDomainIdentifier& domain) const {
+        std::shared_lock lock(m_mutex);
+        auto it = m_domainIndexByName.find(domain.name);
+        return it == m_domainIndexByName.end() || m_domains[it->second].enabled;
+    }
 
-        return bestMatch->domain;
+    // Lets per-frame callers skip the enabled checks while every domain is enabled.
+    bool HasDisabledDomains() const noexcept {
+        return m_disabledDomainCount.load(std::memory_order_relaxed) > 0;
+    }
+
+    // Bumped whenever a domain is enabled or disabled.
+    uint64_t GetDomainStateVersion() const noexcept {
+        return m_domainStateVersion.load(std::memory_order_acquire);
     }
 
 private:
+    static constexpr size_t kNoDomain = ~size_t(0);
+
+    struct DomainState {
+        FeatureDomainIdentifier domain;
+        bool enabled = true;
+    };
+
+    struct StringHash {
+        using is_transparent = void;
+        size_t operator()(std::string_view s) const noexcept { return std::hash<std::string_view>{}(s); }
+    };
+
     FeatureDomainRegistry() {
         RegisterResourceDomain(ResourceIdentifier{ "Builtin::Shadows" }, FeatureDomainIdentifier{ "Builtin::FeatureDomains::Shadows" });
         RegisterResourceDomain(ResourceIdentifier{ "Builtin::GTAO" }, FeatureDomainIdentifier{ "Builtin::FeatureDomains::GTAO" });
     }
 
-    mutable std::mutex m_mutex;
-    std::vector<ResourceDomainMapping> m_resourceDomainMappings;
+    size_t InternDomainLocked(const FeatureDomainIdentifier& domain) {
+        auto [it, inserted] = m_domainIndexByName.try_emplace(domain.name, m_domains.size());
+        if (inserted) {
+            m_domains.push_back(DomainState{ domain });
+        }
+        return it->second;
+    }
+
+    size_t FindLongestPrefixLocked(std::string_view name) const {
+        // Same matches as ResourceIdentifier::hasPrefix: the whole name, then each "::" boundary,
+        // then the empty prefix.
+        for (std::string_view prefix = name;;) {
+            auto it = m_domainIndexByPrefix.find(prefix);
+            if (it != m_domainIndexByPrefix.end()) {
+                return it->second;
+            }
+            if (prefix.empty()) {
+                return kNoDomain;
+            }
+            const size_t pos = prefix.rfind("::");
+            prefix = pos == std::string_view::npos ? std::string_view{} : prefix.substr(0, pos);
+        }
+    }
+
+    mutable std::shared_mutex m_mutex;
+    std::deque<DomainState> m_domains; // Stable addresses for LookupResourceDomain
+    std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> m_domainIndexByName;
+    std::unordered_map<std::string, size_t, StringHash, std::equal_to<>> m_domainIndexByPrefix;
+    mutable std::unordered_map<ResourceIdentifier, size_t, ResourceIdentifier::Hasher> m_domainIndexByResource;
+    std::atomic<int64_t> m_disabledDomainCount{ 0 };
+    std::atomic<uint64_t> m_domainStateVersion{ 0 };
 };
\ No newline at end of file
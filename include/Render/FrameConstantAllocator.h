@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <type_traits>
+#include <vector>
+
+#include <rhi.h>
+
+class Buffer;
+
+// One sub-allocation from FrameConstantAllocator. 'cpu' is write-only, combined memory and stays
+// valid until the frame the allocation was made in has retired on the GPU.
+struct FrameConstantAllocation {
+	std::byte* cpu = nullptr;
+	Buffer* buffer = nullptr;          // Page holding the data
+	uint64_t offset = 0;               // Byte offset into the page, a multiple of kAlignment
+	uint64_t size = 0;                 // Requested size, not rounded up
+	uint32_t pageDescriptorIndex = UINT32_MAX; // StructuredBuffer<uint> SRV of the page; read at offset / 4
+
+	explicit operator bool() const noexcept { return cpu != nullptr; }
+};
+
+// Per-frame linear allocator for constants a pass writes while it records: draw and dispatch
+// parameters that change every frame and would otherwise each need a persistent buffer and an
+// upload. The graph owns one and hands it to passes through PassExecutionContext::constantAllocator.
+//
+// Allocations bump through CPU-writable pages (CPU-visible device-local memory when the heap
+// budget allows, otherwise an upload heap), so nothing is copied and nothing transitions. The
+// graph calls BeginFrame at the start of Update, before passes update (WithTransientUpload data is
+// allocated then, too), and EndFrame with the frame's last queue signals after it submits; pages
+// used by that frame go back to the free list once the GPU has passed every one of those signals.
+// If none has retired yet, the allocator grows rather than waiting. Requests larger than a page get a dedicated page that is released when it retires.
+//
+// Thread-safe: parallel pass parts allocate concurrently.
+class FrameConstantAllocator {
+public:
+	static constexpr uint64_t kAlignment = 256; // Constant buffer placement alignment
+	static constexpr uint64_t kDefaultPageSize = 256ull * 1024ull;
+
+	struct FencePoint {
+		rhi::Timeline timeline;
+		uint64_t value = 0;
+	};
+
+	struct Stats {
+		uint64_t allocationsLastFrame = 0;
+		uint64_t bytesAllocatedLastFrame = 0; // Including alignment padding
+		uint64_t pagesUsedLastFrame = 0;
+		uint64_t livePages = 0;
+		uint64_t liveBytes = 0;
+		uint64_t pagesCreated = 0;
+		uint64_t dedicatedPagesCreated = 0;
+	};
+
+	explicit FrameConstantAllocator(uint64_t pageSize = kDefaultPageSize);
+	~FrameConstantAllocator();
+
+	FrameConstantAllocator(const FrameConstantAllocator&) = delete;
+	FrameConstantAllocator& operator=(const FrameConstantAllocator&) = delete;
+
+	// Returns an empty allocation if a page could not be created or mapped.
+	FrameConstantAllocation Allocate(uint64_t size);
+
+	template<class T>
+	FrameConstantAllocation Push(const T& value) {
+		static_assert(std::is_trivially_copyable_v<T>, "Frame constants are copied byte-wise");
+		FrameConstantAllocation allocation = Allocate(sizeof(T));
+		if (allocation) {
+			std::memcpy(allocation.cpu, &value, sizeof(T));
+		}
+		return allocation;
+	}
+
+	void BeginFrame();
+	// Indexed by queue slot, like DeletionManager::PublishRetirementFences: a slot without a new
+	// signal (value 0) keeps its previous value.
+	void EndFrame(std::span<const FencePoint> fencesBySlot);
+
+	Stats GetStats() const;
+
+private:
+	struct Page {
+		std::shared_ptr<Buffer> buffer;
+		std::byte* mapped = nullptr;
+		uint64_t size = 0;
+		uint64_t used = 0;
+		bool dedicated = false;
+	};
+
+	struct RetiringFrame {
+		std::vector<Page> pages;
+		std::shared_ptr<const std::vector<FencePoint>> fences;
+	};
+
+	Page CreatePage(uint64_t size, bool dedicated);
+	void ReleasePage(Page& page);
+	static bool FencesComplete(const RetiringFrame& frame);
+
+	const uint64_t m_pageSize;
+	mutable std::mutex m_mutex;
+	std::vector<Page> m_framePages; // Current page last; dedicated pages are inserted before it
+	std::vector<Page> m_freePages;
+	std::deque<RetiringFrame> m_retiringFrames; // In EndFrame order
+	std::vector<FencePoint> m_latestFencesBySlot;
+	Stats m_stats{};
+};
@@ -4,6 +4,7 @@
 #include <vector>
 #include <unordered_map>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <stdexcept>
 
@@ -160,6 +161,7 @@ namespace rg::imm {
         BytecodeReader(std::byte const* p, size_t n) : base(p), cur(p), end(p + n) {}
 
         bool Empty() const noexcept;
+        size_t Offset() const noexcept { return static_cast<size_t>(cur - base); }
         Op ReadOp();
 
         template<class T>
@@ -183,7 +185,27 @@ namespace rg::imm {
     };
 
     // Replay bytecode into a concrete RHI command list.
-    void Replay(std::vector<std::byte> const& bytecode, rhi::CommandList& cl, ImmediateDispatch const& dispatch);
+    void Replay(std::span<const std::byte> bytecode, rhi::CommandList& cl, ImmediateDispatch const& dispatch);
+
+    // Cut a stream into at most maxRanges runs of at least minOpsPerRange ops that can be
+    // replayed into separate command lists and submitted in order. Every resource an op writes
+    // is referenced by one run only, so no run needs a barrier against another. Returns the
+    // whole stream as one run when it cannot be cut.
+    std::vector<std::span<const std::byte>> SplitIndependentRanges(std::span<const std::byte> bytecode, uint32_t maxRanges, uint32_t minOpsPerRange);
+
+    struct BytecodeOptimizationStats {
+        uint32_t opsBefore = 0;
+        uint32_t copiesMerged = 0;   // CopyBufferRegions folded into the contiguous copy before them
+        uint32_t clearsDropped = 0;  // Clears overwritten by a later clear before anything touched them
+        uint32_t clearsOverwritten = 0; // Clears never recorded, as the pass overwrites the range in full
+        uint32_t Eliminated() const noexcept { return copiesMerged + clearsDropped + clearsOverwritten; }
+    };
+
+    // Peephole pass over a recorded stream, run before replay. Merges back-to-back contiguous
+    // CopyBufferRegions between the same buffers, and drops a clear when a later clear of the
+    // same kind covers its subresource with no op touching the resource in between. The ops
+    // left access the same resources and subresources, so derived requirements still hold.
+    BytecodeOptimizationStats OptimizeBytecode(std::vector<std::byte>& bytecode);
 
     struct LifetimePin {
         // type-erased owning payload
@@ -215,10 +237,14 @@ namespace rg::imm {
         std::vector<std::byte> bytecode;                 // replay payload
         std::vector<ResourceRequirement> requirements;   // merged segments
 		std::unique_ptr<KeepAliveBag> keepAlive; // Keeps owned resource wrappers alive for the frame. Only used by UploadManager, currently
+        bool requirementsReused = false;                 // Taken from the previous identical stream
+        BytecodeOptimizationStats optimization{};
         void Reset() {
 			bytecode.clear();
 			requirements.clear();
 			keepAlive.reset();
+			requirementsReused = false;
+			optimization = {};
 		}
     };
 
@@ -242,6 +268,13 @@ namespace rg::imm {
 
         void Reset();
 
+		// Run OptimizeBytecode over the stream in Finalize (on by default).
+		void SetOptimizeBytecode(bool enabled) noexcept { m_optimizeBytecode = enabled; }
+
+		// Ranges the pass's Execute overwrites in full. Clears of subresources inside them are not
+		// recorded, since the replayed stream runs first and the clear would be overwritten.
+		void SetFullOverwriteRanges(std::span<const ResourceHandleAndRange> ranges);
+
 		bool HasRecordedWork() const noexcept {
 			return !m_writer.data.empty();
 		}
@@ -442,6 +475,10 @@ namespace rg::imm {
         // Call after the pass finishes recording.
         FrameData Finalize();
 
+        // Finalize, but when the recorded stream matches `previousBytecode` byte for byte (same ops,
+        // handles and ranges) take `previousRequirements` instead of re-deriving them.
+        FrameData Finalize(std::span<const std::byte> previousBytecode, std::span<const ResourceRequirement> previousRequirements);
+
         struct SliceInterval {
             uint32_t lo = 0; // inclusive
             uint32_t hi = 0; // inclusive
@@ -480,6 +517,15 @@ namespace rg::imm {
 	        }
 	    };
 
+	    bool m_optimizeBytecode = true;
+
+	    struct FullOverwriteRange {
+	        uint64_t rid = 0;
+	        SubresourceRange range{};
+	    };
+	    std::vector<FullOverwriteRange> m_fullOverwrite;
+	    uint32_t m_clearsOverwritten = 0;
+
 	    // GlobalID -> handle (for ResourceRequirements)
 	    std::unordered_map<uint64_t, ResourceRegistry::RegistryHandle> m_handles;
 
@@ -487,6 +533,9 @@ namespace rg::imm {
 	    std::unordered_map<uint64_t, AccessAccumulator> m_access;
 
 
+        BytecodeOptimizationStats OptimizeRecordedStream();
+        FrameData FinalizeOptimized(const BytecodeOptimizationStats& optimization);
+
         Resolved Resolve(ResourceIdentifier const& id);
 
         Resolved Resolve(Resource* p);
@@ -497,6 +546,46 @@ namespace rg::imm {
 
         void Track(ResourceRegistry::RegistryHandle handle, uint64_t rid, const RangeSpec& range, rhi::ResourceAccessType access);
 
+        bool IsFullyOverwritten(uint64_t rid, uint32_t mip, uint32_t slice) const noexcept;
+
+        // Records one clear per subresource of range through emit, skipping fully overwritten ones,
+        // and tracks what was recorded.
+        template<class Emit>
+        void RecordClear(Resolved const& target, const RangeSpec& range, rhi::ResourceAccessType access, Emit&& emit)
+        {
+            const uint64_t rid = target.handle.GetGlobalResourceID();
+            if (m_fullOverwrite.empty()) {
+                if (ForEachMipSlice(target.handle, range, [&](uint32_t, uint32_t, const RangeSpec& exact) { emit(exact); })) {
+                    Track(target.handle, rid, range, access);
+                }
+                return;
+            }
+            std::vector<RangeSpec> recorded;
+            bool skipped = false;
+            ForEachMipSlice(target.handle, range,
+                [&](uint32_t mip, uint32_t slice, const RangeSpec& exact)
+                {
+                    if (IsFullyOverwritten(rid, mip, slice)) {
+                        ++m_clearsOverwritten;
+                        skipped = true;
+                        return;
+                    }
+                    emit(exact);
+                    recorded.push_back(exact);
+                });
+
+            if (recorded.empty()) {
+                return;
+            }
+            if (!skipped) {
+                Track(target.handle, rid, range, access);
+                return;
+            }
+            for (const RangeSpec& exact : recorded) {
+                Track(target.handle, rid, exact, access);
+            }
+        }
+
         void CopyBufferRegion(Resolved const& dst, uint64_t dstOffset,
             Resolved const& src, uint64_t srcOffset,
             uint64_t numBytes);
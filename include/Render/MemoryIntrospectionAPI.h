@@ -1,9 +1,12 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
 #include <mutex>
 #include <memory>
+#include <optional>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "Interfaces/IHasMemoryMetadata.h"
@@ -11,18 +14,59 @@
 namespace rg::memory {
 
 struct ResourceMemoryRecord {
+    uint64_t recordID = 0; // Stable for the life of the allocation; keys snapshot deltas
     uint64_t resourceID = 0;
     uint64_t bytes = 0;
     rhi::ResourceType resourceType = rhi::ResourceType::Unknown;
     std::string resourceName;
     std::string usage;
     std::string identifier;
+    std::optional<uint64_t> aliasingPoolID; // Pool heap, or placed resource inside one
+};
+
+struct MemoryTotals {
+    uint64_t bytes = 0;
+    uint64_t records = 0;
+};
+
+// Byte totals over every record. Counted by usage (the usage hint, empty when unset), by resource
+// type and by alias pool heap; allocations outside a pool only count toward total. Resources placed
+// in a pool carry no bytes of their own, so a pool's bytes are its heap size.
+struct MemoryAggregates {
+    uint64_t generation = 0;
+    MemoryTotals total;
+    std::map<rhi::ResourceType, MemoryTotals> byResourceType;
+    std::unordered_map<std::string, MemoryTotals> byUsage;
+    std::unordered_map<uint64_t, MemoryTotals> byAliasingPool;
+};
+
+// Records that changed after sinceGeneration. Pass generation back as the next sinceGeneration.
+// When full is set, upserted holds every record and anything held before should be dropped.
+// Apply removals before upserts: an allocation removed and re-added in one step is in both.
+struct MemorySnapshotDelta {
+    uint64_t generation = 0;
+    bool full = false;
+    std::vector<ResourceMemoryRecord> upserted; // Added or changed
+    std::vector<uint64_t> removedRecordIDs;
 };
 
 class IMemorySnapshotProvider {
 public:
     virtual ~IMemorySnapshotProvider() = default;
     virtual void BuildSnapshot(std::vector<ResourceMemoryRecord>& out) = 0;
+
+    // Providers without change tracking answer every request with a full snapshot.
+    virtual void BuildSnapshotDelta(uint64_t sinceGeneration, MemorySnapshotDelta& out) {
+        out.generation = sinceGeneration + 1;
+        out.full = true;
+        out.removedRecordIDs.clear();
+        BuildSnapshot(out.upserted);
+    }
+
+    // Providers that keep aggregates current answer without walking their records; the default
+    // sums a full snapshot.
+    virtual void BuildAggregates(MemoryAggregates& out);
+    virtual MemoryTotals GetTotals();
 };
 
 class SnapshotProvider {
@@ -30,12 +74,20 @@ public:
     void SetProvider(std::shared_ptr<IMemorySnapshotProvider> provider);
     void ResetProvider();
     void BuildSnapshot(std::vector<ResourceMemoryRecord>& out) const;
+    void BuildSnapshotDelta(uint64_t sinceGeneration, MemorySnapshotDelta& out) const;
+    void BuildAggregates(MemoryAggregates& out) const;
+    MemoryTotals GetTotals() const;
 
 private:
     mutable std::mutex m_providerMutex;
     std::shared_ptr<IMemorySnapshotProvider> m_provider;
 };
 
+// Keep aggregates in step with a provider's records; remove a record's old version before adding
+// its new one.
+void AddToAggregates(MemoryAggregates& aggregates, const ResourceMemoryRecord& record);
+void RemoveFromAggregates(MemoryAggregates& aggregates, const ResourceMemoryRecord& record);
+
 inline void SetResourceUsageHint(IHasMemoryMetadata& resource, std::string usage) {
     resource.SetMemoryUsageHint(std::move(usage));
 }
@@ -380,8 +380,7 @@ namespace detail {
         std::unordered_set<FeatureDomainIdentifier, FeatureDomainIdentifier::Hasher>& activeDomains,
         const ResourceIdentifier& id)
     {
-        auto domain = FeatureDomainRegistry::Get().FindResourceDomain(id);
-        if (domain.has_value()) {
+        if (const FeatureDomainIdentifier* domain = FeatureDomainRegistry::Get().LookupResourceDomain(id)) {
             activeDomains.insert(*domain);
         }
     }
@@ -702,6 +701,36 @@ namespace detail
         return out;
     }
 
+    // Flags write requirements that lie inside a range the pass promised to overwrite in full.
+    // Read segments stay unflagged: their contents are still needed.
+    inline std::vector<ResourceRequirement> MarkFullOverwriteRequirements(
+        const std::vector<ResourceHandleAndRange>& overwritten,
+        std::vector<ResourceRequirement> requirements) {
+        if (overwritten.empty()) {
+            return requirements;
+        }
+        for (auto& req : requirements) {
+            if (!AccessTypeIsWriteType(req.state.access)) {
+                continue;
+            }
+            const uint64_t id = req.resourceHandleAndRange.resource.GetGlobalResourceID();
+            for (auto const& rr : overwritten) {
+                if (rr.resource.GetGlobalResourceID() != id) {
+                    continue;
+                }
+                const SubresourceRange promised = ResolveRangeSpec(
+                    rr.range,
+                    rr.resource.GetNumMipLevels(),
+                    rr.resource.GetArraySize());
+                if (RangeContains(promised, req.resolvedRange)) {
+                    req.fullOverwrite = true;
+                    break;
+                }
+            }
+        }
+        return requirements;
+    }
+
     // Prefer (Inputs, StableArgs...) if available, else (StableArgs...), else default ctor.
     template<class PassT, class InputsT, class... StableArgs>
     std::shared_ptr<PassT> MakePass(InputsT&& inputs, StableArgs&&... stableArgs)
@@ -845,6 +874,15 @@ public:
         return *this;
     }
 
+    // Promises that the pass writes every texel of these ranges before reading them. Declare the
+    // access separately; its previous contents are discarded on the transition in.
+    template<typename... Args>
+        requires ((NotIResourceResolver<Args>) && ...)
+    RenderPassBuilder& WithFullOverwrite(Args&&... args)& {
+        (addFullOverwrite(std::forward<Args>(args)), ...);
+        return *this;
+    }
+
     template<typename T>
         requires ResourceLike<T>
     RenderPassBuilder& WithInternalTransition(T&& resource, ResourceState exitState)& {
@@ -956,6 +994,13 @@ public:
         return std::move(*this);
     }
 
+    template<typename... Args>
+        requires ((NotIResourceResolver<Args>) && ...)
+    RenderPassBuilder WithFullOverwrite(Args&&... args)&& {
+        (addFullOverwrite(std::forward<Args>(args)), ...);
+        return std::move(*this);
+    }
+
     template<typename T>
         requires ResourceLike<T>
     RenderPassBuilder WithInternalTransition(T&& resource, ResourceState exitState)&& {
@@ -1146,6 +1191,30 @@ public:
         return std::move(*this);
     }
 
+    // Prefers High/Realtime priority queue slots over normal ones, for work that must preempt
+    // bulk async work (reprojection, audio). Ignored when no such slot is registered.
+    RenderPassBuilder& LatencyCritical() & {
+        m_latencyCritical = true;
+        return *this;
+    }
+
+    RenderPassBuilder LatencyCritical() && {
+        m_latencyCritical = true;
+        return std::move(*this);
+    }
+
+    // Per-frame CPU data for this pass, allocated and filled by the graph; see TransientUploadDecl.
+    // Execute finds it in context.transientUploads, in declaration order.
+    RenderPassBuilder& WithTransientUpload(std::string name, uint64_t sizeBytes, TransientUploadWriter writer) & {
+        params.transientUploads.push_back({ std::move(name), sizeBytes, std::move(writer) });
+        return *this;
+    }
+
+    RenderPassBuilder WithTransientUpload(std::string name, uint64_t sizeBytes, TransientUploadWriter writer) && {
+        params.transientUploads.push_back({ std::move(name), sizeBytes, std::move(writer) });
+        return std::move(*this);
+    }
+
 	RenderPassBuilder& WithExternalWaitBeforeTransitions(rhi::Timeline timeline, uint64_t value) & {
 		params.externalWaitsBeforeTransitions.push_back({ timeline, value });
 		return *this;
@@ -1156,6 +1225,34 @@ public:
 		return std::move(*this);
 	}
 
+	// Predicates the pass's commands on the 64-bit value at `offset` in one buffer (see
+	// PassPredication.h). The buffer is declared as an indirect argument.
+	template<typename T>
+		requires ResourceLike<T>
+	RenderPassBuilder& WithPredication(T&& x, uint64_t offset = 0, PredicationOp op = PredicationOp::SkipWhenZero) & {
+		addPredication(std::forward<T>(x), offset, op);
+		return *this;
+	}
+
+	template<typename T>
+		requires ResourceLike<T>
+	RenderPassBuilder WithPredication(T&& x, uint64_t offset = 0, PredicationOp op = PredicationOp::SkipWhenZero) && {
+		addPredication(std::forward<T>(x), offset, op);
+		return std::move(*this);
+	}
+
+	// Makes the pass a member of `domain`: while FeatureDomainRegistry has it disabled, the pass is
+	// dropped from each compiled frame without a structural rebuild.
+	RenderPassBuilder& InFeatureDomain(const FeatureDomainIdentifier& domain) & {
+		addMemberFeatureDomain(domain);
+		return *this;
+	}
+
+	RenderPassBuilder InFeatureDomain(const FeatureDomainIdentifier& domain) && {
+		addMemberFeatureDomain(domain);
+		return std::move(*this);
+	}
+
     auto const& DeclaredResourceIds() const { return _declaredIds; }
 
 private:
@@ -1227,6 +1324,7 @@ private:
         params.preferredQueueKind = m_preferredQueueKind;
         params.queueAssignmentPolicy = m_queueAssignmentPolicy;
         params.pinnedQueueSlot = m_pinnedQueueSlot;
+        params.latencyCritical = m_latencyCritical;
         params.identifierSet = _declaredIds;
         params.staticResourceRequirements = GatherResourceRequirements();
 
@@ -1243,6 +1341,7 @@ private:
 		m_preferredQueueKind = QueueKind::Graphics;
 		m_queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
         m_pinnedQueueSlot = std::nullopt;
+        m_latencyCritical = false;
 	}
 
     // Shader Resource
@@ -1473,6 +1572,21 @@ private:
 		return *this;
 	}
 
+	template<typename T>
+		requires ResourceLike<T>
+	RenderPassBuilder& addPredication(T&& x, uint64_t offset, PredicationOp op) {
+		if (offset % 8 != 0) {
+			throw std::invalid_argument("Predication values must be 8-byte aligned");
+		}
+		const size_t first = params.indirectArgumentBuffers.size();
+		addIndirectArguments(std::forward<T>(x));
+		if (params.indirectArgumentBuffers.size() != first + 1) {
+			throw std::invalid_argument("WithPredication takes exactly one buffer");
+		}
+		params.predication = PassPredication{ params.indirectArgumentBuffers.back().resource, offset, op };
+		return *this;
+	}
+
     template<typename T>
         requires ResourceLike<T>
     RenderPassBuilder& addPresent(T&& x) {
@@ -1509,6 +1623,23 @@ private:
             addLegacyInterop(std::forward<decltype(e)>(e));
         }
         return *this;
+    }
+
+    // Full-overwrite promises
+    template<typename T>
+        requires ResourceLike<T>
+    RenderPassBuilder& addFullOverwrite(T&& x) {
+        detail::AppendTrackedResource(graph, _declaredIds, params.fullOverwriteResources, std::forward<T>(x));
+        return *this;
+    }
+    template<class Range>
+        requires (std::ranges::range<Range>&&
+    ResourceLike<std::ranges::range_value_t<Range>>)
+    RenderPassBuilder& addFullOverwrite(Range&& xs) {
+        for (auto&& e : xs) {
+            addFullOverwrite(std::forward<decltype(e)>(e));
+        }
+        return *this;
 	}
 
     template<typename T>
@@ -1524,6 +1655,13 @@ private:
         params.activeFeatureDomains.insert(domain);
     }
 
+    void addMemberFeatureDomain(const FeatureDomainIdentifier& domain) {
+        params.activeFeatureDomains.insert(domain);
+        if (std::find(params.memberFeatureDomains.begin(), params.memberFeatureDomains.end(), domain) == params.memberFeatureDomains.end()) {
+            params.memberFeatureDomains.push_back(domain);
+        }
+    }
+
     void addActiveFeatureDomain(FeatureDomainIdentifier&& domain) {
         params.activeFeatureDomains.insert(std::move(domain));
     }
@@ -1555,7 +1693,7 @@ private:
 	}
 
     std::vector<ResourceRequirement> GatherResourceRequirements() const {
-        return detail::BuildRequirements(
+        return detail::MarkFullOverwriteRequirements(params.fullOverwriteResources, detail::BuildRequirements(
             [](rhi::ResourceAccessType access) { return RenderSyncFromAccess(access); },
             std::pair{ std::cref(params.shaderResources), rhi::ResourceAccessType::ShaderResource },
             std::pair{ std::cref(params.constantBuffers), rhi::ResourceAccessType::ConstantBuffer },
@@ -1570,7 +1708,7 @@ private:
             std::pair{ std::cref(params.copyTargets), rhi::ResourceAccessType::CopyDest },
             std::pair{ std::cref(params.indirectArgumentBuffers), rhi::ResourceAccessType::IndirectArgument },
                 std::pair{ std::cref(params.presentResources), rhi::ResourceAccessType::Present },
-            std::pair{ std::cref(params.legacyInteropResources), rhi::ResourceAccessType::Common });
+            std::pair{ std::cref(params.legacyInteropResources), rhi::ResourceAccessType::Common }));
     }
 
     // storage
@@ -1583,6 +1721,7 @@ private:
 	QueueKind m_preferredQueueKind = QueueKind::Graphics;
     QueueAssignmentPolicy m_queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
     std::optional<QueueSlotIndex> m_pinnedQueueSlot;
+    bool m_latencyCritical = false;
     std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher> _declaredIds;
     std::vector<ResolverSnapshot> resolverSnapshots_;
 
@@ -1641,6 +1780,15 @@ public:
         return *this;
     }
 
+    // Promises that the pass writes every texel of these ranges before reading them. Declare the
+    // access separately; its previous contents are discarded on the transition in.
+    template<typename... Args>
+        requires ((NotIResourceResolver<Args>) && ...)
+    ComputePassBuilder& WithFullOverwrite(Args&&... args)& {
+        (addFullOverwrite(std::forward<Args>(args)), ...);
+        return *this;
+    }
+
     template<typename T>
         requires ResourceLike<T>
     ComputePassBuilder& WithInternalTransition(T&& resource, ResourceState exitState)& {
@@ -1697,6 +1845,13 @@ public:
         return std::move(*this);
     }
 
+    template<typename... Args>
+        requires ((NotIResourceResolver<Args>) && ...)
+    ComputePassBuilder WithFullOverwrite(Args&&... args)&& {
+        (addFullOverwrite(std::forward<Args>(args)), ...);
+        return std::move(*this);
+    }
+
     template<typename T>
         requires ResourceLike<T>
     ComputePassBuilder WithInternalTransition(T&& resource, ResourceState exitState)&& {
@@ -1774,6 +1929,30 @@ public:
                 return std::move(*this);
         }
 
+        // Prefers High/Realtime priority queue slots over normal ones, for work that must preempt
+        // bulk async work (reprojection, audio). Ignored when no such slot is registered.
+        ComputePassBuilder& LatencyCritical() & {
+                m_latencyCritical = true;
+                return *this;
+        }
+
+        ComputePassBuilder LatencyCritical() && {
+                m_latencyCritical = true;
+                return std::move(*this);
+        }
+
+        // Per-frame CPU data for this pass, allocated and filled by the graph; see TransientUploadDecl.
+        // Execute finds it in context.transientUploads, in declaration order.
+        ComputePassBuilder& WithTransientUpload(std::string name, uint64_t sizeBytes, TransientUploadWriter writer) & {
+                params.transientUploads.push_back({ std::move(name), sizeBytes, std::move(writer) });
+                return *this;
+        }
+
+        ComputePassBuilder WithTransientUpload(std::string name, uint64_t sizeBytes, TransientUploadWriter writer) && {
+                params.transientUploads.push_back({ std::move(name), sizeBytes, std::move(writer) });
+                return std::move(*this);
+        }
+
 		ComputePassBuilder& WithExternalWaitBeforeTransitions(rhi::Timeline timeline, uint64_t value) & {
 			params.externalWaitsBeforeTransitions.push_back({ timeline, value });
 			return *this;
@@ -1784,6 +1963,34 @@ public:
 			return std::move(*this);
 		}
 
+		// Predicates the pass's commands on the 64-bit value at `offset` in one buffer (see
+		// PassPredication.h). The buffer is declared as an indirect argument.
+		template<typename T>
+			requires ResourceLike<T>
+		ComputePassBuilder& WithPredication(T&& x, uint64_t offset = 0, PredicationOp op = PredicationOp::SkipWhenZero) & {
+			addPredication(std::forward<T>(x), offset, op);
+			return *this;
+		}
+
+		template<typename T>
+			requires ResourceLike<T>
+		ComputePassBuilder WithPredication(T&& x, uint64_t offset = 0, PredicationOp op = PredicationOp::SkipWhenZero) && {
+			addPredication(std::forward<T>(x), offset, op);
+			return std::move(*this);
+		}
+
+		// Makes the pass a member of `domain`: while FeatureDomainRegistry has it disabled, the pass is
+		// dropped from each compiled frame without a structural rebuild.
+		ComputePassBuilder& InFeatureDomain(const FeatureDomainIdentifier& domain) & {
+			addMemberFeatureDomain(domain);
+			return *this;
+		}
+
+		ComputePassBuilder InFeatureDomain(const FeatureDomainIdentifier& domain) && {
+			addMemberFeatureDomain(domain);
+			return std::move(*this);
+		}
+
         // LVALUE overloads for IResourceResolver
         ComputePassBuilder& WithShaderResource(const IResourceResolver& r)& {
 		return WithResolver(r, [&](auto&& resolved) { addShaderResource(std::forward<decltype(resolved)>(resolved)); });
@@ -1905,6 +2112,7 @@ private:
         params.preferredQueueKind = m_preferredQueueKind;
         params.queueAssignmentPolicy = m_queueAssignmentPolicy;
         params.pinnedQueueSlot = m_pinnedQueueSlot;
+        params.latencyCritical = m_latencyCritical;
         params.staticResourceRequirements = GatherResourceRequirements();
 
         graph->AddComputePass(pass, params, passName, TakeResolverSnapshots());
@@ -1919,6 +2127,7 @@ private:
         m_preferredQueueKind = QueueKind::Compute;
 		m_queueAssignmentPolicy = QueueAssignmentPolicy::Automatic;
         m_pinnedQueueSlot = std::nullopt;
+        m_latencyCritical = false;
     }
 
     // Shader resource
@@ -2019,6 +2228,21 @@ private:
 		return *this;
 	}
 
+	template<typename T>
+		requires ResourceLike<T>
+	ComputePassBuilder& addPredication(T&& x, uint64_t offset, PredicationOp op) {
+		if (offset % 8 != 0) {
+			throw std::invalid_argument("Predication values must be 8-byte aligned");
+		}
+		const size_t first = params.indirectArgumentBuffers.size();
+		addIndirectArguments(std::forward<T>(x));
+		if (params.indirectArgumentBuffers.size() != first + 1) {
+			throw std::invalid_argument("WithPredication takes exactly one buffer");
+		}
+		params.predication = PassPredication{ params.indirectArgumentBuffers.back().resource, offset, op };
+		return *this;
+	}
+
     // Legacy interop resources
     template<typename T>
         requires ResourceLike<T>
@@ -2034,6 +2258,23 @@ private:
         ComputePassBuilder& addLegacyInterop(Range&& xs) {
         for (auto&& e : xs) {
             addLegacyInterop(std::forward<decltype(e)>(e));
+        }
+        return *this;
+    }
+
+    // Full-overwrite promises
+    template<typename T>
+        requires ResourceLike<T>
+    ComputePassBuilder& addFullOverwrite(T&& x) {
+        detail::AppendTrackedResource(graph, _declaredIds, params.fullOverwriteResources, std::forward<T>(x));
+        return *this;
+    }
+    template<class Range>
+        requires (std::ranges::range<Range>&&
+    ResourceLike<std::ranges::range_value_t<Range>>)
+    ComputePassBuilder& addFullOverwrite(Range&& xs) {
+        for (auto&& e : xs) {
+            addFullOverwrite(std::forward<decltype(e)>(e));
         }
 		return *this;
 	}
@@ -2062,6 +2303,13 @@ private:
         params.activeFeatureDomains.insert(domain);
     }
 
+    void addMemberFeatureDomain(const FeatureDomainIdentifier& domain) {
+        params.activeFeatureDomains.insert(domain);
+        if (std::find(params.memberFeatureDomains.begin(), params.memberFeatureDomains.end(), domain) == params.memberFeatureDomains.end()) {
+            params.memberFeatureDomains.push_back(domain);
+        }
+    }
+
     void addActiveFeatureDomain(FeatureDomainIdentifier&& domain) {
         params.activeFeatureDomains.insert(std::move(domain));
     }
@@ -2083,14 +2331,14 @@ private:
     }
 
     std::vector<ResourceRequirement> GatherResourceRequirements() const {
-        return detail::BuildRequirements(
+        return detail::MarkFullOverwriteRequirements(params.fullOverwriteResources, detail::BuildRequirements(
             [](rhi::ResourceAccessType access) { return ComputeSyncFromAccess(access); },
             std::pair{ std::cref(params.shaderResources), rhi::ResourceAccessType::ShaderResource },
             std::pair{ std::cref(params.constantBuffers), rhi::ResourceAccessType::ConstantBuffer },
             std::pair{ std::cref(params.unorderedAccessViews), rhi::ResourceAccessType::UnorderedAccess },
             std::pair{ std::cref(params.unorderedAccessClearViews), rhi::ResourceAccessType::UnorderedAccessClear },
             std::pair{ std::cref(params.indirectArgumentBuffers), rhi::ResourceAccessType::IndirectArgument },
-            std::pair{ std::cref(params.legacyInteropResources), rhi::ResourceAccessType::Common });
+            std::pair{ std::cref(params.legacyInteropResources), rhi::ResourceAccessType::Common }));
     }
 
     // storage
@@ -2102,6 +2350,7 @@ private:
 	QueueKind m_preferredQueueKind = QueueKind::Compute;
     QueueAssignmentPolicy m_queueAssignmentPolicy = QueueAssignmentPolicy::Automatic;
     std::optional<QueueSlotIndex> m_pinnedQueueSlot;
+    bool m_latencyCritical = false;
     std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher> _declaredIds;
     std::vector<ResolverSnapshot> resolverSnapshots_;
 
@@ -2130,6 +2379,15 @@ public:
         return *this;
     }
 
+    // Promises that the pass writes every texel of these ranges before reading them. Declare the
+    // access separately; its previous contents are discarded on the transition in.
+    template<typename... Args>
+        requires ((NotIResourceResolver<Args>) && ...)
+    CopyPassBuilder& WithFullOverwrite(Args&&... args)& {
+        (addFullOverwrite(std::forward<Args>(args)), ...);
+        return *this;
+    }
+
     template<typename T>
         requires ResourceLike<T>
     CopyPassBuilder& WithInternalTransition(T&& resource, ResourceState exitState)& {
@@ -2151,6 +2409,13 @@ public:
         return std::move(*this);
     }
 
+    template<typename... Args>
+        requires ((NotIResourceResolver<Args>) && ...)
+    CopyPassBuilder WithFullOverwrite(Args&&... args)&& {
+        (addFullOverwrite(std::forward<Args>(args)), ...);
+        return std::move(*this);
+    }
+
     template<typename T>
         requires ResourceLike<T>
     CopyPassBuilder WithInternalTransition(T&& resource, ResourceState exitState)&& {
@@ -2222,6 +2487,18 @@ public:
         return std::move(*this);
     }
 
+    // Prefers High/Realtime priority queue slots over normal ones, for work that must preempt
+    // bulk async work (reprojection, audio). Ignored when no such slot is registered.
+    CopyPassBuilder& LatencyCritical() & {
+        m_latencyCritical = true;
+        return *this;
+    }
+
+    CopyPassBuilder LatencyCritical() && {
+        m_latencyCritical = true;
+        return std::move(*this);
+    }
+
 	CopyPassBuilder& WithExternalWaitBeforeTransitions(rhi::Timeline timeline, uint64_t value) & {
 		params.externalWaitsBeforeTransitions.push_back({ timeline, value });
 		return *this;
@@ -2316,6 +2593,7 @@ private:
         params.preferredQueueKind = m_preferredQueueKind;
         params.queueAssignmentPolicy = m_queueAssignmentPolicy;
         params.pinnedQueueSlot = m_pinnedQueueSlot;
+        params.latencyCritical = m_latencyCritical;
         params.staticResourceRequirements = GatherResourceRequirements();
 
         graph->AddCopyPass(pass, params, passName, TakeResolverSnapshots());
@@ -2330,6 +2608,7 @@ private:
         m_preferredQueueKind = QueueKind::Copy;
 		m_queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
         m_pinnedQueueSlot = std::nullopt;
+        m_latencyCritical = false;
     }
 
     template<typename T>
@@ -2368,6 +2647,23 @@ private:
         return *this;
     }
 
+    template<typename T>
+        requires ResourceLike<T>
+    CopyPassBuilder& addFullOverwrite(T&& x) {
+        detail::AppendTrackedResource(graph, _declaredIds, params.fullOverwriteResources, std::forward<T>(x));
+        return *this;
+    }
+
+    template<class Range>
+        requires (std::ranges::range<Range>&&
+    ResourceLike<std::ranges::range_value_t<Range>>)
+    CopyPassBuilder& addFullOverwrite(Range&& xs) {
+        for (auto&& e : xs) {
+            addFullOverwrite(std::forward<decltype(e)>(e));
+        }
+        return *this;
+    }
+
     template<typename T>
         requires ResourceLike<T>
     CopyPassBuilder& addInternalTransition(T&& x, ResourceState exitState)& {
@@ -2377,7 +2673,7 @@ private:
     }
 
     std::vector<ResourceRequirement> GatherResourceRequirements() const {
-        return detail::BuildRequirements(
+        return detail::MarkFullOverwriteRequirements(params.fullOverwriteResources, detail::BuildRequirements(
             [](rhi::ResourceAccessType access) {
                 if ((access & (rhi::ResourceAccessType::CopySource | rhi::ResourceAccessType::CopyDest)) != 0) {
                     return rhi::ResourceSyncState::Copy;
@@ -2385,7 +2681,7 @@ private:
                 return rhi::ResourceSyncState::All;
             },
             std::pair{ std::cref(params.copySources), rhi::ResourceAccessType::CopySource },
-            std::pair{ std::cref(params.copyTargets), rhi::ResourceAccessType::CopyDest });
+            std::pair{ std::cref(params.copyTargets), rhi::ResourceAccessType::CopyDest }));
     }
 
     RenderGraph* graph;
@@ -2396,6 +2692,7 @@ private:
     QueueKind m_preferredQueueKind = QueueKind::Copy;
 	QueueAssignmentPolicy m_queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
     std::optional<QueueSlotIndex> m_pinnedQueueSlot;
+    bool m_latencyCritical = false;
     std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher> _declaredIds;
     std::vector<ResolverSnapshot> resolverSnapshots_;
 
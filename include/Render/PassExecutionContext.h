@@ -1,10 +1,14 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
+#include <span>
+#include <string>
 #include <typeindex>
 #include <rhi.h>
 #include <DirectXMath.h>
 
+#include "Render/FrameConstantAllocator.h"
 #include "Render/ImmediateExecution/ImmediateCommandList.h"
 
 struct IHostExecutionData {
@@ -24,6 +28,19 @@ struct UpdateExecutionContext {
 	const IHostExecutionData* hostData = nullptr;
 };
 
+// Fills a transient upload declared with WithTransientUpload. Runs during RenderGraph::Update,
+// after every pass has updated, on a task-service worker; data is write-only, combined memory.
+using TransientUploadWriter = std::function<void(std::span<std::byte> data, const UpdateExecutionContext& context)>;
+
+// Per-frame upload data owned by the graph instead of a persistent Buffer and UploadData. The
+// graph sub-allocates it from its FrameConstantAllocator every frame, so it is read in place by
+// the GPU; the pages sit in CPU-visible device-local memory whenever the heap budget allows.
+struct TransientUploadDecl {
+	std::string name;
+	uint64_t sizeBytes = 0;
+	TransientUploadWriter writer;
+};
+
 struct ImmediateExecutionContext {
 	rhi::Device device;
 	rg::imm::ImmediateCommandList list;
@@ -34,6 +51,37 @@ struct ImmediateExecutionContext {
 struct IHasImmediateModeCommands {
 	virtual ~IHasImmediateModeCommands() = default;
 	virtual void RecordImmediateCommands(ImmediateExecutionContext& context) = 0;
+
+	// Return true if RecordImmediateCommands records the same stream every frame (fullscreen
+	// clears, fixed blits and copies). The graph then records it once and replays the cached stream
+	// until the pass's inputs, declarations or resolver content versions change.
+	virtual bool ImmediateCommandsAreStatic() const { return false; }
+};
+
+// Render-pass continuation for a pass the graph recorded back to back with its neighbours on one
+// command list, with identical attachments and nothing in between that touches them. Tile-based
+// backends can keep the attachments resident across the group (e.g. D3D12 render-pass
+// suspend/resume, or skipping the store/load) instead of writing them out between passes.
+struct RenderPassMergeInfo {
+	uint32_t groupSize = 1;
+	uint32_t indexInGroup = 0;
+	bool continuesPrevious = false;  // The previous recorded pass left the attachments bound
+	bool continuesIntoNext = false;  // The next recorded pass resumes with the same attachments
+};
+
+struct PassExecutionContext;
+
+// Supplied by the graph while a retained pass executes, so the pass can record parts of itself on
+// several threads. Each part gets its own command list from the queue's CommandListPool and runs
+// through the graph's ITaskService; the parts submit in index order, after whatever the pass
+// recorded before the call and before whatever it records on context.commandList afterwards,
+// all inside the pass's batch. Barriers and statistics queries stay on the pass's own list.
+struct IParallelPassRecorder {
+	virtual ~IParallelPassRecorder() = default;
+	virtual void Record(
+		PassExecutionContext& context,
+		uint32_t partCount,
+		const std::function<void(PassExecutionContext& part, uint32_t partIndex)>& recordPart) = 0;
 };
 
 struct PassExecutionContext {
@@ -46,4 +94,24 @@ struct PassExecutionContext {
 	UINT64 frameFenceValue = 0;
 	float deltaTime = 0.0f;
 	const IHostExecutionData* hostData = nullptr;
+	RenderPassMergeInfo renderPassMerge{}; // Only set for render passes with renderGraphRenderPassMergingEnabled
+	IParallelPassRecorder* parallelRecorder = nullptr; // Null inside a part
+	// Per-frame CPU-written constants, reclaimed once the frame retires; see FrameConstantAllocator.
+	FrameConstantAllocator* constantAllocator = nullptr;
+	// The current pass's transient uploads, in declaration order; an entry is empty if its page
+	// could not be allocated.
+	std::span<const FrameConstantAllocation> transientUploads;
+
+	// Records partCount parts of the current pass, in parallel where the graph can (see
+	// IParallelPassRecorder), else one after another on commandList. recordPart may run on any
+	// thread and must record only into the part context it is given.
+	void RecordParallel(uint32_t partCount, const std::function<void(PassExecutionContext& part, uint32_t partIndex)>& recordPart) {
+		if (parallelRecorder && partCount > 1) {
+			parallelRecorder->Record(*this, partCount, recordPart);
+			return;
+		}
+		for (uint32_t partIndex = 0; partIndex < partCount; ++partIndex) {
+			recordPart(*this, partIndex);
+		}
+	}
 };
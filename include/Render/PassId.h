@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <string_view>
 
 struct PassId {
     uint32_t index{ UINT32_MAX };
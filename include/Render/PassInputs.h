@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <new>
 #include <concepts>
 #include <typeinfo>
 #include <cassert>
@@ -92,39 +94,63 @@ namespace rg {
     friend bool operator==(const Type& a, const Type& b) { return ::rg::AutoEqualMembers<Type, __VA_ARGS__>(a, b); } \
     friend ::rg::Hash64 HashValue(const Type& value) { return ::rg::AutoHashMembers<Type, __VA_ARGS__>(value); }
 
-struct AnyPassInputs {
-    const std::type_info* type = nullptr;
+// Pass inputs up to this size are stored inline in AnyPassInputs instead of on the heap.
+#ifndef ORG_PASS_INPUTS_INLINE_BYTES
+#define ORG_PASS_INPUTS_INLINE_BYTES 64
+#endif
 
-    using HashFn = rg::Hash64(*)(const void*) noexcept;
-    using EqFn = bool(*)(const void*, const void*) noexcept;
-    using DtorFn = void(*)(void*) noexcept;
+// Type-erased pass inputs. Inputs that fit ORG_PASS_INPUTS_INLINE_BYTES (and are nothrow
+// movable) live in the inline buffer; larger ones are heap allocated. The hash is computed once
+// in set, so equals rejects most changes on the hash before calling the type's operator==.
+struct AnyPassInputs {
+    static constexpr std::size_t kInlineBytes = ORG_PASS_INPUTS_INLINE_BYTES;
 
-    HashFn hashFn = nullptr;
-    EqFn   eqFn = nullptr;
-    DtorFn dtorFn = nullptr;
+    const std::type_info* type = nullptr;
 
-	// Simple version: heap allocate always. TODO: Will this ever be a performance issue?
-    void* ptr = nullptr;
+    AnyPassInputs() noexcept = default;
+    AnyPassInputs(const AnyPassInputs& o) { copyFrom(o); }
+    AnyPassInputs(AnyPassInputs&& o) noexcept { moveFrom(o); }
+    AnyPassInputs& operator=(const AnyPassInputs& o) {
+        if (this != &o) {
+            reset();
+            copyFrom(o);
+        }
+        return *this;
+    }
+    AnyPassInputs& operator=(AnyPassInputs&& o) noexcept {
+        if (this != &o) {
+            reset();
+            moveFrom(o);
+        }
+        return *this;
+    }
+    ~AnyPassInputs() { reset(); }
 
     template<rg::PassInputs T>
     void set(T value) {
+        const rg::Hash64 valueHash = HashValue(value);
+        set<T>(std::move(value), valueHash);
+    }
+
+    // For callers that already hashed the value.
+    template<rg::PassInputs T>
+    void set(T value, rg::Hash64 valueHash) {
         reset();
-        ptr = new T(std::move(value));
+        if constexpr (StoresInline<T>()) {
+            ptr = ::new (static_cast<void*>(buffer_)) T(std::move(value));
+        }
+        else {
+            ptr = new T(std::move(value));
+        }
         type = &typeid(T);
-
-        hashFn = [](const void* p) noexcept -> rg::Hash64 {
-            return HashValue(*static_cast<const T*>(p));
-            };
-        eqFn = [](const void* a, const void* b) noexcept -> bool {
-            return *static_cast<const T*>(a) == *static_cast<const T*>(b);
-            };
-        dtorFn = [](void* p) noexcept { delete static_cast<T*>(p); };
+        ops_ = &kOps<T>;
+        hash_ = valueHash;
     }
 
     void reset() noexcept {
-        if (ptr) { dtorFn(ptr); }
+        if (ptr) { ops_->destroy(ptr); }
         ptr = nullptr; type = nullptr;
-        hashFn = nullptr; eqFn = nullptr; dtorFn = nullptr;
+        ops_ = nullptr; hash_ = 0;
     }
 
     template<class T>
@@ -133,13 +159,89 @@ struct AnyPassInputs {
         return *static_cast<const T*>(ptr);
     }
 
-    rg::Hash64 hash() const noexcept { return hashFn(ptr); }
+    rg::Hash64 hash() const noexcept { return hash_; }
     bool equals(const AnyPassInputs& o) const noexcept {
         if (type != o.type) return false;
-        return eqFn(ptr, o.ptr);
+        if (!ptr) return true;
+        if (hash_ != o.hash_) return false;
+        return ops_->equals(ptr, o.ptr);
     }
 
-    ~AnyPassInputs() { reset(); }
+private:
+    struct Ops {
+        bool (*equals)(const void*, const void*) noexcept;
+        // Construct into `inlineStorage` when the type is stored inline; return the value's address.
+        void* (*copy)(const void*, std::byte* inlineStorage);
+        void* (*move)(void*, std::byte* inlineStorage) noexcept;
+        void (*destroy)(void*) noexcept;
+    };
+
+    template<class T>
+    static constexpr bool StoresInline() noexcept {
+        return sizeof(T) <= kInlineBytes
+            && alignof(T) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<T>;
+    }
+
+    template<class T>
+    static constexpr Ops kOps{
+        [](const void* a, const void* b) noexcept -> bool {
+            return *static_cast<const T*>(a) == *static_cast<const T*>(b);
+        },
+        [](const void* p, std::byte* inlineStorage) -> void* {
+            if constexpr (!std::is_copy_constructible_v<T>) {
+                assert(false && "Pass inputs type is not copyable");
+                (void)p; (void)inlineStorage;
+                return nullptr;
+            }
+            else if constexpr (StoresInline<T>()) {
+                return ::new (static_cast<void*>(inlineStorage)) T(*static_cast<const T*>(p));
+            }
+            else {
+                (void)inlineStorage;
+                return new T(*static_cast<const T*>(p));
+            }
+        },
+        [](void* p, std::byte* inlineStorage) noexcept -> void* {
+            if constexpr (StoresInline<T>()) {
+                T* moved = ::new (static_cast<void*>(inlineStorage)) T(std::move(*static_cast<T*>(p)));
+                static_cast<T*>(p)->~T();
+                return moved;
+            }
+            else {
+                (void)inlineStorage;
+                return p; // Heap storage changes owner
+            }
+        },
+        [](void* p) noexcept {
+            if constexpr (StoresInline<T>()) {
+                static_cast<T*>(p)->~T();
+            }
+            else {
+                delete static_cast<T*>(p);
+            }
+        },
+    };
+
+    void copyFrom(const AnyPassInputs& o) {
+        if (!o.ptr) return;
+        ptr = o.ops_->copy(o.ptr, buffer_);
+        if (!ptr) return;
+        type = o.type; ops_ = o.ops_; hash_ = o.hash_;
+    }
+
+    void moveFrom(AnyPassInputs& o) noexcept {
+        if (!o.ptr) return;
+        ptr = o.ops_->move(o.ptr, buffer_);
+        type = o.type; ops_ = o.ops_; hash_ = o.hash_;
+        o.ptr = nullptr; o.type = nullptr;
+        o.ops_ = nullptr; o.hash_ = 0;
+    }
+
+    void* ptr = nullptr;
+    const Ops* ops_ = nullptr;
+    rg::Hash64 hash_ = 0;
+    alignas(std::max_align_t) std::byte buffer_[kInlineBytes];
 };
 
 class RenderGraphPassBase {
@@ -149,7 +251,8 @@ public:
 
     template<rg::PassInputs T>
     void SetInputs(T in) {
-        rg::Hash64 newKey = Mix(TypeHash<T>(), HashValue(in));
+        const rg::Hash64 valueHash = HashValue(in);
+        rg::Hash64 newKey = Mix(TypeHash<T>(), valueHash);
 
         // If types differ or keys differ, still confirm with == (collision safety).
         bool changed = (!inputs_.type) ||
@@ -163,7 +266,7 @@ public:
         }
 
         if (changed) {
-            inputs_.set<T>(std::move(in));
+            inputs_.set<T>(std::move(in), valueHash);
             compileKey_ = newKey;
             compileDirty_ = true;
         }
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+#include "Render/ResourceRegistry.h"
+
+// GPU-side condition for a render or compute pass, declared with WithPredication. The graph keeps
+// the buffer in indirect-argument state (the state D3D12 also uses for predication) and wraps the
+// pass's commands in predication on the 64-bit value at `offset`, so a condition computed on the
+// GPU can skip the work without a readback. Barriers and the pass's statistics queries are not
+// predicated. Backends without predication support run the commands unconditionally.
+enum class PredicationOp : uint8_t {
+	SkipWhenZero,    // Run the pass's commands only when the value is nonzero
+	SkipWhenNonZero, // Run them only when the value is zero
+};
+
+struct PassPredication {
+	ResourceRegistry::RegistryHandle buffer;
+	uint64_t offset = 0; // Must be 8-byte aligned
+	PredicationOp op = PredicationOp::SkipWhenZero;
+};
@@ -8,11 +8,29 @@
 
 class CommandListPool;
 
+namespace rg::runtime {
+class ITaskService;
+}
+
 enum class QueueAutoAssignmentPolicy : uint8_t {
 	AllowAutomaticScheduling = 0,
 	ManualOnly = 1,
 };
 
+/// Scheduling priority the queue was created with. Passes that declare latency-critical intent
+/// prefer High and Realtime slots, and other automatic passes stay off them, so latency-critical
+/// work preempts bulk work on the GPU instead of queuing behind it.
+enum class QueuePriority : uint8_t {
+	Normal = 0,
+	High = 1,
+	Realtime = 2, // Needs OS privileges on most platforms
+};
+
+/// Index of the device a queue slot belongs to; adapter 0 is the device DeviceManager was
+/// initialized with. See RenderGraph::RegisterAdapterQueue.
+using AdapterIndex = uint8_t;
+constexpr AdapterIndex kPrimaryAdapter = 0;
+
 /// Identifies a logical queue by its kind and instance number.
 struct QueueSlot {
 	QueueKind kind{};
@@ -39,6 +57,12 @@ public:
 		QueueAutoAssignmentPolicy autoAssignmentPolicy = QueueAutoAssignmentPolicy::AllowAutomaticScheduling,
 		bool ownsQueue = false);
 
+	/// The CommandListPool the first Register overload gives a slot of `kind` on `device`.
+	std::unique_ptr<CommandListPool> CreatePool(rhi::Device& device, QueueKind kind) const;
+
+	/// Service whose background lane resets completed command lists, for every slot's pool.
+	void SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService);
+
 	/// Register a queue slot with an externally-supplied timeline and pool.
 	QueueSlotIndex Register(QueueSlot slot, rhi::Queue queue, rhi::TimelinePtr fence, std::unique_ptr<CommandListPool> pool,
 		QueueAutoAssignmentPolicy autoAssignmentPolicy = QueueAutoAssignmentPolicy::AllowAutomaticScheduling,
@@ -48,6 +72,9 @@ public:
 	/// Look up slot index by kind + instance. Returns empty optional if not found.
 	QueueSlotIndex FindSlot(QueueSlot slot) const;
 
+	/// First slot of the given kind on an adapter, or 0xFF if it has none.
+	QueueSlotIndex FindSlotOnAdapter(QueueKind kind, AdapterIndex adapter) const;
+
 	/// Returns true if the given slot has been registered.
 	bool HasSlot(QueueSlot slot) const;
 
@@ -62,11 +89,33 @@ public:
 	rhi::Queue     GetQueue(QueueSlotIndex i)     const noexcept { return m_slots[ToUnderlying(i)].queue; }
 	QueueAutoAssignmentPolicy GetAutoAssignmentPolicy(QueueSlotIndex i) const noexcept { return m_slots[ToUnderlying(i)].autoAssignmentPolicy; }
 	bool IsAutoAssignable(QueueSlotIndex i) const noexcept { return GetAutoAssignmentPolicy(i) == QueueAutoAssignmentPolicy::AllowAutomaticScheduling; }
+	QueuePriority  GetPriority(QueueSlotIndex i)  const noexcept { return m_slots[ToUnderlying(i)].priority; }
+	bool IsElevatedPriority(QueueSlotIndex i) const noexcept { return GetPriority(i) != QueuePriority::Normal; }
+	/// Records the priority the slot's queue was created with; it does not change the queue itself.
+	void SetPriority(QueueSlotIndex i, QueuePriority priority) noexcept { m_slots[ToUnderlying(i)].priority = priority; }
 	rhi::Timeline& GetFence(QueueSlotIndex i)           noexcept { return m_slots[ToUnderlying(i)].fence.Get(); }
 	const rhi::Timeline& GetFence(QueueSlotIndex i) const noexcept { return m_slots[ToUnderlying(i)].fence.Get(); }
 	rhi::TimelinePtr& GetFencePtr(QueueSlotIndex i)     noexcept { return m_slots[ToUnderlying(i)].fence; }
 	CommandListPool* GetPool(QueueSlotIndex i)    const noexcept { return m_slots[ToUnderlying(i)].pool.get(); }
 
+	// ---- Multi-adapter ----
+
+	AdapterIndex   GetAdapter(QueueSlotIndex i)   const noexcept { return m_slots[ToUnderlying(i)].adapter; }
+	bool IsOnPrimaryAdapter(QueueSlotIndex i) const noexcept { return GetAdapter(i) == kPrimaryAdapter; }
+	void SetAdapter(QueueSlotIndex i, AdapterIndex adapter) noexcept { m_slots[ToUnderlying(i)].adapter = adapter; }
+	/// True if any registered slot is on an adapter other than the primary one.
+	bool HasSecondaryAdapterSlots() const noexcept;
+
+	/// Records the slot's fence opened on another adapter's device, for that adapter's queues to wait on.
+	void SetPeerFence(QueueSlotIndex i, AdapterIndex adapter, rhi::TimelinePtr fence);
+	bool HasWaitFence(QueueSlotIndex i, AdapterIndex waitingAdapter) const noexcept;
+	/// The slot's fence as seen from a queue on `waitingAdapter`: its own fence on the same adapter,
+	/// otherwise the peer fence. Check HasWaitFence first for slots on other adapters.
+	rhi::Timeline& GetWaitFence(QueueSlotIndex i, AdapterIndex waitingAdapter) noexcept {
+		auto& entry = m_slots[ToUnderlying(i)];
+		return entry.adapter == waitingAdapter ? entry.fence.Get() : entry.peerFences[waitingAdapter].Get();
+	}
+
 	/// Atomically retrieve and increment the per-slot fence value.
 	uint64_t GetNextFenceValue(QueueSlotIndex i) noexcept { return m_slots[ToUnderlying(i)].fenceValue++; }
 
@@ -103,7 +152,11 @@ private:
 		QueueAutoAssignmentPolicy autoAssignmentPolicy = QueueAutoAssignmentPolicy::AllowAutomaticScheduling;
 		bool ownsQueue = false;
 		uint64_t fenceValue = 1;
+		QueuePriority priority = QueuePriority::Normal;
+		AdapterIndex adapter = kPrimaryAdapter;
+		std::vector<rhi::TimelinePtr> peerFences; // Indexed by waiting adapter; null for the slot's own
 	};
 
 	std::vector<SlotEntry> m_slots;
+	std::shared_ptr<rg::runtime::ITaskService> m_taskService;
 };
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+#include <rhi.h>
+
+#include "Resources/TrackedAllocation.h"
+
+namespace rg::alias {
+
+// Process-wide owner of alias pool heaps, shared by several RenderGraph instances (one per view:
+// split-screen, picture-in-picture, reflection probes) so their transient memory is pooled
+// instead of each graph keeping a heap per pool. Attach one instance to every graph with
+// RenderGraph::SetAliasPoolArbiter.
+//
+// Heaps are keyed by pool ID (auto pools use the same IDs in every graph) and sized to the
+// largest requirement of any graph using them. Sharing is safe because aliased resources are
+// discard-activated on their first use in every frame, so no graph expects heap contents to
+// survive another graph's frame. GPU ordering between graphs comes from BeginExecute, which
+// returns the last signals of another graph that used the same heaps; the graph waits for them
+// on its queues before its first batch. A heap replaced by a larger one is released once every
+// graph that placed resources in it has moved to the replacement.
+//
+// Thread-safe: planners of graphs compiled in parallel (RenderGraph::UpdateGraphs) acquire
+// pools concurrently.
+class AliasPoolArbiter {
+public:
+	struct Lease {
+		rhi::ma::Allocation* allocation = nullptr;
+		uint64_t capacityBytes = 0;
+		uint64_t alignment = 1;
+		uint64_t generation = 0; // Changes whenever the heap behind the pool ID is replaced
+	};
+
+	struct FencePoint {
+		rhi::Timeline timeline;
+		uint64_t value = 0;
+	};
+
+	struct Stats {
+		uint64_t sharedHeapCount = 0;
+		uint64_t sharedHeapBytes = 0;
+		uint64_t requestedBytes = 0; // Current requirements summed over owners, what separate heaps would need
+		uint64_t heapReallocations = 0;
+		uint64_t crossGraphWaits = 0;
+	};
+
+	AliasPoolArbiter() = default;
+	~AliasPoolArbiter();
+
+	AliasPoolArbiter(const AliasPoolArbiter&) = delete;
+	AliasPoolArbiter& operator=(const AliasPoolArbiter&) = delete;
+
+	// Grows the heap when requiredBytes or alignment exceed it, by growthHeadroom over its current
+	// capacity. Throws std::runtime_error if the allocation fails, like the per-graph pools.
+	Lease AcquirePool(const void* owner, uint64_t poolID, uint64_t requiredBytes, uint64_t alignment, float growthHeadroom);
+	// The owner no longer places resources in the pool, e.g. after retiring it for idleness.
+	void ReleasePool(const void* owner, uint64_t poolID);
+	void ReleaseOwner(const void* owner);
+
+	// Signals of other owners' last frames on the heaps this owner holds. Empty when the owner
+	// was the last to execute on all of them.
+	std::vector<FencePoint> BeginExecute(const void* owner);
+	// Indexed by queue slot; slots with value 0 are skipped.
+	void EndExecute(const void* owner, std::span<const FencePoint> fencesBySlot);
+
+	Stats GetStats() const;
+
+private:
+	struct Heap {
+		TrackedHandle allocation;
+		uint64_t capacityBytes = 0;
+		uint64_t alignment = 1;
+		uint64_t generation = 0;
+		std::unordered_map<const void*, uint64_t> requiredBytesByOwner;
+		// Owners whose resources may still sit in an older heap, by the generation they hold.
+		std::unordered_map<const void*, uint64_t> generationByOwner;
+		const void* lastExecutor = nullptr;
+		std::vector<FencePoint> lastExecutorFences;
+	};
+
+	struct RetiredHeap {
+		uint64_t poolID = 0;
+		uint64_t generation = 0;
+		TrackedHandle allocation;
+	};
+
+	void ReleaseRetiredHeapsLocked();
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<uint64_t, Heap> m_heapsByPoolID;
+	std::vector<RetiredHeap> m_retiredHeaps;
+	uint64_t m_generationSerial = 0;
+	Stats m_stats{};
+};
+
+} // namespace rg::alias
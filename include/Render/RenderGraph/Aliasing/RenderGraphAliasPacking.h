@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <vector>
+
+enum class AutoAliasPackingStrategy : uint8_t;
+
+namespace rg::alias {
+
+struct AutoAliasDebugSnapshot;
+
+// Everything the packing strategies look at. Lifetimes are inclusive topological ranks.
+struct AliasPackingCandidate {
+	uint64_t resourceID = 0;
+	uint64_t sizeBytes = 0;
+	uint64_t alignment = 1;
+	size_t firstUse = 0;
+	size_t lastUse = 0;
+};
+
+struct AliasPackingPlacement {
+	uint64_t offset = 0;
+	uint64_t sizeBytes = 0;
+	uint64_t alignment = 1;
+	size_t firstUse = 0;
+	size_t lastUse = 0;
+};
+
+// placements[i] belongs to candidates[i].
+struct AliasPackingResult {
+	std::vector<AliasPackingPlacement> placements;
+	uint64_t heapSize = 0;
+	uint64_t poolAlignment = 1;
+	bool searchTruncated = false;
+};
+
+// Orders candidates the way the frame planner feeds them to PackAliasPool: by first use, then
+// larger first, then earlier last use, then resource ID.
+void SortAliasPackingCandidates(std::vector<AliasPackingCandidate>& candidates);
+
+AliasPackingResult PackAliasPool(AutoAliasPackingStrategy strategy, std::span<const AliasPackingCandidate> candidates);
+
+// True when every placement is aligned and no two lifetime-overlapping candidates share bytes.
+bool ValidateAliasPackingResult(std::span<const AliasPackingCandidate> candidates, const AliasPackingResult& result);
+
+// Offline evaluation of the packing strategies. Pools come from a captured frame
+// (BuildAliasPackingPoolsFromDebugSnapshot, requires autoAliasBuildDebugData), from a file
+// written with SaveAliasPackingPools, or from GenerateSyntheticAliasPackingPools. None of it
+// touches the device.
+struct AliasPackingBenchmarkPool {
+	uint64_t poolID = 0;
+	std::vector<AliasPackingCandidate> candidates;
+};
+
+struct AliasPackingBenchmarkResult {
+	AutoAliasPackingStrategy strategy{};
+	double averagePlanMilliseconds = 0.0;
+	double maxPlanMilliseconds = 0.0;
+	uint64_t pooledIndependentBytes = 0;
+	uint64_t pooledActualBytes = 0;
+	uint64_t pooledSavedBytes = 0;
+	size_t truncatedPools = 0;
+	bool allPlansValid = true;
+};
+
+std::vector<AliasPackingBenchmarkPool> BuildAliasPackingPoolsFromDebugSnapshot(const AutoAliasDebugSnapshot& snapshot);
+std::vector<AliasPackingBenchmarkPool> GenerateSyntheticAliasPackingPools(uint64_t seed, uint32_t poolCount, uint32_t candidatesPerPool);
+bool SaveAliasPackingPools(const std::filesystem::path& path, std::span<const AliasPackingBenchmarkPool> pools);
+bool LoadAliasPackingPools(const std::filesystem::path& path, std::vector<AliasPackingBenchmarkPool>& outPools);
+
+// Plans every pool with every strategy `iterations` times. Plan time is per full pass over all
+// pools; byte totals come from the last iteration.
+std::vector<AliasPackingBenchmarkResult> BenchmarkAliasPackingStrategies(std::span<const AliasPackingBenchmarkPool> pools, uint32_t iterations = 16);
+
+}
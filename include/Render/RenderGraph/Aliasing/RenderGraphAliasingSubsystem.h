@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <filesystem>
 #include <limits>
 #include <string>
 #include <unordered_map>
@@ -34,6 +35,7 @@ struct AutoAliasPoolRangeDebug {
 	uint64_t startByte = 0;
 	uint64_t endByte = 0;
 	uint64_t sizeBytes = 0;
+	uint64_t alignment = 1;
 	size_t firstUse = 0;
 	size_t lastUse = 0;
 	bool overlapsByteRange = false;
@@ -58,7 +60,14 @@ struct AutoAliasPlannerStats {
 	uint64_t pooledSavedBytes = 0;
 	size_t planCacheHits = 0;
 	size_t planCacheMisses = 0;
+	size_t persistedPlanCacheHits = 0;
 	const char* primaryPlanCacheMissReason = nullptr;
+	// Subresource lifetime model (autoAliasSubresourceLifetimesEnabled): peak live bytes per pool
+	// with whole-resource lifetimes versus per-mip/slice lifetimes, summed over pools.
+	size_t subresourceTrackedTextures = 0;
+	uint64_t subresourceWholePeakBytes = 0;
+	uint64_t subresourceGranularPeakBytes = 0;
+	uint64_t subresourceEstimatedSavedBytes = 0;
 };
 
 struct AutoAliasDebugSnapshot {
@@ -75,19 +84,32 @@ struct AutoAliasDebugSnapshot {
 	uint64_t pooledSavedBytes = 0;
 	size_t planCacheHits = 0;
 	size_t planCacheMisses = 0;
+	size_t persistedPlanCacheHits = 0;
 	std::string primaryPlanCacheMissReason;
+	size_t subresourceTrackedTextures = 0;
+	uint64_t subresourceWholePeakBytes = 0;
+	uint64_t subresourceGranularPeakBytes = 0;
+	uint64_t subresourceEstimatedSavedBytes = 0;
 	std::vector<AutoAliasReasonCount> exclusionReasons;
 	std::vector<AutoAliasExcludedResourceDebug> excludedResources;
 	std::vector<AutoAliasPoolDebug> poolDebug;
 };
 
 struct PersistentAliasPoolState {
-	TrackedHandle allocation;
+	TrackedHandle allocation;        // Empty for pools leased from an AliasPoolArbiter
+	rhi::ma::Allocation* sharedAllocation = nullptr;
+	uint64_t sharedGeneration = 0;   // Arbiter generation the local generation was bumped for
 	uint64_t capacityBytes = 0;
 	uint64_t alignment = 1;
 	uint64_t generation = 0;
 	uint64_t lastUsedFrame = 0;
 	bool usedThisFrame = false;
+	bool evicted = false; // Paged out by the residency policy
+
+	bool IsShared() const noexcept { return sharedAllocation != nullptr; }
+	rhi::ma::Allocation* GetAllocation() noexcept {
+		return sharedAllocation ? sharedAllocation : allocation.GetAllocation();
+	}
 };
 
 struct CachedAliasPoolPlacement {
@@ -156,12 +178,19 @@ struct FrameAliasResourceInfo {
 
 	uint64_t sizeBytes = 0;
 	uint64_t alignment = 1;
+	uint32_t mipLevels = 1;
+	uint32_t arraySize = 1;
 
 	size_t firstUse = std::numeric_limits<size_t>::max();
 	size_t lastUse = 0;
 	size_t firstUsePassIndex = std::numeric_limits<size_t>::max();
 	size_t lastUsePassIndex = std::numeric_limits<size_t>::max();
 
+	// Per-subresource lifetimes indexed [slice * mipLevels + mip]. Only filled for textures with
+	// more than one subresource while autoAliasSubresourceLifetimesEnabled is set.
+	std::vector<size_t> subresourceFirstUse;
+	std::vector<size_t> subresourceLastUse;
+
 	uint32_t maxNodeCriticality = 0;
 
 	const char* exclusionReason = nullptr;
@@ -183,6 +212,8 @@ struct CachedAliasStaticResourceInfo {
 	bool hasManualPool = false;
 	uint64_t sizeBytes = 0;
 	uint64_t alignment = 1;
+	uint32_t mipLevels = 1;
+	uint32_t arraySize = 1;
 	std::string debugName;
 	const char* exclusionReason = nullptr;
 };
@@ -206,6 +237,11 @@ public:
 	void AutoAssignAliasingPools(RenderGraph& rg, const std::vector<AliasSchedulingNode>& nodes) const;
 	void BuildAliasPlanAfterDag(RenderGraph& rg, const std::vector<AliasSchedulingNode>& nodes) const;
 	void ApplyAliasQueueSynchronization(RenderGraph& rg) const;
+
+	// Plans keyed by pool shape (sizes, alignments and lifetimes, not resource IDs) so they stay
+	// valid across runs. Returns false if the file is missing, unreadable or from another version.
+	bool LoadPersistedAliasPlans(RenderGraph& rg, const std::filesystem::path& path) const;
+	bool SavePersistedAliasPlans(const RenderGraph& rg, const std::filesystem::path& path) const;
 };
 
 } // namespace rg::alias
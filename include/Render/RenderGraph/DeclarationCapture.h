@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <rhi.h>
+
+#include "Render/QueueKind.h"
+#include "Resources/ResourceStateTracker.h"
+
+namespace rg::capture {
+
+// A frame's declaration input as the compiler saw it: the per-frame pass list with merged
+// requirements, the descriptions of every resource those requirements name, and the explicit
+// ordering edges from external insert points. Pass objects and their callbacks are not captured,
+// so a capture holds no game content beyond resource names and shapes.
+
+struct CapturedRequirement {
+	uint64_t resourceID = 0;
+	RangeSpec range;
+	ResourceState state{};
+};
+
+enum class CapturedPassType : uint8_t { Unknown = 0, Render, Compute, Copy };
+
+struct CapturedPass {
+	std::string name;
+	CapturedPassType type = CapturedPassType::Unknown;
+	QueueKind preferredQueueKind = QueueKind::Graphics;
+	QueueAssignmentPolicy queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
+	std::optional<uint8_t> pinnedQueueSlot;
+	bool isGeometryPass = false;
+	bool frameExtension = false;
+	std::vector<CapturedRequirement> requirements;
+	std::vector<CapturedRequirement> internalTransitions;
+};
+
+enum class CapturedResourceKind : uint8_t { Other = 0, Texture, Buffer };
+
+struct CapturedResource {
+	uint64_t resourceID = 0;
+	std::string name;
+	CapturedResourceKind kind = CapturedResourceKind::Other;
+	bool allowAlias = false;
+	std::optional<uint64_t> aliasingPoolID;
+	// Texture
+	uint32_t width = 0;
+	uint32_t height = 0;
+	uint32_t mipLevels = 0;
+	uint32_t arraySize = 0;
+	rhi::Format format = rhi::Format::Unknown;
+	bool isCubemap = false;
+	bool hasRTV = false;
+	bool hasDSV = false;
+	bool hasUAV = false;
+	bool hasSRV = false;
+	// Buffer
+	uint64_t sizeBytes = 0;
+	rhi::HeapType heapType = rhi::HeapType::DeviceLocal;
+	bool unorderedAccess = false;
+};
+
+struct FrameDeclarationCapture {
+	uint64_t frameSerial = 0;
+	std::vector<CapturedPass> passes;       // Frame pass order
+	std::vector<CapturedResource> resources; // Sorted by resource ID
+	std::vector<std::pair<std::string, std::string>> explicitAfterEdges; // (anchor, pass)
+};
+
+bool SaveFrameDeclarationCapture(const FrameDeclarationCapture& capture, const std::filesystem::path& path);
+bool LoadFrameDeclarationCapture(const std::filesystem::path& path, FrameDeclarationCapture& out);
+
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Set of dense per-frame resource indices (see RenderGraph::RebuildFrameSchedulingResourceIndex).
+// Membership is a bitset test; members are also kept in insertion order so iteration and
+// Clear() only touch what was inserted, which keeps per-pass scratch sets cheap to reuse.
+class DenseResourceIndexSet {
+public:
+	DenseResourceIndexSet() = default;
+	explicit DenseResourceIndexSet(size_t capacity) { Reset(capacity); }
+
+	// Drops all members and sizes the bitset for indices in [0, capacity).
+	void Reset(size_t capacity) {
+		m_words.assign((capacity + 63) / 64, 0);
+		m_members.clear();
+	}
+
+	bool Insert(size_t index) {
+		const size_t word = index >> 6;
+		if (word >= m_words.size()) {
+			m_words.resize(word + 1, 0);
+		}
+		const uint64_t bit = uint64_t(1) << (index & 63);
+		if ((m_words[word] & bit) != 0) {
+			return false;
+		}
+		m_words[word] |= bit;
+		m_members.push_back(static_cast<uint32_t>(index));
+		return true;
+	}
+
+	bool Contains(size_t index) const noexcept {
+		const size_t word = index >> 6;
+		return word < m_words.size() && (m_words[word] & (uint64_t(1) << (index & 63))) != 0;
+	}
+
+	void Clear() noexcept {
+		for (uint32_t index : m_members) {
+			m_words[index >> 6] = 0;
+		}
+		m_members.clear();
+	}
+
+	bool empty() const noexcept { return m_members.empty(); }
+	size_t size() const noexcept { return m_members.size(); }
+	size_t Capacity() const noexcept { return m_words.size() * 64; }
+
+	std::vector<uint32_t>::const_iterator begin() const noexcept { return m_members.begin(); }
+	std::vector<uint32_t>::const_iterator end() const noexcept { return m_members.end(); }
+	const std::vector<uint32_t>& Members() const noexcept { return m_members; }
+
+private:
+	std::vector<uint64_t> m_words;
+	std::vector<uint32_t> m_members;
+};
@@ -20,6 +20,13 @@ struct QueueBatchSchedule {
 	// Pre-allocated CL pairs (indexed 0..numCLs-1).
 	// Filled during the pre-allocation phase of Execute().
 	std::array<CommandListPair, 3> preallocatedCLs;
+	// Estimated recording size of each CL, passed to CommandListPool::Request so allocators are
+	// matched to similarly sized work. One unit per transition, kPassRecordingWeight per pass.
+	std::array<uint64_t, 3> clSizeHints{};
+	static constexpr uint64_t kPassRecordingWeight = 64;
+	// Lists submitted in order ahead of preallocatedCLs[i], in the same Submit. Filled while
+	// recording when a long immediate stream is replayed on several lists at once.
+	std::array<std::vector<CommandListPair>, 3> leadingCLs;
 
 	// External fences collected during recording (populated by RecordQueueBatch,
 	// consumed by the submission phase).
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <vector>
+#include <filesystem>
 #include <unordered_map>
 #include <unordered_set>
 #include <string>
@@ -11,6 +12,10 @@
 #include <span>
 #include <utility>
 #include <array>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
 #include <spdlog/spdlog.h>
 #include <rhi.h>
 #include <tracy/Tracy.hpp>
@@ -21,6 +26,8 @@
 #include "Resources/ResourceStateTracker.h"
 #include "Interfaces/IResourceProvider.h"
 #include "Render/ResourceRegistry.h"
+#include "Render/FrameConstantAllocator.h"
+#include "Render/ResourceDescriptorIndexTable.h"
 #include "Render/CommandListPool.h"
 #include "Interfaces/IPassBuilder.h"
 #include "Render/MemoryIntrospectionAPI.h"
@@ -30,14 +37,21 @@
 #include "Render/Runtime/IDescriptorService.h"
 #include "Render/Runtime/IRenderGraphSettingsService.h"
 #include "Render/Runtime/ITaskService.h"
+#include "Render/Runtime/IPipelineCompileService.h"
+#include "Render/Runtime/IShaderCompileService.h"
+#include "Render/PassId.h"
 #include "Render/QueueKind.h"
 #include "Render/QueueRegistry.h"
 #include "Resources/PixelBuffer.h"
 #include "Resources/Buffers/Buffer.h"
 #include "Resources/TrackedAllocation.h"
+#include "Render/RenderGraph/Aliasing/AliasPoolArbiter.h"
 #include "Render/RenderGraph/Aliasing/RenderGraphAliasingSubsystem.h"
 #include "Render/RenderGraph/ExecutionSchedule.h"
+#include "Render/RenderGraph/DeclarationCapture.h"
+#include "Render/RenderGraph/DenseResourceIndexSet.h"
 #include "Interfaces/IResourceResolver.h"
+#include "Interfaces/IPipelineDependentPass.h"
 
 class Resource;
 class RenderPassBuilder;
@@ -46,6 +60,7 @@ class CopyPassBuilder;
 class CommandRecordingManager;
 struct IPassBuilder;
 struct IDynamicDeclaredResources;
+struct IStaticDeclaredResources;
 
 namespace ui {
 	struct FrameGraphSnapshot;
@@ -104,6 +119,7 @@ enum class AutoAliasMode : uint8_t {
 enum class AutoAliasPackingStrategy : uint8_t {
 	GreedySweepLine = 0,
 	BranchAndBound = 1,
+	IntervalBestFit = 2,
 };
 
 class RenderGraph {
@@ -153,6 +169,7 @@ public:
 		std::optional<QueueKind> preferredQueueKind;
 		std::optional<QueueAssignmentPolicy> queueAssignmentPolicy;
 		std::optional<QueueSlotIndex> pinnedQueueSlot; // Target a specific queue slot, bypassing queue preference
+		bool latencyCritical = false; // Prefer High/Realtime priority queue slots; see QueuePriority
 
 		// Optional: if true, the pass will be registered in Get*PassByName().
 		bool registerName = true;
@@ -225,6 +242,16 @@ public:
 			return std::move(*this);
 		}
 
+		ExternalPassDesc& LatencyCritical() & {
+			latencyCritical = true;
+			return *this;
+		}
+
+		ExternalPassDesc LatencyCritical() && {
+			latencyCritical = true;
+			return std::move(*this);
+		}
+
 		ExternalPassDesc& RegisterByName(bool enabled = true) & {
 			registerName = enabled;
 			return *this;
@@ -292,6 +319,9 @@ public:
 	struct RetainedDeclarationCache {
 		bool hasDynamicDeclaredResources = false;
 		IDynamicDeclaredResources* dynamicInterface = nullptr;
+		IStaticDeclaredResources* staticInterface = nullptr;
+		IPipelineDependentPass* pipelineInterface = nullptr;
+		uint64_t staticInvalidationToken = 0; // Token the declaration was built under
 
 		bool containsEphemeralOrAnonymousHandles = false;
 		bool requiresStaleHandleValidation = false;
@@ -303,11 +333,22 @@ public:
 		uint64_t retainedAccessCacheKey = 0;
 	};
 
+	// A pass's last immediate stream and the requirements derived from it. A byte-identical stream
+	// next frame reuses the requirements; a pass with static immediate commands (see
+	// IHasImmediateModeCommands::ImmediateCommandsAreStatic) skips recording while `key` holds.
+	// Shared, so the per-frame copies of a pass entry don't copy the stream.
+	struct CachedImmediateRecording {
+		uint64_t key = 0;
+		std::vector<std::byte> bytecode;
+		std::vector<ResourceRequirement> requirements;
+	};
+
 	struct RenderPassAndResources { // TODO: I'm currently copying these a lot; maybe use pointers instead
 		std::shared_ptr<RenderPass> pass;
 		RenderPassParameters resources;
 		std::string name;
 		std::string techniquePath;
+		PassId passId; // Stable across rebuilds; see AcquirePassId
 		int statisticsIndex = -1;
 		bool collectStatistics = true;
 
@@ -317,6 +358,8 @@ public:
 		std::vector<std::shared_ptr<Resource>> retainedAnonymousKeepAlive; // Keeps retained anonymous handles alive across frames
 		std::vector<ResolverSnapshot> resolverSnapshots; // Versioned resolver snapshots for auto-invalidation
 		RetainedDeclarationCache declarationCache;
+		std::shared_ptr<CachedImmediateRecording> immediateRecording;
+		RenderPassMergeInfo renderPassMerge{}; // Per-frame merge group, see BuildRenderPassMergeGroups
 	};
 
 	struct ComputePassAndResources { // TODO: Same as above
@@ -324,6 +367,7 @@ public:
 		ComputePassParameters resources;
 		std::string name;
 		std::string techniquePath;
+		PassId passId; // Stable across rebuilds; see AcquirePassId
 		int statisticsIndex = -1;
 		bool collectStatistics = true;
 
@@ -333,6 +377,7 @@ public:
 		std::vector<std::shared_ptr<Resource>> retainedAnonymousKeepAlive; // Keeps retained anonymous handles alive across frames
 		std::vector<ResolverSnapshot> resolverSnapshots; // Versioned resolver snapshots for auto-invalidation
 		RetainedDeclarationCache declarationCache;
+		std::shared_ptr<CachedImmediateRecording> immediateRecording;
 	};
 
 	struct CopyPassAndResources {
@@ -340,6 +385,7 @@ public:
 		CopyPassParameters resources;
 		std::string name;
 		std::string techniquePath;
+		PassId passId; // Stable across rebuilds; see AcquirePassId
 		int statisticsIndex = -1;
 		bool collectStatistics = true;
 
@@ -349,6 +395,7 @@ public:
 		std::vector<std::shared_ptr<Resource>> retainedAnonymousKeepAlive; // Keeps retained anonymous handles alive across frames
 		std::vector<ResolverSnapshot> resolverSnapshots; // Versioned resolver snapshots for auto-invalidation
 		RetainedDeclarationCache declarationCache;
+		std::shared_ptr<CachedImmediateRecording> immediateRecording;
 	};
 
 	enum class BatchWaitPhase : uint8_t {
@@ -388,6 +435,31 @@ public:
 			for (auto& p : queueSignalFenceValue) p.assign(queueCount, 0);
 		}
 
+		// Restores the freshly constructed state for queueCount queues while keeping the capacity
+		// of every nested vector, so batches recycled from the previous frame avoid reallocating.
+		void Reset(size_t queueCount) {
+			auto resetPerQueue = [queueCount](auto& perQueue) {
+				perQueue.resize(queueCount);
+				for (auto& entries : perQueue) entries.clear();
+			};
+			resetPerQueue(queuePasses);
+			for (auto& v : queueTransitions) resetPerQueue(v);
+			resetPerQueue(externalWaitsBeforeTransitions);
+			internallyTransitionedResources.clear();
+			allResources.clear();
+			for (auto& p : queueWaitEnabled) {
+				p.resize(queueCount);
+				for (auto& row : p) row.assign(queueCount, 0);
+			}
+			for (auto& p : queueWaitFenceValue) {
+				p.resize(queueCount);
+				for (auto& row : p) row.assign(queueCount, 0);
+			}
+			for (auto& p : queueSignalEnabled) p.assign(queueCount, 0);
+			for (auto& p : queueSignalFenceValue) p.assign(queueCount, 0);
+			passBatchTrackersByResourceIndex.clear();
+		}
+
 		size_t QueueCount() const noexcept { return queuePasses.size(); }
 
 		std::vector<std::vector<QueuedPass>> queuePasses;
@@ -584,23 +656,271 @@ public:
 	void AddRenderPass(std::shared_ptr<RenderPass> pass, RenderPassParameters& resources, std::string name = "", std::vector<ResolverSnapshot> resolverSnapshots = {});
 	void AddComputePass(std::shared_ptr<ComputePass> pass, ComputePassParameters& resources, std::string name = "", std::vector<ResolverSnapshot> resolverSnapshots = {});
 	void AddCopyPass(std::shared_ptr<CopyPass> pass, CopyPassParameters& resources, std::string name = "", std::vector<ResolverSnapshot> resolverSnapshots = {});
+	// Update() runs pass updates and compiles the frame; Execute() records and submits it.
+	// The two must stay strictly ordered: CompileFrame consumes state that only the previous
+	// Execute() produces (cross-frame producer fences, submission-order signal values and
+	// published tracker states), and pass Update() hooks mutate the same pass objects that
+	// Execute() records from. Compile work is parallelized inside CompileFrame instead.
 	void Update(const UpdateExecutionContext& context, rhi::Device device);
 	void Execute(PassExecutionContext& context);
+	// Runs Update on several graphs (one per view) concurrently, one task per graph, with
+	// contexts[i] for graphs[i]. The graphs must not share passes or resources, and services they
+	// share (settings, statistics, uploads) must be thread-safe. Nested ParallelFor calls inside
+	// each compile follow the task service's nesting policy. Execute stays per graph and serial.
+	static void UpdateGraphs(
+		std::span<RenderGraph* const> graphs,
+		std::span<const UpdateExecutionContext> contexts,
+		rhi::Device device,
+		rg::runtime::ITaskService& taskService);
 	void CompileStructural();
 	void ResetForFrame();
 	void ResetForRebuild();
 	void PrepareExtensionsForBuild();
 	void Setup();
 	void RegisterExtension(std::unique_ptr<IRenderGraphExtension> ext, std::optional<std::string_view> id = std::nullopt);
+	// Incremental structural edits for editor iteration and hot reload, instead of ResetForRebuild,
+	// the pass builders, CompileStructural and Setup. Only valid after Setup(). Between
+	// BeginStructuralEdit and CommitStructuralEdit:
+	//  - Build*Pass with a name not in the graph inserts a pass before insertBefore, or after the
+	//    last builder-declared pass when insertBefore is empty or unknown;
+	//  - ReplacePass(name) followed by Build*Pass(name, ...) swaps in a newly constructed pass at the
+	//    same position; a replaced pass that is not built again is removed;
+	//  - ReloadPass(name) keeps the pass object and re-runs DeclareResourceUsages and Setup, which
+	//    picks up shader hot reloads and SetPassTechnique changes;
+	//  - RemovePass(name) drops a pass;
+	//  - RegisterExtension adds an extension, ReloadExtension(id) gathers its structural passes
+	//    again and RemoveExtension(id) drops it together with its structural passes.
+	// Commit declares and sets up only the touched passes, plus any untouched pass that declared a
+	// resource key a replaced or removed pass provided, and drops only the cached replay segments
+	// that contain a touched pass.
+	void BeginStructuralEdit(std::string insertBefore = {});
+	void ReplacePass(std::string const& name);
+	void ReloadPass(std::string const& name);
+	void RemovePass(std::string const& name);
+	void ReloadExtension(std::string_view id);
+	void RemoveExtension(std::string_view id);
+	void CommitStructuralEdit();
+	bool IsInStructuralEdit() const noexcept { return m_structuralEdit.active; }
+	struct StructuralEditStats {
+		uint64_t passesDeclared = 0;     // Passes that ran DeclareResourceUsages and Setup
+		uint64_t passesRemoved = 0;
+		uint64_t dependentPassesRedeclared = 0;
+		uint64_t extensionsGathered = 0;
+		uint64_t replaySegmentsDropped = 0;
+		double commitMs = 0.0;
+	};
+	const StructuralEditStats& GetLastStructuralEditStats() const noexcept { return m_lastStructuralEditStats; }
 	const std::vector<PassBatch>& GetBatches() const { return batches; }
 	std::optional<PresentDependency> GetLastPresentDependency() const noexcept { return m_lastPresentDependency; }
+	// Present-latency mode (renderGraphPresentLatencyModeEnabled): the scheduler submits the
+	// passes that feed a present before anything else, the present queue signals as soon as they
+	// finish (that signal is the frame's PresentDependency) and the remaining work (readbacks,
+	// streaming, async compute for later frames) only starts after it.
+	//
+	// WaitForPresentLatencyBudget blocks until no more than renderGraphPresentLatencyMaxQueuedFrames
+	// frames' present work is still running on the GPU. Call it right before sampling input; Update
+	// calls it itself when the host has not this frame. It returns immediately outside latency mode.
+	struct PresentLatencyStats {
+		uint64_t presentCriticalPasses = 0;
+		uint64_t deferredPasses = 0;
+		uint64_t throttledFrames = 0; // Frame starts that had to wait
+		double lastThrottleWaitMs = 0.0;
+	};
+	void WaitForPresentLatencyBudget();
+	const PresentLatencyStats& GetLastPresentLatencyStats() const noexcept { return m_lastPresentLatencyStats; }
+	// External waits (ExternalTimelinePoint) from the last Execute. A wait is elided when an
+	// earlier wait on the same queue already covered the value, or the timeline has passed it.
+	struct ExternalWaitStats {
+		uint64_t issued = 0;
+		uint64_t elidedCovered = 0;
+		uint64_t elidedCompleted = 0;
+	};
+	const ExternalWaitStats& GetLastExternalWaitStats() const noexcept { return m_lastExternalWaitStats; }
+	// Queue submissions from the last Execute. Consecutive batches on a queue go out in one
+	// Submit until a wait, signal or external fence forces a boundary; a cross-queue wait that an
+	// earlier wait in the frame covered, or whose value has completed, is elided and does not.
+	struct SubmitStats {
+		uint64_t submitCalls = 0;
+		uint64_t submittedCommandLists = 0;
+		uint64_t queueWaitsElided = 0;
+	};
+	const SubmitStats& GetLastSubmitStats() const noexcept { return m_lastSubmitStats; }
+	// Leases alias pool heaps from a process-wide arbiter shared with other graphs instead of
+	// allocating them per graph; null restores per-graph pools. Pools move to the new heaps on
+	// the next compile.
+	void SetAliasPoolArbiter(std::shared_ptr<rg::alias::AliasPoolArbiter> arbiter);
+	rg::alias::AliasPoolArbiter* GetAliasPoolArbiter() const noexcept { return m_aliasPoolArbiter.get(); }
+	// Dead-pass culling (renderGraphDeadPassCullingEnabled) keeps passes whose writes reach a
+	// present, a pass with no tracked writes, or one of these root resources. Mark anything
+	// consumed outside the frame (history buffers read next frame, CPU-visible results) as a root.
+	void AddCullingRootResource(const Resource& resource);
+	void RemoveCullingRootResource(const Resource& resource);
+	void ClearCullingRootResources() { m_cullingRootResourceIDs.clear(); }
+	const std::vector<std::string>& GetLastCulledPassNames() const noexcept { return m_lastCulledPassNames; }
+	// Background materialization (backgroundMaterializationEnabled): while a requested resource is
+	// unmaterialized (first use, or after a resize dematerializes it) its backing is created on a
+	// worker thread instead of inside CompileFrame. Until it is ready the policy decides what the
+	// frame does with passes that touch it. Resources that may alias are placed by the frame's
+	// alias plan and keep materializing in the frame. The worker creates tracked allocations off
+	// the main thread, so hosts with their own ECS hooks must make them thread-safe. With the
+	// default hooks it only runs while trackedAllocationEntityBatchingEnabled is set; otherwise
+	// requests are ignored and resources materialize in the frame.
+	enum class PendingMaterializationPolicy : uint8_t {
+		SkipDependentPasses, // Drop passes that touch the resource until it is ready
+		Wait,                // A frame that uses the resource waits for the worker
+	};
+	void RequestBackgroundMaterialization(const std::shared_ptr<Resource>& resource, PendingMaterializationPolicy policy = PendingMaterializationPolicy::SkipDependentPasses);
+	void CancelBackgroundMaterialization(const Resource& resource);
+	const std::vector<std::string>& GetLastPendingMaterializationSkippedPassNames() const noexcept { return m_lastPendingMaterializationSkippedPassNames; }
+	// Passes dropped from the last compiled frame because a feature domain they are members of
+	// (InFeatureDomain) is disabled in FeatureDomainRegistry.
+	const std::vector<std::string>& GetLastFeatureDomainSkippedPassNames() const noexcept { return m_lastFeatureDomainSkippedPassNames; }
+	// Passes dropped from the last compiled frame because an IPipelineDependentPass reported a
+	// pipeline that is still compiling or failed to compile.
+	const std::vector<std::string>& GetLastPipelinePendingSkippedPassNames() const noexcept { return m_lastPipelinePendingSkippedPassNames; }
+	// Per-pass outcome of the IStaticDeclaredResources check, keyed by pass name: a hit kept the
+	// retained declaration, a miss re-ran DeclareResourceUsages. Accumulates until ResetForRebuild.
+	struct StaticDeclarationStats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t resolverVersionMisses = 0;
+		uint64_t handleGenerationMisses = 0;
+		uint64_t invalidationTokenMisses = 0;
+	};
+	const std::unordered_map<std::string, StaticDeclarationStats>& GetStaticDeclarationStats() const noexcept { return m_staticDeclarationStatsByPassName; }
+	// CPU time of the most recent CompileStructural, CompileFrame and Execute, with CompileFrame
+	// split into its phases, for benchmark harnesses and compile-time regression tracking.
+	struct CompileTimings {
+		enum class Phase : uint8_t {
+			Reset = 0,
+			RefreshDeclarations,
+			ImmediateRecording,
+			FrameExtensions,
+			PassAccess,
+			DependencyGraph,
+			Aliasing,
+			QueueAssignment,
+			Materialize,
+			Replay,
+			Schedule,
+			QueueSync,
+			Diagnostics,
+			Count
+		};
+		static const char* PhaseName(Phase phase) noexcept;
+
+		uint64_t compileFrameCount = 0;
+		double structuralMs = 0.0;
+		double compileFrameMs = 0.0;
+		double executeMs = 0.0;
+		std::array<double, static_cast<size_t>(Phase::Count)> phaseMs{};
+		bool replayAttempted = false;
+		bool replayUsed = false;
+		uint64_t replaySegments = 0;
+		uint64_t replayPasses = 0;
+		uint64_t passCount = 0;
+		uint64_t batchCount = 0;
+
+		// One JSON object on a single line, suitable for JSON-lines result files.
+		std::string ToJson() const;
+	};
+	// Null after shutdown; see ResourceDescriptorIndexTable for the shader-side contract.
+	ResourceDescriptorIndexTable* GetResourceDescriptorIndexTable() const noexcept { return m_descriptorIndexTable.get(); }
+	// Also handed to passes as PassExecutionContext::constantAllocator. Null after shutdown.
+	FrameConstantAllocator* GetFrameConstantAllocator() const noexcept { return m_frameConstantAllocator.get(); }
+	const CompileTimings& GetLastCompileTimings() const noexcept { return m_lastCompileTimings; }
+	// Counters from the most recent CompileFrame alongside its timings. Gathered on every frame
+	// regardless of the logging toggles, so tests and dashboards can assert on compiler behaviour
+	// without parsing the lightweight compile summary.
+	struct CompileMetrics {
+		CompileTimings timings;
+
+		// Frame shape after scheduling. Skipped passes were dropped for a disabled feature domain,
+		// pending background materialization or a pipeline still compiling.
+		uint64_t culledPassCount = 0;
+		uint64_t skippedPassCount = 0;
+		uint64_t transitionCount = 0;
+		uint64_t queueWaitCount = 0;
+		uint64_t externalWaitCount = 0;
+		uint64_t queueSignalCount = 0;
+
+		// Retained declaration fast path.
+		uint64_t declarationRefreshRequested = 0;
+		uint64_t declarationRefreshEquivalent = 0;
+		uint64_t staticDeclarationHits = 0;
+		uint64_t staticDeclarationMisses = 0;
+
+		// Authoritative replay cache.
+		uint64_t replayDynamicGapPasses = 0;
+		uint64_t replayCacheSegments = 0;
+		uint64_t replayCacheEntries = 0;
+		uint64_t replaySegmentLookupHits = 0;
+		uint64_t replaySegmentLookupMisses = 0;
+		uint64_t replaySelectedSegments = 0;
+		uint64_t replaySkippedIneligible = 0;
+		uint64_t replaySkippedTraceRange = 0;
+		uint64_t replaySkippedPassHash = 0;
+		uint64_t replaySkippedLookupMiss = 0;
+
+		// Schedule regions.
+		uint64_t candidateRegions = 0;
+		uint64_t acceptedRegions = 0;
+		uint64_t rejectedRegions = 0;
+		uint64_t regionCoveredPasses = 0;
+		uint64_t estimatedSavedAddTransitionCalls = 0;
+		uint64_t estimatedSavedIsNewBatchNeededCalls = 0;
+
+		// Transition placement.
+		uint64_t transitionPlacementCandidates = 0;
+		uint64_t canonicalBeforePassTransitions = 0;
+		uint64_t inlineEarlyPlacedTransitions = 0;
+		uint64_t graphicsFallbackTransitions = 0;
+		uint64_t aliasActivationTransitions = 0;
+		uint64_t splitBarriers = 0;
+		uint64_t readStateMergeSavedTransitions = 0;
+		uint64_t crossFrameEndStateTransitions = 0;
+		uint64_t fullOverwriteDiscardTransitions = 0;
+
+		// Automatic aliasing planner.
+		uint64_t aliasCandidates = 0;
+		uint64_t aliasAutoAssigned = 0;
+		uint64_t aliasExcluded = 0;
+		uint64_t aliasPooledActualBytes = 0;
+		uint64_t aliasPooledSavedBytes = 0;
+		uint64_t aliasPlanCacheHits = 0;
+		uint64_t aliasPlanCacheMisses = 0;
+		uint64_t aliasPersistedPlanCacheHits = 0;
+
+		// Resources given a new backing allocation by this frame's materialize pass.
+		uint64_t materializedResources = 0;
+
+		// One JSON object on a single line, with the timings nested under "timings".
+		std::string ToJson() const;
+	};
+	CompileMetrics GetLastCompileMetrics() const {
+		CompileMetrics metrics = m_lastCompileMetrics;
+		metrics.timings = m_lastCompileTimings;
+		return metrics;
+	}
+	// Writes the declaration input of the next compiled frame to path (see DeclarationCapture.h),
+	// for replaying real graphs through the compiler offline.
+	void RequestDeclarationCapture(std::filesystem::path path) { m_pendingDeclarationCapturePath = std::move(path); }
+	// Optional on-disk alias plan cache. Loading remembers the path and the plans are written
+	// back there when the graph is destroyed; pools whose shape matches a loaded plan skip packing.
+	bool LoadAliasPlanCache(const std::filesystem::path& path);
+	bool SaveAliasPlanCache(const std::filesystem::path& path) const;
 	rg::memory::SnapshotProvider& GetMemorySnapshotProvider() { return m_memorySnapshotProvider; }
 	const rg::memory::SnapshotProvider& GetMemorySnapshotProvider() const { return m_memorySnapshotProvider; }
 	std::vector<RGCacheOverlayRange> BuildReplayCacheOverlayRanges() const;
 	void SetStatisticsService(std::shared_ptr<rg::runtime::IStatisticsService> service) { m_statisticsService = std::move(service); }
 	rg::runtime::IStatisticsService* GetStatisticsService() { return m_statisticsService.get(); }
 	const rg::runtime::IStatisticsService* GetStatisticsService() const { return m_statisticsService.get(); }
-	void SetUploadService(std::shared_ptr<rg::runtime::IUploadService> service) { m_uploadService = std::move(service); }
+	void SetUploadService(std::shared_ptr<rg::runtime::IUploadService> service) {
+		m_uploadService = std::move(service);
+		if (m_uploadService) {
+			m_uploadService->SetTaskService(m_taskService);
+		}
+	}
 	rg::runtime::IUploadService* GetUploadService() { return m_uploadService.get(); }
 	const rg::runtime::IUploadService* GetUploadService() const { return m_uploadService.get(); }
 	void SetReadbackService(std::shared_ptr<rg::runtime::IReadbackService> service) { m_readbackService = std::move(service); }
@@ -612,9 +932,41 @@ public:
 	void SetRenderGraphSettingsService(std::shared_ptr<rg::runtime::IRenderGraphSettingsService> service) { m_renderGraphSettingsService = std::move(service); }
 	rg::runtime::IRenderGraphSettingsService* GetRenderGraphSettingsService() { return m_renderGraphSettingsService.get(); }
 	const rg::runtime::IRenderGraphSettingsService* GetRenderGraphSettingsService() const { return m_renderGraphSettingsService.get(); }
-	void SetTaskService(std::shared_ptr<rg::runtime::ITaskService> service) { m_taskService = std::move(service); }
+	void SetTaskService(std::shared_ptr<rg::runtime::ITaskService> service) {
+		// Background work queued on the old service finishes before anything moves over.
+		if (m_taskService && m_taskService != service) {
+			m_taskService->WaitForBackgroundIdle();
+		}
+		m_taskService = std::move(service);
+		m_queueRegistry.SetTaskService(m_taskService);
+		if (m_uploadService) {
+			m_uploadService->SetTaskService(m_taskService);
+		}
+		if (m_pipelineCompileService) {
+			m_pipelineCompileService->SetTaskService(m_taskService);
+		}
+		if (m_shaderCompileService) {
+			m_shaderCompileService->SetTaskService(m_taskService);
+		}
+	}
 	rg::runtime::ITaskService* GetTaskService() { return m_taskService.get(); }
 	const rg::runtime::ITaskService* GetTaskService() const { return m_taskService.get(); }
+	void SetPipelineCompileService(std::shared_ptr<rg::runtime::IPipelineCompileService> service) {
+		m_pipelineCompileService = std::move(service);
+		if (m_pipelineCompileService) {
+			m_pipelineCompileService->SetTaskService(m_taskService);
+		}
+	}
+	rg::runtime::IPipelineCompileService* GetPipelineCompileService() { return m_pipelineCompileService.get(); }
+	const rg::runtime::IPipelineCompileService* GetPipelineCompileService() const { return m_pipelineCompileService.get(); }
+	void SetShaderCompileService(std::shared_ptr<rg::runtime::IShaderCompileService> service) {
+		m_shaderCompileService = std::move(service);
+		if (m_shaderCompileService) {
+			m_shaderCompileService->SetTaskService(m_taskService);
+		}
+	}
+	rg::runtime::IShaderCompileService* GetShaderCompileService() { return m_shaderCompileService.get(); }
+	const rg::runtime::IShaderCompileService* GetShaderCompileService() const { return m_shaderCompileService.get(); }
 	void SetStructuralMaterializeCheckpointCallback(std::function<void(std::string_view)> callback) {
 		m_structuralMaterializeCheckpointCallback = std::move(callback);
 	}
@@ -694,17 +1046,66 @@ public:
 		QueueKind kind,
 		const char* name,
 		QueueAutoAssignmentPolicy autoAssignmentPolicy = QueueAutoAssignmentPolicy::AllowAutomaticScheduling);
+	/// Register a queue the host created itself, typically at High or Realtime priority through the
+	/// native API (rhi creates every queue at normal priority). The graph does not destroy it.
+	/// Same timing rules as CreateQueue.
+	QueueSlotIndex RegisterQueue(
+		QueueKind kind,
+		rhi::Queue queue,
+		QueuePriority priority,
+		QueueAutoAssignmentPolicy autoAssignmentPolicy = QueueAutoAssignmentPolicy::AllowAutomaticScheduling);
+	/// Register a queue on a secondary adapter (DeviceManager::AddAdapter) for explicit
+	/// multi-adapter work such as shadow maps or probes rendered on a second GPU. Automatic
+	/// scheduling never picks the slot; pin passes to it with pinnedQueueSlot. Its fence and those
+	/// of the slots on other adapters are opened on each other's devices through DeviceManager's
+	/// shared timeline hook, so the cross-queue waits the graph inserts between dependent passes
+	/// become cross-adapter timeline waits; a transfer is a copy pass pinned to a copy slot on the
+	/// receiving adapter. Passes pinned here record on that adapter's command lists, so they may
+	/// only use resources valid on its device, such as cross-adapter shared resources the host
+	/// opened there, and a non-graphics slot cannot take transitions that need a graphics queue.
+	/// Without the hook, or when it cannot open one of the fences, this logs the reason and
+	/// returns 0xFF without registering a slot. Same timing rules as CreateQueue.
+	QueueSlotIndex RegisterAdapterQueue(
+		AdapterIndex adapter,
+		QueueKind kind,
+		rhi::Queue queue,
+		QueuePriority priority = QueuePriority::Normal);
 	void SetMinimumAutomaticSchedulingQueues(QueueKind kind, uint8_t count);
+	// Adaptive queue count (queueSchedulingAdaptiveQueueCountEnabled): Setup creates
+	// queueSchedulingAdaptiveQueueCountMaxQueues automatic compute and copy slots, and each
+	// adaptive placement window trials one more or one fewer active slot of one kind. The frame
+	// cost is the sum over batches of the longest queue's batch time, plus the configured cost per
+	// cross-queue wait. An extra slot is kept only on a clear win; removing one is kept unless the
+	// frame gets clearly slower, so machines where a second queue only adds fences settle on one.
+	struct AdaptiveQueueCountStats {
+		std::array<uint8_t, static_cast<size_t>(QueueKind::Count)> activeLimitByKind{}; // 0 = not limited
+		std::array<double, static_cast<size_t>(QueueKind::Count)> busyMsByKind{};       // Summed batch time
+		double estimatedFrameMs = 0.0;
+		uint64_t crossQueueWaits = 0; // In the last executed frame
+		uint64_t trialsKept = 0;
+		uint64_t trialsReverted = 0;
+	};
+	const AdaptiveQueueCountStats& GetAdaptiveQueueCountStats() const noexcept { return m_adaptiveQueueCount.stats; }
 	uint8_t GetMinimumAutomaticSchedulingQueues(QueueKind kind) const noexcept {
 		return m_minAutomaticSchedulingQueuesByKind[static_cast<size_t>(kind)];
 	}
 
+	/// False until the backend installs DeviceManager's predication hook; until then
+	/// WithPredication passes run unconditionally.
+	static bool SupportsPassPredication();
+	/// False until the backend installs DeviceManager's residency hook; until then idle alias
+	/// pools are never evicted and only committed D3D12 resources are.
+	static bool SupportsAliasPoolEviction();
+
 	/// Access the queue registry (read-only).
 	const QueueRegistry& GetQueueRegistry() const noexcept { return m_queueRegistry; }
 	QueueRegistry& GetQueueRegistry() noexcept { return m_queueRegistry; }
 
 private:
 	std::string GetTechniquePathForPassName(std::string_view passName) const;
+	// Dense ID for a pass name, handed out on first use and kept for the graph's lifetime, so
+	// statistics stay indexed the same across rebuilds. Unnamed passes get a fresh ID each time.
+	PassId AcquirePassId(std::string_view passName);
 
 	struct AnyPassAndResources {
 		PassType type = PassType::Unknown;
@@ -770,6 +1171,7 @@ private:
 		RangeSpec range{};
 		ResourceState state{};
 		bool isUAV = false;
+		bool fullOverwrite = false;
 		const std::vector<size_t>* equivalentResourceIndices = nullptr;
 	};
 
@@ -788,6 +1190,7 @@ private:
 		ResourceState state{};
 		bool isUAV = false;
 		bool isWrite = false;
+		bool fullOverwrite = false;
 	};
 
 	struct FramePassInternalTransitionStaticSummary {
@@ -805,6 +1208,7 @@ private:
 		QueueKind preferredQueueKind = QueueKind::Graphics;
 		QueueAssignmentPolicy queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
 		std::optional<QueueSlotIndex> pinnedQueueSlot;
+		bool latencyCritical = false;
 	};
 
 	struct CachedFramePassAccessSummary {
@@ -813,6 +1217,50 @@ private:
 		std::vector<uint64_t> usedResourceIDs;
 	};
 
+	// Edge discovered while walking one resource's access sequence. accessPosition is the
+	// index of the consuming access inside the "to" pass's dagAccesses, which lets merged
+	// per-resource edges be ordered exactly like the serial pass-order walk emits them.
+	struct DependencyEdgeRecord {
+		uint32_t to = 0;
+		uint32_t accessPosition = 0;
+		uint32_t from = 0;
+	};
+
+	// Previous frame's dependency edges, grouped per DAG resource. The edges of a resource only
+	// depend on the ordered accesses to it, so resources touched exclusively by passes whose
+	// DAG access list is unchanged can reuse last frame's edges without walking them again.
+	struct IncrementalDependencyGraphCache {
+		bool valid = false;
+		std::vector<uint64_t> passAccessKeys;
+		std::vector<uint32_t> passAccessOffsets;
+		std::vector<uint64_t> passAccessResourceIDs;
+		std::vector<uint64_t> resourceIDs; // Sorted, matches m_frameDAGResourceIDsByIndex of the cached frame
+		std::vector<uint32_t> edgeOffsetsByResource;
+		std::vector<DependencyEdgeRecord> edges;
+	};
+
+	// Finalized dependency graph of the previous frame, keyed by a fingerprint of every pass's DAG
+	// accesses and the explicit ordering edges. In ReplayAuthoritative mode a structurally
+	// identical frame copies these edges instead of running BuildDependencyGraph at all.
+	struct FrameDependencyGraphCache {
+		bool valid = false;
+		uint64_t fingerprint = 0;
+		std::vector<std::vector<size_t>> outByNode;
+		std::vector<std::vector<size_t>> inByNode;
+		std::vector<uint32_t> indegreeByNode;
+		std::vector<size_t> topoRankByNode;
+		std::vector<uint32_t> criticalityByNode;
+	};
+
+	struct IncrementalDependencyGraphStats {
+		bool fullRebuild = true;
+		uint64_t dirtyPassCount = 0;
+		uint64_t dirtyResourceCount = 0;
+		uint64_t reusedResourceCount = 0;
+		uint64_t reusedEdgeCount = 0;
+		uint64_t rebuiltEdgeCount = 0;
+	};
+
 	struct FrameResourceEventSummary {
 		unsigned int latestBatch = 0;
 		unsigned int previousBatch = 0;
@@ -821,6 +1269,8 @@ private:
 	};
 
 	struct FrameCompileResourceState {
+		// Whole-resource state when every subresource agrees; lets AddTransition skip the tracker
+		// for any requirement (whole or partial range) already in that state.
 		struct FastStateShadow {
 			bool valid = false;
 			bool wholeResourceOnly = false;
@@ -847,6 +1297,21 @@ private:
 		ResourceState uniformState{};
 	};
 
+	// State the frame's first transition check asked for, the prediction for the next frame's.
+	struct FrameFirstUse {
+		bool recorded = false;
+		bool wholeResource = false;
+		RangeSpec range{};
+		ResourceState state{};
+	};
+
+	// Union of the read states a resource is required in between two writes, applied to each of
+	// those reads so the resource transitions once instead of flipping between read states.
+	struct FrameMergedReadState {
+		bool valid = false;
+		ResourceState state{};
+	};
+
 	enum class RegionRejectReason : uint8_t {
 		QueueSlotChange = 0,
 		PassCountBelowThreshold,
@@ -861,6 +1326,7 @@ private:
 		GraphicsFallbackTransition,
 		UnsupportedSubresourceState,
 		BatchHazardBoundary,
+		VolatilePass,
 		Count
 	};
 
@@ -1186,6 +1652,9 @@ private:
 		std::string firstOlderHit;
 	};
 
+	// Per-session by design: segment contracts and templates name resources by global resource ID
+	// and registry handle, and neither is stable across launches. In ReplayAuthoritative mode the
+	// first compiled frame extracts and stores its segments, so replay starts on the second frame.
 	struct RenderGraphRegionCache {
 		uint64_t structuralGeneration = 0;
 		uint64_t lastAuthoritativeCompileFingerprint = 0;
@@ -1196,6 +1665,48 @@ private:
 		RegionCacheStats stats;
 	};
 
+	enum class AdaptiveQueuePlacementDecision : uint8_t {
+		None,      // scheduler's own placement
+		Trial,     // pass moved to another queue kind for this measurement window
+		Committed, // earlier trial won and was kept
+	};
+
+	// Feedback controller for AutomaticQueueAssignment() passes that can run on either the
+	// graphics or the compute queue. It alternates a baseline window with a trial window in
+	// which one pass is moved to the other kind, and keeps the move only if the estimated GPU
+	// frame time improved by more than the hysteresis fraction.
+	struct AdaptiveQueuePlacementState {
+		std::unordered_map<uint64_t, QueueKind> committedKindByPass; // keyed by pass name hash
+		std::unordered_map<uint64_t, QueueKind> lastScheduledKindByPass;
+		std::vector<uint64_t> candidatePassKeys;
+		size_t nextCandidate = 0;
+		bool trialActive = false;
+		uint64_t trialPassKey = 0;
+		QueueKind trialKind = QueueKind::Graphics;
+		uint32_t framesInWindow = 0;
+		double windowCostSum = 0.0;
+		uint32_t windowSamples = 0;
+		double baselineCostMs = 0.0;
+		uint64_t trialsKept = 0;
+		uint64_t trialsReverted = 0;
+	};
+
+	struct AdaptiveQueueCountState {
+		std::array<uint8_t, static_cast<size_t>(QueueKind::Count)> limitByKind{};
+		bool trialActive = false;
+		bool trialIncreased = false;
+		QueueKind trialKind = QueueKind::Compute;
+		uint8_t limitBeforeTrial = 0;
+		size_t nextKind = 0;
+		bool nextTrialIncreases = false;
+		uint32_t framesInWindow = 0;
+		double windowCostSum = 0.0;
+		uint32_t windowSamples = 0;
+		double baselineCostMs = 0.0;
+		uint64_t lastFrameCrossQueueWaits = 0; // Written by Execute
+		AdaptiveQueueCountStats stats;
+	};
+
 	struct SchedulingDecisionTrace {
 		uint32_t nodeIndex = 0;
 		uint32_t passIndex = 0;
@@ -1206,6 +1717,7 @@ private:
 		uint32_t candidateChecks = 0;
 		uint32_t isNewBatchNeededChecks = 0;
 		bool fallbackCommit = false;
+		AdaptiveQueuePlacementDecision adaptivePlacement = AdaptiveQueuePlacementDecision::None;
 	};
 
 	struct TransitionPlacementCandidate {
@@ -1232,6 +1744,10 @@ private:
 		uint64_t aliasActivationCount = 0;
 		uint64_t oldInlineEarlyEligibleCount = 0;
 		uint64_t crossQueueCoordinationBlockedCount = 0;
+		uint64_t splitBarrierCount = 0;
+		uint64_t readStateMergeSavedCount = 0;
+		uint64_t crossFrameEndStateCount = 0;
+		uint64_t fullOverwriteDiscardCount = 0;
 	};
 
 	struct BatchBuildState {
@@ -1343,10 +1859,77 @@ private:
 
 		// Longest-path-to-sink (for tie-breaking)
 		uint32_t criticality = 0;
-	};
+		// Longest measured-GPU-time path from this node to a sink, as a fraction of the
+		// frame's longest such path. Zero unless measured critical-path scheduling is active.
+		float measuredCriticalPath = 0.0f;
+		// A present pass or one of its predecessors. Only set in present-latency mode.
+		bool presentCritical = false;
+		AdaptiveQueuePlacementDecision adaptivePlacement = AdaptiveQueuePlacementDecision::None;
+
+		// Back to defaults, keeping vector capacity for the next frame's BuildNodes.
+		void Reset() {
+			passIndex = 0;
+			queueSlot = 0;
+			preferredQueueKind = QueueKind::Graphics;
+			queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
+			compatibleQueueSlots.clear();
+			compatibleQueueKindMask = 0;
+			assignedQueueSlot.reset();
+			originalOrder = 0;
+			topoRank = 0;
+			touchedIDs.clear();
+			uavIDs.clear();
+			out.clear();
+			in.clear();
+			indegree = 0;
+			criticality = 0;
+			measuredCriticalPath = 0.0f;
+			presentCritical = false;
+			adaptivePlacement = AdaptiveQueuePlacementDecision::None;
+		}
+	};
+
+	// Structure-of-arrays copy of the Node fields AutoScheduleAndBuildBatches reads per candidate,
+	// with adjacency and compatible slots in CSR form, so its ready-set loops stay within a few
+	// contiguous arrays instead of striding over Node's vectors. Built once per scheduling run;
+	// assignedQueueSlot is kept in step with Node::assignedQueueSlot as passes commit.
+	struct SchedulerNodeTable {
+		std::vector<uint32_t> passIndex;
+		std::vector<uint16_t> assignedQueueSlot; // Node::queueSlot until the node commits
+		std::vector<uint8_t> compatibleQueueKindMask;
+		std::vector<uint8_t> presentCritical;
+		std::vector<uint8_t> automaticCompute; // Compute pass with automatic queue assignment
+		std::vector<uint32_t> indegree;
+		std::vector<uint32_t> criticality;
+		std::vector<float> measuredCriticalPath;
+		std::vector<uint32_t> originalOrder;
+		std::vector<uint32_t> inOffsets;
+		std::vector<uint32_t> inNodes;
+		std::vector<uint32_t> outOffsets;
+		std::vector<uint32_t> outNodes;
+		std::vector<uint32_t> compatibleSlotOffsets;
+		std::vector<uint16_t> compatibleSlots;
+
+		void Build(const std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes);
+		size_t Size() const noexcept { return passIndex.size(); }
+		std::span<const uint32_t> In(size_t node) const noexcept {
+			return { inNodes.data() + inOffsets[node], inOffsets[node + 1] - inOffsets[node] };
+		}
+		std::span<const uint32_t> Out(size_t node) const noexcept {
+			return { outNodes.data() + outOffsets[node], outOffsets[node + 1] - outOffsets[node] };
+		}
+		std::span<const uint16_t> CompatibleSlots(size_t node) const noexcept {
+			return { compatibleSlots.data() + compatibleSlotOffsets[node], compatibleSlotOffsets[node + 1] - compatibleSlotOffsets[node] };
+		}
+	};
+	SchedulerNodeTable m_schedulerNodeTable; // Reused across frames for its capacity
 
 	std::vector<IResourceProvider*> _providers;
 	ResourceRegistry _registry;
+	std::unique_ptr<ResourceDescriptorIndexTable> m_descriptorIndexTable;
+	std::unique_ptr<FrameConstantAllocator> m_frameConstantAllocator;
+	// This frame's WithTransientUpload allocations by pass, written by AllocateTransientUploads.
+	std::unordered_map<const void*, std::vector<FrameConstantAllocation>> m_transientUploadsByPass;
 	std::unordered_map<ResourceIdentifier, IResourceProvider*, ResourceIdentifier::Hasher> _providerMap;
 
 	std::vector<IPassBuilder*> m_passBuilderOrder;
@@ -1359,14 +1942,25 @@ private:
 	std::vector<AnyPassAndResources> m_framePasses;
 	std::vector<uint8_t> m_framePassIsFrameExtension;
 	std::vector<uint8_t> m_framePassDeclarationRefreshedThisFrame;
+	std::vector<uint8_t> m_framePassVolatile; // Adaptive region boundaries split regions around these passes
+	struct PassVolatility {
+		float score = 0.0f; // Running share of frames whose declaration changed
+		bool isVolatile = false;
+		uint64_t lastSeenFrame = 0;
+	};
+	std::unordered_map<std::string, PassVolatility> m_passVolatilityByName;
+	uint64_t m_passVolatilityFrameSerial = 0;
 	uint64_t m_frameDeclarationRefreshRequestedCount = 0;
 	uint64_t m_frameDeclarationRefreshEquivalentCount = 0;
+	std::unordered_map<std::string, StaticDeclarationStats> m_staticDeclarationStatsByPassName;
 	std::vector<size_t> m_assignedQueueSlotsByFramePass;
 	std::vector<uint8_t> m_activeQueueSlotsThisFrame;
 	std::array<uint8_t, static_cast<size_t>(QueueKind::Count)> m_minAutomaticSchedulingQueuesByKind = { 1, 1, 1 };
 	std::unordered_map<std::string, std::shared_ptr<RenderPass>> renderPassesByName;
 	std::unordered_map<std::string, std::shared_ptr<ComputePass>> computePassesByName;
 	std::unordered_map<std::string, std::string> m_passTechniquePathsByName;
+	std::unordered_map<std::string, PassId> m_passIdsByName;
+	uint32_t m_nextPassId = 0;
 	std::unordered_map<std::string, std::shared_ptr<Resource>> resourcesByName;
 	std::unordered_map<uint64_t, std::shared_ptr<Resource>> resourcesByID;
 	std::unordered_map<uint64_t, std::shared_ptr<Resource>> m_transientFrameResourcesByID;
@@ -1374,6 +1968,11 @@ private:
 	std::unordered_map<std::string, std::shared_ptr<Resource>> m_transientFrameResourcesByName;
 	std::unordered_map<uint64_t, uint64_t> resourceBackingGenerationByID;
 	std::unordered_map<uint64_t, uint32_t> resourceIdleFrameCounts;
+	// Residency policy state: the policy frame each resource was last used in, and the backing
+	// generation of each committed resource it evicted. A new backing starts out resident.
+	std::unordered_map<uint64_t, uint64_t> m_residencyLastUsedFrameByID;
+	std::unordered_map<uint64_t, uint64_t> m_evictedBackingGenerationByID;
+	uint64_t m_residencyFrameIndex = 0;
 	std::unordered_map<uint64_t, uint64_t> compiledResourceGenerationByID;
 	using ResourceMaterializeOptions = std::variant<PixelBuffer::MaterializeOptions, BufferBase::MaterializeOptions>;
 	std::unordered_map<uint64_t, ResourceMaterializeOptions> aliasMaterializeOptionsByID;
@@ -1399,19 +1998,35 @@ private:
 	std::vector<FramePassStaticAccessSummary> m_framePassAccessSummaries;
 	std::vector<FramePassSchedulingSummary> m_framePassSchedulingSummaries;
 	std::unordered_map<uint64_t, CachedFramePassAccessSummary> m_framePassAccessSummaryCache;
+	IncrementalDependencyGraphCache m_incrementalDependencyGraphCache;
+	IncrementalDependencyGraphStats m_lastIncrementalDependencyGraphStats;
+	FrameDependencyGraphCache m_frameDependencyGraphCache;
+	double m_frameMeasuredCriticalPathWeight = 0.0; // > 0 only when this frame has measured GPU timings to schedule by
+	size_t m_framePresentCriticalNodeCount = 0;     // Nonzero only in present-latency mode
+	AdaptiveQueuePlacementState m_adaptiveQueuePlacement;
+	AdaptiveQueueCountState m_adaptiveQueueCount;
 	std::unordered_map<uint64_t, rg::alias::CachedAliasStaticResourceInfo> m_aliasStaticInfoCacheByResourceID;
 	std::unordered_map<uint64_t, uint64_t> aliasPlacementPoolByID;
 	std::unordered_set<uint64_t> aliasActivationPending;
 
 	using PersistentAliasPoolState = rg::alias::PersistentAliasPoolState;
 	std::unordered_map<uint64_t, PersistentAliasPoolState> persistentAliasPools;
+	// Source of PersistentAliasPoolState::generation. Never reset, so a pool ID that is retired and
+	// reallocated can't repeat an earlier (poolID, generation) pair.
+	uint64_t aliasPoolGenerationSerial = 0;
+	std::shared_ptr<rg::alias::AliasPoolArbiter> m_aliasPoolArbiter;
 	std::unordered_map<uint64_t, rg::alias::CachedAliasPoolPlan> cachedAliasPlanByPoolID;
+	std::unordered_map<uint64_t, rg::alias::CachedAliasPoolPlan> persistedAliasPlanByShapeSignature;
+	std::filesystem::path m_aliasPlanCachePath;
 	uint64_t aliasPoolPlanFrameIndex = 0;
 	uint32_t aliasPoolRetireIdleFrames = 120;
 	float aliasPoolGrowthHeadroom = 1.5f;
 
 	std::unordered_map<uint64_t, ResourceTransition> initialTransitions; // Transitions needed to reach the initial state of the resources before executing the first batch. Executed on graph setup.
 	std::vector<PassBatch> batches;
+	// Last frame's batches and nodes, kept so per-frame compile reuses their allocations.
+	std::vector<PassBatch> m_recycledPassBatches;
+	std::vector<Node> m_frameNodes;
 	rg::memory::SnapshotProvider m_memorySnapshotProvider;
 	std::shared_ptr<rg::runtime::IStatisticsService> m_statisticsService;
 	std::shared_ptr<rg::runtime::IUploadService> m_uploadService;
@@ -1419,12 +2034,18 @@ private:
 	std::shared_ptr<rg::runtime::IDescriptorService> m_descriptorService;
 	std::shared_ptr<rg::runtime::IRenderGraphSettingsService> m_renderGraphSettingsService;
 	std::shared_ptr<rg::runtime::ITaskService> m_taskService;
+	std::shared_ptr<rg::runtime::IPipelineCompileService> m_pipelineCompileService;
+	std::shared_ptr<rg::runtime::IShaderCompileService> m_shaderCompileService;
 	struct CapturedTrackerResource {
 		uint64_t backingGeneration = 0;
 	};
 	std::unordered_map<uint64_t, CapturedTrackerResource> trackers; // Resources whose live state trackers receive compiled states after execution.
 	std::vector<FrameCompileResourceState> m_frameCompileResources; // Compile-only symbolic state, indexed by frame-local resource index.
+	std::vector<std::pair<size_t, ExternalTimelinePoint>> m_frameExternalReadyPoints; // Imported external textures with a ready point, by resource index
 	std::vector<FrameResourceAccessSummary> m_frameResourceAccessSummaries;
+	std::vector<std::vector<FrameMergedReadState>> m_frameMergedReadStatesByPass; // Parallel to each pass's requirements; empty when nothing merged
+	std::vector<FrameFirstUse> m_frameFirstUseByResourceIndex;
+	std::unordered_map<uint64_t, ResourceState> m_previousFrameFirstUseStateByResourceID;
 	RenderGraphRegionCache m_regionCache;
 	RegionCacheStats m_lastRegionStats;
 	std::vector<ScheduledRegion> m_lastExtractedRegions;
@@ -1439,6 +2060,19 @@ private:
 	uint64_t m_lastAuthoritativeReplayDynamicGapPasses = 0;
 	std::string m_lastAuthoritativeReplayFailure;
 	std::string m_lastAuthoritativeReplayRecomputeReason;
+	// Sampled segment validation for ValidateOnly and ShadowReplay (renderGraphRegionValidation*).
+	struct RegionValidationSampling {
+		uint64_t frameSerial = 0;
+		size_t segmentCursor = 0; // Next previous-frame segment a sampled frame validates
+		uint64_t fullValidations = 0;
+		uint64_t forcedFullValidations = 0; // Full validations run early for an invalidation
+		uint64_t sampledValidations = 0;
+		uint64_t skippedValidations = 0;
+	};
+	RegionValidationSampling m_regionValidationSampling;
+	CompileTimings m_lastCompileTimings;
+	CompileMetrics m_lastCompileMetrics; // timings is filled in by GetLastCompileMetrics
+	std::filesystem::path m_pendingDeclarationCapturePath;
 	std::unordered_map<uint64_t, LastProducerAcrossFrames> m_lastProducerByResourceAcrossFrames;
 	std::unordered_map<uint64_t, std::vector<LastAliasPlacementProducerAcrossFrames>> m_lastAliasPlacementProducersByPoolAcrossFrames;
 	std::vector<std::unordered_map<uint64_t, unsigned int>> m_compiledLastProducerBatchByResourceByQueue;
@@ -1448,6 +2082,29 @@ private:
 
 	QueueRegistry m_queueRegistry;
 	std::optional<PresentDependency> m_lastPresentDependency;
+	std::deque<PresentDependency> m_inFlightPresentDependencies; // Present-latency mode, oldest first
+	bool m_presentLatencyWaitedThisFrame = false;
+	PresentLatencyStats m_lastPresentLatencyStats;
+	std::unordered_set<uint64_t> m_cullingRootResourceIDs;
+	std::vector<std::string> m_lastCulledPassNames;
+
+	struct BackgroundMaterializationRequest {
+		std::weak_ptr<Resource> resource;
+		PendingMaterializationPolicy policy = PendingMaterializationPolicy::SkipDependentPasses;
+	};
+	std::unordered_map<uint64_t, BackgroundMaterializationRequest> m_backgroundMaterializationRequests; // By requested resource ID
+	std::vector<std::string> m_lastPendingMaterializationSkippedPassNames;
+	std::vector<std::string> m_lastFeatureDomainSkippedPassNames;
+	std::vector<std::string> m_lastPipelinePendingSkippedPassNames;
+	std::unordered_set<std::string> m_pipelineFailureWarnedPassNames;
+	// Worker state; jobs are keyed by the backed (unwrapped) resource ID.
+	std::mutex m_backgroundMaterializationMutex;
+	std::condition_variable m_backgroundMaterializationCv;
+	std::deque<std::pair<uint64_t, std::shared_ptr<Resource>>> m_backgroundMaterializationQueue;
+	std::unordered_set<uint64_t> m_backgroundMaterializationInFlight; // Queued or running
+	std::unordered_set<uint64_t> m_backgroundMaterializationFailed;
+	bool m_backgroundMaterializationQuit = false;
+	std::thread m_backgroundMaterializationThread;
 
 	rhi::CommandAllocatorPtr initialTransitionCommandAllocator;
 	rhi::TimelinePtr m_initialTransitionFence;
@@ -1461,13 +2118,39 @@ private:
 	std::unique_ptr<CommandRecordingManager> m_pCommandRecordingManager;
 	ExecutionSchedule m_executionSchedule;
 	std::unordered_map<uint64_t, uint64_t> m_lastExternalSignalValueByTimeline;
+	std::vector<std::unordered_map<uint64_t, uint64_t>> m_externalWaitedValueByTimelineByQueue; // Per queue slot
+	ExternalWaitStats m_lastExternalWaitStats;
+	SubmitStats m_lastSubmitStats;
 
 	void BuildExecutionSchedule();
 	void AssignQueueSignalFenceValuesInSubmissionOrder(std::vector<PassBatch>& batchesToAssign);
 	void ResizeQueueParallelVectors();
 	void EnsureMinimumAutomaticSchedulingQueues();
+	void OpenPeerFences(QueueSlotIndex slot);
 	static bool RetainedDeclarationMayNeedRefresh(const AnyPassAndResources& pass);
 	void RebuildRetainedDeclarationRefreshCandidates();
+	void MergeStructuralPasses(std::vector<AnyPassAndResources> base, std::span<const size_t> extensionIndices);
+	void SetupMasterPass(AnyPassAndResources& pass);
+	static IResourceProvider* StructuralPassProvider(const AnyPassAndResources& pass) noexcept;
+	void ReleaseStructuralPassProvider(IResourceProvider* provider, std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher>& releasedKeys);
+	size_t DropReplaySegmentsContainingPasses(const std::unordered_set<uint64_t>& passNameHashes);
+
+	struct StructuralEditState {
+		bool active = false;
+		std::string insertBefore;
+		size_t builderOrderSizeAtBegin = 0;
+		size_t extensionCountAtBegin = 0;
+		std::unordered_set<std::string> replacedPassNames;
+		std::unordered_set<std::string> reloadedPassNames;
+		std::unordered_set<std::string> removedPassNames;
+		std::unordered_set<std::string> reloadedExtensionIds;
+		std::unordered_set<std::string> removedExtensionIds;
+	};
+	StructuralEditState m_structuralEdit;
+	StructuralEditStats m_lastStructuralEditStats;
+	// Pass objects each extension contributed to the last structural merge, so an edit can pull
+	// one extension's passes out of m_masterPassList.
+	std::unordered_map<std::string, std::vector<IResourceProvider*>> m_structuralPassProvidersByExtensionId;
 
 	rg::imm::ImmediateDispatch m_immediateDispatch{};
 
@@ -1486,10 +2169,16 @@ private:
 	void TrackTransientFrameResource(Resource* resource);
 	void ShutdownOwnedState();
 
-	/// Dispatches to the injected ITaskService when available, otherwise runs a serial loop.
-	void ParallelForOptional(std::string_view taskName, size_t itemCount, std::function<void(size_t)> func, bool override = false) {
-		if (m_taskService && !override) {
-			m_taskService->ParallelFor(taskName, itemCount, std::move(func));
+	/// Dispatches to the task service (serial by default, the built-in work-stealing pool when
+	/// parallelTaskServiceEnabled is set) in chunked ranges, otherwise runs a serial loop. func is called in place, never copied.
+	template<class F>
+	void ParallelForOptional(std::string_view taskName, size_t itemCount, F&& func, bool override = false) {
+		if (m_taskService && !override && itemCount > 1) {
+			m_taskService->ParallelForChunked(taskName, itemCount, {}, [&func](size_t begin, size_t end) {
+				for (size_t i = begin; i < end; ++i) {
+					func(i);
+				}
+			});
 		} else {
 			for (size_t i = 0; i < itemCount; ++i) {
 				func(i);
@@ -1497,9 +2186,13 @@ private:
 		}
 	}
 
-	void MaterializeUnmaterializedResources(const std::unordered_set<uint64_t>* onlyResourceIDs = nullptr);
+	void AllocateTransientUploads(const UpdateExecutionContext& context);
+
+	void MaterializeUnmaterializedResources(const std::vector<uint64_t>* onlyResourceIDs = nullptr);
+	void EnsureDeclaredSubresourceViews();
 	FrameCompileResourceState& GetOrCreateFrameCompileResourceState(size_t resourceIndex, Resource* resource, uint64_t resourceID);
-	void CaptureCompileTrackersForExecution(const std::unordered_set<uint64_t>& resourceIDs);
+	void PredictCrossFrameEndStates();
+	void CaptureCompileTrackersForExecution(std::span<const uint64_t> resourceIDs);
 	void PublishCompiledTrackerStates();
 	void MaterializeReferencedResources(
 		const std::vector<ResourceRequirement>& resourceRequirements,
@@ -1508,22 +2201,26 @@ private:
 	std::vector<std::shared_ptr<Resource>> CaptureRetainedAnonymousKeepAlive(
 		const std::vector<ResourceRequirement>& resourceRequirements,
 		const std::vector<std::pair<ResourceHandleAndRange, ResourceState>>& internalTransitions) const;
-	void CollectFrameResourceIDs(std::unordered_set<uint64_t>& out) const;
-	void ApplyIdleDematerializationPolicy(const std::unordered_set<uint64_t>& usedResourceIDs);
-	void SnapshotCompiledResourceGenerations(const std::unordered_set<uint64_t>& usedResourceIDs);
+	void CollectFrameResourceIDs(std::vector<uint64_t>& out) const;
+	void ApplyIdleDematerializationPolicy(std::span<const uint64_t> usedResourceIDs);
+	bool IsUnderResidencyBudgetPressure() const;
+	void ApplyResidencyPolicy(std::span<const uint64_t> usedResourceIDs);
+	void SnapshotCompiledResourceGenerations(std::span<const uint64_t> usedResourceIDs);
 	void ValidateCompiledResourceGenerations() const;
-	void RebuildSchedulingEquivalentIDCache(const std::unordered_set<uint64_t>& resourceIDs);
-	void RebuildFrameSchedulingResourceIndex(const std::unordered_set<uint64_t>& resourceIDs);
+	void RebuildSchedulingEquivalentIDCache(std::span<const uint64_t> resourceIDs);
+	void RebuildFrameSchedulingResourceIndex(std::span<const uint64_t> resourceIDs);
 	void RebuildEquivalentResourceIndicesByResourceIndex();
 	void RebuildFrameCompileResources();
 	void RebuildFramePassSchedulingSummaries();
 	void RebuildFrameResourceAccessSummaries(const std::vector<Node>& nodes);
+	void RebuildFrameMergedReadStates();
 	void ResetCompileFrameState();
 	void ResetStructuralBuildState();
 	void ClearFrameSchedulingResourceIndex();
 	void ClearFramePassSchedulingSummaries();
 	void ResetFrameQueueBatchHistoryTables();
 	std::optional<size_t> TryGetFrameSchedulingResourceIndex(uint64_t resourceID) const;
+	const ExternalTimelinePoint* FindFrameExternalReadyPoint(size_t resourceIndex) const;
 	const rg::alias::AliasPlacementRange* TryGetAliasPlacementRangeByResourceIndex(size_t resourceIndex) const;
 	const rg::alias::AliasPlacementRange* TryGetAliasPlacementRange(uint64_t resourceID) const;
 	const rg::alias::AliasPlacementRange* TryGetSchedulingPlacementRangeByResourceIndex(size_t resourceIndex) const;
@@ -1547,7 +2244,12 @@ private:
 	void CompileFrame(rhi::Device device, uint8_t frameIndex, const IHostExecutionData* hostData);
 	void WriteCompiledGraphDebugDump(uint8_t frameIndex, const std::vector<Node>& nodes) const;
 	void WriteVramUsageDebugDump(uint8_t frameIndex) const;
+	rg::capture::FrameDeclarationCapture BuildFrameDeclarationCapture(const std::vector<std::pair<std::string, std::string>>& explicitAfterByName) const;
 	void CoalesceQueueWaitsAndSignals(std::vector<PassBatch>& batchesToCoalesce) const;
+	// Transitive reduction over the batch/queue timeline: drops cross-queue waits already implied
+	// by earlier waits through other queues. Returns the number of waits removed.
+	size_t ReduceTransitiveQueueWaits(std::vector<PassBatch>& batchesToReduce) const;
+	void UpdatePassVolatility();
 	void ExtractScheduleRegionsFromAuthoritativeCompile(
 		const std::vector<Node>& nodes,
 		const std::vector<AnyPassAndResources>& framePasses,
@@ -1631,22 +2333,23 @@ private:
 
 	std::tuple<int, int, int> GetBatchesToWaitOn(const ComputePassAndResources& pass,
 		size_t sourceQueueSlot,
-		std::unordered_set<uint64_t> const& resourcesTransitionedThisPass);
+		DenseResourceIndexSet const& resourcesTransitionedThisPass);
 	std::tuple<int, int, int> GetBatchesToWaitOn(const RenderPassAndResources& pass,
 		size_t sourceQueueSlot,
-		std::unordered_set<uint64_t> const& resourcesTransitionedThisPass);
+		DenseResourceIndexSet const& resourcesTransitionedThisPass);
 	std::tuple<int, int, int> GetBatchesToWaitOn(const CopyPassAndResources& pass,
 		size_t sourceQueueSlot,
-		std::unordered_set<uint64_t> const& resourcesTransitionedThisPass);
+		DenseResourceIndexSet const& resourcesTransitionedThisPass);
 
 	void ProcessResourceRequirements(
+		size_t passIndex,
 		size_t passQueueSlot,
 		const std::vector<DenseRequirementSummary>& resourceRequirements,
 		std::string_view passName,
 		unsigned int batchIndex,
 		PassBatch& currentBatch,
-		std::unordered_set<uint64_t>& outTransitionedResourceIDs,
-		std::unordered_set<size_t>& outFallbackResourceIndices,
+		DenseResourceIndexSet& outTransitionedResourceIndices,
+		DenseResourceIndexSet& outFallbackResourceIndices,
 		std::vector<ResourceTransition>& scratchTransitions);
 
 	template<typename PassRes>
@@ -1656,7 +2359,7 @@ private:
 		PassBatch&                        currentBatch,
 		unsigned int                      currentBatchIndex,
 		const PassRes&                    pass, // either ComputePassAndResources or RenderPassAndResources
-		const std::unordered_set<uint64_t> resourcesTransitionedThisPass)
+		const DenseResourceIndexSet& resourcesTransitionedThisPass)
 	{
 		ZoneScopedN("RenderGraph::applySynchronization");
 		if (!pass.name.empty()) {
@@ -1755,8 +2458,8 @@ private:
 		size_t passQueueSlot,
 		std::string_view passName,
 		const DenseRequirementSummary& requirement,
-		std::unordered_set<uint64_t>& outTransitionedResourceIDs,
-		std::unordered_set<size_t>& outFallbackResourceIndices,
+		DenseResourceIndexSet& outTransitionedResourceIndices,
+		DenseResourceIndexSet& outFallbackResourceIndices,
 		std::vector<ResourceTransition>& scratchTransitions);
 	bool TryAddTransitionFastNoOp(
 		unsigned int batchIndex,
@@ -1771,8 +2474,8 @@ private:
 		std::string_view passName,
 		const DenseRequirementSummary& requirement,
 		ResourceState requiredState,
-		std::unordered_set<uint64_t>& outTransitionedResourceIDs,
-		std::unordered_set<size_t>& outFallbackResourceIndices,
+		DenseResourceIndexSet& outTransitionedResourceIndices,
+		DenseResourceIndexSet& outFallbackResourceIndices,
 		std::vector<ResourceTransition>& scratchTransitions);
 
 	struct AddTransitionDebugStats {
@@ -1808,11 +2511,49 @@ private:
 	using CachedAliasPoolPlan = rg::alias::CachedAliasPoolPlan;
 
 	static PassView GetPassView(const AnyPassAndResources& pr);
-	void RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>& outUsedResourceIDs);
+	void RebuildFramePassAccessSummaries();
+	size_t CullUnreachableFramePasses(std::vector<std::pair<std::string, std::string>>& explicitAfterByName);
+	size_t RemoveFramePasses(const std::vector<uint8_t>& keep, std::vector<std::pair<std::string, std::string>>& explicitAfterByName, std::vector<std::string>& outRemovedNames);
+	size_t SkipPassesOnPendingMaterializations(std::vector<std::pair<std::string, std::string>>& explicitAfterByName);
+	size_t SkipPassesInDisabledFeatureDomains(std::vector<std::pair<std::string, std::string>>& explicitAfterByName);
+	size_t SkipPassesWithPendingPipelines(std::vector<std::pair<std::string, std::string>>& explicitAfterByName);
+	bool IsBackgroundMaterializationInFlight(uint64_t backedResourceID);
+	void BackgroundMaterializationWorkerMain();
+	void StopBackgroundMaterializationWorker();
 	bool BuildDependencyGraph(std::vector<Node>& nodes);
 	bool BuildDependencyGraph(std::vector<Node>& nodes, std::span<const std::pair<size_t, size_t>> explicitEdges);
+	bool BuildDependencyGraphIncremental(std::vector<Node>& nodes, std::span<const std::pair<size_t, size_t>> explicitEdges);
+	bool BuildDependencyGraphParallel(std::vector<Node>& nodes, std::span<const std::pair<size_t, size_t>> explicitEdges);
+	uint64_t ComputeFrameStructureFingerprint(const std::vector<Node>& nodes, std::span<const std::pair<size_t, size_t>> explicitEdges) const;
+	bool TryReuseFrameDependencyGraph(std::vector<Node>& nodes, uint64_t fingerprint) const;
+	void StoreFrameDependencyGraph(const std::vector<Node>& nodes, uint64_t fingerprint);
+	void GatherResourceAccessSequences(
+		const std::vector<Node>& nodes,
+		const std::vector<uint8_t>* resourceFilter,
+		std::vector<uint32_t>& outOffsetsByResource,
+		std::vector<DependencyEdgeRecord>& outAccesses) const;
+	static void AppendResourceDependencyEdges(
+		std::span<const DependencyEdgeRecord> accesses,
+		std::vector<uint32_t>& readsSinceWrite,
+		std::vector<DependencyEdgeRecord>& outEdges);
+	static void MergeDependencyEdges(
+		std::vector<Node>& nodes,
+		std::vector<DependencyEdgeRecord>& edges,
+		std::span<const std::pair<size_t, size_t>> explicitEdges);
 	static bool FinalizeDependencyGraph(std::vector<Node>& nodes);
-	static std::vector<Node> BuildNodes(RenderGraph& rg);
+	void ComputeMeasuredCriticalPath(std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes);
+	void ComputePresentCriticalPasses(std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes);
+	double CriticalPathSchedulingScore(const Node& node, size_t queueSlot) const;
+	double CriticalPathSchedulingScore(bool presentCritical, uint32_t criticality, float measuredCriticalPath, size_t queueSlot) const;
+	static void BuildNodes(RenderGraph& rg, std::vector<Node>& nodes);
+	PassBatch AcquirePassBatch(size_t queueCount);
+	void RecyclePassBatches();
+	void ApplyAdaptiveQueuePlacement(std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes);
+	void RecordAdaptiveQueuePlacement(const std::vector<AnyPassAndResources>& passes);
+	void ApplyAdaptiveQueueCount();
+	// Groups adjacent render passes in each batch queue that share attachments so they can
+	// continue one native render pass. Returns the number of passes that continue a group.
+	size_t BuildRenderPassMergeGroups();
 	static std::vector<uint8_t> PlanActiveQueueSlots(RenderGraph& rg, const std::vector<AnyPassAndResources>& passes, const std::vector<Node>& nodes);
 	static bool AddEdgeDedup(
 		size_t from, size_t to,
@@ -1826,8 +2567,8 @@ private:
 
 		unsigned int currentBatchIndex,
 		PassBatch& currentBatch,
-		std::unordered_set<uint64_t>& scratchTransitioned,
-		std::unordered_set<size_t>& scratchFallback,
+		DenseResourceIndexSet& scratchTransitioned,
+		DenseResourceIndexSet& scratchFallback,
 		std::vector<ResourceTransition>& scratchTransitions);
 	void AutoScheduleAndBuildBatches(
 		RenderGraph& rg,
@@ -1850,6 +2591,7 @@ private:
 	std::function<bool()> m_getRenderGraphBatchTraceEnabled;
 	std::function<bool()> m_getRenderGraphLightweightCompileSummaryEnabled;
 	std::function<bool()> m_getReadOnlyUniformTransitionElisionEnabled;
+	std::function<bool()> m_getReadStateMergingEnabled;
 	std::function<bool()> m_getAutoAliasEnableLogging;
 	std::function<bool()> m_getAutoAliasLogExclusionReasons;
 	std::function<bool()> m_getAutoAliasBuildDebugData;
@@ -1868,6 +2610,42 @@ private:
 	std::function<uint32_t()> m_getRenderGraphRegionMaxPassCount;
 	std::function<bool()> m_getRenderGraphRegionDiagnosticsEnabled;
 	std::function<bool()> m_getRenderGraphRegionShadowStrictBatchMatch;
+	std::function<uint32_t()> m_getRenderGraphRegionValidationIntervalFrames;
+	std::function<uint32_t()> m_getRenderGraphRegionValidationSegmentsPerFrame;
+	std::function<bool()> m_getRenderGraphRegionAdaptiveBoundariesEnabled;
+	std::function<uint32_t()> m_getRenderGraphRegionVolatilityWindowFrames;
+	std::function<float()> m_getRenderGraphRegionVolatilityThreshold;
+	std::function<bool()> m_getRenderGraphIncrementalDependencyGraphEnabled;
+	std::function<bool()> m_getRenderGraphParallelDependencyGraphEnabled;
+	std::function<bool()> m_getQueueSchedulingMeasuredCriticalPathEnabled;
+	std::function<float()> m_getQueueSchedulingCriticalPathWeight;
+	std::function<bool()> m_getQueueSchedulingAdaptivePlacementEnabled;
+	std::function<uint32_t()> m_getQueueSchedulingAdaptivePlacementWindowFrames;
+	std::function<float()> m_getQueueSchedulingAdaptivePlacementHysteresis;
+	std::function<bool()> m_getQueueSchedulingAdaptiveQueueCountEnabled;
+	std::function<uint32_t()> m_getQueueSchedulingAdaptiveQueueCountMaxQueues;
+	std::function<float()> m_getQueueSchedulingAdaptiveQueueCountWaitCostUs;
+	std::function<bool()> m_getRenderGraphSplitBarriersEnabled;
+	std::function<uint32_t()> m_getRenderGraphGlobalBufferBarrierThreshold;
+	std::function<bool()> m_getRenderGraphDeadPassCullingEnabled;
+	std::function<bool()> m_getRenderGraphRenderPassMergingEnabled;
+	std::function<bool()> m_getRenderGraphStreamingSubmissionEnabled;
+	std::function<bool()> m_getRenderGraphTransitiveWaitReductionEnabled;
+	std::function<bool()> m_getRenderGraphCrossFrameOverlapEnabled;
+	std::function<bool()> m_getRenderGraphCrossFrameEndStatePredictionEnabled;
+	std::function<bool()> m_getRenderGraphPresentLatencyModeEnabled;
+	std::function<uint32_t()> m_getRenderGraphPresentLatencyMaxQueuedFrames;
+	std::function<bool()> m_getAutoAliasPoolBudgetAwareEnabled;
+	std::function<float()> m_getAutoAliasPoolBudgetPressureThreshold;
+	std::function<bool()> m_getAutoAliasSubresourceLifetimesEnabled;
+	std::function<bool()> m_getDeferShaderVisibleDescriptorWrites;
+	std::function<bool()> m_getImmediateBytecodeOptimizationEnabled;
+	std::function<uint32_t()> m_getImmediateParallelReplayMinOps;
+	std::function<uint32_t()> m_getImmediateParallelReplayMaxCommandLists;
+	std::function<bool()> m_getResidencyEvictionEnabled;
+	std::function<uint32_t()> m_getResidencyEvictionIdleFrames;
+	std::function<float()> m_getResidencyBudgetPressureThreshold;
+	std::function<bool()> m_getBackgroundMaterializationEnabled;
 	std::unordered_map<uint64_t, AddTransitionDebugStats> m_addTransitionDebugStatsByResource;
 	std::function<uint32_t()> m_getAutoAliasPoolRetireIdleFrames;
 	std::function<float()> m_getAutoAliasPoolGrowthHeadroom;
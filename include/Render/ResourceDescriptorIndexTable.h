@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "Render/ResourceRegistry.h"
+#include "RenderPasses/Base/DescriptorAccessor.h"
+
+class Buffer;
+
+// Persistent GPU table of shader-visible descriptor indices, indexed by a slot that stays fixed
+// for as long as the (registry handle, view) pair it was acquired for stays valid. Passes push
+// slots instead of resolved indices (see BindResourceDescriptorTableSlots) and shaders read
+// StructuredBuffer<uint>(table)[slot], so a pass only packs its bindings again when its
+// declarations are refreshed.
+//
+// Update runs once per frame before any pass records. It compares each slot's backing resource
+// and GetDescriptorSlotVersion with what was last written and rewrites only the slots that
+// moved. The table is one CPU-visible buffer per frame in flight, written in place, so there is
+// no upload pass dependency and no state transition; each copy is brought up to date with the
+// changes made since it was last written. Slots whose handle no longer resolves are released.
+//
+// Registry-backed handles only: ephemeral handles carry a raw pointer that may not outlive the
+// frame, so AcquireSlot returns kInvalidSlot for them and callers keep the root constant path.
+class ResourceDescriptorIndexTable {
+public:
+	static constexpr uint32_t kInvalidSlot = UINT32_MAX;
+	static constexpr uint32_t kInvalidDescriptorIndex = UINT32_MAX;
+
+	struct Stats {
+		uint64_t liveSlots = 0;
+		uint64_t capacity = 0;
+		uint64_t slotsChangedLastUpdate = 0;
+		uint64_t slotsReleasedLastUpdate = 0;
+		uint64_t bytesWrittenLastUpdate = 0;
+		uint64_t growCount = 0;
+	};
+
+	explicit ResourceDescriptorIndexTable(ResourceRegistry& registry);
+	~ResourceDescriptorIndexTable();
+
+	ResourceDescriptorIndexTable(const ResourceDescriptorIndexTable&) = delete;
+	ResourceDescriptorIndexTable& operator=(const ResourceDescriptorIndexTable&) = delete;
+
+	// Same handle and accessor return the same slot. The slot's index is resolved immediately, so
+	// it is correct in the frame it was acquired in.
+	uint32_t AcquireSlot(const ResourceRegistry::RegistryHandle& handle, const DescriptorAccessor& accessor);
+
+	void Update(uint8_t frameIndex);
+
+	// Shader-visible SRV index of the table copy written by the last Update; kInvalidDescriptorIndex
+	// until a slot exists.
+	uint32_t GetTableDescriptorIndex() const;
+	const Stats& GetStats() const noexcept { return m_stats; }
+
+private:
+	struct SlotKey {
+		uint32_t registryKey = 0;
+		uint32_t generation = 0;
+		DescriptorAccessor accessor{};
+
+		bool operator==(const SlotKey& other) const noexcept {
+			return registryKey == other.registryKey && generation == other.generation && accessor == other.accessor;
+		}
+	};
+	struct SlotKeyHasher {
+		size_t operator()(const SlotKey& key) const noexcept;
+	};
+
+	struct SlotEntry {
+		ResourceRegistry::RegistryHandle handle{};
+		DescriptorAccessor accessor{};
+		const Resource* resource = nullptr;             // Resolved registry pointer when last written
+		const GloballyIndexedResource* backing = nullptr; // Unwrapped from dynamic resources
+		uint64_t descriptorSlotVersion = 0;
+		bool isDynamic = false;
+		bool live = false;
+	};
+
+	struct FrameCopy {
+		std::shared_ptr<Buffer> buffer;
+		uint32_t capacity = 0;
+		uint64_t syncedSerial = 0; // m_changeSerial this copy was last brought up to
+	};
+
+	bool Refresh(SlotEntry& entry, uint32_t slot);
+	void WriteIndex(uint32_t slot, uint32_t index);
+	void SyncFrameCopy(FrameCopy& copy);
+
+	ResourceRegistry& m_registry;
+	std::mutex m_mutex;
+	std::unordered_map<SlotKey, uint32_t, SlotKeyHasher> m_slotByKey;
+	std::vector<SlotEntry> m_entries;
+	std::vector<uint32_t> m_indices; // CPU mirror of the table contents
+	std::vector<uint32_t> m_freeSlots;
+	// Slots changed per update, oldest first; kept until every frame copy has applied them.
+	std::deque<std::pair<uint64_t, std::vector<uint32_t>>> m_changeLog;
+	std::vector<uint32_t> m_pendingChanges;
+	uint64_t m_changeSerial = 0;
+	std::vector<FrameCopy> m_frameCopies;
+	size_t m_currentCopy = 0;
+	Stats m_stats{};
+};
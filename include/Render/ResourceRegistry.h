@@ -1,10 +1,13 @@
 #pragma once
 #include "Resources/ResourceIdentifier.h"
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <functional>
 #include <memory>
 #include <map>
 #include <optional>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -19,6 +22,7 @@
 #include "Interfaces/IResourceResolver.h"
 
 class Resource;
+class ResourceDescriptorIndexTable;
 
 template <class T>
 class SharedOrWeakPtr
@@ -72,6 +76,8 @@ public:
         return std::get<Weak>(m_ptr).lock();
     }
 
+    bool IsShared() const noexcept { return std::holds_alternative<Shared>(m_ptr); }
+
 private:
     Variant m_ptr;
 };
@@ -80,27 +86,64 @@ private:
 using OnResourceChangedFn = std::function<void(ResourceIdentifier, std::shared_ptr<Resource>)>;
 
 // TODO: Actually use Epoch?
+//
+// Handle resolution (Resolve, IsValid, IsAnonymous, DescribeHandle) is wait-free and safe from any
+// thread while other threads register: slots live in fixed-size chunks that never move, and each
+// slot publishes an immutable binding (resource, identifier, generation) through one atomic
+// pointer. A registration swaps in a new binding and retires the old one; retired bindings are
+// freed two CollectRetiredBindings calls later, so a reader that loaded one just before the swap
+// has at least a full frame to finish with it. Registration, resolver registration and slot
+// reclamation take the registry lock exclusively; lookups by identifier or Resource* share it.
 class ResourceRegistry {
 
     struct ResourceKey {
         uint32_t idx = 0;
     };
 
-    struct Slot {
+    struct SlotBinding {
         SharedOrWeakPtr<Resource> resource;
         Resource* rawPointer = nullptr;
-        uint32_t generation = 1;
         ResourceIdentifier id; // for debug / access checks / reverse mapping
-        bool alive = false;
+        uint32_t generation = 0;
+    };
+
+    struct Slot {
+        std::atomic<const SlotBinding*> binding{ nullptr }; // Null while the slot is not alive
+        uint32_t generation = 1; // Writer side; stamped into the next binding
     };
 
-    std::vector<Slot> slots;
+    static constexpr uint32_t kSlotChunkShift = 8;
+    static constexpr uint32_t kSlotChunkSize = 1u << kSlotChunkShift;
+    static constexpr uint32_t kMaxSlotChunks = 4096;
+
+    std::array<std::atomic<Slot*>, kMaxSlotChunks> m_slotChunks{};
+    std::atomic<uint32_t> m_slotCount{ 0 };
     std::vector<uint32_t> freeList;
+    std::vector<const SlotBinding*> m_retiredBindings;  // Retired since the last collect
+    std::vector<const SlotBinding*> m_retiringBindings; // Freed by the next collect
+    mutable std::shared_mutex m_mutex;
 
     // Interning map: ResourceIdentifier -> ResourceKey
     std::unordered_map<ResourceIdentifier, ResourceKey, ResourceIdentifier::Hasher> intern;
 
 public:
+    ResourceRegistry() = default;
+    ResourceRegistry(const ResourceRegistry&) = delete;
+    ResourceRegistry& operator=(const ResourceRegistry&) = delete;
+
+    ~ResourceRegistry() { ReleaseAllLocked(); }
+
+    // Drops every registration. Unlike registration this is not safe against concurrent readers;
+    // it is for rebuild and shutdown, when nothing is recording.
+    void Clear() {
+        std::unique_lock lock(m_mutex);
+        ReleaseAllLocked();
+        freeList.clear();
+        intern.clear();
+        resourceToHandle.clear();
+        m_resolvers.clear();
+        m_epoch = 0;
+    }
 
     class RegistryHandle {
     public:
@@ -159,10 +202,12 @@ public:
     };
 
     void RegisterResolver(ResourceIdentifier const& id, std::shared_ptr<IResourceResolver> resolver) {
+        std::unique_lock lock(m_mutex);
         m_resolvers[id] = std::move(resolver);
     }
 
     std::shared_ptr<IResourceResolver> GetResolver(ResourceIdentifier const& id) const {
+        std::shared_lock lock(m_mutex);
         if (auto it = m_resolvers.find(id); it != m_resolvers.end()) {
             return it->second;
         }
@@ -170,21 +215,13 @@ public:
     }
 
     bool HasResolver(ResourceIdentifier const& id) const {
+        std::shared_lock lock(m_mutex);
         return m_resolvers.contains(id);
     }
 
     ResourceKey InternKey(ResourceIdentifier const& id) {
-        if (auto it = intern.find(id); it != intern.end()) return it->second;
-
-        uint32_t idx;
-        if (!freeList.empty()) { idx = freeList.back(); freeList.pop_back(); }
-        else { idx = (uint32_t)slots.size(); slots.emplace_back(); }
-
-        slots[idx].id = id;
-        slots[idx].alive = true;
-        ResourceKey key{ idx };
-        intern.emplace(id, key);
-        return key;
+        std::unique_lock lock(m_mutex);
+        return InternKeyLocked(id);
     }
 
     RegistryHandle MakeEphemeralHandle(Resource* res) const {
@@ -212,21 +249,20 @@ public:
     }
 
     RegistryHandle RegisterOrUpdate(ResourceIdentifier const& id, std::shared_ptr<Resource> res) {
-        ResourceKey key = InternKey(id);
-        Slot& s = slots[key.idx];
+        std::unique_lock lock(m_mutex);
+        ResourceKey key = InternKeyLocked(id);
+        Slot& s = SlotAt(key.idx);
+        const SlotBinding* current = s.binding.load(std::memory_order_relaxed);
 
-        const bool isSameResource = s.alive && s.rawPointer == res.get();
+        const bool isSameResource = current && current->rawPointer == res.get();
 
         // If this slot previously pointed at a different resource pointer,
         // remove its reverse-map entry so stale pointer->handle lookups
         // do not survive replacement.
-        if (s.rawPointer && !isSameResource) {
-            resourceToHandle.erase(s.rawPointer);
+        if (current && current->rawPointer && !isSameResource) {
+            resourceToHandle.erase(current->rawPointer);
         }
 
-        s.resource = res;
-        s.rawPointer = res.get();
-
         // Preserve handle stability when the same resource object is re-registered.
         // Dynamic declaration refreshes routinely re-register stable resources during
         // CompileFrame, and bumping generation in that case invalidates cached handles
@@ -235,8 +271,10 @@ public:
             s.generation++; // bump on first registration or true replacement
         }
 
-        s.alive = true;
-        s.id = id;
+        // An unchanged re-registration keeps its binding, so the refresh allocates nothing.
+        if (!isSameResource || current->id != id || !current->resource.IsShared()) {
+            PublishLocked(s, new SlotBinding{ SharedOrWeakPtr<Resource>(res), res.get(), id, s.generation });
+        }
 
         RegistryHandle h(key,
             s.generation,
@@ -245,7 +283,7 @@ public:
             res->GetMipLevels(), 
             res->GetArraySize());
 
-        resourceToHandle[s.rawPointer] = h;
+        resourceToHandle[res.get()] = h;
 
         return h;
     }
@@ -260,26 +298,21 @@ public:
 
     std::optional<RegistryHandle> GetHandleFor(Resource* res) const {
 		if (res == nullptr) return std::nullopt;
-        if (auto it = resourceToHandle.find(res); it != resourceToHandle.end()) {
-            return it->second;
-		}
-		return std::nullopt;
+        std::shared_lock lock(m_mutex);
+        return GetHandleForLocked(res);
     }
 
     bool IsAnonymous(const RegistryHandle& h) const noexcept {
         if (h.IsEphemeral()) {
             return false;
         }
-        if (h.GetKey().idx >= slots.size()) {
-            return false;
-        }
 
-        const Slot& s = slots[h.GetKey().idx];
-        if (!s.alive) {
+        const SlotBinding* binding = LoadBinding(h.GetKey().idx);
+        if (!binding) {
             return false;
         }
 
-        return s.id.segments.empty();
+        return binding->id.IsEmpty();
     }
 
     bool IsAnonymous(Resource* res) const noexcept {
@@ -288,60 +321,74 @@ public:
     }
 
     std::optional<RegistryHandle> GetHandleFor(ResourceIdentifier const& id) const {
+        std::shared_lock lock(m_mutex);
         auto it = intern.find(id);
         if (it == intern.end()) {
             return std::nullopt;
         }
-        const ResourceKey key = it->second;
-        if (key.idx >= slots.size()) {
+        const SlotBinding* binding = LoadBinding(it->second.idx);
+        if (!binding) {
             return std::nullopt;
         }
-        const Slot& s = slots[key.idx];
-        return GetHandleFor(s.resource.get());
+        return GetHandleForLocked(binding->resource.get());
     }
 
     void ReclaimExpiredAnonymous() {
-        for (uint32_t idx = 0; idx < slots.size(); ++idx) {
-            Slot& s = slots[idx];
-            if (!s.alive) {
+        std::unique_lock lock(m_mutex);
+        const uint32_t slotCount = m_slotCount.load(std::memory_order_relaxed);
+        for (uint32_t idx = 0; idx < slotCount; ++idx) {
+            Slot& s = SlotAt(idx);
+            const SlotBinding* binding = s.binding.load(std::memory_order_relaxed);
+            if (!binding) {
                 continue;
             }
-            if (!s.id.segments.empty()) {
+            if (!binding->id.IsEmpty()) {
                 continue;
             }
-            if (s.resource) {
+            if (binding->resource) {
                 continue;
             }
 
-            if (s.rawPointer) {
-                resourceToHandle.erase(s.rawPointer);
-                s.rawPointer = nullptr;
+            if (binding->rawPointer) {
+                resourceToHandle.erase(binding->rawPointer);
             }
 
-            s.resource = SharedOrWeakPtr<Resource>{};
-            s.alive = false;
+            PublishLocked(s, nullptr);
             ++s.generation;
             freeList.push_back(idx);
         }
     }
 
+    // Frees the bindings retired before the previous call. Call once per frame from a point where
+    // the registry is otherwise quiet; RenderGraph does it in ResetForFrame.
+    void CollectRetiredBindings() {
+        std::unique_lock lock(m_mutex);
+        for (const SlotBinding* binding : m_retiringBindings) {
+            delete binding;
+        }
+        m_retiringBindings.swap(m_retiredBindings);
+        m_retiredBindings.clear();
+    }
+
     RegistryHandle MakeHandle(ResourceIdentifier const& id) const {
+        std::shared_lock lock(m_mutex);
         auto it = intern.find(id);
         if (it == intern.end()) return RegistryHandle({}, 0, 0, 0, 0, 0); // generation==0 means invalid
 
         const ResourceKey key = it->second;
-        if (key.idx >= slots.size()) return RegistryHandle({}, 0, 0, 0, 0, 0);
+        const SlotBinding* binding = LoadBinding(key.idx);
+        if (!binding || !binding->resource) return RegistryHandle({}, 0, 0, 0, 0, 0);
 
-        const Slot& s = slots[key.idx];
-        if (!s.alive || !s.resource) return RegistryHandle({}, 0, 0, 0, 0, 0);
+        const auto resource = binding->resource.lock_shared();
+        if (!resource) return RegistryHandle({}, 0, 0, 0, 0, 0);
 
         RegistryHandle h(
             key,
-            s.generation,
+            binding->generation,
             m_epoch,
-            s.resource->GetGlobalResourceID(),
-                s.resource->GetMipLevels(), 
-                s.resource->GetArraySize());
+            resource->GetGlobalResourceID(),
+                resource->GetMipLevels(), 
+                resource->GetArraySize());
 
         return h;
     }
@@ -350,17 +397,14 @@ public:
         if (h.IsEphemeral()) {
             return h.GetEphemeralPtr();
         }
-        if (h.GetKey().idx >= slots.size()) {
-            return nullptr;
-        }
-        Slot& s = slots[h.GetKey().idx];
-        if (!s.alive || !s.resource) {
+        const SlotBinding* binding = LoadBinding(h.GetKey().idx);
+        if (!binding) {
             return nullptr;
         }
-        if (s.generation != h.GetGeneration()) {
+        if (binding->generation != h.GetGeneration()) {
             return nullptr; // stale handle
         }
-        return s.resource.get();
+        return binding->resource.get();
     }
 
     Resource const* Resolve(RegistryHandle h) const {
@@ -369,15 +413,13 @@ public:
 
     // allow "floating" handles that follow replacements
     Resource* Resolve(ResourceKey k) {
-        if (k.idx >= slots.size()) return nullptr;
-        Slot& s = slots[k.idx];
-        return (s.alive ? s.resource.get() : nullptr);
+        const SlotBinding* binding = LoadBinding(k.idx);
+        return binding ? binding->resource.get() : nullptr;
     }
 
     bool IsValid(RegistryHandle h) const noexcept {
-        if (h.GetKey().idx >= slots.size()) return false;
-        const Slot& s = slots[h.GetKey().idx];
-        return s.alive && s.resource && s.generation == h.GetGeneration();
+        const SlotBinding* binding = LoadBinding(h.GetKey().idx);
+        return binding && binding->resource && binding->generation == h.GetGeneration();
     }
 
     std::string DescribeHandle(RegistryHandle h) const {
@@ -393,17 +435,21 @@ public:
             << " handleEpoch=" << h.GetEpoch()
             << " handleResourceId=" << h.GetGlobalResourceID();
 
-        if (h.GetKey().idx >= slots.size()) {
+        if (h.GetKey().idx >= m_slotCount.load(std::memory_order_acquire)) {
             oss << " slot=<out-of-range>";
             return oss.str();
         }
 
-        const Slot& s = slots[h.GetKey().idx];
-        const auto shared = s.resource.lock_shared();
-        oss << " slotAlive=" << (s.alive ? 1 : 0)
-            << " slotGeneration=" << s.generation
-            << " slotId='" << s.id.ToString() << "'"
-            << " slotRawPointer=" << static_cast<const void*>(s.rawPointer)
+        const SlotBinding* binding = LoadBinding(h.GetKey().idx);
+        if (!binding) {
+            oss << " slotAlive=0";
+            return oss.str();
+        }
+        const auto shared = binding->resource.lock_shared();
+        oss << " slotAlive=1"
+            << " slotGeneration=" << binding->generation
+            << " slotId='" << binding->id.ToString() << "'"
+            << " slotRawPointer=" << static_cast<const void*>(binding->rawPointer)
             << " slotHasResource=" << (shared ? 1 : 0);
         if (shared) {
             oss << " slotResourceId=" << shared->GetGlobalResourceID()
@@ -414,19 +460,16 @@ public:
 
     // Unchecked: no declared-prefix enforcement. For RenderGraph/internal use.
     std::shared_ptr<Resource> RequestShared(ResourceIdentifier const& id) const {
+        std::shared_lock lock(m_mutex);
 		auto it = intern.find(id);
         if (it == intern.end()) {
             return nullptr;
         }
-		const ResourceKey key = it->second;
-        if (key.idx >= slots.size()) {
-            return nullptr;
-        }
-        const Slot& s = slots[key.idx];
-        if (!s.alive || !s.resource) {
+        const SlotBinding* binding = LoadBinding(it->second.idx);
+        if (!binding) {
             return nullptr;
         }
-		return s.resource.lock_shared();
+		return binding->resource.lock_shared();
     }
 
     template<class T>
@@ -435,40 +478,108 @@ public:
         return std::dynamic_pointer_cast<T>(base);
     }
 
+    // Descriptor index table owned by the render graph. Passes' descriptor helpers assign table
+    // slots through it when one is attached.
+    void SetDescriptorIndexTable(ResourceDescriptorIndexTable* table) noexcept { m_descriptorIndexTable = table; }
+    ResourceDescriptorIndexTable* GetDescriptorIndexTable() const noexcept { return m_descriptorIndexTable; }
+
 private:
     uint64_t m_epoch = 0;
+    ResourceDescriptorIndexTable* m_descriptorIndexTable = nullptr;
     std::unordered_map<Resource*, RegistryHandle> resourceToHandle;
 	static constexpr uint32_t kEphemeralSlotIndex = UINT32_MAX;
     std::unordered_map<ResourceIdentifier, std::shared_ptr<IResourceResolver>, ResourceIdentifier::Hasher> m_resolvers;
 
-    RegistryHandle RegisterAnonymousBase(SharedOrWeakPtr<Resource> res) {
-        uint32_t idx;
-        if (!freeList.empty()) { idx = freeList.back(); freeList.pop_back(); }
-        else { idx = (uint32_t)slots.size(); slots.emplace_back(); }
+    void ReleaseAllLocked() noexcept {
+        const uint32_t slotCount = m_slotCount.load(std::memory_order_acquire);
+        for (uint32_t idx = 0; idx < slotCount; ++idx) {
+            delete SlotAt(idx).binding.load(std::memory_order_relaxed);
+        }
+        for (auto& chunk : m_slotChunks) {
+            delete[] chunk.exchange(nullptr, std::memory_order_relaxed);
+        }
+        m_slotCount.store(0, std::memory_order_release);
+        for (const SlotBinding* binding : m_retiredBindings) delete binding;
+        for (const SlotBinding* binding : m_retiringBindings) delete binding;
+        m_retiredBindings.clear();
+        m_retiringBindings.clear();
+    }
+
+    Slot& SlotAt(uint32_t idx) const noexcept {
+        return m_slotChunks[idx >> kSlotChunkShift].load(std::memory_order_acquire)[idx & (kSlotChunkSize - 1)];
+    }
+
+    const SlotBinding* LoadBinding(uint32_t idx) const noexcept {
+        if (idx >= m_slotCount.load(std::memory_order_acquire)) {
+            return nullptr;
+        }
+        return SlotAt(idx).binding.load(std::memory_order_acquire);
+    }
+
+    // Swaps the slot's binding; the old one stays readable until CollectRetiredBindings frees it.
+    void PublishLocked(Slot& s, const SlotBinding* binding) {
+        if (const SlotBinding* old = s.binding.exchange(binding, std::memory_order_acq_rel)) {
+            m_retiredBindings.push_back(old);
+        }
+    }
+
+    uint32_t AllocateSlotLocked() {
+        if (!freeList.empty()) {
+            const uint32_t idx = freeList.back();
+            freeList.pop_back();
+            return idx;
+        }
+        const uint32_t idx = m_slotCount.load(std::memory_order_relaxed);
+        const uint32_t chunk = idx >> kSlotChunkShift;
+        if (chunk >= kMaxSlotChunks) {
+            throw std::runtime_error("ResourceRegistry: slot capacity exhausted");
+        }
+        if ((idx & (kSlotChunkSize - 1)) == 0) {
+            m_slotChunks[chunk].store(new Slot[kSlotChunkSize], std::memory_order_release);
+        }
+        m_slotCount.store(idx + 1, std::memory_order_release);
+        return idx;
+    }
+
+    ResourceKey InternKeyLocked(ResourceIdentifier const& id) {
+        if (auto it = intern.find(id); it != intern.end()) return it->second;
+
+        ResourceKey key{ AllocateSlotLocked() };
+        intern.emplace(id, key);
+        return key;
+    }
 
-        Slot& s = slots[idx];
+    std::optional<RegistryHandle> GetHandleForLocked(Resource* res) const {
+        if (auto it = resourceToHandle.find(res); it != resourceToHandle.end()) {
+            return it->second;
+        }
+        return std::nullopt;
+    }
+
+    RegistryHandle RegisterAnonymousBase(SharedOrWeakPtr<Resource> res) {
+        std::unique_lock lock(m_mutex);
+        const uint32_t idx = AllocateSlotLocked();
+        Slot& s = SlotAt(idx);
 
         // If slot previously held a resource, remove reverse mapping.
-        if (s.rawPointer) {
-            resourceToHandle.erase(s.rawPointer);
+        if (const SlotBinding* current = s.binding.load(std::memory_order_relaxed); current && current->rawPointer) {
+            resourceToHandle.erase(current->rawPointer);
         }
 
-        s.resource = std::move(res);
-        s.rawPointer = s.resource.get();
+        Resource* rawPointer = res.get();
         s.generation++;
-        s.alive = true;
-        s.id = {};
+        PublishLocked(s, new SlotBinding{ std::move(res), rawPointer, {}, s.generation });
 
         RegistryHandle h(
             ResourceKey{ idx },
             s.generation,
             m_epoch,
-            s.resource->GetGlobalResourceID(),
-            s.resource->GetMipLevels(),
-            s.resource->GetArraySize()
+            rawPointer->GetGlobalResourceID(),
+            rawPointer->GetMipLevels(),
+            rawPointer->GetArraySize()
         );
 
-        resourceToHandle[s.rawPointer] = h;
+        resourceToHandle[rawPointer] = h;
         return h;
     }
 };
@@ -573,6 +684,10 @@ public:
         return _global.IsValid(h);
     }
 
+    ResourceDescriptorIndexTable* GetDescriptorIndexTable() const noexcept {
+        return _global.GetDescriptorIndexTable();
+    }
+
     // let the pass declare an entire namespace at once:
     bool DeclaredNamespace(ResourceIdentifier const& ns) const {
         for (auto const& p : _allowedPrefixes)
@@ -29,9 +29,23 @@ struct ResourcePtrAndRange {
 struct ResourceRequirement {
 	ResourceRequirement(const ResourceHandleAndRange& resourceAndRange)
 		: resourceHandleAndRange(resourceAndRange) {
+		RefreshResolvedRange();
 	}
 	ResourceHandleAndRange resourceHandleAndRange;    // resource and range
     ResourceState state;
+	// Range resolved against the handle's mip and slice counts. Call RefreshResolvedRange after
+	// changing resourceHandleAndRange.
+	SubresourceRange resolvedRange{};
+	// The pass overwrites every texel of the range before reading it, so the previous contents
+	// can be discarded on the transition in. Set from the builder's WithFullOverwrite.
+	bool fullOverwrite = false;
+
+	void RefreshResolvedRange() {
+		resolvedRange = ResolveRangeSpec(
+			resourceHandleAndRange.range,
+			resourceHandleAndRange.resource.GetNumMipLevels(),
+			resourceHandleAndRange.resource.GetArraySize());
+	}
 };
 
 template<class PassResourceData>
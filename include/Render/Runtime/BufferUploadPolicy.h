@@ -3,6 +3,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <stdexcept>
 #include <utility>
@@ -10,21 +13,33 @@
 
 #include "Render/Runtime/UploadServiceAccess.h"
 
-namespace rg::runtime {
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define RG_UPLOAD_POLICY_SSE2 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define RG_UPLOAD_POLICY_NEON 1
+#endif
 
-struct BulkWriteHandle {
-    uint8_t* data = nullptr;
-    size_t capacity = 0;
-    std::shared_ptr<void> lock;
-};
+namespace rg::runtime {
 
 enum class UploadPolicyTag : uint8_t {
     Immediate = 0,
     Coalesced = 1,
+    // Writes are copied straight into the mapped buffer and never reach the upload pass. Only
+    // honored for buffers placed in CPU-visible device-local memory (BufferPlacement); others
+    // upload as Immediate. The GPU may still be reading the previous contents from frames in
+    // flight, so callers must only write ranges no in-flight frame reads (e.g. per-frame slices).
+    DirectWrite = 2,
 };
 
 struct UploadPolicyConfig {
     UploadPolicyTag tag = UploadPolicyTag::Immediate;
+    // Coalesced only: compare dirty blocks of the mirror against a shadow of what was last flushed
+    // and upload only the blocks that changed. Dirty ranges are widened to whole blocks, so the
+    // mirror must cover the full buffer. Costs a shadow copy of the buffer in CPU memory.
+    bool diffAgainstShadow = false;
+    uint32_t diffBlockBytes = 256;
 };
 
 struct BufferUploadPolicyStats {
@@ -35,18 +50,60 @@ struct BufferUploadPolicyStats {
     uint64_t mergedWrites = 0;
     uint64_t overlapEvents = 0;
     uint64_t overlapBytes = 0;
+    uint64_t diffedBlocks = 0;
+    uint64_t skippedBlocks = 0;
+    uint64_t skippedBytes = 0;
 };
 
+namespace detail {
+
+inline bool UploadBlocksEqual(const uint8_t* lhs, const uint8_t* rhs, size_t size) noexcept {
+    size_t i = 0;
+#if defined(RG_UPLOAD_POLICY_SSE2)
+    for (; i + 64 <= size; i += 64) {
+        const __m128i a0 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)));
+        const __m128i a1 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i + 16)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i + 16)));
+        const __m128i a2 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i + 32)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i + 32)));
+        const __m128i a3 = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i + 48)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i + 48)));
+        const __m128i all = _mm_and_si128(_mm_and_si128(a0, a1), _mm_and_si128(a2, a3));
+        if (_mm_movemask_epi8(all) != 0xFFFF) {
+            return false;
+        }
+    }
+    for (; i + 16 <= size; i += 16) {
+        const __m128i eq = _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)), _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i)));
+        if (_mm_movemask_epi8(eq) != 0xFFFF) {
+            return false;
+        }
+    }
+#elif defined(RG_UPLOAD_POLICY_NEON)
+    for (; i + 16 <= size; i += 16) {
+        const uint8x16_t eq = vceqq_u8(vld1q_u8(lhs + i), vld1q_u8(rhs + i));
+        if (vminvq_u8(eq) != 0xFF) {
+            return false;
+        }
+    }
+#endif
+    return std::memcmp(lhs + i, rhs + i, size - i) == 0;
+}
+
+}
+
 class BufferUploadPolicyState {
 public:
     BufferUploadPolicyState() = default;
 
     void SetPolicy(const UploadPolicyConfig& config, size_t currentBufferSize) {
-        (void)currentBufferSize;
         m_config = config;
+        m_config.diffBlockBytes = std::max<uint32_t>(m_config.diffBlockBytes, 16u);
         if (m_config.tag != UploadPolicyTag::Coalesced) {
             ClearPendingWork();
         }
+        m_shadow.clear();
+        m_shadowBlockValid.clear();
+        if (UsesShadowDiff()) {
+            ResizeShadow(currentBufferSize);
+        }
     }
 
     UploadPolicyConfig GetPolicy() const {
@@ -58,10 +115,12 @@ public:
     }
 
     void OnBufferResized(size_t newSize) {
-        (void)newSize;
         // Preserve pending dirty ranges across grows so writes staged before a
         // resize are not dropped prior to FlushToUploadService(). Buffer-owned
         // CPU mirrors are authoritative; this policy only tracks byte ranges.
+        if (UsesShadowDiff()) {
+            ResizeShadow(newSize);
+        }
     }
 
     void BeginFrame() {
@@ -72,11 +131,19 @@ public:
         // Staged data is consumed/cleared in FlushToUploadService().
     }
 
-    // Bulk writes are now owned by buffer-specific CPU mirrors. This helper
-    // remains only to fail loudly if old retained-mirror code is reintroduced.
-    BulkWriteHandle PrepareBulkWrite(size_t currentBufferSize) {
-        (void)currentBufferSize;
-        throw std::runtime_error("Upload policy bulk writes were removed; write to the buffer CPU mirror instead");
+    // Reserves `size` bytes at `offset` of the target straight in an upload page, bypassing both the
+    // CPU mirror and the coalescing queue; intended for data regenerated every frame. Commit with
+    // CommitBulkWrite. The mirror (if any) is not updated, so a later flush of an overlapping dirty
+    // range re-uploads the mirror's bytes over the bulk write. Safe to call from multiple threads.
+    UploadReservation PrepareBulkWrite(UploadTarget target, size_t offset, size_t size, size_t currentBufferSize) {
+        if (offset + size > currentBufferSize) {
+            throw std::runtime_error("Upload policy bulk write is out of bounds for target buffer");
+        }
+        return ReserveBufferUploadDispatch(std::move(target), offset, size, nullptr, 0);
+    }
+
+    void CommitBulkWrite(UploadReservation&& reservation) {
+        CommitBufferUploadDispatch(std::move(reservation));
     }
 
     // Registers a dirty range after parallel writes to a buffer-owned CPU mirror.
@@ -102,7 +169,7 @@ public:
             return true;
         }
 
-        if (m_config.tag == UploadPolicyTag::Immediate) {
+        if (m_config.tag != UploadPolicyTag::Coalesced) {
             return false;
         }
 
@@ -133,35 +200,43 @@ public:
         stats.overlapEvents = m_coalescedOverlapEvents;
         stats.overlapBytes = m_coalescedOverlapBytes;
 
-        auto mergedDirty = CoalesceDirtyRanges(std::move(m_coalescedDirtyRanges), m_coalescedDirtyRangesSorted);
-        for (const auto& range : mergedDirty) {
-            const size_t uploadSize = range.end - range.begin;
-            if (uploadSize == 0) {
-                continue;
-            }
-
-            const void* source = sourceBytes(range.begin, uploadSize);
-            if (!source) {
-                throw std::runtime_error("Upload policy source mirror returned null for a dirty range");
-            }
-
+        auto upload = [&](const void* source, size_t offset, size_t uploadSize, const DirtyRange& range) {
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
             uploadService->UploadData(
                 source,
                 uploadSize,
                 target,
-                range.begin,
+                offset,
                 range.file,
                 range.line);
 #else
+            (void)range;
             uploadService->UploadData(
                 source,
                 uploadSize,
                 target,
-                range.begin);
+                offset);
 #endif
             ++stats.flushedWrites;
             stats.flushedBytes += static_cast<uint64_t>(uploadSize);
+        };
+
+        for (const auto& [begin, range] : m_coalescedDirtyRanges) {
+            const size_t uploadSize = range.end - begin;
+            if (uploadSize == 0) {
+                continue;
+            }
+
+            if (UsesShadowDiff() && range.end <= m_shadow.size()) {
+                FlushRangeAgainstShadow(begin, range, sourceBytes, upload, stats);
+                continue;
+            }
+
+            const void* source = sourceBytes(begin, uploadSize);
+            if (!source) {
+                throw std::runtime_error("Upload policy source mirror returned null for a dirty range");
+            }
+            upload(source, begin, uploadSize, range);
         }
 
         stats.mergedWrites = stats.stagedWrites > stats.flushedWrites ? (stats.stagedWrites - stats.flushedWrites) : 0;
@@ -181,81 +256,109 @@ public:
     }
 
 private:
+    // Dirty ranges are kept as a set of disjoint intervals keyed by their begin offset; touching or
+    // overlapping writes merge on insert, so a flush walks them in order with no extra sort.
     struct DirtyRange {
-        size_t begin = 0;
         size_t end = 0;
         const char* file = nullptr;
         int line = 0;
     };
 
-    static std::vector<DirtyRange> CoalesceDirtyRanges(std::vector<DirtyRange> ranges, bool alreadySorted) {
-        if (ranges.empty()) {
-            return ranges;
-        }
+    bool UsesShadowDiff() const {
+        return m_config.tag == UploadPolicyTag::Coalesced && m_config.diffAgainstShadow;
+    }
 
-        if (!alreadySorted) {
-            std::sort(ranges.begin(), ranges.end(), [](const DirtyRange& lhs, const DirtyRange& rhs) {
-                return lhs.begin < rhs.begin;
-            });
+    void ResizeShadow(size_t newSize) {
+        const size_t blockBytes = m_config.diffBlockBytes;
+        const size_t oldSize = m_shadow.size();
+        m_shadow.resize(newSize);
+        m_shadowBlockValid.resize((newSize + blockBytes - 1) / blockBytes, 0);
+        if (oldSize % blockBytes != 0 && oldSize / blockBytes < m_shadowBlockValid.size()) {
+            m_shadowBlockValid[oldSize / blockBytes] = 0; // The old tail block changed length
         }
+    }
+
+    template<class SourceBytesFn, class UploadFn>
+    void FlushRangeAgainstShadow(size_t begin, const DirtyRange& range, SourceBytesFn& sourceBytes, UploadFn& upload, BufferUploadPolicyStats& stats) {
+        const size_t blockBytes = m_config.diffBlockBytes;
+        const size_t firstBlock = begin / blockBytes;
+        const size_t lastBlock = (range.end + blockBytes - 1) / blockBytes;
+
+        size_t runBegin = 0;
+        size_t runEnd = 0;
+        auto flushRun = [&]() {
+            if (runEnd > runBegin) {
+                const void* source = sourceBytes(runBegin, runEnd - runBegin);
+                if (!source) {
+                    throw std::runtime_error("Upload policy source mirror returned null for a dirty range");
+                }
+                upload(source, runBegin, runEnd - runBegin, range);
+            }
+            runBegin = runEnd = 0;
+        };
 
-        std::vector<DirtyRange> merged;
-        merged.reserve(ranges.size());
-        merged.push_back(ranges.front());
-
-        for (size_t i = 1; i < ranges.size(); ++i) {
-            auto& tail = merged.back();
-            const auto& current = ranges[i];
-            if (current.begin <= tail.end) {
-                tail.end = std::max(tail.end, current.end);
-                tail.file = current.file;
-                tail.line = current.line;
+        for (size_t block = firstBlock; block < lastBlock; ++block) {
+            const size_t blockBegin = block * blockBytes;
+            const size_t blockSize = std::min(blockBytes, m_shadow.size() - blockBegin);
+            const auto* source = static_cast<const uint8_t*>(sourceBytes(blockBegin, blockSize));
+            if (!source) {
+                throw std::runtime_error("Upload policy source mirror returned null for a dirty range");
             }
-            else {
-                merged.push_back(current);
+            ++stats.diffedBlocks;
+
+            uint8_t* shadow = m_shadow.data() + blockBegin;
+            if (m_shadowBlockValid[block] && detail::UploadBlocksEqual(source, shadow, blockSize)) {
+                ++stats.skippedBlocks;
+                stats.skippedBytes += static_cast<uint64_t>(blockSize);
+                flushRun();
+                continue;
             }
+
+            std::memcpy(shadow, source, blockSize);
+            m_shadowBlockValid[block] = 1;
+            if (runEnd != blockBegin) {
+                flushRun();
+                runBegin = blockBegin;
+            }
+            runEnd = blockBegin + blockSize;
         }
-        return merged;
+        flushRun();
     }
 
     void AddOrMergeDirtyRange(size_t begin, size_t end, const char* file, int line) {
-        DirtyRange incoming{ begin, end, file, line };
         ++m_coalescedStagedWrites;
         m_coalescedStagedBytes += static_cast<uint64_t>(end - begin);
 
-        if (m_coalescedDirtyRanges.empty()) {
-            m_coalescedDirtyRanges.push_back(incoming);
-            return;
+        // First interval that could touch [begin, end): the last one starting at or before `begin`,
+        // if it reaches `begin`, else the first one starting after it.
+        auto it = m_coalescedDirtyRanges.upper_bound(begin);
+        if (it != m_coalescedDirtyRanges.begin() && std::prev(it)->second.end >= begin) {
+            --it;
         }
 
-        auto& tail = m_coalescedDirtyRanges.back();
-        if (incoming.begin <= tail.end && incoming.end >= tail.begin) {
-            const size_t overlapBegin = std::max(incoming.begin, tail.begin);
-            const size_t overlapEnd = std::min(incoming.end, tail.end);
+        size_t mergedBegin = begin;
+        size_t mergedEnd = end;
+        uint64_t overlapBytes = 0;
+        while (it != m_coalescedDirtyRanges.end() && it->first <= end) {
+            const size_t overlapBegin = std::max(begin, it->first);
+            const size_t overlapEnd = std::min(end, it->second.end);
             if (overlapBegin < overlapEnd) {
-                ++m_coalescedOverlapEvents;
-                m_coalescedOverlapBytes += static_cast<uint64_t>(overlapEnd - overlapBegin);
+                overlapBytes += static_cast<uint64_t>(overlapEnd - overlapBegin);
             }
-
-            tail.begin = std::min(tail.begin, incoming.begin);
-            tail.end = std::max(tail.end, incoming.end);
-            tail.file = file;
-            tail.line = line;
-            return;
+            mergedBegin = std::min(mergedBegin, it->first);
+            mergedEnd = std::max(mergedEnd, it->second.end);
+            it = m_coalescedDirtyRanges.erase(it);
         }
-
-        if (incoming.begin >= tail.end) {
-            m_coalescedDirtyRanges.push_back(incoming);
-            return;
+        if (overlapBytes > 0) {
+            ++m_coalescedOverlapEvents;
+            m_coalescedOverlapBytes += overlapBytes;
         }
 
-        m_coalescedDirtyRanges.push_back(incoming);
-        m_coalescedDirtyRangesSorted = false;
+        m_coalescedDirtyRanges.emplace_hint(it, mergedBegin, DirtyRange{ mergedEnd, file, line });
     }
 
     void ClearPendingWork() {
         m_coalescedDirtyRanges.clear();
-        m_coalescedDirtyRangesSorted = true;
         m_coalescedStagedWrites = 0;
         m_coalescedStagedBytes = 0;
         m_coalescedOverlapEvents = 0;
@@ -263,8 +366,9 @@ private:
     }
 
     UploadPolicyConfig m_config{};
-    std::vector<DirtyRange> m_coalescedDirtyRanges;
-    bool m_coalescedDirtyRangesSorted = true;
+    std::map<size_t, DirtyRange> m_coalescedDirtyRanges;
+    std::vector<uint8_t> m_shadow;
+    std::vector<uint8_t> m_shadowBlockValid;
     uint64_t m_coalescedStagedWrites = 0;
     uint64_t m_coalescedStagedBytes = 0;
     uint64_t m_coalescedOverlapEvents = 0;
@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <variant>
 
 #include <rhi.h>
 
+#include "Render/PassInputs.h"
+
 namespace rg::runtime {
 
 struct DescriptorViewRequirements {
@@ -47,4 +50,53 @@ struct DescriptorViewRequirements {
     std::variant<TextureViews, BufferViews> views;
 };
 
+namespace detail {
+// The rhi view descs have no hash of their own; hash their bytes. Padding can only cause a
+// spurious mismatch, which costs a rewrite, never a wrongly skipped one.
+template<class T>
+rg::Hash64 HashObjectBytes(const T& value) noexcept {
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&value);
+    rg::Hash64 seed = sizeof(T);
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        seed = rg::HashCombine(seed, bytes[i]);
+    }
+    return seed;
+}
+} // namespace detail
+
+inline rg::Hash64 HashValue(const DescriptorViewRequirements& req) noexcept {
+    if (const auto* tex = std::get_if<DescriptorViewRequirements::TextureViews>(&req.views)) {
+        rg::Hash64 seed = 1;
+        for (const rg::Hash64 value : {
+                 rg::Hash64(tex->mipLevels), rg::Hash64(tex->isCubemap), rg::Hash64(tex->isArray),
+                 rg::Hash64(tex->arraySize), rg::Hash64(tex->totalArraySlices),
+                 rg::Hash64(tex->baseFormat), rg::Hash64(tex->srvFormat), rg::Hash64(tex->uavFormat),
+                 rg::Hash64(tex->rtvFormat), rg::Hash64(tex->dsvFormat),
+                 rg::Hash64(tex->createSRV), rg::Hash64(tex->createUAV), rg::Hash64(tex->createNonShaderVisibleUAV),
+                 rg::Hash64(tex->createRTV), rg::Hash64(tex->createDSV),
+                 rg::Hash64(tex->createCubemapAsArraySRV), rg::Hash64(tex->uavFirstMip) }) {
+            seed = rg::HashCombine(seed, value);
+        }
+        return seed;
+    }
+
+    const auto& buf = std::get<DescriptorViewRequirements::BufferViews>(req.views);
+    rg::Hash64 seed = 2;
+    for (const rg::Hash64 value : {
+             rg::Hash64(buf.createCBV), rg::Hash64(buf.createSRV), rg::Hash64(buf.createUAV),
+             rg::Hash64(buf.createNonShaderVisibleUAV), rg::Hash64(buf.uavCounterOffset) }) {
+        seed = rg::HashCombine(seed, value);
+    }
+    if (buf.createCBV) {
+        seed = rg::HashCombine(seed, detail::HashObjectBytes(buf.cbvDesc));
+    }
+    if (buf.createSRV) {
+        seed = rg::HashCombine(seed, detail::HashObjectBytes(buf.srvDesc));
+    }
+    if (buf.createUAV || buf.createNonShaderVisibleUAV) {
+        seed = rg::HashCombine(seed, detail::HashObjectBytes(buf.uavDesc));
+    }
+    return seed;
+}
+
 } // namespace rg::runtime
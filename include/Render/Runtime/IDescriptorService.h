@@ -5,6 +5,7 @@
 #include <rhi.h>
 
 #include "Render/Runtime/DescriptorServiceTypes.h"
+#include "Resources/ResourceStateTracker.h"
 
 class GloballyIndexedResource;
 
@@ -31,6 +32,18 @@ public:
         rhi::Resource& apiResource,
         const DescriptorViewRequirements& req) = 0;
 
+    // Writes views deferred by lazySubresourceDescriptorViews for the declared range; the graph
+    // calls it for every requirement while any target still has deferred views.
+    virtual void EnsureSubresourceViews(
+        GloballyIndexedResource& target,
+        const SubresourceRange& range) = 0;
+    virtual uint64_t GetDeferredSubresourceViewTargetCount() const = 0;
+
+    // Brackets a materialization phase: shader-visible view writes in between are queued and
+    // written in one batch by the flush.
+    virtual void BeginDeferredDescriptorWrites() = 0;
+    virtual void FlushDeferredDescriptorWrites() = 0;
+
     virtual rhi::DescriptorHeap GetSRVDescriptorHeap() const = 0;
     virtual rhi::DescriptorHeap GetSamplerDescriptorHeap() const = 0;
     virtual UINT CreateIndexedSampler(const rhi::SamplerDesc& samplerDesc) = 0;
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+
+class Resource;
+struct PassExecutionContext;
+
+namespace rg::runtime {
+
+// Generate mips [sourceMip + 1, sourceMip + mipCount] of `texture` from sourceMip, for slices
+// [firstSlice, firstSlice + sliceCount). Counts are already resolved against the texture and
+// mipCount never exceeds the generator's GetMaxMipsPerDispatch.
+struct MipGenerationJob {
+    std::shared_ptr<Resource> texture;
+    uint32_t sourceMip = 0;
+    uint32_t mipCount = 0;
+    uint32_t firstSlice = 0;
+    uint32_t sliceCount = 1;
+};
+
+// Single-pass GPU downsampler: writes several mips per dispatch from one source mip (in the style
+// of AMD's SPD). The library ships no shaders: the application registers one generator with
+// IUploadService::RegisterMipGenerator, and MipGenerationPass hands it each batch of jobs.
+class IMipGenerator {
+public:
+    virtual ~IMipGenerator() = default;
+
+    // Mips one dispatch can write below its source; longer chains are split across passes, so
+    // the last mip of one batch is readable as the source of the next.
+    virtual uint32_t GetMaxMipsPerDispatch() const = 0;
+
+    // Called from the pass's Setup; create pipelines here.
+    virtual void Setup() {}
+
+    // Record the dispatches for `jobs`. Each source mip is in shader-resource state and the mips
+    // below it are in UAV state; their previous contents are discarded.
+    virtual void Record(PassExecutionContext& context, std::span<const MipGenerationJob> jobs) = 0;
+};
+
+}
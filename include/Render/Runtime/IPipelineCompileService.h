@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#include "Render/PipelineState.h"
+#include "Render/Runtime/ITaskService.h"
+
+namespace rg::runtime {
+
+// Identity of a pipeline in the compile cache: a hash of everything in its description that shapes
+// the API object (state blocks, formats, root layout) and a hash of the shader bytecode it links.
+struct PipelineCompileKey {
+    uint64_t descriptionHash = 0;
+    uint64_t shaderHash = 0;
+
+    friend bool operator==(const PipelineCompileKey&, const PipelineCompileKey&) = default;
+
+    struct Hasher {
+        size_t operator()(const PipelineCompileKey& key) const noexcept {
+            uint64_t hash = key.descriptionHash ^ (key.shaderHash + 0x9e3779b97f4a7c15ull + (key.descriptionHash << 6) + (key.descriptionHash >> 2));
+            return static_cast<size_t>(hash);
+        }
+    };
+};
+
+enum class PipelineReadiness : uint8_t {
+    Pending,
+    Ready,
+    Failed,
+};
+
+// Result of a pipeline request, shared by every request for the same key. The pipeline is written
+// once by the compiling thread before the state turns Ready and is immutable afterwards.
+class PendingPipeline {
+public:
+    PipelineReadiness GetReadiness() const noexcept { return m_readiness.load(std::memory_order_acquire); }
+    bool IsReady() const noexcept { return GetReadiness() == PipelineReadiness::Ready; }
+
+    const PipelineState& GetPipeline() const {
+        if (!IsReady()) {
+            throw std::runtime_error("Pipeline is not ready");
+        }
+        return m_pipeline;
+    }
+    // Set when the state is Failed.
+    const std::string& GetError() const noexcept { return m_error; }
+
+    // Called by the compile service once.
+    void Complete(PipelineState pipeline) {
+        m_pipeline = std::move(pipeline);
+        m_readiness.store(PipelineReadiness::Ready, std::memory_order_release);
+    }
+    void Fail(std::string error) {
+        m_error = std::move(error);
+        m_readiness.store(PipelineReadiness::Failed, std::memory_order_release);
+    }
+
+private:
+    std::atomic<PipelineReadiness> m_readiness{ PipelineReadiness::Pending };
+    PipelineState m_pipeline;
+    std::string m_error;
+};
+
+struct PipelineCompileStats {
+    uint64_t requests = 0;
+    uint64_t cacheHits = 0;   // Requests answered by an entry that was already ready or compiling
+    uint64_t compiled = 0;
+    uint64_t failed = 0;
+    uint64_t pending = 0;     // Compiles queued or running right now
+    double compileMsTotal = 0.0;
+};
+
+// Creates pipeline state objects off the frame. Passes request their pipelines in Setup with a
+// create callback, keep the returned PendingPipeline, and report it through
+// IPipelineDependentPass so the graph skips them until the pipelines are ready.
+class IPipelineCompileService {
+public:
+    virtual ~IPipelineCompileService() = default;
+
+    // Compiles run through the task service's SubmitBackground; without one they run inline.
+    virtual void SetTaskService(std::shared_ptr<ITaskService> service) = 0;
+
+    // The cached entry for key, or a new one whose create() is queued. create() runs on a
+    // background worker and must only touch thread-safe state (the rhi device is).
+    virtual std::shared_ptr<PendingPipeline> RequestPipeline(const PipelineCompileKey& key, std::function<PipelineState()> create) = 0;
+    // Forgets a cached pipeline, e.g. after a shader hot reload, so the next request compiles.
+    // Holders of the old PendingPipeline keep it.
+    virtual void Evict(const PipelineCompileKey& key) = 0;
+    virtual void Clear() = 0;
+
+    virtual PipelineCompileStats GetStats() const = 0;
+};
+
+std::shared_ptr<IPipelineCompileService> CreateDefaultPipelineCompileService();
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Resources/ReadbackRequest.h"
+
+struct PassExecutionContext;
+
+namespace rg::runtime {
+
+struct ReadbackReductionJob {
+    Resource* source = nullptr;      // In shader-resource state
+    SubresourceRange range{};        // Already resolved against `source`
+    ReadbackReductionDesc desc{};
+    Resource* result = nullptr;      // UAV buffer of ReadbackReductionResultBytes(desc) bytes
+};
+
+// GPU reduction for one ReadbackReductionKind (other than Texel, which needs no shader). The
+// library ships no shaders: the application registers one reducer per kind with
+// IReadbackService::RegisterReadbackReducer, and ReadbackReductionPass hands it its job.
+class IReadbackReducer {
+public:
+    virtual ~IReadbackReducer() = default;
+
+    virtual ReadbackReductionKind GetKind() const = 0;
+
+    // Called from the pass's Setup; create pipelines here.
+    virtual void Setup() {}
+
+    // Record the dispatches that reduce job.source over job.range into job.result, including
+    // clearing the result first. The layout of the result is given on ReadbackReductionKind.
+    virtual void Record(PassExecutionContext& context, const ReadbackReductionJob& job) = 0;
+};
+
+}
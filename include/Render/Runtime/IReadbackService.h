@@ -10,6 +10,7 @@
 
 #include "Render/QueueKind.h"
 #include "Resources/ReadbackRequest.h"
+#include "Render/Runtime/IReadbackReducer.h"
 
 class RenderPass;
 class Resource;
@@ -23,6 +24,7 @@ struct ReadbackCaptureInfo {
     RangeSpec range{};
     ReadbackCaptureCallback callback;
     QueueKind preferredQueueKind = QueueKind::Graphics;
+    ReadbackReductionDesc reduction{}; // kind != None: see ReadbackReductionPass
 };
 
 struct ReadbackCaptureToken {
@@ -35,9 +37,24 @@ public:
 
     virtual void Initialize(rhi::Timeline graphicsReadbackFence, rhi::Timeline copyReadbackFence) = 0;
     virtual void RequestReadbackCapture(const std::string& passName, Resource* resource, const RangeSpec& range, ReadbackCaptureCallback callback, QueueKind preferredQueueKind = QueueKind::Graphics) = 0;
+    // Like RequestReadbackCapture, but only the result of `reduction` over `range` is read back.
+    // Throws if the kind needs a reducer and none is registered, or if Texel targets a buffer.
+    virtual void RequestReadbackReduction(const std::string& passName, Resource* resource, const RangeSpec& range, const ReadbackReductionDesc& reduction, ReadbackCaptureCallback callback, QueueKind preferredQueueKind = QueueKind::Graphics) = 0;
+    // A later registration for the same kind replaces the earlier one.
+    virtual void RegisterReadbackReducer(std::shared_ptr<IReadbackReducer> reducer) = 0;
+    virtual std::shared_ptr<IReadbackReducer> GetReadbackReducer(ReadbackReductionKind kind) = 0;
     virtual std::vector<ReadbackCaptureInfo> ConsumeCaptureRequests() = 0;
     virtual ReadbackCaptureToken EnqueueCapture(ReadbackCaptureRequest&& request) = 0;
+    // All requests share the returned token and are finalized together.
+    virtual ReadbackCaptureToken EnqueueCaptureBatch(std::vector<ReadbackCaptureRequest>&& requests) = 0;
     virtual void FinalizeCapture(ReadbackCaptureToken token, QueueKind queueKind, std::shared_ptr<rhi::TimelinePtr> signalFenceOwner, uint64_t fenceValue) = 0;
+    // Called by the graph once the frame's command lists are submitted, so the fences passed to
+    // FinalizeCapture since the last call are safe to wait on.
+    virtual void OnFrameSubmitted() = 0;
+    // Persistently mapped space in the readback page ring for `queueKind`, for a capture about to
+    // be enqueued; it is released when the capture is delivered.
+    // `shareCount` is the number of captures in a batch that share the allocation.
+    virtual ReadbackAllocation AllocateReadback(QueueKind queueKind, uint64_t size, uint64_t alignment, uint32_t shareCount = 1) = 0;
     virtual uint64_t GetNextReadbackFenceValue(QueueKind queueKind) = 0;
     virtual rhi::Timeline GetReadbackFence(QueueKind queueKind) const = 0;
     virtual void ProcessReadbackRequests() = 0;
@@ -11,12 +11,16 @@ class IRenderGraphSettingsService {
 public:
     virtual ~IRenderGraphSettingsService() = default;
 
+    // Changes whenever any setting may have changed, so cached lookups can be reused until then.
+    virtual uint64_t GetSettingsGeneration() const = 0;
+
     virtual bool GetUseAsyncCompute() const = 0;
     virtual bool GetRenderGraphCompileDumpEnabled() const = 0;
     virtual bool GetRenderGraphVramDumpEnabled() const = 0;
     virtual bool GetRenderGraphBatchTraceEnabled() const = 0;
     virtual bool GetRenderGraphLightweightCompileSummaryEnabled() const = 0;
     virtual bool GetReadOnlyUniformTransitionElisionEnabled() const = 0;
+    virtual bool GetReadStateMergingEnabled() const = 0;
     virtual uint8_t GetAutoAliasMode() const = 0;
     virtual uint8_t GetAutoAliasPackingStrategy() const = 0;
     virtual bool GetAutoAliasEnableLogging() const = 0;
@@ -39,11 +43,68 @@ public:
     virtual uint32_t GetRenderGraphRegionMaxPassCount() const = 0;
     virtual bool GetRenderGraphRegionDiagnosticsEnabled() const = 0;
     virtual bool GetRenderGraphRegionShadowStrictBatchMatch() const = 0;
+    virtual uint32_t GetRenderGraphRegionValidationIntervalFrames() const = 0;
+    virtual uint32_t GetRenderGraphRegionValidationSegmentsPerFrame() const = 0;
+    virtual bool GetRenderGraphRegionAdaptiveBoundariesEnabled() const = 0;
+    virtual uint32_t GetRenderGraphRegionVolatilityWindowFrames() const = 0;
+    virtual float GetRenderGraphRegionVolatilityThreshold() const = 0;
     virtual uint32_t GetRenderGraphReplaySegmentCacheMaxEntries() const = 0;
     virtual uint32_t GetRenderGraphReplaySegmentCacheMaxVariants() const = 0;
     virtual uint32_t GetRenderGraphReplaySegmentCacheMaxVariantsPerKey() const = 0;
     virtual uint32_t GetRenderGraphReplaySegmentCacheMaxAgeFrames() const = 0;
     virtual bool GetRenderGraphReplayRelaxAliasPlacement() const = 0;
+    virtual bool GetRenderGraphIncrementalDependencyGraphEnabled() const = 0;
+    virtual bool GetRenderGraphParallelDependencyGraphEnabled() const = 0;
+    virtual bool GetQueueSchedulingMeasuredCriticalPathEnabled() const = 0;
+    virtual float GetQueueSchedulingCriticalPathWeight() const = 0;
+    virtual bool GetQueueSchedulingAdaptivePlacementEnabled() const = 0;
+    virtual uint32_t GetQueueSchedulingAdaptivePlacementWindowFrames() const = 0;
+    virtual float GetQueueSchedulingAdaptivePlacementHysteresis() const = 0;
+    virtual bool GetQueueSchedulingAdaptiveQueueCountEnabled() const = 0;
+    virtual uint32_t GetQueueSchedulingAdaptiveQueueCountMaxQueues() const = 0;
+    virtual float GetQueueSchedulingAdaptiveQueueCountWaitCostUs() const = 0;
+    virtual bool GetRenderGraphSplitBarriersEnabled() const = 0;
+    virtual uint32_t GetRenderGraphGlobalBufferBarrierThreshold() const = 0;
+    virtual bool GetRenderGraphDeadPassCullingEnabled() const = 0;
+    virtual bool GetRenderGraphRenderPassMergingEnabled() const = 0;
+    virtual bool GetRenderGraphStreamingSubmissionEnabled() const = 0;
+    virtual bool GetRenderGraphTransitiveWaitReductionEnabled() const = 0;
+    virtual bool GetRenderGraphCrossFrameOverlapEnabled() const = 0;
+    virtual bool GetRenderGraphCrossFrameEndStatePredictionEnabled() const = 0;
+    virtual bool GetRenderGraphPresentLatencyModeEnabled() const = 0;
+    virtual uint32_t GetRenderGraphPresentLatencyMaxQueuedFrames() const = 0;
+    virtual bool GetAutoAliasPoolBudgetAwareEnabled() const = 0;
+    virtual float GetAutoAliasPoolBudgetPressureThreshold() const = 0;
+    virtual bool GetAutoAliasSubresourceLifetimesEnabled() const = 0;
+    virtual uint64_t GetStreamingUploadFrameBudgetBytes() const = 0;
+    virtual bool GetCpuVisibleDeviceLocalHeapSupported() const = 0;
+    virtual uint64_t GetCpuVisibleDeviceLocalMaxBufferBytes() const = 0;
+    virtual uint64_t GetUploadParallelCopyThresholdBytes() const = 0;
+    virtual UploadTelemetryLevel GetUploadTelemetryLevel() const = 0;
+    virtual uint64_t GetResourceCopyQueueMinBytes() const = 0;
+    virtual ReadbackCallbackDispatch GetReadbackCallbackDispatch() const = 0;
+    virtual bool GetDeferShaderVisibleDescriptorWrites() const = 0;
+    virtual uint32_t GetShaderVisibleDescriptorHeapInitialCapacity() const = 0;
+    virtual uint32_t GetShaderVisibleDescriptorHeapMaxCapacity() const = 0;
+    virtual bool GetLazySubresourceDescriptorViews() const = 0;
+    virtual bool GetImmediateBytecodeOptimizationEnabled() const = 0;
+    virtual uint32_t GetImmediateParallelReplayMinOps() const = 0;
+    virtual uint32_t GetImmediateParallelReplayMaxCommandLists() const = 0;
+    virtual PassStatisticsMode GetPassStatisticsMode() const = 0;
+    virtual uint32_t GetPassStatisticsSampledPassesPerFrame() const = 0;
+    virtual bool GetExportTracyGpuZones() const = 0;
+    virtual uint32_t GetPipelineStatisticsSampleIntervalFrames() const = 0;
+    virtual uint32_t GetPipelineStatisticsSampledPassesPerFrame() const = 0;
+    virtual bool GetResidencyEvictionEnabled() const = 0;
+    virtual uint32_t GetResidencyEvictionIdleFrames() const = 0;
+    virtual float GetResidencyBudgetPressureThreshold() const = 0;
+    virtual uint64_t GetTextureRecyclePoolMaxBytes() const = 0;
+    virtual uint32_t GetTextureRecyclePoolMaxIdleFrames() const = 0;
+    virtual bool GetTrackedAllocationEntityBatchingEnabled() const = 0;
+    virtual bool GetBackgroundMaterializationEnabled() const = 0;
+    virtual bool GetParallelTaskServiceEnabled() const = 0;
+    virtual bool GetBackgroundDeletionEnabled() const = 0;
+    virtual uint32_t GetBackgroundDeletionMaxQueuedBatches() const = 0;
     virtual bool GetHeavyDebug() const = 0;
 };
 
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Render/Runtime/ITaskService.h"
+
+namespace rg::runtime {
+
+enum class ShaderTarget : uint8_t {
+    DXIL,
+    SPIRV,
+};
+
+enum class ShaderStage : uint8_t {
+    FromAttribute, // The entry point carries [shader("...")]
+    Vertex,
+    Pixel,
+    Geometry,
+    Hull,
+    Domain,
+    Compute,
+    Amplification,
+    Mesh,
+};
+
+// One Slang entry point to compile. The cache key covers every field below plus the compiler
+// build tag; files the source imports or includes are not read, so callers fold their contents
+// into dependencyHash when they can change.
+struct ShaderCompileRequest {
+    std::string source;
+    std::string modulePath;   // Module name for diagnostics and relative imports, e.g. "Passes/Bloom.slang"
+    std::string entryPoint = "main";
+    ShaderStage stage = ShaderStage::FromAttribute;
+    ShaderTarget target = ShaderTarget::DXIL;
+    std::string profile = "sm_6_6";
+    std::vector<std::pair<std::string, std::string>> defines;
+    std::vector<std::string> searchPaths;
+    uint64_t dependencyHash = 0;
+};
+
+// Content address of a compile: a 128-bit hash of the request and the compiler build tag.
+struct ShaderCacheKey {
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+
+    friend bool operator==(const ShaderCacheKey&, const ShaderCacheKey&) = default;
+
+    struct Hasher {
+        size_t operator()(const ShaderCacheKey& key) const noexcept { return static_cast<size_t>(key.lo); }
+    };
+};
+
+struct CompiledShader {
+    bool succeeded = false;
+    bool fromDisk = false;            // Loaded from the disk cache rather than compiled by this process
+    ShaderCacheKey key{};
+    std::vector<std::byte> bytecode;
+    std::string reflectionJson;       // slang::ProgramLayout::toJson of the linked program
+    std::string diagnostics;
+};
+
+struct ShaderCompileStats {
+    uint64_t requests = 0;
+    uint64_t memoryHits = 0;
+    uint64_t diskHits = 0;
+    uint64_t compiled = 0;
+    uint64_t failed = 0;
+    double compileMsTotal = 0.0;      // Summed over workers, so larger than wall time for batches
+};
+
+// Compiles Slang shaders at runtime behind a content-addressed cache: results are kept in memory
+// and, with a cache directory, one file per key on disk, so a warm start compiles nothing.
+// Failed compiles are never cached.
+class IShaderCompileService {
+public:
+    virtual ~IShaderCompileService() = default;
+
+    // Batches compile their misses on the task service's workers; without one they run in order.
+    virtual void SetTaskService(std::shared_ptr<ITaskService> service) = 0;
+    // Empty disables the disk cache. The directory is created on the first store.
+    virtual void SetCacheDirectory(std::filesystem::path directory) = 0;
+
+    virtual ShaderCacheKey ComputeKey(const ShaderCompileRequest& request) const = 0;
+
+    // Thread-safe; may be called from pass Setup or from a pipeline compile job.
+    virtual std::shared_ptr<const CompiledShader> Compile(const ShaderCompileRequest& request) = 0;
+    // Results in request order. Duplicate requests compile once; distinct misses compile in
+    // parallel, so a pass with several shaders should submit them together.
+    virtual std::vector<std::shared_ptr<const CompiledShader>> CompileBatch(std::span<const ShaderCompileRequest> requests) = 0;
+
+    // Drops the in-memory cache; disk files stay valid because their keys are content addresses.
+    virtual void ClearMemoryCache() = 0;
+
+    virtual ShaderCompileStats GetStats() const = 0;
+};
+
+std::shared_ptr<IShaderCompileService> CreateDefaultShaderCompileService();
+
+}
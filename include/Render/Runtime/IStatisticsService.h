@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <span>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -9,6 +10,7 @@
 
 #include <rhi.h>
 
+#include "Render/PassId.h"
 #include "Render/Runtime/StatisticsTypes.h"
 
 namespace rg::runtime {
@@ -21,7 +23,8 @@ public:
     virtual void BeginFrame() = 0;
     virtual void ClearAll() = 0;
 
-    virtual unsigned RegisterPass(const std::string& passName, bool isGeometryPass, std::string_view techniquePath = {}) = 0;
+    // Statistics are indexed by passId.index; the name is kept for display only.
+    virtual void RegisterPass(PassId passId, std::string_view passName, bool isGeometryPass, std::string_view techniquePath = {}) = 0;
     virtual void RegisterQueue(rhi::QueueKind queueKind) = 0;
     virtual void SetupQueryHeap() = 0;
 
@@ -38,10 +41,27 @@ public:
     virtual void ResolveQueries(unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx) = 0;
     virtual void MergePendingResolves(rhi::QueueKind queueKind, unsigned frameIndex, QueryRecordingContext& ctx) = 0;
 
+    // Timestamps around one queue slot's part of a batch. Begin goes on its first command list,
+    // End on its last, before ResolveQueries.
+    virtual void BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList) = 0;
+    virtual void EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList) = 0;
+    virtual void BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx) = 0;
+    virtual void EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx) = 0;
+    // Cross-queue waits and completion signal of a batch entry, exported as markers next to its
+    // timestamps on the Tracy GPU timeline. Safe to call from recording tasks for distinct entries.
+    virtual void SetBatchQueueSync(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, std::span<const BatchQueueWait> waits, uint64_t signalValue) = 0;
+
+    // Frame timeline capture to a Chrome trace-event JSON file, written on a background thread.
+    // At most maxQueuedFrames frames wait to be written; frames beyond that are dropped.
+    virtual bool StartFrameTrace(const std::string& path, uint32_t maxQueuedFrames = 8) = 0;
+    virtual void StopFrameTrace() = 0;
+    virtual bool IsFrameTraceActive() const = 0;
+
     virtual const std::vector<std::string>& GetPassNames() const = 0;
     virtual const std::vector<std::string>& GetPassTechniquePaths() const = 0;
     virtual const std::vector<PassStats>& GetPassStats() const = 0;
     virtual const std::vector<MeshPipelineStats>& GetMeshStats() const = 0;
+    virtual const std::vector<BatchQueueStats>& GetBatchStats() const = 0; // Indexed by BatchQueueStatsIndex
     virtual MemoryBudgetStats GetMemoryBudgetStats() const = 0;
     virtual const std::vector<bool>& GetIsGeometryPassVector() const = 0;
     virtual const std::vector<unsigned>& GetVisiblePassIndices(uint64_t maxStaleFrames) const = 0;
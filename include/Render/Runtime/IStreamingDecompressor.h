@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+
+#include "Render/Runtime/StreamingUploadTypes.h"
+
+struct PassExecutionContext;
+
+namespace rg::runtime {
+
+// GPU decoder for one codec of compressed streaming uploads. The library ships no codecs: the
+// application registers one per codec ID with IUploadService::RegisterStreamingDecompressor, and
+// StreamingDecompressionPass hands it that frame's jobs.
+class IStreamingDecompressor {
+public:
+    virtual ~IStreamingDecompressor() = default;
+
+    virtual uint32_t GetCodec() const = 0;
+
+    // Called from the pass's Setup; create pipelines here.
+    virtual void Setup() {}
+
+    // Record the dispatches that expand `jobs`. Destinations are already in UAV state; sources are
+    // upload-heap ranges that stay valid until the copy-queue region holding them retires.
+    virtual void Record(PassExecutionContext& context, std::span<const StreamingDecompressionJob> jobs) = 0;
+};
+
+}
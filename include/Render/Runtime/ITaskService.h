@@ -1,20 +1,85 @@
 #pragma once
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string_view>
+#include <type_traits>
 
 namespace rg::runtime {
 
+struct TaskRangeOptions {
+    size_t grainSize = 0;        // Items per chunk; 0 lets the service pick from itemCount and worker count
+    uint32_t maxWorkers = 0;     // Caps participating threads, including the caller (0 = all)
+    bool stableAffinity = true;  // Seed each worker with the same contiguous share on every call
+};
+
+// Non-owning view of a range body, so ParallelForChunked can reach the service without
+// allocating a std::function. Only valid for the duration of the call it is passed to.
+struct TaskRangeBody {
+    void* context = nullptr;
+    void (*invoke)(void* context, size_t begin, size_t end) = nullptr;
+
+    void operator()(size_t begin, size_t end) const { invoke(context, begin, end); }
+};
+
 class ITaskService {
 public:
     virtual ~ITaskService() = default;
 
     virtual void ParallelFor(std::string_view taskName, size_t itemCount, std::function<void(size_t)> func) = 0;
 
+    // Runs body over [0, itemCount) split into chunks of contiguous items. The default forwards
+    // one ParallelFor item per chunk so existing services keep working unchanged.
+    virtual void ParallelForRange(std::string_view taskName, size_t itemCount, const TaskRangeOptions& options, TaskRangeBody body) {
+        if (itemCount == 0) {
+            return;
+        }
+        const size_t grain = std::max<size_t>(1, options.grainSize);
+        const size_t chunkCount = (itemCount + grain - 1) / grain;
+        ParallelFor(taskName, chunkCount, [&](size_t chunk) {
+            const size_t begin = chunk * grain;
+            body(begin, std::min(itemCount, begin + grain));
+        });
+    }
+
+    // Templated fast path: body(begin, end) is called in place, with no type erasure beyond a
+    // function pointer.
+    template<class F>
+    void ParallelForChunked(std::string_view taskName, size_t itemCount, const TaskRangeOptions& options, F&& body) {
+        using Body = std::remove_reference_t<F>;
+        Body* bodyPtr = std::addressof(body);
+        ParallelForRange(taskName, itemCount, options, TaskRangeBody{
+            const_cast<void*>(static_cast<const void*>(bodyPtr)),
+            [](void* context, size_t begin, size_t end) { (*static_cast<Body*>(context))(begin, end); } });
+    }
+
+    // Fire-and-forget work that must not block the caller or the frame (pipeline compiles). The
+    // default runs the job inline, so services without background threads stay correct, only
+    // synchronous. Jobs may call ParallelFor; on the default service that runs inline.
+    virtual void SubmitBackground(std::string_view taskName, std::function<void()> job) {
+        (void)taskName;
+        job();
+    }
+
+    // Blocks until every job submitted through SubmitBackground so far has run, including jobs
+    // those jobs submit. Called before a service is swapped out, so nothing it still holds is
+    // lost. Must not be called from a background job. Inline services have nothing to wait for.
+    virtual void WaitForBackgroundIdle() {}
+
     // Optional telemetry hook — default is a no-op.
     virtual void ReportTaskTelemetry(std::string_view /*name*/, uint64_t /*durationMicros*/) {}
 };
 
+// Work-stealing pool: per-worker chunk ranges that owners pop from the front and idle workers
+// split from the back. workerCount counts background threads; 0 uses hardware_concurrency - 1,
+// the calling thread always participates.
+std::shared_ptr<ITaskService> CreateDefaultTaskService(uint32_t workerCount = 0);
+
+// ParallelFor runs on the calling thread; only SubmitBackground gets a thread. The graph's default
+// unless OpenRenderGraphSettings::parallelTaskServiceEnabled is set.
+std::shared_ptr<ITaskService> CreateSerialTaskService();
+
 }
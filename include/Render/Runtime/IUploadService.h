@@ -11,9 +11,13 @@
 #include "Render/ResourceRegistry.h"
 #include "Render/Runtime/UploadTypes.h"
 #include "Render/Runtime/StreamingUploadTypes.h"
+#include "Render/Runtime/ITaskService.h"
+#include "Render/Runtime/IStreamingDecompressor.h"
+#include "Render/Runtime/IMipGenerator.h"
 
 class ResourceRegistry;
 class RenderPass;
+class CopyPass;
 class Resource;
 
 namespace rg::runtime {
@@ -25,6 +29,11 @@ public:
     virtual void Initialize() = 0;
     virtual void SetUploadResolveContext(UploadResolveContext context) = 0;
     virtual std::shared_ptr<RenderPass> GetUploadPass() const = 0;
+    // Copy-queue pass for resource copies of at least resourceCopyQueueMinBytes; null while
+    // that setting is 0. Add it ahead of the upload pass.
+    virtual std::shared_ptr<CopyPass> GetResourceCopyPass() = 0;
+    // Used to split large UploadData copies across workers (uploadParallelCopyThresholdBytes).
+    virtual void SetTaskService(std::shared_ptr<ITaskService> taskService) = 0;
 
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
     virtual void UploadData(const void* data, size_t size, UploadTarget resourceToUpdate, size_t dataBufferOffset, const char* file, int line) = 0;
@@ -54,15 +63,66 @@ public:
         uint32_t srcCount) = 0;
 #endif
 
+    // Zero-copy buffer upload: write the payload straight into the returned upload-page window,
+    // then CommitUpload queues the copy. See UploadReservation for the lifetime rules.
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+    virtual UploadReservation ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size, const char* file, int line) = 0;
+#else
+    virtual UploadReservation ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size) = 0;
+#endif
+    virtual void CommitUpload(UploadReservation&& reservation) = 0;
+
     virtual void QueueResourceCopy(const std::shared_ptr<Resource>& destination, const std::shared_ptr<Resource>& source, size_t size) = 0;
     virtual void ProcessDeferredReleases(uint8_t frameIndex) = 0;
 
     // ── Streaming upload (copy-queue path) ──────────────────────────
     virtual void QueueStreamingUpload(const void* data, size_t size,
                                       std::shared_ptr<Resource> destination,
-                                      size_t dstOffset = 0) = 0;
+                                      size_t dstOffset = 0,
+                                      StreamingUploadPriority priority = StreamingUploadPriority::Normal) = 0;
+    virtual void QueueStreamingTextureUpload(std::shared_ptr<Resource> destination,
+                                             rhi::Format fmt,
+                                             uint32_t baseWidth,
+                                             uint32_t baseHeight,
+                                             uint32_t depthOrLayers,
+                                             uint32_t mipLevels,
+                                             uint32_t arraySize,
+                                             const rhi::helpers::SubresourceData* srcSubresources,
+                                             uint32_t srcCount,
+                                             StreamingUploadPriority priority = StreamingUploadPriority::Normal) = 0;
+    // File-backed streaming: reads straight into upload pages, see StreamingUploadTicket.
+    virtual std::shared_ptr<StreamingUploadTicket> QueueStreamingFileUpload(
+        const StreamingFileSource& source,
+        std::shared_ptr<Resource> destination,
+        size_t dstOffset = 0,
+        StreamingUploadPriority priority = StreamingUploadPriority::Normal) = 0;
+    virtual std::shared_ptr<StreamingUploadTicket> QueueStreamingFileTextureUpload(
+        const StreamingFileSource& source,
+        std::shared_ptr<Resource> destination,
+        std::vector<StreamingTextureFootprint> footprints,
+        StreamingUploadPriority priority = StreamingUploadPriority::Normal) = 0;
     virtual std::vector<StreamingUploadDescriptor> ConsumeStreamingUploads() = 0;
+    virtual StreamingUploadStats GetStreamingUploadStats() const = 0;
+    virtual void CloseStreamingUploadRegion(uint64_t copyFenceValue) = 0;
+    virtual void ReclaimStreamingPagePool(uint64_t completedCopyFenceValue) = 0;
     virtual void ResetStreamingPagePool() = 0;
+    // GPU decompression: compressed chunks are expanded by an application-registered decoder.
+    virtual void RegisterStreamingDecompressor(std::shared_ptr<IStreamingDecompressor> decompressor) = 0;
+    virtual void QueueStreamingCompressedUpload(uint32_t codec,
+                                                const void* data, size_t compressedSize, size_t uncompressedSize,
+                                                std::shared_ptr<Resource> destination, size_t dstOffset = 0) = 0;
+    virtual std::vector<StreamingDecompressionJob> ConsumeStreamingDecompressionJobs() = 0;
+    virtual std::vector<std::shared_ptr<IStreamingDecompressor>> GetStreamingDecompressors() const = 0;
+    virtual StreamingDecompressionStats GetStreamingDecompressionStats() const = 0;
+    // GPU mip generation: mips below sourceMip are built by an application-registered
+    // downsampler, in MipGenerationPasses recorded after the upload pass. UINT32_MAX counts extend
+    // to the end of the chain or array. See TEXTURE_UPLOAD_GENERATE_MIPS for the upload option.
+    virtual void RegisterMipGenerator(std::shared_ptr<IMipGenerator> generator) = 0;
+    virtual void QueueMipGeneration(UploadTarget target,
+                                    uint32_t sourceMip = 0, uint32_t mipCount = UINT32_MAX,
+                                    uint32_t firstSlice = 0, uint32_t sliceCount = UINT32_MAX) = 0;
+    virtual std::vector<MipGenerationJob> ConsumeMipGenerationJobs() = 0;
+    virtual std::shared_ptr<IMipGenerator> GetMipGenerator() const = 0;
 
     virtual void Cleanup() = 0;
 };
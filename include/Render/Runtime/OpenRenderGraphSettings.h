@@ -1,7 +1,9 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 
 namespace rg::runtime {
@@ -19,6 +21,30 @@ enum class TransitionPlacementMode : uint8_t {
     CanonicalThenOptimize,
 };
 
+// How much the upload path records about each queued update. Lean keeps only the global resource
+// ID and resolves names when a queued target is described; Full also looks up the name when the
+// update is queued.
+enum class UploadTelemetryLevel : uint8_t {
+    Lean = 0,
+    Full,
+};
+
+// Where ReadbackCaptureCallbacks run. Inline runs them in ProcessReadbackRequests with a copy of
+// the data; Worker hands them to the readback worker thread with a zero-copy view of the mapped
+// page (ReadbackCaptureResult::mappedData), so the render thread only polls fences.
+enum class ReadbackCallbackDispatch : uint8_t {
+    Inline = 0,
+    Worker,
+};
+
+// What collectPassStatistics times on the GPU. Sampled brackets each batch on each queue slot with
+// timestamps, plus a rotating window of passStatisticsSampledPassesPerFrame passes per frame;
+// AllPasses brackets every pass every frame.
+enum class PassStatisticsMode : uint8_t {
+    Sampled = 0,
+    AllPasses,
+};
+
 struct OpenRenderGraphSettings {
     uint8_t numFramesInFlight = 3;
     bool collectPassStatistics = true;
@@ -27,9 +53,15 @@ struct OpenRenderGraphSettings {
     bool useAsyncCompute = true;
     bool renderGraphCompileDumpEnabled = false;
     bool renderGraphVramDumpEnabled = false;
+    // Minimum time between two dumps of the same kind; dumps are formatted and written off the
+    // render thread, and frames inside the interval skip the capture entirely.
+    uint32_t renderGraphDebugDumpMinIntervalMs = 1000u;
     bool renderGraphBatchTraceEnabled = false;
     bool renderGraphLightweightCompileSummaryEnabled = false;
     bool readOnlyUniformTransitionElisionEnabled = false;
+    // Reads of a resource between two writes (SRV, copy source, indirect argument, ...) all
+    // require the union of their states, so it transitions once rather than at every switch.
+    bool readStateMergingEnabled = false;
     uint8_t autoAliasMode = 2;
     uint8_t autoAliasPackingStrategy = 0;
     bool autoAliasEnableLogging = false;
@@ -52,53 +84,193 @@ struct OpenRenderGraphSettings {
     uint32_t renderGraphRegionMaxPassCount = 0u;
     bool renderGraphRegionDiagnosticsEnabled = false;
     bool renderGraphRegionShadowStrictBatchMatch = false;
+    // ValidateOnly and ShadowReplay run full segment validation every this many frames. Frames in
+    // between validate SegmentsPerFrame cached segments in rotation (0 skips them); an
+    // invalidation found there, or a changed declaration, runs the full validation at once.
+    uint32_t renderGraphRegionValidationIntervalFrames = 1u;
+    uint32_t renderGraphRegionValidationSegmentsPerFrame = 0u;
+    // Cuts region boundaries around passes whose declarations keep changing, so the stable passes
+    // next to them stay replayable. Volatility is the share of recent frames (an average over about
+    // WindowFrames frames) in which the pass's declaration changed; a pass at or above Threshold
+    // is split out until it falls below half of it.
+    bool renderGraphRegionAdaptiveBoundariesEnabled = false;
+    uint32_t renderGraphRegionVolatilityWindowFrames = 32u;
+    float renderGraphRegionVolatilityThreshold = 0.2f;
     uint32_t renderGraphReplaySegmentCacheMaxEntries = 256u;
     uint32_t renderGraphReplaySegmentCacheMaxVariants = 128u;
     uint32_t renderGraphReplaySegmentCacheMaxVariantsPerKey = 32u;
     uint32_t renderGraphReplaySegmentCacheMaxAgeFrames = 0u;
     bool renderGraphReplayRelaxAliasPlacement = true;
+    bool renderGraphIncrementalDependencyGraphEnabled = false;
+    bool renderGraphParallelDependencyGraphEnabled = false;
+    bool queueSchedulingMeasuredCriticalPathEnabled = false;
+    float queueSchedulingCriticalPathWeight = 4.0f;
+    bool queueSchedulingAdaptivePlacementEnabled = false;
+    uint32_t queueSchedulingAdaptivePlacementWindowFrames = 16u;
+    float queueSchedulingAdaptivePlacementHysteresis = 0.03f;
+    // Trials enabling and disabling extra automatic compute and copy queues, using the adaptive
+    // placement window and hysteresis. MaxQueues slots per kind are created at Setup.
+    bool queueSchedulingAdaptiveQueueCountEnabled = false;
+    uint32_t queueSchedulingAdaptiveQueueCountMaxQueues = 2u;
+    float queueSchedulingAdaptiveQueueCountWaitCostUs = 15.0f; // Estimated cost of one cross-queue wait
+    bool renderGraphSplitBarriersEnabled = false;
+    // Buffer barriers in one batch phase, at or above which they are collapsed into a single global
+    // barrier with merged sync and access masks. 0 disables collapsing.
+    uint32_t renderGraphGlobalBufferBarrierThreshold = 0u;
+    bool renderGraphDeadPassCullingEnabled = false;
+    bool renderGraphRenderPassMergingEnabled = false;
+    bool renderGraphStreamingSubmissionEnabled = false;
+    bool renderGraphTransitiveWaitReductionEnabled = true;
+    bool renderGraphCrossFrameOverlapEnabled = false;
+    // Ends each persistent resource's frame in the state its first use asked for in the last two
+    // frames, so the next frame starts without that transition.
+    bool renderGraphCrossFrameEndStatePredictionEnabled = false;
+    // Schedule the passes that feed a present first, signal right after them and hold CPU frame
+    // starts (RenderGraph::WaitForPresentLatencyBudget) until at most this many frames' present
+    // work is still in flight on the GPU.
+    bool renderGraphPresentLatencyModeEnabled = false;
+    uint32_t renderGraphPresentLatencyMaxQueuedFrames = 1u;
+    bool autoAliasPoolBudgetAwareEnabled = false;
+    float autoAliasPoolBudgetPressureThreshold = 0.9f;
+    bool autoAliasSubresourceLifetimesEnabled = false;
+    uint64_t streamingUploadFrameBudgetBytes = 0;
+    bool cpuVisibleDeviceLocalHeapSupported = false;
+    uint64_t cpuVisibleDeviceLocalMaxBufferBytes = 256ull * 1024ull;
+    uint64_t uploadParallelCopyThresholdBytes = 16ull * 1024ull * 1024ull;
+    UploadTelemetryLevel uploadTelemetryLevel = UploadTelemetryLevel::Lean;
+    uint64_t resourceCopyQueueMinBytes = 0;
+    ReadbackCallbackDispatch readbackCallbackDispatch = ReadbackCallbackDispatch::Inline;
+    bool deferShaderVisibleDescriptorWrites = false;
+    uint32_t shaderVisibleDescriptorHeapInitialCapacity = 1000000;
+    uint32_t shaderVisibleDescriptorHeapMaxCapacity = 1000000;
+    // Per-mip and per-slice texture views are written when a compiled pass first declares their
+    // range instead of at materialization. Views reached only through undeclared bindless
+    // indices stay unwritten, so leave this off unless every subresource access is declared.
+    bool lazySubresourceDescriptorViews = false;
+    // Most background jobs each command list pool keeps in flight on the task service to reset
+    // completed allocators and create pairs ahead of the next frame. Read when a queue slot is
+    // registered.
+    uint32_t commandListPoolResetWorkerCount = 2u;
+    bool immediateBytecodeOptimizationEnabled = true;
+    uint32_t immediateParallelReplayMinOps = 0;
+    uint32_t immediateParallelReplayMaxCommandLists = 4;
+    PassStatisticsMode passStatisticsMode = PassStatisticsMode::Sampled;
+    uint32_t passStatisticsSampledPassesPerFrame = 8;
+    bool exportTracyGpuZones = true;
+    uint32_t pipelineStatisticsSampleIntervalFrames = 1u;
+    uint32_t pipelineStatisticsSampledPassesPerFrame = 0u;
+    bool residencyEvictionEnabled = false;
+    uint32_t residencyEvictionIdleFrames = 60u;
+    float residencyBudgetPressureThreshold = 0.9f;
+    // Retired committed texture backings kept for reuse by a matching Materialize; 0 disables.
+    uint64_t textureRecyclePoolMaxBytes = 0;
+    uint32_t textureRecyclePoolMaxIdleFrames = 60u;
+    // Create tracked-allocation ECS entities in one deferred batch per frame instead of per allocation.
+    bool trackedAllocationEntityBatchingEnabled = false;
+    bool backgroundMaterializationEnabled = false;
+    // With no injected ITaskService, run the graph's ParallelFor stages on the built-in
+    // work-stealing pool. Off, they run on the calling thread. Read when the graph is constructed.
+    bool parallelTaskServiceEnabled = false;
+    // Destroy retired API objects and allocations on a low-priority thread instead of in
+    // ProcessDeletions. Past the queue bound, retired batches are destroyed inline again.
+    bool backgroundDeletionEnabled = false;
+    uint32_t backgroundDeletionMaxQueuedBatches = 16u;
     bool heavyDebug = false;
 };
 
+// An immutable copy of the settings. Every SetOpenRenderGraphSettings publishes a new snapshot
+// with the next generation, so a cache can keep the generation it was built against and compare.
+struct OpenRenderGraphSettingsSnapshot {
+    OpenRenderGraphSettings settings;
+    uint64_t generation = 0;
+};
+
 namespace detail {
+// `current` owns the latest snapshot and `generation` mirrors its generation, so readers only
+// touch the shared pointer when it has changed. Each reader thread pins the snapshot it last
+// returned and the one before it; a superseded snapshot is freed once no thread pins it.
 struct OpenRenderGraphSettingsState {
-    std::mutex mutex;
-    OpenRenderGraphSettings settings;
+    std::mutex writerMutex;
+    std::atomic<std::shared_ptr<const OpenRenderGraphSettingsSnapshot>> current{ std::make_shared<const OpenRenderGraphSettingsSnapshot>() };
+    std::atomic<uint64_t> generation{ 0 };
 };
 
 inline OpenRenderGraphSettingsState& GetOpenRenderGraphSettingsState() {
     static OpenRenderGraphSettingsState state;
     return state;
 }
+
+struct OpenRenderGraphSettingsPin {
+    std::shared_ptr<const OpenRenderGraphSettingsSnapshot> current;
+    std::shared_ptr<const OpenRenderGraphSettingsSnapshot> previous;
+};
 }
 
 inline void SetOpenRenderGraphSettings(const OpenRenderGraphSettings& settings) {
-    auto& state = detail::GetOpenRenderGraphSettingsState();
-    std::scoped_lock lock(state.mutex);
-    state.settings = settings;
-    state.settings.numFramesInFlight = (std::max)(uint8_t{ 1 }, state.settings.numFramesInFlight);
-    state.settings.queueSchedulingWidthScale = (std::max)(0.0f, state.settings.queueSchedulingWidthScale);
-    state.settings.queueSchedulingMinPenalty = (std::max)(0.0f, state.settings.queueSchedulingMinPenalty);
-    state.settings.queueSchedulingResourcePressureWeight = (std::max)(0.0f, state.settings.queueSchedulingResourcePressureWeight);
-    state.settings.queueSchedulingUavPressureWeight = (std::max)(0.0f, state.settings.queueSchedulingUavPressureWeight);
-    state.settings.queueSchedulingAutoGraphicsBias = (std::max)(0.0f, state.settings.queueSchedulingAutoGraphicsBias);
-    state.settings.queueSchedulingAsyncOverlapBonus = (std::max)(0.0f, state.settings.queueSchedulingAsyncOverlapBonus);
-    state.settings.queueSchedulingCrossQueueHandoffPenalty = (std::max)(0.0f, state.settings.queueSchedulingCrossQueueHandoffPenalty);
-    state.settings.autoAliasPoolRetireIdleFrames = (std::max)(1u, state.settings.autoAliasPoolRetireIdleFrames);
-    state.settings.autoAliasPoolGrowthHeadroom = (std::max)(1.0f, state.settings.autoAliasPoolGrowthHeadroom);
-    state.settings.renderGraphRegionMinPassCount = (std::max)(1u, state.settings.renderGraphRegionMinPassCount);
-    if (state.settings.renderGraphRegionMaxPassCount != 0u) {
-        state.settings.renderGraphRegionMaxPassCount = (std::max)(1u, state.settings.renderGraphRegionMaxPassCount);
+    auto next = std::make_unique<OpenRenderGraphSettingsSnapshot>();
+    next->settings = settings;
+    next->settings.numFramesInFlight = (std::max)(uint8_t{ 1 }, next->settings.numFramesInFlight);
+    next->settings.queueSchedulingWidthScale = (std::max)(0.0f, next->settings.queueSchedulingWidthScale);
+    next->settings.queueSchedulingMinPenalty = (std::max)(0.0f, next->settings.queueSchedulingMinPenalty);
+    next->settings.queueSchedulingResourcePressureWeight = (std::max)(0.0f, next->settings.queueSchedulingResourcePressureWeight);
+    next->settings.queueSchedulingUavPressureWeight = (std::max)(0.0f, next->settings.queueSchedulingUavPressureWeight);
+    next->settings.queueSchedulingAutoGraphicsBias = (std::max)(0.0f, next->settings.queueSchedulingAutoGraphicsBias);
+    next->settings.queueSchedulingAsyncOverlapBonus = (std::max)(0.0f, next->settings.queueSchedulingAsyncOverlapBonus);
+    next->settings.queueSchedulingCrossQueueHandoffPenalty = (std::max)(0.0f, next->settings.queueSchedulingCrossQueueHandoffPenalty);
+    next->settings.queueSchedulingCriticalPathWeight = (std::max)(0.0f, next->settings.queueSchedulingCriticalPathWeight);
+    next->settings.queueSchedulingAdaptivePlacementWindowFrames = (std::max)(2u, next->settings.queueSchedulingAdaptivePlacementWindowFrames);
+    next->settings.queueSchedulingAdaptivePlacementHysteresis = (std::max)(0.0f, next->settings.queueSchedulingAdaptivePlacementHysteresis);
+    next->settings.queueSchedulingAdaptiveQueueCountMaxQueues = std::clamp(next->settings.queueSchedulingAdaptiveQueueCountMaxQueues, 1u, 4u);
+    next->settings.queueSchedulingAdaptiveQueueCountWaitCostUs = (std::max)(0.0f, next->settings.queueSchedulingAdaptiveQueueCountWaitCostUs);
+    next->settings.autoAliasPoolRetireIdleFrames = (std::max)(1u, next->settings.autoAliasPoolRetireIdleFrames);
+    next->settings.autoAliasPoolGrowthHeadroom = (std::max)(1.0f, next->settings.autoAliasPoolGrowthHeadroom);
+    next->settings.autoAliasPoolBudgetPressureThreshold = std::clamp(next->settings.autoAliasPoolBudgetPressureThreshold, 0.0f, 1.0f);
+    next->settings.renderGraphRegionMinPassCount = (std::max)(1u, next->settings.renderGraphRegionMinPassCount);
+    next->settings.renderGraphPresentLatencyMaxQueuedFrames = (std::max)(1u, next->settings.renderGraphPresentLatencyMaxQueuedFrames);
+    if (next->settings.renderGraphRegionMaxPassCount != 0u) {
+        next->settings.renderGraphRegionMaxPassCount = (std::max)(1u, next->settings.renderGraphRegionMaxPassCount);
     }
-    state.settings.renderGraphReplaySegmentCacheMaxEntries = (std::max)(1u, state.settings.renderGraphReplaySegmentCacheMaxEntries);
-    state.settings.renderGraphReplaySegmentCacheMaxVariants = (std::max)(1u, state.settings.renderGraphReplaySegmentCacheMaxVariants);
-    state.settings.renderGraphReplaySegmentCacheMaxVariantsPerKey = (std::max)(1u, state.settings.renderGraphReplaySegmentCacheMaxVariantsPerKey);
+    // Evicting only resources idle for longer than the frames in flight keeps eviction clear of
+    // work the GPU may still be running.
+    next->settings.residencyEvictionIdleFrames = (std::max)(uint32_t(next->settings.numFramesInFlight) + 1u, next->settings.residencyEvictionIdleFrames);
+    next->settings.residencyBudgetPressureThreshold = std::clamp(next->settings.residencyBudgetPressureThreshold, 0.0f, 1.0f);
+    next->settings.renderGraphReplaySegmentCacheMaxEntries = (std::max)(1u, next->settings.renderGraphReplaySegmentCacheMaxEntries);
+    next->settings.renderGraphReplaySegmentCacheMaxVariants = (std::max)(1u, next->settings.renderGraphReplaySegmentCacheMaxVariants);
+    next->settings.renderGraphReplaySegmentCacheMaxVariantsPerKey = (std::max)(1u, next->settings.renderGraphReplaySegmentCacheMaxVariantsPerKey);
+
+    auto& state = detail::GetOpenRenderGraphSettingsState();
+    std::scoped_lock lock(state.writerMutex);
+    const uint64_t generation = state.generation.load(std::memory_order_relaxed) + 1;
+    next->generation = generation;
+    state.current.store(std::shared_ptr<const OpenRenderGraphSettingsSnapshot>(std::move(next)), std::memory_order_release);
+    state.generation.store(generation, std::memory_order_release);
+}
+
+// The current snapshot, shared. Hold this to keep one snapshot across calls that may read the
+// settings again.
+inline std::shared_ptr<const OpenRenderGraphSettingsSnapshot> AcquireOpenRenderGraphSettingsSnapshot() {
+    return detail::GetOpenRenderGraphSettingsState().current.load(std::memory_order_acquire);
 }
 
-inline OpenRenderGraphSettings GetOpenRenderGraphSettings() {
+// The current snapshot, pinned by the calling thread. The reference stays valid until this
+// thread has observed two further publishes here, so it is safe within a call but must not be
+// stored; use AcquireOpenRenderGraphSettingsSnapshot for that.
+inline const OpenRenderGraphSettingsSnapshot& GetOpenRenderGraphSettingsSnapshot() {
     auto& state = detail::GetOpenRenderGraphSettingsState();
-    std::scoped_lock lock(state.mutex);
-    return state.settings;
+    thread_local detail::OpenRenderGraphSettingsPin pin;
+    if (!pin.current || pin.current->generation != state.generation.load(std::memory_order_acquire)) {
+        pin.previous = std::move(pin.current);
+        pin.current = state.current.load(std::memory_order_acquire);
+    }
+    return *pin.current;
+}
+
+inline const OpenRenderGraphSettings& GetOpenRenderGraphSettings() {
+    return GetOpenRenderGraphSettingsSnapshot().settings;
+}
+
+inline uint64_t GetOpenRenderGraphSettingsGeneration() {
+    return GetOpenRenderGraphSettingsSnapshot().generation;
 }
 
 }
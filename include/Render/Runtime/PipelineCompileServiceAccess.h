@@ -0,0 +1,41 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include "Render/Runtime/IPipelineCompileService.h"
+
+namespace rg::runtime {
+
+inline IPipelineCompileService*& PipelineCompileServiceSlot() {
+    static IPipelineCompileService* service = nullptr;
+    return service;
+}
+
+inline void SetActivePipelineCompileService(IPipelineCompileService* service) {
+    PipelineCompileServiceSlot() = service;
+}
+
+inline IPipelineCompileService* GetActivePipelineCompileService() {
+    return PipelineCompileServiceSlot();
+}
+
+// Without an active service the pipeline is created inline and returned ready (or failed), so
+// passes can use one code path either way.
+inline std::shared_ptr<PendingPipeline> RequestPipelineDispatch(const PipelineCompileKey& key, std::function<PipelineState()> create) {
+    if (auto* service = GetActivePipelineCompileService()) {
+        return service->RequestPipeline(key, std::move(create));
+    }
+
+    auto pending = std::make_shared<PendingPipeline>();
+    try {
+        pending->Complete(create());
+    }
+    catch (const std::exception& e) {
+        pending->Fail(e.what());
+    }
+    return pending;
+}
+
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Render/Runtime/IShaderCompileService.h"
+
+namespace rg::runtime {
+
+inline IShaderCompileService*& ShaderCompileServiceSlot() {
+    static IShaderCompileService* service = nullptr;
+    return service;
+}
+
+inline void SetActiveShaderCompileService(IShaderCompileService* service) {
+    ShaderCompileServiceSlot() = service;
+}
+
+inline IShaderCompileService* GetActiveShaderCompileService() {
+    return ShaderCompileServiceSlot();
+}
+
+}
@@ -17,6 +17,28 @@ struct PassStats {
     }
 };
 
+// GPU time of one queue slot's part of one batch, from its first command to its last.
+struct BatchQueueStats {
+    double gpuTimeEma = 0.0;
+    uint64_t lastSampleFrame = 0; // Frame serial of the last sample; 0 if never sampled
+};
+
+// Batch timings are kept for the first kStatisticsMaxBatches batches of a frame and the first
+// kStatisticsMaxQueueSlots queue slots, at BatchQueueStatsIndex(batch, slot).
+inline constexpr uint32_t kStatisticsMaxBatches = 64;
+inline constexpr uint32_t kStatisticsMaxQueueSlots = 8;
+
+constexpr uint32_t BatchQueueStatsIndex(uint32_t batchIndex, uint32_t queueSlot) noexcept {
+    return batchIndex * kStatisticsMaxQueueSlots + queueSlot;
+}
+
+// One cross-queue wait of a batch entry: the entry's queue slot waits for srcQueueSlot's fence to
+// reach fenceValue before it runs.
+struct BatchQueueWait {
+    uint32_t srcQueueSlot = 0;
+    uint64_t fenceValue = 0;
+};
+
 struct MeshPipelineStats {
     double invocationsEma = 0.0;
     double primitivesEma = 0.0;
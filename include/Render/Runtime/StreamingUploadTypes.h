@@ -1,18 +1,125 @@
 #pragma once
 
+#include <atomic>
 #include <vector>
 #include <memory>
 #include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+#include <rhi.h>
 
 class Resource;
 
+/// Scheduling order for streaming uploads. Higher priorities are issued first
+/// when the per-frame budget (streamingUploadFrameBudgetBytes) cuts a frame short.
+enum class StreamingUploadPriority : uint8_t {
+    Low = 0,
+    Normal = 1,
+    High = 2,
+    Critical = 3,
+};
+
+/// Tracks one file-backed streaming upload from the disk read to the copy.
+/// Poll IsComplete() with the copy queue's completed fence value; the data is
+/// in the destination once it returns true.
+struct StreamingUploadTicket {
+    enum class State : uint8_t {
+        Reading,    // Disk read in flight
+        Queued,     // In the upload page, waiting for a StreamingUploadPass
+        Submitted,  // Recorded; copyFenceValue is set at the next CloseStreamingUploadRegion
+        Failed,
+    };
+
+    std::atomic<State> state{ State::Reading };
+    std::atomic<uint64_t> copyFenceValue{ 0 };
+    std::atomic<uint32_t> pendingCopies{ 0 };
+
+    bool IsComplete(uint64_t completedCopyFenceValue) const noexcept {
+        const uint64_t fence = copyFenceValue.load(std::memory_order_acquire);
+        return fence != 0 && completedCopyFenceValue >= fence;
+    }
+    bool HasFailed() const noexcept {
+        return state.load(std::memory_order_acquire) == State::Failed;
+    }
+};
+
+/// A byte range of a file to stream from. With a native handle (HANDLE on
+/// Windows, a nonzero file descriptor elsewhere) the path is ignored and the
+/// handle must stay open until the ticket leaves State::Reading.
+struct StreamingFileSource {
+    std::filesystem::path path;
+    void* nativeHandle = nullptr;
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+/// One texture subresource of a file-backed texture upload. The file range
+/// must already be in copyable-footprint layout; footprint.offset is relative
+/// to StreamingFileSource::offset.
+struct StreamingTextureFootprint {
+    uint32_t mip = 0;
+    uint32_t slice = 0;
+    rhi::CopyableFootprint footprint{};
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t z = 0;
+};
+
 /// Descriptor for a single streaming upload operation.
 /// Captured by the UploadManager's streaming path and consumed each frame
 /// by the StreamingUploadPass.
 struct StreamingUploadDescriptor {
+    enum class Kind : uint8_t { Buffer, TextureSubresource };
+
+    Kind kind = Kind::Buffer;
+    StreamingUploadPriority priority = StreamingUploadPriority::Normal;
+    uint64_t sequence = 0;                       // Queue order, assigned by the UploadManager
+    std::shared_ptr<StreamingUploadTicket> ticket; // File-backed uploads only
     std::shared_ptr<Resource> srcUploadBuffer;   // Upload-heap page
     size_t srcOffset = 0;
     std::shared_ptr<Resource> dstResource;       // GPU-local target
     size_t dstOffset = 0;
     size_t size = 0;
+
+    // TextureSubresource only. footprint.offset already includes srcOffset.
+    uint32_t mip = 0;
+    uint32_t slice = 0;
+    rhi::CopyableFootprint footprint{};
+    uint32_t x = 0;
+    uint32_t y = 0;
+    uint32_t z = 0;
+};
+
+/// Result of the last ConsumeStreamingUploads call.
+struct StreamingUploadStats {
+    uint64_t frameBudgetBytes = 0;               // 0 = unlimited
+    uint64_t streamedBytes = 0;
+    uint64_t streamedUploads = 0;
+    uint64_t backlogBytes = 0;                   // Carried over to later frames
+    uint64_t backlogUploads = 0;
+    uint64_t pagePoolResidentBytes = 0;
+};
+
+/// One compressed chunk to be expanded on the GPU by the decompressor
+/// registered for `codec`. The compressed bytes sit in an upload page.
+struct StreamingDecompressionJob {
+    uint32_t codec = 0;
+    std::shared_ptr<Resource> srcUploadBuffer;
+    size_t srcOffset = 0;
+    size_t compressedSize = 0;
+    std::shared_ptr<Resource> dstResource;       // Buffer written as UAV
+    size_t dstOffset = 0;
+    size_t uncompressedSize = 0;
+};
+
+/// Totals for the jobs returned by the last ConsumeStreamingDecompressionJobs
+/// call. cpuStagingMicroseconds is the time spent in
+/// QueueStreamingCompressedUpload since the previous call, to set against
+/// decoding the same bytes on the CPU.
+struct StreamingDecompressionStats {
+    uint64_t jobs = 0;
+    uint64_t compressedBytes = 0;
+    uint64_t uncompressedBytes = 0;
+    uint64_t cpuStagingMicroseconds = 0;
 };
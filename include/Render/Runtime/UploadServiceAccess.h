@@ -40,6 +40,34 @@ inline void UploadBufferDataDispatch(
     throw std::runtime_error("Upload service is not active for BUFFER_UPLOAD");
 }
 
+inline UploadReservation ReserveBufferUploadDispatch(
+    UploadTarget resourceToUpdate,
+    size_t dataBufferOffset,
+    size_t size,
+    const char* file,
+    int line) {
+    if (auto* service = GetActiveUploadService()) {
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+        return service->ReserveUpload(std::move(resourceToUpdate), dataBufferOffset, size, file, line);
+#else
+        (void)file;
+        (void)line;
+        return service->ReserveUpload(std::move(resourceToUpdate), dataBufferOffset, size);
+#endif
+    }
+
+    throw std::runtime_error("Upload service is not active for BUFFER_UPLOAD_RESERVE");
+}
+
+inline void CommitBufferUploadDispatch(UploadReservation&& reservation) {
+    if (auto* service = GetActiveUploadService()) {
+        service->CommitUpload(std::move(reservation));
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for CommitUpload");
+}
+
 inline void UploadTextureSubresourcesDispatch(
     UploadTarget target,
     rhi::Format fmt,
@@ -88,15 +116,69 @@ inline void QueueStreamingUploadDispatch(
     const void* data,
     size_t size,
     std::shared_ptr<Resource> destination,
-    size_t dstOffset = 0) {
+    size_t dstOffset = 0,
+    StreamingUploadPriority priority = StreamingUploadPriority::Normal) {
     if (auto* service = GetActiveUploadService()) {
-        service->QueueStreamingUpload(data, size, std::move(destination), dstOffset);
+        service->QueueStreamingUpload(data, size, std::move(destination), dstOffset, priority);
         return;
     }
 
     throw std::runtime_error("Upload service is not active for QueueStreamingUpload");
 }
 
+inline void QueueStreamingTextureUploadDispatch(
+    std::shared_ptr<Resource> destination,
+    rhi::Format fmt,
+    uint32_t baseWidth,
+    uint32_t baseHeight,
+    uint32_t depthOrLayers,
+    uint32_t mipLevels,
+    uint32_t arraySize,
+    const rhi::helpers::SubresourceData* srcSubresources,
+    uint32_t srcCount,
+    StreamingUploadPriority priority = StreamingUploadPriority::Normal) {
+    if (auto* service = GetActiveUploadService()) {
+        service->QueueStreamingTextureUpload(
+            std::move(destination),
+            fmt,
+            baseWidth,
+            baseHeight,
+            depthOrLayers,
+            mipLevels,
+            arraySize,
+            srcSubresources,
+            srcCount,
+            priority);
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for QueueStreamingTextureUpload");
+}
+
+inline std::shared_ptr<StreamingUploadTicket> QueueStreamingFileUploadDispatch(
+    const StreamingFileSource& source,
+    std::shared_ptr<Resource> destination,
+    size_t dstOffset = 0,
+    StreamingUploadPriority priority = StreamingUploadPriority::Normal) {
+    if (auto* service = GetActiveUploadService()) {
+        return service->QueueStreamingFileUpload(source, std::move(destination), dstOffset, priority);
+    }
+
+    throw std::runtime_error("Upload service is not active for QueueStreamingFileUpload");
+}
+
+inline std::shared_ptr<StreamingUploadTicket> QueueStreamingFileTextureUploadDispatch(
+    const StreamingFileSource& source,
+    std::shared_ptr<Resource> destination,
+    std::vector<StreamingTextureFootprint> footprints,
+    StreamingUploadPriority priority = StreamingUploadPriority::Normal) {
+    if (auto* service = GetActiveUploadService()) {
+        return service->QueueStreamingFileTextureUpload(source, std::move(destination), std::move(footprints), priority);
+    }
+
+    throw std::runtime_error("Upload service is not active for QueueStreamingFileTextureUpload");
+}
+
 inline std::vector<StreamingUploadDescriptor> ConsumeStreamingUploadsDispatch() {
     if (auto* service = GetActiveUploadService()) {
         return service->ConsumeStreamingUploads();
@@ -105,6 +187,32 @@ inline std::vector<StreamingUploadDescriptor> ConsumeStreamingUploadsDispatch()
     throw std::runtime_error("Upload service is not active for ConsumeStreamingUploads");
 }
 
+inline StreamingUploadStats GetStreamingUploadStatsDispatch() {
+    if (auto* service = GetActiveUploadService()) {
+        return service->GetStreamingUploadStats();
+    }
+
+    throw std::runtime_error("Upload service is not active for GetStreamingUploadStats");
+}
+
+inline void CloseStreamingUploadRegionDispatch(uint64_t copyFenceValue) {
+    if (auto* service = GetActiveUploadService()) {
+        service->CloseStreamingUploadRegion(copyFenceValue);
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for CloseStreamingUploadRegion");
+}
+
+inline void ReclaimStreamingPagePoolDispatch(uint64_t completedCopyFenceValue) {
+    if (auto* service = GetActiveUploadService()) {
+        service->ReclaimStreamingPagePool(completedCopyFenceValue);
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for ReclaimStreamingPagePool");
+}
+
 inline void ResetStreamingPagePoolDispatch() {
     if (auto* service = GetActiveUploadService()) {
         service->ResetStreamingPagePool();
@@ -114,16 +222,114 @@ inline void ResetStreamingPagePoolDispatch() {
     throw std::runtime_error("Upload service is not active for ResetStreamingPagePool");
 }
 
+inline void RegisterStreamingDecompressorDispatch(std::shared_ptr<IStreamingDecompressor> decompressor) {
+    if (auto* service = GetActiveUploadService()) {
+        service->RegisterStreamingDecompressor(std::move(decompressor));
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for RegisterStreamingDecompressor");
+}
+
+inline void QueueStreamingCompressedUploadDispatch(
+    uint32_t codec,
+    const void* data,
+    size_t compressedSize,
+    size_t uncompressedSize,
+    std::shared_ptr<Resource> destination,
+    size_t dstOffset = 0) {
+    if (auto* service = GetActiveUploadService()) {
+        service->QueueStreamingCompressedUpload(codec, data, compressedSize, uncompressedSize, std::move(destination), dstOffset);
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for QueueStreamingCompressedUpload");
+}
+
+inline std::vector<StreamingDecompressionJob> ConsumeStreamingDecompressionJobsDispatch() {
+    if (auto* service = GetActiveUploadService()) {
+        return service->ConsumeStreamingDecompressionJobs();
+    }
+
+    throw std::runtime_error("Upload service is not active for ConsumeStreamingDecompressionJobs");
+}
+
+inline std::vector<std::shared_ptr<IStreamingDecompressor>> GetStreamingDecompressorsDispatch() {
+    if (auto* service = GetActiveUploadService()) {
+        return service->GetStreamingDecompressors();
+    }
+
+    throw std::runtime_error("Upload service is not active for GetStreamingDecompressors");
+}
+
+inline StreamingDecompressionStats GetStreamingDecompressionStatsDispatch() {
+    if (auto* service = GetActiveUploadService()) {
+        return service->GetStreamingDecompressionStats();
+    }
+
+    throw std::runtime_error("Upload service is not active for GetStreamingDecompressionStats");
+}
+
+inline void RegisterMipGeneratorDispatch(std::shared_ptr<IMipGenerator> generator) {
+    if (auto* service = GetActiveUploadService()) {
+        service->RegisterMipGenerator(std::move(generator));
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for RegisterMipGenerator");
+}
+
+inline void QueueMipGenerationDispatch(
+    UploadTarget target,
+    uint32_t sourceMip = 0,
+    uint32_t mipCount = UINT32_MAX,
+    uint32_t firstSlice = 0,
+    uint32_t sliceCount = UINT32_MAX) {
+    if (auto* service = GetActiveUploadService()) {
+        service->QueueMipGeneration(std::move(target), sourceMip, mipCount, firstSlice, sliceCount);
+        return;
+    }
+
+    throw std::runtime_error("Upload service is not active for QueueMipGeneration");
+}
+
+// Upload option: copy only mip 0 (one SubresourceData per array slice) and build the rest of the
+// mipLevels chain on the GPU, instead of uploading CPU-generated mips.
+inline void UploadTextureGenerateMipsDispatch(
+    UploadTarget target,
+    rhi::Format fmt,
+    uint32_t baseWidth,
+    uint32_t baseHeight,
+    uint32_t depthOrLayers,
+    uint32_t mipLevels,
+    uint32_t arraySize,
+    const rhi::helpers::SubresourceData* srcSubresources,
+    const char* file,
+    int line) {
+    UploadTextureSubresourcesDispatch(target, fmt, baseWidth, baseHeight, depthOrLayers, /*mipLevels*/1, arraySize, srcSubresources, arraySize, file, line);
+    if (mipLevels > 1) {
+        QueueMipGenerationDispatch(std::move(target), 0, mipLevels - 1, 0, arraySize);
+    }
+}
+
 }
 
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
 #define BUFFER_UPLOAD(data,size,res,offset) \
     rg::runtime::UploadBufferDataDispatch((data),(size),(res),(offset),__FILE__,__LINE__)
+#define BUFFER_UPLOAD_RESERVE(res,offset,size) \
+    rg::runtime::ReserveBufferUploadDispatch((res),(offset),(size),__FILE__,__LINE__)
 #define TEXTURE_UPLOAD_SUBRESOURCES(dstTexture,fmt,baseWidth,baseHeight,depthOrLayers,mipLevels,arraySize,srcSubresources,srcCount) \
 	rg::runtime::UploadTextureSubresourcesDispatch((dstTexture),(fmt),(baseWidth),(baseHeight),(depthOrLayers),(mipLevels),(arraySize),(srcSubresources),(srcCount),__FILE__,__LINE__)
+#define TEXTURE_UPLOAD_GENERATE_MIPS(dstTexture,fmt,baseWidth,baseHeight,depthOrLayers,mipLevels,arraySize,srcSubresources) \
+	rg::runtime::UploadTextureGenerateMipsDispatch((dstTexture),(fmt),(baseWidth),(baseHeight),(depthOrLayers),(mipLevels),(arraySize),(srcSubresources),__FILE__,__LINE__)
 #else
 #define BUFFER_UPLOAD(data,size,res,offset) \
     rg::runtime::UploadBufferDataDispatch((data),(size),(res),(offset),nullptr,0)
+#define BUFFER_UPLOAD_RESERVE(res,offset,size) \
+    rg::runtime::ReserveBufferUploadDispatch((res),(offset),(size),nullptr,0)
 #define TEXTURE_UPLOAD_SUBRESOURCES(dstTexture,fmt,baseWidth,baseHeight,depthOrLayers,mipLevels,arraySize,srcSubresources,srcCount) \
 	rg::runtime::UploadTextureSubresourcesDispatch((dstTexture),(fmt),(baseWidth),(baseHeight),(depthOrLayers),(mipLevels),(arraySize),(srcSubresources),(srcCount),nullptr,0)
+#define TEXTURE_UPLOAD_GENERATE_MIPS(dstTexture,fmt,baseWidth,baseHeight,depthOrLayers,mipLevels,arraySize,srcSubresources) \
+	rg::runtime::UploadTextureGenerateMipsDispatch((dstTexture),(fmt),(baseWidth),(baseHeight),(depthOrLayers),(mipLevels),(arraySize),(srcSubresources),nullptr,0)
 #endif
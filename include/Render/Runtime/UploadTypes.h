@@ -1,6 +1,10 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <span>
+#include <utility>
 
 #include "Render/ResourceRegistry.h"
 
@@ -49,4 +53,43 @@ struct UploadTarget {
     }
 };
 
+// Writable window into a mapped upload page, returned by ReserveUpload. Fill Data() and pass the
+// reservation to CommitUpload before the frame's ProcessDeferredReleases; the copy into `target`
+// is queued only at commit. A reservation that is dropped uncommitted just wastes its bytes until
+// the page retires. Move-only because the page stays mapped until commit.
+struct UploadReservation {
+    UploadReservation() = default;
+    UploadReservation(const UploadReservation&) = delete;
+    UploadReservation& operator=(const UploadReservation&) = delete;
+    UploadReservation(UploadReservation&& other) noexcept { *this = std::move(other); }
+    UploadReservation& operator=(UploadReservation&& other) noexcept {
+        if (this != &other) {
+            data = std::exchange(other.data, nullptr);
+            size = std::exchange(other.size, 0);
+            target = std::move(other.target);
+            dstOffset = other.dstOffset;
+            uploadBuffer = std::move(other.uploadBuffer);
+            uploadOffset = other.uploadOffset;
+            generation = other.generation;
+            file = other.file;
+            line = other.line;
+        }
+        return *this;
+    }
+
+    std::span<std::byte> Data() const noexcept { return { reinterpret_cast<std::byte*>(data), size }; }
+    explicit operator bool() const noexcept { return data != nullptr; }
+
+    // Filled in by the upload service; callers only read Data().
+    uint8_t* data = nullptr;
+    size_t size = 0;
+    UploadTarget target{};
+    size_t dstOffset = 0;
+    std::shared_ptr<Resource> uploadBuffer;
+    size_t uploadOffset = 0;
+    uint64_t generation = 0;
+    const char* file = nullptr;
+    int line = 0;
+};
+
 }
@@ -5,6 +5,10 @@
 namespace rg::shaderapi {
 	inline constexpr uint32_t kResourceDescriptorIndicesRootParameter = 5;
 	inline constexpr uint32_t kNumResourceDescriptorIndicesRootConstants = 64;
+	// BindResourceDescriptorTableSlots layout of the same root constants: [0] is the descriptor
+	// index of the ResourceDescriptorIndexTable buffer, [1 + i] the table slot of binding i.
+	inline constexpr uint32_t kResourceDescriptorTableIndexRootConstant = 0;
+	inline constexpr uint32_t kFirstResourceDescriptorTableSlotRootConstant = 1;
 
 	inline constexpr uint32_t kIndirectCommandSignatureRootParameter = 6;
 	inline constexpr uint32_t kNumIndirectCommandSignatureRootConstants = 4;
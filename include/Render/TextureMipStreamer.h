@@ -0,0 +1,157 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "Render/Runtime/StreamingUploadTypes.h"
+#include "Resources/TextureDescription.h"
+
+class Buffer;
+class DynamicGloballyIndexedResource;
+class PixelBuffer;
+
+namespace rg::runtime {
+	class IReadbackService;
+}
+
+// Feedback-driven mip streaming for file-backed textures. Each registered texture is exposed as a
+// DynamicGloballyIndexedResource whose backing holds only the mips from its resident mip down to
+// the tail. When feedback asks for finer mips the streamer creates a larger PixelBuffer, streams
+// the needed mips into it with QueueStreamingFileTextureUpload and swaps it in once the copy
+// queue has passed the upload's ticket; coarsening works the same way with a smaller one. Normalized
+// coordinates and LOD selection are unaffected by the swap, and descriptor index table slots of
+// the handle follow the new backing.
+//
+// PixelBuffer has no reserved (tiled) mode, so residency changes a whole texture at a time rather
+// than per tile, and the old backing lives until its swap. Sampler feedback is not exposed by the
+// RHI either: feedback is a desired-mip buffer (GetFeedbackBuffer, one uint per TextureID, in
+// full-chain mip levels) that the host's shaders write with InterlockedMin, read back every
+// feedbackIntervalFrames frames through the readback service, and optionally CPU estimates
+// through ReportDesiredMip.
+//
+// Update picks loads by priority (mips missing from the desired level, times priorityBias) under
+// budgetBytes, counting each texture at the size it will have once its pending load lands. When
+// an upgrade does not fit, textures holding finer mips than they want are coarsened first,
+// least recently wanted first; if the budget was lowered, textures above their tail are
+// coarsened one mip at a time.
+//
+// Not thread-safe apart from ReportDesiredMip; call the rest from the thread that drives the frame.
+class TextureMipStreamer {
+public:
+	using TextureID = uint32_t;
+	static constexpr TextureID kInvalidTexture = UINT32_MAX;
+	static constexpr uint32_t kNoFeedback = UINT32_MAX; // Clear value of the feedback buffer
+
+	struct Settings {
+		uint64_t budgetBytes = 512ull * 1024ull * 1024ull;
+		uint32_t maxLoadsInFlight = 8;
+		uint32_t feedbackIntervalFrames = 4;
+		uint32_t evictAfterFrames = 120; // Frames without feedback before a texture wants only its tail
+	};
+
+	struct TextureSource {
+		// Full-chain description; imageDimensions per subresource or the base level only.
+		TextureDescription desc;
+		StreamingFileSource file;
+		// Every (mip, slice) of the full chain, in copyable-footprint layout, offsets relative to
+		// file.offset and 512-byte aligned in the file.
+		std::vector<StreamingTextureFootprint> footprints;
+		uint32_t residentTailMips = 1; // Smallest mips that are always resident
+		float priorityBias = 1.0f;
+	};
+
+	struct UpdateContext {
+		uint64_t frameSerial = 0;
+		uint64_t completedCopyFenceValue = 0; // Of the queue the streaming uploads run on
+		rg::runtime::IReadbackService* readbackService = nullptr;
+		const char* feedbackPassName = nullptr; // Last pass that writes the feedback buffer
+	};
+
+	struct Stats {
+		uint64_t budgetBytes = 0;
+		uint64_t residentBytes = 0;
+		uint64_t projectedBytes = 0;  // Once every pending load has landed
+		uint64_t registeredTextures = 0;
+		uint64_t loadsInFlight = 0;
+		uint64_t loadsStarted = 0;
+		uint64_t loadsCompleted = 0;
+		uint64_t loadsFailed = 0;
+		uint64_t coarsenings = 0;
+		uint64_t upgradesDeferredForBudget = 0;
+		uint64_t feedbackReadbacks = 0;
+	};
+
+	TextureMipStreamer(uint32_t maxTextures, Settings settings);
+	explicit TextureMipStreamer(uint32_t maxTextures) : TextureMipStreamer(maxTextures, Settings{}) {}
+	~TextureMipStreamer();
+
+	TextureMipStreamer(const TextureMipStreamer&) = delete;
+	TextureMipStreamer& operator=(const TextureMipStreamer&) = delete;
+
+	// Creates the tail-only backing and queues its upload. Returns kInvalidTexture when maxTextures
+	// are registered or the source has no footprints.
+	TextureID Register(TextureSource source);
+	void Unregister(TextureID id);
+	std::shared_ptr<DynamicGloballyIndexedResource> GetTexture(TextureID id) const;
+	// Full-chain mip the current backing starts at. The tail's contents are undefined until its
+	// first upload lands.
+	uint32_t GetResidentMip(TextureID id) const;
+
+	// Lowest mip wins until the next Update.
+	void ReportDesiredMip(TextureID id, uint32_t mip);
+	const std::shared_ptr<Buffer>& GetFeedbackBuffer() const { return m_feedbackBuffer; }
+
+	void Update(const UpdateContext& context);
+
+	void SetBudgetBytes(uint64_t budgetBytes) { m_settings.budgetBytes = budgetBytes; }
+	Stats GetStats() const;
+
+private:
+	struct PendingLoad {
+		std::shared_ptr<PixelBuffer> texture;
+		std::shared_ptr<StreamingUploadTicket> ticket;
+		uint32_t mip = 0;
+	};
+
+	struct Entry {
+		bool live = false;
+		TextureSource source;
+		std::shared_ptr<DynamicGloballyIndexedResource> handle;
+		std::vector<uint64_t> bytesFromMip; // Size of a backing that starts at each mip
+		uint32_t mipCount = 1;
+		uint32_t sliceCount = 1;
+		uint32_t tailMip = 0;
+		uint32_t residentMip = 0;
+		uint32_t desiredMip = 0;
+		uint32_t reportedMip = kNoFeedback; // Reports since the last Update
+		uint64_t lastWantedFrame = 0;
+		bool hasPending = false;
+		PendingLoad pending;
+	};
+
+	// Receives feedback readbacks, which may complete on a worker after the streamer is gone.
+	struct FeedbackInbox {
+		std::mutex mutex;
+		std::vector<uint32_t> values;
+		bool ready = false;
+	};
+
+	uint64_t ProjectedBytes(const Entry& entry) const;
+	bool StartLoad(Entry& entry, uint32_t mip, StreamingUploadPriority priority);
+	void RequestFeedbackReadback(const UpdateContext& context);
+
+	Settings m_settings;
+	std::vector<Entry> m_entries; // Indexed by TextureID
+	std::vector<TextureID> m_freeIDs;
+	std::mutex m_reportMutex;
+	std::shared_ptr<Buffer> m_feedbackBuffer;
+	std::shared_ptr<FeedbackInbox> m_feedbackInbox;
+	bool m_feedbackReadbackInFlight = false;
+	uint64_t m_lastFeedbackRequestFrame = 0;
+	uint64_t m_residentBytes = 0;
+	uint64_t m_projectedBytes = 0;
+	uint32_t m_loadsInFlight = 0;
+	Stats m_stats{};
+};
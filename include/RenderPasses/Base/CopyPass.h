@@ -21,6 +21,7 @@
 struct CopyPassParameters {
 	std::vector<ResourceHandleAndRange> copyTargets;
 	std::vector<ResourceHandleAndRange> copySources;
+	std::vector<ResourceHandleAndRange> fullOverwriteResources; // Written in full before any read; see WithFullOverwrite
 	std::vector<std::pair<ResourceHandleAndRange, ResourceState>> internalTransitions;
 	std::vector<ExternalTimelinePoint> externalWaitsBeforeTransitions;
 
@@ -32,6 +33,7 @@ struct CopyPassParameters {
 	QueueKind preferredQueueKind = QueueKind::Copy;
 	QueueAssignmentPolicy queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
 	std::optional<QueueSlotIndex> pinnedQueueSlot; // Target a specific queue slot instead of using preferredQueueKind
+	bool latencyCritical = false; // Prefer High/Realtime priority queue slots; see QueuePriority
 };
 
 class CopyPassBuilder;
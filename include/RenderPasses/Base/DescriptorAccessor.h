@@ -0,0 +1,51 @@
+#pragma once
+
+#include <stdexcept>
+
+#include "Resources/GloballyIndexedResource.h"
+
+enum class DescriptorType {
+	SRV,
+	UAV,
+	CBV
+};
+
+struct DescriptorAccessor {
+	DescriptorType type; // Type of the descriptor (SRV or UAV)
+	bool hasSRVViewType = false; // Indicates if a specific SRVViewType is set
+	SRVViewType SRVType; // Type of the SRV
+	bool hasUAVViewType = false; // Indicates if a specific UAVViewType is set
+	UAVViewType UAVType; // Type of the UAV
+	unsigned int mip; // Mip level
+	unsigned int slice; // Slice index
+};
+
+inline bool operator==(const DescriptorAccessor& lhs, const DescriptorAccessor& rhs) {
+	return lhs.type == rhs.type
+		&& lhs.hasSRVViewType == rhs.hasSRVViewType
+		&& (!lhs.hasSRVViewType || lhs.SRVType == rhs.SRVType)
+		&& lhs.hasUAVViewType == rhs.hasUAVViewType
+		&& (!lhs.hasUAVViewType || lhs.UAVType == rhs.UAVType)
+		&& lhs.mip == rhs.mip
+		&& lhs.slice == rhs.slice;
+}
+
+// Shader-visible heap index of the view the accessor names.
+inline unsigned int ResolveDescriptorIndex(const GloballyIndexedResource& resource, const DescriptorAccessor& accessor) {
+	switch (accessor.type) {
+	case DescriptorType::SRV:
+		if (accessor.hasSRVViewType) {
+			return resource.GetSRVInfo(accessor.SRVType, accessor.mip, accessor.slice).slot.index;
+		}
+		return resource.GetSRVInfo(accessor.mip, accessor.slice).slot.index;
+	case DescriptorType::UAV:
+		if (accessor.hasUAVViewType) {
+			return resource.GetUAVShaderVisibleInfo(accessor.UAVType, accessor.mip, accessor.slice).slot.index;
+		}
+		return resource.GetUAVShaderVisibleInfo(accessor.mip, accessor.slice).slot.index;
+	case DescriptorType::CBV:
+		return resource.GetCBVInfo().slot.index;
+	default:
+		throw std::runtime_error("Unsupported descriptor type");
+	}
+}
@@ -18,6 +18,7 @@
 #include "Render/FeatureDomainRegistry.h"
 #include "Render/ShaderAPI.h"
 #include "Render/QueueKind.h"
+#include "Render/PassPredication.h"
 
 struct RenderPassParameters {
 	std::vector<ResourceHandleAndRange> shaderResources;
@@ -34,14 +35,17 @@ struct RenderPassParameters {
 	std::vector<ResourceHandleAndRange> indirectArgumentBuffers;
 	std::vector<ResourceHandleAndRange> presentResources;
 	std::vector<ResourceHandleAndRange> legacyInteropResources;
+	std::vector<ResourceHandleAndRange> fullOverwriteResources; // Written in full before any read; see WithFullOverwrite
 	std::vector<std::pair<ResourceHandleAndRange, ResourceState>> internalTransitions;
 	std::vector<ExternalTimelinePoint> externalWaitsBeforeTransitions;
+	std::optional<PassPredication> predication;
 
 	std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher> identifierSet;
 	std::vector<AutoDescriptorRegistration> autoDescriptorShaderResources;
 	std::vector<AutoDescriptorRegistration> autoDescriptorConstantBuffers;
 	std::vector<AutoDescriptorRegistration> autoDescriptorUnorderedAccessViews;
 	std::unordered_set<FeatureDomainIdentifier, FeatureDomainIdentifier::Hasher> activeFeatureDomains;
+	std::vector<FeatureDomainIdentifier> memberFeatureDomains; // Pass is dropped from the frame while any is disabled
 	std::vector<ResourceRequirement> staticResourceRequirements; // Static resource requirements for the pass
 	std::vector<ResourceRequirement> frameResourceRequirements; // Immediate-mode requirements recorded for this frame
 	mutable std::vector<ResourceRequirement> mergedFrameResourceRequirements; // Lazily built static + immediate requirements when a contiguous view is needed
@@ -50,6 +54,8 @@ struct RenderPassParameters {
 	QueueKind preferredQueueKind = QueueKind::Graphics;
 	QueueAssignmentPolicy queueAssignmentPolicy = QueueAssignmentPolicy::ForcePreferred;
 	std::optional<QueueSlotIndex> pinnedQueueSlot; // Target a specific queue slot instead of using preferredQueueKind
+	bool latencyCritical = false; // Prefer High/Realtime priority queue slots; see QueuePriority
+	std::vector<TransientUploadDecl> transientUploads;
 };
 
 class RenderPassBuilder;
@@ -112,6 +118,21 @@ protected:
 		}
 	}
 
+	// Table variant for shaders that read indices from the ResourceDescriptorIndexTable: pushes the
+	// table's descriptor index and the bindings' stable slots instead of resolving every binding.
+	void BindResourceDescriptorTableSlots(rhi::CommandList& commandList, const PipelineResources& resources) {
+		const auto slots = m_resourceDescriptorIndexHelper->GetPackedDescriptorTableSlots(resources);
+		auto* table = m_resourceRegistryView->GetDescriptorIndexTable();
+		if (!table || slots.size() + rg::shaderapi::kFirstResourceDescriptorTableSlotRootConstant > rg::shaderapi::kNumResourceDescriptorIndicesRootConstants) {
+			throw std::runtime_error("Descriptor index table is unavailable or the pipeline has too many bindings");
+		}
+		const uint32_t tableIndex = table->GetTableDescriptorIndex();
+		commandList.PushConstants(rhi::ShaderStage::All, 0, rg::shaderapi::kResourceDescriptorIndicesRootParameter, rg::shaderapi::kResourceDescriptorTableIndexRootConstant, 1, &tableIndex);
+		if (!slots.empty()) {
+			commandList.PushConstants(rhi::ShaderStage::All, 0, rg::shaderapi::kResourceDescriptorIndicesRootParameter, rg::shaderapi::kFirstResourceDescriptorTableSlotRootConstant, static_cast<uint32_t>(slots.size()), slots.data());
+		}
+	}
+
 	void RegisterSRV(SRVViewType type, ResourceIdentifier id, unsigned int mip = 0, unsigned int slice = 0) {
 		m_resourceDescriptorIndexHelper->RegisterSRV(type, id, mip, slice);
 	}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <sstream>
 #include <unordered_map>
 #include <unordered_set>
@@ -8,8 +9,11 @@
 #include <spdlog/spdlog.h>
 
 #include "Resources/DynamicResource.h"
+#include "RenderPasses/Base/DescriptorAccessor.h"
 #include "Render/FeatureDomainRegistry.h"
+#include "Render/PipelineState.h"
 #include "Render/ResourceRegistry.h"
+#include "Render/ResourceDescriptorIndexTable.h"
 
 class ResourceIndexOrDynamicResource {
 public:
@@ -26,32 +30,6 @@ public:
 };
 
 
-enum class DescriptorType {
-	SRV,
-	UAV,
-	CBV
-};
-
-struct DescriptorAccessor {
-	DescriptorType type; // Type of the descriptor (SRV or UAV)
-	bool hasSRVViewType = false; // Indicates if a specific SRVViewType is set
-	SRVViewType SRVType; // Type of the SRV
-	bool hasUAVViewType = false; // Indicates if a specific UAVViewType is set
-	UAVViewType UAVType; // Type of the UAV
-	unsigned int mip; // Mip level
-	unsigned int slice; // Slice index
-};
-
-inline bool operator==(const DescriptorAccessor& lhs, const DescriptorAccessor& rhs) {
-	return lhs.type == rhs.type
-		&& lhs.hasSRVViewType == rhs.hasSRVViewType
-		&& (!lhs.hasSRVViewType || lhs.SRVType == rhs.SRVType)
-		&& lhs.hasUAVViewType == rhs.hasUAVViewType
-		&& (!lhs.hasUAVViewType || lhs.UAVType == rhs.UAVType)
-		&& lhs.mip == rhs.mip
-		&& lhs.slice == rhs.slice;
-}
-
 struct AutoDescriptorRegistration {
 	ResourceIdentifier resourceId;
 	DescriptorAccessor accessor;
@@ -64,6 +42,7 @@ inline bool operator==(const AutoDescriptorRegistration& lhs, const AutoDescript
 struct ResourceAndAccessor {
 	ResourceIndexOrDynamicResource resource;
 	DescriptorAccessor accessor; // Accessor for the descriptor
+	uint32_t tableSlot = ResourceDescriptorIndexTable::kInvalidSlot; // Slot in the graph's descriptor index table, if any
 };
 
 class ResourceDescriptorIndexHelper {
@@ -112,7 +91,7 @@ public:
 		Resource* res = m_resourceRegistryView->Resolve<Resource>(h);
 
 		auto entry = GetResourceIndexOrDynamicResource(h, res, accessor);
-		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor };
+		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor, AcquireTableSlot(h, accessor) };
 	}
 	void RegisterSRV(ResourceIdentifier id, unsigned int mip, unsigned int slice = 0) {
 		DescriptorAccessor accessor;
@@ -124,7 +103,7 @@ public:
 		Resource* res = m_resourceRegistryView->Resolve<Resource>(h);
 
 		auto entry = GetResourceIndexOrDynamicResource(h, res, accessor);
-		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor };
+		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor, AcquireTableSlot(h, accessor) };
 	}
 	void RegisterUAV(ResourceIdentifier id, unsigned int mip, unsigned int slice = 0) {
 		DescriptorAccessor accessor;
@@ -135,7 +114,7 @@ public:
 		Resource* res = m_resourceRegistryView->Resolve<Resource>(h);
 
 		auto entry = GetResourceIndexOrDynamicResource(h, res, accessor);
-		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor };
+		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor, AcquireTableSlot(h, accessor) };
 	}
 	void RegisterUAV(UAVViewType type, ResourceIdentifier id, unsigned int mip, unsigned int slice = 0) {
 		DescriptorAccessor accessor;
@@ -148,7 +127,7 @@ public:
 		Resource* res = m_resourceRegistryView->Resolve<Resource>(h);
 
 		auto entry = GetResourceIndexOrDynamicResource(h, res, accessor);
-		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor };
+		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor, AcquireTableSlot(h, accessor) };
 	}
 	void RegisterCBV(ResourceIdentifier id) {
 		DescriptorAccessor accessor;
@@ -157,18 +136,18 @@ public:
 		Resource* res = m_resourceRegistryView->Resolve<Resource>(h);
 
 		auto entry = GetResourceIndexOrDynamicResource(h, res, accessor);
-		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor };
+		m_resourceMap[id.hash] = ResourceAndAccessor{ entry, accessor, AcquireTableSlot(h, accessor) };
 	}
-	unsigned int GetResourceDescriptorIndex(size_t hash, bool allowFail = true, const std::string* name = nullptr) const {
+	unsigned int GetResourceDescriptorIndex(size_t hash, bool allowFail = true, std::string_view name = {}) const {
 		auto it = m_resourceMap.find(hash);
 		if (it == m_resourceMap.end()) {
 			if (allowFail) {
 				return (std::numeric_limits<unsigned int>().max)(); // Return max value if the resource is not found and allowFail is true
 			}
-			if (name && ShouldAllowMissingForInactiveFeature(ResourceIdentifier{ *name })) {
+			if (!name.empty() && ShouldAllowMissingForInactiveFeature(ResourceIdentifier{ name })) {
 				return (std::numeric_limits<unsigned int>().max)();
 			}
-			std::string resourceName = name ? *name : "Unknown";
+			std::string resourceName = name.empty() ? "Unknown" : std::string(name);
 			throw std::runtime_error("Resource "+ resourceName +" not found!");
 		}
 		const auto& resourceAndAccessor = it->second;
@@ -182,7 +161,7 @@ public:
 			}
 		}
 		catch (const std::exception& e) {
-			const std::string resourceName = name ? *name : "Unknown";
+			const std::string resourceName = name.empty() ? "Unknown" : std::string(name);
 			std::ostringstream message;
 			message << "Failed to resolve descriptor index for resource '"
 				<< resourceName
@@ -203,13 +182,13 @@ public:
 			if (m_loggedDescriptorIndexChanges.insert(hash).second) {
 				spdlog::debug(
 					"ResourceDescriptorIndexHelper: descriptor index changed for '{}' old={} new={}; using refreshed bind-time index. Further changes for this resource are logged at trace.",
-					name ? *name : std::string("Unknown"),
+					name.empty() ? std::string_view("Unknown") : name,
 					lastIt->second,
 					resolvedIndex);
 			} else {
 				spdlog::trace(
 					"ResourceDescriptorIndexHelper: descriptor index changed for '{}' old={} new={}; using refreshed bind-time index",
-					name ? *name : std::string("Unknown"),
+					name.empty() ? std::string_view("Unknown") : name,
 					lastIt->second,
 					resolvedIndex);
 			}
@@ -219,14 +198,61 @@ public:
 		return resolvedIndex;
 	}
 	unsigned int GetResourceDescriptorIndex(const ResourceIdentifier& id, bool allowFail = true) const {
-		return GetResourceDescriptorIndex(id.hash, allowFail, &id.name);
+		return GetResourceDescriptorIndex(id.hash, allowFail, id.name);
+	}
+
+	// Slot of the registration in the graph's ResourceDescriptorIndexTable. kInvalidSlot when no
+	// table is attached or the resource is ephemeral; shaders must treat it like a missing resource.
+	uint32_t GetResourceDescriptorTableSlot(const ResourceIdentifier& id, bool allowFail = true) const {
+		auto it = m_resourceMap.find(id.hash);
+		if (it == m_resourceMap.end()) {
+			if (allowFail || ShouldAllowMissingForInactiveFeature(id)) {
+				return ResourceDescriptorIndexTable::kInvalidSlot;
+			}
+			throw std::runtime_error("Resource " + id.ToString() + " not found!");
+		}
+		return it->second.tableSlot;
+	}
+
+	// Table slots for the pipeline's mandatory then optional bindings. Slots are stable, so the
+	// array is packed once per pipeline and reused until this helper is replaced by a declaration
+	// refresh; only the identifier hashes are compared on later calls.
+	std::span<const uint32_t> GetPackedDescriptorTableSlots(const PipelineResources& resources) const {
+		auto& packed = m_packedTableSlotsByPipeline[&resources];
+		const size_t count = resources.mandatoryResourceDescriptorSlots.size() + resources.optionalResourceDescriptorSlots.size();
+		bool current = packed.identifierHashes.size() == count;
+		for (size_t i = 0; current && i < resources.mandatoryResourceDescriptorSlots.size(); ++i) {
+			current = packed.identifierHashes[i] == resources.mandatoryResourceDescriptorSlots[i].hash;
+		}
+		for (size_t i = 0; current && i < resources.optionalResourceDescriptorSlots.size(); ++i) {
+			current = packed.identifierHashes[resources.mandatoryResourceDescriptorSlots.size() + i] == resources.optionalResourceDescriptorSlots[i].hash;
+		}
+		if (!current) {
+			packed.identifierHashes.clear();
+			packed.slots.clear();
+			for (const auto& binding : resources.mandatoryResourceDescriptorSlots) {
+				packed.identifierHashes.push_back(binding.hash);
+				packed.slots.push_back(GetResourceDescriptorTableSlot(binding, false));
+			}
+			for (const auto& binding : resources.optionalResourceDescriptorSlots) {
+				packed.identifierHashes.push_back(binding.hash);
+				packed.slots.push_back(GetResourceDescriptorTableSlot(binding, true));
+			}
+		}
+		return packed.slots;
 	}
 
 	void SetActiveFeatureDomains(std::unordered_set<FeatureDomainIdentifier, FeatureDomainIdentifier::Hasher> activeFeatureDomains) {
 		m_activeFeatureDomains = std::move(activeFeatureDomains);
 	}
 private:
+	struct PackedTableSlots {
+		std::vector<size_t> identifierHashes;
+		std::vector<uint32_t> slots;
+	};
+
 	std::unordered_map<size_t, ResourceAndAccessor> m_resourceMap; // Maps resource identifiers to descriptor indices
+	mutable std::unordered_map<const PipelineResources*, PackedTableSlots> m_packedTableSlotsByPipeline;
 	std::unordered_set<FeatureDomainIdentifier, FeatureDomainIdentifier::Hasher> m_activeFeatureDomains;
 	mutable std::unordered_map<size_t, unsigned int> m_lastResolvedDescriptorIndices;
 	mutable std::unordered_set<size_t> m_loggedDescriptorIndexChanges;
@@ -259,8 +285,9 @@ private:
 	}
 
 	bool ShouldAllowMissingForInactiveFeature(const ResourceIdentifier& id) const {
-		auto domain = FeatureDomainRegistry::Get().FindResourceDomain(id);
-		return domain.has_value() && !m_activeFeatureDomains.contains(*domain);
+		const auto& registry = FeatureDomainRegistry::Get();
+		const FeatureDomainIdentifier* domain = registry.LookupResourceDomain(id);
+		return domain && (!m_activeFeatureDomains.contains(*domain) || !registry.IsDomainEnabled(*domain));
 	}
 
 	unsigned int AccessGloballyIndexedResource(const std::shared_ptr<GloballyIndexedResource> resource, const DescriptorAccessor& accessor) const {
@@ -288,27 +315,7 @@ private:
 		const GloballyIndexedResource& resource,
 		const DescriptorAccessor& accessor) const
 	{
-		switch (accessor.type) {
-		case DescriptorType::SRV:
-			if (accessor.hasSRVViewType) {
-				return resource.GetSRVInfo(accessor.SRVType, accessor.mip, accessor.slice).slot.index;
-			}
-			else {
-				return resource.GetSRVInfo(accessor.mip, accessor.slice).slot.index;
-			}
-
-		case DescriptorType::UAV:
-			if (accessor.hasUAVViewType) {
-				return resource.GetUAVShaderVisibleInfo(accessor.UAVType, accessor.mip, accessor.slice).slot.index;
-			}
-			return resource.GetUAVShaderVisibleInfo(accessor.mip, accessor.slice).slot.index;
-
-		case DescriptorType::CBV:
-			return resource.GetCBVInfo().slot.index;
-
-		default:
-			throw std::runtime_error("Unsupported descriptor type");
-		}
+		return ResolveDescriptorIndex(resource, accessor);
 	}
 
 	template<class T>
@@ -345,6 +352,11 @@ private:
 	}
 
 
+	uint32_t AcquireTableSlot(const ResourceRegistry::RegistryHandle& h, const DescriptorAccessor& accessor) const {
+		auto* table = m_resourceRegistryView->GetDescriptorIndexTable();
+		return table ? table->AcquireSlot(h, accessor) : ResourceDescriptorIndexTable::kInvalidSlot;
+	}
+
 	ResourceIndexOrDynamicResource GetResourceIndexOrDynamicResource(
 		const ResourceRegistry::RegistryHandle& h,
 		Resource* resource,
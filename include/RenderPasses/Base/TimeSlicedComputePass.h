@@ -0,0 +1,75 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+#include "RenderPasses/Base/ComputePass.h"
+#include "Render/Runtime/StatisticsTypes.h"
+
+// A compute pass whose work does not have to finish within one frame (probe updates, SDF bakes,
+// BVH refits). The job is a range of GetTotalWorkItems() items and a cursor that persists across
+// frames; each frame Execute records one slice starting at the cursor, sized so the pass's
+// measured GPU time stays near its budget. The graph reports the measured time (the pass's
+// statistics timestamps) before Update, so slices adapt once statistics are collected for the
+// pass; until then each slice is initialSliceItems long.
+//
+// Compute passes default to automatic queue assignment, so slices run on async compute when that
+// is enabled; PinToQueue or PreferQueue on the builder override it. The resources a job touches
+// stay declared while it runs, so the graph carries their states from frame to frame like any
+// retained resource, and releasing them once the job completes is fence-safe.
+class TimeSlicedComputePass : public ComputePass {
+public:
+	explicit TimeSlicedComputePass(double gpuBudgetMs, uint64_t initialSliceItems = 1)
+		: m_gpuBudgetMs(gpuBudgetMs), m_nextSliceItems(std::max<uint64_t>(1, initialSliceItems)) {}
+
+	void SetGpuBudgetMs(double gpuBudgetMs) { m_gpuBudgetMs = gpuBudgetMs; }
+	double GetGpuBudgetMs() const { return m_gpuBudgetMs; }
+
+	uint64_t GetWorkCursor() const { return m_cursor; }
+	bool IsWorkComplete() const { return m_cursor >= GetTotalWorkItems(); }
+	uint64_t GetLastSliceItemCount() const { return m_lastSliceItems; }
+
+	// Called by the graph before Update with the pass's smoothed GPU time (PassStats::gpuTimeEma).
+	void ReportMeasuredGpuTime(double gpuTimeMs) {
+		if (!(gpuTimeMs > 0.0) || !(m_sliceItemsEma > 0.0) || !(m_gpuBudgetMs > 0.0)) {
+			return;
+		}
+		// The EMA blends several slices, so compare it against the equally smoothed slice size.
+		const double msPerItem = gpuTimeMs / m_sliceItemsEma;
+		m_nextSliceItems = std::max<uint64_t>(1, static_cast<uint64_t>(std::floor(m_gpuBudgetMs / msPerItem)));
+	}
+
+	PassReturn Execute(PassExecutionContext& context) final {
+		const uint64_t totalItems = GetTotalWorkItems();
+		uint64_t sliceItems = 0;
+		if (m_cursor < totalItems) {
+			sliceItems = std::min(m_nextSliceItems, totalItems - m_cursor);
+			RecordSlice(context, m_cursor, sliceItems);
+			m_cursor += sliceItems;
+			if (m_cursor >= totalItems) {
+				OnWorkComplete();
+			}
+		}
+		m_lastSliceItems = sliceItems;
+		m_sliceItemsEma += rg::runtime::PassStats::alpha * (static_cast<double>(sliceItems) - m_sliceItemsEma);
+		return {};
+	}
+
+protected:
+	virtual uint64_t GetTotalWorkItems() const = 0;
+	// Records items [firstItem, firstItem + itemCount) of the current job.
+	virtual void RecordSlice(PassExecutionContext& context, uint64_t firstItem, uint64_t itemCount) = 0;
+	// The slice that finished the job was just recorded; it has not executed on the GPU yet.
+	virtual void OnWorkComplete() {}
+
+	// Starts a new job from item 0, e.g. after the derived pass swapped in new work.
+	void RestartWork() { m_cursor = 0; }
+
+private:
+	double m_gpuBudgetMs = 0.0;
+	uint64_t m_cursor = 0;
+	uint64_t m_nextSliceItems = 1;
+	uint64_t m_lastSliceItems = 0;
+	double m_sliceItemsEma = 0.0;
+};
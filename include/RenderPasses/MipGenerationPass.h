@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "RenderPasses/Base/ComputePass.h"
+#include "Render/PassBuilders.h"
+#include "Render/Runtime/IMipGenerator.h"
+#include "Resources/Resource.h"
+
+/// Inputs for the MipGenerationPass: one batch of jobs and the generator
+/// that records them.
+struct MipGenerationInputs {
+    std::vector<rg::runtime::MipGenerationJob> jobs;
+    std::shared_ptr<rg::runtime::IMipGenerator> generator;
+};
+
+inline rg::Hash64 HashValue(const MipGenerationInputs& i) {
+    // Ephemeral per-frame pass; hash by job count for differentiation
+    return static_cast<rg::Hash64>(i.jobs.size());
+}
+
+inline bool operator==(const MipGenerationInputs& a, const MipGenerationInputs& b) {
+    return a.jobs.size() == b.jobs.size(); // identity by reference; ephemeral
+}
+
+/// Split whole-chain jobs into batches of at most maxMipsPerDispatch mips
+/// each. Batch N holds the Nth step of every chain, sourced from the last
+/// mip written by batch N - 1, so each batch becomes one MipGenerationPass
+/// and the graph moves that mip from UAV to shader-resource state between
+/// them.
+inline std::vector<std::vector<rg::runtime::MipGenerationJob>> BuildMipGenerationBatches(
+    std::span<const rg::runtime::MipGenerationJob> jobs, uint32_t maxMipsPerDispatch) {
+    std::vector<std::vector<rg::runtime::MipGenerationJob>> batches;
+    const uint32_t step = std::max(maxMipsPerDispatch, 1u);
+    for (const auto& job : jobs) {
+        if (!job.texture || job.mipCount == 0) {
+            continue;
+        }
+        uint32_t sourceMip = job.sourceMip;
+        uint32_t remaining = job.mipCount;
+        for (size_t batch = 0; remaining > 0; ++batch) {
+            if (batch == batches.size()) {
+                batches.emplace_back();
+            }
+            rg::runtime::MipGenerationJob part = job;
+            part.sourceMip = sourceMip;
+            part.mipCount = std::min(remaining, step);
+            batches[batch].push_back(std::move(part));
+            sourceMip += step;
+            remaining -= std::min(remaining, step);
+        }
+    }
+    return batches;
+}
+
+/// A ComputePass that generates several mips per dispatch with the
+/// registered single-pass downsampler. The source mip is declared as a
+/// shader resource and the mips below it as fully overwritten UAVs, so
+/// their old contents are discarded instead of transitioned. Created
+/// per-frame, one per batch from BuildMipGenerationBatches, by the upload
+/// extension from ConsumeMipGenerationJobs or by the host for rendered
+/// textures.
+class MipGenerationPass final : public ComputePass {
+public:
+    explicit MipGenerationPass(MipGenerationInputs inputs) {
+        SetInputs(std::move(inputs));
+    }
+
+    void DeclareResourceUsages(ComputePassBuilder* builder) override {
+        const auto& inputs = Inputs<MipGenerationInputs>();
+        for (const auto& job : inputs.jobs) {
+            if (!job.texture || job.mipCount == 0) {
+                continue;
+            }
+            const Slice slices{ job.firstSlice, job.sliceCount };
+            const auto destination = Subresources(job.texture, Mip{ job.sourceMip + 1, job.mipCount }, slices);
+            builder->WithShaderResource(Subresources(job.texture, Mip{ job.sourceMip, 1 }, slices))
+                .WithUnorderedAccess(destination)
+                .WithFullOverwrite(destination);
+        }
+    }
+
+    void Setup() override {
+        if (const auto& generator = Inputs<MipGenerationInputs>().generator) {
+            generator->Setup();
+        }
+    }
+
+    PassReturn Execute(PassExecutionContext& context) override {
+        const auto& inputs = Inputs<MipGenerationInputs>();
+        if (inputs.generator && !inputs.jobs.empty()) {
+            inputs.generator->Record(context, inputs.jobs);
+        }
+        return {};
+    }
+
+    void Cleanup() override {}
+};
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "RenderPasses/Base/CopyPass.h"
+#include "RenderPasses/ReadbackReductionPass.h"
+#include "Render/Runtime/IReadbackService.h"
+#include "Render/ResourceRequirements.h"
+#include "Resources/Buffers/Buffer.h"
+#include "Resources/PixelBuffer.h"
+#include "Resources/ResourceStateTracker.h"
+
+struct ReadbackCaptureBatchEntry {
+    std::shared_ptr<Resource> resource;
+    RangeSpec range;
+    ReadbackReductionDesc reduction;
+    // Set for reductions that need a shader; a ReadbackReductionPass must write it first.
+    std::shared_ptr<Resource> reductionResult;
+    ReadbackCaptureCallback callback;
+};
+
+/// Inputs for the ReadbackBatchCapturePass: every capture of one queue for this frame.
+struct ReadbackCaptureBatchInputs {
+    QueueKind queue = QueueKind::Copy;
+    std::vector<ReadbackCaptureBatchEntry> entries;
+};
+
+inline rg::Hash64 HashValue(const ReadbackCaptureBatchInputs& i) {
+    // Ephemeral per-frame pass; hash by entry count for differentiation
+    return rg::HashCombine(static_cast<rg::Hash64>(i.queue), static_cast<rg::Hash64>(i.entries.size()));
+}
+
+inline bool operator==(const ReadbackCaptureBatchInputs& a, const ReadbackCaptureBatchInputs& b) {
+    return a.queue == b.queue && a.entries.size() == b.entries.size(); // identity by reference; ephemeral
+}
+
+/// A CopyPass that records all of a queue's captures for the frame into one
+/// readback allocation and signals one fence for them. Each capture still
+/// reaches its own callback, with its own slice of the allocation.
+class ReadbackBatchCapturePass final : public CopyPass, public IHasImmediateModeCommands {
+public:
+    ReadbackBatchCapturePass(ReadbackCaptureBatchInputs inputs, rg::runtime::IReadbackService* readbackService)
+        : m_readbackService(readbackService) {
+        SetInputs(std::move(inputs));
+    }
+
+    /// Splits ConsumeCaptureRequests output into one batch per queue kind
+    /// (graphics and copy), dropping captures whose resource is gone. Entries
+    /// that need a shader reduction get a result buffer from
+    /// ReadbackReductionPass::CreateResultBuffer; the host adds that pass for them.
+    static std::vector<ReadbackCaptureBatchInputs> GroupByQueue(std::vector<rg::runtime::ReadbackCaptureInfo>&& captures) {
+        ReadbackCaptureBatchInputs graphics{ QueueKind::Graphics, {} };
+        ReadbackCaptureBatchInputs copy{ QueueKind::Copy, {} };
+        for (auto& capture : captures) {
+            auto resource = capture.resource.lock();
+            if (!resource) {
+                continue;
+            }
+            ReadbackCaptureBatchEntry entry;
+            entry.resource = std::move(resource);
+            entry.range = capture.range;
+            entry.reduction = capture.reduction;
+            if (ReadbackReductionResultBytes(capture.reduction) != 0) {
+                entry.reductionResult = ReadbackReductionPass::CreateResultBuffer(capture.reduction);
+            }
+            entry.callback = std::move(capture.callback);
+            (capture.preferredQueueKind == QueueKind::Copy ? copy : graphics).entries.push_back(std::move(entry));
+        }
+
+        std::vector<ReadbackCaptureBatchInputs> batches;
+        if (!graphics.entries.empty()) {
+            batches.push_back(std::move(graphics));
+        }
+        if (!copy.entries.empty()) {
+            batches.push_back(std::move(copy));
+        }
+        return batches;
+    }
+
+    void DeclareResourceUsages(CopyPassBuilder* builder) override {
+        const auto& inputs = Inputs<ReadbackCaptureBatchInputs>();
+        for (const auto& entry : inputs.entries) {
+            if (entry.reductionResult) {
+                builder->WithCopySource(entry.reductionResult);
+            }
+            else if (entry.resource) {
+                builder->WithCopySource(ResourcePtrAndRange{ entry.resource, entry.range });
+            }
+        }
+        builder->PreferQueue(inputs.queue == QueueKind::Copy ? QueueKind::Copy : QueueKind::Graphics);
+    }
+
+    void Setup() override {
+    }
+
+    void RecordImmediateCommands(ImmediateExecutionContext& context) override {
+        const auto& inputs = Inputs<ReadbackCaptureBatchInputs>();
+        if (!m_readbackService || inputs.entries.empty()) {
+            return;
+        }
+        const QueueKind queue = inputs.queue == QueueKind::Copy ? QueueKind::Copy : QueueKind::Graphics;
+
+        // Lay every capture out in one allocation first, so the whole batch is a single
+        // sub-allocation; texture-placement alignment covers the buffer captures too.
+        std::vector<PlannedCapture> planned;
+        planned.reserve(inputs.entries.size());
+        uint64_t totalBytes = 0;
+        for (const auto& entry : inputs.entries) {
+            PlannedCapture plan;
+            if (!PlanCapture(context, entry, plan)) {
+                continue;
+            }
+            totalBytes = AlignUp(totalBytes, kReadbackTextureDataAlignment);
+            plan.offset = totalBytes;
+            totalBytes += plan.request.totalSize;
+            planned.push_back(std::move(plan));
+        }
+        if (planned.empty()) {
+            return;
+        }
+
+        const ReadbackAllocation readback = m_readbackService->AllocateReadback(
+            queue, totalBytes, kReadbackTextureDataAlignment, static_cast<uint32_t>(planned.size()));
+        if (!readback.buffer) {
+            return;
+        }
+
+        std::vector<ReadbackCaptureRequest> requests;
+        requests.reserve(planned.size());
+        for (auto& plan : planned) {
+            const uint64_t base = readback.offset + plan.offset;
+            if (plan.source) {
+                context.list.CopyBufferRegion(readback.buffer.get(), base, plan.source, 0, plan.request.totalSize);
+            }
+            else {
+                for (uint32_t slice = 0; slice < plan.range.sliceCount; ++slice) {
+                    for (uint32_t mip = 0; mip < plan.range.mipCount; ++mip) {
+                        rhi::CopyableFootprint fp = plan.request.layouts[(slice * plan.range.mipCount) + mip];
+                        fp.offset += base;
+                        context.list.CopyTextureToBuffer(
+                            plan.texture,
+                            plan.range.firstMip + mip,
+                            plan.range.firstSlice + slice,
+                            readback.buffer.get(),
+                            fp,
+                            plan.singleTexel ? plan.request.desc.reduction.x : 0,
+                            plan.singleTexel ? plan.request.desc.reduction.y : 0,
+                            0);
+                    }
+                }
+            }
+
+            plan.request.readbackBuffer = readback.buffer;
+            plan.request.readbackOffset = base;
+            plan.request.mappedData = readback.mapped + plan.offset;
+            plan.request.readbackPoolQueueKind = queue;
+            requests.push_back(std::move(plan.request));
+        }
+
+        m_pendingToken = m_readbackService->EnqueueCaptureBatch(std::move(requests));
+        m_hasPendingToken = true;
+    }
+
+    PassReturn Execute(PassExecutionContext& context) override {
+        if (!m_hasPendingToken) {
+            return {};
+        }
+
+        if (!m_readbackService) {
+            m_hasPendingToken = false;
+            return {};
+        }
+
+        auto signalFenceOwner = std::make_shared<rhi::TimelinePtr>();
+        context.device.CreateTimeline(*signalFenceOwner);
+        const rhi::Timeline signalFence = signalFenceOwner->Get();
+        constexpr uint64_t fenceValue = 1;
+        m_readbackService->FinalizeCapture(m_pendingToken, Inputs<ReadbackCaptureBatchInputs>().queue, signalFenceOwner, fenceValue);
+        m_hasPendingToken = false;
+        return { signalFence, fenceValue };
+    }
+
+    void Cleanup() override {
+    }
+
+private:
+    struct PlannedCapture {
+        ReadbackCaptureRequest request;
+        Resource* source = nullptr;      // Buffer captures and reduction results
+        PixelBuffer* texture = nullptr;  // Texture captures
+        SubresourceRange range{};
+        bool singleTexel = false;
+        uint64_t offset = 0;             // Within the batch allocation
+    };
+
+    static uint64_t AlignUp(uint64_t value, uint64_t alignment) noexcept {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    static bool PlanCapture(ImmediateExecutionContext& context, const ReadbackCaptureBatchEntry& entry, PlannedCapture& plan) {
+        Resource* resource = entry.resource.get();
+        if (!resource) {
+            return false;
+        }
+
+        auto& request = plan.request;
+        request.desc.range = entry.range;
+        request.desc.resourceId = resource->GetGlobalResourceID();
+        request.desc.reduction = entry.reduction;
+        request.callback = entry.callback;
+
+        if (entry.reductionResult) {
+            request.desc.kind = ReadbackResourceKind::Buffer;
+            request.totalSize = ReadbackReductionResultBytes(entry.reduction);
+            plan.source = entry.reductionResult.get();
+            return request.totalSize != 0;
+        }
+
+        if (!resource->HasLayout()) {
+            uint64_t byteSize = 0;
+            if (!resource->TryGetBufferByteSize(byteSize) || byteSize == 0) {
+                throw std::runtime_error("ReadbackBatchCapturePass: resource is not a texture and does not expose a buffer byte size for readback.");
+            }
+            request.desc.kind = ReadbackResourceKind::Buffer;
+            request.totalSize = byteSize;
+            plan.source = resource;
+            return true;
+        }
+
+        auto* texture = dynamic_cast<PixelBuffer*>(resource);
+        if (!texture) {
+            throw std::runtime_error("ReadbackBatchCapturePass: texture resource type mismatch.");
+        }
+
+        SubresourceRange sr = ResolveRangeSpec(entry.range, resource->GetMipLevels(), resource->GetArraySize());
+        if (sr.isEmpty()) {
+            return false;
+        }
+        plan.singleTexel = entry.reduction.kind == ReadbackReductionKind::Texel;
+        if (plan.singleTexel) {
+            sr.mipCount = 1;
+            sr.sliceCount = 1;
+        }
+
+        std::vector<rhi::CopyableFootprint> footprints(sr.mipCount * sr.sliceCount);
+        rhi::FootprintRangeDesc fr{};
+        fr.texture = texture->GetAPIResource().GetHandle();
+        fr.firstMip = sr.firstMip;
+        fr.mipCount = sr.mipCount;
+        fr.firstArraySlice = sr.firstSlice;
+        fr.arraySize = sr.sliceCount;
+        fr.firstPlane = 0;
+        fr.planeCount = 1;
+        fr.baseOffset = 0;
+
+        auto info = context.device.GetCopyableFootprints(fr, footprints.data(), static_cast<uint32_t>(footprints.size()));
+        if (plan.singleTexel) {
+            footprints[0].width = 1;
+            footprints[0].height = 1;
+            footprints[0].depth = 1;
+            info.totalBytes = footprints[0].rowPitch;
+        }
+
+        request.desc.kind = ReadbackResourceKind::Texture;
+        request.layouts = std::move(footprints);
+        request.totalSize = info.totalBytes;
+        request.format = texture->GetFormat();
+        request.width = plan.singleTexel ? 1 : texture->GetWidth();
+        request.height = plan.singleTexel ? 1 : texture->GetHeight();
+        request.depth = 1;
+        plan.texture = texture;
+        plan.range = sr;
+        return true;
+    }
+
+    rg::runtime::ReadbackCaptureToken m_pendingToken{};
+    rg::runtime::IReadbackService* m_readbackService = nullptr; // non-owning
+    bool m_hasPendingToken = false;
+};
@@ -11,8 +11,12 @@
 
 struct ReadbackCaptureInputs {
     ResourceHandleAndRange target;
+    // Texel reads one texel of `target`. The other kinds read `reductionResult` instead, which a
+    // ReadbackReductionPass over `target` wrote earlier in the frame.
+    ReadbackReductionDesc reduction;
+    std::shared_ptr<Resource> reductionResult;
 
-    RG_DEFINE_PASS_INPUTS(ReadbackCaptureInputs, &ReadbackCaptureInputs::target);
+    RG_DEFINE_PASS_INPUTS(ReadbackCaptureInputs, &ReadbackCaptureInputs::target, &ReadbackCaptureInputs::reduction, &ReadbackCaptureInputs::reductionResult);
 };
 
 class ReadbackCapturePass final : public RenderPass, public IHasImmediateModeCommands {
@@ -28,7 +32,12 @@ public:
 
     void DeclareResourceUsages(RenderPassBuilder* builder) override {
         const auto& inputs = Inputs<ReadbackCaptureInputs>();
-        builder->WithCopySource(inputs.target);
+        if (inputs.reductionResult) {
+            builder->WithCopySource(inputs.reductionResult);
+        }
+        else {
+            builder->WithCopySource(inputs.target);
+        }
     }
 
     void Setup() override {
@@ -37,25 +46,49 @@ public:
     void RecordImmediateCommands(ImmediateExecutionContext& context) override {
         const auto& inputs = Inputs<ReadbackCaptureInputs>();
         auto* resource = m_resourceRegistryView->Resolve<Resource>(inputs.target.resource);
-        if (!resource) {
+        if (!resource || !m_readbackService) {
             return;
         }
 
         ReadbackCaptureRequest request{};
         request.desc.range = inputs.target.range;
         request.desc.resourceId = resource->GetGlobalResourceID();
+        request.desc.reduction = inputs.reduction;
 
-        if (resource->HasLayout()) {
+        if (inputs.reductionResult) {
+            const uint64_t byteSize = ReadbackReductionResultBytes(inputs.reduction);
+            if (byteSize == 0) {
+                throw std::runtime_error("ReadbackCapturePass: reduction result given for a reduction kind without one.");
+            }
+            const ReadbackAllocation readback = m_readbackService->AllocateReadback(QueueKind::Graphics, byteSize, kReadbackBufferDataAlignment);
+            if (!readback.buffer) {
+                return;
+            }
+
+            context.list.CopyBufferRegion(readback.buffer.get(), readback.offset, inputs.reductionResult.get(), 0, byteSize);
+
+            request.desc.kind = ReadbackResourceKind::Buffer;
+            request.readbackBuffer = readback.buffer;
+            request.readbackOffset = readback.offset;
+            request.mappedData = readback.mapped;
+            request.totalSize = byteSize;
+        }
+        else if (resource->HasLayout()) {
             auto* texture = dynamic_cast<PixelBuffer*>(resource);
             if (!texture) {
                 throw std::runtime_error("ReadbackCapturePass: texture resource type mismatch.");
             }
 
             const auto handle = inputs.target.resource;
-            const SubresourceRange sr = ResolveRangeSpec(inputs.target.range, handle.GetNumMipLevels(), handle.GetArraySize());
+            SubresourceRange sr = ResolveRangeSpec(inputs.target.range, handle.GetNumMipLevels(), handle.GetArraySize());
             if (sr.isEmpty()) {
                 return;
             }
+            const bool singleTexel = inputs.reduction.kind == ReadbackReductionKind::Texel;
+            if (singleTexel) {
+                sr.mipCount = 1;
+                sr.sliceCount = 1;
+            }
 
             std::vector<rhi::CopyableFootprint> footprints(sr.mipCount * sr.sliceCount);
             rhi::FootprintRangeDesc fr{};
@@ -69,34 +102,47 @@ public:
             fr.baseOffset = 0;
 
             auto info = context.device.GetCopyableFootprints(fr, footprints.data(), static_cast<uint32_t>(footprints.size()));
+            if (singleTexel) {
+                // One row of a 1x1 footprint; the copy's x/y pick the texel.
+                footprints[0].width = 1;
+                footprints[0].height = 1;
+                footprints[0].depth = 1;
+                info.totalBytes = footprints[0].rowPitch;
+            }
 
-            auto readbackBuffer = Buffer::CreateShared(rhi::HeapType::Readback, info.totalBytes);
-            readbackBuffer->SetName("ReadbackCaptureBuffer");
+            const ReadbackAllocation readback = m_readbackService->AllocateReadback(QueueKind::Graphics, info.totalBytes, kReadbackTextureDataAlignment);
+            if (!readback.buffer) {
+                return;
+            }
 
             for (uint32_t slice = 0; slice < sr.sliceCount; ++slice) {
                 for (uint32_t mip = 0; mip < sr.mipCount; ++mip) {
                     const uint32_t subresourceIndex = (slice * sr.mipCount) + mip;
-                    const auto& fp = footprints[subresourceIndex];
+                    // Layouts handed to the callback stay relative to the capture's own data.
+                    rhi::CopyableFootprint fp = footprints[subresourceIndex];
+                    fp.offset += readback.offset;
 
                     context.list.CopyTextureToBuffer(
                         texture,
                         sr.firstMip + mip,
                         sr.firstSlice + slice,
-                        readbackBuffer.get(),
+                        readback.buffer.get(),
                         fp,
-                        0,
-                        0,
+                        singleTexel ? inputs.reduction.x : 0,
+                        singleTexel ? inputs.reduction.y : 0,
                         0);
                 }
             }
 
             request.desc.kind = ReadbackResourceKind::Texture;
-            request.readbackBuffer = readbackBuffer;
+            request.readbackBuffer = readback.buffer;
+            request.readbackOffset = readback.offset;
+            request.mappedData = readback.mapped;
             request.layouts = std::move(footprints);
             request.totalSize = info.totalBytes;
             request.format = texture->GetFormat();
-            request.width = texture->GetWidth();
-            request.height = texture->GetHeight();
+            request.width = singleTexel ? 1 : texture->GetWidth();
+            request.height = singleTexel ? 1 : texture->GetHeight();
             request.depth = 1;
         }
         else {
@@ -104,21 +150,22 @@ public:
             if (!resource->TryGetBufferByteSize(byteSize) || byteSize == 0) {
                 throw std::runtime_error("ReadbackCapturePass: resource is not a texture (has no layout) and does not expose a buffer byte size for readback.");
             }
-            auto readbackBuffer = Buffer::CreateShared(rhi::HeapType::Readback, byteSize);
-            readbackBuffer->SetName("ReadbackCaptureBuffer");
+            const ReadbackAllocation readback = m_readbackService->AllocateReadback(QueueKind::Graphics, byteSize, kReadbackBufferDataAlignment);
+            if (!readback.buffer) {
+                return;
+            }
 
-            context.list.CopyBufferRegion(readbackBuffer.get(), 0, resource, 0, byteSize);
+            context.list.CopyBufferRegion(readback.buffer.get(), readback.offset, resource, 0, byteSize);
 
             request.desc.kind = ReadbackResourceKind::Buffer;
-            request.readbackBuffer = readbackBuffer;
+            request.readbackBuffer = readback.buffer;
+            request.readbackOffset = readback.offset;
+            request.mappedData = readback.mapped;
             request.totalSize = byteSize;
         }
 
         request.callback = m_callback;
-        if (!m_readbackService) {
-            return;
-        }
-
+        request.readbackPoolQueueKind = QueueKind::Graphics;
         m_pendingToken = m_readbackService->EnqueueCapture(std::move(request));
         m_hasPendingToken = true;
     }
@@ -11,8 +11,12 @@
 
 struct ReadbackCopyCaptureInputs {
     ResourceHandleAndRange target;
+    // Texel reads one texel of `target`. The other kinds read `reductionResult` instead, which a
+    // ReadbackReductionPass over `target` wrote earlier in the frame.
+    ReadbackReductionDesc reduction;
+    std::shared_ptr<Resource> reductionResult;
 
-    RG_DEFINE_PASS_INPUTS(ReadbackCopyCaptureInputs, &ReadbackCopyCaptureInputs::target);
+    RG_DEFINE_PASS_INPUTS(ReadbackCopyCaptureInputs, &ReadbackCopyCaptureInputs::target, &ReadbackCopyCaptureInputs::reduction, &ReadbackCopyCaptureInputs::reductionResult);
 };
 
 /// A CopyPass variant of ReadbackCapturePass that runs on the copy queue.
@@ -30,7 +34,12 @@ public:
 
     void DeclareResourceUsages(CopyPassBuilder* builder) override {
         const auto& inputs = Inputs<ReadbackCopyCaptureInputs>();
-        builder->WithCopySource(inputs.target);
+        if (inputs.reductionResult) {
+            builder->WithCopySource(inputs.reductionResult);
+        }
+        else {
+            builder->WithCopySource(inputs.target);
+        }
         builder->PreferQueue(QueueKind::Copy);
     }
 
@@ -40,25 +49,49 @@ public:
     void RecordImmediateCommands(ImmediateExecutionContext& context) override {
         const auto& inputs = Inputs<ReadbackCopyCaptureInputs>();
         auto* resource = m_resourceRegistryView->Resolve<Resource>(inputs.target.resource);
-        if (!resource) {
+        if (!resource || !m_readbackService) {
             return;
         }
 
         ReadbackCaptureRequest request{};
         request.desc.range = inputs.target.range;
         request.desc.resourceId = resource->GetGlobalResourceID();
+        request.desc.reduction = inputs.reduction;
 
-        if (resource->HasLayout()) {
+        if (inputs.reductionResult) {
+            const uint64_t byteSize = ReadbackReductionResultBytes(inputs.reduction);
+            if (byteSize == 0) {
+                throw std::runtime_error("ReadbackCopyCapturePass: reduction result given for a reduction kind without one.");
+            }
+            const ReadbackAllocation readback = m_readbackService->AllocateReadback(QueueKind::Copy, byteSize, kReadbackBufferDataAlignment);
+            if (!readback.buffer) {
+                return;
+            }
+
+            context.list.CopyBufferRegion(readback.buffer.get(), readback.offset, inputs.reductionResult.get(), 0, byteSize);
+
+            request.desc.kind = ReadbackResourceKind::Buffer;
+            request.readbackBuffer = readback.buffer;
+            request.readbackOffset = readback.offset;
+            request.mappedData = readback.mapped;
+            request.totalSize = byteSize;
+        }
+        else if (resource->HasLayout()) {
             auto* texture = dynamic_cast<PixelBuffer*>(resource);
             if (!texture) {
                 throw std::runtime_error("ReadbackCopyCapturePass: texture resource type mismatch.");
             }
 
             const auto handle = inputs.target.resource;
-            const SubresourceRange sr = ResolveRangeSpec(inputs.target.range, handle.GetNumMipLevels(), handle.GetArraySize());
+            SubresourceRange sr = ResolveRangeSpec(inputs.target.range, handle.GetNumMipLevels(), handle.GetArraySize());
             if (sr.isEmpty()) {
                 return;
             }
+            const bool singleTexel = inputs.reduction.kind == ReadbackReductionKind::Texel;
+            if (singleTexel) {
+                sr.mipCount = 1;
+                sr.sliceCount = 1;
+            }
 
             std::vector<rhi::CopyableFootprint> footprints(sr.mipCount * sr.sliceCount);
             rhi::FootprintRangeDesc fr{};
@@ -72,34 +105,47 @@ public:
             fr.baseOffset = 0;
 
             auto info = context.device.GetCopyableFootprints(fr, footprints.data(), static_cast<uint32_t>(footprints.size()));
+            if (singleTexel) {
+                // One row of a 1x1 footprint; the copy's x/y pick the texel.
+                footprints[0].width = 1;
+                footprints[0].height = 1;
+                footprints[0].depth = 1;
+                info.totalBytes = footprints[0].rowPitch;
+            }
 
-            auto readbackBuffer = Buffer::CreateShared(rhi::HeapType::Readback, info.totalBytes);
-            readbackBuffer->SetName("ReadbackCopyCaptureBuffer");
+            const ReadbackAllocation readback = m_readbackService->AllocateReadback(QueueKind::Copy, info.totalBytes, kReadbackTextureDataAlignment);
+            if (!readback.buffer) {
+                return;
+            }
 
             for (uint32_t slice = 0; slice < sr.sliceCount; ++slice) {
                 for (uint32_t mip = 0; mip < sr.mipCount; ++mip) {
                     const uint32_t subresourceIndex = (slice * sr.mipCount) + mip;
-                    const auto& fp = footprints[subresourceIndex];
+                    // Layouts handed to the callback stay relative to the capture's own data.
+                    rhi::CopyableFootprint fp = footprints[subresourceIndex];
+                    fp.offset += readback.offset;
 
                     context.list.CopyTextureToBuffer(
                         texture,
                         sr.firstMip + mip,
                         sr.firstSlice + slice,
-                        readbackBuffer.get(),
+                        readback.buffer.get(),
                         fp,
-                        0,
-                        0,
+                        singleTexel ? inputs.reduction.x : 0,
+                        singleTexel ? inputs.reduction.y : 0,
                         0);
                 }
             }
 
             request.desc.kind = ReadbackResourceKind::Texture;
-            request.readbackBuffer = readbackBuffer;
+            request.readbackBuffer = readback.buffer;
+            request.readbackOffset = readback.offset;
+            request.mappedData = readback.mapped;
             request.layouts = std::move(footprints);
             request.totalSize = info.totalBytes;
             request.format = texture->GetFormat();
-            request.width = texture->GetWidth();
-            request.height = texture->GetHeight();
+            request.width = singleTexel ? 1 : texture->GetWidth();
+            request.height = singleTexel ? 1 : texture->GetHeight();
             request.depth = 1;
         }
         else {
@@ -107,21 +153,22 @@ public:
             if (!resource->TryGetBufferByteSize(byteSize) || byteSize == 0) {
                 throw std::runtime_error("ReadbackCopyCapturePass: resource is not a texture and does not expose a buffer byte size for readback.");
             }
-            auto readbackBuffer = Buffer::CreateShared(rhi::HeapType::Readback, byteSize);
-            readbackBuffer->SetName("ReadbackCopyCaptureBuffer");
+            const ReadbackAllocation readback = m_readbackService->AllocateReadback(QueueKind::Copy, byteSize, kReadbackBufferDataAlignment);
+            if (!readback.buffer) {
+                return;
+            }
 
-            context.list.CopyBufferRegion(readbackBuffer.get(), 0, resource, 0, byteSize);
+            context.list.CopyBufferRegion(readback.buffer.get(), readback.offset, resource, 0, byteSize);
 
             request.desc.kind = ReadbackResourceKind::Buffer;
-            request.readbackBuffer = readbackBuffer;
+            request.readbackBuffer = readback.buffer;
+            request.readbackOffset = readback.offset;
+            request.mappedData = readback.mapped;
             request.totalSize = byteSize;
         }
 
         request.callback = m_callback;
-        if (!m_readbackService) {
-            return;
-        }
-
+        request.readbackPoolQueueKind = QueueKind::Copy;
         m_pendingToken = m_readbackService->EnqueueCapture(std::move(request));
         m_hasPendingToken = true;
     }
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <memory>
+#include <stdexcept>
+
+#include "RenderPasses/Base/ComputePass.h"
+#include "Render/Runtime/IReadbackReducer.h"
+#include "Render/ResourceRequirements.h"
+#include "Resources/Buffers/Buffer.h"
+#include "Resources/ResourceStateTracker.h"
+
+struct ReadbackReductionInputs {
+    ResourceHandleAndRange target;
+    ReadbackReductionDesc reduction;
+    std::shared_ptr<Resource> result;
+
+    RG_DEFINE_PASS_INPUTS(ReadbackReductionInputs, &ReadbackReductionInputs::target, &ReadbackReductionInputs::reduction, &ReadbackReductionInputs::result);
+};
+
+/// A ComputePass that reduces a capture target on the GPU with the reducer
+/// registered for the reduction kind. For a ReadbackCaptureInfo whose
+/// reduction needs a shader (anything but None or Texel), the host adds:
+///   1. this pass over info.resource/info.range, writing CreateResultBuffer(info.reduction);
+///   2. a ReadbackCapturePass or ReadbackCopyCapturePass with the same target,
+///      reduction and that buffer as reductionResult.
+/// Only ReadbackReductionResultBytes(reduction) bytes are then copied back.
+class ReadbackReductionPass final : public ComputePass {
+public:
+    ReadbackReductionPass(ReadbackReductionInputs inputs, std::shared_ptr<rg::runtime::IReadbackReducer> reducer)
+        : m_reducer(std::move(reducer)) {
+        if (!m_reducer || m_reducer->GetKind() != inputs.reduction.kind) {
+            throw std::runtime_error("ReadbackReductionPass: reducer does not match the reduction kind.");
+        }
+        SetInputs(std::move(inputs));
+    }
+
+    static std::shared_ptr<Buffer> CreateResultBuffer(const ReadbackReductionDesc& reduction) {
+        const uint64_t bytes = ReadbackReductionResultBytes(reduction);
+        if (bytes == 0) {
+            throw std::runtime_error("ReadbackReductionPass: reduction kind has no GPU result.");
+        }
+        auto buffer = Buffer::CreateShared(rhi::HeapType::DeviceLocal, bytes, /*uav=*/true);
+        buffer->SetName("ReadbackReductionResult");
+        return buffer;
+    }
+
+    void DeclareResourceUsages(ComputePassBuilder* builder) override {
+        const auto& inputs = Inputs<ReadbackReductionInputs>();
+        builder->WithShaderResource(inputs.target);
+        if (inputs.result) {
+            builder->WithUnorderedAccess(inputs.result);
+        }
+    }
+
+    void Setup() override {
+        m_reducer->Setup();
+    }
+
+    PassReturn Execute(PassExecutionContext& context) override {
+        const auto& inputs = Inputs<ReadbackReductionInputs>();
+        auto* source = m_resourceRegistryView->Resolve<Resource>(inputs.target.resource);
+        if (!source || !inputs.result) {
+            return {};
+        }
+
+        const auto handle = inputs.target.resource;
+        rg::runtime::ReadbackReductionJob job;
+        job.source = source;
+        job.range = ResolveRangeSpec(inputs.target.range, handle.GetNumMipLevels(), handle.GetArraySize());
+        job.desc = inputs.reduction;
+        job.result = inputs.result.get();
+        if (job.range.isEmpty()) {
+            return {};
+        }
+        m_reducer->Record(context, job);
+        return {};
+    }
+
+    void Cleanup() override {
+    }
+
+private:
+    std::shared_ptr<rg::runtime::IReadbackReducer> m_reducer;
+};
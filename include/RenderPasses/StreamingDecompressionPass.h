@@ -0,0 +1,79 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+#include "RenderPasses/Base/ComputePass.h"
+#include "Render/Runtime/IStreamingDecompressor.h"
+#include "Render/Runtime/StreamingUploadTypes.h"
+#include "Resources/Resource.h"
+
+/// Inputs for the StreamingDecompressionPass: one frame's jobs and the
+/// decompressors for the codecs they use.
+struct StreamingDecompressionInputs {
+    std::vector<StreamingDecompressionJob> jobs;
+    std::vector<std::shared_ptr<rg::runtime::IStreamingDecompressor>> decompressors;
+};
+
+inline rg::Hash64 HashValue(const StreamingDecompressionInputs& i) {
+    // Ephemeral per-frame pass; hash by job count for differentiation
+    return static_cast<rg::Hash64>(i.jobs.size());
+}
+
+inline bool operator==(const StreamingDecompressionInputs& a, const StreamingDecompressionInputs& b) {
+    return a.jobs.size() == b.jobs.size(); // identity by reference; ephemeral
+}
+
+/// A ComputePass that expands compressed streaming uploads into their
+/// destination buffers. Created per-frame by the streaming extension from
+/// ConsumeStreamingDecompressionJobs when there is work.
+class StreamingDecompressionPass final : public ComputePass {
+public:
+    explicit StreamingDecompressionPass(StreamingDecompressionInputs inputs) {
+        SetInputs(std::move(inputs));
+    }
+
+    void DeclareResourceUsages(ComputePassBuilder* builder) override {
+        const auto& inputs = Inputs<StreamingDecompressionInputs>();
+        for (const auto& job : inputs.jobs) {
+            if (job.dstResource) {
+                builder->WithUnorderedAccess(job.dstResource);
+            }
+            // Upload-heap sources are always readable and are kept alive by
+            // the job, so they are not declared.
+        }
+    }
+
+    void Setup() override {
+        for (const auto& decompressor : Inputs<StreamingDecompressionInputs>().decompressors) {
+            if (decompressor) {
+                decompressor->Setup();
+            }
+        }
+    }
+
+    PassReturn Execute(PassExecutionContext& context) override {
+        const auto& inputs = Inputs<StreamingDecompressionInputs>();
+        // Jobs arrive grouped by codec; hand each decompressor its contiguous run.
+        for (const auto& decompressor : inputs.decompressors) {
+            if (!decompressor) {
+                continue;
+            }
+            const uint32_t codec = decompressor->GetCodec();
+            const auto first = std::find_if(inputs.jobs.begin(), inputs.jobs.end(), [codec](const StreamingDecompressionJob& job) {
+                return job.codec == codec;
+            });
+            const auto last = std::find_if(first, inputs.jobs.end(), [codec](const StreamingDecompressionJob& job) {
+                return job.codec != codec;
+            });
+            if (first != last) {
+                decompressor->Record(context, std::span<const StreamingDecompressionJob>(&*first, static_cast<size_t>(last - first)));
+            }
+        }
+        return {};
+    }
+
+    void Cleanup() override {}
+};
@@ -29,7 +29,7 @@ inline bool operator==(const StreamingUploadInputs& a, const StreamingUploadInpu
     return a.uploads.size() == b.uploads.size(); // identity by reference; ephemeral
 }
 
-/// A CopyPass that runs on the copy queue and performs streaming buffer uploads.
+/// A CopyPass that runs on the copy queue and performs streaming buffer and texture uploads.
 /// Created per-frame by the streaming extension when there are pending uploads.
 class StreamingUploadPass final : public CopyPass, public IHasImmediateModeCommands {
 public:
@@ -40,7 +40,20 @@ public:
     void DeclareResourceUsages(CopyPassBuilder* builder) override {
         const auto& inputs = Inputs<StreamingUploadInputs>();
         for (const auto& upload : inputs.uploads) {
-            if (upload.dstResource) {
+            if (!upload.dstResource) {
+                continue;
+            }
+            if (upload.kind == StreamingUploadDescriptor::Kind::TextureSubresource) {
+                // Only the written subresource goes to copy-dest, so the rest of a partially
+                // streamed texture stays usable on other queues.
+                RangeSpec range;
+                range.mipLower = { BoundType::Exact, upload.mip };
+                range.mipUpper = { BoundType::Exact, upload.mip };
+                range.sliceLower = { BoundType::Exact, upload.slice };
+                range.sliceUpper = { BoundType::Exact, upload.slice };
+                builder->WithCopyDest(ResourcePtrAndRange{ upload.dstResource, range });
+            }
+            else {
                 builder->WithCopyDest(upload.dstResource);
             }
             // Upload-heap sources don't need to be declared — they are
@@ -65,6 +78,13 @@ public:
             if (!upload.dstResource || !upload.srcUploadBuffer || upload.size == 0) {
                 continue;
             }
+            if (upload.kind == StreamingUploadDescriptor::Kind::TextureSubresource) {
+                context.list.CopyBufferToTexture(
+                    upload.srcUploadBuffer, upload.dstResource.get(),
+                    upload.mip, upload.slice, upload.footprint,
+                    upload.x, upload.y, upload.z);
+                continue;
+            }
             context.list.CopyBufferRegion(
                 upload.dstResource.get(), upload.dstOffset,
                 upload.srcUploadBuffer, upload.srcOffset,
@@ -3,14 +3,22 @@
 #include <optional>
 #include <rhi_allocator.h>
 
+// poolGeneration changes whenever the pool's memory is reallocated, so two equal placements
+// always refer to the same bytes of the same live allocation.
 struct TextureAliasPlacement {
 	rhi::ma::Allocation* allocation = nullptr;
 	uint64_t offset = 0;
 	std::optional<uint64_t> poolID;
+	uint64_t poolGeneration = 0;
+
+	bool operator==(const TextureAliasPlacement&) const = default;
 };
 
 struct BufferAliasPlacement {
 	rhi::ma::Allocation* allocation = nullptr;
 	uint64_t offset = 0;
 	std::optional<uint64_t> poolID;
+	uint64_t poolGeneration = 0;
+
+	bool operator==(const BufferAliasPlacement&) const = default;
 };
@@ -2,6 +2,8 @@
 
 #include <cstdint>
 
+class TrackedHandle;
+
 // Graph-facing contract for resources whose API handle is backed by a concrete GPU allocation.
 // RenderGraph should depend on this capability instead of specific resource subclasses.
 class BackedResource {
@@ -11,4 +13,7 @@ public:
     virtual bool IsMaterialized() const = 0;
     virtual uint64_t GetBackingGeneration() const = 0;
     virtual void EnsureVirtualDescriptorSlotsAllocated() = 0;
+    // Device-local allocation this resource owns outright, for residency management. Null while
+    // unmaterialized or placed in an alias pool, whose heap the pool pages as a whole.
+    virtual TrackedHandle* GetCommittedAllocation() { return nullptr; }
 };
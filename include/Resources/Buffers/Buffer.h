@@ -25,10 +25,18 @@ public:
         bool createNonShaderVisibleUAV = false;
     };
 
+    // Each Buffer is its own API resource. Its memory already comes out of the allocator's shared
+    // heaps, so small buffers do not get a heap each. Packing several buffers into one resource is
+    // not supported: uploads, readbacks, copies, barriers and descriptors all address a buffer as
+    // a whole resource starting at offset zero, and state is tracked per resource.
     static std::shared_ptr<Buffer> CreateShared(rhi::HeapType accessType, uint64_t bufferSize, bool unorderedAccess = false) {
         return std::shared_ptr<Buffer>(new Buffer(accessType, bufferSize, unorderedAccess, true));
     }
 
+    static std::shared_ptr<Buffer> CreateShared(BufferPlacement placement, uint64_t bufferSize, bool unorderedAccess = false) {
+        return CreateShared(ResolvePlacementHeapType(placement, bufferSize), bufferSize, unorderedAccess);
+    }
+
     static std::shared_ptr<Buffer> CreateSharedUnmaterialized(rhi::HeapType accessType, uint64_t bufferSize, bool unorderedAccess = false) {
         return std::shared_ptr<Buffer>(new Buffer(accessType, bufferSize, unorderedAccess, false));
     }
@@ -109,6 +117,9 @@ public:
         if (wasMaterialized) {
             Dematerialize();
         }
+        else {
+            ReleaseParkedBacking();
+        }
 
         UpdateDescriptorsForByteSize(newBufferSize);
         ConfigureBacking(m_accessType, newBufferSize, m_unorderedAccess);
@@ -119,6 +130,25 @@ public:
         return true;
     }
 
+    // Grows the buffer to at least newCapacityBytes and keeps its contents: the live bytes of the old
+    // backing are copied into the new one. Never shrinks; returns false when the buffer already fits.
+    bool ReserveBytes(uint64_t newCapacityBytes) {
+        if (m_structuredParams.has_value()) {
+            throw std::runtime_error("ReserveBytes called on a structured buffer");
+        }
+        if (newCapacityBytes <= m_bufferSize) {
+            return false;
+        }
+
+        UpdateDescriptorsForByteSize(newCapacityBytes);
+        return GrowBacking(newCapacityBytes);
+    }
+
+    // ReserveBytes for a buffer that is filled incrementally: capacity follows the growth policy.
+    bool GrowBytes(uint64_t requiredBytes) {
+        return ReserveBytes(ComputeGrowthCapacity(requiredBytes));
+    }
+
     bool ResizeStructured(uint32_t newNumElements) {
         if (!m_structuredParams.has_value()) {
             throw std::runtime_error("ResizeStructured called on a non-structured buffer");
@@ -143,6 +173,9 @@ public:
         if (wasMaterialized) {
             Dematerialize();
         }
+        else {
+            ReleaseParkedBacking();
+        }
 
         UpdateDescriptorsForStructuredResize(params, layout.counterOffset);
         m_structuredParams = params;
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+class BufferBase;
+
+// Incremental defragmentation of long-lived, non-aliased device-local buffers. After a long
+// session of creating and freeing buffers the allocator's heaps are left with holes that new
+// allocations cannot use, and each partly used heap keeps its whole size resident. Moving a live
+// buffer into a fresh allocation lets the allocator place it in a hole of a fuller heap, and frees
+// its old range, so nearly empty heaps drain and can be released.
+//
+// The RHI allocator does not report where an allocation sits, so the defragmenter cannot pick only
+// the badly placed ones. Instead, while a sweep is running, it walks the registered buffers in
+// registration order and relocates up to bytesPerFrame bytes each Update, skipping buffers moved in
+// the last minFramesBetweenMoves frames. Oldest buffers go first, since they are the ones left
+// stranded in heaps that have emptied out around them. Each move goes through
+// BufferBase::RelocateBacking: a copy of the live bytes on the resource copy path (the copy queue
+// for copies of at least the resourceCopyQueueMinBytes setting), new descriptor slots and
+// a backing generation bump; the old backing and slots are released once the frames that used them
+// have retired.
+//
+// Buffers are held weakly and dropped once their last owner releases them. Not thread-safe; call
+// Update at a frame boundary from the thread that may replace backings, before the frame's graph
+// is executed, so the queued copies run in that frame.
+class BufferDefragmenter {
+public:
+    struct Settings {
+        uint64_t bytesPerFrame = 32ull * 1024ull * 1024ull;
+        uint64_t minBufferBytes = 64ull * 1024ull; // Smaller buffers waste too little to be worth moving
+        uint32_t minFramesBetweenMoves = 600;
+        uint32_t sweepIntervalFrames = 0; // Start a sweep every this many frames; 0 = only on BeginSweep
+    };
+
+    struct Stats {
+        uint64_t registeredBuffers = 0;
+        uint64_t sweepsStarted = 0;
+        uint64_t sweepsCompleted = 0;
+        uint64_t relocations = 0;
+        uint64_t bytesRelocated = 0;
+        uint64_t relocationsLastFrame = 0;
+        uint64_t bytesRelocatedLastFrame = 0;
+        uint64_t skippedIneligible = 0; // Aliased, CPU-visible, dematerialized or moved too recently
+    };
+
+    explicit BufferDefragmenter(Settings settings);
+    BufferDefragmenter() : BufferDefragmenter(Settings{}) {}
+
+    BufferDefragmenter(const BufferDefragmenter&) = delete;
+    BufferDefragmenter& operator=(const BufferDefragmenter&) = delete;
+
+    void Register(const std::shared_ptr<BufferBase>& buffer);
+    void Unregister(const BufferBase* buffer);
+
+    // Starts a pass over every registered buffer; a sweep already running restarts from the oldest.
+    void BeginSweep();
+    bool IsSweepActive() const { return m_sweepActive; }
+
+    void Update(uint64_t frameSerial);
+
+    void SetSettings(const Settings& settings) { m_settings = settings; }
+    const Settings& GetSettings() const { return m_settings; }
+    Stats GetStats() const;
+
+private:
+    struct Entry {
+        std::weak_ptr<BufferBase> buffer;
+        const BufferBase* key = nullptr;
+        uint64_t lastMovedFrame = 0;
+        bool moved = false;
+    };
+
+    Settings m_settings;
+    std::vector<Entry> m_entries; // In registration order
+    size_t m_cursor = 0;          // Next entry of the running sweep
+    bool m_sweepActive = false;
+    uint64_t m_lastSweepStartFrame = 0;
+    Stats m_stats{};
+};
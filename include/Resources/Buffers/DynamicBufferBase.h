@@ -18,6 +18,15 @@ class GpuBufferBacking;
 
 class BufferView;
 
+// Where a buffer's memory lives. CpuVisibleDeviceLocal asks for device-local memory the CPU can map
+// directly (resizable BAR / GPU upload heaps). The RHI cannot report adapter support, so it is only
+// granted when the application sets cpuVisibleDeviceLocalHeapSupported and the buffer fits in
+// cpuVisibleDeviceLocalMaxBufferBytes; otherwise the buffer is placed as Default.
+enum class BufferPlacement : uint8_t {
+    Default = 0,
+    CpuVisibleDeviceLocal = 1,
+};
+
 class BufferBase : public GloballyIndexedResource, public BackedResource, public rg::runtime::IUploadPolicyClient {
 public:
     class ScopedBackingMutation {
@@ -49,6 +58,10 @@ public:
         uint64_t uavCounterOffset = 0;
     };
 
+    // Heap used for BufferPlacement::CpuVisibleDeviceLocal; backends map the RHI's Custom heap to
+    // host-visible device-local memory.
+    static constexpr rhi::HeapType kCpuVisibleDeviceLocalHeapType = rhi::HeapType::Custom;
+
     BufferBase();
 
     BufferBase(
@@ -88,10 +101,18 @@ public:
 
     uint64_t GetBackingGeneration() const override;
 
+    TrackedHandle* GetCommittedAllocation() override;
+
     void Materialize(const MaterializeOptions* options = nullptr);
 
     void Dematerialize();
 
+    // Dematerialize, but keep an alias-placed backing aside so the next Materialize with the same
+    // placement rebinds it without recreating the API resource or rewriting descriptors.
+    void ParkAliasedBacking();
+    void ReleaseParkedBacking();
+    std::optional<BufferAliasPlacement> GetParkedAliasPlacement() const;
+
     void SetDescriptorRequirements(const DescriptorRequirements& requirements);
 
     bool HasDescriptorRequirements() const;
@@ -115,6 +136,63 @@ public:
     rg::runtime::UploadPolicyTag GetUploadPolicyTag() const;
 
     bool IsUploadPolicyImmediate() const;
+
+    // How a buffer that is grown step by step picks its next capacity: at least growthFactor times
+    // the current size and minimumGrowthBytes more than it, so a run of small appends reallocates
+    // a logarithmic number of times instead of once per append.
+    struct GrowthPolicy {
+        float growthFactor = 1.0f;
+        uint64_t minimumGrowthBytes = 0;
+    };
+
+    struct ResizeStats {
+        uint64_t resizeCount = 0;
+        uint64_t bytesCopied = 0;
+    };
+
+    void SetGrowthPolicy(const GrowthPolicy& policy);
+
+    const GrowthPolicy& GetGrowthPolicy() const;
+
+    uint64_t ComputeGrowthCapacity(uint64_t requiredBytes) const;
+
+    // Writers report the end of the bytes they have written; a resize then copies only up to the
+    // high-water mark. Until something is reported, a resize copies the whole old backing.
+    void NoteBytesUsed(uint64_t endByte);
+
+    void ResetBytesUsed();
+
+    std::optional<uint64_t> GetBytesUsedHighWater() const;
+
+    const ResizeStats& GetResizeStats() const;
+
+    // Whether RelocateBacking may move this buffer: materialized, device-local, not placed or
+    // allowed in an alias pool and not written in place by the CPU.
+    bool CanRelocateBacking() const;
+
+    // Moves the buffer into a fresh backing of the same size so the allocator can place it in a
+    // fuller heap, for BufferDefragmenter. The live bytes are copied through the upload service,
+    // descriptors move to new slots, and the old slots and backing are retired by fence. Bumps the
+    // backing generation. Call under ScopedBackingMutation; returns false when the buffer cannot move.
+    bool RelocateBacking();
+
+    // Totals across every buffer since start-up.
+    static ResizeStats GetTotalResizeStats();
+
+    static rhi::HeapType ResolvePlacementHeapType(BufferPlacement placement, uint64_t bufferSize);
+    // Heap for buffers the CPU writes in place every frame: CPU-visible device-local memory when
+    // ResolvePlacementHeapType grants it, otherwise an upload heap. Never needs a transition.
+    static rhi::HeapType ResolveCpuWritableHeapType(uint64_t bufferSize);
+
+    bool IsCpuVisibleDeviceLocal() const;
+
+    // True when uploads to this buffer are written straight into its mapped memory instead of
+    // going through the upload pass (DirectWrite tag on a CPU-visible device-local buffer).
+    bool IsDirectWriteEnabled() const;
+
+    // Number of live buffers with IsDirectWriteEnabled(); lets the upload path skip resolving
+    // targets when there are none.
+    static size_t GetDirectWriteBufferCount();
     static bool IsBackingMutationAllowedOnThisThread();
 
     virtual ~BufferBase();
@@ -129,6 +207,9 @@ protected:
     void CreateAndSetBacking(rhi::HeapType accessType, uint64_t bufferSize, bool unorderedAccess);
     void SetBackingName(const std::string& baseName, const std::string& suffix);
     void QueueResourceCopyFromOldBacking(uint64_t bytesToCopy);
+    // Replaces the backing with one of newBufferSize bytes and queues a copy of the live bytes of
+    // the old one. Only grows; returns false when the buffer is already that large.
+    bool GrowBacking(uint64_t newBufferSize);
 
     void ApplyMetadataToBacking(const EntityComponentBundle& bundle);
 
@@ -136,6 +217,7 @@ protected:
     void MarkUploadPolicyDirty();
     void RefreshUploadPolicyRegistration();
     void UnregisterUploadPolicyClient();
+    void RefreshDirectWriteRegistration();
 
     virtual void OnBackingMaterialized() {}
 
@@ -150,8 +232,16 @@ protected:
 
 private:
     uint64_t m_backingGeneration = 0;
+    std::optional<BufferAliasPlacement> m_backingAliasPlacement;
+    std::unique_ptr<GpuBufferBacking> m_parkedBacking;
+    BufferAliasPlacement m_parkedAliasPlacement{};
+    bool m_parkedDescriptorsStale = false;
+    GrowthPolicy m_growthPolicy{};
+    std::optional<uint64_t> m_bytesUsedHighWater;
+    ResizeStats m_resizeStats{};
     rg::runtime::UploadPolicyTag m_uploadPolicyTag = rg::runtime::UploadPolicyTag::Immediate;
     bool m_uploadPolicyRegistered = false;
+    bool m_directWriteRegistered = false;
 };
 
 class ViewedDynamicBufferBase : public BufferBase {
@@ -3,6 +3,7 @@
 #include <rhi.h>
 #include <resource_states.h>
 
+#include "RenderPasses/Base/PassReturn.h"
 #include "Resources/Resource.h"
 #include "Resources/ResourceStateTracker.h"
 
@@ -10,6 +11,13 @@
 // swapchain image).  Does NOT allocate or free the underlying GPU resource;
 // the caller retains ownership.  Provides the SymbolicTracker and barrier
 // generation the render-graph needs for automatic state tracking.
+//
+// Textures produced outside the graph (video decode, capture, another
+// device's shared handle opened by the host) are imported the same way,
+// without a copy: each frame the producer calls ImportFrame with the
+// texture it wrote and the timeline point that signals the write.  Every
+// batch whose passes touch the texture waits on that point before its
+// transitions, on the queue the batch runs on.
 class ExternalTextureResource : public Resource {
 public:
     ExternalTextureResource(rhi::ResourceHandle handle,
@@ -72,6 +80,30 @@ public:
         m_width = width;
         m_height = height;
     }
+    // Hands this frame's contents over.  The producer releases the texture
+    // in the common layout, so the tracker restarts there; a new handle
+    // (e.g. the next surface of a decoder's ring) swaps in with it.
+    void ImportFrame(rhi::ResourceHandle handle, ExternalTimelinePoint readyPoint) {
+        m_handle = handle;
+        m_readyPoint = readyPoint;
+        ResetToCommon();
+    }
+    void ImportFrame(rhi::ResourceHandle handle,
+                     unsigned int width,
+                     unsigned int height,
+                     ExternalTimelinePoint readyPoint) {
+        SetDimensions(width, height);
+        ImportFrame(handle, readyPoint);
+    }
+
+    // Timeline point the graph waits on before the first use of the
+    // imported contents.  Waits on a point that has already completed are
+    // elided at submit.
+    bool HasReadyPoint() const { return m_readyPoint.timeline.IsValid() && m_readyPoint.value != 0; }
+    const ExternalTimelinePoint& GetReadyPoint() const { return m_readyPoint; }
+    void SetReadyPoint(ExternalTimelinePoint readyPoint) { m_readyPoint = readyPoint; }
+    void ClearReadyPoint() { m_readyPoint = {}; }
+
     void SetRTVSlot(rhi::DescriptorSlot slot) { m_rtvSlot = slot; }
     bool HasRTVSlot() const { return m_rtvSlot.heap.valid(); }
     rhi::DescriptorSlot GetRTVSlot() const { return m_rtvSlot; }
@@ -103,4 +135,5 @@ private:
     rhi::TextureBarrier   m_barrier{};
     SymbolicTracker       m_stateTracker;
     rhi::DescriptorSlot   m_rtvSlot{};
+    ExternalTimelinePoint m_readyPoint{};
 };
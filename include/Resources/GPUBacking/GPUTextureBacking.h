@@ -47,6 +47,9 @@ public:
 	static unsigned int DumpLiveTextures();
 
 	rhi::Resource GetAPIResource() { return m_textureHandle.GetResource(); }
+	TrackedHandle& GetAllocationHandle() { return m_textureHandle; }
+	const TextureDescription& GetDescription() const { return m_desc; }
+	uint64_t GetAllocationSizeBytes() const { return m_allocationSizeBytes; }
 
 	//rhi::HeapHandle GetPlacedResourceHeap() const {
 	//	return m_placedResourceHeap;
@@ -93,6 +96,7 @@ private:
 	unsigned int m_mipLevels;
 	unsigned int m_arraySize;
 	TrackedHandle m_textureHandle;
+	uint64_t m_allocationSizeBytes = 0;
 	rhi::Format m_format;
 	TextureDescription m_desc;
 
@@ -5,6 +5,8 @@
 #include "spdlog/spdlog.h"
 #include "Resources/HeapIndexInfo.h"
 
+struct DeferredSubresourceViews; // See DescriptorHeapManager
+
 class GloballyIndexedResourceBase : public Resource {
 public:
 	GloballyIndexedResourceBase() : Resource() {};
@@ -53,12 +55,14 @@ public:
 		}
 		m_SRVViews[static_cast<unsigned int>(type)] = {heap, infos};
 		m_pSRVHeap = heap;
+		++m_descriptorSlotVersion;
 	}
 
 	void SetUAVGPUDescriptors(std::shared_ptr<DescriptorHeap> pUAVHeap, const std::vector<std::vector<ShaderVisibleIndexInfo>>& uavInfos, size_t counterOffset = 0) {
 		m_pUAVShaderVisibleHeap = pUAVHeap;
 		m_UAVShaderVisibleInfos = uavInfos;
 		m_counterOffset = counterOffset;
+		++m_descriptorSlotVersion;
 	}
 
 	void SetUAVView(
@@ -68,6 +72,7 @@ public:
 	) {
 		m_UAVViews[static_cast<unsigned int>(type)] = { heap, infos };
 		m_pUAVShaderVisibleHeap = heap;
+		++m_descriptorSlotVersion;
 	}
 
 	void SetUAVCPUDescriptors(std::shared_ptr<DescriptorHeap> pUAVHeap, const std::vector<std::vector<NonShaderVisibleIndexInfo>>& uavInfos) {
@@ -78,6 +83,7 @@ public:
 	void SetCBVDescriptor(std::shared_ptr<DescriptorHeap> pCBVHeap, const ShaderVisibleIndexInfo& cbvInfo) {
 		m_pCBVHeap = pCBVHeap;
 		m_CBVInfo = cbvInfo;
+		++m_descriptorSlotVersion;
 	}
 
 	void SetRTVDescriptors(std::shared_ptr<DescriptorHeap> pRTVHeap, const std::vector<std::vector<NonShaderVisibleIndexInfo>>& rtvInfos) {
@@ -149,8 +155,22 @@ public:
 			return;
 		}
 		m_primaryViewType = type;
+		++m_descriptorSlotVersion;
 	}
 
+	// Bumped whenever a shader-visible slot or the default SRV view changes, so cached descriptor
+	// indices (see ResourceDescriptorIndexTable) can be revalidated without re-reading every view.
+	uint64_t GetDescriptorSlotVersion() const { return m_descriptorSlotVersion; }
+
+	// Identifies what the current slots were last written with (API resource handle and view
+	// requirements), so DescriptorHeapManager can skip rewriting identical views. 0 means unwritten.
+	uint64_t GetDescriptorContentsKey() const { return m_descriptorContentsKey; }
+	void SetDescriptorContentsKey(uint64_t key) { m_descriptorContentsKey = key; }
+
+	// Views left unwritten under lazySubresourceDescriptorViews; their slots are already reserved.
+	const std::shared_ptr<DeferredSubresourceViews>& GetDeferredSubresourceViews() const { return m_deferredSubresourceViews; }
+	void SetDeferredSubresourceViews(std::shared_ptr<DeferredSubresourceViews> views) { m_deferredSubresourceViews = std::move(views); }
+
 	bool HasAnyDescriptorSlots() const {
 		if (m_CBVInfo.slot.heap.valid()) {
 			return true;
@@ -245,18 +265,16 @@ protected:
 		m_pDSVHeap.reset();
 		m_counterOffset = 0;
 		m_primaryViewType = SRVViewType::Invalid;
+		m_descriptorContentsKey = 0;
+		m_deferredSubresourceViews.reset();
+		++m_descriptorSlotVersion;
 
 		return slots;
 	}
 
 	void ReleaseDescriptorSlots() {
 		auto slots = DetachDescriptorSlotsForDeferredRelease();
-		for (auto& [heap, index] : slots) {
-			if (!heap) {
-				continue;
-			}
-			heap->ReleaseDescriptor(index);
-		}
+		DescriptorHeap::ReleaseDescriptorSlots(slots);
 	}
 private:
 	struct SRVView {
@@ -281,6 +299,9 @@ private:
 	std::vector<std::vector<NonShaderVisibleIndexInfo>> m_DSVInfos;
 	std::shared_ptr<DescriptorHeap> m_pDSVHeap = nullptr;
 	size_t m_counterOffset = 0;
+	uint64_t m_descriptorContentsKey = 0;
+	uint64_t m_descriptorSlotVersion = 0;
+	std::shared_ptr<DeferredSubresourceViews> m_deferredSubresourceViews;
 
 	SRVViewType m_primaryViewType = SRVViewType::Invalid;
 
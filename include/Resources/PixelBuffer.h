@@ -16,6 +16,9 @@
 
 class GpuTextureBacking;
 
+// Every materialized PixelBuffer is fully backed: committed, or placed in an alias pool. There is
+// no reserved (tiled) mode, because the RHI can neither create a resource without memory nor queue
+// a tile mapping update, and both would need new RHI entry points first.
 class PixelBuffer : public GloballyIndexedResource, public BackedResource, public IHasMemoryMetadata {
 public:
     struct MaterializeOptions {
@@ -82,6 +85,8 @@ public:
 
     bool HasValidBackingResource() const;
 
+    TrackedHandle* GetCommittedAllocation() override;
+
     uint64_t GetBackingGeneration() const override {
         return m_backingGeneration;
     }
@@ -124,6 +129,12 @@ public:
 
     void Dematerialize();
 
+    // Dematerialize, but keep an alias-placed backing aside so the next Materialize with the same
+    // placement rebinds it without recreating the API resource or rewriting descriptors.
+    void ParkAliasedBacking();
+    void ReleaseParkedBacking();
+    std::optional<TextureAliasPlacement> GetParkedAliasPlacement() const;
+
     void EnsureVirtualDescriptorSlotsAllocated() override;
 
     ~PixelBuffer() override;
@@ -137,6 +148,9 @@ private:
     void ApplyMetadataComponentBundle(const EntityComponentBundle& bundle) override;
 
     std::unique_ptr<GpuTextureBacking> m_backing;
+    std::optional<TextureAliasPlacement> m_backingAliasPlacement;
+    std::unique_ptr<GpuTextureBacking> m_parkedBacking;
+    TextureAliasPlacement m_parkedAliasPlacement{};
 	TextureDescription m_desc;
     mutable std::vector<EntityComponentBundle> m_metadataBundles;
     uint64_t m_backingGeneration = 0;
@@ -6,7 +6,9 @@
 #include <functional>
 #include <memory>
 #include <cstddef>
+#include <span>
 
+#include "Render/PassInputs.h"
 #include "Render/QueueKind.h"
 #include "Resources/Resource.h"
 #include "Resources/ResourceStateTracker.h"
@@ -25,28 +27,99 @@ enum class ReadbackResourceKind : uint8_t {
     Texture
 };
 
+// Reductions run on the GPU before the copy so only their result is read back. Texel is a
+// plain one-texel copy; the others are recorded by the IReadbackReducer registered for the kind
+// (see ReadbackReductionPass) and produce ReadbackReductionResultBytes(desc) bytes:
+//   Sum       float4: per-channel sums
+//   MinMax    float4 min, then float4 max
+//   Histogram histogramBins uint32 counts of luminance over [histogramMin, histogramMax)
+enum class ReadbackReductionKind : uint8_t {
+    None = 0,
+    Texel,
+    Sum,
+    MinMax,
+    Histogram,
+};
+
+struct ReadbackReductionDesc {
+    ReadbackReductionKind kind = ReadbackReductionKind::None;
+    uint32_t x = 0; // Texel coordinates in the first mip and slice of the range
+    uint32_t y = 0;
+    uint32_t histogramBins = 0;
+    float histogramMin = 0.0f;
+    float histogramMax = 1.0f;
+
+    RG_DEFINE_PASS_INPUTS(
+        ReadbackReductionDesc,
+        &ReadbackReductionDesc::kind,
+        &ReadbackReductionDesc::x,
+        &ReadbackReductionDesc::y,
+        &ReadbackReductionDesc::histogramBins,
+        &ReadbackReductionDesc::histogramMin,
+        &ReadbackReductionDesc::histogramMax);
+};
+
+inline uint64_t ReadbackReductionResultBytes(const ReadbackReductionDesc& desc) {
+    switch (desc.kind) {
+    case ReadbackReductionKind::Sum:
+        return 4 * sizeof(float);
+    case ReadbackReductionKind::MinMax:
+        return 8 * sizeof(float);
+    case ReadbackReductionKind::Histogram:
+        return static_cast<uint64_t>(desc.histogramBins) * sizeof(uint32_t);
+    default:
+        return 0;
+    }
+}
+
 struct ReadbackCaptureDesc {
     ReadbackResourceKind kind = ReadbackResourceKind::Buffer;
     uint64_t resourceId = 0;
     RangeSpec range;
+    ReadbackReductionDesc reduction; // What `data` holds when kind != None
 };
 
 struct ReadbackCaptureResult {
     ReadbackCaptureDesc desc;
     std::vector<rhi::CopyableFootprint> layouts;
     std::vector<std::byte> data;
+    // With ReadbackCallbackDispatch::Worker the capture is not copied: `data` stays empty and
+    // mappedData views the readback page, which stays reserved until the last copy of
+    // mappedLease is dropped. Bytes() returns whichever one is set.
+    std::span<const std::byte> mappedData;
+    std::shared_ptr<const void> mappedLease;
     rhi::Format format = rhi::Format::Unknown;
     uint32_t width = 0;
     uint32_t height = 0;
     uint32_t depth = 0;
+
+    std::span<const std::byte> Bytes() const {
+        return mappedLease ? mappedData : std::span<const std::byte>(data);
+    }
 };
 
 using ReadbackCaptureCallback = std::function<void(ReadbackCaptureResult&&)>;
 
+// A sub-allocation of a persistently mapped readback page; see ReadbackPagePool.
+struct ReadbackAllocation {
+    std::shared_ptr<Resource> buffer;
+    uint64_t offset = 0;
+    const std::byte* mapped = nullptr; // Mapping of `buffer` at `offset`
+};
+
+// Placement alignment for texture footprints and buffer copies in readback pages.
+inline constexpr uint64_t kReadbackTextureDataAlignment = 512;
+inline constexpr uint64_t kReadbackBufferDataAlignment = 256;
+
 struct ReadbackCaptureRequest {
     uint64_t token = 0;
     ReadbackCaptureDesc desc;
     std::shared_ptr<Resource> readbackBuffer;
+    // Set when readbackBuffer is a pooled page (ReadbackManager::AllocateReadback) rather than
+    // a buffer of its own; the capture's data starts at readbackOffset.
+    uint64_t readbackOffset = 0;
+    const std::byte* mappedData = nullptr;
+    QueueKind readbackPoolQueueKind = QueueKind::Graphics;
     std::shared_ptr<rhi::TimelinePtr> signalFenceOwner;
     std::vector<rhi::CopyableFootprint> layouts;
     uint64_t totalSize = 0;
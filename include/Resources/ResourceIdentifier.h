@@ -1,52 +1,84 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <string_view>
 #include <cassert>
 #include <functional>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <unordered_set>
 
 #include "Resources/ResourceStateTracker.h"
 
 template<typename T> struct ReflectNamespaceTag {};
 
+// A "A::B::C" resource name. The name is a view into static storage: a string literal for
+// "..."_rid identifiers, or a process-lifetime intern pool for names built at runtime. Copies are
+// two words and the hash is computed once, so pass declarations and registry lookups do not
+// allocate after a name has been seen for the first time.
 struct ResourceIdentifier {
-    // e.g. {"Builtin","GBuffer","Normals"}
-    std::vector<std::string> segments;
-	size_t hash = 0;
-    std::string name;
-    ResourceIdentifier() = default;
-
-    // parse "A::B::C"
-    ResourceIdentifier(std::string_view s) {
+    // Normalized "A::B::C" (a trailing "::" is dropped, as the segment parse always did)
+    std::string_view name;
+    size_t hash = HashName({});
+
+    constexpr ResourceIdentifier() = default;
+
+    // Interns s, so calls with a name that has been seen before do not allocate. Throws
+    // std::invalid_argument for a non-empty name with no segments ("::", "::::"), which would
+    // otherwise collide with the unnamed identifier.
+    ResourceIdentifier(std::string_view s) : ResourceIdentifier(StaticStorage{}, Intern(NormalizeNamed(s))) {}
+    ResourceIdentifier(const std::string& s) : ResourceIdentifier(std::string_view(s)) {}
+    ResourceIdentifier(char const* s) : ResourceIdentifier(std::string_view{ s }) {}
+
+    // For names whose storage outlives every identifier, such as string literals.
+    struct StaticStorage {};
+    constexpr ResourceIdentifier(StaticStorage, std::string_view normalizedName) noexcept
+        : name(normalizedName), hash(HashName(normalizedName)) {}
+
+    // FNV-1a over the normalized name.
+    static constexpr size_t HashName(std::string_view normalizedName) noexcept {
+        uint64_t h = 0xcbf29ce484222325ull;
+        for (char c : normalizedName) {
+            h ^= static_cast<uint8_t>(c);
+            h *= 0x100000001b3ull;
+        }
+        return static_cast<size_t>(h);
+    }
+
+    // Cuts s after the last segment the "::" split produces.
+    static constexpr std::string_view Normalize(std::string_view s) noexcept {
         size_t start = 0;
+        size_t end = 0;
         while (start < s.size()) {
             auto pos = s.find("::", start);
             if (pos == std::string_view::npos) pos = s.size();
-            segments.emplace_back(s.substr(start, pos - start));
+            end = pos;
             start = pos + 2;
         }
-		hash = Hasher{}(*this);
-        name = s;
+        return s.substr(0, end);
     }
 
-    // String constructor
-	ResourceIdentifier(const std::string& s) : ResourceIdentifier(std::string_view(s)) {}
+    std::string ToString() const {
+        return std::string(name);
+    }
 
-    // direct-from-literal ctor:
-    ResourceIdentifier(char const* s) : ResourceIdentifier(std::string_view{ s }){}
+    bool IsEmpty() const noexcept {
+        return name.empty();
+    }
 
-    // join back into "A::B::C"
-    std::string ToString() const {
-        std::string out;
-        for (size_t i = 0; i < segments.size(); ++i) {
-            if (i) out += "::";
-            out += segments[i];
+    size_t SegmentCount() const noexcept {
+        if (name.empty()) return 0;
+        size_t count = 1;
+        for (size_t pos = name.find("::"); pos != std::string_view::npos; pos = name.find("::", pos + 2)) {
+            ++count;
         }
-        return out;
+        return count;
     }
 
     bool operator==(ResourceIdentifier const& o) const noexcept {
-        return segments == o.segments;
+        return hash == o.hash && name == o.name;
     }
     bool operator!=(ResourceIdentifier const& o) const noexcept {
         return !(*this == o);
@@ -55,21 +87,58 @@ struct ResourceIdentifier {
     // does this id start with prefix P?  (i.e. P is a namespace
     // under which *this* lives)
     bool hasPrefix(ResourceIdentifier const& p) const noexcept {
-        if (p.segments.size() > segments.size()) return false;
-        return std::equal(p.segments.begin(), p.segments.end(),
-            segments.begin());
+        if (p.name.empty()) return true;
+        if (!name.starts_with(p.name)) return false;
+        return name.size() == p.name.size() || name.substr(p.name.size(), 2) == "::";
     }
 
     struct Hasher {
         size_t operator()(ResourceIdentifier const& id) const noexcept {
-            size_t h = 0;
-            for (auto& seg : id.segments)
-                h = h * 31 + std::hash<std::string>()(seg);
-            return h;
+            return id.hash;
         }
     };
+
+private:
+    static std::string_view NormalizeNamed(std::string_view s) {
+        const std::string_view normalized = Normalize(s);
+        if (normalized.empty() && !s.empty()) {
+            throw std::invalid_argument("ResourceIdentifier name \"" + std::string(s) + "\" has no segments");
+        }
+        return normalized;
+    }
+
+    static std::string_view Intern(std::string_view normalizedName) {
+        struct Pool {
+            struct TransparentHash {
+                using is_transparent = void;
+                size_t operator()(std::string_view v) const noexcept { return HashName(v); }
+            };
+            std::shared_mutex mutex;
+            std::unordered_set<std::string, TransparentHash, std::equal_to<>> names; // Nodes never move
+        };
+        static Pool pool;
+
+        if (normalizedName.empty()) return {};
+        {
+            std::shared_lock lock(pool.mutex);
+            if (auto it = pool.names.find(normalizedName); it != pool.names.end()) return *it;
+        }
+        std::unique_lock lock(pool.mutex);
+        return *pool.names.emplace(normalizedName).first;
+    }
 };
 
+namespace rg::literals {
+    // "Builtin::GBuffer::Normals"_rid: hashed at compile time, no intern lookup.
+    consteval ResourceIdentifier operator""_rid(char const* s, size_t n) {
+        const std::string_view name{ s, n };
+        if (ResourceIdentifier::Normalize(name) != name) {
+            throw "_rid names must not end in \"::\"";
+        }
+        return ResourceIdentifier(ResourceIdentifier::StaticStorage{}, name);
+    }
+}
+
 namespace std {
     template<>
     struct hash<ResourceIdentifier> {
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <vector>
 #include <resource_states.h>
 #include <span>
 #include <string>
+#include <utility>
 
 #include "Render/PassInputs.h"
 
@@ -54,7 +57,48 @@ struct RangeSpec {
     Bound sliceLower = { BoundType::All, 0 };
     Bound sliceUpper = { BoundType::All, 0 };
 
-    RG_DEFINE_PASS_INPUTS(RangeSpec, &RangeSpec::mipLower, &RangeSpec::mipUpper, &RangeSpec::sliceLower, &RangeSpec::sliceUpper);
+    // Canonical 64-bit encoding: 16 bits per bound, the type in the top two and the value in the
+    // rest, with the value zeroed for All since it is ignored there. Exact only when Packable(),
+    // i.e. no bound value exceeds kPackedValueMax; equality and hashing fall back to the fields
+    // otherwise, so both stay consistent across packed and unpacked specs.
+    static constexpr uint32_t kPackedValueBits = 14;
+    static constexpr uint32_t kPackedValueMax = (1u << kPackedValueBits) - 1;
+
+    static constexpr uint64_t PackBound(Bound const& b) noexcept {
+        const uint64_t value = b.type == BoundType::All ? 0 : (b.value & kPackedValueMax);
+        return (static_cast<uint64_t>(b.type) << kPackedValueBits) | value;
+    }
+    constexpr bool Packable() const noexcept {
+        return (mipLower.value | mipUpper.value | sliceLower.value | sliceUpper.value) <= kPackedValueMax;
+    }
+    constexpr uint64_t Packed() const noexcept {
+        return PackBound(mipLower)
+            | (PackBound(mipUpper) << 16)
+            | (PackBound(sliceLower) << 32)
+            | (PackBound(sliceUpper) << 48);
+    }
+
+    friend bool operator==(RangeSpec const& a, RangeSpec const& b) noexcept {
+        if (a.Packable() && b.Packable()) {
+            return a.Packed() == b.Packed();
+        }
+        auto same = [](Bound const& x, Bound const& y) {
+            return x.type == y.type && (x.type == BoundType::All || x.value == y.value);
+        };
+        return same(a.mipLower, b.mipLower) && same(a.mipUpper, b.mipUpper)
+            && same(a.sliceLower, b.sliceLower) && same(a.sliceUpper, b.sliceUpper);
+    }
+    friend rg::Hash64 HashValue(RangeSpec const& r) noexcept {
+        if (r.Packable()) {
+            return rg::HashCombine(0, r.Packed());
+        }
+        rg::Hash64 seed = 0;
+        for (Bound const* b : std::array<Bound const*, 4>{ &r.mipLower, &r.mipUpper, &r.sliceLower, &r.sliceUpper }) {
+            seed = rg::HashCombine(seed, static_cast<uint64_t>(b->type));
+            seed = rg::HashCombine(seed, b->type == BoundType::All ? 0 : b->value);
+        }
+        return seed;
+    }
 };
 
 struct SubresourceRange {
@@ -67,10 +111,29 @@ struct SubresourceRange {
 	}
 };
 
+inline bool Overlaps(SubresourceRange const& a, SubresourceRange const& b) noexcept {
+	return a.firstMip < b.firstMip + b.mipCount && b.firstMip < a.firstMip + a.mipCount
+		&& a.firstSlice < b.firstSlice + b.sliceCount && b.firstSlice < a.firstSlice + a.sliceCount;
+}
+
+inline bool RangeContains(SubresourceRange const& outer, SubresourceRange const& inner) noexcept {
+	return inner.firstMip >= outer.firstMip && inner.firstMip + inner.mipCount <= outer.firstMip + outer.mipCount
+		&& inner.firstSlice >= outer.firstSlice && inner.firstSlice + inner.sliceCount <= outer.firstSlice + outer.sliceCount;
+}
+
 SubresourceRange ResolveRangeSpec(const RangeSpec& spec,
     uint32_t totalMips,
     uint32_t totalSlices);
 
+// Which half of a split barrier a transition is. A split barrier begins right after the
+// last use of the old state and ends right before the first use of the new one; the two
+// halves carry identical ranges, accesses and layouts and are linked through SyncSplit.
+enum class TransitionSplit : uint8_t {
+    None,
+    Begin,
+    End,
+};
+
 struct ResourceTransition {
     ResourceTransition() = default;
     ResourceTransition(Resource* pResource, RangeSpec range, rhi::ResourceAccessType prevAccessType, rhi::ResourceAccessType newAccessType, rhi::ResourceLayout prevLayout, rhi::ResourceLayout newLayout, rhi::ResourceSyncState prevSyncState, rhi::ResourceSyncState newSyncState, bool discard = false)
@@ -85,15 +148,89 @@ struct ResourceTransition {
     rhi::ResourceSyncState prevSyncState = rhi::ResourceSyncState::None;
     rhi::ResourceSyncState newSyncState = rhi::ResourceSyncState::None;
     bool discard = false;
+    TransitionSplit split = TransitionSplit::None;
 };
 
+// True for transitions worth splitting: texture layout changes, which are the ones that
+// stall on large render targets. Access-only changes are cheap enough to stay whole.
+bool IsSplitBarrierCandidate(const ResourceTransition& transition);
+
+// Returns the {begin, end} halves of a whole transition.
+std::pair<ResourceTransition, ResourceTransition> SplitTransition(const ResourceTransition& transition);
+
 struct Segment {
     RangeSpec     rangeSpec;
     ResourceState state;
 };
 
+// True when every bound is All, i.e. the spec covers the whole resource whatever its size.
+inline bool IsWholeRangeSpec(const RangeSpec& range) noexcept {
+    return range.mipLower.type == BoundType::All
+        && range.mipUpper.type == BoundType::All
+        && range.sliceLower.type == BoundType::All
+        && range.sliceUpper.type == BoundType::All;
+}
+
+// Segment list with inline room for the handful of segments a tracker nearly always holds,
+// so copying or rebuilding a tracker does not allocate. Spills to the heap past that.
+class SegmentList {
+public:
+    static constexpr size_t kInlineCapacity = 4;
+
+    SegmentList() = default;
+
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+    Segment* data() noexcept { return m_onHeap ? m_heap.data() : m_inline.data(); }
+    const Segment* data() const noexcept { return m_onHeap ? m_heap.data() : m_inline.data(); }
+    Segment* begin() noexcept { return data(); }
+    Segment* end() noexcept { return data() + m_size; }
+    const Segment* begin() const noexcept { return data(); }
+    const Segment* end() const noexcept { return data() + m_size; }
+    Segment& operator[](size_t index) noexcept { return data()[index]; }
+    const Segment& operator[](size_t index) const noexcept { return data()[index]; }
+    Segment& back() noexcept { return data()[m_size - 1]; }
+
+    void clear() noexcept {
+        m_size = 0;
+        m_onHeap = false;
+        m_heap.clear();
+    }
+
+    void push_back(const Segment& segment) {
+        if (!m_onHeap && m_size == kInlineCapacity) {
+            m_heap.assign(m_inline.begin(), m_inline.end());
+            m_onHeap = true;
+        }
+        if (m_onHeap) {
+            m_heap.push_back(segment);
+        }
+        else {
+            m_inline[m_size] = segment;
+        }
+        ++m_size;
+    }
+
+    // Drops everything after the first count segments.
+    void resize_down(size_t count) noexcept {
+        if (count >= m_size) {
+            return;
+        }
+        if (m_onHeap) {
+            m_heap.resize(count);
+        }
+        m_size = static_cast<uint32_t>(count);
+    }
+
+private:
+    std::array<Segment, kInlineCapacity> m_inline{};
+    std::vector<Segment> m_heap;
+    uint32_t m_size = 0;
+    bool m_onHeap = false;
+};
+
 class SymbolicTracker {
-    std::vector<Segment> _segs;
+    SegmentList _segs;
 public:
     SymbolicTracker() {
 		RangeSpec whole;
@@ -118,7 +255,7 @@ public:
 
     std::vector<Segment> Flatten(ResourceState const& skipState, bool includeSkipState = false) const;
 
-    const std::vector<Segment>& GetSegments() const noexcept;
+    std::span<const Segment> GetSegments() const noexcept;
 
     void CopyFrom(const SymbolicTracker& other);
 };
@@ -1,7 +1,10 @@
 #pragma once
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <cstring>
 #include <unordered_map>
+#include <vector>
 #include <rhi.h>
 
 namespace rhi {
@@ -129,9 +132,60 @@ namespace rhi {
 
 }
 
+class Sampler;
+
+// Read-mostly cache of samplers by canonical desc. Lookups read an immutable snapshot through one
+// atomic load, so they never lock; an insert copies the snapshot under a mutex and publishes the
+// copy. Superseded snapshots stay alive until the cache is destroyed, which is cheap because an
+// application only ever has a few dozen distinct samplers.
+class SamplerCache {
+public:
+    using Map = std::unordered_map<rhi::SamplerDesc, std::shared_ptr<Sampler>, rhi::SamplerDescHash, rhi::SamplerDescEq>;
+
+    SamplerCache() {
+        m_snapshots.push_back(std::make_unique<const Map>());
+        m_current.store(m_snapshots.back().get(), std::memory_order_release);
+    }
+
+    SamplerCache(const SamplerCache&) = delete;
+    SamplerCache& operator=(const SamplerCache&) = delete;
+
+    std::shared_ptr<Sampler> Find(const rhi::SamplerDesc& desc) const {
+        const Map* map = m_current.load(std::memory_order_acquire);
+        auto it = map->find(desc);
+        return it != map->end() ? it->second : nullptr;
+    }
+
+    // `create` runs at most once per distinct desc, under the insert lock.
+    template<class CreateFn>
+    std::shared_ptr<Sampler> FindOrCreate(const rhi::SamplerDesc& desc, CreateFn&& create) {
+        if (auto existing = Find(desc)) {
+            return existing;
+        }
+
+        std::lock_guard<std::mutex> lock(m_insertMutex);
+        const Map* current = m_current.load(std::memory_order_relaxed);
+        if (auto it = current->find(desc); it != current->end()) {
+            return it->second;
+        }
+        std::shared_ptr<Sampler> sampler = create();
+        auto next = std::make_unique<Map>(*current);
+        next->emplace(rhi::canonicalize(desc), sampler);
+        m_snapshots.push_back(std::move(next));
+        m_current.store(m_snapshots.back().get(), std::memory_order_release);
+        return sampler;
+    }
+
+private:
+    std::atomic<const Map*> m_current{ nullptr };
+    std::vector<std::unique_ptr<const Map>> m_snapshots; // Guarded by m_insertMutex
+    std::mutex m_insertMutex;
+};
+
 class Sampler {
 public:
-        static std::shared_ptr<Sampler> CreateSampler(rhi::SamplerDesc samplerDesc);
+    // Repeat descs return the cached sampler without taking a lock.
+    static std::shared_ptr<Sampler> CreateSampler(rhi::SamplerDesc samplerDesc);
     ~Sampler() {
     }
 
@@ -152,7 +206,5 @@ private:
     rhi::SamplerDesc m_samplerDesc; // Descriptor of the sampler
     Sampler(rhi::SamplerDesc samplerDesc);
 
-    static std::shared_ptr<Sampler> m_defaultSampler;
-	static std::shared_ptr<Sampler> m_defaultShadowSampler;
-	static std::unordered_map<rhi::SamplerDesc, std::shared_ptr<Sampler>, rhi::SamplerDescHash, rhi::SamplerDescEq> m_samplerCache;
+    static SamplerCache m_samplerCache;
 };
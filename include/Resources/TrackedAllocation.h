@@ -113,7 +113,8 @@ struct TrackedEntityToken {
                     return;
                 }
 
-                if (deferredState->world && deferredState->id && s_hooks.isMainThread && s_hooks.isMainThread()) {
+                // Without a main-thread hook there is no later drain, so a resolved token applies directly.
+                if (deferredState->world && deferredState->id && (!s_hooks.isMainThread || s_hooks.isMainThread())) {
                     resolvedWorld = deferredState->world;
                     resolvedId = deferredState->id;
                     applyImmediately = true;
@@ -312,6 +313,12 @@ public:
         return {};
     }
 
+    // Hands the entity back so the API object can be released on another thread while the
+    // entity is destroyed on the thread that owns the world.
+    TrackedEntityToken TakeEntityToken() noexcept {
+        return std::move(tok_);
+    }
+
     rhi::ma::Allocation* GetAllocation() noexcept {
         if (auto* p = std::get_if<rhi::ma::AllocationPtr>(&h_)) {
             return p->Get();
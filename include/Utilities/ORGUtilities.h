@@ -1,5 +1,14 @@
 #pragma once
 
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
 namespace rg::util {
 
     inline std::wstring s2ws(const std::string_view& utf8)
@@ -72,4 +81,133 @@ namespace rg::util {
     inline uint16_t CalculateMipLevels(uint16_t width, uint16_t height) {
         return static_cast<uint16_t>(std::floor(std::log2((std::max)(width, height)))) + 1;
     }
-}
\ No newline at end of file
+
+    // Fast non-cryptographic hashing for cache keys and fingerprints, after wyhash: values are
+    // folded through a 64x64->128-bit multiply, and byte ranges are consumed 16 or 48 bytes at a
+    // time instead of one field at a time. Results are stable within a build; anything persisted
+    // with them must carry a format version.
+    namespace hash_detail {
+        inline constexpr uint64_t kSecret0 = 0xa0761d6478bd642full;
+        inline constexpr uint64_t kSecret1 = 0xe7037ed1a0b428dbull;
+        inline constexpr uint64_t kSecret2 = 0x8ebc6af09c88c6e3ull;
+        inline constexpr uint64_t kSecret3 = 0x589965cc75374cc3ull;
+
+        // Replaces a and b with the low and high halves of a * b.
+        inline void Multiply(uint64_t& a, uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+            a = static_cast<uint64_t>(product);
+            b = static_cast<uint64_t>(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            const uint64_t aHi = a >> 32, aLo = static_cast<uint32_t>(a);
+            const uint64_t bHi = b >> 32, bLo = static_cast<uint32_t>(b);
+            const uint64_t hh = aHi * bHi, hl = aHi * bLo, lh = aLo * bHi, ll = aLo * bLo;
+            const uint64_t mid = (ll >> 32) + static_cast<uint32_t>(hl) + static_cast<uint32_t>(lh);
+            a = (mid << 32) | static_cast<uint32_t>(ll);
+            b = hh + (hl >> 32) + (lh >> 32) + (mid >> 32);
+#endif
+        }
+
+        inline uint64_t Mix(uint64_t a, uint64_t b) noexcept {
+            Multiply(a, b);
+            return a ^ b;
+        }
+
+        inline uint64_t Read64(const uint8_t* p) noexcept {
+            uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t Read32(const uint8_t* p) noexcept {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t Read3(const uint8_t* p, size_t size) noexcept {
+            return (uint64_t(p[0]) << 16) | (uint64_t(p[size >> 1]) << 8) | p[size - 1];
+        }
+    }
+
+    // Folds value into seed. Replaces HashCombine-style chains where each field is hashed alone.
+    inline uint64_t HashMix64(uint64_t seed, uint64_t value) noexcept {
+        return hash_detail::Mix(seed ^ hash_detail::kSecret0, value ^ hash_detail::kSecret1);
+    }
+
+    inline uint64_t HashBytes64(const void* data, size_t size, uint64_t seed = 0) noexcept {
+        using namespace hash_detail;
+        const auto* p = static_cast<const uint8_t*>(data);
+        seed ^= Mix(seed ^ kSecret0, kSecret1);
+        uint64_t a = 0;
+        uint64_t b = 0;
+        if (size <= 16) {
+            if (size >= 4) {
+                const size_t step = (size >> 3) << 2;
+                a = (Read32(p) << 32) | Read32(p + step);
+                b = (Read32(p + size - 4) << 32) | Read32(p + size - 4 - step);
+            }
+            else if (size > 0) {
+                a = Read3(p, size);
+            }
+        }
+        else {
+            size_t remaining = size;
+            if (remaining > 48) {
+                uint64_t lane1 = seed;
+                uint64_t lane2 = seed;
+                do {
+                    seed = Mix(Read64(p) ^ kSecret1, Read64(p + 8) ^ seed);
+                    lane1 = Mix(Read64(p + 16) ^ kSecret2, Read64(p + 24) ^ lane1);
+                    lane2 = Mix(Read64(p + 32) ^ kSecret3, Read64(p + 40) ^ lane2);
+                    p += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= lane1 ^ lane2;
+            }
+            while (remaining > 16) {
+                seed = Mix(Read64(p) ^ kSecret1, Read64(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+            a = Read64(p + remaining - 16);
+            b = Read64(p + remaining - 8);
+        }
+        a ^= kSecret1;
+        b ^= seed;
+        Multiply(a, b);
+        return Mix(a ^ kSecret0 ^ size, b ^ kSecret1);
+    }
+
+    inline uint64_t HashString64(std::string_view value, uint64_t seed = 0) noexcept {
+        return HashBytes64(value.data(), value.size(), seed);
+    }
+
+    // Hashes the object representation of a span at once. Only for types without padding, so
+    // equal values always hash equal.
+    template<class T>
+    uint64_t HashPod64(std::span<const T> values, uint64_t seed = 0) noexcept {
+        static_assert(std::is_trivially_copyable_v<T> && std::has_unique_object_representations_v<T>,
+            "HashPod64 requires a trivially copyable type without padding");
+        return HashBytes64(values.data(), values.size_bytes(), seed);
+    }
+
+    template<class T>
+    uint64_t HashPod64(const T& value, uint64_t seed = 0) noexcept {
+        return HashPod64(std::span<const T>(&value, 1), seed);
+    }
+
+    // Two independently seeded 64-bit hashes, for keys whose collisions would be re-checked
+    // field by field on every lookup.
+    struct Hash128 {
+        uint64_t lo = 0;
+        uint64_t hi = 0;
+        friend bool operator==(const Hash128&, const Hash128&) = default;
+    };
+
+    inline Hash128 HashBytes128(const void* data, size_t size, uint64_t seed = 0) noexcept {
+        return { HashBytes64(data, size, seed), HashBytes64(data, size, seed ^ hash_detail::kSecret2) };
+    }
+}
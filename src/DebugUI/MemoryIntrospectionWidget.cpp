@@ -59,15 +59,19 @@ namespace ui {
         ImGui::Separator();
 
         MemorySnapshot dummyMem;
-        const MemorySnapshot* ms = snapshot;
+        const MemorySnapshot* ms = snapshot ? snapshot : (hasRetained_ ? &retained_ : nullptr);
         if (ms == nullptr || (ms->categories.empty() && ms->resources.empty())) {
             dummyMem = MakeDummySnapshot();
             ms = &dummyMem;
         }
-        MemorySnapshot localMem = *ms;
-        if (localMem.totalBytes == 0) {
-            localMem.totalBytes = ComputeTotalBytes(localMem);
+        // Only copy when the total has to be filled in; large snapshots are drawn in place.
+        MemorySnapshot totaledMem;
+        if (ms->totalBytes == 0) {
+            totaledMem = *ms;
+            totaledMem.totalBytes = ComputeTotalBytes(totaledMem);
+            ms = &totaledMem;
         }
+        const MemorySnapshot& localMem = *ms;
 
         FrameGraphSnapshot dummyFG;
         const FrameGraphSnapshot* fg = frameGraph;
@@ -92,6 +96,47 @@ namespace ui {
         ImGui::End();
     }
 
+    void MemoryIntrospectionWidget::ApplySnapshotDelta(const MemorySnapshotDelta& delta) {
+        auto& rows = retained_.resources;
+        if (delta.reset) {
+            rows.clear();
+            retainedIndexByUid_.clear();
+            retained_.totalBytes = 0;
+        }
+
+        for (uint64_t uid : delta.removedUids) {
+            auto it = retainedIndexByUid_.find(uid);
+            if (it == retainedIndexByUid_.end()) {
+                continue;
+            }
+            const size_t index = it->second;
+            retained_.totalBytes -= rows[index].bytes;
+            retainedIndexByUid_.erase(it);
+            if (index + 1 != rows.size()) {
+                rows[index] = std::move(rows.back());
+                retainedIndexByUid_[rows[index].uid] = index;
+            }
+            rows.pop_back();
+        }
+
+        for (const auto& row : delta.upserted) {
+            auto [it, inserted] = retainedIndexByUid_.try_emplace(row.uid, rows.size());
+            if (inserted) {
+                rows.push_back(row);
+            }
+            else {
+                retained_.totalBytes -= rows[it->second].bytes;
+                rows[it->second] = row;
+            }
+            retained_.totalBytes += row.bytes;
+        }
+
+        if (!delta.categories.empty()) {
+            retained_.categories = delta.categories;
+        }
+        hasRetained_ = true;
+    }
+
     void MemoryIntrospectionWidget::DrawToolbar() {
         int v = static_cast<int>(view_);
 
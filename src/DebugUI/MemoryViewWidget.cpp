@@ -301,6 +301,12 @@ namespace ui {
             resource,
             range,
             [this](ReadbackCaptureResult&& r) {
+                // The widget keeps its result across frames, so don't pin a readback page for it.
+                if (r.mappedLease) {
+                    r.data.assign(r.mappedData.begin(), r.mappedData.end());
+                    r.mappedData = {};
+                    r.mappedLease.reset();
+                }
                 std::scoped_lock cbLock(mutex_);
                 result_ = std::move(r);
                 waiting_ = false;
@@ -473,16 +479,38 @@ namespace ui {
         else if (r.format == rhi::Format::R32G32B32A32_Float || r.format == rhi::Format::R32G32B32A32_Typeless) {
             ImGui::TextDisabled("Preview normalizes float4 channels across this subresource for readability; typeless is treated as float.");
         }
+        else if (r.format == rhi::Format::BC6H_UF16 || r.format == rhi::Format::BC6H_SF16 || r.format == rhi::Format::BC6H_Typeless) {
+            ImGui::TextDisabled("Preview is decoded by the GPU; HDR values outside [0, 1] are clamped.");
+        }
 
         if (previewDirty_) {
             previewDirty_ = false;
 
-            // Decode to RGBA8
-            auto rgba8 = DecodeSubresourceToRGBA8(r.data.data(), r.data.size(), fp, r.format);
-            if (rgba8.empty()) {
-                ReleasePreviewTexture();
-                ImGui::TextDisabled("Format not supported for preview (%d).", static_cast<int>(r.format));
-                return;
+            // Block-compressed data is uploaded as-is and decoded by the sampler; everything else
+            // is decoded to RGBA8 here.
+            const rhi::Format blockFormat = BlockCompressedPreviewFormat(r.format);
+            const bool gpuDecoded = blockFormat != rhi::Format::Unknown;
+            const rhi::Format previewFormat = gpuDecoded ? blockFormat : rhi::Format::R8G8B8A8_UNorm;
+            // Block-compressed textures are sized in whole 4x4 blocks.
+            const uint32_t previewTexWidth = gpuDecoded ? ((fp.width + 3u) & ~3u) : fp.width;
+            const uint32_t previewTexHeight = gpuDecoded ? ((fp.height + 3u) & ~3u) : fp.height;
+            const size_t blockRowCount = previewTexHeight / 4u;
+
+            std::vector<uint8_t> rgba8;
+            if (gpuDecoded) {
+                if (fp.offset + static_cast<size_t>(fp.rowPitch) * blockRowCount > r.data.size()) {
+                    ReleasePreviewTexture();
+                    ImGui::TextDisabled("Readback data is smaller than the subresource footprint.");
+                    return;
+                }
+            }
+            else {
+                rgba8 = DecodeSubresourceToRGBA8(r.data.data(), r.data.size(), fp, r.format);
+                if (rgba8.empty()) {
+                    ReleasePreviewTexture();
+                    ImGui::TextDisabled("Format not supported for preview (%d).", static_cast<int>(r.format));
+                    return;
+                }
             }
 
             // Check if we have descriptor callbacks
@@ -501,9 +529,9 @@ namespace ui {
             texDesc.heapType = rhi::HeapType::DeviceLocal;
             texDesc.resourceFlags = rhi::ResourceFlags::RF_None;
             texDesc.debugName = "MemViewPreview";
-            texDesc.texture.format = rhi::Format::R8G8B8A8_UNorm;
-            texDesc.texture.width = fp.width;
-            texDesc.texture.height = fp.height;
+            texDesc.texture.format = previewFormat;
+            texDesc.texture.width = previewTexWidth;
+            texDesc.texture.height = previewTexHeight;
             texDesc.texture.depthOrLayers = 1;
             texDesc.texture.mipLevels = 1;
             texDesc.texture.sampleCount = 1;
@@ -539,16 +567,23 @@ namespace ui {
             cmdList->Barriers(copyDestBarrierBatch);
 
             rhi::helpers::SubresourceData subData{};
-            subData.pData = rgba8.data();
-            subData.rowPitch = fp.width * 4;
-            subData.slicePitch = fp.width * fp.height * 4;
+            if (gpuDecoded) {
+                subData.pData = r.data.data() + fp.offset;
+                subData.rowPitch = fp.rowPitch;
+                subData.slicePitch = static_cast<size_t>(fp.rowPitch) * blockRowCount;
+            }
+            else {
+                subData.pData = rgba8.data();
+                subData.rowPitch = fp.width * 4;
+                subData.slicePitch = fp.width * fp.height * 4;
+            }
 
             previewUploadBuffer_ = rhi::helpers::UpdateTextureSubresources(
                 device,
                 cmdList.Get(),
                 previewTexture_.Get(),
-                rhi::Format::R8G8B8A8_UNorm,
-                fp.width, fp.height, 1,
+                previewFormat,
+                previewTexWidth, previewTexHeight, 1,
                 1, 1,
                 rhi::Span<const rhi::helpers::SubresourceData>(&subData, 1));
 
@@ -579,7 +614,7 @@ namespace ui {
 
             rhi::SrvDesc srvDesc{};
             srvDesc.dimension = rhi::SrvDim::Texture2D;
-            srvDesc.formatOverride = rhi::Format::R8G8B8A8_UNorm;
+            srvDesc.formatOverride = previewFormat;
             srvDesc.tex2D.mipLevels = 1;
             srvDesc.tex2D.mostDetailedMip = 0;
 
@@ -3,11 +3,12 @@
 #include "imgui.h"
 #include "implot.h"
 #include <algorithm>
+#include <bit>
 #include <tuple>
-#include <sstream>
 #include <rhi_helpers.h>
 
 #include "Render/QueueKind.h"
+#include "Utilities/ORGUtilities.h"
 
 struct BatchLayout {
     // Absolute X (plot coords) for this batch
@@ -313,6 +314,251 @@ static void DrawArrowBetweenLanes(ImDrawList* dl,
     }
 }
 
+struct ResourceRow {
+    uint64_t id = 0;
+    std::string name;
+    std::string label;      // "name [id]" or "#id"
+    std::string lowerLabel; // For the filter
+    Resource* ptr = nullptr;
+};
+
+// A cross-queue wait, resolved to the batch and phase that signals it.
+struct WaitArrow {
+    int batchIndex = -1;
+    size_t dstSlot = 0;
+    size_t srcSlot = 0;
+    RenderGraph::BatchWaitPhase phase = RenderGraph::BatchWaitPhase::BeforeTransitions;
+    SignalSite signal;
+};
+
+// Everything Show derives from the batches. The graph recompiles every frame, so the model is
+// keyed by a signature of the schedule's structure and rebuilt only when that changes; an open
+// inspector then costs the rows and batches actually on screen rather than the whole graph.
+struct InspectorModel {
+    bool valid = false;
+    uint64_t signature = 0;
+    std::vector<BatchLayout> layouts;
+    double totalWidth = 1.0;
+    std::vector<WaitArrow> waitArrows;
+    std::vector<std::string> slotLabels;
+    std::vector<ResourceRow> resources; // Sorted by label
+    std::vector<std::vector<std::string>> passNamesByBatch;
+    std::vector<std::string> anchorPassByBatch;
+
+    // Derived views, each rebuilt when its inputs change.
+    bool visibleRowsValid = false;
+    int visibleRowsBatchFilter = -1;
+    std::string visibleRowsFilterText;
+    std::vector<uint32_t> visibleResourceRows;
+
+    bool touchesValid = false;
+    uint64_t touchesSelectedResource = 0;
+    std::vector<uint8_t> passBlockTouchesSelected; // [batch * slotCount + slot]
+};
+
+// Structural identity of the compiled schedule: what the model caches, without the fence values
+// (they advance every frame) or the transition details that drawing reads live.
+static uint64_t ComputeScheduleSignature(const std::vector<RenderGraph::PassBatch>& batches,
+    const QueueRegistry& registry,
+    const RGInspectorOptions& opts)
+{
+    using rg::util::HashMix64;
+    uint64_t h = HashMix64(0x5247494e53504543ull, batches.size());
+    h = HashMix64(h, registry.SlotCount());
+    for (float v : { opts.blockLeftTransitions, opts.blockWidthTransitions, opts.blockGap, opts.blockWidthPasses, opts.blockWidthBatchEnd }) {
+        h = HashMix64(h, std::bit_cast<uint32_t>(v));
+    }
+    for (const auto& b : batches) {
+        const size_t queueCount = b.QueueCount();
+        h = HashMix64(h, queueCount);
+        for (size_t qi = 0; qi < queueCount; ++qi) {
+            for (const auto& queuedPass : b.Passes(qi)) {
+                std::visit([&](const auto* pass) {
+                    h = HashMix64(h, reinterpret_cast<uintptr_t>(pass));
+                    h = rg::util::HashString64(pass->name, h);
+                }, queuedPass);
+            }
+            for (size_t phaseIndex = 0; phaseIndex < static_cast<size_t>(RenderGraph::BatchTransitionPhase::Count); ++phaseIndex) {
+                const auto& transitions = b.Transitions(qi, static_cast<RenderGraph::BatchTransitionPhase>(phaseIndex));
+                h = HashMix64(h, transitions.size());
+                for (const auto& t : transitions) {
+                    h = HashMix64(h, reinterpret_cast<uintptr_t>(t.pResource));
+                }
+            }
+            uint64_t syncBits = (b.HasQueueSignal(RenderGraph::BatchSignalPhase::AfterTransitions, qi) ? 1ull : 0ull)
+                | (b.HasQueueSignal(RenderGraph::BatchSignalPhase::AfterCompletion, qi) ? 2ull : 0ull);
+            for (size_t srcSlot = 0; srcSlot < queueCount; ++srcSlot) {
+                for (size_t phaseIndex = 0; phaseIndex < static_cast<size_t>(RenderGraph::BatchWaitPhase::Count); ++phaseIndex) {
+                    if (srcSlot != qi && b.HasQueueWait(static_cast<RenderGraph::BatchWaitPhase>(phaseIndex), qi, srcSlot)) {
+                        syncBits = HashMix64(syncBits, (srcSlot << 8) | phaseIndex);
+                    }
+                }
+            }
+            h = HashMix64(h, syncBits);
+        }
+        h = rg::util::HashBytes64(b.allResources.data(), b.allResources.size() * sizeof(uint64_t), h);
+        h = rg::util::HashBytes64(b.internallyTransitionedResources.data(), b.internallyTransitionedResources.size() * sizeof(uint64_t), h);
+    }
+    return h;
+}
+
+static std::vector<std::string> BuildSlotLabels(const QueueRegistry& registry)
+{
+    const size_t numSlots = registry.SlotCount();
+    auto slotKind = [&](size_t qi) -> QueueKind {
+        return registry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(qi)));
+    };
+    std::vector<std::string> slotLabels(numSlots);
+    std::array<int, static_cast<size_t>(QueueKind::Count)> kindCount{};
+    for (size_t qi = 0; qi < numSlots; ++qi) {
+        ++kindCount[static_cast<size_t>(slotKind(qi))];
+    }
+    auto kindName = [](QueueKind k) -> const char* {
+        switch (k) {
+        case QueueKind::Graphics: return "Graphics";
+        case QueueKind::Compute:  return "Compute";
+        case QueueKind::Copy:     return "Copy";
+        default:                  return "Queue";
+        }
+    };
+    for (size_t qi = 0; qi < numSlots; ++qi) {
+        auto kind = slotKind(qi);
+        auto inst = registry.GetInstance(static_cast<QueueSlotIndex>(static_cast<uint8_t>(qi)));
+        if (kindCount[static_cast<size_t>(kind)] > 1) {
+            slotLabels[qi] = std::string(kindName(kind)) + "[" + std::to_string(inst) + "]";
+        } else {
+            slotLabels[qi] = kindName(kind);
+        }
+    }
+    return slotLabels;
+}
+
+static void RebuildInspectorModel(InspectorModel& model,
+    uint64_t signature,
+    const std::vector<RenderGraph::PassBatch>& batches,
+    const QueueRegistry& registry,
+    const RGResourceNameByIdFn& resourceNameById,
+    const RGResourcePtrByIdFn& resourcePtrById,
+    const RGInspectorOptions& opts)
+{
+    model = InspectorModel{};
+    model.valid = true;
+    model.signature = signature;
+    model.layouts = BuildBatchLayouts(batches, opts);
+    model.totalWidth = model.layouts.empty() ? 1.0 : (model.layouts.back().baseX + model.layouts.back().width);
+    model.slotLabels = BuildSlotLabels(registry);
+
+    const SignalIndex sigIdx = BuildSignalIndex(batches);
+    for (int bi = 0; bi < static_cast<int>(batches.size()); ++bi) {
+        const auto& b = batches[bi];
+        for (size_t dstSlot = 0; dstSlot < b.QueueCount(); ++dstSlot) {
+            for (size_t srcSlot = 0; srcSlot < b.QueueCount(); ++srcSlot) {
+                if (dstSlot == srcSlot) {
+                    continue;
+                }
+                for (size_t phaseIndex = 0; phaseIndex < static_cast<size_t>(RenderGraph::BatchWaitPhase::Count); ++phaseIndex) {
+                    const auto phase = static_cast<RenderGraph::BatchWaitPhase>(phaseIndex);
+                    if (!b.HasQueueWait(phase, dstSlot, srcSlot)) {
+                        continue;
+                    }
+                    auto signalIt = sigIdx.find({ srcSlot, b.GetQueueWaitFenceValue(phase, dstSlot, srcSlot) });
+                    if (signalIt != sigIdx.end()) {
+                        model.waitArrows.push_back(WaitArrow{ bi, dstSlot, srcSlot, phase, signalIt->second });
+                    }
+                }
+            }
+        }
+    }
+
+    std::unordered_map<uint64_t, std::string> idToName;
+    std::unordered_map<uint64_t, Resource*> idToPtr;
+    CollectResourceIds(batches, idToName, idToPtr, resourceNameById, resourcePtrById);
+    model.resources.reserve(idToName.size());
+    for (auto& [id, name] : idToName) {
+        ResourceRow row;
+        row.id = id;
+        row.label = name.empty() ? ("#" + std::to_string(id)) : name + " [" + std::to_string(id) + "]";
+        row.lowerLabel = row.label;
+        std::transform(row.lowerLabel.begin(), row.lowerLabel.end(), row.lowerLabel.begin(), ::tolower);
+        row.name = std::move(name);
+        auto ptrIt = idToPtr.find(id);
+        row.ptr = ptrIt != idToPtr.end() ? ptrIt->second : nullptr;
+        model.resources.push_back(std::move(row));
+    }
+    std::sort(model.resources.begin(), model.resources.end(), [](const ResourceRow& a, const ResourceRow& b) {
+        return a.lowerLabel < b.lowerLabel;
+    });
+
+    model.passNamesByBatch.resize(batches.size());
+    model.anchorPassByBatch.resize(batches.size());
+    for (size_t bi = 0; bi < batches.size(); ++bi) {
+        auto& names = model.passNamesByBatch[bi];
+        for (size_t qi = 0; qi < batches[bi].QueueCount(); ++qi) {
+            for (auto const& queuedPass : batches[bi].Passes(qi)) {
+                names.push_back(std::visit([](const auto* pass) { return pass->name; }, queuedPass));
+            }
+        }
+        model.anchorPassByBatch[bi] = GetBatchAnchorPassName(batches[bi]);
+    }
+}
+
+static void RebuildVisibleResourceRows(InspectorModel& model,
+    const std::vector<RenderGraph::PassBatch>& batches,
+    int batchFilter,
+    const std::string& lowerFilter)
+{
+    std::unordered_set<uint64_t> allowedResourceIds;
+    if (batchFilter >= 0 && batchFilter < static_cast<int>(batches.size())) {
+        CollectBatchResourceIds(batches[batchFilter], allowedResourceIds);
+    }
+    model.visibleResourceRows.clear();
+    for (uint32_t row = 0; row < static_cast<uint32_t>(model.resources.size()); ++row) {
+        const auto& resource = model.resources[row];
+        if (batchFilter >= 0 && allowedResourceIds.find(resource.id) == allowedResourceIds.end()) {
+            continue;
+        }
+        if (!lowerFilter.empty() && resource.lowerLabel.find(lowerFilter) == std::string::npos) {
+            continue;
+        }
+        model.visibleResourceRows.push_back(row);
+    }
+    model.visibleRowsValid = true;
+    model.visibleRowsBatchFilter = batchFilter;
+    model.visibleRowsFilterText = lowerFilter;
+}
+
+static void RebuildPassBlockTouches(InspectorModel& model,
+    const std::vector<RenderGraph::PassBatch>& batches,
+    size_t numSlots,
+    uint64_t selectedRes,
+    const RGPassUsesResourceFn& passUses)
+{
+    model.passBlockTouchesSelected.assign(batches.size() * numSlots, 0);
+    if (selectedRes != 0 && passUses) {
+        for (size_t bi = 0; bi < batches.size(); ++bi) {
+            for (size_t qi = 0; qi < std::min(numSlots, batches[bi].QueueCount()); ++qi) {
+                for (auto const& queuedPass : batches[bi].Passes(qi)) {
+                    const bool usesSelected = std::visit(
+                        [&](const auto& pass) {
+                            using TPass = std::remove_pointer_t<std::decay_t<decltype(pass)>>;
+                            constexpr int passKind =
+                                std::is_same_v<TPass, RenderGraph::ComputePassAndResources> ? 1 :
+                                std::is_same_v<TPass, RenderGraph::CopyPassAndResources> ? 2 : 0;
+                            return pass != nullptr && passUses(static_cast<const void*>(pass), selectedRes, passKind);
+                        },
+                        queuedPass);
+                    if (usesSelected) {
+                        model.passBlockTouchesSelected[bi * numSlots + qi] = 1;
+                        break;
+                    }
+                }
+            }
+        }
+    }
+    model.touchesValid = true;
+    model.touchesSelectedResource = selectedRes;
+}
+
 namespace RGInspector {
 
     void Show(const std::vector<RenderGraph::PassBatch>& batches,
@@ -333,9 +579,17 @@ namespace RGInspector {
             return registry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(qi)));
         };
 
-        SignalIndex sigIdx = BuildSignalIndex(batches);
-        auto layouts = BuildBatchLayouts(batches, opts);
-        double totalW = layouts.empty() ? 1.0 : (layouts.back().baseX + layouts.back().width);
+        static InspectorModel s_model;
+        static bool s_refreshRequested = false;
+        const uint64_t signature = ComputeScheduleSignature(batches, registry, opts);
+        const bool modelRebuilt = !s_model.valid || s_model.signature != signature || s_refreshRequested;
+        if (modelRebuilt) {
+            RebuildInspectorModel(s_model, signature, batches, registry, resourceNameById, resourcePtrById, opts);
+            s_refreshRequested = false;
+        }
+        const auto& layouts = s_model.layouts;
+        const double totalW = s_model.totalWidth;
+        const auto& slotLabels = s_model.slotLabels;
 
         // Left panel: resource picker
         static uint64_t s_selectedRes = 0;
@@ -356,72 +610,88 @@ namespace RGInspector {
             s_memoryViewCallbacksWired = true;
         }
         static char filterBuf[128] = {};
-        std::unordered_map<uint64_t, std::string> idToName;
-        std::unordered_map<uint64_t, Resource*> idToPtr;
-        CollectResourceIds(batches, idToName, idToPtr, resourceNameById, resourcePtrById);
 
         if (s_filterBatchResources >= static_cast<int>(batches.size())) {
             s_filterBatchResources = -1;
         }
 
-        std::unordered_set<uint64_t> allowedResourceIds;
-        if (s_filterBatchResources >= 0 && s_filterBatchResources < static_cast<int>(batches.size())) {
-            CollectBatchResourceIds(batches[s_filterBatchResources], allowedResourceIds);
-        }
+        auto selectResource = [&](uint64_t id, Resource* ptr) {
+            s_selectedRes = id;
+            s_selectedResPtr = ptr;
+            if (!s_selectedResPtr && id != 0 && resourcePtrById) {
+                s_selectedResPtr = resourcePtrById(id);
+            }
+        };
+        // Drops the selection when the given batch does not use it.
+        auto keepSelectionInBatch = [&](int batchIndex) {
+            if (s_selectedRes == 0) {
+                return;
+            }
+            std::unordered_set<uint64_t> allowed;
+            CollectBatchResourceIds(batches[batchIndex], allowed);
+            if (allowed.find(s_selectedRes) == allowed.end()) {
+                selectResource(0, nullptr);
+            }
+        };
 
         ImGui::BeginChild("LeftPanel", ImVec2(320, 0), true);
 
         const float capturePanelHeight = 190.0f;
         ImGui::BeginChild("LeftPanelResources", ImVec2(0, -capturePanelHeight), false);
 
-        ImGui::TextUnformatted("Resources");
+        if (opts.culledPassNames && !opts.culledPassNames->empty()) {
+            const std::string culledHeader = "Culled Passes (" + std::to_string(opts.culledPassNames->size()) + ")";
+            if (ImGui::CollapsingHeader(culledHeader.c_str())) {
+                ImGuiListClipper clipper;
+                clipper.Begin(static_cast<int>(opts.culledPassNames->size()));
+                while (clipper.Step()) {
+                    for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                        ImGui::BulletText("%s", (*opts.culledPassNames)[i].c_str());
+                    }
+                }
+            }
+        }
+
+        ImGui::Text("Resources (%d)", static_cast<int>(s_model.resources.size()));
+        ImGui::SameLine();
+        if (ImGui::SmallButton("Refresh")) {
+            s_refreshRequested = true; // Resource names can change without the schedule changing
+        }
         if (s_filterBatchResources >= 0) {
             ImGui::Text("Batch Filter: %d", s_filterBatchResources);
             ImGui::SameLine();
             if (ImGui::SmallButton("Clear Batch Filter")) {
                 s_filterBatchResources = -1;
-                allowedResourceIds.clear();
             }
         }
         ImGui::InputTextWithHint("##resfilter", "filter...", filterBuf, IM_ARRAYSIZE(filterBuf));
 
         std::string f = filterBuf;
         std::transform(f.begin(), f.end(), f.begin(), ::tolower);
+        if (!s_model.visibleRowsValid || s_model.visibleRowsBatchFilter != s_filterBatchResources || s_model.visibleRowsFilterText != f) {
+            RebuildVisibleResourceRows(s_model, batches, s_filterBatchResources, f);
+        }
 
-        for (auto& kv : idToName) {
-            const uint64_t id = kv.first;
-
-            if (s_filterBatchResources >= 0) {
-                if (allowedResourceIds.find(id) == allowedResourceIds.end()) {
-                    continue;
-                }
-            }
-
-            std::string label = kv.second.empty() ? ("#" + std::to_string(id)) : kv.second + " [" + std::to_string(id) + "]";
-            std::string lcl = label; std::transform(lcl.begin(), lcl.end(), lcl.begin(), ::tolower);
-            if (!f.empty() && lcl.find(f) == std::string::npos) {
-                continue;
-            }
-
-            bool sel = (s_selectedRes == id);
-            if (ImGui::Selectable(label.c_str(), sel)) {
-                s_selectedRes = id;
-                auto it = idToPtr.find(id);
-                s_selectedResPtr = (it != idToPtr.end()) ? it->second : nullptr;
-                if (!s_selectedResPtr && resourcePtrById) {
-                    s_selectedResPtr = resourcePtrById(id);
+        {
+            ImGuiListClipper clipper;
+            clipper.Begin(static_cast<int>(s_model.visibleResourceRows.size()));
+            while (clipper.Step()) {
+                for (int visibleRow = clipper.DisplayStart; visibleRow < clipper.DisplayEnd; ++visibleRow) {
+                    const auto& row = s_model.resources[s_model.visibleResourceRows[visibleRow]];
+                    bool sel = (s_selectedRes == row.id);
+                    if (ImGui::Selectable(row.label.c_str(), sel)) {
+                        selectResource(row.id, row.ptr);
+                    }
+                    if (ImGui::IsItemHovered() && !row.name.empty()) {
+                        ImGui::SetTooltip("%s", row.name.c_str());
+                    }
                 }
             }
-            if (ImGui::IsItemHovered() && !kv.second.empty()) {
-                ImGui::SetTooltip("%s", kv.second.c_str());
-            }
         }
         if (ImGui::Button("Clear Selection")) {
-            s_selectedRes = 0;
-            s_selectedResPtr = nullptr;
+            selectResource(0, nullptr);
             // Also clear the batch filter so the UI obviously resets.
             s_filterBatchResources = -1;
-            allowedResourceIds.clear();
         }
 
         ImGui::EndChild();
@@ -435,33 +705,13 @@ namespace RGInspector {
             if (ImGui::SliderInt("Batch", &s_selectedBatch, 0, static_cast<int>(batches.size()) - 1)) {
                 // Keep the batch resource filter in sync with the slider.
                 s_filterBatchResources = s_selectedBatch;
-
-                if (s_selectedRes != 0) {
-                    std::unordered_set<uint64_t> sliderAllowed;
-                    CollectBatchResourceIds(batches[s_selectedBatch], sliderAllowed);
-                    if (sliderAllowed.find(s_selectedRes) == sliderAllowed.end()) {
-                        s_selectedRes = 0;
-                        s_selectedResPtr = nullptr;
-                    }
-                }
+                keepSelectionInBatch(s_selectedBatch);
             }
 
             // Pass selector (used for memory capture insertion point)
             {
-                std::vector<std::string> passNames;
-                size_t totalPassCount = 0;
-                for (size_t qi = 0; qi < batches[s_selectedBatch].QueueCount(); ++qi) {
-                    totalPassCount += batches[s_selectedBatch].Passes(qi).size();
-                }
-                passNames.reserve(totalPassCount);
-
-                for (size_t qi = 0; qi < batches[s_selectedBatch].QueueCount(); ++qi) {
-                    for (auto const& queuedPass : batches[s_selectedBatch].Passes(qi)) {
-                        passNames.push_back(std::visit([](const auto* pass) { return pass->name; }, queuedPass));
-                    }
-                }
-
-                const std::string anchor = GetBatchAnchorPassName(batches[s_selectedBatch]);
+                const auto& passNames = s_model.passNamesByBatch[s_selectedBatch];
+                const std::string& anchor = s_model.anchorPassByBatch[s_selectedBatch];
                 auto findIndex = [&](const std::string& name) -> int {
                     for (int i = 0; i < static_cast<int>(passNames.size()); ++i) {
                         if (passNames[i] == name) {
@@ -471,7 +721,7 @@ namespace RGInspector {
                     return -1;
                 };
 
-                if (s_selectedPassName.empty() || (!s_selectedPassName.empty() && findIndex(s_selectedPassName) < 0)) {
+                if (s_selectedPassName.empty() || findIndex(s_selectedPassName) < 0) {
                     s_selectedPassName = anchor;
                     if (s_selectedPassName.empty() && !passNames.empty()) {
                         s_selectedPassName = passNames[0];
@@ -488,13 +738,17 @@ namespace RGInspector {
 
                 const char* preview = passNames.empty() ? "(no passes)" : passNames[passIndex].c_str();
                 if (ImGui::BeginCombo("Pass", preview, ImGuiComboFlags_HeightLarge)) {
-                    for (int i = 0; i < static_cast<int>(passNames.size()); ++i) {
-                        bool isSel = (i == passIndex);
-                        if (ImGui::Selectable(passNames[i].c_str(), isSel)) {
-                            s_selectedPassName = passNames[i];
-                        }
-                        if (isSel) {
-                            ImGui::SetItemDefaultFocus();
+                    ImGuiListClipper clipper;
+                    clipper.Begin(static_cast<int>(passNames.size()));
+                    while (clipper.Step()) {
+                        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                            bool isSel = (i == passIndex);
+                            if (ImGui::Selectable(passNames[i].c_str(), isSel)) {
+                                s_selectedPassName = passNames[i];
+                            }
+                            if (isSel) {
+                                ImGui::SetItemDefaultFocus();
+                            }
                         }
                     }
                     ImGui::EndCombo();
@@ -542,47 +796,30 @@ namespace RGInspector {
 
         ImGui::SameLine();
 
+        if (!s_model.touchesValid || s_model.touchesSelectedResource != s_selectedRes) {
+            RebuildPassBlockTouches(s_model, batches, numSlots, s_selectedRes, passUses);
+        }
+
         // --- Right panel: plot ---
         ImGui::BeginGroup();
         ImGui::Checkbox("Show Cached Regions", &s_showCacheRegions);
         ImGui::SameLine();
         ImGui::TextDisabled("green = cached replay, red = dynamic/uncached");
         if (ImPlot::BeginPlot("##RGPlot", ImVec2(-1, -1), ImPlotFlags_CanvasOnly)) {
-            // Axes: X = batch index [0..N], Y = lanes
+            // Axes: X = batch index [0..N], Y = lanes. X is fitted when the schedule changes and
+            // can be zoomed and panned otherwise; only batches inside the view are drawn.
             ImPlot::SetupAxes(nullptr, nullptr, ImPlotAxisFlags_NoTickLabels, ImPlotAxisFlags_NoTickLabels);
-            ImPlot::SetupAxisLimits(ImAxis_X1, -0.1, totalW + 0.1, ImGuiCond_Always);
+            ImPlot::SetupAxisLimits(ImAxis_X1, -0.1, totalW + 0.1, modelRebuilt ? ImGuiCond_Always : ImGuiCond_Once);
             const float H = opts.rowHeight;
             const float S = opts.laneSpacing;
             const float topLaneY = (numSlots > 0) ? LaneY(0, numSlots, H, S) : 0.0f;
             ImPlot::SetupAxisLimits(ImAxis_Y1, -S, topLaneY + H + S, ImGuiCond_Always);
 
             ImDrawList* dl = ImPlot::GetPlotDrawList();
-
-            // Build per-slot labels
-            std::vector<std::string> slotLabels(numSlots);
-            {
-                std::array<int, static_cast<size_t>(QueueKind::Count)> kindCount{};
-                for (size_t qi = 0; qi < numSlots; ++qi) {
-                    ++kindCount[static_cast<size_t>(slotKind(qi))];
-                }
-                auto kindName = [](QueueKind k) -> const char* {
-                    switch (k) {
-                    case QueueKind::Graphics: return "Graphics";
-                    case QueueKind::Compute:  return "Compute";
-                    case QueueKind::Copy:     return "Copy";
-                    default:                  return "Queue";
-                    }
-                };
-                for (size_t qi = 0; qi < numSlots; ++qi) {
-                    auto kind = slotKind(qi);
-                    auto inst = registry.GetInstance(static_cast<QueueSlotIndex>(static_cast<uint8_t>(qi)));
-                    if (kindCount[static_cast<size_t>(kind)] > 1) {
-                        slotLabels[qi] = std::string(kindName(kind)) + "[" + std::to_string(inst) + "]";
-                    } else {
-                        slotLabels[qi] = kindName(kind);
-                    }
-                }
-            }
+            const ImPlotRect view = ImPlot::GetPlotLimits();
+            auto spanVisible = [&](double x0, double x1) {
+                return x1 >= view.X.Min && x0 <= view.X.Max;
+            };
 
             // Grid: lane separators + labels
             for (size_t qi = 0; qi < numSlots; ++qi) {
@@ -590,13 +827,20 @@ namespace RGInspector {
                 ImPlotPoint a(-0.25, y - 0.05);
                 ImPlotPoint b(static_cast<double>(batches.size()) + 0.25, y + H + 0.05);
                 DrawBlock(dl, a, b, IM_COL32(245, 245, 245, 32), IM_COL32(0, 0, 0, 32), 0.0f);
-                ImVec2 lp = ImPlot::PlotToPixels(ImPlotPoint(-0.2, y + H + 0.18f * S));
+                ImVec2 lp = ImPlot::PlotToPixels(ImPlotPoint(std::max(-0.2, view.X.Min), y + H + 0.18f * S));
                 dl->AddText(lp, IM_COL32(255, 255, 255, 255), slotLabels[qi].c_str());
             }
 
+            // First batch whose slot reaches into the view; layouts are sorted by baseX.
+            const int firstVisibleBatch = static_cast<int>(std::partition_point(layouts.begin(), layouts.end(),
+                [&](const BatchLayout& L) { return L.baseX + L.width < view.X.Min; }) - layouts.begin());
+
             // X grid lines per batch
-            for (int i = 0; i <= static_cast<int>(layouts.size()); ++i) {
+            for (int i = firstVisibleBatch; i <= static_cast<int>(layouts.size()); ++i) {
                 double x = (i == static_cast<int>(layouts.size())) ? totalW : layouts[i].baseX;
+                if (x > view.X.Max) {
+                    break;
+                }
                 ImVec2 p0 = ImPlot::PlotToPixels(ImPlotPoint(x, -S));
                 ImVec2 p1 = ImPlot::PlotToPixels(ImPlotPoint(x, topLaneY + H + S));
                 dl->AddLine(p0, p1, IM_COL32(180, 180, 180, 64), (i % 5 == 0) ? 2.0f : 1.0f);
@@ -616,6 +860,9 @@ namespace RGInspector {
                     }
                     const double x0 = layouts[range.firstBatch].baseX;
                     const double x1 = layouts[lastBatch].baseX + layouts[lastBatch].width;
+                    if (!spanVisible(x0, x1)) {
+                        continue;
+                    }
                     ImVec2 a = ImPlot::PlotToPixels(ImPlotPoint(x0, yMin));
                     ImVec2 b = ImPlot::PlotToPixels(ImPlotPoint(x1, yMax));
                     if (a.x > b.x) {
@@ -715,6 +962,7 @@ namespace RGInspector {
                 }
                 };
 
+
             auto draw_passes = [&](const std::vector<RenderGraph::PassBatch::QueuedPass>& passesVec, size_t qi, int bi) {
                 if (passesVec.empty()) {
                     return;
@@ -725,60 +973,43 @@ namespace RGInspector {
                 ImPlotPoint maxP(L.p1, y + H);
 
                 // Does any pass use the selected resource?
-                bool touchesSelected = false;
-                if (s_selectedRes != 0 && passUses) {
-                    for (auto const& queuedPass : passesVec) {
-                        const bool usesSelected = std::visit(
-                            [&](const auto& pass) {
-                                using TPass = std::remove_pointer_t<std::decay_t<decltype(pass)>>;
-                                constexpr int passKind =
-                                    std::is_same_v<TPass, RenderGraph::ComputePassAndResources> ? 1 :
-                                    std::is_same_v<TPass, RenderGraph::CopyPassAndResources> ? 2 : 0;
-                                return pass != nullptr && passUses(static_cast<const void*>(pass), s_selectedRes, passKind);
-                            },
-                            queuedPass);
-                        if (usesSelected) {
-                            touchesSelected = true;
-                            break;
-                        }
-                    }
-                }
+                const bool touchesSelected = qi < numSlots && s_model.passBlockTouchesSelected[static_cast<size_t>(bi) * numSlots + qi] != 0;
 
                 DrawBlock(dl, minP, maxP,
                     touchesSelected ? ColHighlight() : ColPassForKind(slotKind(qi)),
                     ColBorder());
 
                 // Pass labels (stacked vertically)
-                int n = static_cast<int>(passesVec.size());
                 ImVec2 tp = ImPlot::PlotToPixels(ImPlotPoint((L.p0 + L.p1) * 0.5, y + 0.1 + 0.5f * (H - 0.2f)));
                 dl->AddText(tp, IM_COL32_BLACK, std::to_string(static_cast<int>(passesVec.size())).c_str());
-                //for (int i = 0; i < n; ++i) {
-                //    double u = (i + 0.5) / std::max(1, n);
-                //    ImVec2 tp = ImPlot::PlotToPixels(ImPlotPoint(batchIndex + (xP0 + xP1) * 0.5, y + 0.1 + u * (H - 0.2)));
-                //    const char* name = passesVec[i].name.c_str();
-                //    dl->AddText(tp, IM_COL32_BLACK, name);
-                //}
 
                 // Tooltip for whole pass block
                 if (IsMouseOver(minP, maxP)) {
                     ImGui::BeginTooltip();
                     ImGui::Text("%s Passes (%d)", slotLabels[qi].c_str(), static_cast<int>(passesVec.size()));
-                    for (auto const& queuedPass : passesVec) {
-                        std::visit(
-                            [&](const auto* pass) {
-                                ImGui::BulletText("%s", pass->name.c_str());
-                            },
-                            queuedPass);
+                    ImGuiListClipper clipper;
+                    clipper.Begin(static_cast<int>(passesVec.size()));
+                    while (clipper.Step()) {
+                        for (int i = clipper.DisplayStart; i < clipper.DisplayEnd; ++i) {
+                            std::visit(
+                                [&](const auto* pass) {
+                                    ImGui::BulletText("%s", pass->name.c_str());
+                                },
+                                passesVec[i]);
+                        }
                     }
                     ImGui::EndTooltip();
                 }
                 };
 
-            // Draw all batches
-            for (int bi = 0; bi < static_cast<int>(batches.size()); ++bi) {
+            // Draw the batches inside the view
+            for (int bi = firstVisibleBatch; bi < static_cast<int>(batches.size()); ++bi) {
 
                 const auto& b = batches[bi];
                 const auto& L = layouts[bi];
+                if (L.baseX > view.X.Max) {
+                    break;
+                }
 
                 // Batch hitbox for selection (click anywhere in the batch slot)
                 {
@@ -789,15 +1020,7 @@ namespace RGInspector {
                     if (IsMouseOver(hbMin, hbMax) && ImGui::IsMouseClicked(ImGuiMouseButton_Left)) {
                         s_filterBatchResources = bi;
                         s_selectedBatch = bi;
-
-                        if (s_selectedRes != 0) {
-                            std::unordered_set<uint64_t> clickedAllowed;
-                            CollectBatchResourceIds(b, clickedAllowed);
-                            if (clickedAllowed.find(s_selectedRes) == clickedAllowed.end()) {
-                                s_selectedRes = 0;
-                                s_selectedResPtr = nullptr;
-                            }
-                        }
+                        keepSelectionInBatch(bi);
                     }
 
                     if (s_filterBatchResources == bi) {
@@ -816,67 +1039,39 @@ namespace RGInspector {
                         draw_transitions(b.Transitions(qi, RenderGraph::BatchTransitionPhase::AfterPasses), qi, bi, L.e0, L.e1);
                     }
                 }
+            }
 
-                // Cross-queue waits/signals
-                auto labelFence = [](bool enabled, uint64_t val)->std::string {
-                    if (!enabled) {
-                        return {};
-                    }
-                    std::ostringstream o; 
-                	return o.str();
-                    };
-
-                auto siteToX = [&](const SignalSite& s)->double {
-                    const auto& SL = layouts[s.batchIndex];
-                    switch (s.phase) {
-                    case SignalPhase::AfterTransitions:         return SL.t1;
-                    case SignalPhase::AfterPasses:              return SL.p1;
-                    case SignalPhase::AfterPostTransitions: return SL.e1;
-                    default:                                    return SL.p1;
-                    }
-                    };
-                auto laneCenterY = [&](size_t qi)->float {
-                    return LaneY(qi, numSlots, H, S) + H * 0.5f;
-                    };
-
-                auto waitX_Transitions = [&](int bi)->double { return layouts[bi].t0; };
-                auto waitX_Passes = [&](int bi)->double { return layouts[bi].p0; };
-
-                for (size_t dstSlot = 0; dstSlot < b.QueueCount(); ++dstSlot) {
-                    for (size_t srcSlot = 0; srcSlot < b.QueueCount(); ++srcSlot) {
-                        if (dstSlot == srcSlot) {
-                            continue;
-                        }
-
-                        for (size_t phaseIndex = 0; phaseIndex < static_cast<size_t>(RenderGraph::BatchWaitPhase::Count); ++phaseIndex) {
-                            const auto phase = static_cast<RenderGraph::BatchWaitPhase>(phaseIndex);
-                            if (!b.HasQueueWait(phase, dstSlot, srcSlot)) {
-                                continue;
-                            }
-
-                            const uint64_t fenceValue = b.GetQueueWaitFenceValue(phase, dstSlot, srcSlot);
-                            auto signalIt = sigIdx.find({ srcSlot, fenceValue });
-                            if (signalIt == sigIdx.end()) {
-                                continue;
-                            }
+            // Cross-queue waits, resolved when the model was built
+            auto siteToX = [&](const SignalSite& s)->double {
+                const auto& SL = layouts[s.batchIndex];
+                switch (s.phase) {
+                case SignalPhase::AfterTransitions:         return SL.t1;
+                case SignalPhase::AfterPasses:              return SL.p1;
+                case SignalPhase::AfterPostTransitions: return SL.e1;
+                default:                                    return SL.p1;
+                }
+                };
+            auto laneCenterY = [&](size_t qi)->float {
+                return LaneY(qi, numSlots, H, S) + H * 0.5f;
+                };
 
-                            const auto& signalSite = signalIt->second;
-                            const double waitX = (phase == RenderGraph::BatchWaitPhase::BeforeTransitions)
-                                ? waitX_Transitions(bi)
-                                : waitX_Passes(bi);
-                            const auto label = labelFence(true, fenceValue);
-
-                            DrawArrowBetweenLanes(
-                                dl,
-                                static_cast<float>(siteToX(signalSite)),
-                                laneCenterY(srcSlot),
-                                static_cast<float>(waitX),
-                                laneCenterY(dstSlot),
-                                ColArrowWait(),
-                                label.c_str());
-                        }
-                    }
+            for (const auto& arrow : s_model.waitArrows) {
+                const double signalX = siteToX(arrow.signal);
+                const double waitX = (arrow.phase == RenderGraph::BatchWaitPhase::BeforeTransitions)
+                    ? layouts[arrow.batchIndex].t0
+                    : layouts[arrow.batchIndex].p0;
+                if (!spanVisible(std::min(signalX, waitX), std::max(signalX, waitX))) {
+                    continue;
                 }
+
+                DrawArrowBetweenLanes(
+                    dl,
+                    static_cast<float>(signalX),
+                    laneCenterY(arrow.srcSlot),
+                    static_cast<float>(waitX),
+                    laneCenterY(arrow.dstSlot),
+                    ColArrowWait(),
+                    nullptr);
             }
 
             ImPlot::EndPlot();
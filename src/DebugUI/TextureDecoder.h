@@ -10,6 +10,15 @@
 #include <rhi.h>
 #include <spdlog/spdlog.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64)
+#include <emmintrin.h>
+#define RG_TEXTURE_DECODER_SSE2 1
+#if defined(__F16C__) || defined(__AVX2__)
+#include <immintrin.h>
+#define RG_TEXTURE_DECODER_F16C 1
+#endif
+#endif
+
 namespace ui {
 
     inline float DecodeHalfToFloat(uint16_t h) {
@@ -56,6 +65,178 @@ namespace ui {
         return std::clamp(value, 0.0f, 1.0f);
     }
 
+    inline float DecodeUFloat11ToFloat(uint32_t v) {
+        const uint32_t e = (v >> 6) & 0x1F;
+        const uint32_t m = v & 0x3F;
+        if (e == 0) return (m == 0) ? 0.0f : std::ldexp(static_cast<float>(m) / 64.0f, -14);
+        if (e == 31) return (m == 0) ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+        return std::ldexp(1.0f + static_cast<float>(m) / 64.0f, static_cast<int>(e) - 15);
+    }
+
+    inline float DecodeUFloat10ToFloat(uint32_t v) {
+        const uint32_t e = (v >> 5) & 0x1F;
+        const uint32_t m = v & 0x1F;
+        if (e == 0) return (m == 0) ? 0.0f : std::ldexp(static_cast<float>(m) / 32.0f, -14);
+        if (e == 31) return (m == 0) ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
+        return std::ldexp(1.0f + static_cast<float>(m) / 32.0f, static_cast<int>(e) - 15);
+    }
+
+    // Row decoders for the formats HDR targets use. Each converts a whole row, four texels per
+    // step where SIMD is available, and finishes the tail with the scalar helpers above; both
+    // paths round exactly like FloatToByte.
+    namespace detail {
+
+#if defined(RG_TEXTURE_DECODER_SSE2)
+        // Small-float bits already shifted into float32 position (exponent at bit 23) -> float.
+        // The multiply rebiases the 5-bit exponent and handles denormals; exponent 31 becomes
+        // Inf/NaN. 'infThreshold' is the shifted encoding of exponent 31.
+        inline __m128 RebiasSmallFloat(__m128i shifted, __m128i infThreshold) {
+            const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(shifted), _mm_castsi128_ps(_mm_set1_epi32(0x77800000))); // 2^112
+            const __m128i isInfNan = _mm_cmpgt_epi32(shifted, _mm_sub_epi32(infThreshold, _mm_set1_epi32(1)));
+            const __m128 infNan = _mm_castsi128_ps(_mm_or_si128(shifted, _mm_set1_epi32(0x7F800000)));
+            return _mm_or_ps(_mm_and_ps(_mm_castsi128_ps(isInfNan), infNan), _mm_andnot_ps(_mm_castsi128_ps(isInfNan), scaled));
+        }
+
+        // Four halves (low 64 bits of 'packed') -> floats.
+        inline __m128 HalfToFloat4(__m128i packed) {
+#if defined(RG_TEXTURE_DECODER_F16C)
+            return _mm_cvtph_ps(packed);
+#else
+            const __m128i h = _mm_unpacklo_epi16(packed, _mm_setzero_si128());
+            const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+            const __m128i magnitude = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+            const __m128 value = RebiasSmallFloat(magnitude, _mm_set1_epi32(0x7C00 << 13));
+            return _mm_or_ps(value, _mm_castsi128_ps(sign));
+#endif
+        }
+
+        // FloatToByte on four lanes, as int32 in [0, 255].
+        inline __m128i FloatToByte4(__m128 v) {
+            v = _mm_and_ps(v, _mm_cmpord_ps(v, v)); // NaN -> 0
+            v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+            return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(255.0f)), _mm_set1_ps(0.5f)));
+        }
+
+        // Four gray values -> four opaque RGBA8 texels.
+        inline void StoreGray4(uint8_t* dst, __m128i gray) {
+            const __m128i rgba = _mm_or_si128(
+                _mm_or_si128(gray, _mm_slli_epi32(gray, 8)),
+                _mm_or_si128(_mm_slli_epi32(gray, 16), _mm_set1_epi32(static_cast<int>(0xFF000000u))));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst), rgba);
+        }
+
+        // One texel's four channels -> one RGBA8 texel.
+        inline void StoreTexel(uint8_t* dst, __m128i channels) {
+            const __m128i packed = _mm_packus_epi16(_mm_packs_epi32(channels, channels), _mm_setzero_si128());
+            const int rgba = _mm_cvtsi128_si32(packed);
+            std::memcpy(dst, &rgba, sizeof(rgba));
+        }
+#endif
+
+        inline void DecodeRowR16Float(const uint16_t* src, uint8_t* dst, uint32_t w) {
+            uint32_t x = 0;
+#if defined(RG_TEXTURE_DECODER_SSE2)
+            for (; x + 4 <= w; x += 4) {
+                const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + x));
+                StoreGray4(dst + static_cast<size_t>(x) * 4, FloatToByte4(HalfToFloat4(packed)));
+            }
+#endif
+            for (; x < w; ++x) {
+                uint8_t* texel = dst + static_cast<size_t>(x) * 4;
+                texel[0] = texel[1] = texel[2] = FloatToByte(DecodeHalfToFloat(src[x]));
+                texel[3] = 255;
+            }
+        }
+
+        inline void DecodeRowR32Float(const float* src, uint8_t* dst, uint32_t w) {
+            uint32_t x = 0;
+#if defined(RG_TEXTURE_DECODER_SSE2)
+            for (; x + 4 <= w; x += 4) {
+                StoreGray4(dst + static_cast<size_t>(x) * 4, FloatToByte4(_mm_loadu_ps(src + x)));
+            }
+#endif
+            for (; x < w; ++x) {
+                uint8_t* texel = dst + static_cast<size_t>(x) * 4;
+                texel[0] = texel[1] = texel[2] = FloatToByte(src[x]);
+                texel[3] = 255;
+            }
+        }
+
+        inline void DecodeRowRGBA16Float(const uint16_t* src, uint8_t* dst, uint32_t w) {
+            uint32_t x = 0;
+#if defined(RG_TEXTURE_DECODER_SSE2)
+            for (; x + 2 <= w; x += 2) {
+                const __m128i packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + static_cast<size_t>(x) * 4));
+                const __m128i lo = FloatToByte4(HalfToFloat4(packed));
+                const __m128i hi = FloatToByte4(HalfToFloat4(_mm_srli_si128(packed, 8)));
+                const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(lo, hi), _mm_setzero_si128());
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + static_cast<size_t>(x) * 4), bytes);
+            }
+#endif
+            for (; x < w; ++x) {
+                const uint16_t* texelSrc = src + static_cast<size_t>(x) * 4;
+                uint8_t* texel = dst + static_cast<size_t>(x) * 4;
+                texel[0] = FloatToByte(DecodeHalfToFloat(texelSrc[0]));
+                texel[1] = FloatToByte(DecodeHalfToFloat(texelSrc[1]));
+                texel[2] = FloatToByte(DecodeHalfToFloat(texelSrc[2]));
+                texel[3] = FloatToByte(DecodeHalfToFloat(texelSrc[3]));
+            }
+        }
+
+        inline void DecodeRowRG16Float(const uint16_t* src, uint8_t* dst, uint32_t w) {
+            uint32_t x = 0;
+#if defined(RG_TEXTURE_DECODER_SSE2)
+            for (; x + 2 <= w; x += 2) {
+                // r0 g0 r1 g1 -> r0 g0 0 255 r1 g1 0 255
+                const __m128i rg = FloatToByte4(HalfToFloat4(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(src + static_cast<size_t>(x) * 2))));
+                const __m128i ba = _mm_set_epi32(255, 0, 255, 0);
+                const __m128i texel0 = _mm_unpacklo_epi64(rg, ba);
+                const __m128i texel1 = _mm_unpackhi_epi64(rg, ba);
+                const __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(texel0, texel1), _mm_setzero_si128());
+                _mm_storel_epi64(reinterpret_cast<__m128i*>(dst + static_cast<size_t>(x) * 4), bytes);
+            }
+#endif
+            for (; x < w; ++x) {
+                const uint16_t* texelSrc = src + static_cast<size_t>(x) * 2;
+                uint8_t* texel = dst + static_cast<size_t>(x) * 4;
+                texel[0] = FloatToByte(DecodeHalfToFloat(texelSrc[0]));
+                texel[1] = FloatToByte(DecodeHalfToFloat(texelSrc[1]));
+                texel[2] = 0;
+                texel[3] = 255;
+            }
+        }
+
+        inline void DecodeRowR11G11B10Float(const uint32_t* src, uint8_t* dst, uint32_t w) {
+            uint32_t x = 0;
+#if defined(RG_TEXTURE_DECODER_SSE2)
+            for (; x + 4 <= w; x += 4) {
+                const __m128i p = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + x));
+                // Channel bits with the 5-bit exponent landing at float32 bit 23.
+                const __m128i r = _mm_slli_epi32(_mm_and_si128(p, _mm_set1_epi32(0x7FF)), 17);
+                const __m128i g = _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(p, 11), _mm_set1_epi32(0x7FF)), 17);
+                const __m128i b = _mm_slli_epi32(_mm_srli_epi32(p, 22), 18);
+                const __m128i infThreshold = _mm_set1_epi32(31 << 23);
+                const __m128i r8 = FloatToByte4(RebiasSmallFloat(r, infThreshold));
+                const __m128i g8 = FloatToByte4(RebiasSmallFloat(g, infThreshold));
+                const __m128i b8 = FloatToByte4(RebiasSmallFloat(b, infThreshold));
+                const __m128i rgba = _mm_or_si128(
+                    _mm_or_si128(r8, _mm_slli_epi32(g8, 8)),
+                    _mm_or_si128(_mm_slli_epi32(b8, 16), _mm_set1_epi32(static_cast<int>(0xFF000000u))));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + static_cast<size_t>(x) * 4), rgba);
+            }
+#endif
+            for (; x < w; ++x) {
+                const uint32_t p = src[x];
+                uint8_t* texel = dst + static_cast<size_t>(x) * 4;
+                texel[0] = FloatToByte(DecodeUFloat11ToFloat((p >>  0) & 0x7FF));
+                texel[1] = FloatToByte(DecodeUFloat11ToFloat((p >> 11) & 0x7FF));
+                texel[2] = FloatToByte(DecodeUFloat10ToFloat((p >> 22) & 0x3FF));
+                texel[3] = 255;
+            }
+        }
+
+    } // namespace detail
+
     struct FloatPreviewRange {
         float minValue = std::numeric_limits<float>::infinity();
         float maxValue = -std::numeric_limits<float>::infinity();
@@ -89,6 +270,37 @@ namespace ui {
         return FloatToByte((value - range.minValue) / extent);
     }
 
+    // Block-compressed formats are previewed without a CPU decode: the blocks are uploaded
+    // unchanged into a texture of the returned format and the sampler decodes them, so BC1-BC7
+    // cost one copy regardless of size. Returns Unknown for formats that are not block-compressed.
+    inline rhi::Format BlockCompressedPreviewFormat(rhi::Format format) {
+        using F = rhi::Format;
+        switch (format) {
+        case F::BC1_Typeless:
+        case F::BC1_UNorm:      return F::BC1_UNorm;
+        case F::BC1_UNorm_sRGB: return F::BC1_UNorm_sRGB;
+        case F::BC2_Typeless:
+        case F::BC2_UNorm:      return F::BC2_UNorm;
+        case F::BC2_UNorm_sRGB: return F::BC2_UNorm_sRGB;
+        case F::BC3_Typeless:
+        case F::BC3_UNorm:      return F::BC3_UNorm;
+        case F::BC3_UNorm_sRGB: return F::BC3_UNorm_sRGB;
+        case F::BC4_Typeless:
+        case F::BC4_UNorm:      return F::BC4_UNorm;
+        case F::BC4_SNorm:      return F::BC4_SNorm;
+        case F::BC5_Typeless:
+        case F::BC5_UNorm:      return F::BC5_UNorm;
+        case F::BC5_SNorm:      return F::BC5_SNorm;
+        case F::BC6H_Typeless:
+        case F::BC6H_UF16:      return F::BC6H_UF16;
+        case F::BC6H_SF16:      return F::BC6H_SF16;
+        case F::BC7_Typeless:
+        case F::BC7_UNorm:      return F::BC7_UNorm;
+        case F::BC7_UNorm_sRGB: return F::BC7_UNorm_sRGB;
+        default:                return F::Unknown;
+        }
+    }
+
     // Decode a single subresource from readback data into tightly-packed RGBA8.
     // 'srcBase' points to the start of the readback buffer data.
     // The footprint describes where and how this subresource is laid out
@@ -150,14 +362,7 @@ namespace ui {
             for (uint32_t y = 0; y < h; ++y) {
                 const auto* src = reinterpret_cast<const uint16_t*>(rowSrc(y));
                 if (!src) break;
-                uint8_t* dst = out.data() + static_cast<size_t>(y) * w * 4;
-                for (uint32_t x = 0; x < w; ++x) {
-                    dst[0] = FloatToByte(DecodeHalfToFloat(src[0]));
-                    dst[1] = FloatToByte(DecodeHalfToFloat(src[1]));
-                    dst[2] = FloatToByte(DecodeHalfToFloat(src[2]));
-                    dst[3] = FloatToByte(DecodeHalfToFloat(src[3]));
-                    src += 4; dst += 4;
-                }
+                detail::DecodeRowRGBA16Float(src, out.data() + static_cast<size_t>(y) * w * 4, w);
             }
             return out;
 
@@ -256,38 +461,13 @@ namespace ui {
             return out;
 
         // R11G11B10_Float
-        case F::R11G11B10_Float: {
-            // Unpack 11-bit, 11-bit, 10-bit unsigned floats.
-            auto unpack11 = [](uint32_t v) -> float {
-                uint32_t e = (v >> 6) & 0x1F;
-                uint32_t m = v & 0x3F;
-                if (e == 0) return (m == 0) ? 0.0f : std::ldexp(static_cast<float>(m) / 64.0f, -14);
-                if (e == 31) return (m == 0) ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
-                return std::ldexp(1.0f + static_cast<float>(m) / 64.0f, static_cast<int>(e) - 15);
-            };
-            auto unpack10 = [](uint32_t v) -> float {
-                uint32_t e = (v >> 5) & 0x1F;
-                uint32_t m = v & 0x1F;
-                if (e == 0) return (m == 0) ? 0.0f : std::ldexp(static_cast<float>(m) / 32.0f, -14);
-                if (e == 31) return (m == 0) ? std::numeric_limits<float>::infinity() : std::numeric_limits<float>::quiet_NaN();
-                return std::ldexp(1.0f + static_cast<float>(m) / 32.0f, static_cast<int>(e) - 15);
-            };
-
+        case F::R11G11B10_Float:
             for (uint32_t y = 0; y < h; ++y) {
                 const auto* src = reinterpret_cast<const uint32_t*>(rowSrc(y));
                 if (!src) break;
-                uint8_t* dst = out.data() + static_cast<size_t>(y) * w * 4;
-                for (uint32_t x = 0; x < w; ++x) {
-                    uint32_t p = src[x];
-                    dst[0] = FloatToByte(unpack11((p >>  0) & 0x7FF));
-                    dst[1] = FloatToByte(unpack11((p >> 11) & 0x7FF));
-                    dst[2] = FloatToByte(unpack10((p >> 22) & 0x3FF));
-                    dst[3] = 255;
-                    dst += 4;
-                }
+                detail::DecodeRowR11G11B10Float(src, out.data() + static_cast<size_t>(y) * w * 4, w);
             }
             return out;
-        }
 
         // Single-channel -> grayscale
         case F::R8_UNorm:
@@ -322,13 +502,7 @@ namespace ui {
             for (uint32_t y = 0; y < h; ++y) {
                 const auto* src = reinterpret_cast<const uint16_t*>(rowSrc(y));
                 if (!src) break;
-                uint8_t* dst = out.data() + static_cast<size_t>(y) * w * 4;
-                for (uint32_t x = 0; x < w; ++x) {
-                    uint8_t v = FloatToByte(DecodeHalfToFloat(src[x]));
-                    dst[0] = dst[1] = dst[2] = v;
-                    dst[3] = 255;
-                    dst += 4;
-                }
+                detail::DecodeRowR16Float(src, out.data() + static_cast<size_t>(y) * w * 4, w);
             }
             return out;
 
@@ -338,13 +512,7 @@ namespace ui {
             for (uint32_t y = 0; y < h; ++y) {
                 const auto* src = reinterpret_cast<const float*>(rowSrc(y));
                 if (!src) break;
-                uint8_t* dst = out.data() + static_cast<size_t>(y) * w * 4;
-                for (uint32_t x = 0; x < w; ++x) {
-                    uint8_t v = FloatToByte(src[x]);
-                    dst[0] = dst[1] = dst[2] = v;
-                    dst[3] = 255;
-                    dst += 4;
-                }
+                detail::DecodeRowR32Float(src, out.data() + static_cast<size_t>(y) * w * 4, w);
             }
             return out;
 
@@ -369,14 +537,7 @@ namespace ui {
             for (uint32_t y = 0; y < h; ++y) {
                 const auto* src = reinterpret_cast<const uint16_t*>(rowSrc(y));
                 if (!src) break;
-                uint8_t* dst = out.data() + static_cast<size_t>(y) * w * 4;
-                for (uint32_t x = 0; x < w; ++x) {
-                    dst[0] = FloatToByte(DecodeHalfToFloat(src[0]));
-                    dst[1] = FloatToByte(DecodeHalfToFloat(src[1]));
-                    dst[2] = 0;
-                    dst[3] = 255;
-                    src += 2; dst += 4;
-                }
+                detail::DecodeRowRG16Float(src, out.data() + static_cast<size_t>(y) * w * 4, w);
             }
             return out;
 
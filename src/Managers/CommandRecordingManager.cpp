@@ -7,16 +7,13 @@
 thread_local CommandRecordingManager::ThreadState CommandRecordingManager::s_tls{};
 
 CommandRecordingManager::CommandRecordingManager(const Init& init) {
-    m_bind[static_cast<size_t>(QueueKind::Graphics)] =
-    { init.graphicsQ, init.graphicsF, init.graphicsPool, rhi::QueueKind::Graphics };
-
-    m_bind[static_cast<size_t>(QueueKind::Compute)] =
-    { init.computeQ,  init.computeF,  init.computePool,  rhi::QueueKind::Compute };
-
-    m_bind[static_cast<size_t>(QueueKind::Copy)] =
-    { init.copyQ,     init.copyF,     init.copyPool,     rhi::QueueKind::Copy };
+    m_bind.reserve(init.queues.size());
+    for (const auto& queue : init.queues) {
+        m_bind.push_back({ queue.queue, queue.fence, queue.pool, queue.listType });
+    }
+    m_lastSignaledValue.assign(m_bind.size(), 0);
 
-    for (size_t i = 0; i < static_cast<size_t>(QueueKind::Count); ++i) {
+    for (size_t i = 0; i < m_bind.size(); ++i) {
         auto& bind = m_bind[i];
         if (bind.valid()) {
             m_lastSignaledValue[i] = bind.fence->GetCompletedValue();
@@ -24,13 +21,21 @@ CommandRecordingManager::CommandRecordingManager(const Init& init) {
     }
 }
 
-rhi::CommandList CommandRecordingManager::EnsureOpen(QueueKind requested, uint32_t frameEpoch) {
-    const QueueKind qk = requested;
-    auto& bind = m_bind[static_cast<size_t>(qk)];
-    assert(bind.valid() && "Queue/Fence/Pool not initialized for this QueueKind");
-
+CommandRecordingManager::PerQueueCtx& CommandRecordingManager::ThreadContext(size_t slot) {
     auto& tls = s_tls;
-    auto& ctx = tls.ctxs[static_cast<size_t>(qk)];
+    if (slot >= tls.ctxs.size()) {
+        tls.ctxs.resize(slot + 1);
+    }
+    return tls.ctxs[slot];
+}
+
+rhi::CommandList CommandRecordingManager::EnsureOpen(QueueSlotIndex slot, uint32_t frameEpoch) {
+    const size_t slotIndex = static_cast<size_t>(slot);
+    assert(slotIndex < m_bind.size() && "Queue slot not registered with the CommandRecordingManager");
+    auto& bind = m_bind[slotIndex];
+    assert(bind.valid() && "Queue/Fence/Pool not initialized for this queue slot");
+
+    auto& ctx = ThreadContext(slotIndex);
 
     // If the epoch changed since last list, drop the old one (we'll get a new allocator)
     if (ctx.list && ctx.epoch != frameEpoch) {
@@ -52,10 +57,12 @@ rhi::CommandList CommandRecordingManager::EnsureOpen(QueueKind requested, uint32
     return ctx.list.Get();
 }
 
-uint64_t CommandRecordingManager::Flush(QueueKind requested, Signal sig) {
-    const QueueKind qk = requested;
-    const size_t qkIndex = static_cast<size_t>(qk);
-    auto& bind = m_bind[static_cast<size_t>(qk)];
+uint64_t CommandRecordingManager::Flush(QueueSlotIndex slot, Signal sig) {
+    const size_t qkIndex = static_cast<size_t>(slot);
+    if (qkIndex >= m_bind.size() || qkIndex >= s_tls.ctxs.size()) {
+        return 0; // Nothing was ever opened on this slot by this thread
+    }
+    auto& bind = m_bind[qkIndex];
     auto& ctx = s_tls.ctxs[qkIndex];
 
     uint64_t signaled = 0;
@@ -64,7 +71,7 @@ uint64_t CommandRecordingManager::Flush(QueueKind requested, Signal sig) {
         if (ctx.dirty) {
             // Close + execute
             ctx.list->End();
-			bind.queue->Submit({ &ctx.list.Get(), 1 }, {});
+			bind.queue.Submit({ &ctx.list.Get(), 1 }, {});
         }
 
 		//bind.queue->CheckDebugMessages();
@@ -77,12 +84,12 @@ uint64_t CommandRecordingManager::Flush(QueueKind requested, Signal sig) {
 			if (m_lastSignaledValue[qkIndex] >= UINT64_MAX - 1 && !(sig.enable && sig.value != 0)) {
 				// Something is wrong
                 spdlog::error("CRM::Flush signal: timeline for queue {} has exhausted its value space! No further command lists can be recorded.",
-                    static_cast<int>(qk));
+                    static_cast<int>(qkIndex));
                 throw std::runtime_error("Timeline value space exhausted");
             }
             if (sig.enable && sig.value != 0) {
                 if (sig.value == UINT64_MAX) {
-                    spdlog::error("CRM::Flush signal: explicit signal for queue {} requested terminal value UINT64_MAX", static_cast<int>(qk));
+                    spdlog::error("CRM::Flush signal: explicit signal for queue {} requested terminal value UINT64_MAX", static_cast<int>(qkIndex));
                     throw std::runtime_error("Timeline signal value UINT64_MAX is invalid");
                 }
                 signaled = sig.value;
@@ -93,15 +100,15 @@ uint64_t CommandRecordingManager::Flush(QueueKind requested, Signal sig) {
 
             // Diagnostic: log every CRM fence signal so we can trace unexpected values
             spdlog::debug("CRM::Flush signal: resolvedQueue={} fenceIdx={} fenceGen={} value={}",
-                static_cast<int>(qk),
+                static_cast<int>(qkIndex),
                 bind.fence->GetHandle().index,
                 bind.fence->GetHandle().generation,
                 signaled);
-            const rhi::Result signalResult = bind.queue->Signal({ bind.fence->GetHandle(), signaled });
+            const rhi::Result signalResult = bind.queue.Signal({ bind.fence->GetHandle(), signaled });
             if (signalResult != rhi::Result::Ok) {
                 spdlog::error(
                     "CRM::Flush signal failed: queue={} timeline(idx={}, gen={}) value={} result={}",
-                    static_cast<int>(qk),
+                    static_cast<int>(qkIndex),
                     bind.fence->GetHandle().index,
                     bind.fence->GetHandle().generation,
                     signaled,
@@ -140,9 +147,15 @@ uint64_t CommandRecordingManager::Flush(QueueKind requested, Signal sig) {
     return signaled;
 }
 
+void CommandRecordingManager::FlushAll() {
+    for (size_t i = 0; i < m_bind.size(); ++i) {
+        Flush(static_cast<QueueSlotIndex>(i), { false, 0 });
+    }
+}
+
 void CommandRecordingManager::EndFrame() {
     // Let pools reclaim any in-flight allocators whose fences have completed
-    for (size_t i = 0; i < static_cast<size_t>(QueueKind::Count); ++i) {
+    for (size_t i = 0; i < m_bind.size(); ++i) {
         auto& bind = m_bind[i];
         if (!bind.valid()) continue;
         const uint64_t done = bind.fence->GetCompletedValue();
@@ -150,12 +163,12 @@ void CommandRecordingManager::EndFrame() {
     }
 }
 
-rhi::Timeline* CommandRecordingManager::Fence(QueueKind qk) const {
-    return m_bind[static_cast<size_t>(qk)].fence;
+rhi::Timeline* CommandRecordingManager::Fence(QueueSlotIndex slot) const {
+    return m_bind[static_cast<size_t>(slot)].fence;
 }
 
-rhi::Queue* CommandRecordingManager::Queue(QueueKind qk) const {
-    return m_bind[static_cast<size_t>(qk)].queue;
+rhi::Queue* CommandRecordingManager::Queue(QueueSlotIndex slot) {
+    return &m_bind[static_cast<size_t>(slot)].queue;
 }
 
 void CommandRecordingManager::ShutdownThreadLocal() {
@@ -0,0 +1,129 @@
+#include "Managers/Singletons/DebugDumpWriter.h"
+
+#include <fstream>
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Render/Runtime/OpenRenderGraphSettings.h"
+
+DebugDumpWriter& DebugDumpWriter::GetInstance() {
+	static DebugDumpWriter instance;
+	return instance;
+}
+
+bool DebugDumpWriter::ShouldCapture(DebugDumpChannel channel) {
+	const size_t index = static_cast<size_t>(channel);
+	const auto minInterval = std::chrono::milliseconds(rg::runtime::GetOpenRenderGraphSettings().renderGraphDebugDumpMinIntervalMs);
+	const Clock::time_point now = Clock::now();
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_pending[index].has_value() || (m_lastCapture[index].has_value() && now - *m_lastCapture[index] < minInterval)) {
+		++m_stats.skipped;
+		return false;
+	}
+	m_lastCapture[index] = now;
+	return true;
+}
+
+void DebugDumpWriter::Submit(DebugDumpChannel channel, std::filesystem::path path, Formatter format) {
+	const size_t index = static_cast<size_t>(channel);
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		if (m_quit) {
+			return;
+		}
+		if (m_pending[index].has_value()) {
+			++m_stats.replaced;
+		}
+		m_pending[index] = PendingDump{ std::move(path), std::move(format) };
+		if (!m_writerThread.joinable()) {
+			m_writerThread = std::thread(&DebugDumpWriter::WriterMain, this);
+		}
+	}
+	m_queueCv.notify_one();
+}
+
+void DebugDumpWriter::Flush() {
+	std::unique_lock<std::mutex> lock(m_mutex);
+	m_idleCv.wait(lock, [this] {
+		if (m_writing) {
+			return false;
+		}
+		for (const auto& pending : m_pending) {
+			if (pending.has_value()) {
+				return !m_writerThread.joinable(); // Nothing will drain it
+			}
+		}
+		return true;
+	});
+}
+
+void DebugDumpWriter::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_queueCv.notify_all();
+	if (m_writerThread.joinable()) {
+		m_writerThread.join();
+	}
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_writerThread = {};
+	m_quit = false;
+	m_idleCv.notify_all();
+}
+
+DebugDumpWriter::Stats DebugDumpWriter::GetStats() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
+
+void DebugDumpWriter::WriterMain() {
+	tracy::SetThreadName("RG Debug Dumps");
+	std::unique_lock<std::mutex> lock(m_mutex);
+	while (true) {
+		std::optional<PendingDump> next;
+		m_queueCv.wait(lock, [&] {
+			for (auto& pending : m_pending) {
+				if (pending.has_value()) {
+					next = std::move(pending);
+					pending.reset();
+					return true;
+				}
+			}
+			return m_quit;
+		});
+		if (!next.has_value()) {
+			return; // Quit with nothing left to write
+		}
+		m_writing = true;
+		lock.unlock();
+		const bool written = WriteDump(*next);
+		next.reset();
+		lock.lock();
+		m_writing = false;
+		++(written ? m_stats.written : m_stats.failed);
+		m_idleCv.notify_all();
+	}
+}
+
+bool DebugDumpWriter::WriteDump(PendingDump& dump) {
+	ZoneScopedN("DebugDumpWriter::WriteDump");
+	try {
+		const std::string contents = dump.format();
+
+		namespace fs = std::filesystem;
+		std::error_code fsError;
+		fs::create_directories(dump.path.parent_path(), fsError);
+		std::ofstream outFile(dump.path, std::ios::out | std::ios::trunc);
+		if (!outFile.is_open()) {
+			spdlog::warn("Failed to open render graph debug dump '{}'", dump.path.string());
+			return false;
+		}
+		outFile.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+		return static_cast<bool>(outFile);
+	}
+	catch (const std::exception& ex) {
+		spdlog::warn("Failed to write render graph debug dump '{}': {}", dump.path.string(), ex.what());
+		return false;
+	}
+}
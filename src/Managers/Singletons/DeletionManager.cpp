@@ -0,0 +1,314 @@
+#include "Managers/Singletons/DeletionManager.h"
+
+#include <algorithm>
+
+#include <tracy/Tracy.hpp>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#endif
+
+namespace {
+	constexpr size_t kPendingNodeChunkSize = 256;
+}
+
+DeletionManager::~DeletionManager() {
+	StopDestructionThread();
+	// Destroys whatever the pending and free nodes still hold.
+	m_pendingHead.store(nullptr, std::memory_order_relaxed);
+	m_freeHead.store(nullptr, std::memory_order_relaxed);
+	m_nodeChunks.clear();
+}
+
+DeletionManager::PendingNode* DeletionManager::AcquireNode() {
+	// A thread that exits hands its cached nodes back for the others.
+	struct ThreadNodeCache {
+		PendingNode* head = nullptr;
+		~ThreadNodeCache() {
+			if (!head) {
+				return;
+			}
+			PendingNode* last = head;
+			while (last->next) {
+				last = last->next;
+			}
+			DeletionManager::GetInstance().ReleaseNodes(head, last);
+		}
+	};
+	thread_local ThreadNodeCache cache;
+
+	if (!cache.head) {
+		cache.head = m_freeHead.exchange(nullptr, std::memory_order_acquire);
+	}
+	if (!cache.head) {
+		auto chunk = std::make_unique<PendingNode[]>(kPendingNodeChunkSize);
+		for (size_t i = 0; i + 1 < kPendingNodeChunkSize; ++i) {
+			chunk[i].next = &chunk[i + 1];
+		}
+		cache.head = &chunk[0];
+		std::scoped_lock lock(m_nodeChunkMutex);
+		m_nodeChunks.push_back(std::move(chunk));
+	}
+	PendingNode* node = cache.head;
+	cache.head = node->next;
+	return node;
+}
+
+void DeletionManager::ReleaseNodes(PendingNode* first, PendingNode* last) {
+	PendingNode* head = m_freeHead.load(std::memory_order_relaxed);
+	do {
+		last->next = head;
+	} while (!m_freeHead.compare_exchange_weak(head, first, std::memory_order_release, std::memory_order_relaxed));
+}
+
+void DeletionManager::CollectPendingUnlocked() {
+	PendingNode* const first = m_pendingHead.exchange(nullptr, std::memory_order_acquire);
+	PendingNode* last = nullptr;
+	PendingNode* node = first;
+	while (node) {
+		std::visit([this](auto& item) {
+			using T = std::decay_t<decltype(item)>;
+			if constexpr (std::is_same_v<T, rhi::helpers::AnyObjectPtr>) {
+				m_openBatch.objects.push_back(std::move(item));
+			}
+			else if constexpr (std::is_same_v<T, rhi::ma::AllocationPtr>) {
+				m_openBatch.allocations.push_back(std::move(item));
+			}
+			else {
+				m_openBatch.trackedAllocations.push_back(std::move(item));
+			}
+		}, node->item);
+		last = node;
+		node = node->next;
+	}
+	if (first) {
+		ReleaseNodes(first, last);
+	}
+}
+
+void DeletionManager::PublishRetirementFences(std::span<const QueueFencePoint> fencesBySlot) {
+	std::scoped_lock lock(m_mutex);
+	if (!IsInitialized()) {
+		return;
+	}
+	CollectPendingUnlocked();
+	if (m_latestFencesBySlot.size() < fencesBySlot.size()) {
+		m_latestFencesBySlot.resize(fencesBySlot.size());
+	}
+	for (size_t slot = 0; slot < fencesBySlot.size(); ++slot) {
+		const auto& point = fencesBySlot[slot];
+		if (point.timeline.IsValid() && point.value != 0 && point.value != UINT64_MAX) {
+			m_latestFencesBySlot[slot] = point;
+		}
+	}
+	const bool firstPublish = !m_fenceDriven;
+	m_fenceDriven = true;
+	if (m_openBatch.Empty() && !firstPublish) {
+		return;
+	}
+	auto snapshot = std::make_shared<std::vector<QueueFencePoint>>();
+	snapshot->reserve(m_latestFencesBySlot.size());
+	for (const auto& point : m_latestFencesBySlot) {
+		if (point.timeline.IsValid()) {
+			snapshot->push_back(point);
+		}
+	}
+	// Batches still aging under the frame-count fallback wait for these fences instead.
+	if (firstPublish) {
+		for (auto& batch : m_sealedBatches) {
+			batch.requiredFences = snapshot;
+		}
+	}
+	if (!m_openBatch.Empty()) {
+		m_openBatch.requiredFences = std::move(snapshot);
+		m_sealedBatches.push_back(std::move(m_openBatch));
+		m_openBatch = {};
+	}
+}
+
+bool DeletionManager::FencesComplete(const RetirementBatch& batch) {
+	if (!batch.requiredFences) {
+		return true;
+	}
+	for (const auto& point : *batch.requiredFences) {
+		const uint64_t completed = point.timeline.GetCompletedValue();
+		// UINT64_MAX means the device was lost; keep the objects until DrainAll.
+		if (completed == UINT64_MAX || completed < point.value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void DeletionManager::ProcessDeletions() {
+	ZoneScopedN("DeletionManager::ProcessDeletions");
+	std::vector<RetirementBatch> retired;
+	{
+		std::scoped_lock lock(m_mutex);
+		if (!IsInitialized()) {
+			return;
+		}
+		if (m_fenceDriven) {
+			// Fence values only grow along the queue, so stop at the first batch still pending.
+			while (!m_sealedBatches.empty() && FencesComplete(m_sealedBatches.front())) {
+				retired.push_back(std::move(m_sealedBatches.front()));
+				m_sealedBatches.pop_front();
+			}
+		}
+		else {
+			CollectPendingUnlocked();
+			if (!m_openBatch.Empty()) {
+				m_sealedBatches.push_back(std::move(m_openBatch));
+				m_openBatch = {};
+			}
+			const uint32_t retirementCalls = static_cast<uint32_t>(m_numFramesInFlight.load(std::memory_order_relaxed)) + 1u;
+			for (auto& batch : m_sealedBatches) {
+				++batch.processCalls;
+			}
+			while (!m_sealedBatches.empty() && m_sealedBatches.front().processCalls >= retirementCalls) {
+				retired.push_back(std::move(m_sealedBatches.front()));
+				m_sealedBatches.pop_front();
+			}
+		}
+	}
+	// Released outside m_mutex so producers and the fence publish never wait on destruction.
+	DestroyBatches(retired);
+}
+
+void DeletionManager::DestroyBatches(std::vector<RetirementBatch>& batches) {
+	if (batches.empty()) {
+		return;
+	}
+	const size_t batchCount = batches.size();
+	const auto& settings = rg::runtime::GetOpenRenderGraphSettings();
+	if (!settings.backgroundDeletionEnabled) {
+		{
+			ZoneScopedN("DeletionManager::DestroyInline");
+			batches.clear();
+		}
+		std::scoped_lock lock(m_destructionMutex);
+		m_stats.batchesDestroyedInline += batchCount;
+		return;
+	}
+
+	// Entities are destroyed here when this scope ends; only the API objects move to the thread.
+	std::vector<TrackedEntityToken> entityTokens;
+	std::vector<RetirementBatch> overflow;
+	{
+		std::unique_lock lock(m_destructionMutex);
+		if (!m_destructionThread.joinable()) {
+			m_destructionStop = false;
+			m_destructionThread = std::thread([this] { DestructionLoop(); });
+		}
+		const size_t maxQueued = std::max<uint32_t>(1u, settings.backgroundDeletionMaxQueuedBatches);
+		for (auto& batch : batches) {
+			for (auto& tracked : batch.trackedAllocations) {
+				entityTokens.push_back(tracked.TakeEntityToken());
+			}
+			batch.requiredFences.reset();
+			// Backpressure: a full queue means the thread is behind, so the caller pays for this one.
+			if (m_destructionQueue.size() >= maxQueued) {
+				overflow.push_back(std::move(batch));
+				++m_stats.backpressureBatches;
+				continue;
+			}
+			m_destructionQueue.push_back(std::move(batch));
+		}
+		m_stats.queuedBackgroundBatches = m_destructionQueue.size();
+		TracyPlot("RG.DeletionQueuedBatches", static_cast<int64_t>(m_destructionQueue.size()));
+	}
+	m_destructionCv.notify_one();
+	batches.clear();
+	if (!overflow.empty()) {
+		const size_t overflowCount = overflow.size();
+		{
+			ZoneScopedN("DeletionManager::DestroyInline");
+			overflow.clear();
+		}
+		std::scoped_lock lock(m_destructionMutex);
+		m_stats.batchesDestroyedInline += overflowCount;
+	}
+}
+
+void DeletionManager::DestructionLoop() {
+#ifdef _WIN32
+	SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_BELOW_NORMAL);
+#endif
+	tracy::SetThreadName("RG Deletion");
+	std::unique_lock lock(m_destructionMutex);
+	while (true) {
+		m_destructionCv.wait(lock, [this] { return m_destructionStop || !m_destructionQueue.empty(); });
+		if (m_destructionQueue.empty()) {
+			return; // Stopped with nothing left
+		}
+		RetirementBatch batch = std::move(m_destructionQueue.front());
+		m_destructionQueue.pop_front();
+		m_destructionBusy = true;
+		lock.unlock();
+		{
+			ZoneScopedN("DeletionManager::DestroyInBackground");
+			batch = {};
+		}
+		lock.lock();
+		m_destructionBusy = false;
+		++m_stats.batchesDestroyedInBackground;
+		m_stats.queuedBackgroundBatches = m_destructionQueue.size();
+		m_destructionIdleCv.notify_all();
+	}
+}
+
+void DeletionManager::StopDestructionThread() {
+	{
+		std::scoped_lock lock(m_destructionMutex);
+		if (!m_destructionThread.joinable()) {
+			return;
+		}
+		m_destructionStop = true;
+	}
+	m_destructionCv.notify_one();
+	m_destructionThread.join();
+	std::scoped_lock lock(m_destructionMutex);
+	m_destructionThread = {};
+	m_destructionStop = false;
+}
+
+void DeletionManager::DrainAll() {
+	std::deque<RetirementBatch> sealed;
+	RetirementBatch open;
+	{
+		std::scoped_lock lock(m_mutex);
+		if (!IsInitialized()) {
+			return;
+		}
+		CollectPendingUnlocked();
+		sealed.swap(m_sealedBatches);
+		open = std::move(m_openBatch);
+		m_openBatch = {};
+	}
+	std::deque<RetirementBatch> queued;
+	{
+		std::unique_lock lock(m_destructionMutex);
+		queued.swap(m_destructionQueue);
+		m_stats.queuedBackgroundBatches = 0;
+		m_destructionIdleCv.wait(lock, [this] { return !m_destructionBusy; });
+	}
+}
+
+void DeletionManager::Cleanup() {
+	StopDestructionThread();
+	std::scoped_lock lock(m_mutex);
+	CollectPendingUnlocked();
+	m_sealedBatches.clear();
+	m_openBatch = {};
+	m_latestFencesBySlot.clear();
+	m_fenceDriven = false;
+	m_numFramesInFlight.store(0, std::memory_order_release);
+}
+
+DeletionManager::Stats DeletionManager::GetStats() const {
+	std::scoped_lock lock(m_destructionMutex);
+	return m_stats;
+}
@@ -1,10 +1,13 @@
 #include "Managers/Singletons/DescriptorHeapManager.h"
 
 #include <algorithm>
+#include <iterator>
 #include <stdexcept>
+#include <type_traits>
 
 #include <spdlog/spdlog.h>
 #include <rhi_helpers.h>
+#include <tracy/Tracy.hpp>
 
 #include "Managers/Singletons/DeviceManager.h"
 #include "Resources/GloballyIndexedResource.h"
@@ -20,14 +23,22 @@
 void DescriptorHeapManager::Initialize() {
     auto device = DeviceManager::GetInstance().GetDevice();
     m_deferredReleases.clear();
-    m_latestQueueFenceSnapshot.clear();
+    m_latestQueueFenceSnapshot.reset();
 
+    // The shader-visible heap may start small and grow at frame boundaries up to the max capacity;
+    // see GrowShaderVisibleHeapIfNeeded.
+    const auto& settings = rg::runtime::GetOpenRenderGraphSettings();
+    const uint32_t initialCapacity = std::max(settings.shaderVisibleDescriptorHeapInitialCapacity, 1u);
+    m_cbvSrvUavHeapMaxCapacity = std::max(initialCapacity, settings.shaderVisibleDescriptorHeapMaxCapacity);
     m_cbvSrvUavHeap = std::make_shared<DescriptorHeap>(
         device,
         rhi::DescriptorHeapType::CbvSrvUav,
-        1000000,
+        initialCapacity,
         true,
         "cbvSrvUavHeap");
+    if (m_cbvSrvUavHeapMaxCapacity > initialCapacity) {
+        m_cbvSrvUavHeap->EnableViewRecords();
+    }
 
     m_samplerHeap = std::make_shared<DescriptorHeap>(
         device,
@@ -62,14 +73,15 @@ void DescriptorHeapManager::Cleanup() {
     {
         std::scoped_lock lock(m_descriptorMutationMutex);
         for (auto& release : m_deferredReleases) {
-            for (auto& [heap, index] : release.descriptorSlots) {
-                if (heap) {
-                    heap->ReleaseDescriptor(index);
-                }
-            }
+            ExecuteDeferredRelease(release);
         }
         m_deferredReleases.clear();
-        m_latestQueueFenceSnapshot.clear();
+        m_latestQueueFenceSnapshot.reset();
+    }
+    {
+        std::scoped_lock lock(m_pendingDescriptorWriteMutex);
+        m_pendingDescriptorWrites.clear();
+        m_deferShaderVisibleWrites.store(false, std::memory_order_relaxed);
     }
     m_cbvSrvUavHeap.reset();
     m_samplerHeap.reset();
@@ -78,16 +90,35 @@ void DescriptorHeapManager::Cleanup() {
     m_nonShaderVisibleHeap.reset();
 }
 
+DescriptorHeapManager::DeferredRelease& DescriptorHeapManager::CurrentDeferredReleaseUnlocked() {
+    if (m_deferredReleases.empty() || m_deferredReleases.back().requiredFences != m_latestQueueFenceSnapshot) {
+        DeferredRelease release{};
+        release.requiredFences = m_latestQueueFenceSnapshot;
+        m_deferredReleases.push_back(std::move(release));
+    }
+    return m_deferredReleases.back();
+}
+
+void DescriptorHeapManager::ExecuteDeferredRelease(DeferredRelease& release) {
+    DescriptorHeap::ReleaseDescriptorSlots(release.descriptorSlots);
+    release.descriptorSlots.clear();
+    release.bufferBackings.clear();
+    release.descriptorHeaps.clear();
+}
+
 void DescriptorHeapManager::RetireDescriptorSlots(std::vector<std::pair<std::shared_ptr<DescriptorHeap>, UINT>> slots) {
     if (slots.empty()) {
         return;
     }
 
     std::scoped_lock lock(m_descriptorMutationMutex);
-    DeferredRelease release{};
-    release.requiredFences = m_latestQueueFenceSnapshot;
-    release.descriptorSlots = std::move(slots);
-    m_deferredReleases.push_back(std::move(release));
+    auto& release = CurrentDeferredReleaseUnlocked();
+    if (release.descriptorSlots.empty()) {
+        release.descriptorSlots = std::move(slots);
+    }
+    else {
+        release.descriptorSlots.insert(release.descriptorSlots.end(), std::make_move_iterator(slots.begin()), std::make_move_iterator(slots.end()));
+    }
 }
 
 void DescriptorHeapManager::RetireBufferBacking(std::unique_ptr<GpuBufferBacking> backing) {
@@ -96,14 +127,10 @@ void DescriptorHeapManager::RetireBufferBacking(std::unique_ptr<GpuBufferBacking
     }
 
     std::scoped_lock lock(m_descriptorMutationMutex);
-    DeferredRelease release{};
-    release.requiredFences = m_latestQueueFenceSnapshot;
-    release.bufferBackings.push_back(std::move(backing));
-    m_deferredReleases.push_back(std::move(release));
+    CurrentDeferredReleaseUnlocked().bufferBackings.push_back(std::move(backing));
 }
 
 void DescriptorHeapManager::PublishQueueFenceSnapshot(std::vector<QueueFenceSnapshotPoint> fenceSnapshot) {
-    std::scoped_lock lock(m_descriptorMutationMutex);
     fenceSnapshot.erase(
         std::remove_if(
             fenceSnapshot.begin(),
@@ -112,15 +139,20 @@ void DescriptorHeapManager::PublishQueueFenceSnapshot(std::vector<QueueFenceSnap
                 return !point.timeline.IsValid() || point.value == 0 || point.value == UINT64_MAX;
             }),
         fenceSnapshot.end());
-    m_latestQueueFenceSnapshot = std::move(fenceSnapshot);
+    auto snapshot = std::make_shared<const std::vector<QueueFenceSnapshotPoint>>(std::move(fenceSnapshot));
+    std::scoped_lock lock(m_descriptorMutationMutex);
+    m_latestQueueFenceSnapshot = std::move(snapshot);
 }
 
 void DescriptorHeapManager::ProcessDeferredReleases(uint8_t frameIndex) {
     (void)frameIndex;
     std::scoped_lock lock(m_descriptorMutationMutex);
 
-    auto releaseIsSafe = [](DeferredRelease& release) {
-        for (auto& point : release.requiredFences) {
+    auto releaseIsSafe = [](const DeferredRelease& release) {
+        if (!release.requiredFences) {
+            return true;
+        }
+        for (const auto& point : *release.requiredFences) {
             if (!point.timeline.IsValid()) {
                 return false;
             }
@@ -132,30 +164,314 @@ void DescriptorHeapManager::ProcessDeferredReleases(uint8_t frameIndex) {
         return true;
     };
 
-    for (size_t i = 0; i < m_deferredReleases.size();) {
-        auto& release = m_deferredReleases[i];
-        if (!releaseIsSafe(release)) {
-            ++i;
-            continue;
+    // Later entries wait on the same or later fence values, so stop at the first one pending.
+    while (!m_deferredReleases.empty() && releaseIsSafe(m_deferredReleases.front())) {
+        ExecuteDeferredRelease(m_deferredReleases.front());
+        m_deferredReleases.pop_front();
+    }
+}
+
+void DescriptorHeapManager::GrowShaderVisibleHeapIfNeeded() {
+    std::scoped_lock lock(m_descriptorMutationMutex);
+    GrowShaderVisibleHeapIfNeededUnlocked();
+}
+
+void DescriptorHeapManager::GrowShaderVisibleHeapIfNeededUnlocked() {
+    if (!m_cbvSrvUavHeap) {
+        return;
+    }
+    const uint32_t capacity = m_cbvSrvUavHeap->GetCapacity();
+    if (capacity >= m_cbvSrvUavHeapMaxCapacity || m_cbvSrvUavHeap->GetHighWaterMark() < capacity - capacity / 4) {
+        return;
+    }
+
+    ZoneScopedN("DescriptorHeapManager::GrowShaderVisibleHeap");
+    const uint32_t newCapacity = static_cast<uint32_t>(std::min<uint64_t>(m_cbvSrvUavHeapMaxCapacity, static_cast<uint64_t>(capacity) * 2));
+    auto device = DeviceManager::GetInstance().GetDevice();
+    std::unique_lock heapLock(m_shaderVisibleHeapMutex);
+    auto retiredHeap = m_cbvSrvUavHeap->Grow(device, newCapacity);
+
+    // Indices are unchanged, so re-creating every live view at its index migrates the heap.
+    const auto heapHandle = m_cbvSrvUavHeap->GetHeap().GetHandle();
+    const auto records = m_cbvSrvUavHeap->SnapshotViewRecords();
+    for (const auto& [index, record] : records) {
+        CreateView(device, { heapHandle, index }, record.resource, record.desc);
+    }
+    heapLock.unlock();
+
+    // In-flight frames still reference the old heap.
+    CurrentDeferredReleaseUnlocked().descriptorHeaps.push_back(std::move(retiredHeap));
+    spdlog::info("DescriptorHeapManager: grew cbvSrvUavHeap from {} to {} descriptors ({} views migrated)", capacity, newCapacity, records.size());
+}
+
+void DescriptorHeapManager::BeginDeferredDescriptorWrites() {
+    m_deferShaderVisibleWrites.store(true, std::memory_order_relaxed);
+}
+
+void DescriptorHeapManager::FlushDeferredDescriptorWrites() {
+    ZoneScopedN("DescriptorHeapManager::FlushDeferredDescriptorWrites");
+    std::vector<PendingDescriptorWrite> writes;
+    {
+        std::scoped_lock lock(m_pendingDescriptorWriteMutex);
+        m_deferShaderVisibleWrites.store(false, std::memory_order_relaxed);
+        writes.swap(m_pendingDescriptorWrites);
+    }
+    TracyPlot("RG.Descriptors.DeferredWrites", static_cast<int64_t>(writes.size()));
+    if (writes.empty()) {
+        return;
+    }
+
+    // Ascending slot order turns the scattered writes of parallel materialization into one
+    // sequential pass over the write-combined heap memory. Stable, so a rewritten slot keeps its
+    // last contents.
+    std::stable_sort(writes.begin(), writes.end(), [](const PendingDescriptorWrite& a, const PendingDescriptorWrite& b) {
+        return a.index < b.index;
+    });
+    auto device = DeviceManager::GetInstance().GetDevice();
+    std::shared_lock heapLock(m_shaderVisibleHeapMutex);
+    const auto heapHandle = m_cbvSrvUavHeap->GetHeap().GetHandle();
+    for (const auto& write : writes) {
+        CreateView(device, { heapHandle, write.index }, write.resource, write.desc);
+    }
+}
+
+void DescriptorHeapManager::CreateView(
+    rhi::Device& device,
+    const rhi::DescriptorSlot& slot,
+    rhi::ResourceHandle resource,
+    const PendingViewDesc& desc)
+{
+    std::visit([&](const auto& viewDesc) {
+        using Desc = std::decay_t<decltype(viewDesc)>;
+        if constexpr (std::is_same_v<Desc, rhi::CbvDesc>) {
+            device.CreateConstantBufferView({ slot.heap, slot.index }, resource, viewDesc);
+        }
+        else if constexpr (std::is_same_v<Desc, rhi::SrvDesc>) {
+            device.CreateShaderResourceView({ slot.heap, slot.index }, resource, viewDesc);
+        }
+        else {
+            device.CreateUnorderedAccessView({ slot.heap, slot.index }, resource, viewDesc);
+        }
+    }, desc);
+}
+
+void DescriptorHeapManager::WriteShaderVisibleView(
+    rhi::Device& device,
+    const rhi::DescriptorSlot& slot,
+    rhi::ResourceHandle resource,
+    const PendingViewDesc& desc)
+{
+    // Slots keep the heap handle they were assigned with, which goes stale once the heap grows.
+    // The shared lock keeps a grow from slipping between reading the current handle, recording
+    // the view for migration and writing it.
+    std::shared_lock heapLock(m_shaderVisibleHeapMutex);
+    m_cbvSrvUavHeap->RecordView(slot.index, resource, desc);
+
+    if (m_deferShaderVisibleWrites.load(std::memory_order_relaxed)) {
+        std::scoped_lock lock(m_pendingDescriptorWriteMutex);
+        // Re-check under the lock so a write racing a flush is not left behind.
+        if (m_deferShaderVisibleWrites.load(std::memory_order_relaxed)) {
+            m_pendingDescriptorWrites.push_back({ slot.index, resource, desc });
+            return;
         }
+    }
+    const rhi::DescriptorSlot target{ m_cbvSrvUavHeap->GetHeap().GetHandle(), slot.index };
+    CreateView(device, target, resource, desc);
+}
 
-        for (auto& [heap, index] : release.descriptorSlots) {
-            if (heap) {
-                heap->ReleaseDescriptor(index);
-            }
+namespace {
+
+using TextureViews = rg::runtime::DescriptorViewRequirements::TextureViews;
+
+SRVViewType TextureSRVGridViewType(const TextureViews& tex) {
+    if (tex.isArray) {
+        return tex.isCubemap ? SRVViewType::TextureCubeArray : SRVViewType::Texture2DArray;
+    }
+    return tex.isCubemap ? SRVViewType::TextureCube : SRVViewType::Texture2D;
+}
+
+uint32_t TextureSRVMipLevels(const TextureViews& tex, uint32_t mip) {
+#if ORG_TEXTURE_SRV_INCLUDE_LOWER_MIPS
+    return tex.mipLevels - mip;
+#else
+    (void)tex;
+    (void)mip;
+    return 1u;
+#endif
+}
+
+rhi::Format ShaderVisibleUAVFormat(const TextureViews& tex) {
+    return tex.uavFormat == rhi::Format::Unknown && !rhi::helpers::IsSRGB(tex.baseFormat)
+        ? tex.baseFormat
+        : tex.uavFormat;
+}
+
+rhi::UavDesc MakeTextureUAVDesc(const TextureViews& tex, rhi::Format format, uint32_t mip, uint32_t slice) {
+    rhi::UavDesc uavDesc{};
+    uavDesc.formatOverride = format;
+    if (tex.isArray || tex.isCubemap) {
+        uavDesc.dimension = rhi::UavDim::Texture2DArray;
+        uavDesc.texture2DArray.mipSlice = mip + tex.uavFirstMip;
+        uavDesc.texture2DArray.firstArraySlice = slice;
+        uavDesc.texture2DArray.arraySize = 1;
+        uavDesc.texture2DArray.planeSlice = 0;
+    }
+    else {
+        uavDesc.dimension = rhi::UavDim::Texture2D;
+        uavDesc.texture2D.mipSlice = mip + tex.uavFirstMip;
+        uavDesc.texture2D.planeSlice = 0;
+    }
+    return uavDesc;
+}
+
+} // namespace
+
+void DescriptorHeapManager::WriteTextureSRVGridView(
+    rhi::Device& device,
+    GloballyIndexedResource& target,
+    rhi::ResourceHandle resource,
+    const TextureViews& tex,
+    uint32_t mip,
+    uint32_t srvSlice)
+{
+    const uint32_t mipLevelsForView = TextureSRVMipLevels(tex, mip);
+    rhi::SrvDesc srvDesc{};
+    srvDesc.formatOverride = tex.srvFormat == rhi::Format::Unknown ? tex.baseFormat : tex.srvFormat;
+
+    if (tex.isCubemap) {
+        if (tex.isArray) {
+            srvDesc.dimension = rhi::SrvDim::TextureCubeArray;
+            srvDesc.cubeArray.mostDetailedMip = mip;
+            srvDesc.cubeArray.mipLevels = mipLevelsForView;
+            srvDesc.cubeArray.first2DArrayFace = srvSlice * 6u;
+            srvDesc.cubeArray.numCubes = 1;
+        }
+        else {
+            srvDesc.dimension = rhi::SrvDim::TextureCube;
+            srvDesc.cube.mostDetailedMip = mip;
+            srvDesc.cube.mipLevels = mipLevelsForView;
         }
+    }
+    else if (tex.isArray) {
+        srvDesc.dimension = rhi::SrvDim::Texture2DArray;
+        srvDesc.tex2DArray.mostDetailedMip = mip;
+        srvDesc.tex2DArray.mipLevels = mipLevelsForView;
+        srvDesc.tex2DArray.firstArraySlice = srvSlice;
+        srvDesc.tex2DArray.arraySize = 1;
+        srvDesc.tex2DArray.planeSlice = 0;
+    }
+    else {
+        srvDesc.dimension = rhi::SrvDim::Texture2D;
+        srvDesc.tex2D.mostDetailedMip = mip;
+        srvDesc.tex2D.mipLevels = mipLevelsForView;
+        srvDesc.tex2D.planeSlice = 0;
+    }
+
+    const auto& slot = target.GetSRVInfo(TextureSRVGridViewType(tex), mip, srvSlice).slot;
+    WriteShaderVisibleView(device, slot, resource, srvDesc);
+}
+
+void DescriptorHeapManager::WriteTextureSubresourceViews(
+    rhi::Device& device,
+    GloballyIndexedResource& target,
+    rhi::ResourceHandle resource,
+    const TextureViews& tex,
+    uint32_t mip,
+    uint32_t slice)
+{
+    // Single-face SRVs of a cubemap viewed as a 2D array; only the first cube has them.
+    if (tex.createSRV && tex.createCubemapAsArraySRV && tex.isCubemap && slice < 6u) {
+        rhi::SrvDesc srvDesc{};
+        srvDesc.formatOverride = tex.srvFormat == rhi::Format::Unknown ? tex.baseFormat : tex.srvFormat;
+        srvDesc.dimension = rhi::SrvDim::Texture2DArray;
+        srvDesc.tex2DArray.mostDetailedMip = mip;
+        srvDesc.tex2DArray.mipLevels = TextureSRVMipLevels(tex, mip);
+        srvDesc.tex2DArray.firstArraySlice = slice;
+        srvDesc.tex2DArray.arraySize = 1;
+        srvDesc.tex2DArray.planeSlice = 0;
+
+        const auto& slot = target.GetSRVInfo(SRVViewType::Texture2DArray, mip, slice).slot;
+        WriteShaderVisibleView(device, slot, resource, srvDesc);
+    }
+
+    if (tex.createUAV) {
+        const auto& slot = target.GetUAVShaderVisibleInfo(mip, slice).slot;
+        WriteShaderVisibleView(device, slot, resource, MakeTextureUAVDesc(tex, ShaderVisibleUAVFormat(tex), mip, slice));
+    }
+
+    if (tex.createNonShaderVisibleUAV) {
+        const rhi::Format uavFormat = tex.uavFormat == rhi::Format::Unknown ? tex.baseFormat : tex.uavFormat;
+        const auto& slot = target.GetUAVNonShaderVisibleInfo(mip, slice).slot;
+        device.CreateUnorderedAccessView({ slot.heap, slot.index }, resource, MakeTextureUAVDesc(tex, uavFormat, mip, slice));
+    }
+
+    const bool arrayed = tex.isArray || tex.isCubemap;
+    if (tex.createRTV) {
+        rhi::RtvDesc rtvDesc{};
+        rtvDesc.formatOverride = tex.rtvFormat == rhi::Format::Unknown ? tex.baseFormat : tex.rtvFormat;
+        rtvDesc.dimension = arrayed ? rhi::RtvDim::Texture2DArray : rhi::RtvDim::Texture2D;
+        rtvDesc.range = { mip, 1u, arrayed ? slice : 0u, 1u };
+
+        const auto& slot = target.GetRTVInfo(mip, slice).slot;
+        device.CreateRenderTargetView({ slot.heap, slot.index }, resource, rtvDesc);
+    }
+
+    if (tex.createDSV) {
+        rhi::DsvDesc dsvDesc{};
+        dsvDesc.formatOverride = tex.dsvFormat == rhi::Format::Unknown ? tex.baseFormat : tex.dsvFormat;
+        dsvDesc.dimension = arrayed ? rhi::DsvDim::Texture2DArray : rhi::DsvDim::Texture2D;
+        dsvDesc.range = { mip, 1u, arrayed ? slice : 0u, 1u };
 
-        release = std::move(m_deferredReleases.back());
-        m_deferredReleases.pop_back();
+        const auto& slot = target.GetDSVInfo(mip, slice).slot;
+        device.CreateDepthStencilView({ slot.heap, slot.index }, resource, dsvDesc);
     }
 }
 
+void DescriptorHeapManager::EnsureSubresourceViews(GloballyIndexedResource& target, const SubresourceRange& range) {
+    auto deferred = target.GetDeferredSubresourceViews();
+    if (!deferred || range.isEmpty()) {
+        return;
+    }
+
+    const auto& tex = deferred->views;
+    const uint32_t srvSlices = (tex.isArray || tex.isCubemap) ? tex.arraySize : 1u;
+    const uint32_t arraySlices = (tex.isArray || tex.isCubemap) ? tex.totalArraySlices : 1u;
+    const uint32_t mipEnd = std::min(range.firstMip + range.mipCount, tex.mipLevels);
+    const uint32_t sliceEnd = std::min(range.firstSlice + range.sliceCount, arraySlices);
+    auto device = DeviceManager::GetInstance().GetDevice();
+    for (uint32_t slice = range.firstSlice; slice < sliceEnd; ++slice) {
+        const uint32_t srvSlice = tex.isCubemap ? slice / 6u : (tex.isArray ? slice : 0u);
+        for (uint32_t mip = range.firstMip; mip < mipEnd; ++mip) {
+            if (srvSlice < srvSlices && !deferred->srvWritten.empty()) {
+                auto& written = deferred->srvWritten[static_cast<size_t>(srvSlice) * tex.mipLevels + mip];
+                if (!written) {
+                    WriteTextureSRVGridView(device, target, deferred->resource, tex, mip, srvSlice);
+                    written = 1;
+                    --deferred->remaining;
+                }
+            }
+            auto& written = deferred->subresourceWritten[static_cast<size_t>(slice) * tex.mipLevels + mip];
+            if (!written) {
+                WriteTextureSubresourceViews(device, target, deferred->resource, tex, mip, slice);
+                written = 1;
+                --deferred->remaining;
+            }
+        }
+    }
+    if (deferred->remaining == 0) {
+        target.SetDeferredSubresourceViews(nullptr);
+    }
+}
+
+uint64_t DescriptorHeapManager::GetDeferredSubresourceViewTargetCount() const {
+    return DeferredSubresourceViews::liveCount.load(std::memory_order_relaxed);
+}
+
 void DescriptorHeapManager::AssignDescriptorSlots(
     GloballyIndexedResource& target,
     rhi::Resource& apiResource,
     const ViewRequirements& req)
 {
-    std::scoped_lock lock(m_descriptorMutationMutex);
     ReserveDescriptorSlotsUnlocked(target, req);
     UpdateDescriptorContentsUnlocked(target, apiResource, req);
 }
@@ -164,7 +480,6 @@ void DescriptorHeapManager::ReserveDescriptorSlots(
     GloballyIndexedResource& target,
     const ViewRequirements& req)
 {
-    std::scoped_lock lock(m_descriptorMutationMutex);
     ReserveDescriptorSlotsUnlocked(target, req);
 }
 
@@ -185,11 +500,13 @@ void DescriptorHeapManager::ReserveDescriptorSlotsUnlocked(
         auto makeShaderVisibleGrid = [&](uint32_t slices, uint32_t mips, const std::shared_ptr<DescriptorHeap>& heap) {
             std::vector<std::vector<ShaderVisibleIndexInfo>> infos;
             infos.resize(slices);
+            // One contiguous block per view, laid out [slice][mip], so it can be bound as a table.
+            const UINT base = slices * mips > 0 ? heap->AllocateDescriptorRange(slices * mips) : 0;
             for (uint32_t slice = 0; slice < slices; ++slice) {
                 infos[slice].resize(mips);
                 for (uint32_t mip = 0; mip < mips; ++mip) {
                     ShaderVisibleIndexInfo info{};
-                    info.slot.index = heap->AllocateDescriptor();
+                    info.slot.index = base + slice * mips + mip;
                     info.slot.heap = heap->GetHeap().GetHandle();
                     infos[slice][mip] = info;
                 }
@@ -200,11 +517,13 @@ void DescriptorHeapManager::ReserveDescriptorSlotsUnlocked(
         auto makeNonShaderVisibleGrid = [&](uint32_t slices, uint32_t mips, const std::shared_ptr<DescriptorHeap>& heap) {
             std::vector<std::vector<NonShaderVisibleIndexInfo>> infos;
             infos.resize(slices);
+            // One contiguous block per view, laid out [slice][mip], so it can be bound as a table.
+            const UINT base = slices * mips > 0 ? heap->AllocateDescriptorRange(slices * mips) : 0;
             for (uint32_t slice = 0; slice < slices; ++slice) {
                 infos[slice].resize(mips);
                 for (uint32_t mip = 0; mip < mips; ++mip) {
                     NonShaderVisibleIndexInfo info{};
-                    info.slot.index = heap->AllocateDescriptor();
+                    info.slot.index = base + slice * mips + mip;
                     info.slot.heap = heap->GetHeap().GetHandle();
                     infos[slice][mip] = info;
                 }
@@ -265,23 +584,27 @@ void DescriptorHeapManager::ReserveDescriptorSlotsUnlocked(
     }
 
     if (const auto* buf = std::get_if<ViewRequirements::BufferViews>(&req.views)) {
+        // The shader-visible views share one block: CBV, then SRV, then UAV.
+        const UINT shaderVisibleCount = (buf->createCBV ? 1u : 0u) + (buf->createSRV ? 1u : 0u) + (buf->createUAV ? 1u : 0u);
+        UINT nextShaderVisible = shaderVisibleCount > 0 ? m_cbvSrvUavHeap->AllocateDescriptorRange(shaderVisibleCount) : 0;
+
         if (buf->createCBV) {
             ShaderVisibleIndexInfo cbvInfo{};
-            cbvInfo.slot.index = m_cbvSrvUavHeap->AllocateDescriptor();
+            cbvInfo.slot.index = nextShaderVisible++;
             cbvInfo.slot.heap = m_cbvSrvUavHeap->GetHeap().GetHandle();
             target.SetCBVDescriptor(m_cbvSrvUavHeap, cbvInfo);
         }
 
         if (buf->createSRV) {
             ShaderVisibleIndexInfo srvInfo{};
-            srvInfo.slot.index = m_cbvSrvUavHeap->AllocateDescriptor();
+            srvInfo.slot.index = nextShaderVisible++;
             srvInfo.slot.heap = m_cbvSrvUavHeap->GetHeap().GetHandle();
             target.SetSRVView(SRVViewType::Buffer, m_cbvSrvUavHeap, { { srvInfo } });
         }
 
         if (buf->createUAV) {
             ShaderVisibleIndexInfo uavInfo{};
-            uavInfo.slot.index = m_cbvSrvUavHeap->AllocateDescriptor();
+            uavInfo.slot.index = nextShaderVisible++;
             uavInfo.slot.heap = m_cbvSrvUavHeap->GetHeap().GetHandle();
             target.SetUAVGPUDescriptors(m_cbvSrvUavHeap, { { uavInfo } }, buf->uavCounterOffset);
         }
@@ -305,7 +628,6 @@ void DescriptorHeapManager::UpdateDescriptorContents(
     rhi::Resource& apiResource,
     const ViewRequirements& req)
 {
-    std::scoped_lock lock(m_descriptorMutationMutex);
     UpdateDescriptorContentsUnlocked(target, apiResource, req);
 }
 
@@ -321,245 +643,99 @@ void DescriptorHeapManager::UpdateDescriptorContentsUnlocked(
         throw std::runtime_error("DescriptorHeapManager::UpdateDescriptorContents called before DescriptorHeapManager::Initialize");
     }
 
+    // Repeat requests for the same views of the same resource keep the slots as written. The
+    // handle's generation changes whenever the API resource does, so a reused handle index
+    // still rewrites.
+    const rhi::ResourceHandle handle = apiResource.GetHandle();
+    rg::Hash64 contentsKey = rg::HashCombine(rg::HashCombine(HashValue(req), handle.index), handle.generation);
+    contentsKey = contentsKey == 0 ? 1 : contentsKey;
+    if (target.GetDescriptorContentsKey() == contentsKey) {
+        return;
+    }
+    target.SetDescriptorContentsKey(contentsKey);
+
     if (const auto* tex = std::get_if<ViewRequirements::TextureViews>(&req.views)) {
-        if (tex->createSRV) {
-            SRVViewType srvViewType = SRVViewType::Invalid;
-            if (tex->isArray) {
-                srvViewType = tex->isCubemap ? SRVViewType::TextureCubeArray : SRVViewType::Texture2DArray;
-            }
-            else if (tex->isCubemap) {
-                srvViewType = SRVViewType::TextureCube;
+        const uint32_t srvSlices = (tex->isArray || tex->isCubemap) ? tex->arraySize : 1u;
+        const uint32_t arraySlices = (tex->isArray || tex->isCubemap) ? tex->totalArraySlices : 1u;
+
+        // Lazy mode writes only the whole-resource views now: the default SRV at mip 0 and the
+        // full-array views. The rest keep their reserved slots until EnsureSubresourceViews.
+        const bool lazy = rg::runtime::GetOpenRenderGraphSettings().lazySubresourceDescriptorViews
+            && static_cast<uint64_t>(tex->mipLevels) * arraySlices > 1;
+        target.SetDeferredSubresourceViews(nullptr);
+        if (lazy) {
+            auto deferred = std::make_shared<DeferredSubresourceViews>();
+            deferred->resource = handle;
+            deferred->views = *tex;
+            deferred->srvWritten.assign(tex->createSRV ? static_cast<size_t>(srvSlices) * tex->mipLevels : 0u, 0);
+            deferred->subresourceWritten.assign(static_cast<size_t>(arraySlices) * tex->mipLevels, 0);
+            if (!deferred->srvWritten.empty()) {
+                WriteTextureSRVGridView(device, target, handle, *tex, 0, 0);
+                deferred->srvWritten[0] = 1;
             }
-            else {
-                srvViewType = SRVViewType::Texture2D;
+            deferred->remaining = static_cast<uint32_t>(std::count(deferred->srvWritten.begin(), deferred->srvWritten.end(), 0)
+                + deferred->subresourceWritten.size());
+            target.SetDeferredSubresourceViews(std::move(deferred));
+        }
+        else {
+            for (uint32_t slice = 0; slice < srvSlices && tex->createSRV; ++slice) {
+                for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
+                    WriteTextureSRVGridView(device, target, handle, *tex, mip, slice);
+                }
             }
-
-            const rhi::Format srvFormat = tex->srvFormat == rhi::Format::Unknown ? tex->baseFormat : tex->srvFormat;
-            const uint32_t srvSlices = (tex->isArray || tex->isCubemap) ? tex->arraySize : 1u;
-            for (uint32_t slice = 0; slice < srvSlices; ++slice) {
+            for (uint32_t slice = 0; slice < arraySlices; ++slice) {
                 for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    const uint32_t mipLevelsForView =
-#if ORG_TEXTURE_SRV_INCLUDE_LOWER_MIPS
-                        tex->mipLevels - mip;
-#else
-                        1u;
-#endif
-
-                    rhi::SrvDesc srvDesc{};
-                    srvDesc.formatOverride = srvFormat;
-
-                    if (tex->isCubemap) {
-                        if (tex->isArray) {
-                            srvDesc.dimension = rhi::SrvDim::TextureCubeArray;
-                            srvDesc.cubeArray.mostDetailedMip = mip;
-                            srvDesc.cubeArray.mipLevels = mipLevelsForView;
-                            srvDesc.cubeArray.first2DArrayFace = slice * 6u;
-                            srvDesc.cubeArray.numCubes = 1;
-                        }
-                        else {
-                            srvDesc.dimension = rhi::SrvDim::TextureCube;
-                            srvDesc.cube.mostDetailedMip = mip;
-                            srvDesc.cube.mipLevels = mipLevelsForView;
-                        }
-                    }
-                    else if (tex->isArray) {
-                        srvDesc.dimension = rhi::SrvDim::Texture2DArray;
-                        srvDesc.tex2DArray.mostDetailedMip = mip;
-                        srvDesc.tex2DArray.mipLevels = mipLevelsForView;
-                        srvDesc.tex2DArray.firstArraySlice = slice;
-                        srvDesc.tex2DArray.arraySize = 1;
-                        srvDesc.tex2DArray.planeSlice = 0;
-                    }
-                    else {
-                        srvDesc.dimension = rhi::SrvDim::Texture2D;
-                        srvDesc.tex2D.mostDetailedMip = mip;
-                        srvDesc.tex2D.mipLevels = mipLevelsForView;
-                        srvDesc.tex2D.planeSlice = 0;
-                    }
-
-                    const auto& slot = target.GetSRVInfo(srvViewType, mip, slice).slot;
-                    device.CreateShaderResourceView({ slot.heap, slot.index }, apiResource.GetHandle(), srvDesc);
+                    WriteTextureSubresourceViews(device, target, handle, *tex, mip, slice);
                 }
             }
+        }
 
+        if (tex->createSRV) {
+            const rhi::Format srvFormat = tex->srvFormat == rhi::Format::Unknown ? tex->baseFormat : tex->srvFormat;
             if (tex->isArray && !tex->isCubemap) {
                 for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    const uint32_t mipLevelsForView =
-#if ORG_TEXTURE_SRV_INCLUDE_LOWER_MIPS
-                        tex->mipLevels - mip;
-#else
-                        1u;
-#endif
-
                     rhi::SrvDesc srvDesc{};
                     srvDesc.formatOverride = srvFormat;
                     srvDesc.dimension = rhi::SrvDim::Texture2DArray;
                     srvDesc.tex2DArray.mostDetailedMip = mip;
-                    srvDesc.tex2DArray.mipLevels = mipLevelsForView;
+                    srvDesc.tex2DArray.mipLevels = TextureSRVMipLevels(*tex, mip);
                     srvDesc.tex2DArray.firstArraySlice = 0u;
                     srvDesc.tex2DArray.arraySize = tex->arraySize;
                     srvDesc.tex2DArray.planeSlice = 0u;
 
                     const auto& slot = target.GetSRVInfo(SRVViewType::Texture2DArrayFull, mip, 0u).slot;
-                    device.CreateShaderResourceView({ slot.heap, slot.index }, apiResource.GetHandle(), srvDesc);
+                    WriteShaderVisibleView(device, slot, handle, srvDesc);
                 }
             }
             else if (tex->isCubemap && tex->isArray) {
                 for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    const uint32_t mipLevelsForView =
-#if ORG_TEXTURE_SRV_INCLUDE_LOWER_MIPS
-                        tex->mipLevels - mip;
-#else
-                        1u;
-#endif
-
                     rhi::SrvDesc srvDesc{};
                     srvDesc.formatOverride = srvFormat;
                     srvDesc.dimension = rhi::SrvDim::TextureCubeArray;
                     srvDesc.cubeArray.mostDetailedMip = mip;
-                    srvDesc.cubeArray.mipLevels = mipLevelsForView;
+                    srvDesc.cubeArray.mipLevels = TextureSRVMipLevels(*tex, mip);
                     srvDesc.cubeArray.first2DArrayFace = 0u;
                     srvDesc.cubeArray.numCubes = tex->arraySize;
 
                     const auto& slot = target.GetSRVInfo(SRVViewType::TextureCubeArrayFull, mip, 0u).slot;
-                    device.CreateShaderResourceView({ slot.heap, slot.index }, apiResource.GetHandle(), srvDesc);
-                }
-            }
-
-            if (tex->createCubemapAsArraySRV && tex->isCubemap) {
-                for (uint32_t slice = 0; slice < 6u; ++slice) {
-                    for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                        const uint32_t mipLevelsForView =
-#if ORG_TEXTURE_SRV_INCLUDE_LOWER_MIPS
-                            tex->mipLevels - mip;
-#else
-                            1u;
-#endif
-
-                        rhi::SrvDesc srvDesc{};
-                        srvDesc.formatOverride = srvFormat;
-                        srvDesc.dimension = rhi::SrvDim::Texture2DArray;
-                        srvDesc.tex2DArray.mostDetailedMip = mip;
-                        srvDesc.tex2DArray.mipLevels = mipLevelsForView;
-                        srvDesc.tex2DArray.firstArraySlice = slice;
-                        srvDesc.tex2DArray.arraySize = 1;
-                        srvDesc.tex2DArray.planeSlice = 0;
-
-                        const auto& slot = target.GetSRVInfo(SRVViewType::Texture2DArray, mip, slice).slot;
-                        device.CreateShaderResourceView({ slot.heap, slot.index }, apiResource.GetHandle(), srvDesc);
-                    }
-                }
-            }
-        }
-
-        if (tex->createUAV) {
-            const rhi::Format uavFormat = tex->uavFormat == rhi::Format::Unknown && !rhi::helpers::IsSRGB(tex->baseFormat)
-                ? tex->baseFormat
-                : tex->uavFormat;
-            const uint32_t uavSlices = (tex->isArray || tex->isCubemap) ? tex->totalArraySlices : 1u;
-            for (uint32_t slice = 0; slice < uavSlices; ++slice) {
-                for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    rhi::UavDesc uavDesc{};
-                    uavDesc.formatOverride = uavFormat;
-                    if (tex->isArray || tex->isCubemap) {
-                        uavDesc.dimension = rhi::UavDim::Texture2DArray;
-                        uavDesc.texture2DArray.mipSlice = mip + tex->uavFirstMip;
-                        uavDesc.texture2DArray.firstArraySlice = slice;
-                        uavDesc.texture2DArray.arraySize = 1;
-                        uavDesc.texture2DArray.planeSlice = 0;
-                    }
-                    else {
-                        uavDesc.dimension = rhi::UavDim::Texture2D;
-                        uavDesc.texture2D.mipSlice = mip + tex->uavFirstMip;
-                        uavDesc.texture2D.planeSlice = 0;
-                    }
-
-                    const auto& slot = target.GetUAVShaderVisibleInfo(mip, slice).slot;
-                    device.CreateUnorderedAccessView({ slot.heap, slot.index }, apiResource.GetHandle(), uavDesc);
-                }
-            }
-
-            if (tex->isArray || tex->isCubemap) {
-                for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    rhi::UavDesc uavDesc{};
-                    uavDesc.formatOverride = uavFormat;
-                    uavDesc.dimension = rhi::UavDim::Texture2DArray;
-                    uavDesc.texture2DArray.mipSlice = mip + tex->uavFirstMip;
-                    uavDesc.texture2DArray.firstArraySlice = 0u;
-                    uavDesc.texture2DArray.arraySize = tex->totalArraySlices;
-                    uavDesc.texture2DArray.planeSlice = 0u;
-
-                    const auto& slot = target.GetUAVShaderVisibleInfo(UAVViewType::Texture2DArrayFull, mip, 0u).slot;
-                    device.CreateUnorderedAccessView({ slot.heap, slot.index }, apiResource.GetHandle(), uavDesc);
-                }
-            }
-        }
-
-        if (tex->createNonShaderVisibleUAV) {
-            const rhi::Format uavFormat = tex->uavFormat == rhi::Format::Unknown ? tex->baseFormat : tex->uavFormat;
-            const uint32_t uavSlices = (tex->isArray || tex->isCubemap) ? tex->totalArraySlices : 1u;
-            for (uint32_t slice = 0; slice < uavSlices; ++slice) {
-                for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    rhi::UavDesc uavDesc{};
-                    uavDesc.formatOverride = uavFormat;
-                    if (tex->isArray || tex->isCubemap) {
-                        uavDesc.dimension = rhi::UavDim::Texture2DArray;
-                        uavDesc.texture2DArray.mipSlice = mip + tex->uavFirstMip;
-                        uavDesc.texture2DArray.firstArraySlice = slice;
-                        uavDesc.texture2DArray.arraySize = 1;
-                        uavDesc.texture2DArray.planeSlice = 0;
-                    }
-                    else {
-                        uavDesc.dimension = rhi::UavDim::Texture2D;
-                        uavDesc.texture2D.mipSlice = mip + tex->uavFirstMip;
-                        uavDesc.texture2D.planeSlice = 0;
-                    }
-
-                    const auto& slot = target.GetUAVNonShaderVisibleInfo(mip, slice).slot;
-                    device.CreateUnorderedAccessView({ slot.heap, slot.index }, apiResource.GetHandle(), uavDesc);
+                    WriteShaderVisibleView(device, slot, handle, srvDesc);
                 }
             }
         }
 
-        if (tex->createRTV) {
-            const rhi::Format rtvFormat = tex->rtvFormat == rhi::Format::Unknown ? tex->baseFormat : tex->rtvFormat;
-            const uint32_t rtvSlices = (tex->isArray || tex->isCubemap) ? tex->totalArraySlices : 1u;
-            for (uint32_t slice = 0; slice < rtvSlices; ++slice) {
-                for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    rhi::RtvDesc rtvDesc{};
-                    rtvDesc.formatOverride = rtvFormat;
-                    rtvDesc.dimension = (tex->isArray || tex->isCubemap) ? rhi::RtvDim::Texture2DArray : rhi::RtvDim::Texture2D;
-                    rtvDesc.range = {
-                        static_cast<uint32_t>(mip),
-                        1u,
-                        (tex->isArray || tex->isCubemap) ? slice : 0u,
-                        1u
-                    };
-
-                    const auto& slot = target.GetRTVInfo(mip, slice).slot;
-                    device.CreateRenderTargetView({ slot.heap, slot.index }, apiResource.GetHandle(), rtvDesc);
-                }
-            }
-        }
-
-        if (tex->createDSV) {
-            const rhi::Format dsvFormat = tex->dsvFormat == rhi::Format::Unknown ? tex->baseFormat : tex->dsvFormat;
-            const uint32_t dsvSlices = (tex->isArray || tex->isCubemap) ? tex->totalArraySlices : 1u;
-            for (uint32_t slice = 0; slice < dsvSlices; ++slice) {
-                for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
-                    rhi::DsvDesc dsvDesc{};
-                    dsvDesc.formatOverride = dsvFormat;
-                    dsvDesc.dimension = (tex->isArray || tex->isCubemap) ? rhi::DsvDim::Texture2DArray : rhi::DsvDim::Texture2D;
-                    dsvDesc.range = {
-                        static_cast<uint32_t>(mip),
-                        1u,
-                        (tex->isArray || tex->isCubemap) ? slice : 0u,
-                        1u
-                    };
-
-                    const auto& slot = target.GetDSVInfo(mip, slice).slot;
-                    device.CreateDepthStencilView({ slot.heap, slot.index }, apiResource.GetHandle(), dsvDesc);
-                }
+        if (tex->createUAV && (tex->isArray || tex->isCubemap)) {
+            const rhi::Format uavFormat = ShaderVisibleUAVFormat(*tex);
+            for (uint32_t mip = 0; mip < tex->mipLevels; ++mip) {
+                rhi::UavDesc uavDesc{};
+                uavDesc.formatOverride = uavFormat;
+                uavDesc.dimension = rhi::UavDim::Texture2DArray;
+                uavDesc.texture2DArray.mipSlice = mip + tex->uavFirstMip;
+                uavDesc.texture2DArray.firstArraySlice = 0u;
+                uavDesc.texture2DArray.arraySize = tex->totalArraySlices;
+                uavDesc.texture2DArray.planeSlice = 0u;
+
+                const auto& slot = target.GetUAVShaderVisibleInfo(UAVViewType::Texture2DArrayFull, mip, 0u).slot;
+                WriteShaderVisibleView(device, slot, handle, uavDesc);
             }
         }
 
@@ -569,26 +745,17 @@ void DescriptorHeapManager::UpdateDescriptorContentsUnlocked(
     if (const auto* buf = std::get_if<ViewRequirements::BufferViews>(&req.views)) {
         if (buf->createCBV) {
             const auto& slot = target.GetCBVInfo().slot;
-            device.CreateConstantBufferView(
-                { slot.heap, slot.index },
-                apiResource.GetHandle(),
-                buf->cbvDesc);
+            WriteShaderVisibleView(device, slot, apiResource.GetHandle(), buf->cbvDesc);
         }
 
         if (buf->createSRV) {
             const auto& slot = target.GetSRVInfo(SRVViewType::Buffer, 0, 0).slot;
-            device.CreateShaderResourceView(
-                { slot.heap, slot.index },
-                apiResource.GetHandle(),
-                buf->srvDesc);
+            WriteShaderVisibleView(device, slot, apiResource.GetHandle(), buf->srvDesc);
         }
 
         if (buf->createUAV) {
             const auto& slot = target.GetUAVShaderVisibleInfo(0, 0).slot;
-            device.CreateUnorderedAccessView(
-                { slot.heap, slot.index },
-                apiResource.GetHandle(),
-                buf->uavDesc);
+            WriteShaderVisibleView(device, slot, apiResource.GetHandle(), buf->uavDesc);
         }
 
         if (buf->createNonShaderVisibleUAV) {
@@ -621,8 +788,7 @@ rhi::DescriptorHeap DescriptorHeapManager::GetSamplerDescriptorHeap() const {
 }
 
 UINT DescriptorHeapManager::CreateIndexedSampler(const rhi::SamplerDesc& samplerDesc) {
-    std::scoped_lock lock(m_descriptorMutationMutex);
-
+    // The sampler heap is fixed at Initialize and synchronises its own allocations.
     if (!m_samplerHeap) {
         spdlog::error("DescriptorHeapManager::CreateIndexedSampler called before DescriptorHeapManager::Initialize");
         throw std::runtime_error("DescriptorHeapManager::CreateIndexedSampler called before DescriptorHeapManager::Initialize");
@@ -1,5 +1,9 @@
 #include "Managers/Singletons/DeviceManager.h"
 
+#include <stdexcept>
+#include <string>
+#include <vector>
+
 #include <spdlog/spdlog.h>
 #include <flecs.h>
 #include <rhi_interop_dx12.h>
@@ -134,6 +138,105 @@ rhi::Result DeviceManager::AllocateMemoryTracked(
     return result;
 }
 
+bool DeviceManager::ChangeResidency(ResidencyOperation operation, std::span<TrackedHandle* const> allocations) {
+    if (allocations.empty()) {
+        return true;
+    }
+    if (s_residencyHook) {
+        return s_residencyHook(operation, allocations);
+    }
+
+    std::vector<ID3D12Pageable*> pageables;
+    pageables.reserve(allocations.size());
+    for (TrackedHandle* allocation : allocations) {
+        if (!allocation || !*allocation) {
+            continue;
+        }
+        auto& resource = allocation->GetResource();
+        rhi::D3D12ResourceInfo resourceInfo{};
+        if (!resource.IsValid()
+            || !rhi::QueryNativeResource(resource, rhi::RHI_IID_D3D12_RESOURCE, &resourceInfo, sizeof(resourceInfo))
+            || resourceInfo.resource == nullptr) {
+            continue;
+        }
+        pageables.push_back(static_cast<ID3D12Resource*>(resourceInfo.resource));
+    }
+    if (pageables.empty()) {
+        static std::once_flag warnOnce;
+        std::call_once(warnOnce, [] {
+            spdlog::warn("DeviceManager::ChangeResidency: no residency hook is installed and the allocations have no D3D12 resource; they stay resident.");
+        });
+        return false;
+    }
+
+    ID3D12Device* nativeDevice = nullptr;
+    if (FAILED(static_cast<ID3D12Resource*>(pageables.front())->GetDevice(IID_PPV_ARGS(&nativeDevice)))) {
+        return false;
+    }
+    const HRESULT hr = operation == ResidencyOperation::Evict
+        ? nativeDevice->Evict(static_cast<UINT>(pageables.size()), pageables.data())
+        : nativeDevice->MakeResident(static_cast<UINT>(pageables.size()), pageables.data());
+    nativeDevice->Release();
+    if (FAILED(hr)) {
+        spdlog::warn("DeviceManager::ChangeResidency: {} of {} allocations failed (hr=0x{:08x}).",
+            operation == ResidencyOperation::Evict ? "Evict" : "MakeResident",
+            pageables.size(),
+            static_cast<uint32_t>(hr));
+        return false;
+    }
+    return true;
+}
+
+bool DeviceManager::BeginPredication(rhi::CommandList& commandList, const rhi::Resource& buffer, uint64_t offset, PredicationOp op) {
+    if (s_predicationHook && s_predicationHook(commandList, &buffer, offset, op)) {
+        return true;
+    }
+    static std::once_flag warnOnce;
+    std::call_once(warnOnce, [] {
+        spdlog::warn("DeviceManager::BeginPredication: no predication hook is installed or it declined; predicated passes run unconditionally.");
+    });
+    return false;
+}
+
+void DeviceManager::EndPredication(rhi::CommandList& commandList) {
+    if (s_predicationHook) {
+        (void)s_predicationHook(commandList, nullptr, 0, PredicationOp::SkipWhenZero);
+    }
+}
+
+uint8_t DeviceManager::AddAdapter(rhi::Device device) {
+    if (!device) {
+        throw std::runtime_error("DeviceManager::AddAdapter: device is null");
+    }
+    if (m_device && m_device.Get().impl == device.impl) {
+        return 0;
+    }
+    for (size_t i = 0; i < m_secondaryAdapters.size(); ++i) {
+        if (m_secondaryAdapters[i].impl == device.impl) {
+            return static_cast<uint8_t>(i + 1);
+        }
+    }
+    if (m_secondaryAdapters.size() >= UINT8_MAX - 1) {
+        throw std::runtime_error("DeviceManager::AddAdapter: too many adapters");
+    }
+    m_secondaryAdapters.push_back(device);
+    return static_cast<uint8_t>(m_secondaryAdapters.size());
+}
+
+rhi::Device DeviceManager::GetAdapterDevice(uint8_t adapter) {
+    if (adapter == 0) {
+        return GetDevice();
+    }
+    if (adapter > m_secondaryAdapters.size()) {
+        throw std::runtime_error("DeviceManager::GetAdapterDevice: unknown adapter " + std::to_string(adapter));
+    }
+    return m_secondaryAdapters[adapter - 1];
+}
+
+bool DeviceManager::OpenTimelineOnDevice(const rhi::Timeline& timeline, rhi::Device device, rhi::TimelinePtr& outTimeline) {
+    return s_sharedTimelineHook && s_sharedTimelineHook(timeline, device, outTimeline);
+}
+
 void DeviceManager::Initialize(rhi::Device device) {
     if (!s_trackingHooks.createTrackingToken) {
         s_trackingHooks.createTrackingToken = [](flecs::entity existing) {
@@ -144,10 +247,14 @@ void DeviceManager::Initialize(rhi::Device device) {
             auto& world = ECSManager::GetInstance().GetWorld();
             flecs::entity entity = existing;
             if (!entity.is_alive()) {
+                if (rg::runtime::GetOpenRenderGraphSettings().trackedAllocationEntityBatchingEnabled) {
+                    return ECSManager::GetInstance().CreateQueuedTrackedEntity();
+                }
                 entity = world.entity();
             }
             return TrackedEntityToken(world, entity);
         };
+        s_defaultTrackingHooks = true;
     }
 
     if (m_allocator && m_device && m_device.Get().impl == device.impl) {
@@ -176,6 +283,7 @@ void DeviceManager::Initialize(rhi::Device device) {
 }
 
 void DeviceManager::Cleanup() {
+    m_secondaryAdapters.clear();
     if (!m_allocator) {
         m_graphicsQueue.Reset();
         m_computeQueue.Reset();
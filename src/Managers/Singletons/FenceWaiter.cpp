@@ -0,0 +1,146 @@
+#include "Managers/Singletons/FenceWaiter.h"
+
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+std::unique_ptr<FenceWaiter> FenceWaiter::instance = nullptr;
+bool FenceWaiter::initialized = false;
+
+void FenceWaiter::WhenReached(rhi::Timeline timeline, uint64_t value, Callback callback) {
+	if (!callback) {
+		return;
+	}
+	const uint64_t completed = timeline.IsValid() ? timeline.GetCompletedValue() : UINT64_MAX;
+	if (completed == UINT64_MAX || completed >= value) {
+		{
+			std::scoped_lock lock(m_mutex);
+			++m_stats.registeredWaits;
+			++m_stats.completedInline;
+		}
+		callback(completed != UINT64_MAX);
+		return;
+	}
+
+	bool cancelled = false;
+	{
+		std::scoped_lock lock(m_mutex);
+		++m_stats.registeredWaits;
+		if (m_quit) {
+			// Cleanup is joining the worker; nothing would release this wait.
+			++m_stats.cancelledWaits;
+			cancelled = true;
+		}
+		else {
+			if (!m_thread.joinable()) {
+				m_thread = std::thread(&FenceWaiter::WorkerMain, this);
+			}
+			m_waits.push_back(PendingWait{ timeline, value, std::move(callback) });
+		}
+	}
+	if (cancelled) {
+		callback(false);
+		return;
+	}
+	m_cv.notify_one();
+}
+
+std::shared_future<bool> FenceWaiter::WaitAsync(rhi::Timeline timeline, uint64_t value) {
+	auto promise = std::make_shared<std::promise<bool>>();
+	std::shared_future<bool> future = promise->get_future().share();
+	WhenReached(timeline, value, [promise](bool reached) { promise->set_value(reached); });
+	return future;
+}
+
+void FenceWaiter::WorkerMain() {
+	tracy::SetThreadName("RG Fence Waiter");
+	std::vector<std::pair<Callback, bool>> ready;
+	std::unique_lock lock(m_mutex);
+	for (;;) {
+		m_cv.wait(lock, [&] { return m_quit || !m_waits.empty(); });
+		if (m_quit) {
+			break;
+		}
+
+		// Release everything that has completed, on any timeline.
+		for (auto it = m_waits.begin(); it != m_waits.end();) {
+			const uint64_t completed = it->timeline.GetCompletedValue();
+			if (completed != UINT64_MAX && completed < it->value) {
+				++it;
+				continue;
+			}
+			const bool reached = completed != UINT64_MAX; // Device lost: release the waiter
+			if (!reached) {
+				++m_stats.failedWaits;
+			}
+			ready.emplace_back(std::move(it->callback), reached);
+			it = m_waits.erase(it);
+		}
+		if (!ready.empty()) {
+			lock.unlock();
+			for (auto& [callback, reached] : ready) {
+				callback(reached);
+			}
+			ready.clear();
+			lock.lock();
+			continue;
+		}
+
+		// Nothing is ready: block on the oldest wait. Waits registered meanwhile queue behind it
+		// and are swept as soon as it returns.
+		const rhi::Timeline timeline = m_waits.front().timeline;
+		const uint64_t value = m_waits.front().value;
+		++m_stats.hostWaits;
+		lock.unlock();
+		bool failed = false;
+		{
+			ZoneScopedN("FenceWaiter::HostWait");
+			const rhi::Result result = timeline.HostWait(value);
+			if (rhi::Failed(result)) {
+				spdlog::warn("FenceWaiter: host wait for value {} failed: {}", value, rhi::ResultName(result));
+				failed = true;
+			}
+		}
+		lock.lock();
+		if (failed) {
+			// Only this thread removes waits, so the front is still the one it blocked on.
+			Callback callback = std::move(m_waits.front().callback);
+			m_waits.pop_front();
+			++m_stats.failedWaits;
+			lock.unlock();
+			callback(false);
+			lock.lock();
+		}
+	}
+
+	// Cancel the waits that were never started.
+	std::deque<PendingWait> cancelled = std::move(m_waits);
+	m_waits.clear();
+	m_stats.cancelledWaits += cancelled.size();
+	lock.unlock();
+	for (auto& wait : cancelled) {
+		wait.callback(false);
+	}
+}
+
+FenceWaiter::Stats FenceWaiter::GetStats() const {
+	std::scoped_lock lock(m_mutex);
+	return m_stats;
+}
+
+void FenceWaiter::Cleanup() {
+	std::thread worker;
+	{
+		std::scoped_lock lock(m_mutex);
+		m_quit = true;
+		worker = std::move(m_thread);
+	}
+	m_cv.notify_all();
+	if (worker.joinable()) {
+		worker.join();
+	}
+	std::scoped_lock lock(m_mutex);
+	m_quit = false;
+}
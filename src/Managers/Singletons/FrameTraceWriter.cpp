@@ -0,0 +1,269 @@
+#include "Managers/Singletons/FrameTraceWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+namespace {
+thread_local uint32_t s_traceThreadId = 0;
+
+const char* QueueTraceName(size_t queueIndex) {
+	switch (static_cast<rhi::QueueKind>(queueIndex)) {
+	case rhi::QueueKind::Graphics: return "Graphics queue";
+	case rhi::QueueKind::Compute:  return "Compute queue";
+	case rhi::QueueKind::Copy:     return "Copy queue";
+	}
+	return "Queue";
+}
+
+const char* CounterTraceName(FrameTraceCounter counter) {
+	switch (counter) {
+	case FrameTraceCounter::UploadBytes:         return "UploadBytes";
+	case FrameTraceCounter::StreamedUploadBytes: return "StreamedUploadBytes";
+	case FrameTraceCounter::ReadbackBytes:       return "ReadbackBytes";
+	case FrameTraceCounter::Count:               break;
+	}
+	return "Counter";
+}
+
+void WriteJsonString(std::ofstream& out, const std::string& text) {
+	out.put('"');
+	for (const char c : text) {
+		switch (c) {
+		case '"':  out << "\\\""; break;
+		case '\\': out << "\\\\"; break;
+		case '\n': out << "\\n"; break;
+		case '\t': out << "\\t"; break;
+		default:
+			if (static_cast<unsigned char>(c) < 0x20) {
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned>(c));
+				out << escaped;
+			}
+			else {
+				out.put(c);
+			}
+		}
+	}
+	out.put('"');
+}
+}
+
+FrameTraceWriter& FrameTraceWriter::GetInstance() {
+	static FrameTraceWriter instance;
+	return instance;
+}
+
+bool FrameTraceWriter::Start(const std::string& path, uint32_t maxQueuedFrames) {
+	if (IsCapturing() || m_writerThread.joinable()) {
+		spdlog::warn("FrameTraceWriter::Start: a capture is already running; ignoring '{}'.", path);
+		return false;
+	}
+	m_out.open(path, std::ios::out | std::ios::trunc);
+	if (!m_out) {
+		spdlog::error("FrameTraceWriter::Start: cannot open '{}' for writing.", path);
+		return false;
+	}
+
+	m_out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+	m_out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << kCpuPid << ",\"args\":{\"name\":\"OpenRenderGraph CPU\"}},\n";
+	m_out << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << kGpuPid << ",\"args\":{\"name\":\"OpenRenderGraph GPU\"}}";
+	for (size_t queueIndex = 0; queueIndex < m_gpuAnchors.size(); ++queueIndex) {
+		m_out << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << kGpuPid << ",\"tid\":" << queueIndex + 1
+			<< ",\"args\":{\"name\":\"" << QueueTraceName(queueIndex) << "\"}}";
+	}
+	m_firstEvent = false;
+
+	m_captureStart = Clock::now();
+	m_frameStart = m_captureStart;
+	m_gpuAnchors = {};
+	for (auto& counter : m_counters) {
+		counter.store(0, std::memory_order_relaxed);
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_frameMutex);
+		m_frameEvents.clear();
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_queuedFrames.clear();
+		m_maxQueuedFrames = (std::max)(maxQueuedFrames, 1u);
+		m_droppedFrames = 0;
+		m_quit = false;
+	}
+	m_writerThread = std::thread(&FrameTraceWriter::WriterMain, this);
+	m_capturing.store(true, std::memory_order_release);
+	spdlog::info("FrameTraceWriter: capturing frame trace to '{}'.", path);
+	return true;
+}
+
+void FrameTraceWriter::Stop() {
+	m_capturing.store(false, std::memory_order_release);
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		m_quit = true;
+	}
+	m_queueCv.notify_all();
+	if (m_writerThread.joinable()) {
+		m_writerThread.join();
+	}
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	m_frameEvents.clear();
+}
+
+double FrameTraceWriter::ToTraceUs(Clock::time_point time) const {
+	return std::chrono::duration<double, std::micro>(time - m_captureStart).count();
+}
+
+double FrameTraceWriter::GpuToTraceUs(rhi::QueueKind queue, uint64_t ticks, uint64_t ticksPerSecond) {
+	auto& anchor = m_gpuAnchors[static_cast<size_t>(queue)];
+	if (!anchor.valid) {
+		anchor.valid = true;
+		anchor.ticks = ticks;
+		anchor.timestampUs = ToTraceUs(Clock::now());
+	}
+	const double deltaTicks = ticks >= anchor.ticks ? double(ticks - anchor.ticks) : -double(anchor.ticks - ticks);
+	return anchor.timestampUs + deltaTicks * 1e6 / double(ticksPerSecond);
+}
+
+void FrameTraceWriter::Push(Event&& event) {
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	m_frameEvents.push_back(std::move(event));
+}
+
+void FrameTraceWriter::CpuSpan(const char* name, Clock::time_point begin, Clock::time_point end) {
+	if (!IsCapturing()) {
+		return;
+	}
+	if (s_traceThreadId == 0) {
+		s_traceThreadId = m_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+	}
+	Event event;
+	event.name = name;
+	event.timestampUs = ToTraceUs(begin);
+	event.durationUs = std::chrono::duration<double, std::micro>(end - begin).count();
+	event.pid = kCpuPid;
+	event.tid = s_traceThreadId;
+	Push(std::move(event));
+}
+
+void FrameTraceWriter::GpuSpan(rhi::QueueKind queue, std::string name, uint64_t beginTicks, uint64_t endTicks, uint64_t ticksPerSecond) {
+	if (!IsCapturing() || ticksPerSecond == 0 || static_cast<size_t>(queue) >= m_gpuAnchors.size()) {
+		return;
+	}
+	Event event;
+	event.name = std::move(name);
+	event.durationUs = endTicks > beginTicks ? double(endTicks - beginTicks) * 1e6 / double(ticksPerSecond) : 0.0;
+	event.pid = kGpuPid;
+	event.tid = static_cast<uint32_t>(queue) + 1;
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	event.timestampUs = GpuToTraceUs(queue, beginTicks, ticksPerSecond);
+	m_frameEvents.push_back(std::move(event));
+}
+
+void FrameTraceWriter::GpuInstant(rhi::QueueKind queue, std::string name, uint64_t ticks, uint64_t ticksPerSecond) {
+	if (!IsCapturing() || ticksPerSecond == 0 || static_cast<size_t>(queue) >= m_gpuAnchors.size()) {
+		return;
+	}
+	Event event;
+	event.name = std::move(name);
+	event.pid = kGpuPid;
+	event.tid = static_cast<uint32_t>(queue) + 1;
+	event.phase = 'i';
+	std::lock_guard<std::mutex> lock(m_frameMutex);
+	event.timestampUs = GpuToTraceUs(queue, ticks, ticksPerSecond);
+	m_frameEvents.push_back(std::move(event));
+}
+
+void FrameTraceWriter::EndFrame(uint64_t frameSerial) {
+	if (!IsCapturing()) {
+		return;
+	}
+	ZoneScopedN("FrameTraceWriter::EndFrame");
+	const Clock::time_point now = Clock::now();
+	std::vector<Event> frame;
+	{
+		std::lock_guard<std::mutex> lock(m_frameMutex);
+		frame.swap(m_frameEvents);
+	}
+
+	if (s_traceThreadId == 0) {
+		s_traceThreadId = m_nextThreadId.fetch_add(1, std::memory_order_relaxed);
+	}
+	Event frameSpan;
+	frameSpan.name = "Frame " + std::to_string(frameSerial);
+	frameSpan.timestampUs = ToTraceUs(m_frameStart);
+	frameSpan.durationUs = std::chrono::duration<double, std::micro>(now - m_frameStart).count();
+	frameSpan.pid = kCpuPid;
+	frameSpan.tid = s_traceThreadId;
+	frame.push_back(std::move(frameSpan));
+	for (size_t i = 0; i < m_counters.size(); ++i) {
+		Event counter;
+		counter.name = CounterTraceName(static_cast<FrameTraceCounter>(i));
+		counter.timestampUs = ToTraceUs(m_frameStart);
+		counter.value = static_cast<int64_t>(m_counters[i].exchange(0, std::memory_order_relaxed));
+		counter.pid = kCpuPid;
+		counter.phase = 'C';
+		frame.push_back(std::move(counter));
+	}
+	m_frameStart = now;
+
+	{
+		std::lock_guard<std::mutex> lock(m_queueMutex);
+		if (m_queuedFrames.size() >= m_maxQueuedFrames) {
+			++m_droppedFrames;
+			return;
+		}
+		Event dropped;
+		dropped.name = "DroppedFrames";
+		dropped.timestampUs = ToTraceUs(now);
+		dropped.value = static_cast<int64_t>(m_droppedFrames);
+		dropped.pid = kCpuPid;
+		dropped.phase = 'C';
+		frame.push_back(std::move(dropped));
+		m_queuedFrames.push_back(std::move(frame));
+	}
+	m_queueCv.notify_one();
+}
+
+void FrameTraceWriter::WriteEvent(const Event& event) {
+	m_out << (m_firstEvent ? "\n" : ",\n");
+	m_firstEvent = false;
+	m_out << "{\"name\":";
+	WriteJsonString(m_out, event.name);
+	m_out << ",\"ph\":\"" << event.phase << "\",\"pid\":" << event.pid << ",\"tid\":" << event.tid
+		<< ",\"ts\":" << event.timestampUs;
+	switch (event.phase) {
+	case 'X': m_out << ",\"dur\":" << event.durationUs; break;
+	case 'i': m_out << ",\"s\":\"t\""; break;
+	case 'C': m_out << ",\"args\":{\"value\":" << event.value << '}'; break;
+	default: break;
+	}
+	m_out << '}';
+}
+
+void FrameTraceWriter::WriterMain() {
+	tracy::SetThreadName("ORG Frame Trace Writer");
+	m_out << std::fixed;
+	m_out.precision(3);
+	for (;;) {
+		std::vector<Event> frame;
+		{
+			std::unique_lock<std::mutex> lock(m_queueMutex);
+			m_queueCv.wait(lock, [this] { return m_quit || !m_queuedFrames.empty(); });
+			if (m_queuedFrames.empty()) {
+				break;
+			}
+			frame = std::move(m_queuedFrames.front());
+			m_queuedFrames.pop_front();
+		}
+		ZoneScopedN("FrameTraceWriter::WriteFrame");
+		for (const auto& event : frame) {
+			WriteEvent(event);
+		}
+		m_out.flush();
+	}
+	m_out << "\n]}\n";
+	m_out.close();
+}
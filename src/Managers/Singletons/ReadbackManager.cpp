@@ -1,7 +1,14 @@
 #include "Managers/Singletons/ReadbackManager.h"
 
+#include <algorithm>
 #include <cstring>
+#include <stdexcept>
+#include <string>
 #include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Managers/Singletons/FenceWaiter.h"
+#include "Managers/Singletons/FrameTraceWriter.h"
 
 std::unique_ptr<ReadbackManager> ReadbackManager::instance = nullptr;
 bool ReadbackManager::initialized = false;
@@ -31,6 +38,75 @@ void ReadbackManager::RequestReadbackCapture(
         });
 }
 
+void ReadbackManager::RequestReadbackReduction(
+    const std::string& passName,
+    Resource* resource,
+    const RangeSpec& range,
+    const ReadbackReductionDesc& reduction,
+    ReadbackCaptureCallback callback,
+    QueueKind preferredQueueKind)
+{
+    if (reduction.kind == ReadbackReductionKind::None) {
+        RequestReadbackCapture(passName, resource, range, std::move(callback), preferredQueueKind);
+        return;
+    }
+    if (reduction.kind == ReadbackReductionKind::Texel) {
+        if (resource && !resource->HasLayout()) {
+            throw std::runtime_error("ReadbackManager::RequestReadbackReduction: texel reductions need a texture");
+        }
+    }
+    else if (!GetReadbackReducer(reduction.kind)) {
+        throw std::runtime_error(
+            "ReadbackManager::RequestReadbackReduction: no reducer registered for reduction kind "
+            + std::to_string(static_cast<int>(reduction.kind)));
+    }
+    else if (reduction.kind == ReadbackReductionKind::Histogram && reduction.histogramBins == 0) {
+        throw std::runtime_error("ReadbackManager::RequestReadbackReduction: histogram reductions need at least one bin");
+    }
+
+    std::weak_ptr<Resource> weakResource;
+    uint64_t resourceId = 0;
+    if (resource) {
+        weakResource = resource->weak_from_this();
+        resourceId = resource->GetGlobalResourceID();
+    }
+
+    std::scoped_lock lock(m_captureQueueMutex);
+    m_queuedCaptures.push_back(ReadbackCaptureInfo{
+        passName,
+        weakResource,
+        resourceId,
+        range,
+        std::move(callback),
+        preferredQueueKind,
+        reduction
+        });
+}
+
+void ReadbackManager::RegisterReadbackReducer(std::shared_ptr<rg::runtime::IReadbackReducer> reducer) {
+    if (!reducer) {
+        return;
+    }
+    std::scoped_lock lock(m_captureQueueMutex);
+    for (auto& existing : m_readbackReducers) {
+        if (existing->GetKind() == reducer->GetKind()) {
+            existing = std::move(reducer);
+            return;
+        }
+    }
+    m_readbackReducers.push_back(std::move(reducer));
+}
+
+std::shared_ptr<rg::runtime::IReadbackReducer> ReadbackManager::GetReadbackReducer(ReadbackReductionKind kind) {
+    std::scoped_lock lock(m_captureQueueMutex);
+    for (const auto& reducer : m_readbackReducers) {
+        if (reducer->GetKind() == kind) {
+            return reducer;
+        }
+    }
+    return nullptr;
+}
+
 std::vector<ReadbackCaptureInfo> ReadbackManager::ConsumeCaptureRequests() {
     std::lock_guard<std::mutex> lock(m_captureQueueMutex);
     auto out = std::move(m_queuedCaptures);
@@ -46,16 +122,39 @@ ReadbackCaptureToken ReadbackManager::EnqueueCapture(ReadbackCaptureRequest&& re
     return { token };
 }
 
-void ReadbackManager::FinalizeCapture(ReadbackCaptureToken token, QueueKind queueKind, std::shared_ptr<rhi::TimelinePtr> signalFenceOwner, uint64_t fenceValue) {
+ReadbackCaptureToken ReadbackManager::EnqueueCaptureBatch(std::vector<ReadbackCaptureRequest>&& requests) {
+    const uint64_t token = ++m_captureTokenCounter;
     std::lock_guard<std::mutex> lock(readbackRequestsMutex);
+    for (auto& request : requests) {
+        request.token = token;
+        m_readbackCaptureRequests.push_back(std::move(request));
+    }
+    return { token };
+}
+
+void ReadbackManager::FinalizeCapture(ReadbackCaptureToken token, QueueKind queueKind, std::shared_ptr<rhi::TimelinePtr> signalFenceOwner, uint64_t fenceValue) {
+    std::unique_lock<std::mutex> lock(readbackRequestsMutex);
+    bool found = false;
     for (auto& request : m_readbackCaptureRequests) {
         if (request.token == token.id) {
             request.signalQueueKind = NormalizeQueueKind(queueKind);
-            request.signalFenceOwner = std::move(signalFenceOwner);
+            request.signalFenceOwner = signalFenceOwner;
             request.fenceValue = fenceValue;
-            return;
+            found = true;
         }
     }
+    if (found) {
+        if (m_callbackDispatch == rg::runtime::ReadbackCallbackDispatch::Worker && m_initialized) {
+            // Delivered the moment the copy lands rather than at the next ProcessReadbackRequests.
+            // The fence is only signalled once the frame is submitted, so OnFrameSubmitted hands
+            // it to the fence waiter.
+            const rhi::Timeline timeline = signalFenceOwner && *signalFenceOwner ? signalFenceOwner->Get() : ResolveReadbackFence(queueKind);
+            if (timeline.IsValid()) {
+                m_unsubmittedFenceWaits.push_back(UnsubmittedFenceWait{ std::move(signalFenceOwner), timeline, fenceValue });
+            }
+        }
+        return;
+    }
 
     spdlog::warn(
         "ReadbackManager::FinalizeCapture could not find token {}. Pending captures: {}.",
@@ -63,6 +162,79 @@ void ReadbackManager::FinalizeCapture(ReadbackCaptureToken token, QueueKind queu
         m_readbackCaptureRequests.size());
 }
 
+void ReadbackManager::OnFrameSubmitted() {
+    std::vector<UnsubmittedFenceWait> waits;
+    {
+        std::lock_guard<std::mutex> lock(readbackRequestsMutex);
+        waits = std::move(m_unsubmittedFenceWaits);
+        m_unsubmittedFenceWaits.clear();
+    }
+    for (auto& wait : waits) {
+        // The owner rides along so the capture's timeline outlives the wait on it. The callback
+        // may run inline when the value has already been reached.
+        FenceWaiter::GetInstance().WhenReached(wait.timeline, wait.value, [this, owner = std::move(wait.signalFenceOwner)](bool) {
+            std::lock_guard<std::mutex> deliverLock(readbackRequestsMutex);
+            DeliverCompletedCapturesLocked(true);
+        });
+    }
+}
+
+ReadbackAllocation ReadbackManager::AllocateReadback(QueueKind queueKind, uint64_t size, uint64_t alignment, uint32_t shareCount) {
+    const bool copyQueue = NormalizeQueueKind(queueKind) == QueueKind::Copy;
+    FrameTraceWriter::GetInstance().AddToCounter(FrameTraceCounter::ReadbackBytes, size);
+    return ResolveReadbackPages(queueKind).Allocate(
+        static_cast<size_t>(size),
+        static_cast<size_t>((std::max)(alignment, uint64_t{ 1 })),
+        copyQueue ? "ReadbackCopyCapturePage" : "ReadbackCapturePage",
+        (std::max)(shareCount, 1u));
+}
+
+void ReadbackManager::ReleaseReadback(const ReadbackCaptureRequest& request) {
+    if (request.mappedData && request.readbackBuffer) {
+        ResolveReadbackPages(request.readbackPoolQueueKind).Release(request.readbackBuffer.get());
+    }
+}
+
+void ReadbackManager::DispatchToCallbackWorker(PendingCallback&& pending) {
+    {
+        std::lock_guard<std::mutex> lock(m_callbackMutex);
+        if (!m_callbackThread.joinable()) {
+            m_callbackQuit = false;
+            m_callbackThread = std::thread(&ReadbackManager::CallbackWorkerMain, this);
+        }
+        m_pendingCallbacks.push_back(std::move(pending));
+    }
+    m_callbackCv.notify_one();
+}
+
+void ReadbackManager::CallbackWorkerMain() {
+    for (;;) {
+        PendingCallback pending;
+        {
+            std::unique_lock<std::mutex> lock(m_callbackMutex);
+            m_callbackCv.wait(lock, [this] { return m_callbackQuit || !m_pendingCallbacks.empty(); });
+            if (m_pendingCallbacks.empty()) {
+                return;
+            }
+            pending = std::move(m_pendingCallbacks.front());
+            m_pendingCallbacks.pop_front();
+        }
+        ZoneScopedN("ReadbackManager::CallbackWorker");
+        pending.callback(std::move(pending.result));
+    }
+}
+
+void ReadbackManager::StopCallbackWorker() {
+    {
+        std::lock_guard<std::mutex> lock(m_callbackMutex);
+        m_callbackQuit = true;
+    }
+    m_callbackCv.notify_all();
+    if (m_callbackThread.joinable()) {
+        m_callbackThread.join();
+    }
+}
+
 rhi::Timeline ReadbackManager::GetReadbackFence(QueueKind queueKind) const {
     return ResolveReadbackFence(queueKind);
 }
@@ -84,14 +256,28 @@ void ReadbackManager::ProcessReadbackRequests() {
         return;
     }
 
+    DeliverCompletedCapturesLocked(false);
+    m_graphicsReadbackPages.Reclaim();
+    m_copyReadbackPages.Reclaim();
+}
+
+void ReadbackManager::DeliverCompletedCapturesLocked(bool workerDispatchOnly) {
     std::vector<ReadbackCaptureRequest> remainingCaptures;
     remainingCaptures.reserve(m_readbackCaptureRequests.size());
     for (auto& request : m_readbackCaptureRequests) {
+        // From the fence waiter only captures that go straight to the callback worker are
+        // delivered; the rest wait for ProcessReadbackRequests on the frame thread.
+        const bool workerDispatch = m_callbackDispatch == rg::runtime::ReadbackCallbackDispatch::Worker && request.mappedData && request.callback;
+        if (workerDispatchOnly && (request.fenceValue == 0 || !workerDispatch)) {
+            remainingCaptures.push_back(std::move(request));
+            continue;
+        }
         if (request.fenceValue == 0) {
             spdlog::warn(
                 "ReadbackManager dropping capture token {} for resource {} because it has no fence value (FinalizeCapture was not applied).",
                 request.token,
                 request.desc.resourceId);
+            ReleaseReadback(request);
             continue;
         }
 
@@ -107,26 +293,43 @@ void ReadbackManager::ProcessReadbackRequests() {
                     request.token,
                     request.desc.resourceId,
                     static_cast<int>(request.signalQueueKind));
+                ReleaseReadback(request);
                 continue;
             }
         }
 
         const auto completedValue = requestFence.GetCompletedValue();
         if (completedValue >= request.fenceValue) {
-            void* mappedData = nullptr;
-            request.readbackBuffer->GetAPIResource().Map(&mappedData);
-
             ReadbackCaptureResult result{};
             result.desc = request.desc;
-            result.layouts = request.layouts;
+            result.layouts = std::move(request.layouts);
             result.format = request.format;
             result.width = request.width;
             result.height = request.height;
             result.depth = request.depth;
-            result.data.resize(request.totalSize);
 
-            std::memcpy(result.data.data(), mappedData, request.totalSize);
-            request.readbackBuffer->GetAPIResource().Unmap(0, 0);
+            if (workerDispatch) {
+                // The lease keeps the page slot reserved until the callback drops its view.
+                ReadbackPagePool* pages = &ResolveReadbackPages(request.readbackPoolQueueKind);
+                result.mappedData = std::span<const std::byte>(request.mappedData, static_cast<size_t>(request.totalSize));
+                result.mappedLease = std::shared_ptr<const void>(
+                    request.mappedData,
+                    [pages, buffer = request.readbackBuffer](const void*) { pages->Release(buffer.get()); });
+                DispatchToCallbackWorker({ std::move(request.callback), std::move(result) });
+                continue;
+            }
+
+            result.data.resize(request.totalSize);
+            if (request.mappedData) {
+                std::memcpy(result.data.data(), request.mappedData, request.totalSize);
+                ReleaseReadback(request);
+            }
+            else {
+                void* mappedData = nullptr;
+                request.readbackBuffer->GetAPIResource().Map(&mappedData);
+                std::memcpy(result.data.data(), mappedData, request.totalSize);
+                request.readbackBuffer->GetAPIResource().Unmap(0, 0);
+            }
 
             if (request.callback) {
                 request.callback(std::move(result));
@@ -7,8 +7,11 @@
 
 #include "Managers/Singletons/DeviceManager.h"
 #include "Managers/Singletons/DeletionManager.h"
+#include "Managers/Singletons/FrameTraceWriter.h"
 #include "Render/Runtime/OpenRenderGraphSettings.h"
 
+thread_local StatisticsManager::CpuTimingAccumulator* StatisticsManager::s_cpuAccumulator = nullptr;
+
 StatisticsManager& StatisticsManager::GetInstance() {
     static StatisticsManager inst;
     return inst;
@@ -32,72 +35,77 @@ void StatisticsManager::Initialize() {
     };
     m_collectPassStatistics = m_getCollectPassStatistics();
     m_collectPipelineStatistics = m_getCollectPipelineStatistics();
-}
-
-void StatisticsManager::RegisterPasses(const std::vector<std::string>& passNames) {
-    m_passNames = passNames;
-    m_numPasses = static_cast<unsigned>(passNames.size());
-    m_passTechniquePaths.assign(m_numPasses, {});
-    m_stats.assign(m_numPasses, {});
-    m_isGeometryPass.assign(m_numPasses, false);
-    m_meshStatsEma.assign(m_numPasses, {});
-    m_passLastExecutionFrame.assign(m_numPasses, kNeverSeenFrame);
-    m_passNameToIndex.clear();
-    for (unsigned i = 0; i < m_numPasses; ++i) {
-        if (!m_passNames[i].empty()) {
-            m_passNameToIndex.emplace(m_passNames[i], i);
-        }
+    m_passStatisticsMode = rg::runtime::GetOpenRenderGraphSettings().passStatisticsMode;
+    m_sampledPassesPerFrame = rg::runtime::GetOpenRenderGraphSettings().passStatisticsSampledPassesPerFrame;
+    m_exportTracyGpuZones = TracyGpuTimeline::Available() && rg::runtime::GetOpenRenderGraphSettings().exportTracyGpuZones;
+    m_tracyGpuTimeline.SetTimestampFrequency(m_gpuTimestampFreq);
+    if (m_exportTracyGpuZones) {
+        m_batchSync.assign(m_numFramesInFlight, std::vector<BatchQueueSync>(kBatchQueryEntries));
     }
 }
 
-unsigned StatisticsManager::RegisterPass(const std::string& passName, bool isGeometryPass, std::string_view techniquePath) {
-    if (!passName.empty()) {
-        auto it = m_passNameToIndex.find(passName);
-        if (it != m_passNameToIndex.end()) {
-            if (isGeometryPass) {
-                m_isGeometryPass[it->second] = true;
-            }
-            if (!techniquePath.empty()) {
-                auto& existingTechniquePath = m_passTechniquePaths[it->second];
-                if (existingTechniquePath.empty()) {
-                    existingTechniquePath.assign(techniquePath);
-                }
-                else if (existingTechniquePath != techniquePath) {
-                    spdlog::warn(
-                        "Pass '{}' was registered with conflicting technique paths '{}' and '{}'. Keeping the first one.",
-                        passName,
-                        existingTechniquePath,
-                        techniquePath);
-                }
-            }
-            return it->second;
-        }
+void StatisticsManager::RegisterPass(PassId passId, std::string_view passName, bool isGeometryPass, std::string_view techniquePath) {
+    if (!passId) {
+        return;
     }
-
-    std::string resolvedName = passName;
-    if (resolvedName.empty()) {
-        resolvedName = "UnnamedPass#" + std::to_string(m_unnamedPassCounter++);
+    const unsigned index = passId.index;
+    if (index >= m_passNames.size()) {
+        const size_t count = size_t(index) + 1;
+        m_passNames.resize(count);
+        m_passTechniquePaths.resize(count);
+        m_stats.resize(count);
+        m_isGeometryPass.resize(count, false);
+        m_meshStatsEma.resize(count);
+        m_passLastExecutionFrame.resize(count, kNeverSeenFrame);
+        m_numPasses = static_cast<unsigned>(count);
+    }
+
+    auto& name = m_passNames[index];
+    if (name.empty()) {
+        name = passName.empty() ? "UnnamedPass#" + std::to_string(index) : std::string(passName);
+    }
+    if (isGeometryPass) {
+        m_isGeometryPass[index] = true;
+    }
+    if (!techniquePath.empty()) {
+        auto& existingTechniquePath = m_passTechniquePaths[index];
+        if (existingTechniquePath.empty()) {
+            existingTechniquePath.assign(techniquePath);
+        }
+        else if (existingTechniquePath != techniquePath) {
+            spdlog::warn(
+                "Pass '{}' was registered with conflicting technique paths '{}' and '{}'. Keeping the first one.",
+                name,
+                existingTechniquePath,
+                techniquePath);
+        }
     }
-
-    const unsigned index = static_cast<unsigned>(m_passNames.size());
-    m_passNames.push_back(resolvedName);
-    m_passNameToIndex[resolvedName] = index;
-
-    m_numPasses = static_cast<unsigned>(m_passNames.size());
-    m_passTechniquePaths.emplace_back(techniquePath);
-    m_stats.emplace_back();
-    m_isGeometryPass.push_back(isGeometryPass);
-    m_meshStatsEma.emplace_back();
-    m_passLastExecutionFrame.push_back(kNeverSeenFrame);
-    return index;
 }
 
 void StatisticsManager::BeginFrame() {
+    MergeCpuTimings();
+    auto& frameTrace = FrameTraceWriter::GetInstance();
+    frameTrace.EndFrame(m_frameSerial);
     ++m_frameSerial;
+    // Recording tasks write their own batch entries, so the storage is allocated here, before them.
+    if (frameTrace.IsCapturing() && m_batchSync.empty()) {
+        m_batchSync.assign(m_numFramesInFlight, std::vector<BatchQueueSync>(kBatchQueryEntries));
+    }
 
     if (m_getCollectPassStatistics) {
         m_collectPassStatistics = m_getCollectPassStatistics();
     }
+    m_passStatisticsMode = rg::runtime::GetOpenRenderGraphSettings().passStatisticsMode;
+    m_sampledPassesPerFrame = rg::runtime::GetOpenRenderGraphSettings().passStatisticsSampledPassesPerFrame;
+    if (m_numPasses > 0) {
+        m_sampleWindowBegin = static_cast<uint32_t>((uint64_t(m_sampleWindowBegin) + m_sampledPassesPerFrame) % m_numPasses);
+    }
+    if (m_getCollectPipelineStatistics) {
+        m_collectPipelineStatistics = m_getCollectPipelineStatistics();
+    }
+    m_pipelineStatsIntervalFrames = rg::runtime::GetOpenRenderGraphSettings().pipelineStatisticsSampleIntervalFrames;
+    m_pipelineStatsPassesPerFrame = rg::runtime::GetOpenRenderGraphSettings().pipelineStatisticsSampledPassesPerFrame;
+    RebuildPipelineStatsSample();
 
     rg::runtime::MemoryBudgetStats memoryBudgetStats{};
     memoryBudgetStats.sampleFrameSerial = m_frameSerial;
@@ -124,23 +132,112 @@ void StatisticsManager::RecordCpuTimeSample(unsigned passIndex, double milliseco
         return;
     }
 
-    std::scoped_lock lock(m_cpuStatsMutex);
-    if (passIndex >= m_stats.size()) {
-        return;
+    auto& accumulator = ThreadCpuTimingAccumulator();
+    std::scoped_lock lock(accumulator.mutex);
+    if (passIndex >= accumulator.samples.size()) {
+        accumulator.samples.resize(passIndex + 1);
     }
-
-    auto& passStats = m_stats[passIndex];
+    auto& sample = accumulator.samples[passIndex];
     if (isUpdate) {
-        UpdateEma(passStats.cpuUpdateTimeEma, milliseconds);
+        sample.updateMs += milliseconds;
+        ++sample.updateCount;
     }
     else {
-        UpdateEma(passStats.cpuExecuteTimeEma, milliseconds);
-        if (passIndex < m_passLastExecutionFrame.size()) {
-            m_passLastExecutionFrame[passIndex] = m_frameSerial;
+        sample.executeMs += milliseconds;
+        ++sample.executeCount;
+    }
+    accumulator.dirty = true;
+}
+
+StatisticsManager::CpuTimingAccumulator& StatisticsManager::ThreadCpuTimingAccumulator() {
+    if (!s_cpuAccumulator) {
+        std::scoped_lock lock(m_cpuAccumulatorRegistryMutex);
+        s_cpuAccumulator = m_cpuAccumulators.emplace_back(std::make_unique<CpuTimingAccumulator>()).get();
+    }
+    return *s_cpuAccumulator;
+}
+
+// Sums every thread's samples per pass first, so a pass whose Update and Execute ran on
+// different threads, or that several threads recorded into, still gets one EMA sample per merge.
+void StatisticsManager::MergeCpuTimings() {
+    std::scoped_lock registryLock(m_cpuAccumulatorRegistryMutex);
+    auto& sums = m_cpuTimingMergeScratch;
+    sums.assign(m_stats.size(), {});
+    bool any = false;
+    for (auto& accumulator : m_cpuAccumulators) {
+        std::scoped_lock lock(accumulator->mutex);
+        if (!accumulator->dirty) {
+            continue;
+        }
+        const size_t count = (std::min)(accumulator->samples.size(), sums.size());
+        for (size_t passIndex = 0; passIndex < count; ++passIndex) {
+            auto& sample = accumulator->samples[passIndex];
+            auto& sum = sums[passIndex];
+            sum.updateMs += sample.updateMs;
+            sum.updateCount += sample.updateCount;
+            sum.executeMs += sample.executeMs;
+            sum.executeCount += sample.executeCount;
+            sample = {};
+        }
+        accumulator->dirty = false;
+        any = true;
+    }
+    if (!any) {
+        return;
+    }
+    for (size_t passIndex = 0; passIndex < sums.size(); ++passIndex) {
+        const auto& sum = sums[passIndex];
+        auto& passStats = m_stats[passIndex];
+        if (sum.updateCount != 0) {
+            UpdateEma(passStats.cpuUpdateTimeEma, sum.updateMs);
+        }
+        if (sum.executeCount != 0) {
+            UpdateEma(passStats.cpuExecuteTimeEma, sum.executeMs);
+            if (passIndex < m_passLastExecutionFrame.size()) {
+                m_passLastExecutionFrame[passIndex] = m_frameSerial;
+            }
         }
     }
 }
 
+bool StatisticsManager::IsPassSampled(unsigned passIndex) const {
+    if (m_passStatisticsMode == rg::runtime::PassStatisticsMode::AllPasses || m_numPasses <= m_sampledPassesPerFrame
+        || SamplesPipelineStats(passIndex)) {
+        return true;
+    }
+    const unsigned offset = (passIndex + m_numPasses - m_sampleWindowBegin) % m_numPasses;
+    return offset < m_sampledPassesPerFrame;
+}
+
+void StatisticsManager::RebuildPipelineStatsSample() {
+    m_pipelineStatsSampled.assign(m_numPasses, 0);
+    if (!m_collectPipelineStatistics || m_numPasses == 0) {
+        return;
+    }
+    if (m_frameSerial % (std::max)(m_pipelineStatsIntervalFrames, 1u) != 0) {
+        return;
+    }
+
+    const unsigned geometryPasses = static_cast<unsigned>(std::count(m_isGeometryPass.begin(), m_isGeometryPass.end(), true));
+    if (m_pipelineStatsPassesPerFrame == 0 || m_pipelineStatsPassesPerFrame >= geometryPasses) {
+        for (unsigned i = 0; i < m_numPasses; ++i) {
+            m_pipelineStatsSampled[i] = m_isGeometryPass[i] ? 1 : 0;
+        }
+        return;
+    }
+
+    uint32_t picked = 0;
+    unsigned passIndex = m_pipelineStatsCursor % m_numPasses;
+    for (unsigned visited = 0; visited < m_numPasses && picked < m_pipelineStatsPassesPerFrame; ++visited) {
+        if (m_isGeometryPass[passIndex]) {
+            m_pipelineStatsSampled[passIndex] = 1;
+            ++picked;
+        }
+        passIndex = (passIndex + 1) % m_numPasses;
+    }
+    m_pipelineStatsCursor = passIndex;
+}
+
 void StatisticsManager::RebuildVisiblePassIndices(uint64_t maxStaleFrames, std::vector<unsigned>& out) const {
     out.clear();
     out.reserve(m_passNames.size());
@@ -148,6 +245,9 @@ void StatisticsManager::RebuildVisiblePassIndices(uint64_t maxStaleFrames, std::
     const bool includeNeverSeen = (maxStaleFrames == (std::numeric_limits<uint64_t>::max)());
 
     for (unsigned i = 0; i < m_passNames.size(); ++i) {
+        if (m_passNames[i].empty()) {
+            continue; // ID handed out by the graph but never registered here
+        }
         const uint64_t lastExecution = (i < m_passLastExecutionFrame.size()) ? m_passLastExecutionFrame[i] : kNeverSeenFrame;
         if (lastExecution == kNeverSeenFrame) {
             if (includeNeverSeen) {
@@ -183,24 +283,36 @@ const std::vector<unsigned>& StatisticsManager::GetVisiblePassIndices(uint64_t m
     return m_visiblePassIndices;
 }
 
-void StatisticsManager::MarkGeometryPass(const std::string& passName) {
-    auto it = std::find(m_passNames.begin(), m_passNames.end(), passName);
-    if (it != m_passNames.end()) {
-        m_isGeometryPass[it - m_passNames.begin()] = true;
+void StatisticsManager::MarkGeometryPass(PassId passId) {
+    if (passId && passId.index < m_isGeometryPass.size()) {
+        m_isGeometryPass[passId.index] = true;
     }
 }
 
+StatisticsManager::QueueData* StatisticsManager::FindQueue(rhi::QueueKind queueKind) {
+    const size_t index = static_cast<size_t>(queueKind);
+    if (index >= m_queues.size() || !m_queues[index].registered) {
+        return nullptr;
+    }
+    return &m_queues[index];
+}
+
 void StatisticsManager::RegisterQueue(rhi::QueueKind queueKind) {
-    m_timestampBuffers[queueKind];
-    m_meshStatsBuffers[queueKind];
-    m_recordedQueries[queueKind];
-    m_pendingResolves[queueKind];
+    const size_t index = static_cast<size_t>(queueKind);
+    if (index >= m_queues.size()) {
+        spdlog::warn("StatisticsManager::RegisterQueue: queue kind {} is out of range", static_cast<int>(queueKind));
+        return;
+    }
+    auto& queueData = m_queues[index];
+    queueData.registered = true;
+    queueData.recordedQueries.resize((std::max)(queueData.recordedQueries.size(), size_t(m_numFramesInFlight)));
+    queueData.pendingResolves.resize((std::max)(queueData.pendingResolves.size(), size_t(m_numFramesInFlight)));
     if (m_timestampPool && m_pipelineStatsPool) {
-        EnsureQueueBuffers(queueKind);
+        EnsureQueueBuffers(queueData);
     }
 }
 
-void StatisticsManager::EnsureQueueBuffers(rhi::QueueKind queueKind) {
+void StatisticsManager::EnsureQueueBuffers(QueueData& queueData) {
     if (!m_timestampPool || !m_pipelineStatsPool) {
         return;
     }
@@ -214,10 +326,53 @@ void StatisticsManager::EnsureQueueBuffers(rhi::QueueKind queueKind) {
         static_cast<uint64_t>(m_pipelineStatsQueryInfo.elementSize) * m_pipelineStatsQueryInfo.count,
         rhi::HeapType::Readback);
 
-    auto& tsBuf = m_timestampBuffers[queueKind];
-    auto& psBuf = m_meshStatsBuffers[queueKind];
-    auto result = device.CreateCommittedResource(tsRb, tsBuf);
-    result = device.CreateCommittedResource(psRb, psBuf);
+    ReleaseQueueBuffers(queueData);
+    auto result = device.CreateCommittedResource(tsRb, queueData.timestampBuffer);
+    result = device.CreateCommittedResource(psRb, queueData.meshStatsBuffer);
+    MapQueueBuffers(queueData);
+}
+
+void StatisticsManager::MapQueueBuffers(QueueData& queueData) {
+    queueData.timestampMapped = nullptr;
+    queueData.meshStatsMapped = nullptr;
+    if (!queueData.timestampBuffer || !queueData.meshStatsBuffer) {
+        return;
+    }
+
+    // Readback memory stays mapped for the buffers' lifetime; OnFrameComplete reads a frame's
+    // region once the host reports that frame complete.
+    void* tsMapped = nullptr;
+    queueData.timestampBuffer->Map(&tsMapped);
+    void* psMapped = nullptr;
+    queueData.meshStatsBuffer->Map(&psMapped);
+    if (!tsMapped || !psMapped) {
+        spdlog::warn("StatisticsManager: failed to map statistics readback buffers; GPU statistics are disabled for this queue");
+        if (tsMapped) {
+            queueData.timestampBuffer->Unmap(0, 0);
+        }
+        if (psMapped) {
+            queueData.meshStatsBuffer->Unmap(0, 0);
+        }
+        return;
+    }
+    queueData.timestampMapped = static_cast<const uint8_t*>(tsMapped);
+    queueData.meshStatsMapped = static_cast<const uint8_t*>(psMapped);
+}
+
+void StatisticsManager::ReleaseQueueBuffers(QueueData& queueData) {
+    auto& deletionMgr = DeletionManager::GetInstance();
+    if (queueData.timestampMapped) {
+        queueData.timestampBuffer->Unmap(0, 0);
+        queueData.meshStatsBuffer->Unmap(0, 0);
+    }
+    queueData.timestampMapped = nullptr;
+    queueData.meshStatsMapped = nullptr;
+    if (queueData.timestampBuffer) {
+        deletionMgr.MarkForDelete(std::move(queueData.timestampBuffer));
+    }
+    if (queueData.meshStatsBuffer) {
+        deletionMgr.MarkForDelete(std::move(queueData.meshStatsBuffer));
+    }
 }
 
 void StatisticsManager::SetupQueryHeap() {
@@ -251,22 +406,15 @@ void StatisticsManager::SetupQueryHeap() {
     if (m_pipelineStatsPool) {
         deletionMgr.MarkForDelete(std::move(m_pipelineStatsPool));
     }
-    for (auto& kv : m_timestampBuffers) {
-        if (kv.second) {
-            deletionMgr.MarkForDelete(std::move(kv.second));
-        }
-    }
-    for (auto& kv : m_meshStatsBuffers) {
-        if (kv.second) {
-            deletionMgr.MarkForDelete(std::move(kv.second));
-        }
+    for (auto& queueData : m_queues) {
+        ReleaseQueueBuffers(queueData);
     }
 
-    // Timestamp heap: 2 queries/pass/frame
+    // Timestamp heap: 2 queries per pass and per batch entry, per frame
 
 	rhi::QueryPoolDesc tq;
     tq.type = rhi::QueryType::Timestamp;
-    tq.count = m_queryPoolPassCapacity * 2 * m_numFramesInFlight;
+    tq.count = (m_queryPoolPassCapacity + kBatchQueryEntries) * 2 * m_numFramesInFlight;
     auto result = device.CreateQueryPool(tq, m_timestampPool);
 
 	rhi::QueryPoolDesc sq;
@@ -283,11 +431,13 @@ void StatisticsManager::SetupQueryHeap() {
     rhi::ResourceDesc tsRb = rhi::helpers::ResourceDesc::Buffer(static_cast<uint64_t>(tsInfo.elementSize) * tsInfo.count, rhi::HeapType::Readback);
     rhi::ResourceDesc psRb = rhi::helpers::ResourceDesc::Buffer(static_cast<uint64_t>(psInfo.elementSize) * psInfo.count, rhi::HeapType::Readback);
 
-    for (auto& kv : m_timestampBuffers) {
-        auto& buf = kv.second;
-        result = device.CreateCommittedResource(tsRb, buf);
-        auto& mb = m_meshStatsBuffers[kv.first];
-        result = std::move(device.CreateCommittedResource(psRb, mb));
+    for (auto& queueData : m_queues) {
+        if (!queueData.registered) {
+            continue;
+        }
+        result = device.CreateCommittedResource(tsRb, queueData.timestampBuffer);
+        result = device.CreateCommittedResource(psRb, queueData.meshStatsBuffer);
+        MapQueueBuffers(queueData);
 	}
 
     m_timestampQueryInfo = m_timestampPool->GetQueryResultInfo();
@@ -297,13 +447,11 @@ void StatisticsManager::SetupQueryHeap() {
     m_pipelineStatsFields[1].field = rhi::PipelineStatTypes::MeshPrimitives;
     m_pipelineStatsLayout = m_pipelineStatsPool->GetPipelineStatsLayout(m_pipelineStatsFields.data(), static_cast<uint32_t>(m_pipelineStatsFields.size()));
 
-    m_recordedQueries.clear();
-    m_pendingResolves.clear();
-    for (auto& kv : m_timestampBuffers) {
-        const auto qk = kv.first;
-        m_recordedQueries[qk];
-        m_pendingResolves[qk];
+    for (auto& queueData : m_queues) {
+        queueData.recordedQueries.assign(m_numFramesInFlight, {});
+        queueData.pendingResolves.assign(m_numFramesInFlight, {});
     }
+    m_pipelineStatsRecorded.assign(m_numFramesInFlight, std::vector<uint8_t>(m_queryPoolPassCapacity, 0));
 }
 
 void StatisticsManager::BeginQuery(
@@ -314,12 +462,13 @@ void StatisticsManager::BeginQuery(
 {
     if (!m_collectPassStatistics) return;
     if (!m_timestampPool || passIndex >= m_numPasses || passIndex >= m_queryPoolPassCapacity) return;
+    if (!IsPassSampled(passIndex)) return;
 
-    auto queueKind = queue.GetKind();
-    auto tsIt = m_timestampBuffers.find(queueKind);
-    if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer) return;
 
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
 
     // Timestamp "begin" marker = write a timestamp at index 2*N
     const uint32_t tsIdx = (frameBase + passIndex) * 2u;
@@ -327,12 +476,16 @@ void StatisticsManager::BeginQuery(
     cmd.WriteTimestamp(m_timestampPool->GetHandle(), tsIdx, rhi::Stage::Top); // RHI: EndQuery on a Timestamp pool writes a timestamp
 
     // Begin pipeline stats for geometry passes
-    if (m_collectPipelineStatistics && m_isGeometryPass[passIndex]) {
-        const uint32_t psIdx = frameBase + passIndex;
+    const bool pipelineStats = SamplesPipelineStats(passIndex);
+    if (frameIndex < m_pipelineStatsRecorded.size()) {
+        m_pipelineStatsRecorded[frameIndex][passIndex] = pipelineStats ? 1 : 0;
+    }
+    if (pipelineStats) {
+        const uint32_t psIdx = psFrameBase + passIndex;
         cmd.ResetQueries(m_pipelineStatsPool->GetHandle(), psIdx, 1);
         cmd.BeginQuery(m_pipelineStatsPool->GetHandle(), psIdx);
     }
-    m_recordedQueries[queueKind][frameIndex].push_back(tsIdx);
+    FrameEntry(queueData->recordedQueries, frameIndex).push_back(tsIdx);
 }
 
 void StatisticsManager::EndQuery(
@@ -343,12 +496,13 @@ void StatisticsManager::EndQuery(
 {
     if (!m_collectPassStatistics) return;
     if (!m_timestampPool || passIndex >= m_numPasses || passIndex >= m_queryPoolPassCapacity) return;
+    if (!IsPassSampled(passIndex)) return;
 
-    auto queueKind = queue.GetKind();
-    auto tsIt = m_timestampBuffers.find(queueKind);
-    if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer) return;
 
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
 
     // Timestamp "end" marker = write a timestamp at index 2*N + 1
     const uint32_t tsIdx = (frameBase + passIndex) * 2u + 1u;
@@ -356,11 +510,11 @@ void StatisticsManager::EndQuery(
     cmd.WriteTimestamp(m_timestampPool->GetHandle(), tsIdx, rhi::Stage::Bottom); // RHI: EndQuery on a Timestamp pool writes a timestamp
 
     // End pipeline stats for geometry passes
-    if (m_collectPipelineStatistics && m_isGeometryPass[passIndex]) {
-        const uint32_t psIdx = frameBase + passIndex;
+    if (PipelineStatsRecorded(frameIndex, passIndex)) {
+        const uint32_t psIdx = psFrameBase + passIndex;
         cmd.EndQuery(m_pipelineStatsPool->GetHandle(), psIdx);
     }
-    m_recordedQueries[queueKind][frameIndex].push_back(tsIdx);
+    FrameEntry(queueData->recordedQueries, frameIndex).push_back(tsIdx);
 }
 
 void StatisticsManager::ResolveQueries(
@@ -370,13 +524,10 @@ void StatisticsManager::ResolveQueries(
 {
     if (!m_timestampPool || m_timestampQueryInfo.elementSize == 0) return;
 
-    auto queueKind = queue.GetKind();
-    auto tsIt = m_timestampBuffers.find(queueKind);
-    if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
-    auto psIt = m_meshStatsBuffers.find(queueKind);
-    if (psIt == m_meshStatsBuffers.end() || !psIt->second) return;
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer || !queueData->meshStatsBuffer) return;
 
-    auto& rec = m_recordedQueries[queueKind][frameIndex];
+    auto& rec = FrameEntry(queueData->recordedQueries, frameIndex);
     if (rec.empty()) return;
 
     // Collapse timestamp indices into contiguous ranges
@@ -395,12 +546,14 @@ void StatisticsManager::ResolveQueries(
     }
     ranges.emplace_back(start, prev - start + 1);
 
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
     const uint64_t tsStride = m_timestampQueryInfo.elementSize; // usually 8
     const uint64_t psStride = m_pipelineStatsQueryInfo.elementSize; // backend-dependent
 
-    auto& tsBuf = tsIt->second;   // rhi::ResourcePtr
-    auto& psBuf = psIt->second;   // rhi::ResourcePtr
+    auto& tsBuf = queueData->timestampBuffer;
+    auto& psBuf = queueData->meshStatsBuffer;
+    auto& pendingResolves = FrameEntry(queueData->pendingResolves, frameIndex);
 
     // Resolve timestamp data and remember what to read on frame complete
     for (auto& r : ranges) {
@@ -412,9 +565,7 @@ void StatisticsManager::ResolveQueries(
             tsStride * uint64_t(r.first)
         );
 
-        m_pendingResolves[queueKind][frameIndex].push_back(r);
-
-        if (!m_collectPipelineStatistics) continue;
+        pendingResolves.push_back(r);
 
         // For each stamped pass in this range, resolve pipeline stats if it's a geometry pass
         for (uint32_t idx = r.first; idx < r.first + r.second; idx += 2) {
@@ -426,9 +577,9 @@ void StatisticsManager::ResolveQueries(
             if (pi >= m_numPasses) {
                 continue;
             }
-            if (!m_isGeometryPass[pi]) continue;
+            if (!PipelineStatsRecorded(frameIndex, pi)) continue;
 
-            const uint32_t psIdx = frameBase + pi;
+            const uint32_t psIdx = psFrameBase + pi;
 
             cmd.ResolveQueryData(
                 m_pipelineStatsPool->GetHandle(),
@@ -451,18 +602,23 @@ void StatisticsManager::BeginQuery(
 {
     if (!m_collectPassStatistics) return;
     if (!m_timestampPool || passIndex >= m_numPasses || passIndex >= m_queryPoolPassCapacity) return;
+    if (!IsPassSampled(passIndex)) return;
 
-    auto queueKind = queue.GetKind();
-    auto tsIt = m_timestampBuffers.find(queueKind);
-    if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer) return;
 
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
     const uint32_t tsIdx = (frameBase + passIndex) * 2u;
     cmd.ResetQueries(m_timestampPool->GetHandle(), tsIdx, 1);
     cmd.WriteTimestamp(m_timestampPool->GetHandle(), tsIdx, rhi::Stage::Top);
 
-    if (m_collectPipelineStatistics && m_isGeometryPass[passIndex]) {
-        const uint32_t psIdx = frameBase + passIndex;
+    const bool pipelineStats = SamplesPipelineStats(passIndex);
+    if (frameIndex < m_pipelineStatsRecorded.size()) {
+        m_pipelineStatsRecorded[frameIndex][passIndex] = pipelineStats ? 1 : 0;
+    }
+    if (pipelineStats) {
+        const uint32_t psIdx = psFrameBase + passIndex;
         cmd.ResetQueries(m_pipelineStatsPool->GetHandle(), psIdx, 1);
         cmd.BeginQuery(m_pipelineStatsPool->GetHandle(), psIdx);
     }
@@ -478,18 +634,19 @@ void StatisticsManager::EndQuery(
 {
     if (!m_collectPassStatistics) return;
     if (!m_timestampPool || passIndex >= m_numPasses || passIndex >= m_queryPoolPassCapacity) return;
+    if (!IsPassSampled(passIndex)) return;
 
-    auto queueKind = queue.GetKind();
-    auto tsIt = m_timestampBuffers.find(queueKind);
-    if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer) return;
 
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
     const uint32_t tsIdx = (frameBase + passIndex) * 2u + 1u;
     cmd.ResetQueries(m_timestampPool->GetHandle(), tsIdx, 1);
     cmd.WriteTimestamp(m_timestampPool->GetHandle(), tsIdx, rhi::Stage::Bottom);
 
-    if (m_collectPipelineStatistics && m_isGeometryPass[passIndex]) {
-        const uint32_t psIdx = frameBase + passIndex;
+    if (PipelineStatsRecorded(frameIndex, passIndex)) {
+        const uint32_t psIdx = psFrameBase + passIndex;
         cmd.EndQuery(m_pipelineStatsPool->GetHandle(), psIdx);
     }
     ctx.recordedIndices.push_back(tsIdx);
@@ -503,11 +660,8 @@ void StatisticsManager::ResolveQueries(
 {
     if (!m_timestampPool || m_timestampQueryInfo.elementSize == 0) return;
 
-    auto queueKind = queue.GetKind();
-    auto tsIt = m_timestampBuffers.find(queueKind);
-    if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
-    auto psIt = m_meshStatsBuffers.find(queueKind);
-    if (psIt == m_meshStatsBuffers.end() || !psIt->second) return;
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer || !queueData->meshStatsBuffer) return;
 
     auto& rec = ctx.recordedIndices;
     if (rec.empty()) return;
@@ -526,12 +680,13 @@ void StatisticsManager::ResolveQueries(
     }
     ranges.emplace_back(start, prev - start + 1);
 
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
     const uint64_t tsStride = m_timestampQueryInfo.elementSize;
     const uint64_t psStride = m_pipelineStatsQueryInfo.elementSize;
 
-    auto& tsBuf = tsIt->second;
-    auto& psBuf = psIt->second;
+    auto& tsBuf = queueData->timestampBuffer;
+    auto& psBuf = queueData->meshStatsBuffer;
 
     for (auto& r : ranges) {
         cmd.ResolveQueryData(
@@ -543,16 +698,14 @@ void StatisticsManager::ResolveQueries(
 
         ctx.pendingRanges.push_back(r);
 
-        if (!m_collectPipelineStatistics) continue;
-
         for (uint32_t idx = r.first; idx < r.first + r.second; idx += 2) {
             const uint32_t encoded = idx / 2;
             if (encoded < frameBase) continue;
             const uint32_t pi = encoded - frameBase;
             if (pi >= m_numPasses) continue;
-            if (!m_isGeometryPass[pi]) continue;
+            if (!PipelineStatsRecorded(frameIndex, pi)) continue;
 
-            const uint32_t psIdx = frameBase + pi;
+            const uint32_t psIdx = psFrameBase + pi;
             cmd.ResolveQueryData(
                 m_pipelineStatsPool->GetHandle(),
                 psIdx, 1,
@@ -570,15 +723,124 @@ void StatisticsManager::MergePendingResolves(
     unsigned frameIndex,
     QueryRecordingContext& ctx)
 {
-    auto& dest = m_pendingResolves[queueKind][frameIndex];
+    auto* queueData = FindQueue(queueKind);
+    if (!queueData) {
+        ctx.pendingRanges.clear();
+        return;
+    }
+    auto& dest = FrameEntry(queueData->pendingResolves, frameIndex);
     dest.insert(dest.end(), ctx.pendingRanges.begin(), ctx.pendingRanges.end());
     ctx.pendingRanges.clear();
 }
 
+bool StatisticsManager::WriteBatchTimestamp(
+    unsigned batchIndex,
+    unsigned queueSlot,
+    unsigned frameIndex,
+    rhi::Queue& queue,
+    rhi::CommandList& cmd,
+    uint32_t which,
+    uint32_t& outIndex)
+{
+    if (!m_collectPassStatistics) return false;
+    if (!m_timestampPool || batchIndex >= rg::runtime::kStatisticsMaxBatches || queueSlot >= rg::runtime::kStatisticsMaxQueueSlots) return false;
+
+    auto* queueData = FindQueue(queue.GetKind());
+    if (!queueData || !queueData->timestampBuffer) return false;
+
+    const uint32_t entry = m_queryPoolPassCapacity + rg::runtime::BatchQueueStatsIndex(batchIndex, queueSlot);
+    outIndex = (TimestampFrameBase(frameIndex) + entry) * 2u + which;
+    cmd.ResetQueries(m_timestampPool->GetHandle(), outIndex, 1);
+    cmd.WriteTimestamp(m_timestampPool->GetHandle(), outIndex, which == 0 ? rhi::Stage::Top : rhi::Stage::Bottom);
+    return true;
+}
+
+void StatisticsManager::BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmd) {
+    uint32_t tsIdx = 0;
+    if (WriteBatchTimestamp(batchIndex, queueSlot, frameIndex, queue, cmd, 0, tsIdx)) {
+        FrameEntry(m_queues[static_cast<size_t>(queue.GetKind())].recordedQueries, frameIndex).push_back(tsIdx);
+    }
+}
+
+void StatisticsManager::EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmd) {
+    uint32_t tsIdx = 0;
+    if (WriteBatchTimestamp(batchIndex, queueSlot, frameIndex, queue, cmd, 1, tsIdx)) {
+        FrameEntry(m_queues[static_cast<size_t>(queue.GetKind())].recordedQueries, frameIndex).push_back(tsIdx);
+    }
+}
+
+void StatisticsManager::BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmd, QueryRecordingContext& ctx) {
+    uint32_t tsIdx = 0;
+    if (WriteBatchTimestamp(batchIndex, queueSlot, frameIndex, queue, cmd, 0, tsIdx)) {
+        ctx.recordedIndices.push_back(tsIdx);
+    }
+}
+
+void StatisticsManager::EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmd, QueryRecordingContext& ctx) {
+    uint32_t tsIdx = 0;
+    if (WriteBatchTimestamp(batchIndex, queueSlot, frameIndex, queue, cmd, 1, tsIdx)) {
+        ctx.recordedIndices.push_back(tsIdx);
+    }
+}
+
+void StatisticsManager::SetBatchQueueSync(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, std::span<const rg::runtime::BatchQueueWait> waits, uint64_t signalValue) {
+    if (frameIndex >= m_batchSync.size()
+        || batchIndex >= rg::runtime::kStatisticsMaxBatches || queueSlot >= rg::runtime::kStatisticsMaxQueueSlots) {
+        return;
+    }
+    auto& sync = m_batchSync[frameIndex][rg::runtime::BatchQueueStatsIndex(batchIndex, queueSlot)];
+    sync.waitCount = static_cast<uint32_t>(std::min(waits.size(), sync.waits.size()));
+    std::copy_n(waits.begin(), sync.waitCount, sync.waits.begin());
+    sync.signalValue = signalValue;
+}
+
+void StatisticsManager::ExportGpuTimelineEntry(rhi::QueueKind queueKind, unsigned frameIndex, uint32_t entry, uint64_t t0, uint64_t t1, bool toTracy, bool toFrameTrace) {
+    auto& frameTrace = FrameTraceWriter::GetInstance();
+    auto addZone = [&](std::string name, uint64_t begin, uint64_t end) {
+        if (toFrameTrace) {
+            frameTrace.GpuSpan(queueKind, toTracy ? name : std::move(name), begin, end, m_gpuTimestampFreq);
+        }
+        if (toTracy) {
+            m_tracyGpuTimeline.AddZone(std::move(name), begin, end);
+        }
+    };
+    auto addMarker = [&](std::string name, uint64_t ticks) {
+        if (toFrameTrace) {
+            frameTrace.GpuInstant(queueKind, toTracy ? name : std::move(name), ticks, m_gpuTimestampFreq);
+        }
+        if (toTracy) {
+            m_tracyGpuTimeline.AddMarker(std::move(name), ticks);
+        }
+    };
+
+    if (entry < m_queryPoolPassCapacity) {
+        if (entry < m_numPasses) {
+            addZone(m_passNames[entry].empty() ? "Pass " + std::to_string(entry) : m_passNames[entry], t0, t1);
+        }
+        return;
+    }
+
+    const uint32_t batchEntry = entry - m_queryPoolPassCapacity;
+    const uint32_t batchIndex = batchEntry / rg::runtime::kStatisticsMaxQueueSlots;
+    const uint32_t queueSlot = batchEntry % rg::runtime::kStatisticsMaxQueueSlots;
+    addZone("Batch " + std::to_string(batchIndex) + " (slot " + std::to_string(queueSlot) + ")", t0, t1);
+    if (frameIndex >= m_batchSync.size() || batchEntry >= m_batchSync[frameIndex].size()) {
+        return;
+    }
+    const auto& sync = m_batchSync[frameIndex][batchEntry];
+    for (uint32_t i = 0; i < sync.waitCount; ++i) {
+        addMarker("Wait slot " + std::to_string(sync.waits[i].srcQueueSlot) + " >= " + std::to_string(sync.waits[i].fenceValue), t0);
+    }
+    if (sync.signalValue != 0) {
+        addMarker("Signal " + std::to_string(sync.signalValue), t1);
+    }
+}
+
 void StatisticsManager::OnFrameComplete(
     unsigned frameIndex,
     rhi::Queue& queue)
 {
+    MergeCpuTimings();
 	if (!m_timestampPool || m_timestampQueryInfo.elementSize == 0) return;
 
     if (m_getCollectPassStatistics) {
@@ -589,20 +851,20 @@ void StatisticsManager::OnFrameComplete(
         m_collectPipelineStatistics = m_getCollectPipelineStatistics();
     }
 	auto queueKind = queue.GetKind();
-	auto tsIt = m_timestampBuffers.find(queueKind);
-	auto psIt = m_meshStatsBuffers.find(queueKind);
-	if (tsIt == m_timestampBuffers.end() || !tsIt->second) return;
-	if (psIt == m_meshStatsBuffers.end() || !psIt->second) return;
-
-    auto& tsBuf = tsIt->second;
-    auto& psBuf = psIt->second;
-    auto& pending = m_pendingResolves[queueKind][frameIndex];
+	auto* queueData = FindQueue(queueKind);
+	if (!queueData || !queueData->timestampMapped || !queueData->meshStatsMapped) return;
+
+    const uint8_t* tsMapped = queueData->timestampMapped;
+    const uint8_t* psMapped = queueData->meshStatsMapped;
+    auto& pending = FrameEntry(queueData->pendingResolves, frameIndex);
     if (pending.empty()) return;
 
     const uint64_t tsStride = m_timestampQueryInfo.elementSize; // usually 8
     const uint64_t psStride = m_pipelineStatsQueryInfo.elementSize; // backend-specific
-    const uint32_t frameBase = frameIndex * m_queryPoolPassCapacity;
+    const uint32_t frameBase = TimestampFrameBase(frameIndex);
+    const uint32_t psFrameBase = frameIndex * m_queryPoolPassCapacity;
     const double   toMs = 1000.0 / double(m_gpuTimestampFreq);
+    const bool     exportFrameTrace = FrameTraceWriter::GetInstance().IsCapturing();
 
     auto readU64At = [](const uint8_t* base, uint64_t byteOffset) -> uint64_t {
         uint64_t v = 0;
@@ -623,22 +885,8 @@ void StatisticsManager::OnFrameComplete(
             continue;
         }
 
-        // Map just the timestamp byte range we resolved this frame
-        const uint64_t tsMapOffset = tsStride * uint64_t(r.first);
-        const uint64_t tsMapSize = tsStride * uint64_t(r.second);
-
-        void* tsPtrVoid = nullptr;
-        tsBuf->Map(&tsPtrVoid, tsMapOffset, tsMapSize);
-        if (tsPtrVoid == nullptr) {
-            spdlog::warn(
-                "StatisticsManager::OnFrameComplete: timestamp readback Map returned null queue={} frameIndex={} firstQuery={} queryCount={}",
-                static_cast<int>(queueKind),
-                frameIndex,
-                r.first,
-                r.second);
-            continue;
-        }
-        const uint8_t* tsBase = static_cast<const uint8_t*>(tsPtrVoid);
+        // This frame's region of the ring, resolved numFramesInFlight frames ago
+        const uint8_t* tsBase = tsMapped + tsStride * uint64_t(r.first);
 
         for (uint32_t idx = r.first; idx < r.first + r.second; idx += 2) {
             const uint32_t local0 = (idx - r.first);
@@ -664,6 +912,17 @@ void StatisticsManager::OnFrameComplete(
                 continue;
             }
             const uint32_t pi = encoded - frameBase;
+            if (m_exportTracyGpuZones || exportFrameTrace) {
+                ExportGpuTimelineEntry(queueKind, frameIndex, pi, t0, t1, m_exportTracyGpuZones, exportFrameTrace);
+            }
+            if (pi >= m_queryPoolPassCapacity) {
+                const uint32_t batchEntry = pi - m_queryPoolPassCapacity;
+                if (batchEntry < m_batchStats.size()) {
+                    UpdateEma(m_batchStats[batchEntry].gpuTimeEma, ms);
+                    m_batchStats[batchEntry].lastSampleFrame = m_frameSerial;
+                }
+                continue;
+            }
             if (pi >= m_numPasses) {
                 continue;
             }
@@ -673,24 +932,11 @@ void StatisticsManager::OnFrameComplete(
                 m_passLastExecutionFrame[pi] = m_frameSerial;
             }
 
-            if (!m_collectPipelineStatistics || !m_isGeometryPass[pi]) continue;
-
-            // Map just this pass's pipeline stat element
-            const uint32_t psIdx = frameBase + pi;
-            const uint64_t psOffset = psStride * uint64_t(psIdx);
-            void* psPtrVoid = nullptr;
-            psBuf->Map(&psPtrVoid, psOffset, psStride);
-            if (psPtrVoid == nullptr) {
-                spdlog::warn(
-                    "StatisticsManager::OnFrameComplete: pipeline-stat readback Map returned null queue={} frameIndex={} passIndex={} queryIndex={}",
-                    static_cast<int>(queueKind),
-                    frameIndex,
-                    pi,
-                    psIdx);
-                continue;
-            }
+            if (!PipelineStatsRecorded(frameIndex, pi)) continue;
+            m_pipelineStatsRecorded[frameIndex][pi] = 0;
 
-            const uint8_t* psBase = static_cast<const uint8_t*>(psPtrVoid);
+            const uint32_t psIdx = psFrameBase + pi;
+            const uint8_t* psBase = psMapped + psStride * uint64_t(psIdx);
 
             uint64_t inv = 0, prim = 0;
             uint32_t offInv = 0, offPrim = 0;
@@ -700,41 +946,51 @@ void StatisticsManager::OnFrameComplete(
             if (findFieldOffset(rhi::PipelineStatTypes::MeshPrimitives, offPrim))
                 prim = readU64At(psBase, offPrim);
 
-            psBuf->Unmap(0, 0);
-
             auto& mps = m_meshStatsEma[pi];
             UpdateEma(mps.invocationsEma, double(inv));
             UpdateEma(mps.primitivesEma, double(prim));
         }
-
-        tsBuf->Unmap(0, 0);
     }
 
+    if (m_exportTracyGpuZones) {
+        m_tracyGpuTimeline.Submit(queueKind);
+    }
     pending.clear();
-    m_pendingResolves[queueKind].erase(frameIndex);
 }
 
 
 void StatisticsManager::ClearAll() {
     m_timestampPool.Reset();
     m_pipelineStatsPool.Reset();
-    for (auto& kv:m_timestampBuffers) kv.second.Reset();
-    for (auto& kv:m_meshStatsBuffers) kv.second.Reset();
-    m_timestampBuffers.clear();
-    m_meshStatsBuffers.clear();
+    for (auto& queueData : m_queues) {
+        ReleaseQueueBuffers(queueData);
+    }
+    m_queues = {};
     m_passNames.clear();
     m_passTechniquePaths.clear();
     m_stats.clear();
     m_isGeometryPass.clear();
     m_meshStatsEma.clear();
-    m_passNameToIndex.clear();
+    m_batchStats.assign(kBatchQueryEntries, {});
+    for (auto& frameSync : m_batchSync) {
+        frameSync.assign(frameSync.size(), {});
+    }
+    m_tracyGpuTimeline.Reset();
+    m_sampleWindowBegin = 0;
+    m_pipelineStatsCursor = 0;
+    m_pipelineStatsSampled.clear();
+    m_pipelineStatsRecorded.clear();
     m_passLastExecutionFrame.clear();
     m_visiblePassIndices.clear();
-    m_recordedQueries.clear();
-    m_pendingResolves.clear();
+    {
+        std::scoped_lock lock(m_cpuAccumulatorRegistryMutex);
+        for (auto& accumulator : m_cpuAccumulators) {
+            accumulator->samples.clear();
+            accumulator->dirty = false;
+        }
+    }
     m_numPasses=0;
     m_queryPoolPassCapacity = 0;
-    m_unnamedPassCounter = 0;
     m_frameSerial = 0;
     m_collectPassStatistics = true;
     m_getCollectPassStatistics = {};
@@ -0,0 +1,178 @@
+#include "Managers/Singletons/TextureRecyclePool.h"
+
+#include <tracy/Tracy.hpp>
+
+#include "Managers/Singletons/DeletionManager.h"
+#include "Render/Runtime/OpenRenderGraphSettings.h"
+#include "Resources/GPUBacking/GPUTextureBacking.h"
+#include "Utilities/ORGUtilities.h"
+
+namespace {
+// Only the fields that shape the API resource: view formats and pitches are rebuilt or read per
+// PixelBuffer, so backings that differ only in those are interchangeable.
+uint64_t HashTextureShape(const TextureDescription& desc) {
+	uint64_t hash = 0x7e47c1ec9c1e0001ull;
+	if (!desc.imageDimensions.empty()) {
+		hash = rg::util::HashMix64(hash, desc.imageDimensions[0].width);
+		hash = rg::util::HashMix64(hash, desc.imageDimensions[0].height);
+	}
+	hash = rg::util::HashMix64(hash, desc.imageDimensions.size());
+	hash = rg::util::HashMix64(hash, static_cast<uint64_t>(desc.format));
+	hash = rg::util::HashMix64(hash, desc.arraySize);
+	hash = rg::util::HashMix64(hash,
+		(desc.isCubemap ? 1ull : 0ull)
+		| (desc.isArray ? 2ull : 0ull)
+		| (desc.hasRTV ? 4ull : 0ull)
+		| (desc.hasDSV ? 8ull : 0ull)
+		| (desc.hasUAV ? 16ull : 0ull)
+		| (desc.generateMipMaps ? 32ull : 0ull)
+		| (desc.padInternalResolution ? 64ull : 0ull));
+	hash = rg::util::HashMix64(hash, static_cast<uint64_t>(desc.initialLayout));
+	return hash;
+}
+
+bool SameTextureShape(const TextureDescription& a, const TextureDescription& b) {
+	const bool sameBaseDimensions = a.imageDimensions.empty() || b.imageDimensions.empty()
+		? a.imageDimensions.empty() == b.imageDimensions.empty()
+		: a.imageDimensions[0].width == b.imageDimensions[0].width && a.imageDimensions[0].height == b.imageDimensions[0].height;
+	return sameBaseDimensions
+		&& a.imageDimensions.size() == b.imageDimensions.size()
+		&& a.channels == b.channels
+		&& a.format == b.format
+		&& a.isCubemap == b.isCubemap
+		&& a.isArray == b.isArray
+		&& a.arraySize == b.arraySize
+		&& a.hasRTV == b.hasRTV
+		&& a.rtvFormat == b.rtvFormat
+		&& a.hasDSV == b.hasDSV
+		&& a.dsvFormat == b.dsvFormat
+		&& a.hasUAV == b.hasUAV
+		&& a.generateMipMaps == b.generateMipMaps
+		&& a.padInternalResolution == b.padInternalResolution
+		&& a.initialLayout == b.initialLayout
+		&& a.depthClearValue == b.depthClearValue
+		&& a.clearColor[0] == b.clearColor[0]
+		&& a.clearColor[1] == b.clearColor[1]
+		&& a.clearColor[2] == b.clearColor[2]
+		&& a.clearColor[3] == b.clearColor[3];
+}
+}
+
+TextureRecyclePool& TextureRecyclePool::GetInstance() {
+	static TextureRecyclePool instance;
+	return instance;
+}
+
+void TextureRecyclePool::Retire(std::unique_ptr<GpuTextureBacking> backing) {
+	if (!backing) {
+		return;
+	}
+	const uint64_t maxBytes = rg::runtime::GetOpenRenderGraphSettings().textureRecyclePoolMaxBytes;
+	const uint64_t sizeBytes = backing->GetAllocationSizeBytes();
+	// Without a running DeletionManager the runtime is shutting down, and nothing would reuse it.
+	if (maxBytes == 0 || sizeBytes > maxBytes || !DeletionManager::GetInstance().IsInitialized() || !backing->HasValidResource()) {
+		return;
+	}
+
+	backing->SetName("RenderGraph texture recycle pool");
+	std::scoped_lock lock(m_mutex);
+	while (m_stats.pooledBytes + sizeBytes > maxBytes && m_stats.pooledBackings > 0) {
+		EvictOldestLocked();
+	}
+	const uint64_t shape = HashTextureShape(backing->GetDescription());
+	m_entriesByShape[shape].push_back(Entry{
+		.backing = std::move(backing),
+		.retiredFrame = m_frame,
+		.sizeBytes = sizeBytes,
+	});
+	m_stats.pooledBytes += sizeBytes;
+	++m_stats.pooledBackings;
+}
+
+std::unique_ptr<GpuTextureBacking> TextureRecyclePool::Acquire(const TextureDescription& desc) {
+	std::scoped_lock lock(m_mutex);
+	if (m_stats.pooledBackings == 0) {
+		return nullptr;
+	}
+
+	const uint64_t safeFrames = uint64_t(rg::runtime::GetOpenRenderGraphSettings().numFramesInFlight) + 1u;
+	auto itShape = m_entriesByShape.find(HashTextureShape(desc));
+	if (itShape != m_entriesByShape.end()) {
+		auto& entries = itShape->second;
+		for (auto it = entries.begin(); it != entries.end(); ++it) {
+			if (m_frame - it->retiredFrame < safeFrames) {
+				break; // Entries are in retirement order, so the rest are younger.
+			}
+			if (!SameTextureShape(it->backing->GetDescription(), desc)) {
+				continue;
+			}
+			auto backing = std::move(it->backing);
+			m_stats.pooledBytes -= it->sizeBytes;
+			--m_stats.pooledBackings;
+			++m_stats.hits;
+			entries.erase(it);
+			if (entries.empty()) {
+				m_entriesByShape.erase(itShape);
+			}
+			return backing;
+		}
+	}
+	++m_stats.misses;
+	return nullptr;
+}
+
+void TextureRecyclePool::ProcessFrame() {
+	std::scoped_lock lock(m_mutex);
+	++m_frame;
+	if (m_stats.pooledBackings == 0) {
+		return;
+	}
+
+	const auto& settings = rg::runtime::GetOpenRenderGraphSettings();
+	const uint64_t maxAgeFrames = uint64_t(settings.numFramesInFlight) + 1u + settings.textureRecyclePoolMaxIdleFrames;
+	for (auto itShape = m_entriesByShape.begin(); itShape != m_entriesByShape.end(); ) {
+		auto& entries = itShape->second;
+		while (!entries.empty() && m_frame - entries.front().retiredFrame > maxAgeFrames) {
+			m_stats.pooledBytes -= entries.front().sizeBytes;
+			--m_stats.pooledBackings;
+			++m_stats.evictions;
+			entries.pop_front();
+		}
+		itShape = entries.empty() ? m_entriesByShape.erase(itShape) : std::next(itShape);
+	}
+	while (m_stats.pooledBytes > settings.textureRecyclePoolMaxBytes && m_stats.pooledBackings > 0) {
+		EvictOldestLocked();
+	}
+	TracyPlot("RG.TextureRecyclePool.Bytes", static_cast<int64_t>(m_stats.pooledBytes));
+}
+
+void TextureRecyclePool::EvictOldestLocked() {
+	auto oldest = m_entriesByShape.end();
+	for (auto it = m_entriesByShape.begin(); it != m_entriesByShape.end(); ++it) {
+		if (oldest == m_entriesByShape.end() || it->second.front().retiredFrame < oldest->second.front().retiredFrame) {
+			oldest = it;
+		}
+	}
+	if (oldest == m_entriesByShape.end()) {
+		return;
+	}
+	m_stats.pooledBytes -= oldest->second.front().sizeBytes;
+	--m_stats.pooledBackings;
+	++m_stats.evictions;
+	oldest->second.pop_front();
+	if (oldest->second.empty()) {
+		m_entriesByShape.erase(oldest);
+	}
+}
+
+void TextureRecyclePool::Clear() {
+	std::scoped_lock lock(m_mutex);
+	m_entriesByShape.clear();
+	m_stats.pooledBytes = 0;
+	m_stats.pooledBackings = 0;
+}
+
+TextureRecyclePool::Stats TextureRecyclePool::GetStats() const {
+	std::scoped_lock lock(m_mutex);
+	return m_stats;
+}
@@ -1,13 +1,21 @@
 #include "Managers/Singletons/UploadManager.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstring>
+#include <iterator>
+#include <numeric>
 #include <sstream>
+#include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
 
 #include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
 
 #include "Render/PassBuilders.h"
 #include "Render/Runtime/OpenRenderGraphSettings.h"
+#include "Managers/Singletons/FrameTraceWriter.h"
 
 namespace {
 	RangeSpec SingleSubresourceRange(uint32_t mip, uint32_t slice) noexcept
@@ -31,11 +39,18 @@ void UploadManager::Initialize() {
 	config.debugName = "UploadManager";
 	config.pageNamePrefix = "UploadManagerPage";
 	config.usageHint = "Upload buffer";
+	config.parallelCopyThresholdBytes = static_cast<size_t>(rg::runtime::GetOpenRenderGraphSettings().uploadParallelCopyThresholdBytes);
+	{
+		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		m_resourceCopyQueueMinBytes = rg::runtime::GetOpenRenderGraphSettings().resourceCopyQueueMinBytes;
+	}
+	m_captureNamesOnQueue = rg::runtime::GetOpenRenderGraphSettings().uploadTelemetryLevel == rg::runtime::UploadTelemetryLevel::Full;
+	config.captureTargetNamesOnQueue = m_captureNamesOnQueue;
 	m_uploadInstance = std::make_unique<UploadInstance>(std::move(config));
 	m_uploadInstance->SetPendingWorkChangedCallback([this] {
 		MarkUploadPassDirty();
 	});
-	m_uploadInstance->SetTargetTelemetryCallback([this](const UploadTarget& target, uint64_t& outId, std::string& outName) {
+	m_uploadInstance->SetTargetTelemetryCallback([this](const UploadTarget& target, uint64_t& outId, const std::string** outName) {
 		CaptureUploadTargetTelemetry(target, outId, outName);
 	});
 	m_uploadInstance->SetInvalidRegistryHandleCallback(
@@ -43,14 +58,22 @@ void UploadManager::Initialize() {
 			return IsUploadTargetValid(target, reason, file, line);
 		});
 	m_uploadInstance->SetResolveContext(m_ctx);
+	m_uploadInstance->SetTaskService(m_taskService);
 	MarkUploadPassDirty();
 }
 
+void UploadManager::SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService) {
+	m_taskService = std::move(taskService);
+	if (m_uploadInstance) {
+		m_uploadInstance->SetTaskService(m_taskService);
+	}
+}
+
 void UploadManager::SetUploadResolveContext(UploadResolveContext ctx) {
 	{
 		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 		m_ctx = ctx;
-		RefreshQueuedCopyTelemetryLocked();
+		RefreshQueuedCopyTelemetryLocked(m_captureNamesOnQueue);
 	}
 	if (m_uploadInstance) {
 		m_uploadInstance->SetResolveContext(ctx);
@@ -65,37 +88,62 @@ void UploadManager::MarkUploadPassDirty()
 	}
 }
 
-void UploadManager::CaptureResourceCopyTelemetry(ResourceCopy& copy)
+void UploadManager::MarkResourceCopyPassDirty()
+{
+	if (m_resourceCopyPass) {
+		m_resourceCopyPass->MarkDeclaredResourcesDirty();
+	}
+}
+
+std::shared_ptr<CopyPass> UploadManager::GetResourceCopyPass()
+{
+	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+	if (m_resourceCopyQueueMinBytes == 0) {
+		return nullptr;
+	}
+	if (!m_resourceCopyPass) {
+		m_resourceCopyPass = std::make_shared<ResourceCopyPass>();
+	}
+	return m_resourceCopyPass;
+}
+
+void UploadManager::CaptureResourceCopyTelemetry(ResourceCopy& copy, bool withNames)
 {
 	copy.sourceGlobalResourceId = copy.source ? copy.source->GetGlobalResourceID() : 0;
 	copy.destinationGlobalResourceId = copy.destination ? copy.destination->GetGlobalResourceID() : 0;
-	copy.sourceDebugName = copy.source ? copy.source->GetName() : std::string{};
-	copy.destinationDebugName = copy.destination ? copy.destination->GetName() : std::string{};
+	if (withNames) {
+		copy.sourceDebugName = copy.source ? UploadInstance::InternDebugName(copy.source->GetName()) : nullptr;
+		copy.destinationDebugName = copy.destination ? UploadInstance::InternDebugName(copy.destination->GetName()) : nullptr;
+	}
 }
 
-void UploadManager::RefreshQueuedCopyTelemetryLocked()
+void UploadManager::RefreshQueuedCopyTelemetryLocked(bool withNames)
 {
 	for (auto& copy : queuedResourceCopies) {
-		CaptureResourceCopyTelemetry(copy);
+		CaptureResourceCopyTelemetry(copy, withNames);
+	}
+	for (auto& copy : m_copyQueueResourceCopies) {
+		CaptureResourceCopyTelemetry(copy, withNames);
 	}
 }
 
-void UploadManager::CaptureUploadTargetTelemetry(const UploadTarget& target, uint64_t& outId, std::string& outName)
+void UploadManager::CaptureUploadTargetTelemetry(const UploadTarget& target, uint64_t& outId, const std::string** outName)
 {
 	outId = 0;
-	outName.clear();
 	switch (target.kind) {
 	case UploadTarget::Kind::PinnedShared:
 		if (target.pinned) {
 			outId = target.pinned->GetGlobalResourceID();
-			outName = target.pinned->GetName();
+			if (outName) {
+				*outName = UploadInstance::InternDebugName(target.pinned->GetName());
+			}
 		}
 		break;
 	case UploadTarget::Kind::RegistryHandle:
 		outId = target.h.GetGlobalResourceID();
-		if (m_ctx.registry) {
+		if (outName && m_ctx.registry) {
 			if (auto* resource = m_ctx.registry->Resolve(target.h)) {
-				outName = resource->GetName();
+				*outName = UploadInstance::InternDebugName(resource->GetName());
 			}
 		}
 		break;
@@ -141,6 +189,29 @@ void UploadManager::UploadData(const void* data, size_t size, UploadTarget resou
 #endif
 }
 
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+UploadManager::UploadReservation UploadManager::ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size, const char* file, int line)
+#else
+UploadManager::UploadReservation UploadManager::ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size)
+#endif
+{
+	if (!m_uploadInstance) {
+		Initialize();
+	}
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+	return m_uploadInstance->ReserveUpload(std::move(resourceToUpdate), dataBufferOffset, size, file, line);
+#else
+	return m_uploadInstance->ReserveUpload(std::move(resourceToUpdate), dataBufferOffset, size);
+#endif
+}
+
+void UploadManager::CommitUpload(UploadReservation&& reservation) {
+	if (!m_uploadInstance) {
+		return;
+	}
+	m_uploadInstance->CommitUpload(std::move(reservation));
+}
+
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
 void UploadManager::UploadTextureSubresources(
 	UploadTarget target,
@@ -212,7 +283,7 @@ void UploadManager::DeclareUploadPassResourceUsages(RenderPassBuilder* builder)
 
 	{
 		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
-		RefreshQueuedCopyTelemetryLocked();
+		RefreshQueuedCopyTelemetryLocked(m_captureNamesOnQueue);
 		for (const auto& copy : queuedResourceCopies) {
 			if (copy.source) {
 				builder->WithCopySource(copy.source);
@@ -257,6 +328,25 @@ void UploadManager::DeclareUploadPassResourceUsages(RenderPassBuilder* builder)
 		});
 }
 
+void UploadManager::DeclareResourceCopyPassResourceUsages(CopyPassBuilder* builder)
+{
+	if (!builder) {
+		return;
+	}
+
+	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+	RefreshQueuedCopyTelemetryLocked(m_captureNamesOnQueue);
+	for (const auto& copy : m_copyQueueResourceCopies) {
+		if (copy.source) {
+			builder->WithCopySource(copy.source);
+		}
+		if (copy.destination) {
+			builder->WithCopyDest(copy.destination);
+		}
+	}
+	builder->PreferQueue(QueueKind::Copy);
+}
+
 std::string UploadManager::DescribeQueuedTargetByGlobalResourceId(uint64_t globalResourceId)
 {
 	if (globalResourceId == 0) {
@@ -274,17 +364,17 @@ std::string UploadManager::DescribeQueuedTargetByGlobalResourceId(uint64_t globa
 	}
 
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
-	RefreshQueuedCopyTelemetryLocked();
+	RefreshQueuedCopyTelemetryLocked(true);
 
-	for (const auto& copy : queuedResourceCopies) {
+	auto describeCopy = [&](const ResourceCopy& copy, const char* queueSuffix) {
 		if (copy.destinationGlobalResourceId == globalResourceId) {
 			if (matchCount++ > 0) {
 				result << " | ";
 			}
 			result
-				<< "resource-copy-dest"
-				<< " name='" << (copy.destinationDebugName.empty() ? std::string("<unknown>") : copy.destinationDebugName) << "'"
-				<< " sourceName='" << (copy.sourceDebugName.empty() ? std::string("<unknown>") : copy.sourceDebugName) << "'"
+				<< "resource-copy-dest" << queueSuffix
+				<< " name='" << (copy.destinationDebugName ? *copy.destinationDebugName : std::string("<unknown>")) << "'"
+				<< " sourceName='" << (copy.sourceDebugName ? *copy.sourceDebugName : std::string("<unknown>")) << "'"
 				<< " bytes=" << copy.size;
 		}
 
@@ -293,11 +383,17 @@ std::string UploadManager::DescribeQueuedTargetByGlobalResourceId(uint64_t globa
 				result << " | ";
 			}
 			result
-				<< "resource-copy-source"
-				<< " name='" << (copy.sourceDebugName.empty() ? std::string("<unknown>") : copy.sourceDebugName) << "'"
-				<< " destinationName='" << (copy.destinationDebugName.empty() ? std::string("<unknown>") : copy.destinationDebugName) << "'"
+				<< "resource-copy-source" << queueSuffix
+				<< " name='" << (copy.sourceDebugName ? *copy.sourceDebugName : std::string("<unknown>")) << "'"
+				<< " destinationName='" << (copy.destinationDebugName ? *copy.destinationDebugName : std::string("<unknown>")) << "'"
 				<< " bytes=" << copy.size;
 		}
+	};
+	for (const auto& copy : queuedResourceCopies) {
+		describeCopy(copy, "");
+	}
+	for (const auto& copy : m_copyQueueResourceCopies) {
+		describeCopy(copy, "(copy-queue)");
 	}
 
 	return result.str();
@@ -315,9 +411,33 @@ void UploadManager::QueueResourceCopy(const std::shared_ptr<Resource>& destinati
 	copy.source = source;
 	copy.destination = destination;
 	copy.size = size;
-	CaptureResourceCopyTelemetry(copy);
-	queuedResourceCopies.push_back(std::move(copy));
-	MarkUploadPassDirty();
+	CaptureResourceCopyTelemetry(copy, m_captureNamesOnQueue);
+
+	// Only the first queued copy into a destination runs, so later copies follow it onto the
+	// same queue rather than being split by size.
+	auto queuedFor = [&](const std::vector<ResourceCopy>& copies) {
+		return std::any_of(copies.begin(), copies.end(), [&](const ResourceCopy& queued) {
+			return queued.destination == destination;
+		});
+	};
+	bool useCopyQueue = false;
+	if (m_resourceCopyPass && m_resourceCopyQueueMinBytes > 0) {
+		if (queuedFor(m_copyQueueResourceCopies)) {
+			useCopyQueue = true;
+		}
+		else if (!queuedFor(queuedResourceCopies)) {
+			useCopyQueue = size >= m_resourceCopyQueueMinBytes;
+		}
+	}
+
+	if (useCopyQueue) {
+		m_copyQueueResourceCopies.push_back(std::move(copy));
+		MarkResourceCopyPassDirty();
+	}
+	else {
+		queuedResourceCopies.push_back(std::move(copy));
+		MarkUploadPassDirty();
+	}
 }
 
 void UploadManager::ExecuteResourceCopies(uint8_t frameIndex, rg::imm::ImmediateCommandList& commandList) {
@@ -331,6 +451,29 @@ void UploadManager::ExecuteResourceCopies(uint8_t frameIndex, rg::imm::Immediate
 		}
 	}
 
+	RecordResourceCopies(resourceCopies, commandList);
+}
+
+void UploadManager::ExecuteCopyQueueResourceCopies(rg::imm::ImmediateCommandList& commandList) {
+	ZoneScopedN("UploadManager::ExecuteCopyQueueResourceCopies");
+	std::vector<ResourceCopy> resourceCopies;
+	{
+		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		resourceCopies.swap(m_copyQueueResourceCopies);
+		if (!resourceCopies.empty()) {
+			MarkResourceCopyPassDirty();
+		}
+	}
+
+	uint64_t bytes = 0;
+	for (const auto& copy : resourceCopies) {
+		bytes += copy.size;
+	}
+	TracyPlot("RG.Upload.CopyQueueResourceCopyBytes", static_cast<int64_t>(bytes));
+	RecordResourceCopies(resourceCopies, commandList);
+}
+
+void UploadManager::RecordResourceCopies(std::vector<ResourceCopy>& resourceCopies, rg::imm::ImmediateCommandList& commandList) {
 	std::unordered_set<Resource*> seenDestinations;
 	for (auto& copy : resourceCopies) {
 		auto* dstPtr = copy.destination.get();
@@ -355,49 +498,528 @@ void UploadManager::Cleanup() {
 	{
 		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 		queuedResourceCopies.clear();
+		m_copyQueueResourceCopies.clear();
 	}
 
+	std::unique_ptr<StreamingFileReader> fileReader;
+	{
+		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		fileReader = std::move(m_streamingFileReader);
+	}
+	fileReader.reset(); // Joins the reader; its completions take m_streamingMutex
 	m_streamingPagePool.Cleanup();
 	{
 		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		for (auto& desc : m_pendingStreamingUploads) {
+			if (desc.ticket) {
+				desc.ticket->state.store(StreamingUploadTicket::State::Failed, std::memory_order_release);
+			}
+		}
 		m_pendingStreamingUploads.clear();
+		m_ticketsAwaitingFence.clear();
+		m_pendingDecompressionJobs.clear();
+		m_streamingDecompressors.clear();
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_mipGenerationMutex);
+		m_pendingMipGenerations.clear();
+		m_mipGenerator.reset();
 	}
 	MarkUploadPassDirty();
+	MarkResourceCopyPassDirty();
 }
 
 void UploadManager::QueueStreamingUpload(
     const void* data, size_t size,
-    std::shared_ptr<Resource> destination, size_t dstOffset)
+    std::shared_ptr<Resource> destination, size_t dstOffset,
+    StreamingUploadPriority priority)
 {
 	if (!data || size == 0 || !destination) return;
 
-	auto uploadBuffer = Buffer::CreateShared(rhi::HeapType::Upload, size, /*uav=*/false);
-	uploadBuffer->SetName("StreamingUploadTemp");
+	auto allocation = m_streamingPagePool.Allocate(size, /*alignment*/16);
 
 	uint8_t* mapped = nullptr;
-	uploadBuffer->GetAPIResource().Map(reinterpret_cast<void**>(&mapped), 0, size);
-	if (mapped) {
-		std::memcpy(mapped, data, size);
-		uploadBuffer->GetAPIResource().Unmap(0, size);
+	allocation.buffer->GetAPIResource().Map(reinterpret_cast<void**>(&mapped), 0, allocation.offset + size);
+	if (!mapped) {
+		spdlog::error("QueueStreamingUpload: failed to map streaming page for {} bytes", size);
+		m_streamingPagePool.MarkSubmitted(allocation.buffer.get()); // Release the allocation
+		return;
 	}
+	std::memcpy(mapped + allocation.offset, data, size);
+	allocation.buffer->GetAPIResource().Unmap(0, allocation.offset + size);
 
 	StreamingUploadDescriptor desc;
-	desc.srcUploadBuffer = std::move(uploadBuffer);
-	desc.srcOffset       = 0;
+	desc.srcUploadBuffer = std::move(allocation.buffer);
+	desc.srcOffset       = allocation.offset;
 	desc.dstResource     = std::move(destination);
 	desc.dstOffset       = dstOffset;
 	desc.size            = size;
+	desc.priority        = priority;
+
+	{
+		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		desc.sequence = m_nextStreamingSequence++;
+		m_pendingStreamingUploads.push_back(std::move(desc));
+	}
+}
+
+void UploadManager::QueueStreamingTextureUpload(
+    std::shared_ptr<Resource> destination,
+    rhi::Format fmt,
+    uint32_t baseWidth,
+    uint32_t baseHeight,
+    uint32_t depthOrLayers,
+    uint32_t mipLevels,
+    uint32_t arraySize,
+    const rhi::helpers::SubresourceData* srcSubresources,
+    uint32_t srcCount,
+    StreamingUploadPriority priority)
+{
+	if (!destination || !srcSubresources || srcCount == 0) return;
+
+	rhi::Span<const rhi::helpers::SubresourceData> srcSpan{ srcSubresources, srcCount };
+	const auto plan = rhi::helpers::PlanTextureUploadSubresources(
+		fmt, baseWidth, baseHeight, depthOrLayers, mipLevels, arraySize, srcSpan);
+	if (plan.totalSize == 0 || plan.footprints.empty()) return;
+
+	const size_t totalSize = static_cast<size_t>(plan.totalSize);
+	auto allocation = m_streamingPagePool.Allocate(
+		totalSize, /*alignment*/512, static_cast<uint32_t>(plan.footprints.size()));
+
+	uint8_t* mapped = nullptr;
+	allocation.buffer->GetAPIResource().Map(reinterpret_cast<void**>(&mapped), 0, allocation.offset + totalSize);
+	if (!mapped) {
+		spdlog::error("QueueStreamingTextureUpload: failed to map streaming page for {} bytes", totalSize);
+		for (size_t i = 0; i < plan.footprints.size(); ++i) {
+			m_streamingPagePool.MarkSubmitted(allocation.buffer.get()); // Release the allocation
+		}
+		return;
+	}
+	rhi::helpers::WriteTextureUploadSubresources(plan, srcSpan, mapped, static_cast<uint64_t>(allocation.offset));
+	allocation.buffer->GetAPIResource().Unmap(0, allocation.offset + totalSize);
+
+	std::vector<StreamingUploadDescriptor> descs;
+	descs.reserve(plan.footprints.size());
+	for (const auto& fp : plan.footprints) {
+		StreamingUploadDescriptor desc;
+		desc.kind            = StreamingUploadDescriptor::Kind::TextureSubresource;
+		desc.priority        = priority;
+		desc.srcUploadBuffer = allocation.buffer;
+		desc.srcOffset       = allocation.offset + static_cast<size_t>(fp.offset);
+		desc.dstResource     = destination;
+		desc.size            = static_cast<size_t>(fp.rowPitch) * fp.height * fp.depth;
+		desc.mip             = fp.mip;
+		desc.slice           = fp.arraySlice;
+		desc.footprint.offset   = static_cast<uint64_t>(allocation.offset) + fp.offset;
+		desc.footprint.rowPitch = fp.rowPitch;
+		desc.footprint.width    = fp.width;
+		desc.footprint.height   = fp.height;
+		desc.footprint.depth    = fp.depth;
+		desc.z               = fp.zSlice;
+		descs.push_back(std::move(desc));
+	}
 
 	{
 		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		for (auto& desc : descs) {
+			desc.sequence = m_nextStreamingSequence++;
+		}
+		m_pendingStreamingUploads.insert(
+			m_pendingStreamingUploads.end(),
+			std::make_move_iterator(descs.begin()),
+			std::make_move_iterator(descs.end()));
+	}
+}
+
+StreamingFileReader& UploadManager::GetStreamingFileReaderLocked()
+{
+	if (!m_streamingFileReader) {
+		m_streamingFileReader = std::make_unique<StreamingFileReader>(m_streamingPagePool);
+	}
+	return *m_streamingFileReader;
+}
+
+void UploadManager::QueueStreamingDescriptorsLocked(std::vector<StreamingUploadDescriptor>&& descs)
+{
+	for (auto& desc : descs) {
+		desc.sequence = m_nextStreamingSequence++;
 		m_pendingStreamingUploads.push_back(std::move(desc));
 	}
 }
 
+std::shared_ptr<StreamingUploadTicket> UploadManager::QueueStreamingFileUpload(
+    const StreamingFileSource& source,
+    std::shared_ptr<Resource> destination,
+    size_t dstOffset,
+    StreamingUploadPriority priority)
+{
+	auto ticket = std::make_shared<StreamingUploadTicket>();
+	if (!destination || source.size == 0) {
+		ticket->state.store(StreamingUploadTicket::State::Failed, std::memory_order_release);
+		return ticket;
+	}
+	ticket->pendingCopies.store(1, std::memory_order_relaxed);
+
+	const size_t size = static_cast<size_t>(source.size);
+	auto completion = [this, ticket, destination = std::move(destination), dstOffset, priority, size](
+		bool succeeded, const AsyncCopyPagePool::Allocation& allocation, size_t dataOffset) {
+		if (!succeeded) {
+			ticket->state.store(StreamingUploadTicket::State::Failed, std::memory_order_release);
+			return;
+		}
+		std::vector<StreamingUploadDescriptor> descs(1);
+		auto& desc = descs.front();
+		desc.srcUploadBuffer = allocation.buffer;
+		desc.srcOffset       = dataOffset;
+		desc.dstResource     = destination;
+		desc.dstOffset       = dstOffset;
+		desc.size            = size;
+		desc.priority        = priority;
+		desc.ticket          = ticket;
+
+		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		ticket->state.store(StreamingUploadTicket::State::Queued, std::memory_order_release);
+		QueueStreamingDescriptorsLocked(std::move(descs));
+	};
+
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	GetStreamingFileReaderLocked().Enqueue(source, 1, std::move(completion));
+	return ticket;
+}
+
+std::shared_ptr<StreamingUploadTicket> UploadManager::QueueStreamingFileTextureUpload(
+    const StreamingFileSource& source,
+    std::shared_ptr<Resource> destination,
+    std::vector<StreamingTextureFootprint> footprints,
+    StreamingUploadPriority priority)
+{
+	auto ticket = std::make_shared<StreamingUploadTicket>();
+	if (!destination || source.size == 0 || footprints.empty()) {
+		ticket->state.store(StreamingUploadTicket::State::Failed, std::memory_order_release);
+		return ticket;
+	}
+	for (const auto& fp : footprints) {
+		if (((source.offset + fp.footprint.offset) & 511) != 0) {
+			throw std::runtime_error("Streaming file texture footprints must start 512-byte aligned in the file");
+		}
+	}
+
+	const auto submitCount = static_cast<uint32_t>(footprints.size());
+	ticket->pendingCopies.store(submitCount, std::memory_order_relaxed);
+
+	auto completion = [this, ticket, destination = std::move(destination), footprints = std::move(footprints), priority](
+		bool succeeded, const AsyncCopyPagePool::Allocation& allocation, size_t dataOffset) {
+		if (!succeeded) {
+			ticket->state.store(StreamingUploadTicket::State::Failed, std::memory_order_release);
+			return;
+		}
+		std::vector<StreamingUploadDescriptor> descs;
+		descs.reserve(footprints.size());
+		for (const auto& fp : footprints) {
+			StreamingUploadDescriptor desc;
+			desc.kind            = StreamingUploadDescriptor::Kind::TextureSubresource;
+			desc.priority        = priority;
+			desc.srcUploadBuffer = allocation.buffer;
+			desc.srcOffset       = dataOffset + static_cast<size_t>(fp.footprint.offset);
+			desc.dstResource     = destination;
+			desc.size            = static_cast<size_t>(fp.footprint.rowPitch) * fp.footprint.height * fp.footprint.depth;
+			desc.mip             = fp.mip;
+			desc.slice           = fp.slice;
+			desc.footprint       = fp.footprint;
+			desc.footprint.offset = static_cast<uint64_t>(dataOffset) + fp.footprint.offset;
+			desc.x               = fp.x;
+			desc.y               = fp.y;
+			desc.z               = fp.z;
+			desc.ticket          = ticket;
+			descs.push_back(std::move(desc));
+		}
+
+		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		ticket->state.store(StreamingUploadTicket::State::Queued, std::memory_order_release);
+		QueueStreamingDescriptorsLocked(std::move(descs));
+	};
+
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	GetStreamingFileReaderLocked().Enqueue(source, submitCount, std::move(completion));
+	return ticket;
+}
+
 std::vector<StreamingUploadDescriptor> UploadManager::ConsumeStreamingUploads()
 {
+	const uint64_t budget = rg::runtime::GetOpenRenderGraphSettings().streamingUploadFrameBudgetBytes;
+
 	std::lock_guard<std::mutex> lock(m_streamingMutex);
 	std::vector<StreamingUploadDescriptor> result;
-	result.swap(m_pendingStreamingUploads);
+	StreamingUploadStats stats;
+	stats.frameBudgetBytes = budget;
+
+	if (budget == 0) {
+		result.swap(m_pendingStreamingUploads);
+	}
+	else {
+		// Pending uploads are in sequence order. An upload inherits the highest priority of any
+		// later upload to the same destination, so sorting by that never lets a later write to a
+		// resource overtake an earlier one.
+		const size_t count = m_pendingStreamingUploads.size();
+		std::vector<uint8_t> effectivePriority(count);
+		{
+			std::unordered_map<Resource*, uint8_t> laterMaxPriority;
+			for (size_t i = count; i-- > 0;) {
+				const auto& desc = m_pendingStreamingUploads[i];
+				auto& laterMax = laterMaxPriority[desc.dstResource.get()];
+				laterMax = (std::max)(laterMax, static_cast<uint8_t>(desc.priority));
+				effectivePriority[i] = laterMax;
+			}
+		}
+		std::vector<size_t> order(count);
+		std::iota(order.begin(), order.end(), size_t{ 0 });
+		std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+			return effectivePriority[lhs] > effectivePriority[rhs];
+		});
+
+		// Critical uploads ignore the budget, and the first upload of a frame always goes so an
+		// oversized one can't stall the queue. Once a destination has an upload deferred, the rest
+		// of its uploads wait with it.
+		std::vector<uint8_t> issued(count, 0);
+		std::unordered_set<Resource*> deferredDestinations;
+		uint64_t issuedBytes = 0;
+		for (const size_t index : order) {
+			const auto& desc = m_pendingStreamingUploads[index];
+			Resource* destination = desc.dstResource.get();
+			if (deferredDestinations.contains(destination)) {
+				continue;
+			}
+			const bool critical = effectivePriority[index] >= static_cast<uint8_t>(StreamingUploadPriority::Critical);
+			const bool fits = issuedBytes + desc.size <= budget || issuedBytes == 0;
+			if (!critical && !fits) {
+				deferredDestinations.insert(destination);
+				continue;
+			}
+			issued[index] = 1;
+			issuedBytes += desc.size;
+		}
+
+		// Issue in sequence order; the copy pass records them as given.
+		std::vector<StreamingUploadDescriptor> backlog;
+		result.reserve(count);
+		for (size_t i = 0; i < count; ++i) {
+			(issued[i] ? result : backlog).push_back(std::move(m_pendingStreamingUploads[i]));
+		}
+		m_pendingStreamingUploads.swap(backlog);
+	}
+
+	for (const auto& desc : result) {
+		m_streamingPagePool.MarkSubmitted(desc.srcUploadBuffer.get());
+		if (desc.ticket && desc.ticket->pendingCopies.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+			desc.ticket->state.store(StreamingUploadTicket::State::Submitted, std::memory_order_release);
+			m_ticketsAwaitingFence.push_back(desc.ticket);
+		}
+		stats.streamedBytes += desc.size;
+	}
+	stats.streamedUploads = result.size();
+	for (const auto& desc : m_pendingStreamingUploads) {
+		stats.backlogBytes += desc.size;
+	}
+	stats.backlogUploads = m_pendingStreamingUploads.size();
+	stats.pagePoolResidentBytes = m_streamingPagePool.GetResidentBytes();
+	m_lastStreamingStats = stats;
+
+	TracyPlot("RG.StreamingUpload.StreamedBytes", static_cast<int64_t>(stats.streamedBytes));
+	TracyPlot("RG.StreamingUpload.BacklogBytes", static_cast<int64_t>(stats.backlogBytes));
+	TracyPlot("RG.StreamingUpload.BacklogUploads", static_cast<int64_t>(stats.backlogUploads));
+	FrameTraceWriter::GetInstance().AddToCounter(FrameTraceCounter::StreamedUploadBytes, stats.streamedBytes);
+	return result;
+}
+
+void UploadManager::CloseStreamingUploadRegion(uint64_t copyFenceValue)
+{
+	m_streamingPagePool.CloseRegion(copyFenceValue);
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	for (auto& ticket : m_ticketsAwaitingFence) {
+		ticket->copyFenceValue.store(copyFenceValue, std::memory_order_release);
+	}
+	m_ticketsAwaitingFence.clear();
+}
+
+void UploadManager::ReclaimStreamingPagePool(uint64_t completedCopyFenceValue)
+{
+	m_streamingPagePool.Reclaim(completedCopyFenceValue);
+}
+
+StreamingUploadStats UploadManager::GetStreamingUploadStats()
+{
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	return m_lastStreamingStats;
+}
+
+void UploadManager::RegisterStreamingDecompressor(std::shared_ptr<rg::runtime::IStreamingDecompressor> decompressor)
+{
+	if (!decompressor) {
+		throw std::runtime_error("RegisterStreamingDecompressor: decompressor is null");
+	}
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	const uint32_t codec = decompressor->GetCodec();
+	std::erase_if(m_streamingDecompressors, [codec](const auto& existing) { return existing->GetCodec() == codec; });
+	m_streamingDecompressors.push_back(std::move(decompressor));
+}
+
+void UploadManager::QueueStreamingCompressedUpload(
+    uint32_t codec,
+    const void* data, size_t compressedSize, size_t uncompressedSize,
+    std::shared_ptr<Resource> destination, size_t dstOffset)
+{
+	if (!data || compressedSize == 0 || uncompressedSize == 0 || !destination) return;
+
+	{
+		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		const bool registered = std::any_of(m_streamingDecompressors.begin(), m_streamingDecompressors.end(), [codec](const auto& decompressor) {
+			return decompressor->GetCodec() == codec;
+		});
+		if (!registered) {
+			throw std::runtime_error("QueueStreamingCompressedUpload: no decompressor registered for codec " + std::to_string(codec));
+		}
+	}
+
+	const auto stagingStart = std::chrono::steady_clock::now();
+	auto allocation = m_streamingPagePool.Allocate(compressedSize, /*alignment*/16);
+
+	uint8_t* mapped = nullptr;
+	allocation.buffer->GetAPIResource().Map(reinterpret_cast<void**>(&mapped), 0, allocation.offset + compressedSize);
+	if (!mapped) {
+		spdlog::error("QueueStreamingCompressedUpload: failed to map streaming page for {} bytes", compressedSize);
+		m_streamingPagePool.MarkSubmitted(allocation.buffer.get()); // Release the allocation
+		return;
+	}
+	std::memcpy(mapped + allocation.offset, data, compressedSize);
+	allocation.buffer->GetAPIResource().Unmap(0, allocation.offset + compressedSize);
+	const auto stagingMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(
+		std::chrono::steady_clock::now() - stagingStart).count();
+
+	StreamingDecompressionJob job;
+	job.codec            = codec;
+	job.srcUploadBuffer  = std::move(allocation.buffer);
+	job.srcOffset        = allocation.offset;
+	job.compressedSize   = compressedSize;
+	job.dstResource      = std::move(destination);
+	job.dstOffset        = dstOffset;
+	job.uncompressedSize = uncompressedSize;
+
+	{
+		std::lock_guard<std::mutex> lock(m_streamingMutex);
+		m_decompressionStagingMicroseconds += static_cast<uint64_t>(stagingMicroseconds);
+		m_pendingDecompressionJobs.push_back(std::move(job));
+	}
+}
+
+std::vector<StreamingDecompressionJob> UploadManager::ConsumeStreamingDecompressionJobs()
+{
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	std::vector<StreamingDecompressionJob> result;
+	result.swap(m_pendingDecompressionJobs);
+
+	// Group by codec so each decompressor gets one contiguous run; submission order is kept
+	// within a codec.
+	std::stable_sort(result.begin(), result.end(), [](const StreamingDecompressionJob& lhs, const StreamingDecompressionJob& rhs) {
+		return lhs.codec < rhs.codec;
+	});
+
+	StreamingDecompressionStats stats;
+	for (const auto& job : result) {
+		m_streamingPagePool.MarkSubmitted(job.srcUploadBuffer.get());
+		stats.compressedBytes += job.compressedSize;
+		stats.uncompressedBytes += job.uncompressedSize;
+	}
+	stats.jobs = result.size();
+	stats.cpuStagingMicroseconds = m_decompressionStagingMicroseconds;
+	m_decompressionStagingMicroseconds = 0;
+	m_lastDecompressionStats = stats;
+
+	TracyPlot("RG.StreamingDecompression.Jobs", static_cast<int64_t>(stats.jobs));
+	TracyPlot("RG.StreamingDecompression.CompressedBytes", static_cast<int64_t>(stats.compressedBytes));
+	TracyPlot("RG.StreamingDecompression.UncompressedBytes", static_cast<int64_t>(stats.uncompressedBytes));
+	return result;
+}
+
+std::vector<std::shared_ptr<rg::runtime::IStreamingDecompressor>> UploadManager::GetStreamingDecompressors()
+{
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	return m_streamingDecompressors;
+}
+
+StreamingDecompressionStats UploadManager::GetStreamingDecompressionStats()
+{
+	std::lock_guard<std::mutex> lock(m_streamingMutex);
+	return m_lastDecompressionStats;
+}
+
+void UploadManager::RegisterMipGenerator(std::shared_ptr<rg::runtime::IMipGenerator> generator)
+{
+	if (!generator) {
+		throw std::runtime_error("RegisterMipGenerator: generator is null");
+	}
+	std::lock_guard<std::mutex> lock(m_mipGenerationMutex);
+	m_mipGenerator = std::move(generator);
+}
+
+void UploadManager::QueueMipGeneration(UploadTarget target, uint32_t sourceMip, uint32_t mipCount, uint32_t firstSlice, uint32_t sliceCount)
+{
+	if (mipCount == 0 || sliceCount == 0) return;
+
+	std::lock_guard<std::mutex> lock(m_mipGenerationMutex);
+	if (!m_mipGenerator) {
+		throw std::runtime_error("QueueMipGeneration: no mip generator registered");
+	}
+	m_pendingMipGenerations.push_back(PendingMipGeneration{
+		.target = std::move(target),
+		.sourceMip = sourceMip,
+		.mipCount = mipCount,
+		.firstSlice = firstSlice,
+		.sliceCount = sliceCount });
+}
+
+std::vector<rg::runtime::MipGenerationJob> UploadManager::ConsumeMipGenerationJobs()
+{
+	std::vector<PendingMipGeneration> pending;
+	{
+		std::lock_guard<std::mutex> lock(m_mipGenerationMutex);
+		pending.swap(m_pendingMipGenerations);
+	}
+
+	std::vector<rg::runtime::MipGenerationJob> result;
+	result.reserve(pending.size());
+	uint64_t mips = 0;
+	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+	for (auto& request : pending) {
+		Resource* texture = request.target.kind == UploadTarget::Kind::PinnedShared
+			? request.target.pinned.get()
+			: (m_ctx.registry ? m_ctx.registry->Resolve(request.target.h) : nullptr);
+		if (!texture) {
+			spdlog::warn("ConsumeMipGenerationJobs: dropping mip generation for a target that no longer resolves");
+			continue;
+		}
+		const uint32_t mipLevels = texture->GetMipLevels();
+		const uint32_t arraySize = texture->GetArraySize();
+		if (request.sourceMip + 1 >= mipLevels || request.firstSlice >= arraySize) {
+			continue;
+		}
+
+		rg::runtime::MipGenerationJob job;
+		job.texture = texture->shared_from_this();
+		job.sourceMip = request.sourceMip;
+		job.mipCount = std::min(request.mipCount, mipLevels - request.sourceMip - 1);
+		job.firstSlice = request.firstSlice;
+		job.sliceCount = std::min(request.sliceCount, arraySize - request.firstSlice);
+		mips += static_cast<uint64_t>(job.mipCount) * job.sliceCount;
+		result.push_back(std::move(job));
+	}
+
+	TracyPlot("RG.MipGeneration.Jobs", static_cast<int64_t>(result.size()));
+	TracyPlot("RG.MipGeneration.Subresources", static_cast<int64_t>(mips));
 	return result;
 }
+
+std::shared_ptr<rg::runtime::IMipGenerator> UploadManager::GetMipGenerator()
+{
+	std::lock_guard<std::mutex> lock(m_mipGenerationMutex);
+	return m_mipGenerator;
+}
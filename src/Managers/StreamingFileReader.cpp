@@ -0,0 +1,223 @@
+#include "Managers/StreamingFileReader.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Resources/Resource.h"
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace {
+	constexpr uint64_t AlignDownU64(uint64_t v, uint64_t a) noexcept { return v & ~(a - 1); }
+	constexpr uint64_t AlignUpU64(uint64_t v, uint64_t a) noexcept { return (v + (a - 1)) & ~(a - 1); }
+
+	// Largest single read; keeps each call inside the platform's 32-bit read length.
+	constexpr size_t kMaxReadChunk = 64ull * 1024ull * 1024ull;
+
+#ifdef _WIN32
+	void* OpenUnbuffered(const std::filesystem::path& path) {
+		HANDLE handle = CreateFileW(
+			path.c_str(),
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_FLAG_NO_BUFFERING | FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN,
+			nullptr);
+		return handle == INVALID_HANDLE_VALUE ? nullptr : handle;
+	}
+
+	void CloseNative(void* handle) {
+		if (handle) {
+			CloseHandle(static_cast<HANDLE>(handle));
+		}
+	}
+
+	// Overlapped read so handles opened with FILE_FLAG_OVERLAPPED work as well as plain ones.
+	bool ReadNative(void* handle, uint64_t fileOffset, size_t size, uint8_t* destination, size_t& outRead) {
+		OVERLAPPED overlapped{};
+		overlapped.Offset = static_cast<DWORD>(fileOffset & 0xFFFFFFFFull);
+		overlapped.OffsetHigh = static_cast<DWORD>(fileOffset >> 32);
+		overlapped.hEvent = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+		if (!overlapped.hEvent) {
+			return false;
+		}
+		DWORD read = 0;
+		BOOL ok = ReadFile(static_cast<HANDLE>(handle), destination, static_cast<DWORD>(size), nullptr, &overlapped);
+		if (ok || GetLastError() == ERROR_IO_PENDING) {
+			ok = GetOverlappedResult(static_cast<HANDLE>(handle), &overlapped, &read, TRUE);
+		}
+		CloseHandle(overlapped.hEvent);
+		outRead = read;
+		// Unbuffered reads past end of file come back short or as ERROR_HANDLE_EOF.
+		return ok || GetLastError() == ERROR_HANDLE_EOF;
+	}
+#else
+	// File descriptors travel in the handle slot as-is; 0 reads as "no handle".
+	void* FdToHandle(int fd) { return reinterpret_cast<void*>(static_cast<intptr_t>(fd)); }
+	int HandleToFd(void* handle) { return static_cast<int>(reinterpret_cast<intptr_t>(handle)); }
+
+	void* OpenUnbuffered(const std::filesystem::path& path) {
+		int fd = -1;
+#ifdef O_DIRECT
+		fd = ::open(path.c_str(), O_RDONLY | O_DIRECT);
+#endif
+		if (fd < 0) {
+			fd = ::open(path.c_str(), O_RDONLY);
+		}
+		return fd <= 0 ? nullptr : FdToHandle(fd);
+	}
+
+	void CloseNative(void* handle) {
+		if (handle) {
+			::close(HandleToFd(handle));
+		}
+	}
+
+	bool ReadNative(void* handle, uint64_t fileOffset, size_t size, uint8_t* destination, size_t& outRead) {
+		const ssize_t read = ::pread(HandleToFd(handle), destination, size, static_cast<off_t>(fileOffset));
+		outRead = read > 0 ? static_cast<size_t>(read) : 0;
+		return read >= 0;
+	}
+#endif
+}
+
+StreamingFileReader::StreamingFileReader(AsyncCopyPagePool& pool)
+	: m_pool(pool)
+{
+	m_thread = std::thread(&StreamingFileReader::WorkerMain, this);
+}
+
+StreamingFileReader::~StreamingFileReader() {
+	Stop();
+}
+
+void StreamingFileReader::Enqueue(StreamingFileSource source, uint32_t submitCount, Completion completion) {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_requests.push_back(Request{ std::move(source), (std::max)(submitCount, 1u), std::move(completion) });
+	}
+	m_cv.notify_one();
+}
+
+void StreamingFileReader::Stop() {
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_quit = true;
+	}
+	m_cv.notify_all();
+	if (m_thread.joinable()) {
+		m_thread.join();
+	}
+
+	std::deque<Request> abandoned;
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		abandoned.swap(m_requests);
+	}
+	for (auto& request : abandoned) {
+		if (request.completion) {
+			request.completion(false, {}, 0);
+		}
+	}
+	CloseCached();
+}
+
+void StreamingFileReader::WorkerMain() {
+	for (;;) {
+		Request request;
+		{
+			std::unique_lock<std::mutex> lock(m_mutex);
+			m_cv.wait(lock, [this] { return m_quit || !m_requests.empty(); });
+			if (m_quit) {
+				return;
+			}
+			request = std::move(m_requests.front());
+			m_requests.pop_front();
+		}
+		Execute(request);
+	}
+}
+
+void StreamingFileReader::Execute(Request& request) {
+	ZoneScopedN("StreamingFileReader::Execute");
+	const auto& source = request.source;
+	const uint64_t alignedBegin = AlignDownU64(source.offset, kReadAlignment);
+	const uint64_t alignedEnd = AlignUpU64(source.offset + source.size, kReadAlignment);
+	const size_t readSize = static_cast<size_t>(alignedEnd - alignedBegin);
+	const size_t head = static_cast<size_t>(source.offset - alignedBegin);
+
+	auto allocation = m_pool.Allocate(readSize, kReadAlignment, request.submitCount);
+	uint8_t* mapped = nullptr;
+	allocation.buffer->GetAPIResource().Map(reinterpret_cast<void**>(&mapped), 0, allocation.offset + readSize);
+	bool succeeded = mapped && ReadRange(source, alignedBegin, readSize, mapped + allocation.offset);
+	if (mapped) {
+		allocation.buffer->GetAPIResource().Unmap(0, allocation.offset + readSize);
+	}
+
+	if (!succeeded) {
+		spdlog::error(
+			"StreamingFileReader: failed to read {} bytes at offset {} from '{}'",
+			source.size,
+			source.offset,
+			source.path.string());
+		for (uint32_t i = 0; i < request.submitCount; ++i) {
+			m_pool.MarkSubmitted(allocation.buffer.get());
+		}
+	}
+	if (request.completion) {
+		request.completion(succeeded, allocation, allocation.offset + head);
+	}
+}
+
+bool StreamingFileReader::ReadRange(const StreamingFileSource& source, uint64_t fileOffset, size_t size, uint8_t* destination) {
+	void* handle = source.nativeHandle ? source.nativeHandle : OpenCached(source.path);
+	if (!handle) {
+		return false;
+	}
+
+	const size_t required = static_cast<size_t>(source.offset + source.size - fileOffset);
+	size_t total = 0;
+	while (total < size) {
+		const size_t chunk = (std::min)(size - total, kMaxReadChunk);
+		size_t read = 0;
+		if (!ReadNative(handle, fileOffset + total, chunk, destination + total, read)) {
+			return false;
+		}
+		total += read;
+		if (read < chunk) {
+			break; // End of file; the aligned tail may run past it
+		}
+	}
+	return total >= required;
+}
+
+void* StreamingFileReader::OpenCached(const std::filesystem::path& path) {
+	if (m_cachedHandle && m_cachedPath == path) {
+		return m_cachedHandle;
+	}
+	CloseCached();
+	m_cachedHandle = OpenUnbuffered(path);
+	if (m_cachedHandle) {
+		m_cachedPath = path;
+	}
+	return m_cachedHandle;
+}
+
+void StreamingFileReader::CloseCached() {
+	CloseNative(m_cachedHandle);
+	m_cachedHandle = nullptr;
+	m_cachedPath.clear();
+}
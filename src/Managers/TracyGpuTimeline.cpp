@@ -0,0 +1,145 @@
+#include "Managers/TracyGpuTimeline.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include <tracy/Tracy.hpp>
+#ifdef TRACY_ENABLE
+#include <client/TracyProfiler.hpp>
+#endif
+
+namespace {
+#ifdef TRACY_ENABLE
+const char* QueueContextName(rhi::QueueKind queueKind) {
+    switch (queueKind) {
+    case rhi::QueueKind::Graphics: return "ORG Graphics";
+    case rhi::QueueKind::Compute:  return "ORG Compute";
+    case rhi::QueueKind::Copy:     return "ORG Copy";
+    }
+    return "ORG Queue";
+}
+
+void EmitNewContext(uint8_t id, int64_t gpuTime, float period, const char* name) {
+    auto* item = tracy::Profiler::QueueSerial();
+    tracy::MemWrite(&item->hdr.type, tracy::QueueType::GpuNewContext);
+    tracy::MemWrite(&item->gpuNewContext.cpuTime, tracy::Profiler::GetTime());
+    tracy::MemWrite(&item->gpuNewContext.gpuTime, gpuTime);
+    std::memset(&item->gpuNewContext.thread, 0, sizeof(item->gpuNewContext.thread));
+    tracy::MemWrite(&item->gpuNewContext.period, period);
+    tracy::MemWrite(&item->gpuNewContext.context, id);
+    tracy::MemWrite(&item->gpuNewContext.flags, uint8_t(0));
+    tracy::MemWrite(&item->gpuNewContext.type, tracy::GpuContextType::Direct3D12);
+#ifdef TRACY_ON_DEMAND
+    tracy::GetProfiler().DeferItem(*item);
+#endif
+    tracy::Profiler::QueueSerialFinish();
+
+    const size_t length = std::strlen(name);
+    auto* ptr = static_cast<char*>(tracy::tracy_malloc(length));
+    std::memcpy(ptr, name, length);
+    item = tracy::Profiler::QueueSerial();
+    tracy::MemWrite(&item->hdr.type, tracy::QueueType::GpuContextName);
+    tracy::MemWrite(&item->gpuContextNameFat.context, id);
+    tracy::MemWrite(&item->gpuContextNameFat.ptr, reinterpret_cast<uint64_t>(ptr));
+    tracy::MemWrite(&item->gpuContextNameFat.size, static_cast<uint16_t>(length));
+#ifdef TRACY_ON_DEMAND
+    tracy::GetProfiler().DeferItem(*item);
+#endif
+    tracy::Profiler::QueueSerialFinish();
+}
+
+void EmitGpuTime(uint8_t id, uint16_t queryId, int64_t gpuTime) {
+    auto* item = tracy::Profiler::QueueSerial();
+    tracy::MemWrite(&item->hdr.type, tracy::QueueType::GpuTime);
+    tracy::MemWrite(&item->gpuTime.gpuTime, gpuTime);
+    tracy::MemWrite(&item->gpuTime.queryId, queryId);
+    tracy::MemWrite(&item->gpuTime.context, id);
+    tracy::Profiler::QueueSerialFinish();
+}
+
+void EmitZoneBegin(uint8_t id, uint16_t queryId, const std::string& name, int64_t gpuTime) {
+    static constexpr char kFunction[] = "RenderGraph GPU";
+    const uint64_t srcloc = tracy::Profiler::AllocSourceLocation(
+        __LINE__, __FILE__, sizeof(__FILE__) - 1, kFunction, sizeof(kFunction) - 1, name.data(), name.size());
+    auto* item = tracy::Profiler::QueueSerial();
+    tracy::MemWrite(&item->hdr.type, tracy::QueueType::GpuZoneBeginAllocSrcLocSerial);
+    tracy::MemWrite(&item->gpuZoneBegin.cpuTime, tracy::Profiler::GetTime());
+    tracy::MemWrite(&item->gpuZoneBegin.srcloc, srcloc);
+    tracy::MemWrite(&item->gpuZoneBegin.thread, tracy::GetThreadHandle());
+    tracy::MemWrite(&item->gpuZoneBegin.queryId, queryId);
+    tracy::MemWrite(&item->gpuZoneBegin.context, id);
+    tracy::Profiler::QueueSerialFinish();
+    EmitGpuTime(id, queryId, gpuTime);
+}
+
+void EmitZoneEnd(uint8_t id, uint16_t queryId, int64_t gpuTime) {
+    auto* item = tracy::Profiler::QueueSerial();
+    tracy::MemWrite(&item->hdr.type, tracy::QueueType::GpuZoneEndSerial);
+    tracy::MemWrite(&item->gpuZoneEnd.cpuTime, tracy::Profiler::GetTime());
+    tracy::MemWrite(&item->gpuZoneEnd.thread, tracy::GetThreadHandle());
+    tracy::MemWrite(&item->gpuZoneEnd.queryId, queryId);
+    tracy::MemWrite(&item->gpuZoneEnd.context, id);
+    tracy::Profiler::QueueSerialFinish();
+    EmitGpuTime(id, queryId, gpuTime);
+}
+#endif
+}
+
+void TracyGpuTimeline::AddZone(std::string name, uint64_t beginTicks, uint64_t endTicks) {
+    if constexpr (!Available()) {
+        return;
+    }
+    m_zones.push_back({ std::move(name), beginTicks, std::max(beginTicks, endTicks) });
+}
+
+void TracyGpuTimeline::Submit(rhi::QueueKind queueKind) {
+#ifdef TRACY_ENABLE
+    ZoneScopedN("TracyGpuTimeline::Submit");
+    const size_t contextIndex = static_cast<size_t>(queueKind);
+    if (m_zones.empty() || m_ticksPerSecond == 0 || contextIndex >= m_contexts.size()) {
+        m_zones.clear();
+        return;
+    }
+
+    // Markers first, then outer zones: a wait lands just before the batch it gates, a signal at
+    // the end of the batch it completes rather than inside the next one, and a batch sorts
+    // before the passes that start with it.
+    std::sort(m_zones.begin(), m_zones.end(), [](const Zone& a, const Zone& b) {
+        if (a.begin != b.begin) {
+            return a.begin < b.begin;
+        }
+        const bool aMarker = a.begin == a.end;
+        const bool bMarker = b.begin == b.end;
+        return aMarker != bMarker ? aMarker : a.end > b.end;
+        });
+
+    auto& context = m_contexts[contextIndex];
+    if (!context.created) {
+        context.id = tracy::GetGpuCtxCounter().fetch_add(1, std::memory_order_relaxed);
+        EmitNewContext(context.id, static_cast<int64_t>(m_zones.front().begin), static_cast<float>(1e9 / double(m_ticksPerSecond)), QueueContextName(queueKind));
+        context.created = true;
+    }
+
+    // Tracy needs zones strictly nested per context; a zone that outlives its parent (timestamps
+    // of different command lists can overlap by a few ticks) is clipped to it.
+    m_openEnds.clear();
+    for (auto& zone : m_zones) {
+        while (!m_openEnds.empty() && m_openEnds.back() <= zone.begin && !(zone.begin == zone.end && m_openEnds.back() == zone.begin)) {
+            EmitZoneEnd(context.id, context.nextQueryId++, static_cast<int64_t>(m_openEnds.back()));
+            m_openEnds.pop_back();
+        }
+        if (!m_openEnds.empty()) {
+            zone.end = std::min(zone.end, m_openEnds.back());
+        }
+        EmitZoneBegin(context.id, context.nextQueryId++, zone.name, static_cast<int64_t>(zone.begin));
+        m_openEnds.push_back(zone.end);
+    }
+    while (!m_openEnds.empty()) {
+        EmitZoneEnd(context.id, context.nextQueryId++, static_cast<int64_t>(m_openEnds.back()));
+        m_openEnds.pop_back();
+    }
+#else
+    (void)queueKind;
+#endif
+    m_zones.clear();
+}
@@ -2,6 +2,8 @@
 
 #include <algorithm>
 #include <cstring>
+#include <functional>
+#include <iterator>
 #include <sstream>
 
 #include <rhi_helpers.h>
@@ -12,11 +14,33 @@
 #include "Resources/Resource.h"
 #include "Render/MemoryIntrospectionAPI.h"
 #include "Render/ImmediateExecution/ImmediateCommandList.h"
+#include "Managers/Singletons/FrameTraceWriter.h"
 
 namespace {
 	size_t AlignUpSizeT(const size_t v, const size_t a) noexcept {
 		return (v + (a - 1)) & ~(a - 1);
 	}
+
+	// Instance serials instead of addresses, so a new instance allocated where a destroyed one
+	// lived can't pick up its stale lane.
+	std::atomic<uint64_t> g_nextUploadInstanceSerial{ 1 };
+
+	// One CopyBufferRegion after coalescing; `update` supplies the upload page and pinned target.
+	struct PendingBufferCopy {
+		const UploadInstance::ResourceUpdate* update = nullptr;
+		Resource* dst = nullptr;
+		uint32_t order = 0;
+		size_t dstOffset = 0;
+		size_t srcOffset = 0;
+		size_t size = 0;
+	};
+
+	struct ThreadLaneCacheEntry {
+		uint64_t instanceSerial = 0;
+		void* lane = nullptr;
+	};
+	constexpr size_t kMaxCachedThreadLanes = 16;
+	thread_local std::vector<ThreadLaneCacheEntry> t_threadUploadLanes;
 }
 
 UploadInstance::UploadInstance(uint8_t numFramesInFlight, size_t pageSize)
@@ -30,11 +54,14 @@ UploadInstance::UploadInstance(uint8_t numFramesInFlight, size_t pageSize)
 UploadInstance::UploadInstance(Config config)
 	: m_pageSize((std::max)(size_t{ 1 }, config.pageSizeBytes))
 	, m_preallocateCapacityBytes(config.preallocateCapacityBytes)
+	, m_parallelCopyThresholdBytes(config.parallelCopyThresholdBytes)
+	, m_captureTargetNamesOnQueue(config.captureTargetNamesOnQueue)
 	, m_debugName(std::move(config.debugName))
 	, m_pageNamePrefix(std::move(config.pageNamePrefix))
 	, m_usageHint(std::move(config.usageHint))
 	, m_numFramesInFlight((std::max)(uint8_t{ 1 }, config.numFramesInFlight))
 {
+	m_instanceSerial = g_nextUploadInstanceSerial.fetch_add(1, std::memory_order_relaxed);
 	m_framePages.resize(m_numFramesInFlight);
 	m_recentFrameBytes.assign(m_numFramesInFlight, 0);
 	StartWorker();
@@ -47,11 +74,17 @@ UploadInstance::~UploadInstance() {
 void UploadInstance::SetResolveContext(UploadResolveContext ctx) {
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 	m_ctx = ctx;
-	RefreshQueuedTargetTelemetryLocked();
+	DrainThreadLanesLocked();
+	RefreshQueuedTargetTelemetryLocked(m_captureTargetNamesOnQueue);
 	PruneInvalidRegistryHandleUpdatesLocked("resolve-context-update");
 	MarkPendingWorkChangedLocked();
 }
 
+void UploadInstance::SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService) {
+	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+	m_taskService = std::move(taskService);
+}
+
 void UploadInstance::SetPendingWorkChangedCallback(PendingWorkChangedCallback callback) {
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 	m_pendingWorkChanged = std::move(callback);
@@ -60,7 +93,8 @@ void UploadInstance::SetPendingWorkChangedCallback(PendingWorkChangedCallback ca
 void UploadInstance::SetTargetTelemetryCallback(TargetTelemetryCallback callback) {
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 	m_targetTelemetry = std::move(callback);
-	RefreshQueuedTargetTelemetryLocked();
+	DrainThreadLanesLocked();
+	RefreshQueuedTargetTelemetryLocked(m_captureTargetNamesOnQueue);
 }
 
 void UploadInstance::SetInvalidRegistryHandleCallback(InvalidRegistryHandleCallback callback) {
@@ -283,27 +317,64 @@ void UploadInstance::UnmapUpload(const std::shared_ptr<Resource>& uploadBuffer)
 	uploadBuffer->GetAPIResource().Unmap(0, 0);
 }
 
+void UploadInstance::CopyToUpload(uint8_t* destination, const void* source, size_t size) {
+	std::shared_ptr<rg::runtime::ITaskService> taskService;
+	if (m_parallelCopyThresholdBytes != 0 && size >= m_parallelCopyThresholdBytes) {
+		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		taskService = m_taskService;
+	}
+	if (!taskService) {
+		std::memcpy(destination, source, size);
+		return;
+	}
+
+	// One update still covers the whole region, so splitting the copy can't reorder it against
+	// other uploads; only the CPU-side fill runs in parallel.
+	ZoneScopedN("UploadInstance::ParallelCopy");
+	const auto* bytes = static_cast<const uint8_t*>(source);
+	const size_t chunkCount = (size + kParallelCopyChunkBytes - 1) / kParallelCopyChunkBytes;
+	rg::runtime::TaskRangeOptions options;
+	options.grainSize = 1;
+	options.stableAffinity = false;
+	taskService->ParallelForChunked("UploadInstance::ParallelCopy", chunkCount, options, [&](size_t begin, size_t end) {
+		for (size_t chunk = begin; chunk < end; ++chunk) {
+			const size_t offset = chunk * kParallelCopyChunkBytes;
+			std::memcpy(destination + offset, bytes + offset, (std::min)(kParallelCopyChunkBytes, size - offset));
+		}
+	});
+}
+
 void UploadInstance::MarkPendingWorkChangedLocked() {
 	if (m_pendingWorkChanged) {
 		m_pendingWorkChanged();
 	}
 }
 
-void UploadInstance::CaptureTargetTelemetryLocked(const UploadTarget& target, uint64_t& outId, std::string& outName) {
+void UploadInstance::CaptureTargetTelemetryLocked(const UploadTarget& target, uint64_t& outId, const std::string*& outName, bool withName) {
 	outId = 0;
-	outName.clear();
+	outName = nullptr;
 	if (m_targetTelemetry) {
-		m_targetTelemetry(target, outId, outName);
+		m_targetTelemetry(target, outId, withName ? &outName : nullptr);
 	}
 }
 
-void UploadInstance::RefreshQueuedTargetTelemetryLocked() {
+void UploadInstance::RefreshQueuedTargetTelemetryLocked(bool withNames) {
 	for (auto& update : m_resourceUpdates) {
-		CaptureTargetTelemetryLocked(update.resourceToUpdate, update.targetGlobalResourceId, update.targetDebugName);
+		CaptureTargetTelemetryLocked(update.resourceToUpdate, update.targetGlobalResourceId, update.targetDebugName, withNames);
 	}
 	for (auto& update : m_textureUpdates) {
-		CaptureTargetTelemetryLocked(update.texture, update.targetGlobalResourceId, update.targetDebugName);
+		CaptureTargetTelemetryLocked(update.texture, update.targetGlobalResourceId, update.targetDebugName, withNames);
+	}
+}
+
+const std::string* UploadInstance::InternDebugName(const std::string& name) {
+	if (name.empty()) {
+		return nullptr;
 	}
+	static std::mutex mutex;
+	static std::unordered_set<std::string> names;
+	std::lock_guard<std::mutex> lock(mutex);
+	return &*names.insert(name).first;
 }
 
 void UploadInstance::PruneInvalidRegistryHandleUpdatesLocked(const char* reason) {
@@ -346,6 +417,160 @@ void UploadInstance::PruneInvalidRegistryHandleUpdatesLocked(const char* reason)
 	});
 }
 
+UploadInstance::ThreadUploadLane& UploadInstance::GetThreadUploadLane() {
+	for (const auto& entry : t_threadUploadLanes) {
+		if (entry.instanceSerial == m_instanceSerial) {
+			return *static_cast<ThreadUploadLane*>(entry.lane);
+		}
+	}
+
+	auto lane = std::make_unique<ThreadUploadLane>();
+	ThreadUploadLane* rawLane = lane.get();
+	{
+		std::lock_guard<std::mutex> registryLock(m_threadLaneRegistryMutex);
+		m_threadLanes.push_back(std::move(lane));
+	}
+	// Entries of destroyed instances never match again; evicting a live one only costs this
+	// thread a second lane.
+	if (t_threadUploadLanes.size() >= kMaxCachedThreadLanes) {
+		t_threadUploadLanes.erase(t_threadUploadLanes.begin());
+	}
+	t_threadUploadLanes.push_back(ThreadLaneCacheEntry{ m_instanceSerial, rawLane });
+	return *rawLane;
+}
+
+bool UploadInstance::TryAllocateFromThreadSlice(
+	ThreadUploadLane& lane,
+	size_t size,
+	std::shared_ptr<Resource>& outUploadBuffer,
+	size_t& outOffset) const
+{
+	if (!lane.sliceBuffer || lane.sliceGeneration != m_sliceGeneration.load(std::memory_order_acquire)) {
+		return false;
+	}
+	const size_t alignedCursor = AlignUpSizeT(lane.sliceCursor, 16);
+	if (alignedCursor + size > lane.sliceEnd) {
+		return false;
+	}
+	outUploadBuffer = lane.sliceBuffer;
+	outOffset = alignedCursor;
+	lane.sliceCursor = alignedCursor + size;
+	return true;
+}
+
+uint64_t UploadInstance::AllocateThreadUploadRegion(
+	ThreadUploadLane& lane,
+	size_t size,
+	std::shared_ptr<Resource>& outUploadBuffer,
+	size_t& outOffset)
+{
+	{
+		std::lock_guard<std::mutex> laneLock(lane.mutex);
+		if (TryAllocateFromThreadSlice(lane, size, outUploadBuffer, outOffset)) {
+			return lane.sliceGeneration;
+		}
+	}
+
+	// Small uploads refill the lane's slice; large ones take a region of their own so a single
+	// big write doesn't waste the rest of a slice.
+	const size_t sliceBytes = (std::min)(kThreadSliceBytes, m_pageSize);
+	const bool refillSlice = size <= sliceBytes / 4;
+	uint64_t sliceGeneration = 0;
+	{
+		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		AllocateUploadRegion(refillSlice ? sliceBytes : size, /*alignment*/16, outUploadBuffer, outOffset);
+		sliceGeneration = m_sliceGeneration.load(std::memory_order_relaxed);
+	}
+	if (refillSlice) {
+		std::lock_guard<std::mutex> laneLock(lane.mutex);
+		lane.sliceBuffer = outUploadBuffer;
+		lane.sliceCursor = outOffset + size;
+		lane.sliceEnd = outOffset + sliceBytes;
+		lane.sliceGeneration = sliceGeneration;
+	}
+	return sliceGeneration;
+}
+
+void UploadInstance::QueueThreadLaneUpdate(ThreadUploadLane& lane, ResourceUpdate&& update) {
+	bool laneWasEmpty = false;
+	{
+		std::lock_guard<std::mutex> laneLock(lane.mutex);
+		update.sequence = m_uploadSequence.fetch_add(1, std::memory_order_acq_rel);
+		laneWasEmpty = lane.updates.empty();
+		lane.updates.push_back(std::move(update));
+		m_pendingLaneUpdates.fetch_add(1, std::memory_order_acq_rel);
+	}
+	// Pending work only needs re-announcing when this lane goes from drained to non-empty.
+	if (laneWasEmpty) {
+		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		MarkPendingWorkChangedLocked();
+	}
+}
+
+void UploadInstance::AppendResourceUpdateLocked(ResourceUpdate&& update) {
+	for (int i = static_cast<int>(m_resourceUpdates.size()) - 1; i >= 0; --i) {
+		auto& last = m_resourceUpdates[static_cast<size_t>(i)];
+		if (!last.active) {
+			continue;
+		}
+		if (TryCoalesceAppend(last, update)) {
+			return;
+		}
+		break;
+	}
+	m_resourceUpdates.push_back(std::move(update));
+}
+
+void UploadInstance::DrainThreadLanesLocked() {
+	if (m_pendingLaneUpdates.load(std::memory_order_acquire) == 0) {
+		return;
+	}
+
+	// Sequence numbers are taken under the lane mutex, so once the lanes have been visited every
+	// update numbered below the cut is in hand. Later ones wait for the next drain, which keeps
+	// m_resourceUpdates in sequence order even while other threads keep uploading.
+	const uint64_t cut = m_uploadSequence.load(std::memory_order_acquire);
+	std::vector<ResourceUpdate> drained;
+	{
+		std::lock_guard<std::mutex> registryLock(m_threadLaneRegistryMutex);
+		for (auto& lane : m_threadLanes) {
+			std::lock_guard<std::mutex> laneLock(lane->mutex);
+			auto& updates = lane->updates;
+			const auto split = std::find_if(updates.begin(), updates.end(), [cut](const ResourceUpdate& update) {
+				return update.sequence >= cut;
+			});
+			std::move(updates.begin(), split, std::back_inserter(drained));
+			updates.erase(updates.begin(), split);
+		}
+	}
+	if (drained.empty()) {
+		return;
+	}
+	m_pendingLaneUpdates.fetch_sub(drained.size(), std::memory_order_acq_rel);
+
+	std::sort(drained.begin(), drained.end(), [](const ResourceUpdate& lhs, const ResourceUpdate& rhs) {
+		return lhs.sequence < rhs.sequence;
+	});
+	for (auto& update : drained) {
+		CaptureTargetTelemetryLocked(update.resourceToUpdate, update.targetGlobalResourceId, update.targetDebugName, m_captureTargetNamesOnQueue);
+		AppendResourceUpdateLocked(std::move(update));
+	}
+}
+
+void UploadInstance::ResetThreadLanesLocked(bool dropUpdates) {
+	std::lock_guard<std::mutex> registryLock(m_threadLaneRegistryMutex);
+	for (auto& lane : m_threadLanes) {
+		std::lock_guard<std::mutex> laneLock(lane->mutex);
+		lane->sliceBuffer.reset();
+		lane->sliceCursor = 0;
+		lane->sliceEnd = 0;
+		if (dropUpdates) {
+			m_pendingLaneUpdates.fetch_sub(lane->updates.size(), std::memory_order_acq_rel);
+			lane->updates.clear();
+		}
+	}
+}
+
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
 void UploadInstance::UploadData(const void* data, size_t size, UploadTarget target, size_t dstOffset,
                                 const char* file, int line)
@@ -356,59 +581,148 @@ void UploadInstance::UploadData(const void* data, size_t size, UploadTarget targ
 	if (!data || size == 0) {
 		return;
 	}
+	if (TryWriteDirect(data, size, target, dstOffset)) {
+		return;
+	}
 
+	ThreadUploadLane& lane = GetThreadUploadLane();
 	std::shared_ptr<Resource> uploadBuffer;
 	size_t uploadOffset = 0;
-	ResourceUpdate update;
-	{
-		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
-		AllocateUploadRegion(size, /*alignment*/16, uploadBuffer, uploadOffset);
+	AllocateThreadUploadRegion(lane, size, uploadBuffer, uploadOffset);
 
-		update.size = size;
-		update.resourceToUpdate = target;
-		update.uploadBuffer = uploadBuffer;
-		update.uploadBufferOffset = uploadOffset;
-		update.dataBufferOffset = dstOffset;
+	uint8_t* mapped = nullptr;
+	MapUpload(uploadBuffer, uploadOffset + size, &mapped);
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
-		update.file = file;
-		update.line = line;
+	if (!mapped) {
+		__debugbreak();
+		return;
+	}
+#endif
+	if (mapped) {
+		CopyToUpload(mapped + uploadOffset, data, size);
+	}
+	UnmapUpload(uploadBuffer);
+
+	ResourceUpdate update;
+	update.size = size;
+	update.resourceToUpdate = target;
+	update.uploadBuffer = std::move(uploadBuffer);
+	update.uploadBufferOffset = uploadOffset;
+	update.dataBufferOffset = dstOffset;
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+	update.file = file;
+	update.line = line;
 #ifdef _WIN32
-		void* frames[ResourceUpdate::MaxStack];
-		USHORT captured = RtlCaptureStackBackTrace(1, ResourceUpdate::MaxStack, frames, nullptr);
-		update.stackSize = static_cast<uint8_t>(captured);
-		for (USHORT i = 0; i < captured; i++) update.stack[i] = frames[i];
+	void* frames[ResourceUpdate::MaxStack];
+	USHORT captured = RtlCaptureStackBackTrace(1, ResourceUpdate::MaxStack, frames, nullptr);
+	update.stackSize = static_cast<uint8_t>(captured);
+	for (USHORT i = 0; i < captured; i++) update.stack[i] = frames[i];
+#endif
 #endif
+
+	QueueThreadLaneUpdate(lane, std::move(update));
+}
+
+bool UploadInstance::TryWriteDirect(const void* data, size_t size, const UploadTarget& target, size_t dstOffset)
+{
+	if (BufferBase::GetDirectWriteBufferCount() == 0) {
+		return false;
+	}
+
+	Resource* resource = nullptr;
+	if (target.kind == UploadTarget::Kind::PinnedShared) {
+		resource = target.pinned.get();
+	}
+	else {
+		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		resource = m_ctx.registry ? m_ctx.registry->Resolve(target.h) : nullptr;
+	}
+	auto* buffer = dynamic_cast<BufferBase*>(resource);
+	if (!buffer || !buffer->IsDirectWriteEnabled() || !buffer->IsMaterialized()
+		|| dstOffset + size > buffer->GetBufferSize()) {
+		return false; // The regular path uploads it, or reports the bad target
+	}
+
+	uint8_t* mapped = nullptr;
+	auto apiResource = buffer->GetAPIResource();
+	apiResource.Map(reinterpret_cast<void**>(&mapped), 0, dstOffset + size);
+	if (!mapped) {
+		return false;
+	}
+	std::memcpy(mapped + dstOffset, data, size);
+	apiResource.Unmap(0, 0);
+	m_directWriteBytes.fetch_add(size, std::memory_order_relaxed);
+	return true;
+}
+
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+UploadInstance::UploadReservation UploadInstance::ReserveUpload(UploadTarget target, size_t dstOffset, size_t size,
+                                                                const char* file, int line)
+#else
+UploadInstance::UploadReservation UploadInstance::ReserveUpload(UploadTarget target, size_t dstOffset, size_t size)
 #endif
-		CaptureTargetTelemetryLocked(update.resourceToUpdate, update.targetGlobalResourceId, update.targetDebugName);
+{
+	UploadReservation reservation;
+	if (size == 0) {
+		return reservation;
 	}
 
+	ThreadUploadLane& lane = GetThreadUploadLane();
+	std::shared_ptr<Resource> uploadBuffer;
+	size_t uploadOffset = 0;
+	const uint64_t generation = AllocateThreadUploadRegion(lane, size, uploadBuffer, uploadOffset);
+
+	// The page stays mapped until CommitUpload; upload heaps tolerate overlapping maps.
 	uint8_t* mapped = nullptr;
 	MapUpload(uploadBuffer, uploadOffset + size, &mapped);
-#if BUILD_TYPE == BUILD_TYPE_DEBUG
 	if (!mapped) {
-		__debugbreak();
-		return;
+		UnmapUpload(uploadBuffer);
+		spdlog::error("{} ReserveUpload: failed to map upload page for {} bytes", m_debugName, size);
+		return reservation;
 	}
+
+	reservation.data = mapped + uploadOffset;
+	reservation.size = size;
+	reservation.target = std::move(target);
+	reservation.dstOffset = dstOffset;
+	reservation.uploadBuffer = std::move(uploadBuffer);
+	reservation.uploadOffset = uploadOffset;
+	reservation.generation = generation;
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+	reservation.file = file;
+	reservation.line = line;
 #endif
-	if (mapped) {
-		std::memcpy(mapped + uploadOffset, data, size);
+	return reservation;
+}
+
+void UploadInstance::CommitUpload(UploadReservation&& reservation) {
+	UploadReservation committed = std::move(reservation);
+	if (!committed) {
+		return;
 	}
-	UnmapUpload(uploadBuffer);
+	UnmapUpload(committed.uploadBuffer);
 
-	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
-	for (int i = static_cast<int>(m_resourceUpdates.size()) - 1; i >= 0; --i) {
-		auto& last = m_resourceUpdates[static_cast<size_t>(i)];
-		if (!last.active) {
-			continue;
-		}
-		if (TryCoalesceAppend(last, update)) {
-			MarkPendingWorkChangedLocked();
-			return;
-		}
-		break;
+	// Pages are handed to frame retirement in ProcessDeferredReleases, so a reservation committed
+	// after that could be copied from a page that is already being recycled.
+	if (committed.generation != m_sliceGeneration.load(std::memory_order_acquire)) {
+		spdlog::error(
+			"{} CommitUpload: dropping {} byte reservation committed after its frame's deferred releases",
+			m_debugName,
+			committed.size);
+		return;
 	}
-	m_resourceUpdates.push_back(std::move(update));
-	MarkPendingWorkChangedLocked();
+
+	ResourceUpdate update;
+	update.size = committed.size;
+	update.resourceToUpdate = std::move(committed.target);
+	update.uploadBuffer = std::move(committed.uploadBuffer);
+	update.uploadBufferOffset = committed.uploadOffset;
+	update.dataBufferOffset = committed.dstOffset;
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+	update.file = committed.file;
+	update.line = committed.line;
+#endif
+	QueueThreadLaneUpdate(GetThreadUploadLane(), std::move(update));
 }
 
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
@@ -480,7 +794,7 @@ void UploadInstance::UploadTextureSubresources(
 		update.file = file;
 		update.line = line;
 #endif
-		CaptureTargetTelemetryLocked(update.texture, update.targetGlobalResourceId, update.targetDebugName);
+		CaptureTargetTelemetryLocked(update.texture, update.targetGlobalResourceId, update.targetDebugName, m_captureTargetNamesOnQueue);
 		m_textureUpdates.push_back(std::move(update));
 	}
 	MarkPendingWorkChangedLocked();
@@ -494,6 +808,7 @@ void UploadInstance::ProcessUploads(uint8_t frameIndex, rg::imm::ImmediateComman
 	UploadResolveContext ctx;
 	{
 		std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
+		DrainThreadLanesLocked();
 		PruneInvalidRegistryHandleUpdatesLocked("upload-pass-execute");
 		resourceUpdates.swap(m_resourceUpdates);
 		textureUpdates.swap(m_textureUpdates);
@@ -503,27 +818,96 @@ void UploadInstance::ProcessUploads(uint8_t frameIndex, rg::imm::ImmediateComman
 		}
 	}
 
+	// Group copies by destination and fold runs that are contiguous in both the upload page and the
+	// destination into one CopyBufferRegion. A destination whose ranges overlap keeps submission
+	// order so later writes still win; only back-to-back neighbours are merged there.
+	std::vector<PendingBufferCopy> copies;
+	copies.reserve(resourceUpdates.size());
 	for (auto& update : resourceUpdates) {
 		if (!update.active || !update.uploadBuffer || update.size == 0) continue;
-		switch (update.resourceToUpdate.kind) {
-		case UploadTarget::Kind::PinnedShared:
+		PendingBufferCopy copy;
+		copy.update = &update;
+		copy.dst = update.resourceToUpdate.kind == UploadTarget::Kind::PinnedShared
+			? update.resourceToUpdate.pinned.get()
+			: ctx.registry->Resolve(update.resourceToUpdate.h);
+		copy.order = static_cast<uint32_t>(copies.size());
+		copy.dstOffset = update.dataBufferOffset;
+		copy.srcOffset = update.uploadBufferOffset;
+		copy.size = update.size;
+		copies.push_back(copy);
+	}
+
+	std::stable_sort(copies.begin(), copies.end(), [](const PendingBufferCopy& lhs, const PendingBufferCopy& rhs) {
+		return std::less<Resource*>{}(lhs.dst, rhs.dst);
+	});
+	for (size_t groupBegin = 0; groupBegin < copies.size();) {
+		size_t groupEnd = groupBegin + 1;
+		while (groupEnd < copies.size() && copies[groupEnd].dst == copies[groupBegin].dst) {
+			++groupEnd;
+		}
+		const auto first = copies.begin() + static_cast<ptrdiff_t>(groupBegin);
+		const auto last = copies.begin() + static_cast<ptrdiff_t>(groupEnd);
+		std::stable_sort(first, last, [](const PendingBufferCopy& lhs, const PendingBufferCopy& rhs) {
+			return lhs.dstOffset < rhs.dstOffset;
+		});
+		for (auto it = first + 1; it < last; ++it) {
+			if (it->dstOffset < (it - 1)->dstOffset + (it - 1)->size) {
+				std::sort(first, last, [](const PendingBufferCopy& lhs, const PendingBufferCopy& rhs) {
+					return lhs.order < rhs.order;
+				});
+				break;
+			}
+		}
+		groupBegin = groupEnd;
+	}
+
+	size_t writeIndex = 0;
+	for (size_t readIndex = 0; readIndex < copies.size(); ++readIndex) {
+		const auto& next = copies[readIndex];
+		if (writeIndex > 0) {
+			auto& tail = copies[writeIndex - 1];
+			if (tail.dst == next.dst
+				&& tail.update->uploadBuffer.get() == next.update->uploadBuffer.get()
+				&& tail.dstOffset + tail.size == next.dstOffset
+				&& tail.srcOffset + tail.size == next.srcOffset) {
+				tail.size += next.size;
+				continue;
+			}
+		}
+		copies[writeIndex++] = next;
+	}
+	copies.resize(writeIndex);
+
+	for (const auto& copy : copies) {
+		const auto& update = *copy.update;
+		if (update.resourceToUpdate.kind == UploadTarget::Kind::PinnedShared) {
 			commandList.CopyBufferRegion(
 				update.resourceToUpdate.pinned,
-				update.dataBufferOffset,
+				copy.dstOffset,
 				update.uploadBuffer,
-				update.uploadBufferOffset,
-				update.size);
-			break;
-		case UploadTarget::Kind::RegistryHandle:
+				copy.srcOffset,
+				copy.size);
+		} else {
 			commandList.CopyBufferRegion(
-				ctx.registry->Resolve(update.resourceToUpdate.h),
-				update.dataBufferOffset,
+				copy.dst,
+				copy.dstOffset,
 				update.uploadBuffer,
-				update.uploadBufferOffset,
-				update.size);
-			break;
+				copy.srcOffset,
+				copy.size);
 		}
 	}
+	const uint64_t directWriteBytes = m_directWriteBytes.exchange(0, std::memory_order_relaxed);
+	TracyPlot("RG.Upload.BufferUpdates", static_cast<int64_t>(resourceUpdates.size()));
+	TracyPlot("RG.Upload.BufferCopies", static_cast<int64_t>(copies.size()));
+	TracyPlot("RG.Upload.DirectWriteBytes", static_cast<int64_t>(directWriteBytes));
+	auto& frameTrace = FrameTraceWriter::GetInstance();
+	if (frameTrace.IsCapturing()) {
+		uint64_t copiedBytes = 0;
+		for (const auto& copy : copies) {
+			copiedBytes += copy.size;
+		}
+		frameTrace.AddToCounter(FrameTraceCounter::UploadBytes, copiedBytes + directWriteBytes);
+	}
 
 	for (auto& texUpdate : textureUpdates) {
 		if (texUpdate.texture.kind == UploadTarget::Kind::PinnedShared) {
@@ -558,6 +942,10 @@ void UploadInstance::ProcessDeferredReleases(uint8_t frameIndex) {
 	}
 	frameIndex %= m_numFramesInFlight;
 
+	// Slices handed out this frame live in pages that are about to be tracked for retirement.
+	m_sliceGeneration.fetch_add(1, std::memory_order_acq_rel);
+	ResetThreadLanesLocked(/*dropUpdates*/false);
+
 	auto& retiringPages = m_framePages[frameIndex];
 	for (auto& page : retiringPages) {
 		if (!page) {
@@ -589,6 +977,9 @@ void UploadInstance::ProcessDeferredReleases(uint8_t frameIndex) {
 }
 
 bool UploadInstance::HasPendingWork() const {
+	if (m_pendingLaneUpdates.load(std::memory_order_acquire) != 0) {
+		return true;
+	}
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 	return !m_resourceUpdates.empty() || !m_textureUpdates.empty();
 }
@@ -596,13 +987,25 @@ bool UploadInstance::HasPendingWork() const {
 void UploadInstance::CollectPendingDestinations(std::vector<std::shared_ptr<Resource>>& out) const {
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
 	std::unordered_set<Resource*> seen;
-	for (auto& u : m_resourceUpdates) {
-		if (!u.active) continue;
+	const auto collectBufferDestination = [&](const ResourceUpdate& u) {
+		if (!u.active) return;
 		if (u.resourceToUpdate.kind == UploadTarget::Kind::PinnedShared) {
 			if (u.resourceToUpdate.pinned && seen.insert(u.resourceToUpdate.pinned.get()).second) {
 				out.push_back(u.resourceToUpdate.pinned);
 			}
 		}
+	};
+	for (auto& u : m_resourceUpdates) {
+		collectBufferDestination(u);
+	}
+	{
+		std::lock_guard<std::mutex> registryLock(m_threadLaneRegistryMutex);
+		for (const auto& lane : m_threadLanes) {
+			std::lock_guard<std::mutex> laneLock(lane->mutex);
+			for (const auto& u : lane->updates) {
+				collectBufferDestination(u);
+			}
+		}
 	}
 	for (auto& t : m_textureUpdates) {
 		if (t.texture.kind == UploadTarget::Kind::PinnedShared) {
@@ -618,7 +1021,8 @@ void UploadInstance::DeclarePendingUploadResourceUsages(
 	const std::function<void(const UploadTarget&, uint32_t mip, uint32_t slice)>& copyDest)
 {
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
-	RefreshQueuedTargetTelemetryLocked();
+	DrainThreadLanesLocked();
+	RefreshQueuedTargetTelemetryLocked(m_captureTargetNamesOnQueue);
 	PruneInvalidRegistryHandleUpdatesLocked("upload-pass-declare");
 
 	for (const auto& update : m_resourceUpdates) {
@@ -643,7 +1047,8 @@ std::string UploadInstance::DescribeQueuedTargetByGlobalResourceId(uint64_t glob
 	}
 
 	std::lock_guard<std::mutex> lock(m_uploadQueueMutex);
-	RefreshQueuedTargetTelemetryLocked();
+	DrainThreadLanesLocked();
+	RefreshQueuedTargetTelemetryLocked(true);
 
 	std::ostringstream result;
 	size_t matchCount = 0;
@@ -656,7 +1061,7 @@ std::string UploadInstance::DescribeQueuedTargetByGlobalResourceId(uint64_t glob
 		}
 		result
 			<< updateKind
-			<< " name='" << (update.targetDebugName.empty() ? std::string("<unknown>") : update.targetDebugName) << "'";
+			<< " name='" << (update.targetDebugName ? *update.targetDebugName : std::string("<unknown>")) << "'";
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
 		result << " queuedAt=" << (update.file ? update.file : "<unknown>") << ":" << update.line;
 #endif
@@ -689,6 +1094,7 @@ void UploadInstance::Cleanup() {
 		pages.clear();
 	}
 	m_activePage.reset();
+	ResetThreadLanesLocked(/*dropUpdates*/true);
 	m_resourceUpdates.clear();
 	m_textureUpdates.clear();
 	m_currentFrameUploadBytes = 0;
@@ -1,11 +1,17 @@
 #include "Render/CommandListPool.h"
+#include "Render/Runtime/ITaskService.h"
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
 #include <string>
 #include <spdlog/spdlog.h>
 #include <tracy/Tracy.hpp>
 
 namespace {
+    // Pairs a job takes per pass, so a large backlog is shared by every job.
+    constexpr size_t kBackgroundResetChunk = 16;
+
     const char* QueueKindDebugName(rhi::QueueKind type) noexcept {
         switch (type) {
         case rhi::QueueKind::Graphics: return "Graphics";
@@ -16,20 +22,40 @@ namespace {
     }
 }
 
-CommandListPool::CommandListPool(rhi::Device& device, rhi::QueueKind type)
-    : m_device(device), m_type(type) {
-    m_backgroundResetThread = std::thread([this] { BackgroundResetMain(); });
+// Held by a submitted job's closure. A service that drops the job unrun still releases its slot.
+struct CommandListPool::BackgroundJob {
+    CommandListPool* pool;
+    bool ran = false;
+
+    explicit BackgroundJob(CommandListPool* owner) : pool(owner) {}
+    BackgroundJob(const BackgroundJob&) = delete;
+    BackgroundJob& operator=(const BackgroundJob&) = delete;
+
+    ~BackgroundJob() {
+        if (!ran) {
+            std::lock_guard lock(pool->m_mutex);
+            pool->FinishBackgroundJobLocked();
+        }
+    }
+};
+
+CommandListPool::CommandListPool(rhi::Device& device, rhi::QueueKind type, uint32_t resetWorkerCount, std::shared_ptr<rg::runtime::ITaskService> taskService)
+    : m_device(device), m_type(type), m_taskService(std::move(taskService)) {
+    m_diagnostics.backgroundResetWorkerCount = std::max(1u, resetWorkerCount);
 }
 
 CommandListPool::~CommandListPool() {
+    std::unique_lock lock(m_mutex);
+    m_stopBackgroundReset = true;
+    m_backgroundJobsIdleCv.wait(lock, [this] { return m_backgroundJobCount == 0; });
+}
+
+void CommandListPool::SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService) {
     {
         std::lock_guard lock(m_mutex);
-        m_stopBackgroundReset = true;
-    }
-    m_backgroundResetCv.notify_one();
-    if (m_backgroundResetThread.joinable()) {
-        m_backgroundResetThread.join();
+        m_taskService = std::move(taskService);
     }
+    ScheduleBackgroundResets(SIZE_MAX);
 }
 
 void CommandListPool::PreparePairForReuse(CommandListPair& pair) {
@@ -39,11 +65,106 @@ void CommandListPool::PreparePairForReuse(CommandListPair& pair) {
 }
 
 void CommandListPool::UpdateDiagnosticsCountsLocked() {
-    m_diagnostics.availableCount = m_available.size();
     m_diagnostics.inFlightCount = m_inFlight.size();
     m_diagnostics.backgroundResetPendingCount = m_pendingBackgroundReset.size() + m_backgroundResetActiveCount;
 }
 
+CommandListPool::Diagnostics CommandListPool::GetDiagnostics() const {
+    Diagnostics diagnostics;
+    {
+        std::lock_guard lock(m_mutex);
+        diagnostics = m_diagnostics;
+    }
+    diagnostics.createdThisFrame = m_createdThisFrame.load(std::memory_order_relaxed);
+    diagnostics.reusedThisFrame = m_reusedThisFrame.load(std::memory_order_relaxed);
+    diagnostics.stolenThisFrame = m_stolenThisFrame.load(std::memory_order_relaxed);
+    diagnostics.availableCount = 0;
+    for (size_t i = 0; i < kShardCount; ++i) {
+        std::lock_guard lock(m_shards[i].mutex);
+        diagnostics.availableByShard[i] = m_shards[i].available.size();
+        diagnostics.availableCount += diagnostics.availableByShard[i];
+    }
+    return diagnostics;
+}
+
+CommandListPool::Shard& CommandListPool::LocalShard() {
+    thread_local const size_t shard = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return m_shards[shard % kShardCount];
+}
+
+bool CommandListPool::TryPopBestFit(std::vector<CommandListPair>& available, uint64_t sizeHint, CommandListPair& pair) {
+    if (available.empty()) {
+        return false;
+    }
+    size_t best = available.size() - 1;
+    if (sizeHint != 0) {
+        for (size_t i = 0; i < available.size(); ++i) {
+            const uint64_t footprint = available[i].footprint;
+            const uint64_t bestFootprint = available[best].footprint;
+            const bool covers = footprint >= sizeHint;
+            const bool bestCovers = bestFootprint >= sizeHint;
+            if ((covers && (!bestCovers || footprint < bestFootprint)) || (!covers && !bestCovers && footprint > bestFootprint)) {
+                best = i;
+            }
+        }
+    }
+    pair = std::move(available[best]);
+    if (best != available.size() - 1) {
+        available[best] = std::move(available.back());
+    }
+    available.pop_back();
+    pair.footprint = std::max(pair.footprint, sizeHint);
+    return true;
+}
+
+bool CommandListPool::TryPopAvailable(CommandListPair& pair, uint64_t sizeHint) {
+    Shard& local = LocalShard();
+    {
+        std::lock_guard lock(local.mutex);
+        if (TryPopBestFit(local.available, sizeHint, pair)) {
+            m_reusedThisFrame.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    const size_t localIndex = static_cast<size_t>(&local - m_shards.data());
+    for (size_t offset = 1; offset < kShardCount; ++offset) {
+        Shard& victim = m_shards[(localIndex + offset) % kShardCount];
+        std::lock_guard lock(victim.mutex);
+        if (TryPopBestFit(victim.available, sizeHint, pair)) {
+            m_reusedThisFrame.fetch_add(1, std::memory_order_relaxed);
+            m_stolenThisFrame.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CommandListPool::DistributeAvailable(std::vector<CommandListPair>& pairs) {
+    if (pairs.empty()) {
+        return;
+    }
+    // One lock per shard: shard i takes every kShardCount-th pair from its start.
+    const size_t first = m_nextDistributeShard.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < kShardCount && i < pairs.size(); ++i) {
+        Shard& shard = m_shards[(first + i) % kShardCount];
+        std::lock_guard lock(shard.mutex);
+        for (size_t p = i; p < pairs.size(); p += kShardCount) {
+            shard.available.emplace_back(std::move(pairs[p]));
+        }
+    }
+    pairs.clear();
+}
+
+size_t CommandListPool::CountAvailable() const {
+    size_t count = 0;
+    for (const auto& shard : m_shards) {
+        std::lock_guard lock(shard.mutex);
+        count += shard.available.size();
+    }
+    return count;
+}
+
 CommandListPair CommandListPool::CreateReadyPair() {
     ZoneScopedN("CommandListPool::CreateReadyPair");
     CommandListPair pair;
@@ -60,25 +181,16 @@ CommandListPair CommandListPool::CreateReadyPair() {
     return pair;
 }
 
-CommandListPair CommandListPool::Request() {
+CommandListPair CommandListPool::Request(uint64_t sizeHint) {
     ZoneScopedN("CommandListPool::Request");
-    {
-        std::lock_guard lock(m_mutex);
-        if (!m_available.empty()) {
-            CommandListPair pair = std::move(m_available.back());
-            m_available.pop_back();
-            ++m_diagnostics.reusedThisFrame;
-            UpdateDiagnosticsCountsLocked();
-            return pair;
-        }
+    CommandListPair pair;
+    if (TryPopAvailable(pair, sizeHint)) {
+        return pair;
     }
 
-    CommandListPair pair = CreateReadyPair();
-    {
-        std::lock_guard lock(m_mutex);
-        ++m_diagnostics.createdThisFrame;
-        UpdateDiagnosticsCountsLocked();
-    }
+    pair = CreateReadyPair();
+    pair.footprint = sizeHint;
+    m_createdThisFrame.fetch_add(1, std::memory_order_relaxed);
     return pair;
 }
 
@@ -87,58 +199,73 @@ void CommandListPool::PrepareForRequests(size_t requiredCount, uint64_t complete
     {
         std::lock_guard lock(m_mutex);
         m_diagnostics.lastRequestedCount = requiredCount;
-        m_diagnostics.createdThisFrame = 0;
-        m_diagnostics.reusedThisFrame = 0;
         m_diagnostics.preparedDeficit = 0;
         m_diagnostics.enqueuedForBackgroundResetThisFrame = 0;
         m_diagnostics.backgroundResetCompletedThisFrame = 0;
+        m_diagnostics.resetOnCallerThisFrame = 0;
+        m_diagnostics.createdAheadThisFrame = 0;
+        // This frame's shortfall is made up below; ahead-of-time creation resumes at the next
+        // RecycleCompleted.
+        m_pendingAheadCreates = 0;
+        const size_t movedCount = MoveCompletedToPendingLocked(completedFenceValue);
+        m_diagnostics.enqueuedForBackgroundResetThisFrame += movedCount;
         UpdateDiagnosticsCountsLocked();
     }
+    m_createdThisFrame.store(0, std::memory_order_relaxed);
+    m_reusedThisFrame.store(0, std::memory_order_relaxed);
+    m_stolenThisFrame.store(0, std::memory_order_relaxed);
+    ScheduleBackgroundResets(SIZE_MAX);
 
-    RecycleCompleted(completedFenceValue);
+    const size_t availableBeforeWarm = CountAvailable();
+    size_t deficit = availableBeforeWarm < requiredCount ? requiredCount - availableBeforeWarm : 0;
+    if (deficit == 0) {
+        return;
+    }
 
-    size_t deficit = 0;
+    // Resetting a pending pair is cheaper than creating one and keeps the pool from growing while
+    // the background jobs catch up.
+    std::vector<CommandListPair> ready;
+    ready.reserve(deficit);
     {
         std::lock_guard lock(m_mutex);
-        if (m_available.size() < requiredCount) {
-            deficit = requiredCount - m_available.size();
-            m_diagnostics.preparedDeficit = deficit;
-            m_available.reserve(requiredCount);
-        }
+        const size_t take = std::min(deficit, m_pendingBackgroundReset.size());
+        const auto first = m_pendingBackgroundReset.end() - static_cast<std::ptrdiff_t>(take);
+        std::move(first, m_pendingBackgroundReset.end(), std::back_inserter(ready));
+        m_pendingBackgroundReset.erase(first, m_pendingBackgroundReset.end());
+        m_diagnostics.resetOnCallerThisFrame = take;
+        UpdateDiagnosticsCountsLocked();
     }
-
-    if (deficit > 0) {
-        std::vector<CommandListPair> created;
-        created.reserve(deficit);
-        for (size_t i = 0; i < deficit; ++i) {
-            created.emplace_back(CreateReadyPair());
-        }
-
-        size_t inFlightCount = 0;
-        {
-            std::lock_guard lock(m_mutex);
-            m_available.reserve(std::max(m_available.size() + created.size(), requiredCount));
-            for (auto& pair : created) {
-                m_available.emplace_back(std::move(pair));
-                ++m_diagnostics.createdThisFrame;
-            }
-            UpdateDiagnosticsCountsLocked();
-            inFlightCount = m_diagnostics.inFlightCount;
+    {
+        ZoneScopedN("CommandListPool::PrepareForRequests::ResetOnCaller");
+        for (auto& pair : ready) {
+            PreparePairForReuse(pair);
         }
+    }
+    const size_t resetOnCaller = ready.size();
+    deficit -= resetOnCaller;
 
-        spdlog::debug(
-            "CommandListPool::PrepareForRequests queue={} required={} availableBeforeWarm={} created={} inFlight={}",
-            QueueKindDebugName(m_type),
-            requiredCount,
-            requiredCount - deficit,
-            deficit,
-            inFlightCount);
+    for (size_t i = 0; i < deficit; ++i) {
+        ready.emplace_back(CreateReadyPair());
     }
+    DistributeAvailable(ready);
+    m_createdThisFrame.fetch_add(deficit, std::memory_order_relaxed);
 
+    size_t inFlightCount = 0;
     {
         std::lock_guard lock(m_mutex);
+        m_diagnostics.preparedDeficit = deficit + resetOnCaller;
         UpdateDiagnosticsCountsLocked();
+        inFlightCount = m_diagnostics.inFlightCount;
     }
+
+    spdlog::debug(
+        "CommandListPool::PrepareForRequests queue={} required={} availableBeforeWarm={} resetOnCaller={} created={} inFlight={}",
+        QueueKindDebugName(m_type),
+        requiredCount,
+        availableBeforeWarm,
+        resetOnCaller,
+        deficit,
+        inFlightCount);
 }
 
 void CommandListPool::Recycle(CommandListPair&& pair, uint64_t fenceValue) {
@@ -160,65 +287,127 @@ void CommandListPool::Recycle(CommandListPair&& pair, uint64_t fenceValue) {
     }
 
     if (notifyBackgroundReset) {
-        m_backgroundResetCv.notify_one();
+        ScheduleBackgroundResets(1);
+    }
+}
+
+size_t CommandListPool::MoveCompletedToPendingLocked(uint64_t completedFenceValue) {
+    size_t movedCount = 0;
+    while (!m_inFlight.empty() && m_inFlight.front().first <= completedFenceValue) {
+        m_pendingBackgroundReset.emplace_back(std::move(m_inFlight.front().second));
+        m_inFlight.pop_front();
+        ++movedCount;
     }
+    return movedCount;
+}
+
+void CommandListPool::ScheduleAheadCreatesLocked() {
+    // Pairs the next frame can count on without the caller: available, pending reset or being
+    // reset. In-flight pairs are left out, since their fence may not be reached in time.
+    const size_t target = m_diagnostics.lastRequestedCount;
+    const size_t onTheWay = m_diagnostics.availableCount + m_pendingBackgroundReset.size() + m_backgroundResetActiveCount;
+    m_pendingAheadCreates = onTheWay < target ? target - onTheWay : 0;
 }
 
 void CommandListPool::RecycleCompleted(uint64_t completedFenceValue) {
     ZoneScopedN("CommandListPool::RecycleCompleted");
+    const size_t available = CountAvailable();
     size_t movedCount = 0;
+    bool scheduledAhead = false;
     {
         std::lock_guard lock(m_mutex);
-        while (!m_inFlight.empty() && m_inFlight.front().first <= completedFenceValue) {
-            m_pendingBackgroundReset.emplace_back(std::move(m_inFlight.front().second));
-            m_inFlight.pop_front();
-            ++movedCount;
-        }
+        movedCount = MoveCompletedToPendingLocked(completedFenceValue);
         m_diagnostics.enqueuedForBackgroundResetThisFrame += movedCount;
+        m_diagnostics.availableCount = available;
+        ScheduleAheadCreatesLocked();
+        scheduledAhead = m_pendingAheadCreates > 0;
         UpdateDiagnosticsCountsLocked();
     }
 
-    if (movedCount > 0) {
-        m_backgroundResetCv.notify_one();
+    if (movedCount > kBackgroundResetChunk || scheduledAhead) {
+        ScheduleBackgroundResets(SIZE_MAX);
+    }
+    else if (movedCount > 0) {
+        ScheduleBackgroundResets(1);
+    }
+}
+
+void CommandListPool::ScheduleBackgroundResets(size_t wantedJobs) {
+    std::shared_ptr<rg::runtime::ITaskService> taskService;
+    size_t submitCount = 0;
+    {
+        std::lock_guard lock(m_mutex);
+        if (!m_taskService || m_stopBackgroundReset || (m_pendingBackgroundReset.empty() && m_pendingAheadCreates == 0)) {
+            return;
+        }
+        const size_t target = std::min(wantedJobs, m_diagnostics.backgroundResetWorkerCount);
+        submitCount = m_backgroundJobCount < target ? target - m_backgroundJobCount : 0;
+        m_backgroundJobCount += submitCount;
+        taskService = m_taskService;
+    }
+    // Outside the lock: a service without background threads runs the job inline.
+    for (size_t i = 0; i < submitCount; ++i) {
+        auto job = std::make_shared<BackgroundJob>(this);
+        taskService->SubmitBackground("CommandListPool::BackgroundReset", [job] { job->pool->RunBackgroundResets(*job); });
+    }
+}
+
+void CommandListPool::FinishBackgroundJobLocked() {
+    --m_backgroundJobCount;
+    if (m_backgroundJobCount == 0) {
+        m_backgroundJobsIdleCv.notify_all();
     }
 }
 
-void CommandListPool::BackgroundResetMain() {
-    tracy::SetThreadName("ORG CommandListPool Reset");
+void CommandListPool::RunBackgroundResets(BackgroundJob& job) {
+    job.ran = true;
     std::vector<CommandListPair> local;
 
     for (;;) {
+        size_t createCount = 0;
         {
-            std::unique_lock lock(m_mutex);
-            m_backgroundResetCv.wait(lock, [this] {
-                return m_stopBackgroundReset || !m_pendingBackgroundReset.empty();
-            });
-
-            if (m_stopBackgroundReset && m_pendingBackgroundReset.empty()) {
-                break;
+            std::lock_guard lock(m_mutex);
+            // Leaving under the lock where no work was found means work queued after this point
+            // always schedules a new job.
+            if (m_stopBackgroundReset || (m_pendingBackgroundReset.empty() && m_pendingAheadCreates == 0)) {
+                FinishBackgroundJobLocked();
+                return;
             }
 
+            // Resets first: they return pairs the pool already owns.
             local.clear();
-            local.swap(m_pendingBackgroundReset);
-            m_backgroundResetActiveCount += local.size();
+            const size_t take = std::min(kBackgroundResetChunk, m_pendingBackgroundReset.size());
+            const auto first = m_pendingBackgroundReset.end() - static_cast<std::ptrdiff_t>(take);
+            std::move(first, m_pendingBackgroundReset.end(), std::back_inserter(local));
+            m_pendingBackgroundReset.erase(first, m_pendingBackgroundReset.end());
+            if (take == 0) {
+                createCount = std::min(kBackgroundResetChunk, m_pendingAheadCreates);
+                m_pendingAheadCreates -= createCount;
+            }
+            m_backgroundResetActiveCount += take + createCount;
             UpdateDiagnosticsCountsLocked();
         }
 
-        {
-            ZoneScopedN("CommandListPool::BackgroundResetMain::ResetPairs");
+        const size_t resetCount = local.size();
+        if (resetCount > 0) {
+            ZoneScopedN("CommandListPool::RunBackgroundResets::ResetPairs");
             for (auto& pair : local) {
                 PreparePairForReuse(pair);
             }
         }
+        if (createCount > 0) {
+            ZoneScopedN("CommandListPool::RunBackgroundResets::CreateAhead");
+            for (size_t i = 0; i < createCount; ++i) {
+                local.emplace_back(CreateReadyPair());
+            }
+        }
 
+        DistributeAvailable(local);
         {
             std::lock_guard lock(m_mutex);
-            m_available.reserve(m_available.size() + local.size());
-            for (auto& pair : local) {
-                m_available.emplace_back(std::move(pair));
-            }
-            m_backgroundResetActiveCount -= local.size();
-            m_diagnostics.backgroundResetCompletedThisFrame += local.size();
+            m_backgroundResetActiveCount -= resetCount + createCount;
+            m_diagnostics.backgroundResetCompletedThisFrame += resetCount;
+            m_diagnostics.createdAheadThisFrame += createCount;
             UpdateDiagnosticsCountsLocked();
         }
     }
@@ -1,8 +1,13 @@
 #include "Render/DescriptorHeap.h"
+#include <algorithm>
+#include <functional>
+#include <iterator>
 #include <mutex>
+#include <stdexcept>
+#include <thread>
 
 DescriptorHeap::DescriptorHeap(rhi::Device& device, rhi::DescriptorHeapType type, uint32_t numDescriptors, bool shaderVisible, std::string name)
-    : m_type(type), m_shaderVisible(shaderVisible), m_numDescriptorsAllocated(0) {
+    : m_type(type), m_shaderVisible(shaderVisible), m_name(name), m_numDescriptorsAllocated(0) {
 
 	rhi::DescriptorHeapDesc heapDesc = {.type = type, .capacity = numDescriptors, .shaderVisible = shaderVisible, .debugName = name.c_str()};
     auto result = device.CreateDescriptorHeap(heapDesc, m_heap);
@@ -16,24 +21,249 @@ DescriptorHeap::~DescriptorHeap() {
 }
 
 rhi::DescriptorHeap DescriptorHeap::GetHeap() {
+    std::lock_guard lock(m_allocationMutex); // Grow swaps m_heap under it
     return m_heap.Get();
 }
 
-UINT DescriptorHeap::AllocateDescriptor() {
+UINT DescriptorHeap::GetHighWaterMark() {
     std::lock_guard lock(m_allocationMutex);
-    if (!m_freeIndices.empty()) {
-        UINT freeIndex = m_freeIndices.front();
-        m_freeIndices.pop();
-        return freeIndex;
+    return m_numDescriptorsAllocated;
+}
+
+rhi::DescriptorHeapPtr DescriptorHeap::Grow(rhi::Device& device, uint32_t newCapacity) {
+    std::lock_guard lock(m_allocationMutex);
+    if (newCapacity <= m_totalSize) {
+        throw std::invalid_argument("DescriptorHeap::Grow: new capacity must exceed the current one");
+    }
+
+    rhi::DescriptorHeapDesc heapDesc = {.type = m_type, .capacity = newCapacity, .shaderVisible = m_shaderVisible, .debugName = m_name.c_str()};
+    rhi::DescriptorHeapPtr grown;
+    device.CreateDescriptorHeap(heapDesc, grown);
+    grown->SetName(m_name.c_str());
+    std::swap(m_heap, grown);
+    m_totalSize = newCapacity;
+    return grown;
+}
+
+void DescriptorHeap::EnableViewRecords() {
+    m_viewRecordsEnabled.store(true);
+}
+
+void DescriptorHeap::RecordView(UINT index, rhi::ResourceHandle resource, const ViewDesc& desc) {
+    if (!m_viewRecordsEnabled.load(std::memory_order_relaxed)) {
+        return;
     }
-    else if (m_numDescriptorsAllocated < m_totalSize) {
-        return m_numDescriptorsAllocated++;
+    std::lock_guard lock(m_viewRecordMutex);
+    m_viewRecords.insert_or_assign(index, ViewRecord{ resource, desc });
+}
+
+std::vector<std::pair<UINT, DescriptorHeap::ViewRecord>> DescriptorHeap::SnapshotViewRecords() {
+    std::lock_guard lock(m_viewRecordMutex);
+    return { m_viewRecords.begin(), m_viewRecords.end() };
+}
+
+void DescriptorHeap::ForgetViews(std::span<const UINT> indices) {
+    if (!m_viewRecordsEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard lock(m_viewRecordMutex);
+    for (const UINT index : indices) {
+        m_viewRecords.erase(index);
+    }
+}
+
+void DescriptorHeap::ForgetViewRange(UINT firstIndex, UINT count) {
+    if (!m_viewRecordsEnabled.load(std::memory_order_relaxed)) {
+        return;
+    }
+    std::lock_guard lock(m_viewRecordMutex);
+    for (UINT i = 0; i < count; ++i) {
+        m_viewRecords.erase(firstIndex + i);
+    }
+}
+
+DescriptorHeap::MagazineShard& DescriptorHeap::LocalMagazine() {
+    thread_local const size_t shard = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return m_magazines[shard % kMagazineShardCount];
+}
+
+std::unique_lock<std::mutex> DescriptorHeap::LockMagazine(MagazineShard& magazine) {
+    std::unique_lock lock(magazine.mutex, std::try_to_lock);
+    if (!lock.owns_lock()) {
+        lock.lock();
+        ++magazine.contended;
+    }
+    return lock;
+}
+
+DescriptorHeap::Stats DescriptorHeap::GetStats() const {
+    Stats stats;
+    for (const auto& magazine : m_magazines) {
+        std::lock_guard magazineLock(magazine.mutex);
+        stats.singleAllocations += magazine.allocations;
+        stats.singleReleases += magazine.releases;
+        stats.magazineRefills += magazine.refills;
+        stats.magazineSpills += magazine.spills;
+        stats.magazineLockContended += magazine.contended;
+    }
+    std::lock_guard lock(m_allocationMutex);
+    stats.rangeAllocations = m_rangeAllocations;
+    stats.rangeReleases = m_rangeReleases;
+    stats.magazineDrains = m_magazineDrains;
+    return stats;
+}
+
+UINT DescriptorHeap::AllocateDescriptor() {
+    {
+        auto& magazine = LocalMagazine();
+        auto magazineLock = LockMagazine(magazine);
+        ++magazine.allocations;
+        if (magazine.slots.empty()) {
+            ++magazine.refills;
+            std::lock_guard lock(m_allocationMutex);
+            RefillMagazineUnlocked(magazine.slots);
+        }
+        if (!magazine.slots.empty()) {
+            const UINT index = magazine.slots.back();
+            magazine.slots.pop_back();
+            return index;
+        }
+    }
+    // The central list is dry, but other shards may still be holding slots.
+    return AllocateDescriptorRange(1);
+}
+
+UINT DescriptorHeap::AllocateDescriptorRange(UINT count) {
+    if (count == 0) {
+        throw std::invalid_argument("DescriptorHeap::AllocateDescriptorRange: count must be non-zero");
+    }
+    UINT start = 0;
+    {
+        std::lock_guard lock(m_allocationMutex);
+        ++m_rangeAllocations;
+        if (TryAllocateRangeUnlocked(count, start)) {
+            return start;
+        }
+        ++m_magazineDrains;
+    }
+    DrainMagazines();
+    std::lock_guard lock(m_allocationMutex);
+    if (TryAllocateRangeUnlocked(count, start)) {
+        return start;
     }
     throw std::runtime_error("Out of descriptor heap space!");
 }
 
-void DescriptorHeap::ReleaseDescriptor(UINT index) {
+bool DescriptorHeap::TryAllocateRangeUnlocked(UINT count, UINT& start) {
+    auto bestFit = m_freeRangesBySize.lower_bound(count);
+    if (bestFit != m_freeRangesBySize.end()) {
+        start = bestFit->second;
+        const UINT size = bestFit->first;
+        EraseFreeRangeUnlocked(m_freeRangesByStart.find(start));
+        if (size > count) {
+            m_freeRangesByStart.emplace(start + count, size - count);
+            m_freeRangesBySize.emplace(size - count, start + count);
+        }
+        return true;
+    }
+    if (count <= m_totalSize - m_numDescriptorsAllocated) {
+        start = m_numDescriptorsAllocated;
+        m_numDescriptorsAllocated += count;
+        return true;
+    }
+    return false;
+}
+
+void DescriptorHeap::RefillMagazineUnlocked(std::vector<UINT>& slots) {
+    // Fill the smallest holes first so the large free ranges stay whole for ranged allocations,
+    // then bump from the high-water mark.
+    size_t needed = kMagazineRefillCount;
+    while (needed > 0 && !m_freeRangesBySize.empty()) {
+        const auto smallest = m_freeRangesBySize.begin();
+        const UINT start = smallest->second;
+        const UINT size = smallest->first;
+        const UINT taken = static_cast<UINT>(std::min<size_t>(size, needed));
+        EraseFreeRangeUnlocked(m_freeRangesByStart.find(start));
+        if (size > taken) {
+            m_freeRangesByStart.emplace(start + taken, size - taken);
+            m_freeRangesBySize.emplace(size - taken, start + taken);
+        }
+        for (UINT i = 0; i < taken; ++i) {
+            slots.push_back(start + i);
+        }
+        needed -= taken;
+    }
+    const UINT bumped = static_cast<UINT>(std::min<size_t>(needed, m_totalSize - m_numDescriptorsAllocated));
+    for (UINT i = 0; i < bumped; ++i) {
+        slots.push_back(m_numDescriptorsAllocated + i);
+    }
+    m_numDescriptorsAllocated += bumped;
+    // Hand out low indices first.
+    std::reverse(slots.begin(), slots.end());
+}
+
+void DescriptorHeap::DrainMagazines() {
+    for (auto& magazine : m_magazines) {
+        std::vector<UINT> slots;
+        {
+            std::lock_guard magazineLock(magazine.mutex);
+            slots.swap(magazine.slots);
+        }
+        if (slots.empty()) {
+            continue;
+        }
+        std::sort(slots.begin(), slots.end());
+        std::lock_guard lock(m_allocationMutex);
+        ReleaseSortedUnlocked(slots);
+    }
+}
+
+void DescriptorHeap::ReleaseDescriptorRange(UINT firstIndex, UINT count) {
+    if (count == 0) {
+        return;
+    }
+    ForgetViewRange(firstIndex, count);
     std::lock_guard lock(m_allocationMutex);
+    ++m_rangeReleases;
+    InsertFreeRangeUnlocked(firstIndex, count);
+}
+
+void DescriptorHeap::EraseFreeRangeUnlocked(std::map<UINT, UINT>::iterator byStart) {
+    auto [first, last] = m_freeRangesBySize.equal_range(byStart->second);
+    for (auto it = first; it != last; ++it) {
+        if (it->second == byStart->first) {
+            m_freeRangesBySize.erase(it);
+            break;
+        }
+    }
+    m_freeRangesByStart.erase(byStart);
+}
+
+void DescriptorHeap::InsertFreeRangeUnlocked(UINT start, UINT count) {
+    auto next = m_freeRangesByStart.lower_bound(start);
+    if (next != m_freeRangesByStart.begin()) {
+        auto prev = std::prev(next);
+        if (prev->first + prev->second == start) {
+            start = prev->first;
+            count += prev->second;
+            EraseFreeRangeUnlocked(prev);
+        }
+    }
+    if (next != m_freeRangesByStart.end() && start + count == next->first) {
+        count += next->second;
+        EraseFreeRangeUnlocked(next);
+    }
+
+    // A range that reaches the high-water mark is handed back to it instead.
+    if (start + count == m_numDescriptorsAllocated) {
+        m_numDescriptorsAllocated = start;
+        return;
+    }
+    m_freeRangesByStart.emplace(start, count);
+    m_freeRangesBySize.emplace(count, start);
+}
+
+void DescriptorHeap::ReleaseDescriptor(UINT index) {
 //#if BUILD_TYPE == BUILD_TYPE_DEBUG
 //    if (index == 0) {
 //		spdlog::error("DescriptorHeap::ReleaseDescriptor: Attempting to release descriptor 0");
@@ -44,5 +274,63 @@ void DescriptorHeap::ReleaseDescriptor(UINT index) {
 //	assert(signedValue >= 0 && signedValue < m_totalSize); // If this trggers, a descriptor is likely set but uninitialized
 //#pragma warning(default : 4018)
 //#endif
-    m_freeIndices.push(index);
-}
\ No newline at end of file
+    ForgetViewRange(index, 1);
+    auto& magazine = LocalMagazine();
+    auto magazineLock = LockMagazine(magazine);
+    ++magazine.releases;
+    magazine.slots.push_back(index);
+    if (magazine.slots.size() <= kMagazineCapacity) {
+        return;
+    }
+    ++magazine.spills;
+
+    // Keep the most recently freed slots and spill the oldest back to the central list at once.
+    const auto spillEnd = magazine.slots.end() - kMagazineRefillCount;
+    std::vector<UINT> spilled(magazine.slots.begin(), spillEnd);
+    magazine.slots.erase(magazine.slots.begin(), spillEnd);
+    std::sort(spilled.begin(), spilled.end());
+    std::lock_guard lock(m_allocationMutex);
+    ReleaseSortedUnlocked(spilled);
+}
+
+void DescriptorHeap::ReleaseDescriptors(std::span<const UINT> indices) {
+    if (indices.empty()) {
+        return;
+    }
+    ForgetViews(indices);
+    std::vector<UINT> sorted(indices.begin(), indices.end());
+    std::sort(sorted.begin(), sorted.end());
+    std::lock_guard lock(m_allocationMutex);
+    ++m_rangeReleases;
+    ReleaseSortedUnlocked(sorted);
+}
+
+void DescriptorHeap::ReleaseDescriptorSlots(std::span<const std::pair<std::shared_ptr<DescriptorHeap>, UINT>> slots) {
+    // Resources rarely span more than a couple of heaps, so a linear grouping is enough.
+    std::vector<std::pair<DescriptorHeap*, std::vector<UINT>>> byHeap;
+    for (const auto& [heap, index] : slots) {
+        if (!heap) {
+            continue;
+        }
+        auto it = std::find_if(byHeap.begin(), byHeap.end(), [&](const auto& group) { return group.first == heap.get(); });
+        if (it == byHeap.end()) {
+            it = byHeap.emplace(byHeap.end(), heap.get(), std::vector<UINT>{});
+        }
+        it->second.push_back(index);
+    }
+    for (auto& [heap, indices] : byHeap) {
+        heap->ReleaseDescriptors(indices);
+    }
+}
+
+void DescriptorHeap::ReleaseSortedUnlocked(std::span<const UINT> sortedIndices) {
+    for (size_t i = 0; i < sortedIndices.size();) {
+        const UINT start = sortedIndices[i];
+        UINT count = 1;
+        while (i + count < sortedIndices.size() && sortedIndices[i + count] == start + count) {
+            ++count;
+        }
+        InsertFreeRangeUnlocked(start, count);
+        i += count;
+    }
+}
@@ -0,0 +1,179 @@
+#include "Render/FrameConstantAllocator.h"
+
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Resources/Buffers/Buffer.h"
+
+namespace {
+	constexpr uint64_t AlignUp(uint64_t value, uint64_t alignment) {
+		return (value + alignment - 1) & ~(alignment - 1);
+	}
+}
+
+FrameConstantAllocator::FrameConstantAllocator(uint64_t pageSize)
+	: m_pageSize(AlignUp(std::max(pageSize, kAlignment), kAlignment)) {
+}
+
+FrameConstantAllocator::~FrameConstantAllocator() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& page : m_framePages) {
+		ReleasePage(page);
+	}
+	for (auto& page : m_freePages) {
+		ReleasePage(page);
+	}
+	for (auto& frame : m_retiringFrames) {
+		for (auto& page : frame.pages) {
+			ReleasePage(page);
+		}
+	}
+}
+
+FrameConstantAllocator::Page FrameConstantAllocator::CreatePage(uint64_t size, bool dedicated) {
+	Page page{ .size = size, .dedicated = dedicated };
+	const rhi::HeapType heapType = BufferBase::ResolveCpuWritableHeapType(size);
+	page.buffer = Buffer::CreateUnmaterializedStructuredBuffer(static_cast<uint32_t>(size / sizeof(uint32_t)), sizeof(uint32_t), false, false, false, heapType);
+	page.buffer->SetName(dedicated ? "RG Frame Constants (Dedicated)" : "RG Frame Constants");
+	page.buffer->Materialize();
+
+	// Upload and CPU-visible device-local memory stay mapped for the page's lifetime.
+	void* mapped = nullptr;
+	page.buffer->GetAPIResource().Map(&mapped, 0, size);
+	if (!mapped) {
+		spdlog::error("FrameConstantAllocator: failed to map a {} byte page", size);
+		page.buffer.reset();
+		return page;
+	}
+	page.mapped = static_cast<std::byte*>(mapped);
+	++m_stats.pagesCreated;
+	if (dedicated) {
+		++m_stats.dedicatedPagesCreated;
+	}
+	++m_stats.livePages;
+	m_stats.liveBytes += size;
+	return page;
+}
+
+void FrameConstantAllocator::ReleasePage(Page& page) {
+	if (!page.buffer) {
+		return;
+	}
+	if (page.mapped) {
+		page.buffer->GetAPIResource().Unmap(0, 0);
+	}
+	--m_stats.livePages;
+	m_stats.liveBytes -= page.size;
+	page = {};
+}
+
+FrameConstantAllocation FrameConstantAllocator::Allocate(uint64_t size) {
+	const uint64_t alignedSize = AlignUp(std::max<uint64_t>(size, 1), kAlignment);
+	std::lock_guard<std::mutex> lock(m_mutex);
+
+	Page* target = nullptr;
+	if (alignedSize > m_pageSize) {
+		Page page = CreatePage(alignedSize, true);
+		if (!page.buffer) {
+			return {};
+		}
+		// Keep the current shared page last so later small allocations continue in it.
+		const bool hasCurrent = !m_framePages.empty() && !m_framePages.back().dedicated;
+		auto it = m_framePages.insert(hasCurrent ? std::prev(m_framePages.end()) : m_framePages.end(), std::move(page));
+		target = &*it;
+	}
+	else {
+		if (m_framePages.empty() || m_framePages.back().dedicated || m_framePages.back().size - m_framePages.back().used < alignedSize) {
+			if (!m_freePages.empty()) {
+				m_framePages.push_back(std::move(m_freePages.back()));
+				m_freePages.pop_back();
+			}
+			else {
+				Page page = CreatePage(m_pageSize, false);
+				if (!page.buffer) {
+					return {};
+				}
+				m_framePages.push_back(std::move(page));
+			}
+		}
+		target = &m_framePages.back();
+	}
+
+	FrameConstantAllocation allocation{
+		.cpu = target->mapped + target->used,
+		.buffer = target->buffer.get(),
+		.offset = target->used,
+		.size = size,
+		.pageDescriptorIndex = target->buffer->GetSRVInfo(0).slot.index,
+	};
+	target->used += alignedSize;
+	++m_stats.allocationsLastFrame;
+	m_stats.bytesAllocatedLastFrame += alignedSize;
+	return allocation;
+}
+
+bool FrameConstantAllocator::FencesComplete(const RetiringFrame& frame) {
+	if (!frame.fences) {
+		return true;
+	}
+	for (const auto& point : *frame.fences) {
+		const uint64_t completed = point.timeline.GetCompletedValue();
+		// UINT64_MAX means the device was lost; keep the pages rather than overwrite them in flight.
+		if (completed == UINT64_MAX || completed < point.value) {
+			return false;
+		}
+	}
+	return true;
+}
+
+void FrameConstantAllocator::BeginFrame() {
+	ZoneScopedN("FrameConstantAllocator::BeginFrame");
+	std::lock_guard<std::mutex> lock(m_mutex);
+	// Frames retire in submission order on every queue, so stop at the first one still in flight.
+	while (!m_retiringFrames.empty() && FencesComplete(m_retiringFrames.front())) {
+		for (auto& page : m_retiringFrames.front().pages) {
+			if (page.dedicated) {
+				ReleasePage(page);
+				continue;
+			}
+			page.used = 0;
+			m_freePages.push_back(std::move(page));
+		}
+		m_retiringFrames.pop_front();
+	}
+	m_stats.allocationsLastFrame = 0;
+	m_stats.bytesAllocatedLastFrame = 0;
+}
+
+void FrameConstantAllocator::EndFrame(std::span<const FencePoint> fencesBySlot) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	if (m_latestFencesBySlot.size() < fencesBySlot.size()) {
+		m_latestFencesBySlot.resize(fencesBySlot.size());
+	}
+	for (size_t slot = 0; slot < fencesBySlot.size(); ++slot) {
+		if (fencesBySlot[slot].value != 0) {
+			m_latestFencesBySlot[slot] = fencesBySlot[slot];
+		}
+	}
+	m_stats.pagesUsedLastFrame = m_framePages.size();
+	TracyPlot("RG.FrameConstants.Bytes", static_cast<int64_t>(m_stats.bytesAllocatedLastFrame));
+	if (m_framePages.empty()) {
+		return;
+	}
+
+	auto fences = std::make_shared<std::vector<FencePoint>>();
+	for (const auto& point : m_latestFencesBySlot) {
+		if (point.value != 0) {
+			fences->push_back(point);
+		}
+	}
+	m_retiringFrames.push_back(RetiringFrame{ std::move(m_framePages), std::move(fences) });
+	m_framePages = {};
+}
+
+FrameConstantAllocator::Stats FrameConstantAllocator::GetStats() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	return m_stats;
+}
@@ -2,6 +2,8 @@
 
 #include "Render/ResourceRegistry.h"
 
+#include <variant>
+
 namespace rg::imm {
 
     namespace {
@@ -181,7 +183,7 @@ namespace rg::imm {
 
 	// End of BytecodeReader functions
 
-    void Replay(std::vector<std::byte> const& bytecode, rhi::CommandList& cl, ImmediateDispatch const& dispatch) {
+    void Replay(std::span<const std::byte> bytecode, rhi::CommandList& cl, ImmediateDispatch const& dispatch) {
         BytecodeReader r(bytecode.data(), bytecode.size());
         std::vector<rhi::ResourceHandle> writtenBuffers;
         std::vector<rhi::ResourceHandle> writtenTextures;
@@ -388,23 +390,327 @@ namespace rg::imm {
         }
     }
 
+    namespace {
+
+        struct DecodedOp {
+            Op op{};
+            std::variant<CopyBufferRegionCmd, ClearRTVCmd, ClearDSVCmd, ClearUavFloatCmd, ClearUavUintCmd,
+                CopyTextureRegionCmd, CopyTextureToBufferCmd, CopyBufferToTextureCmd> cmd;
+            bool dead = false;
+        };
+
+        DecodedOp DecodeOp(BytecodeReader& r) {
+            DecodedOp d;
+            d.op = r.ReadOp();
+            switch (d.op) {
+            case Op::CopyBufferRegion: d.cmd = r.ReadPOD<CopyBufferRegionCmd>(); break;
+            case Op::ClearRTV: d.cmd = r.ReadPOD<ClearRTVCmd>(); break;
+            case Op::ClearDSV: d.cmd = r.ReadPOD<ClearDSVCmd>(); break;
+            case Op::ClearUavFloat: d.cmd = r.ReadPOD<ClearUavFloatCmd>(); break;
+            case Op::ClearUavUint: d.cmd = r.ReadPOD<ClearUavUintCmd>(); break;
+            case Op::CopyTextureRegion: d.cmd = r.ReadPOD<CopyTextureRegionCmd>(); break;
+            case Op::CopyTextureToBuffer: d.cmd = r.ReadPOD<CopyTextureToBufferCmd>(); break;
+            case Op::CopyBufferToTexture: d.cmd = r.ReadPOD<CopyBufferToTextureCmd>(); break;
+            default:
+                throw std::runtime_error("Unknown immediate bytecode op");
+            }
+            return d;
+        }
+
+        // Clears of one kind overwrite each other; UAV float and uint clears are the same kind.
+        enum class ClearKind : uint8_t { None, RenderTarget, DepthStencil, UnorderedAccess };
+
+        struct ClearInfo {
+            ClearKind kind = ClearKind::None;
+            ResourceRegistry::RegistryHandle target{};
+            RangeSpec range{};
+            uint8_t aspects = 0; // Depth = 1, stencil = 2; 1 for other kinds
+        };
+
+        ClearInfo GetClearInfo(const DecodedOp& d) {
+            switch (d.op) {
+            case Op::ClearRTV: {
+                const auto& c = std::get<ClearRTVCmd>(d.cmd);
+                return { ClearKind::RenderTarget, c.target, c.range, 1 };
+            }
+            case Op::ClearDSV: {
+                const auto& c = std::get<ClearDSVCmd>(d.cmd);
+                return { ClearKind::DepthStencil, c.target, c.range, static_cast<uint8_t>((c.clearDepth ? 1 : 0) | (c.clearStencil ? 2 : 0)) };
+            }
+            case Op::ClearUavFloat: {
+                const auto& c = std::get<ClearUavFloatCmd>(d.cmd);
+                return { ClearKind::UnorderedAccess, c.target, c.range, 1 };
+            }
+            case Op::ClearUavUint: {
+                const auto& c = std::get<ClearUavUintCmd>(d.cmd);
+                return { ClearKind::UnorderedAccess, c.target, c.range, 1 };
+            }
+            default:
+                return {};
+            }
+        }
+
+        template<class Fn>
+        void ForEachReferencedResource(const DecodedOp& d, Fn&& fn) {
+            std::visit([&](const auto& c) {
+                using T = std::decay_t<decltype(c)>;
+                if constexpr (std::is_same_v<T, CopyBufferRegionCmd>) { fn(c.dst); fn(c.src); }
+                else if constexpr (std::is_same_v<T, CopyTextureRegionCmd>) { fn(c.dstTexture); fn(c.srcTexture); }
+                else if constexpr (std::is_same_v<T, CopyTextureToBufferCmd> || std::is_same_v<T, CopyBufferToTextureCmd>) { fn(c.texture); fn(c.buffer); }
+                else { fn(c.target); }
+            }, d.cmd);
+        }
+
+        template<class Fn>
+        void ForEachWrittenResource(const DecodedOp& d, Fn&& fn) {
+            std::visit([&](const auto& c) {
+                using T = std::decay_t<decltype(c)>;
+                if constexpr (std::is_same_v<T, CopyBufferRegionCmd>) { fn(c.dst); }
+                else if constexpr (std::is_same_v<T, CopyTextureRegionCmd>) { fn(c.dstTexture); }
+                else if constexpr (std::is_same_v<T, CopyTextureToBufferCmd>) { fn(c.buffer); }
+                else if constexpr (std::is_same_v<T, CopyBufferToTextureCmd>) { fn(c.texture); }
+                else { fn(c.target); }
+            }, d.cmd);
+        }
+
+        void EncodeOp(BytecodeWriter& w, const DecodedOp& d) {
+            w.WriteOp(d.op);
+            std::visit([&](const auto& c) { w.WritePOD(c); }, d.cmd);
+        }
+
+    } // anonymous namespace
+
+    BytecodeOptimizationStats OptimizeBytecode(std::vector<std::byte>& bytecode) {
+        BytecodeOptimizationStats stats{};
+        std::vector<DecodedOp> ops;
+        {
+            BytecodeReader r(bytecode.data(), bytecode.size());
+            while (!r.Empty()) {
+                ops.push_back(DecodeOp(r));
+            }
+        }
+        stats.opsBefore = static_cast<uint32_t>(ops.size());
+        if (ops.size() < 2) {
+            return stats;
+        }
+
+        // Walk backwards, tracking per resource which subresources a later clear overwrites with
+        // nothing touching the resource in between. Clears are recorded one subresource each.
+        struct Covered {
+            uint64_t subresource = 0; // (mip << 32) | slice
+            ClearKind kind = ClearKind::None;
+            uint8_t aspects = 0;
+        };
+        std::unordered_map<uint64_t, std::vector<Covered>> covered;
+        for (size_t i = ops.size(); i-- > 0;) {
+            const ClearInfo clear = GetClearInfo(ops[i]);
+            if (clear.kind == ClearKind::None) {
+                ForEachReferencedResource(ops[i], [&](const ResourceRegistry::RegistryHandle& h) {
+                    covered.erase(h.GetGlobalResourceID());
+                });
+                continue;
+            }
+
+            const SubresourceRange sr = ResolveRangeSpec(clear.range, clear.target.GetNumMipLevels(), clear.target.GetArraySize());
+            if (sr.mipCount != 1 || sr.sliceCount != 1) {
+                covered.erase(clear.target.GetGlobalResourceID());
+                continue;
+            }
+            const uint64_t subresource = (uint64_t(sr.firstMip) << 32) | sr.firstSlice;
+            auto& entries = covered[clear.target.GetGlobalResourceID()];
+            auto it = std::find_if(entries.begin(), entries.end(), [&](const Covered& c) { return c.subresource == subresource; });
+            if (it == entries.end()) {
+                entries.push_back({ subresource, clear.kind, clear.aspects });
+            }
+            else if (it->kind == clear.kind && (it->aspects & clear.aspects) == clear.aspects) {
+                ops[i].dead = true;
+                ++stats.clearsDropped;
+            }
+            else if (it->kind == clear.kind) {
+                it->aspects |= clear.aspects;
+            }
+            else {
+                *it = { subresource, clear.kind, clear.aspects };
+            }
+        }
+
+        // Fold each CopyBufferRegion into the live copy right before it when both continue the
+        // same source and destination ranges.
+        DecodedOp* previous = nullptr;
+        for (auto& op : ops) {
+            if (op.dead) {
+                continue;
+            }
+            if (previous && previous->op == Op::CopyBufferRegion && op.op == Op::CopyBufferRegion) {
+                auto& prev = std::get<CopyBufferRegionCmd>(previous->cmd);
+                const auto& cur = std::get<CopyBufferRegionCmd>(op.cmd);
+                if (prev.dst.GetGlobalResourceID() == cur.dst.GetGlobalResourceID()
+                    && prev.src.GetGlobalResourceID() == cur.src.GetGlobalResourceID()
+                    && prev.dst.GetGlobalResourceID() != prev.src.GetGlobalResourceID()
+                    && prev.dstOffset + prev.numBytes == cur.dstOffset
+                    && prev.srcOffset + prev.numBytes == cur.srcOffset) {
+                    prev.numBytes += cur.numBytes;
+                    op.dead = true;
+                    ++stats.copiesMerged;
+                    continue;
+                }
+            }
+            previous = &op;
+        }
+
+        if (stats.Eliminated() == 0) {
+            return stats;
+        }
+        BytecodeWriter w;
+        w.data.reserve(bytecode.size());
+        for (const auto& op : ops) {
+            if (!op.dead) {
+                EncodeOp(w, op);
+            }
+        }
+        bytecode = std::move(w.data);
+        return stats;
+    }
+
+    std::vector<std::span<const std::byte>> SplitIndependentRanges(std::span<const std::byte> bytecode, uint32_t maxRanges, uint32_t minOpsPerRange) {
+        std::vector<std::span<const std::byte>> ranges;
+        if (maxRanges < 2 || minOpsPerRange == 0) {
+            ranges.push_back(bytecode);
+            return ranges;
+        }
+
+        std::vector<DecodedOp> ops;
+        std::vector<size_t> opOffsets;
+        {
+            BytecodeReader r(bytecode.data(), bytecode.size());
+            while (!r.Empty()) {
+                opOffsets.push_back(r.Offset());
+                ops.push_back(DecodeOp(r));
+            }
+        }
+        const size_t opCount = ops.size();
+        const size_t rangeCount = (std::min)(static_cast<size_t>(maxRanges), opCount / minOpsPerRange);
+        if (rangeCount < 2) {
+            ranges.push_back(bytecode);
+            return ranges;
+        }
+
+        // A cut before op i is legal unless some written resource is referenced on both sides.
+        // Span each written resource from its first to its last reference, then mark the
+        // positions inside.
+        struct Span {
+            size_t first = 0;
+            size_t last = 0;
+            bool written = false;
+        };
+        std::unordered_map<uint64_t, Span> spans;
+        for (size_t i = 0; i < opCount; ++i) {
+            ForEachReferencedResource(ops[i], [&](const ResourceRegistry::RegistryHandle& h) {
+                auto [it, inserted] = spans.try_emplace(h.GetGlobalResourceID(), Span{ i, i, false });
+                it->second.last = i;
+            });
+            ForEachWrittenResource(ops[i], [&](const ResourceRegistry::RegistryHandle& h) {
+                spans[h.GetGlobalResourceID()].written = true;
+            });
+        }
+        std::vector<int32_t> open(opCount + 1, 0);
+        for (const auto& [id, span] : spans) {
+            if (span.written && span.first < span.last) {
+                ++open[span.first + 1];
+                --open[span.last + 1];
+            }
+        }
+        std::vector<bool> canCut(opCount, false);
+        int32_t depth = 0;
+        for (size_t i = 0; i < opCount; ++i) {
+            depth += open[i];
+            canCut[i] = i > 0 && depth == 0;
+        }
+
+        // Take the legal cut nearest each even split point, keeping every run at least
+        // minOpsPerRange ops long.
+        size_t begin = 0;
+        for (size_t k = 1; k < rangeCount; ++k) {
+            const size_t target = (opCount * k) / rangeCount;
+            const size_t lo = begin + minOpsPerRange;
+            const size_t hi = opCount - minOpsPerRange;
+            if (lo > hi) {
+                break;
+            }
+            size_t cut = 0;
+            for (size_t d = 0; cut == 0; ++d) {
+                const bool belowInRange = target >= lo + d;
+                const bool aboveInRange = target + d <= hi;
+                if (!belowInRange && !aboveInRange) {
+                    break;
+                }
+                if (belowInRange && target - d <= hi && canCut[target - d]) {
+                    cut = target - d;
+                }
+                else if (aboveInRange && target + d >= lo && canCut[target + d]) {
+                    cut = target + d;
+                }
+            }
+            if (cut == 0) {
+                break;
+            }
+            ranges.push_back(bytecode.subspan(opOffsets[begin], opOffsets[cut] - opOffsets[begin]));
+            begin = cut;
+        }
+        ranges.push_back(bytecode.subspan(opOffsets[begin]));
+        return ranges;
+    }
+
 	// ImmediateCommandList functions
 
     void ImmediateCommandList::Reset() {
         m_writer.Reset();
         m_handles.clear();
         m_access.clear();
+        m_fullOverwrite.clear();
+        m_clearsOverwritten = 0;
         if (m_keepAlive) {
             m_keepAlive->pins.clear();
         }
     }
 
+    void ImmediateCommandList::SetFullOverwriteRanges(std::span<const ResourceHandleAndRange> ranges) {
+        m_fullOverwrite.clear();
+        m_fullOverwrite.reserve(ranges.size());
+        for (const auto& rr : ranges) {
+            const SubresourceRange sr = ResolveRangeSpec(rr.range, rr.resource.GetNumMipLevels(), rr.resource.GetArraySize());
+            if (!sr.isEmpty()) {
+                m_fullOverwrite.push_back(FullOverwriteRange{ rr.resource.GetGlobalResourceID(), sr });
+            }
+        }
+    }
+
+    bool ImmediateCommandList::IsFullyOverwritten(uint64_t rid, uint32_t mip, uint32_t slice) const noexcept {
+        const SubresourceRange subresource{ mip, 1, slice, 1 };
+        for (const auto& entry : m_fullOverwrite) {
+            if (entry.rid == rid && RangeContains(entry.range, subresource)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    BytecodeOptimizationStats ImmediateCommandList::OptimizeRecordedStream() {
+        BytecodeOptimizationStats stats = m_optimizeBytecode ? OptimizeBytecode(m_writer.data) : BytecodeOptimizationStats{};
+        stats.clearsOverwritten = m_clearsOverwritten;
+        return stats;
+    }
+
     FrameData ImmediateCommandList::Finalize() {
-        FrameData out;
         if (!HasRecordedWork()) {
-            return out;
+            return {};
         }
+        return FinalizeOptimized(OptimizeRecordedStream());
+    }
 
+    FrameData ImmediateCommandList::FinalizeOptimized(const BytecodeOptimizationStats& optimization) {
+        FrameData out;
+        out.optimization = optimization;
         out.bytecode = std::move(m_writer.data);
         if (m_keepAlive && !m_keepAlive->pins.empty()) {
             out.keepAlive = std::move(m_keepAlive);
@@ -488,6 +794,7 @@ namespace rg::imm {
             {
                 ResourceRequirement rr{ itH->second };
                 rr.resourceHandleAndRange.range = RectToRangeSpec(r, acc.totalMips, acc.totalSlices);
+                rr.RefreshResolvedRange();
                 rr.state = acc.state;
                 out.requirements.push_back(rr);
             }
@@ -496,6 +803,28 @@ namespace rg::imm {
         return out;
     }
 
+    FrameData ImmediateCommandList::Finalize(std::span<const std::byte> previousBytecode, std::span<const ResourceRequirement> previousRequirements) {
+        if (!HasRecordedWork()) {
+            return {};
+        }
+        // Compare optimized streams, as that is what was cached
+        const BytecodeOptimizationStats optimization = OptimizeRecordedStream();
+        if (previousBytecode.size() != m_writer.data.size()
+            || !std::equal(previousBytecode.begin(), previousBytecode.end(), m_writer.data.begin())) {
+            return FinalizeOptimized(optimization);
+        }
+
+        FrameData out;
+        out.optimization = optimization;
+        out.bytecode = std::move(m_writer.data);
+        if (m_keepAlive && !m_keepAlive->pins.empty()) {
+            out.keepAlive = std::move(m_keepAlive);
+        }
+        out.requirements.assign(previousRequirements.begin(), previousRequirements.end());
+        out.requirementsReused = true;
+        return out;
+    }
+
     ImmediateCommandList::Resolved ImmediateCommandList::Resolve(ResourceIdentifier const& id) {
         if (!m_resolveByIdFn) throw std::runtime_error("ImmediateCommandList has no ResolveByIdFn");
         const auto handle = m_resolveByIdFn(m_resolveUser, id, /*allowFailure=*/false);
@@ -629,8 +958,8 @@ namespace rg::imm {
         cv.rgba[2] = b;
         cv.rgba[3] = a;
 
-        const bool any = ForEachMipSlice(target.handle, range,
-            [&](uint32_t /*mip*/, uint32_t /*slice*/, const RangeSpec& exact)
+        RecordClear(target, range, rhi::ResourceAccessType::RenderTargetClear,
+            [&](const RangeSpec& exact)
             {
                 ClearRTVCmd cmd{};
                 cmd.target = target.handle;
@@ -640,10 +969,6 @@ namespace rg::imm {
                 m_writer.WriteOp(Op::ClearRTV);
                 m_writer.WritePOD(cmd);
             });
-
-        if (any) {
-            Track(target.handle, target.handle.GetGlobalResourceID(), range, rhi::ResourceAccessType::RenderTargetClear);
-        }
     }
 
     void ImmediateCommandList::ClearDSV(Resolved const& target,
@@ -659,8 +984,8 @@ namespace rg::imm {
             throw std::runtime_error("ImmediateDispatch::GetDSV not set");
         }
 
-        const bool any = ForEachMipSlice(target.handle, range,
-            [&](uint32_t /*mip*/, uint32_t /*slice*/, const RangeSpec& exact)
+        RecordClear(target, range, rhi::ResourceAccessType::DepthStencilClear,
+            [&](const RangeSpec& exact)
             {
                 ClearDSVCmd cmd{};
                 cmd.target = target.handle;
@@ -673,10 +998,6 @@ namespace rg::imm {
                 m_writer.WriteOp(Op::ClearDSV);
                 m_writer.WritePOD(cmd);
             });
-
-        if (any) {
-            Track(target.handle, target.handle.GetGlobalResourceID(), range, rhi::ResourceAccessType::DepthStencilClear);
-        }
     }
 
     void ImmediateCommandList::ClearUavFloat(Resolved const& target, const float x, const float y, const float z, const float w, const RangeSpec& range)
@@ -684,8 +1005,8 @@ namespace rg::imm {
         rhi::UavClearFloat value{};
         value.v[0] = x; value.v[1] = y; value.v[2] = z; value.v[3] = w;
 
-        const bool any = ForEachMipSlice(target.handle, range,
-            [&](uint32_t /*mip*/, uint32_t /*slice*/, const RangeSpec& exact)
+        RecordClear(target, range, rhi::ResourceAccessType::UnorderedAccessClear,
+            [&](const RangeSpec& exact)
             {
                 ClearUavFloatCmd cmd{};
                 cmd.target = target.handle;
@@ -695,9 +1016,6 @@ namespace rg::imm {
                 m_writer.WriteOp(Op::ClearUavFloat);
                 m_writer.WritePOD(cmd);
             });
-
-        if (any)
-            Track(target.handle, target.handle.GetGlobalResourceID(), range, rhi::ResourceAccessType::UnorderedAccessClear);
     }
 
     void ImmediateCommandList::ClearUavUint(Resolved const& target, const uint32_t x, const uint32_t y, const uint32_t z, const uint32_t w, const RangeSpec& range)
@@ -705,8 +1023,8 @@ namespace rg::imm {
         rhi::UavClearUint value{};
         value.v[0] = x; value.v[1] = y; value.v[2] = z; value.v[3] = w;
 
-        const bool any = ForEachMipSlice(target.handle, range,
-            [&](uint32_t /*mip*/, uint32_t /*slice*/, const RangeSpec& exact)
+        RecordClear(target, range, rhi::ResourceAccessType::UnorderedAccessClear,
+            [&](const RangeSpec& exact)
             {
                 ClearUavUintCmd cmd{};
                 cmd.target = target.handle;
@@ -716,9 +1034,6 @@ namespace rg::imm {
                 m_writer.WriteOp(Op::ClearUavUint);
                 m_writer.WritePOD(cmd);
             });
-
-        if (any)
-            Track(target.handle, target.handle.GetGlobalResourceID(), range, rhi::ResourceAccessType::UnorderedAccessClear);
     }
 
     void ImmediateCommandList::CopyTextureRegion(
@@ -1,7 +1,57 @@
 #include "Render/MemoryIntrospectionAPI.h"
 
+#include <algorithm>
+
 namespace rg::memory {
 
+void AddToAggregates(MemoryAggregates& aggregates, const ResourceMemoryRecord& record) {
+    auto add = [&](MemoryTotals& totals) {
+        totals.bytes += record.bytes;
+        ++totals.records;
+    };
+    add(aggregates.total);
+    add(aggregates.byResourceType[record.resourceType]);
+    add(aggregates.byUsage[record.usage]);
+    if (record.aliasingPoolID) {
+        add(aggregates.byAliasingPool[*record.aliasingPoolID]);
+    }
+}
+
+void RemoveFromAggregates(MemoryAggregates& aggregates, const ResourceMemoryRecord& record) {
+    auto remove = [&](MemoryTotals& totals) {
+        totals.bytes -= std::min(totals.bytes, record.bytes);
+        totals.records -= std::min<uint64_t>(totals.records, 1);
+        return totals.records == 0;
+    };
+    remove(aggregates.total);
+    if (auto it = aggregates.byResourceType.find(record.resourceType); it != aggregates.byResourceType.end() && remove(it->second)) {
+        aggregates.byResourceType.erase(it);
+    }
+    if (auto it = aggregates.byUsage.find(record.usage); it != aggregates.byUsage.end() && remove(it->second)) {
+        aggregates.byUsage.erase(it);
+    }
+    if (record.aliasingPoolID) {
+        if (auto it = aggregates.byAliasingPool.find(*record.aliasingPoolID); it != aggregates.byAliasingPool.end() && remove(it->second)) {
+            aggregates.byAliasingPool.erase(it);
+        }
+    }
+}
+
+void IMemorySnapshotProvider::BuildAggregates(MemoryAggregates& out) {
+    std::vector<ResourceMemoryRecord> records;
+    BuildSnapshot(records);
+    out = {};
+    for (const auto& record : records) {
+        AddToAggregates(out, record);
+    }
+}
+
+MemoryTotals IMemorySnapshotProvider::GetTotals() {
+    MemoryAggregates aggregates;
+    BuildAggregates(aggregates);
+    return aggregates.total;
+}
+
 void SnapshotProvider::SetProvider(std::shared_ptr<IMemorySnapshotProvider> provider) {
     std::scoped_lock lock(m_providerMutex);
     m_provider = std::move(provider);
@@ -27,4 +77,47 @@ void SnapshotProvider::BuildSnapshot(std::vector<ResourceMemoryRecord>& out) con
     localProvider->BuildSnapshot(out);
 }
 
+void SnapshotProvider::BuildSnapshotDelta(uint64_t sinceGeneration, MemorySnapshotDelta& out) const {
+    std::shared_ptr<IMemorySnapshotProvider> localProvider;
+    {
+        std::scoped_lock lock(m_providerMutex);
+        localProvider = m_provider;
+    }
+
+    if (!localProvider) {
+        out.generation = 0;
+        out.full = true;
+        out.upserted.clear();
+        out.removedRecordIDs.clear();
+        return;
+    }
+
+    localProvider->BuildSnapshotDelta(sinceGeneration, out);
+}
+
+void SnapshotProvider::BuildAggregates(MemoryAggregates& out) const {
+    std::shared_ptr<IMemorySnapshotProvider> localProvider;
+    {
+        std::scoped_lock lock(m_providerMutex);
+        localProvider = m_provider;
+    }
+
+    if (!localProvider) {
+        out = {};
+        return;
+    }
+
+    localProvider->BuildAggregates(out);
+}
+
+MemoryTotals SnapshotProvider::GetTotals() const {
+    std::shared_ptr<IMemorySnapshotProvider> localProvider;
+    {
+        std::scoped_lock lock(m_providerMutex);
+        localProvider = m_provider;
+    }
+
+    return localProvider ? localProvider->GetTotals() : MemoryTotals{};
+}
+
 }
@@ -1,5 +1,11 @@
 #include "Render/MemoryIntrospectionBackend.h"
 
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
 #include "Render/MemoryIntrospectionAPI.h"
 #include "Managers/Singletons/ECSManager.h"
 #include "Resources/MemoryStatisticsComponents.h"
@@ -8,42 +14,186 @@
 namespace rg::memory {
 
 namespace {
+// Keeps one record per tracked-allocation entity, refreshed from observers on the memory
+// statistics components, so a delta only touches the entities that changed since it was asked.
+// Aggregates are adjusted by each record's old and new version as it changes, so reading them
+// costs the changes since the last read rather than a walk over every entity.
 class ECSMemorySnapshotProvider final : public IMemorySnapshotProvider {
 public:
     explicit ECSMemorySnapshotProvider(flecs::world& world)
-        : m_memoryQuery(world.query_builder<const MemoryStatisticsComponents::MemSizeBytes>().build()) {
+        : m_world(world)
+        , m_memoryQuery(world.query_builder<const MemoryStatisticsComponents::MemSizeBytes>().build()) {
+        auto markDirty = [this](flecs::entity e) {
+            std::scoped_lock lock(m_mutex);
+            m_dirty.insert(e.id());
+        };
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::MemSizeBytes>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const MemoryStatisticsComponents::MemSizeBytes&) { markDirty(e); }));
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::ResourceID>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const MemoryStatisticsComponents::ResourceID&) { markDirty(e); }));
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::ResourceType>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const MemoryStatisticsComponents::ResourceType&) { markDirty(e); }));
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::ResourceName>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const MemoryStatisticsComponents::ResourceName&) { markDirty(e); }));
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::ResourceUsage>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const MemoryStatisticsComponents::ResourceUsage&) { markDirty(e); }));
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::AliasingPool>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const MemoryStatisticsComponents::AliasingPool&) { markDirty(e); }));
+        m_observers.push_back(world.observer<const ResourceIdentifier>()
+            .event(flecs::OnSet).each([markDirty](flecs::entity e, const ResourceIdentifier&) { markDirty(e); }));
+        // Fires before the component goes away, including when the entity is deleted.
+        m_observers.push_back(world.observer<const MemoryStatisticsComponents::MemSizeBytes>()
+            .event(flecs::OnRemove).each([this](flecs::entity e, const MemoryStatisticsComponents::MemSizeBytes&) {
+                std::scoped_lock lock(m_mutex);
+                m_dirty.erase(e.id());
+                m_removed.insert(e.id());
+            }));
+
+        std::scoped_lock lock(m_mutex);
+        m_memoryQuery.each([&](flecs::entity e, const MemoryStatisticsComponents::MemSizeBytes&) {
+            m_dirty.insert(e.id());
+        });
+    }
+
+    ~ECSMemorySnapshotProvider() override {
+        for (auto& observer : m_observers) {
+            observer.destruct();
+        }
     }
 
     void BuildSnapshot(std::vector<ResourceMemoryRecord>& out) override {
+        std::scoped_lock lock(m_mutex);
+        ApplyPendingLocked();
         out.clear();
-        out.reserve(2048);
-
-        m_memoryQuery.each([&](flecs::entity e, const MemoryStatisticsComponents::MemSizeBytes& sz) {
-            ResourceMemoryRecord row;
-            row.bytes = sz.size;
+        out.reserve(m_records.size());
+        for (const auto& [entity, entry] : m_records) {
+            (void)entity;
+            out.push_back(entry.record);
+        }
+    }
 
-            if (auto rid = e.try_get<MemoryStatisticsComponents::ResourceID>()) {
-                row.resourceID = rid->id;
+    void BuildSnapshotDelta(uint64_t sinceGeneration, MemorySnapshotDelta& out) override {
+        std::scoped_lock lock(m_mutex);
+        ApplyPendingLocked();
+        out.generation = m_generation;
+        out.upserted.clear();
+        out.removedRecordIDs.clear();
+        // Generation 0 never names a state a caller holds; the tombstone floor marks how far back
+        // removals are still known.
+        out.full = sinceGeneration == 0 || sinceGeneration < m_tombstoneFloorGeneration || sinceGeneration > m_generation;
+        for (const auto& [entity, entry] : m_records) {
+            (void)entity;
+            if (out.full || entry.changedGeneration > sinceGeneration) {
+                out.upserted.push_back(entry.record);
             }
-            if (auto rt = e.try_get<MemoryStatisticsComponents::ResourceType>()) {
-                row.resourceType = rt->type;
+        }
+        if (!out.full) {
+            for (auto it = m_tombstones.rbegin(); it != m_tombstones.rend() && it->generation > sinceGeneration; ++it) {
+                out.removedRecordIDs.push_back(it->recordID);
             }
-            if (auto rn = e.try_get<MemoryStatisticsComponents::ResourceName>()) {
-                row.resourceName = rn->name;
+        }
+    }
+
+    void BuildAggregates(MemoryAggregates& out) override {
+        std::scoped_lock lock(m_mutex);
+        ApplyPendingLocked();
+        out = m_aggregates;
+        out.generation = m_generation;
+    }
+
+    MemoryTotals GetTotals() override {
+        std::scoped_lock lock(m_mutex);
+        ApplyPendingLocked();
+        return m_aggregates.total;
+    }
+
+private:
+    struct Entry {
+        ResourceMemoryRecord record;
+        uint64_t changedGeneration = 0;
+    };
+
+    struct Tombstone {
+        uint64_t recordID = 0;
+        uint64_t generation = 0;
+    };
+
+    static constexpr size_t kMaxTombstones = 16384;
+
+    void ReadRecord(flecs::entity e, ResourceMemoryRecord& row) const {
+        row = {};
+        row.recordID = e.id();
+        if (auto sz = e.try_get<MemoryStatisticsComponents::MemSizeBytes>()) {
+            row.bytes = sz->size;
+        }
+        if (auto rid = e.try_get<MemoryStatisticsComponents::ResourceID>()) {
+            row.resourceID = rid->id;
+        }
+        if (auto rt = e.try_get<MemoryStatisticsComponents::ResourceType>()) {
+            row.resourceType = rt->type;
+        }
+        if (auto rn = e.try_get<MemoryStatisticsComponents::ResourceName>()) {
+            row.resourceName = rn->name;
+        }
+        if (auto usage = e.try_get<MemoryStatisticsComponents::ResourceUsage>()) {
+            row.usage = usage->usage;
+        }
+        if (auto ident = e.try_get<ResourceIdentifier>()) {
+            row.identifier = ident->name;
+        }
+        if (auto pool = e.try_get<MemoryStatisticsComponents::AliasingPool>()) {
+            row.aliasingPoolID = pool->poolID;
+        }
+    }
+
+    void ApplyPendingLocked() {
+        if (m_dirty.empty() && m_removed.empty()) {
+            return;
+        }
+        const uint64_t generation = ++m_generation;
+        for (flecs::entity_t id : m_removed) {
+            auto it = m_records.find(id);
+            if (it != m_records.end()) {
+                RemoveFromAggregates(m_aggregates, it->second.record);
+                m_records.erase(it);
+                m_tombstones.push_back(Tombstone{ id, generation });
             }
-            if (auto usage = e.try_get<MemoryStatisticsComponents::ResourceUsage>()) {
-                row.usage = usage->usage;
+        }
+        m_removed.clear();
+        while (m_tombstones.size() > kMaxTombstones) {
+            m_tombstoneFloorGeneration = m_tombstones.front().generation;
+            m_tombstones.pop_front();
+        }
+
+        for (flecs::entity_t id : m_dirty) {
+            flecs::entity e(m_world, id);
+            if (!e.is_alive() || !e.has<MemoryStatisticsComponents::MemSizeBytes>()) {
+                continue;
             }
-            if (auto ident = e.try_get<ResourceIdentifier>()) {
-                row.identifier = ident->name;
+            auto [it, inserted] = m_records.try_emplace(id);
+            auto& entry = it->second;
+            if (!inserted) {
+                RemoveFromAggregates(m_aggregates, entry.record);
             }
-
-            out.push_back(std::move(row));
-            });
+            ReadRecord(e, entry.record);
+            AddToAggregates(m_aggregates, entry.record);
+            entry.changedGeneration = generation;
+        }
+        m_dirty.clear();
     }
 
-private:
+    flecs::world& m_world;
     flecs::query<const MemoryStatisticsComponents::MemSizeBytes> m_memoryQuery;
+    std::vector<flecs::observer> m_observers;
+
+    std::mutex m_mutex; // Observers fire from whichever thread writes the components
+    std::unordered_set<flecs::entity_t> m_dirty;
+    std::unordered_set<flecs::entity_t> m_removed;
+    std::unordered_map<flecs::entity_t, Entry> m_records;
+    MemoryAggregates m_aggregates;
+    std::deque<Tombstone> m_tombstones; // Oldest first
+    uint64_t m_generation = 1;
+    uint64_t m_tombstoneFloorGeneration = 0;
 };
 }
 
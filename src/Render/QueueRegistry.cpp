@@ -1,5 +1,6 @@
 #include "Render/QueueRegistry.h"
 #include "Render/CommandListPool.h"
+#include "Render/Runtime/OpenRenderGraphSettings.h"
 
 #include <string>
 
@@ -14,8 +15,25 @@ namespace {
 	}
 }
 
+std::unique_ptr<CommandListPool> QueueRegistry::CreatePool(rhi::Device& device, QueueKind kind) const {
+	return std::make_unique<CommandListPool>(
+		device,
+		static_cast<rhi::QueueKind>(kind),
+		rg::runtime::GetOpenRenderGraphSettings().commandListPoolResetWorkerCount,
+		m_taskService);
+}
+
+void QueueRegistry::SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService) {
+	m_taskService = std::move(taskService);
+	for (auto& slot : m_slots) {
+		if (slot.pool) {
+			slot.pool->SetTaskService(m_taskService);
+		}
+	}
+}
+
 QueueSlotIndex QueueRegistry::Register(QueueSlot slot, rhi::Queue queue, rhi::Device& device, QueueAutoAssignmentPolicy autoAssignmentPolicy, bool ownsQueue) {
-	auto pool = std::make_unique<CommandListPool>(device, static_cast<rhi::QueueKind>(slot.kind));
+	auto pool = CreatePool(device, slot.kind);
 	rhi::TimelinePtr fence;
 	device.CreateTimeline(fence);
 	return Register(slot, queue, std::move(fence), std::move(pool), autoAssignmentPolicy, ownsQueue, ownsQueue ? device : rhi::Device{});
@@ -44,6 +62,35 @@ QueueSlotIndex QueueRegistry::FindSlot(QueueSlot slot) const {
 	return static_cast<QueueSlotIndex>(0xFF);
 }
 
+QueueSlotIndex QueueRegistry::FindSlotOnAdapter(QueueKind kind, AdapterIndex adapter) const {
+	for (size_t i = 0; i < m_slots.size(); ++i) {
+		if (m_slots[i].kind == kind && m_slots[i].adapter == adapter)
+			return static_cast<QueueSlotIndex>(static_cast<uint8_t>(i));
+	}
+	return static_cast<QueueSlotIndex>(0xFF);
+}
+
+bool QueueRegistry::HasSecondaryAdapterSlots() const noexcept {
+	for (auto& s : m_slots) {
+		if (s.adapter != kPrimaryAdapter) return true;
+	}
+	return false;
+}
+
+void QueueRegistry::SetPeerFence(QueueSlotIndex i, AdapterIndex adapter, rhi::TimelinePtr fence) {
+	auto& entry = m_slots[ToUnderlying(i)];
+	if (entry.peerFences.size() <= adapter) {
+		entry.peerFences.resize(static_cast<size_t>(adapter) + 1);
+	}
+	entry.peerFences[adapter] = std::move(fence);
+}
+
+bool QueueRegistry::HasWaitFence(QueueSlotIndex i, AdapterIndex waitingAdapter) const noexcept {
+	auto& entry = m_slots[ToUnderlying(i)];
+	if (entry.adapter == waitingAdapter) return true;
+	return waitingAdapter < entry.peerFences.size() && entry.peerFences[waitingAdapter];
+}
+
 bool QueueRegistry::HasSlot(QueueSlot slot) const {
 	for (auto& s : m_slots) {
 		if (s.kind == slot.kind && s.instance == slot.instance) return true;
@@ -53,13 +100,16 @@ bool QueueRegistry::HasSlot(QueueSlot slot) const {
 
 QueueSlotIndex QueueRegistry::FindGraphicsSlot() const noexcept {
 	for (size_t i = 0; i < m_slots.size(); ++i) {
-		if (m_slots[i].kind == QueueKind::Graphics)
+		if (m_slots[i].kind == QueueKind::Graphics && m_slots[i].adapter == kPrimaryAdapter)
 			return static_cast<QueueSlotIndex>(static_cast<uint8_t>(i));
 	}
 	return static_cast<QueueSlotIndex>(0);
 }
 
 void QueueRegistry::Clear() {
+	for (auto& slot : m_slots) {
+		slot.peerFences.clear(); // Opened on other adapters' devices, which may own the queues below
+	}
 	for (auto& slot : m_slots) {
 		if (slot.ownsQueue && slot.device && slot.queue) {
 			slot.device.DestroyQueue(slot.queue.GetQueueHandle());
@@ -0,0 +1,209 @@
+#include "Render/RenderGraph/Aliasing/AliasPoolArbiter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include <spdlog/spdlog.h>
+
+#include "Managers/Singletons/DeletionManager.h"
+#include "Managers/Singletons/DeviceManager.h"
+#include "Resources/MemoryStatisticsComponents.h"
+
+namespace rg::alias {
+
+AliasPoolArbiter::~AliasPoolArbiter() {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto& retired : m_retiredHeaps) {
+		DeletionManager::GetInstance().MarkForDelete(std::move(retired.allocation));
+	}
+	for (auto& [poolID, heap] : m_heapsByPoolID) {
+		(void)poolID;
+		if (heap.allocation) {
+			DeletionManager::GetInstance().MarkForDelete(std::move(heap.allocation));
+		}
+	}
+}
+
+AliasPoolArbiter::Lease AliasPoolArbiter::AcquirePool(const void* owner, uint64_t poolID, uint64_t requiredBytes, uint64_t alignment, float growthHeadroom) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Heap& heap = m_heapsByPoolID[poolID];
+	heap.requiredBytesByOwner[owner] = requiredBytes;
+
+	const bool needsInitialAllocation = !static_cast<bool>(heap.allocation);
+	if (needsInitialAllocation || requiredBytes > heap.capacityBytes || alignment > heap.alignment) {
+		uint64_t newCapacity = requiredBytes;
+		if (!needsInitialAllocation && requiredBytes > heap.capacityBytes) {
+			const double grownTarget = static_cast<double>(heap.capacityBytes) * static_cast<double>(std::max(1.0f, growthHeadroom));
+			newCapacity = std::max(newCapacity, static_cast<uint64_t>(std::ceil(grownTarget)));
+		}
+		// Another owner may need more than this one, so never shrink while replacing.
+		newCapacity = std::max(newCapacity, heap.capacityBytes);
+		const uint64_t newAlignment = std::max(alignment, heap.alignment);
+
+		rhi::ma::AllocationDesc allocDesc{};
+		allocDesc.heapType = rhi::HeapType::DeviceLocal;
+		allocDesc.flags = rhi::ma::AllocationFlagCanAlias;
+
+		rhi::ResourceAllocationInfo allocInfo{};
+		allocInfo.offset = 0;
+		allocInfo.alignment = newAlignment;
+		allocInfo.sizeInBytes = newCapacity;
+
+		TrackedHandle newHeap;
+		AllocationTrackDesc trackDesc(0);
+		trackDesc.attach
+			.Set<MemoryStatisticsComponents::ResourceName>({ "RenderGraph Shared Alias Pool" })
+			.Set<MemoryStatisticsComponents::ResourceType>({ rhi::ResourceType::Unknown })
+			.Set<MemoryStatisticsComponents::ResourceUsage>({ "RenderGraph alias pools" })
+			.Set<MemoryStatisticsComponents::AliasingPool>({ poolID });
+
+		const auto allocResult = DeviceManager::GetInstance().AllocateMemoryTracked(allocDesc, allocInfo, newHeap, trackDesc);
+		if (!rhi::IsOk(allocResult)) {
+			throw std::runtime_error("Failed to allocate shared alias pool memory");
+		}
+
+		if (heap.allocation) {
+			m_retiredHeaps.push_back(RetiredHeap{ poolID, heap.generation, std::move(heap.allocation) });
+			++m_stats.heapReallocations;
+		}
+		heap.allocation = std::move(newHeap);
+		heap.capacityBytes = newCapacity;
+		heap.alignment = newAlignment;
+		heap.generation = ++m_generationSerial;
+		spdlog::debug("RG shared alias pool: pool={} capacity={} alignment={} generation={}", poolID, newCapacity, newAlignment, heap.generation);
+	}
+
+	heap.generationByOwner[owner] = heap.generation;
+	ReleaseRetiredHeapsLocked();
+	return Lease{
+		.allocation = heap.allocation.GetAllocation(),
+		.capacityBytes = heap.capacityBytes,
+		.alignment = heap.alignment,
+		.generation = heap.generation,
+	};
+}
+
+void AliasPoolArbiter::ReleasePool(const void* owner, uint64_t poolID) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	auto it = m_heapsByPoolID.find(poolID);
+	if (it == m_heapsByPoolID.end()) {
+		return;
+	}
+	Heap& heap = it->second;
+	heap.requiredBytesByOwner.erase(owner);
+	heap.generationByOwner.erase(owner);
+	if (heap.generationByOwner.empty()) {
+		if (heap.allocation) {
+			DeletionManager::GetInstance().MarkForDelete(std::move(heap.allocation));
+		}
+		m_heapsByPoolID.erase(it);
+	}
+	ReleaseRetiredHeapsLocked();
+}
+
+void AliasPoolArbiter::ReleaseOwner(const void* owner) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	for (auto it = m_heapsByPoolID.begin(); it != m_heapsByPoolID.end(); ) {
+		Heap& heap = it->second;
+		heap.requiredBytesByOwner.erase(owner);
+		heap.generationByOwner.erase(owner);
+		if (heap.lastExecutor == owner) {
+			// Its last frame may still be in flight; later owners keep waiting for it.
+			heap.lastExecutor = nullptr;
+		}
+		if (!heap.generationByOwner.empty()) {
+			++it;
+			continue;
+		}
+		if (heap.allocation) {
+			DeletionManager::GetInstance().MarkForDelete(std::move(heap.allocation));
+		}
+		it = m_heapsByPoolID.erase(it);
+	}
+	ReleaseRetiredHeapsLocked();
+}
+
+void AliasPoolArbiter::ReleaseRetiredHeapsLocked() {
+	// A replaced heap goes to the deletion manager, which holds it until the GPU has retired the
+	// frames that used it, once no owner is still on its generation.
+	std::erase_if(m_retiredHeaps, [&](RetiredHeap& retired) {
+		auto it = m_heapsByPoolID.find(retired.poolID);
+		if (it != m_heapsByPoolID.end()) {
+			for (const auto& [owner, generation] : it->second.generationByOwner) {
+				(void)owner;
+				if (generation <= retired.generation) {
+					return false;
+				}
+			}
+		}
+		DeletionManager::GetInstance().MarkForDelete(std::move(retired.allocation));
+		return true;
+	});
+}
+
+std::vector<AliasPoolArbiter::FencePoint> AliasPoolArbiter::BeginExecute(const void* owner) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::vector<FencePoint> fences;
+	for (const auto& [poolID, heap] : m_heapsByPoolID) {
+		(void)poolID;
+		if (heap.lastExecutorFences.empty() || heap.lastExecutor == owner || !heap.generationByOwner.contains(owner)) {
+			continue;
+		}
+		for (const auto& point : heap.lastExecutorFences) {
+			const auto handle = point.timeline.GetHandle();
+			auto existing = std::find_if(fences.begin(), fences.end(), [&](const FencePoint& f) {
+				const auto other = f.timeline.GetHandle();
+				return other.index == handle.index && other.generation == handle.generation;
+			});
+			if (existing == fences.end()) {
+				fences.push_back(point);
+			}
+			else {
+				existing->value = std::max(existing->value, point.value);
+			}
+		}
+	}
+	m_stats.crossGraphWaits += fences.size();
+	return fences;
+}
+
+void AliasPoolArbiter::EndExecute(const void* owner, std::span<const FencePoint> fencesBySlot) {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	std::vector<FencePoint> fences;
+	for (const auto& point : fencesBySlot) {
+		if (point.value != 0) {
+			fences.push_back(point);
+		}
+	}
+	if (fences.empty()) {
+		return;
+	}
+	for (auto& [poolID, heap] : m_heapsByPoolID) {
+		(void)poolID;
+		if (!heap.generationByOwner.contains(owner)) {
+			continue;
+		}
+		heap.lastExecutor = owner;
+		heap.lastExecutorFences = fences;
+	}
+}
+
+AliasPoolArbiter::Stats AliasPoolArbiter::GetStats() const {
+	std::lock_guard<std::mutex> lock(m_mutex);
+	Stats stats = m_stats;
+	stats.sharedHeapCount = m_heapsByPoolID.size();
+	stats.sharedHeapBytes = 0;
+	stats.requestedBytes = 0;
+	for (const auto& [poolID, heap] : m_heapsByPoolID) {
+		(void)poolID;
+		stats.sharedHeapBytes += heap.capacityBytes;
+		for (const auto& [owner, bytes] : heap.requiredBytesByOwner) {
+			(void)owner;
+			stats.requestedBytes += bytes;
+		}
+	}
+	return stats;
+}
+
+} // namespace rg::alias
@@ -0,0 +1,679 @@
+#include "Render/RenderGraph/Aliasing/RenderGraphAliasPacking.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <unordered_set>
+
+#include "Render/RenderGraph/RenderGraph.h"
+
+namespace rg::alias {
+
+namespace {
+	uint64_t AlignUpU64(uint64_t value, uint64_t alignment) {
+		if (alignment == 0) {
+			return value;
+		}
+		return (value + alignment - 1ull) / alignment * alignment;
+	}
+
+	struct ActiveAllocation {
+		size_t lastUse = 0;
+		uint64_t startByte = 0;
+		uint64_t endByte = 0;
+
+		bool operator>(const ActiveAllocation& rhs) const {
+			return lastUse > rhs.lastUse;
+		}
+	};
+
+	struct FreeRange {
+		uint64_t startByte = 0;
+		uint64_t endByte = 0;
+	};
+
+	using Placement = AliasPackingPlacement;
+
+	void InsertFreeRangeSortedMerged(std::vector<FreeRange>& ranges, FreeRange range) {
+		if (range.endByte <= range.startByte) {
+			return;
+		}
+
+		auto it = std::lower_bound(
+			ranges.begin(), ranges.end(), range.startByte,
+			[](const FreeRange& lhs, uint64_t startByte) {
+				return lhs.startByte < startByte;
+			});
+
+		size_t pos = static_cast<size_t>(it - ranges.begin());
+		ranges.insert(it, range);
+
+		if (pos > 0 && ranges[pos - 1].endByte >= ranges[pos].startByte) {
+			ranges[pos - 1].endByte = std::max(ranges[pos - 1].endByte, ranges[pos].endByte);
+			ranges.erase(ranges.begin() + static_cast<std::ptrdiff_t>(pos));
+			--pos;
+		}
+
+		while (pos + 1 < ranges.size() && ranges[pos].endByte >= ranges[pos + 1].startByte) {
+			ranges[pos].endByte = std::max(ranges[pos].endByte, ranges[pos + 1].endByte);
+			ranges.erase(ranges.begin() + static_cast<std::ptrdiff_t>(pos + 1));
+		}
+	}
+
+	AliasPackingResult PlanWithGreedySweepLine(std::span<const AliasPackingCandidate> candidates) {
+		std::priority_queue<
+			ActiveAllocation,
+			std::vector<ActiveAllocation>,
+			std::greater<ActiveAllocation>> activeByEnd;
+		std::vector<FreeRange> freeRanges;
+		std::vector<Placement> plannedPlacements(candidates.size());
+
+		uint64_t heapEnd = 0;
+		uint64_t poolAlignment = 1;
+
+		for (size_t candidateIndex = 0; candidateIndex < candidates.size(); ++candidateIndex) {
+			const auto& c = candidates[candidateIndex];
+			while (!activeByEnd.empty() && activeByEnd.top().lastUse < c.firstUse) {
+				const auto expired = activeByEnd.top();
+				InsertFreeRangeSortedMerged(freeRanges, FreeRange{
+					.startByte = expired.startByte,
+					.endByte = expired.endByte,
+					});
+				activeByEnd.pop();
+			}
+
+			bool found = false;
+			size_t bestRangeIndex = std::numeric_limits<size_t>::max();
+			uint64_t bestStartByte = 0;
+			uint64_t bestSlackBytes = std::numeric_limits<uint64_t>::max();
+
+			for (size_t rangeIndex = 0; rangeIndex < freeRanges.size(); ++rangeIndex) {
+				const auto& range = freeRanges[rangeIndex];
+				const uint64_t alignedStart = AlignUpU64(range.startByte, c.alignment);
+				const uint64_t alignedEnd = alignedStart + c.sizeBytes;
+				if (alignedStart < range.startByte || alignedEnd > range.endByte) {
+					continue;
+				}
+
+				const uint64_t slackBytes = range.endByte - alignedEnd;
+				if (!found || slackBytes < bestSlackBytes || (slackBytes == bestSlackBytes && alignedStart < bestStartByte)) {
+					found = true;
+					bestRangeIndex = rangeIndex;
+					bestStartByte = alignedStart;
+					bestSlackBytes = slackBytes;
+				}
+			}
+
+			uint64_t startByte = 0;
+			if (found) {
+				const auto selected = freeRanges[bestRangeIndex];
+				startByte = bestStartByte;
+				const uint64_t endByte = startByte + c.sizeBytes;
+
+				if (selected.startByte < startByte && endByte < selected.endByte) {
+					freeRanges[bestRangeIndex].endByte = startByte;
+					freeRanges.insert(
+						freeRanges.begin() + static_cast<std::ptrdiff_t>(bestRangeIndex + 1),
+						FreeRange{
+							.startByte = endByte,
+							.endByte = selected.endByte,
+						});
+				}
+				else if (selected.startByte < startByte) {
+					freeRanges[bestRangeIndex].endByte = startByte;
+				}
+				else if (endByte < selected.endByte) {
+					freeRanges[bestRangeIndex].startByte = endByte;
+				}
+				else {
+					freeRanges.erase(freeRanges.begin() + static_cast<std::ptrdiff_t>(bestRangeIndex));
+				}
+			}
+			else {
+				startByte = AlignUpU64(heapEnd, c.alignment);
+				heapEnd = startByte + c.sizeBytes;
+			}
+
+			const uint64_t endByte = startByte + c.sizeBytes;
+			heapEnd = std::max(heapEnd, endByte);
+			poolAlignment = std::max(poolAlignment, c.alignment);
+
+			activeByEnd.push(ActiveAllocation{
+				.lastUse = c.lastUse,
+				.startByte = startByte,
+				.endByte = endByte,
+				});
+
+			plannedPlacements[candidateIndex] = Placement{
+				.offset = startByte,
+				.sizeBytes = c.sizeBytes,
+				.alignment = c.alignment,
+				.firstUse = c.firstUse,
+				.lastUse = c.lastUse,
+			};
+		}
+
+		return AliasPackingResult{ std::move(plannedPlacements), heapEnd, poolAlignment, false };
+	}
+
+	// Offline interval packing: biggest (then longest-lived) resources first, each placed at the
+	// lowest aligned offset that does not overlap any already placed resource whose lifetime
+	// intersects its own. Unlike the sweep-line it sees the whole frame up front, so a large
+	// late resource can't be fragmented around by small early ones.
+	AliasPackingResult PlanWithIntervalBestFit(std::span<const AliasPackingCandidate> candidates) {
+		struct PlacedInterval {
+			uint64_t startByte = 0;
+			uint64_t endByte = 0;
+			size_t firstUse = 0;
+			size_t lastUse = 0;
+		};
+
+		std::vector<size_t> candidateOrder(candidates.size());
+		for (size_t i = 0; i < candidateOrder.size(); ++i) {
+			candidateOrder[i] = i;
+		}
+		std::sort(candidateOrder.begin(), candidateOrder.end(), [&](size_t aIdx, size_t bIdx) {
+			const auto& a = candidates[aIdx];
+			const auto& b = candidates[bIdx];
+			if (a.sizeBytes != b.sizeBytes) {
+				return a.sizeBytes > b.sizeBytes;
+			}
+			const uint64_t aSpan = static_cast<uint64_t>(a.lastUse - a.firstUse);
+			const uint64_t bSpan = static_cast<uint64_t>(b.lastUse - b.firstUse);
+			if (aSpan != bSpan) {
+				return aSpan > bSpan;
+			}
+			if (a.firstUse != b.firstUse) {
+				return a.firstUse < b.firstUse;
+			}
+			return a.resourceID < b.resourceID;
+		});
+
+		std::vector<Placement> plannedPlacements(candidates.size());
+		std::vector<PlacedInterval> placed;
+		placed.reserve(candidates.size());
+		std::vector<std::pair<uint64_t, uint64_t>> conflicting;
+		conflicting.reserve(candidates.size());
+
+		uint64_t heapEnd = 0;
+		uint64_t poolAlignment = 1;
+
+		for (size_t candidateIndex : candidateOrder) {
+			const auto& c = candidates[candidateIndex];
+
+			conflicting.clear();
+			for (const auto& other : placed) {
+				if (!(other.lastUse < c.firstUse || c.lastUse < other.firstUse)) {
+					conflicting.emplace_back(other.startByte, other.endByte);
+				}
+			}
+			std::sort(conflicting.begin(), conflicting.end());
+
+			// Walk the byte ranges taken by lifetime-overlapping resources in offset order and
+			// take the first aligned gap the candidate fits in.
+			uint64_t startByte = AlignUpU64(0, c.alignment);
+			for (const auto& [takenStart, takenEnd] : conflicting) {
+				if (startByte + c.sizeBytes <= takenStart) {
+					break;
+				}
+				if (takenEnd > startByte) {
+					startByte = AlignUpU64(takenEnd, c.alignment);
+				}
+			}
+
+			const uint64_t endByte = startByte + c.sizeBytes;
+			heapEnd = std::max(heapEnd, endByte);
+			poolAlignment = std::max(poolAlignment, c.alignment);
+			placed.push_back(PlacedInterval{
+				.startByte = startByte,
+				.endByte = endByte,
+				.firstUse = c.firstUse,
+				.lastUse = c.lastUse,
+			});
+
+			plannedPlacements[candidateIndex] = Placement{
+				.offset = startByte,
+				.sizeBytes = c.sizeBytes,
+				.alignment = c.alignment,
+				.firstUse = c.firstUse,
+				.lastUse = c.lastUse,
+			};
+		}
+
+		return AliasPackingResult{ std::move(plannedPlacements), heapEnd, poolAlignment, false };
+	}
+
+	AliasPackingResult PlanWithBeamSearch(std::span<const AliasPackingCandidate> candidates) {
+		struct PlannedRange {
+			size_t candidateIndex = 0;
+			uint64_t startByte = 0;
+			uint64_t endByte = 0;
+		};
+
+		struct BeamState {
+			std::vector<PlannedRange> placedRanges;
+			std::vector<uint8_t> placedMask;
+			uint64_t heapSize = 0;
+			double score = 0.0;
+		};
+
+		std::vector<Placement> bestPlacements;
+		uint64_t bestHeapSize = std::numeric_limits<uint64_t>::max();
+		uint64_t poolAlignment = 1;
+		for (const auto& c : candidates) {
+			poolAlignment = std::max(poolAlignment, c.alignment);
+		}
+
+		auto greedy = PlanWithGreedySweepLine(candidates);
+		bestPlacements = std::move(greedy.placements);
+		bestHeapSize = greedy.heapSize;
+		poolAlignment = std::max(poolAlignment, greedy.poolAlignment);
+
+		std::vector<size_t> candidateOrder;
+		candidateOrder.reserve(candidates.size());
+		for (size_t i = 0; i < candidates.size(); ++i) {
+			candidateOrder.push_back(i);
+		}
+
+		std::sort(candidateOrder.begin(), candidateOrder.end(), [&](size_t aIdx, size_t bIdx) {
+			const auto& a = candidates[aIdx];
+			const auto& b = candidates[bIdx];
+			const uint64_t aSpan = static_cast<uint64_t>(a.lastUse - a.firstUse + 1ull);
+			const uint64_t bSpan = static_cast<uint64_t>(b.lastUse - b.firstUse + 1ull);
+			const uint64_t aWeight = a.sizeBytes * aSpan;
+			const uint64_t bWeight = b.sizeBytes * bSpan;
+			if (aWeight != bWeight) {
+				return aWeight > bWeight;
+			}
+			if (a.sizeBytes != b.sizeBytes) {
+				return a.sizeBytes > b.sizeBytes;
+			}
+			if (a.firstUse != b.firstUse) {
+				return a.firstUse < b.firstUse;
+			}
+			return a.resourceID < b.resourceID;
+		});
+
+		auto lifetimesOverlap = [&](const AliasPackingCandidate& lhs, const AliasPackingCandidate& rhs) {
+			return !(lhs.lastUse < rhs.firstUse || rhs.lastUse < lhs.firstUse);
+		};
+
+		auto intervalOverlaps = [](uint64_t aStart, uint64_t aEnd, uint64_t bStart, uint64_t bEnd) {
+			const uint64_t overlapStart = std::max(aStart, bStart);
+			const uint64_t overlapEnd = std::min(aEnd, bEnd);
+			return overlapStart < overlapEnd;
+		};
+
+		auto buildPlacementVector = [&](const std::vector<PlannedRange>& placedRanges) {
+			std::vector<Placement> out(candidates.size());
+			for (const auto& placed : placedRanges) {
+				const auto& c = candidates[placed.candidateIndex];
+				out[placed.candidateIndex] = Placement{
+					.offset = placed.startByte,
+					.sizeBytes = c.sizeBytes,
+					.alignment = c.alignment,
+					.firstUse = c.firstUse,
+					.lastUse = c.lastUse,
+				};
+			}
+			return out;
+		};
+
+		constexpr size_t kBeamWidth = 24;
+		constexpr size_t kCandidateStartsPerState = 8;
+		bool truncated = false;
+
+		auto scoreState = [](const BeamState& state) {
+			double wastePenalty = 0.0;
+			for (const auto& placed : state.placedRanges) {
+				wastePenalty += static_cast<double>(placed.endByte - placed.startByte);
+			}
+			return static_cast<double>(state.heapSize) + (0.000001 * wastePenalty);
+		};
+
+		BeamState initialState{};
+		initialState.heapSize = 0;
+		initialState.placedMask.assign(candidates.size(), 0);
+		initialState.placedRanges.reserve(candidates.size());
+		initialState.score = 0.0;
+
+		std::vector<BeamState> beam;
+		beam.push_back(std::move(initialState));
+
+		for (size_t depth = 0; depth < candidates.size() && !beam.empty(); ++depth) {
+			std::vector<BeamState> nextBeam;
+			nextBeam.reserve(beam.size() * kCandidateStartsPerState);
+
+			for (const auto& state : beam) {
+				size_t nextCandidateIndex = std::numeric_limits<size_t>::max();
+				for (size_t orderedIndex : candidateOrder) {
+					if (!state.placedMask[orderedIndex]) {
+						nextCandidateIndex = orderedIndex;
+						break;
+					}
+				}
+				if (nextCandidateIndex == std::numeric_limits<size_t>::max()) {
+					if (state.heapSize < bestHeapSize) {
+						bestHeapSize = state.heapSize;
+						bestPlacements = buildPlacementVector(state.placedRanges);
+					}
+					continue;
+				}
+
+				const auto& nextCandidate = candidates[nextCandidateIndex];
+				std::vector<uint64_t> candidateStarts;
+				candidateStarts.reserve(1 + state.placedRanges.size());
+				candidateStarts.push_back(0ull);
+
+				for (const auto& placed : state.placedRanges) {
+					const auto& placedCandidate = candidates[placed.candidateIndex];
+					if (lifetimesOverlap(nextCandidate, placedCandidate)) {
+						candidateStarts.push_back(placed.endByte);
+					}
+				}
+
+				std::vector<std::pair<uint64_t, uint64_t>> feasibleStarts;
+				feasibleStarts.reserve(candidateStarts.size());
+				std::unordered_set<uint64_t> dedupStarts;
+				dedupStarts.reserve(candidateStarts.size() * 2 + 1);
+
+				for (uint64_t rawStart : candidateStarts) {
+					const uint64_t alignedStart = AlignUpU64(rawStart, nextCandidate.alignment);
+					if (!dedupStarts.insert(alignedStart).second) {
+						continue;
+					}
+
+					const uint64_t alignedEnd = alignedStart + nextCandidate.sizeBytes;
+					bool conflicts = false;
+					for (const auto& placed : state.placedRanges) {
+						const auto& placedCandidate = candidates[placed.candidateIndex];
+						if (!lifetimesOverlap(nextCandidate, placedCandidate)) {
+							continue;
+						}
+						if (intervalOverlaps(alignedStart, alignedEnd, placed.startByte, placed.endByte)) {
+							conflicts = true;
+							break;
+						}
+					}
+
+					if (!conflicts) {
+						const uint64_t resultingHeap = std::max(state.heapSize, alignedEnd);
+						if (resultingHeap < bestHeapSize) {
+							feasibleStarts.emplace_back(alignedStart, resultingHeap);
+						}
+					}
+				}
+
+				if (feasibleStarts.empty()) {
+					const uint64_t appendStart = AlignUpU64(state.heapSize, nextCandidate.alignment);
+					const uint64_t appendEnd = appendStart + nextCandidate.sizeBytes;
+					if (appendEnd < bestHeapSize) {
+						feasibleStarts.emplace_back(appendStart, appendEnd);
+					}
+				}
+
+				std::sort(feasibleStarts.begin(), feasibleStarts.end(), [](const auto& a, const auto& b) {
+					if (a.second != b.second) {
+						return a.second < b.second;
+					}
+					return a.first < b.first;
+				});
+
+				if (feasibleStarts.size() > kCandidateStartsPerState) {
+					feasibleStarts.resize(kCandidateStartsPerState);
+					truncated = true;
+				}
+
+				for (const auto& [startByte, resultingHeap] : feasibleStarts) {
+					BeamState newState = state;
+					newState.placedMask[nextCandidateIndex] = 1;
+					newState.heapSize = resultingHeap;
+					newState.placedRanges.push_back(PlannedRange{
+						.candidateIndex = nextCandidateIndex,
+						.startByte = startByte,
+						.endByte = startByte + nextCandidate.sizeBytes,
+					});
+					newState.score = scoreState(newState);
+					nextBeam.push_back(std::move(newState));
+				}
+			}
+
+			if (nextBeam.empty()) {
+				break;
+			}
+
+			std::sort(nextBeam.begin(), nextBeam.end(), [](const BeamState& a, const BeamState& b) {
+				if (a.score != b.score) {
+					return a.score < b.score;
+				}
+				return a.heapSize < b.heapSize;
+			});
+
+			if (nextBeam.size() > kBeamWidth) {
+				nextBeam.resize(kBeamWidth);
+				truncated = true;
+			}
+
+			beam = std::move(nextBeam);
+		}
+
+		for (const auto& state : beam) {
+			if (state.placedRanges.size() == candidates.size() && state.heapSize < bestHeapSize) {
+				bestHeapSize = state.heapSize;
+				bestPlacements = buildPlacementVector(state.placedRanges);
+			}
+		}
+
+		if (bestPlacements.empty()) {
+			auto fallback = PlanWithGreedySweepLine(candidates);
+			bestPlacements = std::move(fallback.placements);
+			bestHeapSize = fallback.heapSize;
+			poolAlignment = std::max(poolAlignment, fallback.poolAlignment);
+			truncated = true;
+		}
+
+		return AliasPackingResult{ std::move(bestPlacements), bestHeapSize, poolAlignment, truncated };
+	}
+}
+
+void SortAliasPackingCandidates(std::vector<AliasPackingCandidate>& candidates) {
+	std::sort(candidates.begin(), candidates.end(), [](const AliasPackingCandidate& lhs, const AliasPackingCandidate& rhs) {
+		if (lhs.firstUse != rhs.firstUse) {
+			return lhs.firstUse < rhs.firstUse;
+		}
+		if (lhs.sizeBytes != rhs.sizeBytes) {
+			return lhs.sizeBytes > rhs.sizeBytes;
+		}
+		if (lhs.lastUse != rhs.lastUse) {
+			return lhs.lastUse < rhs.lastUse;
+		}
+		return lhs.resourceID < rhs.resourceID;
+	});
+}
+
+AliasPackingResult PackAliasPool(AutoAliasPackingStrategy strategy, std::span<const AliasPackingCandidate> candidates) {
+	switch (strategy) {
+	case AutoAliasPackingStrategy::GreedySweepLine:
+		return PlanWithGreedySweepLine(candidates);
+	case AutoAliasPackingStrategy::BranchAndBound:
+		return PlanWithBeamSearch(candidates);
+	case AutoAliasPackingStrategy::IntervalBestFit:
+		return PlanWithIntervalBestFit(candidates);
+	default:
+		throw std::runtime_error("Unsupported alias packing strategy");
+	}
+}
+
+bool ValidateAliasPackingResult(std::span<const AliasPackingCandidate> candidates, const AliasPackingResult& result) {
+	if (result.placements.size() != candidates.size()) {
+		return false;
+	}
+	for (size_t i = 0; i < candidates.size(); ++i) {
+		const auto& placement = result.placements[i];
+		if (candidates[i].alignment != 0 && placement.offset % candidates[i].alignment != 0) {
+			return false;
+		}
+		if (placement.offset + candidates[i].sizeBytes > result.heapSize) {
+			return false;
+		}
+		for (size_t j = i + 1; j < candidates.size(); ++j) {
+			const bool lifetimesOverlap = !(candidates[i].lastUse < candidates[j].firstUse || candidates[j].lastUse < candidates[i].firstUse);
+			if (!lifetimesOverlap) {
+				continue;
+			}
+			const auto& other = result.placements[j];
+			if (placement.offset < other.offset + candidates[j].sizeBytes && other.offset < placement.offset + candidates[i].sizeBytes) {
+				return false;
+			}
+		}
+	}
+	return true;
+}
+
+std::vector<AliasPackingBenchmarkPool> BuildAliasPackingPoolsFromDebugSnapshot(const AutoAliasDebugSnapshot& snapshot) {
+	std::vector<AliasPackingBenchmarkPool> pools;
+	pools.reserve(snapshot.poolDebug.size());
+	for (const auto& poolDebug : snapshot.poolDebug) {
+		auto& pool = pools.emplace_back();
+		pool.poolID = poolDebug.poolID;
+		pool.candidates.reserve(poolDebug.ranges.size());
+		for (const auto& range : poolDebug.ranges) {
+			pool.candidates.push_back(AliasPackingCandidate{
+				.resourceID = range.resourceID,
+				.sizeBytes = range.sizeBytes,
+				.alignment = range.alignment,
+				.firstUse = range.firstUse,
+				.lastUse = range.lastUse,
+			});
+		}
+		SortAliasPackingCandidates(pool.candidates);
+	}
+	return pools;
+}
+
+std::vector<AliasPackingBenchmarkPool> GenerateSyntheticAliasPackingPools(uint64_t seed, uint32_t poolCount, uint32_t candidatesPerPool) {
+	// Roughly what a deferred frame looks like: mostly short-lived, 64 KiB aligned targets with a
+	// long tail of sizes, plus the occasional MSAA target that needs 4 MiB alignment.
+	constexpr uint64_t kDefaultAlignment = 64ull * 1024ull;
+	constexpr uint64_t kMsaaAlignment = 4ull * 1024ull * 1024ull;
+
+	std::mt19937_64 rng(seed);
+	std::vector<AliasPackingBenchmarkPool> pools(poolCount);
+	const size_t passCount = std::max<size_t>(2, size_t(candidatesPerPool) * 2);
+	for (uint32_t poolIndex = 0; poolIndex < poolCount; ++poolIndex) {
+		auto& pool = pools[poolIndex];
+		pool.poolID = poolIndex;
+		pool.candidates.reserve(candidatesPerPool);
+		std::uniform_int_distribution<size_t> firstUseDist(0, passCount - 1);
+		std::geometric_distribution<size_t> lifetimeDist(0.15);
+		std::geometric_distribution<uint64_t> sizeUnitsDist(0.05);
+		std::bernoulli_distribution msaaDist(0.0625);
+		for (uint32_t candidateIndex = 0; candidateIndex < candidatesPerPool; ++candidateIndex) {
+			const uint64_t alignment = msaaDist(rng) ? kMsaaAlignment : kDefaultAlignment;
+			const size_t firstUse = firstUseDist(rng);
+			pool.candidates.push_back(AliasPackingCandidate{
+				.resourceID = (uint64_t(poolIndex) << 32) | candidateIndex,
+				.sizeBytes = (1ull + sizeUnitsDist(rng)) * alignment,
+				.alignment = alignment,
+				.firstUse = firstUse,
+				.lastUse = std::min(passCount - 1, firstUse + lifetimeDist(rng)),
+			});
+		}
+		SortAliasPackingCandidates(pool.candidates);
+	}
+	return pools;
+}
+
+// Text format: "pool <poolID> <candidateCount>" followed by one
+// "<resourceID> <sizeBytes> <alignment> <firstUse> <lastUse>" line per candidate.
+bool SaveAliasPackingPools(const std::filesystem::path& path, std::span<const AliasPackingBenchmarkPool> pools) {
+	std::ofstream out(path, std::ios::trunc);
+	if (!out) {
+		return false;
+	}
+	for (const auto& pool : pools) {
+		out << "pool " << pool.poolID << ' ' << pool.candidates.size() << '\n';
+		for (const auto& c : pool.candidates) {
+			out << c.resourceID << ' ' << c.sizeBytes << ' ' << c.alignment << ' ' << c.firstUse << ' ' << c.lastUse << '\n';
+		}
+	}
+	return static_cast<bool>(out);
+}
+
+bool LoadAliasPackingPools(const std::filesystem::path& path, std::vector<AliasPackingBenchmarkPool>& outPools) {
+	std::ifstream in(path);
+	if (!in) {
+		return false;
+	}
+	std::vector<AliasPackingBenchmarkPool> pools;
+	std::string tag;
+	while (in >> tag) {
+		if (tag != "pool") {
+			return false;
+		}
+		auto& pool = pools.emplace_back();
+		size_t candidateCount = 0;
+		if (!(in >> pool.poolID >> candidateCount)) {
+			return false;
+		}
+		pool.candidates.resize(candidateCount);
+		for (auto& c : pool.candidates) {
+			if (!(in >> c.resourceID >> c.sizeBytes >> c.alignment >> c.firstUse >> c.lastUse) || c.lastUse < c.firstUse) {
+				return false;
+			}
+			c.alignment = std::max<uint64_t>(1, c.alignment);
+		}
+		SortAliasPackingCandidates(pool.candidates);
+	}
+	outPools = std::move(pools);
+	return true;
+}
+
+std::vector<AliasPackingBenchmarkResult> BenchmarkAliasPackingStrategies(std::span<const AliasPackingBenchmarkPool> pools, uint32_t iterations) {
+	constexpr AutoAliasPackingStrategy kStrategies[] = {
+		AutoAliasPackingStrategy::GreedySweepLine,
+		AutoAliasPackingStrategy::BranchAndBound,
+		AutoAliasPackingStrategy::IntervalBestFit,
+	};
+	iterations = std::max(1u, iterations);
+
+	std::vector<AliasPackingBenchmarkResult> results;
+	results.reserve(std::size(kStrategies));
+	for (AutoAliasPackingStrategy strategy : kStrategies) {
+		auto& result = results.emplace_back();
+		result.strategy = strategy;
+		double totalMilliseconds = 0.0;
+		for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+			const bool lastIteration = iteration + 1 == iterations;
+			const auto start = std::chrono::steady_clock::now();
+			for (const auto& pool : pools) {
+				AliasPackingResult plan = PackAliasPool(strategy, pool.candidates);
+				if (!lastIteration) {
+					continue;
+				}
+				for (const auto& c : pool.candidates) {
+					result.pooledIndependentBytes += c.sizeBytes;
+				}
+				result.pooledActualBytes += plan.heapSize;
+				result.truncatedPools += plan.searchTruncated ? 1 : 0;
+				result.allPlansValid = result.allPlansValid && ValidateAliasPackingResult(pool.candidates, plan);
+			}
+			const double milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+			totalMilliseconds += milliseconds;
+			result.maxPlanMilliseconds = std::max(result.maxPlanMilliseconds, milliseconds);
+		}
+		result.averagePlanMilliseconds = totalMilliseconds / static_cast<double>(iterations);
+		result.pooledSavedBytes = result.pooledIndependentBytes > result.pooledActualBytes
+			? result.pooledIndependentBytes - result.pooledActualBytes
+			: 0;
+	}
+	return results;
+}
+
+}
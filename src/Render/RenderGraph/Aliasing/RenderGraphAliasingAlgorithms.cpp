@@ -1,13 +1,13 @@
 #include "Render/RenderGraph/RenderGraph.h"
+#include "Render/RenderGraph/Aliasing/RenderGraphAliasPacking.h"
 
 #include "DebugUI/MemoryIntrospectionWidget.h"
 
 #include <algorithm>
-#include <boost/functional/hash.hpp>
 #include <cmath>
 #include <functional>
 #include <limits>
-#include <queue>
+#include <mutex>
 #include <sstream>
 #include <tracy/Tracy.hpp>
 #include <tuple>
@@ -19,6 +19,7 @@
 #include "Resources/PixelBuffer.h"
 #include "Resources/Buffers/DynamicBufferBase.h"
 #include "Resources/MemoryStatisticsComponents.h"
+#include "Utilities/ORGUtilities.h"
 
 RenderGraph::AutoAliasDebugSnapshot RenderGraph::GetAutoAliasDebugSnapshot() const {
 	return m_aliasingSubsystem.BuildDebugSnapshot(
@@ -501,8 +502,7 @@ namespace {
 	}
 
 	uint64_t HashAliasValue(uint64_t seed, uint64_t value) {
-		boost::hash_combine(seed, value);
-		return seed;
+		return rg::util::HashMix64(seed, value);
 	}
 
 	uint64_t BuildAliasTextureStaticSignature(const TextureDescription& desc, uint64_t backingGeneration, bool materialized) {
@@ -558,6 +558,8 @@ namespace {
 		info.hasManualPool = cachedInfo.hasManualPool;
 		info.sizeBytes = cachedInfo.sizeBytes;
 		info.alignment = cachedInfo.alignment;
+		info.mipLevels = cachedInfo.mipLevels;
+		info.arraySize = cachedInfo.arraySize;
 		info.debugName = cachedInfo.debugName;
 		info.exclusionReason = cachedInfo.exclusionReason;
 		info.staticInfoInitialized = true;
@@ -574,31 +576,82 @@ namespace {
 			.hasManualPool = info.hasManualPool,
 			.sizeBytes = info.sizeBytes,
 			.alignment = info.alignment,
+			.mipLevels = info.mipLevels,
+			.arraySize = info.arraySize,
 			.debugName = info.debugName,
 			.exclusionReason = info.exclusionReason,
 		};
 	}
 
-	uint64_t AlignUpU64(uint64_t value, uint64_t alignment) {
-		if (alignment == 0) {
-			return value;
+	// Bounds the per-texture lifetime arrays; a 16-mip, 16-slice texture still fits.
+	constexpr size_t kMaxTrackedAliasSubresources = 256;
+
+	struct LiveBytesEvent {
+		size_t time = 0;
+		int64_t deltaBytes = 0;
+	};
+
+	void AppendLiveInterval(std::vector<LiveBytesEvent>& events, size_t firstUse, size_t lastUse, uint64_t bytes) {
+		if (bytes == 0) {
+			return;
+		}
+		events.push_back({ firstUse, static_cast<int64_t>(bytes) });
+		events.push_back({ lastUse + 1, -static_cast<int64_t>(bytes) });
+	}
+
+	// Lifetimes are inclusive, so an interval ending at t frees its bytes before one starting at
+	// t + 1 claims them.
+	uint64_t PeakLiveBytes(std::vector<LiveBytesEvent>& events) {
+		std::sort(events.begin(), events.end(), [](const LiveBytesEvent& a, const LiveBytesEvent& b) {
+			if (a.time != b.time) {
+				return a.time < b.time;
+			}
+			return a.deltaBytes < b.deltaBytes;
+			});
+		int64_t live = 0;
+		int64_t peak = 0;
+		for (const auto& event : events) {
+			live += event.deltaBytes;
+			peak = std::max(peak, live);
+		}
+		return static_cast<uint64_t>(peak);
+	}
+
+	// Splits a texture's allocation across its subresources by texel count, assuming each mip is a
+	// quarter of the one above it. Driver layouts are opaque, so this is an estimate.
+	void AppendSubresourceLiveIntervals(std::vector<LiveBytesEvent>& events, const rg::alias::FrameAliasResourceInfo& info) {
+		const uint32_t mipLevels = info.mipLevels;
+		double mipWeightSum = 0.0;
+		for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+			mipWeightSum += std::ldexp(1.0, -2 * static_cast<int>(mip));
+		}
+		const double sliceBytes = static_cast<double>(info.sizeBytes) / static_cast<double>(info.arraySize);
+		for (size_t subresource = 0; subresource < info.subresourceFirstUse.size(); ++subresource) {
+			const uint32_t mip = static_cast<uint32_t>(subresource % mipLevels);
+			const uint64_t bytes = static_cast<uint64_t>(sliceBytes * std::ldexp(1.0, -2 * static_cast<int>(mip)) / mipWeightSum);
+			// A subresource no pass touches still occupies memory for the resource's whole lifetime.
+			if (info.subresourceFirstUse[subresource] == std::numeric_limits<size_t>::max()) {
+				AppendLiveInterval(events, info.firstUse, info.lastUse, bytes);
+			}
+			else {
+				AppendLiveInterval(events, info.subresourceFirstUse[subresource], info.subresourceLastUse[subresource], bytes);
+			}
 		}
-		return (value + alignment - 1ull) / alignment * alignment;
 	}
 
 	uint64_t BuildAliasPlacementSignatureValue(uint64_t poolID, uint64_t startByte, uint64_t endByte, uint64_t poolGeneration) {
-		size_t signature = static_cast<size_t>(0xcbf29ce484222325ull);
-		boost::hash_combine(signature, poolID);
-		boost::hash_combine(signature, startByte);
-		boost::hash_combine(signature, endByte);
-		boost::hash_combine(signature, poolGeneration);
-		return static_cast<uint64_t>(signature);
+		uint64_t signature = 0xcbf29ce484222325ull;
+		signature = rg::util::HashMix64(signature, poolID);
+		signature = rg::util::HashMix64(signature, startByte);
+		signature = rg::util::HashMix64(signature, endByte);
+		signature = rg::util::HashMix64(signature, poolGeneration);
+		return signature;
 	}
 
 	uint64_t BuildDedicatedSchedulingPoolID(uint64_t resourceID) {
-		size_t signature = static_cast<size_t>(0xded1ca7e5eed0001ull);
-		boost::hash_combine(signature, resourceID);
-		return static_cast<uint64_t>(signature);
+		uint64_t signature = 0xded1ca7e5eed0001ull;
+		signature = rg::util::HashMix64(signature, resourceID);
+		return signature;
 	}
 
 	uint64_t BuildAliasPoolPlanningSignature(
@@ -606,28 +659,59 @@ namespace {
 		AutoAliasPackingStrategy packingStrategy,
 		const rg::alias::FrameAliasAnalysis& analysis,
 		const std::vector<uint32_t>& poolCandidateIndices) {
-		size_t signature = static_cast<size_t>(0x7f4a7c15d9e31a01ull);
-		boost::hash_combine(signature, poolID);
-		boost::hash_combine(signature, static_cast<uint8_t>(packingStrategy));
-		boost::hash_combine(signature, poolCandidateIndices.size());
+		uint64_t signature = 0x7f4a7c15d9e31a01ull;
+		signature = rg::util::HashMix64(signature, poolID);
+		signature = rg::util::HashMix64(signature, static_cast<uint64_t>(packingStrategy));
+		signature = rg::util::HashMix64(signature, poolCandidateIndices.size());
 		for (uint32_t resourceIndex : poolCandidateIndices) {
 			if (resourceIndex >= analysis.infoByResourceIndex.size()) {
-				boost::hash_combine(signature, resourceIndex);
+				signature = rg::util::HashMix64(signature, resourceIndex);
 				continue;
 			}
 
 			const auto& info = analysis.infoByResourceIndex[resourceIndex];
-			boost::hash_combine(signature, info.resourceID);
-			boost::hash_combine(signature, info.sizeBytes);
-			boost::hash_combine(signature, info.alignment);
-			boost::hash_combine(signature, info.firstUse);
-			boost::hash_combine(signature, info.lastUse);
-			boost::hash_combine(signature, info.firstUseIsWrite);
-			boost::hash_combine(signature, static_cast<uint8_t>(info.kind));
-		}
-		return static_cast<uint64_t>(signature);
+			signature = rg::util::HashMix64(signature, info.resourceID);
+			signature = rg::util::HashMix64(signature, info.sizeBytes);
+			signature = rg::util::HashMix64(signature, info.alignment);
+			signature = rg::util::HashMix64(signature, info.firstUse);
+			signature = rg::util::HashMix64(signature, info.lastUse);
+			signature = rg::util::HashMix64(signature, info.firstUseIsWrite);
+			signature = rg::util::HashMix64(signature, static_cast<uint64_t>(info.kind));
+		}
+		return signature;
 	}
 
+	// Same inputs as BuildAliasPoolPlanningSignature minus resource IDs, which are not stable
+	// across runs. Placements only depend on these, so a plan with a matching shape is valid for
+	// whichever resources fill the candidate slots.
+	uint64_t BuildAliasPoolShapeSignature(
+		uint64_t poolID,
+		AutoAliasPackingStrategy packingStrategy,
+		const rg::alias::FrameAliasAnalysis& analysis,
+		const std::vector<uint32_t>& poolCandidateIndices) {
+		uint64_t signature = 0x3c6ef372fe94f82bull;
+		signature = rg::util::HashMix64(signature, poolID);
+		signature = rg::util::HashMix64(signature, static_cast<uint64_t>(packingStrategy));
+		signature = rg::util::HashMix64(signature, poolCandidateIndices.size());
+		for (uint32_t resourceIndex : poolCandidateIndices) {
+			if (resourceIndex >= analysis.infoByResourceIndex.size()) {
+				signature = rg::util::HashMix64(signature, resourceIndex);
+				continue;
+			}
+
+			const auto& info = analysis.infoByResourceIndex[resourceIndex];
+			signature = rg::util::HashMix64(signature, info.sizeBytes);
+			signature = rg::util::HashMix64(signature, info.alignment);
+			signature = rg::util::HashMix64(signature, info.firstUse);
+			signature = rg::util::HashMix64(signature, info.lastUse);
+			signature = rg::util::HashMix64(signature, info.firstUseIsWrite);
+			signature = rg::util::HashMix64(signature, static_cast<uint64_t>(info.kind));
+		}
+		return signature;
+	}
+
+	constexpr size_t kMaxPersistedAliasPlans = 256;
+
 	enum class AliasPlanCacheMissReason : uint8_t {
 		None,
 		NoCachedPlan,
@@ -690,7 +774,7 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 	analysis.infoByResourceIndex.resize(rg.m_frameSchedulingResourceCount);
 	analysis.candidateResourceIndices.reserve(rg.m_frameSchedulingResourceCount);
 
-	auto device = DeviceManager::GetInstance().GetDevice();
+	auto& deviceManager = DeviceManager::GetInstance();
 	auto initializeStaticInfo = [&](FrameAliasResourceInfo& info, uint64_t resourceID, const ResourceRegistry::RegistryHandle* handle) {
 		Resource* resource = nullptr;
 		auto resourceIt = resourcesByID.find(resourceID);
@@ -719,6 +803,8 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 			}
 
 			info.kind = RGResourceRuntimeKind::Texture;
+			info.mipLevels = std::max(1u, static_cast<uint32_t>(texture->GetMipLevels()));
+			info.arraySize = std::max(1u, static_cast<uint32_t>(texture->GetArraySize()));
 			info.aliasAllowed = desc.allowAlias;
 			info.deviceLocal = true;
 			info.materialized = texture->IsMaterialized();
@@ -728,8 +814,7 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 			}
 
 			auto resourceDesc = BuildAliasTextureResourceDesc(desc);
-			rhi::ResourceAllocationInfo allocationInfo{};
-			device.GetResourceAllocationInfo(&resourceDesc, 1, &allocationInfo);
+			const rhi::ResourceAllocationInfo allocationInfo = deviceManager.GetResourceAllocationInfo(resourceDesc);
 			info.sizeBytes = allocationInfo.sizeInBytes;
 			info.alignment = std::max<uint64_t>(1, allocationInfo.alignment);
 
@@ -765,8 +850,7 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 				buffer->GetBufferSize(),
 				buffer->IsUnorderedAccessEnabled(),
 				buffer->GetAccessType());
-			rhi::ResourceAllocationInfo allocationInfo{};
-			device.GetResourceAllocationInfo(&resourceDesc, 1, &allocationInfo);
+			const rhi::ResourceAllocationInfo allocationInfo = deviceManager.GetResourceAllocationInfo(resourceDesc);
 			info.sizeBytes = allocationInfo.sizeInBytes;
 			info.alignment = std::max<uint64_t>(1, allocationInfo.alignment);
 
@@ -791,7 +875,31 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 		info.staticInfoInitialized = true;
 		staticInfoCache[resourceID] = BuildCachedAliasStaticInfo(info, 0x51a71c5e00000000ull);
 	};
-	auto collectResource = [&](size_t resourceIndex, uint64_t resourceID, const ResourceRegistry::RegistryHandle* handle, bool isWrite, size_t usageOrder, uint32_t passCrit, size_t passIdx) {
+	const bool trackSubresourceLifetimes = rg.m_getAutoAliasSubresourceLifetimesEnabled
+		? rg.m_getAutoAliasSubresourceLifetimesEnabled()
+		: false;
+	// range == nullptr means the whole resource (internal transitions carry no range).
+	auto collectSubresourceLifetimes = [&](FrameAliasResourceInfo& info, const RangeSpec* range, size_t usageOrder) {
+		const size_t subresourceCount = size_t(info.mipLevels) * size_t(info.arraySize);
+		if (info.kind != RGResourceRuntimeKind::Texture || subresourceCount <= 1 || subresourceCount > kMaxTrackedAliasSubresources) {
+			return;
+		}
+		if (info.subresourceFirstUse.empty()) {
+			info.subresourceFirstUse.assign(subresourceCount, std::numeric_limits<size_t>::max());
+			info.subresourceLastUse.assign(subresourceCount, 0);
+		}
+		const SubresourceRange sr = range
+			? ResolveRangeSpec(*range, info.mipLevels, info.arraySize)
+			: SubresourceRange{ 0, info.mipLevels, 0, info.arraySize };
+		for (uint32_t slice = sr.firstSlice; slice < sr.firstSlice + sr.sliceCount; ++slice) {
+			for (uint32_t mip = sr.firstMip; mip < sr.firstMip + sr.mipCount; ++mip) {
+				const size_t subresource = size_t(slice) * info.mipLevels + mip;
+				info.subresourceFirstUse[subresource] = std::min(info.subresourceFirstUse[subresource], usageOrder);
+				info.subresourceLastUse[subresource] = std::max(info.subresourceLastUse[subresource], usageOrder);
+			}
+		}
+	};
+	auto collectResource = [&](size_t resourceIndex, uint64_t resourceID, const ResourceRegistry::RegistryHandle* handle, const RangeSpec* range, bool isWrite, size_t usageOrder, uint32_t passCrit, size_t passIdx) {
 		if (resourceIndex >= analysis.infoByResourceIndex.size()) {
 			return;
 		}
@@ -826,6 +934,9 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 		}
 		info.everWritten = info.everWritten || isWrite;
 		info.maxNodeCriticality = std::max(info.maxNodeCriticality, passCrit);
+		if (trackSubresourceLifetimes) {
+			collectSubresourceLifetimes(info, range, usageOrder);
+		}
 	};
 
 	for (size_t passIdx = 0; passIdx < m_framePasses.size(); ++passIdx) {
@@ -842,14 +953,14 @@ rg::alias::FrameAliasAnalysis rg::alias::RenderGraphAliasingSubsystem::BuildAlia
 			if (!resourceIndex.has_value()) {
 				continue;
 			}
-			collectResource(*resourceIndex, req.resourceID, &req.resource, AccessTypeIsWriteOrCommon(req.state.access), usageOrder, passCrit, passIdx);
+			collectResource(*resourceIndex, req.resourceID, &req.resource, &req.range, AccessTypeIsWriteOrCommon(req.state.access), usageOrder, passCrit, passIdx);
 		}
 		for (const auto& transition : passSummary.internalTransitionSummaries) {
 			auto resourceIndex = rg.TryGetFrameSchedulingResourceIndex(transition.resourceID);
 			if (!resourceIndex.has_value()) {
 				continue;
 			}
-			collectResource(*resourceIndex, transition.resourceID, nullptr, true, usageOrder, passCrit, passIdx);
+			collectResource(*resourceIndex, transition.resourceID, nullptr, nullptr, true, usageOrder, passCrit, passIdx);
 		}
 	}
 
@@ -1088,16 +1199,20 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 	auto& m_getAutoAliasPoolRetireIdleFrames = rg.m_getAutoAliasPoolRetireIdleFrames;
 	auto& aliasPoolGrowthHeadroom = rg.aliasPoolGrowthHeadroom;
 	auto& m_getAutoAliasPoolGrowthHeadroom = rg.m_getAutoAliasPoolGrowthHeadroom;
+	auto& m_getAutoAliasPoolBudgetAwareEnabled = rg.m_getAutoAliasPoolBudgetAwareEnabled;
+	auto& m_getAutoAliasPoolBudgetPressureThreshold = rg.m_getAutoAliasPoolBudgetPressureThreshold;
 	auto& autoAliasPackingStrategyLastFrame = rg.autoAliasPackingStrategyLastFrame;
 	auto& m_getAutoAliasPackingStrategy = rg.m_getAutoAliasPackingStrategy;
 	auto& m_getAutoAliasEnableLogging = rg.m_getAutoAliasEnableLogging;
 	auto& m_getAutoAliasBuildDebugData = rg.m_getAutoAliasBuildDebugData;
 	auto& frameSchedulingResourceIndexByID = rg.m_frameSchedulingResourceIndexByID;
 	auto& persistentAliasPools = rg.persistentAliasPools;
+	auto* aliasPoolArbiter = rg.m_aliasPoolArbiter.get();
 	auto& m_framePasses = rg.m_framePasses;
 	auto& resourcesByID = rg.resourcesByID;
 	auto& aliasPlacementPoolByID = rg.aliasPlacementPoolByID;
 	auto& cachedAliasPlanByPoolID = rg.cachedAliasPlanByPoolID;
+	auto& persistedAliasPlanByShapeSignature = rg.persistedAliasPlanByShapeSignature;
 	auto& aliasPlacementRangesByID = rg.aliasPlacementRangesByID;
 	auto& aliasPlacementRangeByResourceIndex = rg.m_aliasPlacementRangeByResourceIndex;
 	auto& hasAliasPlacementByResourceIndex = rg.m_hasAliasPlacementByResourceIndex;
@@ -1127,6 +1242,11 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 	autoAliasPlannerStats.pooledSavedBytes = 0;
 	autoAliasPlannerStats.planCacheHits = 0;
 	autoAliasPlannerStats.planCacheMisses = 0;
+	autoAliasPlannerStats.persistedPlanCacheHits = 0;
+	autoAliasPlannerStats.subresourceTrackedTextures = 0;
+	autoAliasPlannerStats.subresourceWholePeakBytes = 0;
+	autoAliasPlannerStats.subresourceGranularPeakBytes = 0;
+	autoAliasPlannerStats.subresourceEstimatedSavedBytes = 0;
 	autoAliasPlannerStats.primaryPlanCacheMissReason = nullptr;
 	autoAliasPoolDebug.clear();
 	uint64_t pooledReservedBytes = 0;
@@ -1137,6 +1257,28 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 	aliasPoolGrowthHeadroom = m_getAutoAliasPoolGrowthHeadroom
 		? std::max(1.0f, m_getAutoAliasPoolGrowthHeadroom())
 		: std::max(1.0f, aliasPoolGrowthHeadroom);
+
+	// Budget-aware pools: while device-local usage sits at or above the pressure threshold of the
+	// OS budget, grow to exactly what the plan needs, give back capacity a pool no longer needs,
+	// and retire idle pools after a few frames instead of the configured idle window. With slack
+	// the configured headroom and retirement policy apply unchanged.
+	constexpr uint64_t kBudgetPressureRetireIdleFrames = 4;
+	bool underBudgetPressure = false;
+	if (m_getAutoAliasPoolBudgetAwareEnabled && m_getAutoAliasPoolBudgetAwareEnabled() && rg.m_statisticsService) {
+		const auto budget = rg.m_statisticsService->GetMemoryBudgetStats();
+		if (budget.valid && budget.budgetBytes > 0) {
+			const float pressureThreshold = m_getAutoAliasPoolBudgetPressureThreshold
+				? m_getAutoAliasPoolBudgetPressureThreshold()
+				: 0.9f;
+			underBudgetPressure = static_cast<double>(budget.usageBytes)
+				>= static_cast<double>(budget.budgetBytes) * static_cast<double>(pressureThreshold);
+		}
+	}
+	const float effectiveGrowthHeadroom = underBudgetPressure ? 1.0f : aliasPoolGrowthHeadroom;
+	const uint64_t effectiveRetireIdleFrames = underBudgetPressure
+		? std::min<uint64_t>(aliasPoolRetireIdleFrames, kBudgetPressureRetireIdleFrames)
+		: aliasPoolRetireIdleFrames;
+	TracyPlot("RG.AliasPool.BudgetPressure", static_cast<int64_t>(underBudgetPressure ? 1 : 0));
 	const AutoAliasPackingStrategy previousPackingStrategy = autoAliasPackingStrategyLastFrame;
 	const AutoAliasPackingStrategy packingStrategy = m_getAutoAliasPackingStrategy
 		? m_getAutoAliasPackingStrategy()
@@ -1202,6 +1344,28 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 		}
 		return false;
 	};
+	// Resources that left the plan keep their placed backing parked (see ParkAliasedBacking) so an
+	// unchanged placement can rebind it later. Those backings point into pool memory, so they have
+	// to go whenever that memory is reallocated or retired.
+	auto releaseParkedBackingsForPool = [&](uint64_t poolID) {
+		for (auto& [resourceID, resource] : resourcesByID) {
+			if (!resource) {
+				continue;
+			}
+			if (auto* texture = dynamic_cast<PixelBuffer*>(resource.get())) {
+				const auto parked = texture->GetParkedAliasPlacement();
+				if (parked.has_value() && parked->poolID == poolID) {
+					texture->ReleaseParkedBacking();
+				}
+			}
+			else if (auto* buffer = dynamic_cast<BufferBase*>(resource.get())) {
+				const auto parked = buffer->GetParkedAliasPlacement();
+				if (parked.has_value() && parked->poolID == poolID) {
+					buffer->ReleaseParkedBacking();
+				}
+			}
+		}
+	};
 
 	std::vector<AliasResourceIndex> dedicatedSchedulingCandidateIndices;
 	dedicatedSchedulingCandidateIndices.reserve(analysis.candidateResourceIndices.size());
@@ -1287,6 +1451,35 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			poolIndependentBytes += getInfoByIndex(resourceIndex).sizeBytes;
 		}
 
+		// Opaque texture layouts don't say which bytes back a given mip or slice, so no placement
+		// may overlap a dead subresource of a live texture. The per-subresource peak is reported
+		// as the headroom a layout-aware placement could recover.
+		bool poolHasSubresourceLifetimes = false;
+		for (AliasResourceIndex resourceIndex : poolCandidateIndices) {
+			poolHasSubresourceLifetimes = poolHasSubresourceLifetimes || !getInfoByIndex(resourceIndex).subresourceFirstUse.empty();
+		}
+		if (poolHasSubresourceLifetimes) {
+			std::vector<LiveBytesEvent> wholeEvents;
+			std::vector<LiveBytesEvent> granularEvents;
+			wholeEvents.reserve(poolCandidateIndices.size() * 2);
+			for (AliasResourceIndex resourceIndex : poolCandidateIndices) {
+				const auto& info = getInfoByIndex(resourceIndex);
+				AppendLiveInterval(wholeEvents, info.firstUse, info.lastUse, info.sizeBytes);
+				if (info.subresourceFirstUse.empty()) {
+					AppendLiveInterval(granularEvents, info.firstUse, info.lastUse, info.sizeBytes);
+				}
+				else {
+					AppendSubresourceLiveIntervals(granularEvents, info);
+					autoAliasPlannerStats.subresourceTrackedTextures++;
+				}
+			}
+			const uint64_t wholePeak = PeakLiveBytes(wholeEvents);
+			const uint64_t granularPeak = PeakLiveBytes(granularEvents);
+			autoAliasPlannerStats.subresourceWholePeakBytes += wholePeak;
+			autoAliasPlannerStats.subresourceGranularPeakBytes += granularPeak;
+			autoAliasPlannerStats.subresourceEstimatedSavedBytes += wholePeak > granularPeak ? wholePeak - granularPeak : 0;
+		}
+
 		std::sort(poolCandidateIndices.begin(), poolCandidateIndices.end(), [&](AliasResourceIndex lhsIndex, AliasResourceIndex rhsIndex) {
 			const auto& lhs = getInfoByIndex(lhsIndex);
 			const auto& rhs = getInfoByIndex(rhsIndex);
@@ -1302,28 +1495,19 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			return lhs.resourceID < rhs.resourceID;
 		});
 
-		struct ActiveAllocation {
-			size_t lastUse = 0;
-			uint64_t startByte = 0;
-			uint64_t endByte = 0;
-
-			bool operator>(const ActiveAllocation& rhs) const {
-				return lastUse > rhs.lastUse;
-			}
-		};
-
-		struct FreeRange {
-			uint64_t startByte = 0;
-			uint64_t endByte = 0;
-		};
-
-		struct Placement {
-			uint64_t offset = 0;
-			uint64_t sizeBytes = 0;
-			uint64_t alignment = 1;
-			size_t firstUse = 0;
-			size_t lastUse = 0;
-		};
+		using Placement = AliasPackingPlacement;
+		std::vector<AliasPackingCandidate> packingCandidates;
+		packingCandidates.reserve(poolCandidateIndices.size());
+		for (AliasResourceIndex resourceIndex : poolCandidateIndices) {
+			const auto& info = getInfoByIndex(resourceIndex);
+			packingCandidates.push_back(AliasPackingCandidate{
+				.resourceID = info.resourceID,
+				.sizeBytes = info.sizeBytes,
+				.alignment = info.alignment,
+				.firstUse = info.firstUse,
+				.lastUse = info.lastUse,
+				});
+		}
 
 		const uint64_t planSignature = BuildAliasPoolPlanningSignature(
 			poolID,
@@ -1331,359 +1515,24 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			analysis,
 			poolCandidateIndices);
 
-		auto insertFreeRangeSortedMerged = [](std::vector<FreeRange>& ranges, FreeRange range) {
-			if (range.endByte <= range.startByte) {
-				return;
-			}
-
-			auto it = std::lower_bound(
-				ranges.begin(), ranges.end(), range.startByte,
-				[](const FreeRange& lhs, uint64_t startByte) {
-					return lhs.startByte < startByte;
-				});
-
-			size_t pos = static_cast<size_t>(it - ranges.begin());
-			ranges.insert(it, range);
-
-			if (pos > 0 && ranges[pos - 1].endByte >= ranges[pos].startByte) {
-				ranges[pos - 1].endByte = std::max(ranges[pos - 1].endByte, ranges[pos].endByte);
-				ranges.erase(ranges.begin() + static_cast<std::ptrdiff_t>(pos));
-				--pos;
-			}
-
-			while (pos + 1 < ranges.size() && ranges[pos].endByte >= ranges[pos + 1].startByte) {
-				ranges[pos].endByte = std::max(ranges[pos].endByte, ranges[pos + 1].endByte);
-				ranges.erase(ranges.begin() + static_cast<std::ptrdiff_t>(pos + 1));
-			}
-		};
-
-		auto planWithGreedySweepLine = [&]() {
-			std::priority_queue<
-				ActiveAllocation,
-				std::vector<ActiveAllocation>,
-				std::greater<ActiveAllocation>> activeByEnd;
-			std::vector<FreeRange> freeRanges;
-			std::vector<Placement> plannedPlacements(poolCandidateIndices.size());
-
-			uint64_t heapEnd = 0;
-			uint64_t poolAlignment = 1;
-
-			for (size_t candidateIndex = 0; candidateIndex < poolCandidateIndices.size(); ++candidateIndex) {
-				const auto& c = getInfoByIndex(poolCandidateIndices[candidateIndex]);
-				while (!activeByEnd.empty() && activeByEnd.top().lastUse < c.firstUse) {
-					const auto expired = activeByEnd.top();
-					insertFreeRangeSortedMerged(freeRanges, FreeRange{
-						.startByte = expired.startByte,
-						.endByte = expired.endByte,
-						});
-					activeByEnd.pop();
-				}
-
-				bool found = false;
-				size_t bestRangeIndex = std::numeric_limits<size_t>::max();
-				uint64_t bestStartByte = 0;
-				uint64_t bestSlackBytes = std::numeric_limits<uint64_t>::max();
-
-				for (size_t rangeIndex = 0; rangeIndex < freeRanges.size(); ++rangeIndex) {
-					const auto& range = freeRanges[rangeIndex];
-					const uint64_t alignedStart = AlignUpU64(range.startByte, c.alignment);
-					const uint64_t alignedEnd = alignedStart + c.sizeBytes;
-					if (alignedStart < range.startByte || alignedEnd > range.endByte) {
-						continue;
-					}
-
-					const uint64_t slackBytes = range.endByte - alignedEnd;
-					if (!found || slackBytes < bestSlackBytes || (slackBytes == bestSlackBytes && alignedStart < bestStartByte)) {
-						found = true;
-						bestRangeIndex = rangeIndex;
-						bestStartByte = alignedStart;
-						bestSlackBytes = slackBytes;
-					}
-				}
-
-				uint64_t startByte = 0;
-				if (found) {
-					const auto selected = freeRanges[bestRangeIndex];
-					startByte = bestStartByte;
-					const uint64_t endByte = startByte + c.sizeBytes;
-
-					if (selected.startByte < startByte && endByte < selected.endByte) {
-						freeRanges[bestRangeIndex].endByte = startByte;
-						freeRanges.insert(
-							freeRanges.begin() + static_cast<std::ptrdiff_t>(bestRangeIndex + 1),
-							FreeRange{
-								.startByte = endByte,
-								.endByte = selected.endByte,
-							});
-					}
-					else if (selected.startByte < startByte) {
-						freeRanges[bestRangeIndex].endByte = startByte;
-					}
-					else if (endByte < selected.endByte) {
-						freeRanges[bestRangeIndex].startByte = endByte;
-					}
-					else {
-						freeRanges.erase(freeRanges.begin() + static_cast<std::ptrdiff_t>(bestRangeIndex));
-					}
-				}
-				else {
-					startByte = AlignUpU64(heapEnd, c.alignment);
-					heapEnd = startByte + c.sizeBytes;
-				}
-
-				const uint64_t endByte = startByte + c.sizeBytes;
-				heapEnd = std::max(heapEnd, endByte);
-				poolAlignment = std::max(poolAlignment, c.alignment);
-
-				activeByEnd.push(ActiveAllocation{
-					.lastUse = c.lastUse,
-					.startByte = startByte,
-					.endByte = endByte,
-					});
-
-				plannedPlacements[candidateIndex] = Placement{
-					.offset = startByte,
-					.sizeBytes = c.sizeBytes,
-					.alignment = c.alignment,
-					.firstUse = c.firstUse,
-					.lastUse = c.lastUse,
-				};
-			}
-
-			return std::make_tuple(std::move(plannedPlacements), heapEnd, poolAlignment);
-		};
-
-		auto planWithBeamSearch = [&]() {
-			struct PlannedRange {
-				size_t candidateIndex = 0;
-				uint64_t startByte = 0;
-				uint64_t endByte = 0;
-			};
-
-			struct BeamState {
-				std::vector<PlannedRange> placedRanges;
-				std::vector<uint8_t> placedMask;
-				uint64_t heapSize = 0;
-				double score = 0.0;
-			};
-
-			std::vector<Placement> bestPlacements;
-			uint64_t bestHeapSize = std::numeric_limits<uint64_t>::max();
-			uint64_t poolAlignment = 1;
-			for (AliasResourceIndex resourceIndex : poolCandidateIndices) {
-				const auto& c = getInfoByIndex(resourceIndex);
-				poolAlignment = std::max(poolAlignment, c.alignment);
-			}
-
-			auto [greedyPlacements, greedyHeapSize, greedyAlignment] = planWithGreedySweepLine();
-			bestPlacements = std::move(greedyPlacements);
-			bestHeapSize = greedyHeapSize;
-			poolAlignment = std::max(poolAlignment, greedyAlignment);
-
-			std::vector<size_t> candidateOrder;
-			candidateOrder.reserve(poolCandidateIndices.size());
-			for (size_t i = 0; i < poolCandidateIndices.size(); ++i) {
-				candidateOrder.push_back(i);
-			}
-
-			std::sort(candidateOrder.begin(), candidateOrder.end(), [&](size_t aIdx, size_t bIdx) {
-				const auto& a = getInfoByIndex(poolCandidateIndices[aIdx]);
-				const auto& b = getInfoByIndex(poolCandidateIndices[bIdx]);
-				const uint64_t aSpan = static_cast<uint64_t>(a.lastUse - a.firstUse + 1ull);
-				const uint64_t bSpan = static_cast<uint64_t>(b.lastUse - b.firstUse + 1ull);
-				const uint64_t aWeight = a.sizeBytes * aSpan;
-				const uint64_t bWeight = b.sizeBytes * bSpan;
-				if (aWeight != bWeight) {
-					return aWeight > bWeight;
-				}
-				if (a.sizeBytes != b.sizeBytes) {
-					return a.sizeBytes > b.sizeBytes;
-				}
-				if (a.firstUse != b.firstUse) {
-					return a.firstUse < b.firstUse;
-				}
-				return a.resourceID < b.resourceID;
-			});
-
-			auto lifetimesOverlap = [&](const FrameAliasResourceInfo& lhs, const FrameAliasResourceInfo& rhs) {
-				return !(lhs.lastUse < rhs.firstUse || rhs.lastUse < lhs.firstUse);
-			};
-
-			auto intervalOverlaps = [](uint64_t aStart, uint64_t aEnd, uint64_t bStart, uint64_t bEnd) {
-				const uint64_t overlapStart = std::max(aStart, bStart);
-				const uint64_t overlapEnd = std::min(aEnd, bEnd);
-				return overlapStart < overlapEnd;
-			};
-
-			auto buildPlacementVector = [&](const std::vector<PlannedRange>& placedRanges) {
-				std::vector<Placement> out(poolCandidateIndices.size());
-				for (const auto& placed : placedRanges) {
-					const auto& c = getInfoByIndex(poolCandidateIndices[placed.candidateIndex]);
-					out[placed.candidateIndex] = Placement{
-						.offset = placed.startByte,
-						.sizeBytes = c.sizeBytes,
-						.alignment = c.alignment,
-						.firstUse = c.firstUse,
-						.lastUse = c.lastUse,
-					};
-				}
-				return out;
-			};
-
-			constexpr size_t kBeamWidth = 24;
-			constexpr size_t kCandidateStartsPerState = 8;
-			bool truncated = false;
-
-			auto scoreState = [](const BeamState& state) {
-				double wastePenalty = 0.0;
-				for (const auto& placed : state.placedRanges) {
-					wastePenalty += static_cast<double>(placed.endByte - placed.startByte);
-				}
-				return static_cast<double>(state.heapSize) + (0.000001 * wastePenalty);
-			};
-
-			BeamState initialState{};
-			initialState.heapSize = 0;
-			initialState.placedMask.assign(poolCandidateIndices.size(), 0);
-			initialState.placedRanges.reserve(poolCandidateIndices.size());
-			initialState.score = 0.0;
-
-			std::vector<BeamState> beam;
-			beam.push_back(std::move(initialState));
-
-			for (size_t depth = 0; depth < poolCandidateIndices.size() && !beam.empty(); ++depth) {
-				std::vector<BeamState> nextBeam;
-				nextBeam.reserve(beam.size() * kCandidateStartsPerState);
-
-				for (const auto& state : beam) {
-					size_t nextCandidateIndex = std::numeric_limits<size_t>::max();
-					for (size_t orderedIndex : candidateOrder) {
-						if (!state.placedMask[orderedIndex]) {
-							nextCandidateIndex = orderedIndex;
-							break;
-						}
-					}
-					if (nextCandidateIndex == std::numeric_limits<size_t>::max()) {
-						if (state.heapSize < bestHeapSize) {
-							bestHeapSize = state.heapSize;
-							bestPlacements = buildPlacementVector(state.placedRanges);
-						}
-						continue;
-					}
-
-					const auto& nextCandidate = getInfoByIndex(poolCandidateIndices[nextCandidateIndex]);
-					std::vector<uint64_t> candidateStarts;
-					candidateStarts.reserve(1 + state.placedRanges.size());
-					candidateStarts.push_back(0ull);
-
-					for (const auto& placed : state.placedRanges) {
-						const auto& placedCandidate = getInfoByIndex(poolCandidateIndices[placed.candidateIndex]);
-						if (lifetimesOverlap(nextCandidate, placedCandidate)) {
-							candidateStarts.push_back(placed.endByte);
-						}
-					}
-
-					std::vector<std::pair<uint64_t, uint64_t>> feasibleStarts;
-					feasibleStarts.reserve(candidateStarts.size());
-					std::unordered_set<uint64_t> dedupStarts;
-					dedupStarts.reserve(candidateStarts.size() * 2 + 1);
-
-					for (uint64_t rawStart : candidateStarts) {
-						const uint64_t alignedStart = AlignUpU64(rawStart, nextCandidate.alignment);
-						if (!dedupStarts.insert(alignedStart).second) {
-							continue;
-						}
-
-						const uint64_t alignedEnd = alignedStart + nextCandidate.sizeBytes;
-						bool conflicts = false;
-						for (const auto& placed : state.placedRanges) {
-							const auto& placedCandidate = getInfoByIndex(poolCandidateIndices[placed.candidateIndex]);
-							if (!lifetimesOverlap(nextCandidate, placedCandidate)) {
-								continue;
-							}
-							if (intervalOverlaps(alignedStart, alignedEnd, placed.startByte, placed.endByte)) {
-								conflicts = true;
-								break;
-							}
-						}
-
-						if (!conflicts) {
-							const uint64_t resultingHeap = std::max(state.heapSize, alignedEnd);
-							if (resultingHeap < bestHeapSize) {
-								feasibleStarts.emplace_back(alignedStart, resultingHeap);
-							}
-						}
-					}
-
-					if (feasibleStarts.empty()) {
-						const uint64_t appendStart = AlignUpU64(state.heapSize, nextCandidate.alignment);
-						const uint64_t appendEnd = appendStart + nextCandidate.sizeBytes;
-						if (appendEnd < bestHeapSize) {
-							feasibleStarts.emplace_back(appendStart, appendEnd);
-						}
-					}
-
-					std::sort(feasibleStarts.begin(), feasibleStarts.end(), [](const auto& a, const auto& b) {
-						if (a.second != b.second) {
-							return a.second < b.second;
-						}
-						return a.first < b.first;
-					});
-
-					if (feasibleStarts.size() > kCandidateStartsPerState) {
-						feasibleStarts.resize(kCandidateStartsPerState);
-						truncated = true;
-					}
-
-					for (const auto& [startByte, resultingHeap] : feasibleStarts) {
-						BeamState newState = state;
-						newState.placedMask[nextCandidateIndex] = 1;
-						newState.heapSize = resultingHeap;
-						newState.placedRanges.push_back(PlannedRange{
-							.candidateIndex = nextCandidateIndex,
-							.startByte = startByte,
-							.endByte = startByte + nextCandidate.sizeBytes,
-						});
-						newState.score = scoreState(newState);
-						nextBeam.push_back(std::move(newState));
-					}
-				}
-
-				if (nextBeam.empty()) {
-					break;
-				}
-
-				std::sort(nextBeam.begin(), nextBeam.end(), [](const BeamState& a, const BeamState& b) {
-					if (a.score != b.score) {
-						return a.score < b.score;
-					}
-					return a.heapSize < b.heapSize;
+		auto storeCachedPlan = [&](rg::alias::CachedAliasPoolPlan& cachedPlan, uint64_t signature, const std::vector<Placement>& plannedPlacements, uint64_t requiredBytes, uint64_t plannedPoolAlignment) {
+			cachedPlan.signature = signature;
+			cachedPlan.requiredBytes = requiredBytes;
+			cachedPlan.poolAlignment = plannedPoolAlignment;
+			cachedPlan.placements.clear();
+			cachedPlan.placements.reserve(poolCandidateIndices.size());
+			for (size_t candidateIndex = 0; candidateIndex < poolCandidateIndices.size() && candidateIndex < plannedPlacements.size(); ++candidateIndex) {
+				const auto& candidateInfo = getInfoByIndex(poolCandidateIndices[candidateIndex]);
+				const auto& placement = plannedPlacements[candidateIndex];
+				cachedPlan.placements.push_back(rg::alias::CachedAliasPoolPlacement{
+					.resourceID = candidateInfo.resourceID,
+					.offset = placement.offset,
+					.sizeBytes = placement.sizeBytes,
+					.alignment = placement.alignment,
+					.firstUse = placement.firstUse,
+					.lastUse = placement.lastUse,
 				});
-
-				if (nextBeam.size() > kBeamWidth) {
-					nextBeam.resize(kBeamWidth);
-					truncated = true;
-				}
-
-				beam = std::move(nextBeam);
-			}
-
-			for (const auto& state : beam) {
-				if (state.placedRanges.size() == poolCandidateIndices.size() && state.heapSize < bestHeapSize) {
-					bestHeapSize = state.heapSize;
-					bestPlacements = buildPlacementVector(state.placedRanges);
-				}
-			}
-
-			if (bestPlacements.empty()) {
-				auto [fallbackPlacements, fallbackHeapSize, fallbackAlignment] = planWithGreedySweepLine();
-				bestPlacements = std::move(fallbackPlacements);
-				bestHeapSize = fallbackHeapSize;
-				poolAlignment = std::max(poolAlignment, fallbackAlignment);
-				truncated = true;
 			}
-
-			return std::make_tuple(std::move(bestPlacements), bestHeapSize, poolAlignment, truncated);
 		};
 
 		std::vector<Placement> placements;
@@ -1734,9 +1583,57 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			}
 		}
 
+		// In-memory miss: fall back to a plan loaded from (or destined for) the on-disk cache.
+		const bool persistAliasPlans = !rg.m_aliasPlanCachePath.empty();
+		const uint64_t shapeSignature = persistAliasPlans || !persistedAliasPlanByShapeSignature.empty()
+			? BuildAliasPoolShapeSignature(poolID, packingStrategy, analysis, poolCandidateIndices)
+			: 0;
+		bool reusedPersistedPlan = false;
+		if (!reusedCachedPlan) {
+			auto persistedIt = persistedAliasPlanByShapeSignature.find(shapeSignature);
+			if (persistedIt != persistedAliasPlanByShapeSignature.end()
+				&& persistedIt->second.placements.size() == poolCandidateIndices.size()) {
+				const auto& persistedPlan = persistedIt->second;
+				AliasPackingResult persistedResult{ .heapSize = persistedPlan.requiredBytes };
+				persistedResult.placements.reserve(persistedPlan.placements.size());
+				for (size_t candidateIndex = 0; candidateIndex < persistedPlan.placements.size(); ++candidateIndex) {
+					const auto& candidateInfo = getInfoByIndex(poolCandidateIndices[candidateIndex]);
+					persistedResult.placements.push_back(Placement{
+						.offset = persistedPlan.placements[candidateIndex].offset,
+						.sizeBytes = candidateInfo.sizeBytes,
+						.alignment = candidateInfo.alignment,
+						.firstUse = candidateInfo.firstUse,
+						.lastUse = candidateInfo.lastUse,
+					});
+				}
+				// Guard against a corrupt or hash-colliding file entry: the offsets must still be
+				// aligned, in bounds and disjoint for every pair of candidates whose lifetimes in
+				// this graph overlap. A rejected entry is replaced by the plan packed below.
+				const bool persistedPlanFits = ValidateAliasPackingResult(packingCandidates, persistedResult);
+				placements = std::move(persistedResult.placements);
+				if (persistedPlanFits) {
+					heapSize = persistedPlan.requiredBytes;
+					poolAlignment = persistedPlan.poolAlignment;
+					reusedCachedPlan = true;
+					reusedPersistedPlan = true;
+					storeCachedPlan(cachedAliasPlanByPoolID[poolID], planSignature, placements, heapSize, poolAlignment);
+				}
+				else {
+					placements.clear();
+					persistedAliasPlanByShapeSignature.erase(persistedIt);
+					if (aliasLoggingEnabled) {
+						spdlog::info("RG persisted alias plan rejected: pool={} candidates={}", poolID, poolCandidateIndices.size());
+					}
+				}
+			}
+		}
+
 		if (collectAliasCacheDebugStats) {
 			if (reusedCachedPlan) {
 				++autoAliasPlannerStats.planCacheHits;
+				if (reusedPersistedPlan) {
+					++autoAliasPlannerStats.persistedPlanCacheHits;
+				}
 			}
 			else {
 				++autoAliasPlannerStats.planCacheMisses;
@@ -1758,49 +1655,25 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 		}
 
 		if (!reusedCachedPlan) {
-			switch (packingStrategy) {
-			case AutoAliasPackingStrategy::GreedySweepLine: {
-				auto [plannedPlacements, plannedHeapSize, plannedPoolAlignment] = planWithGreedySweepLine();
-				placements = std::move(plannedPlacements);
-				heapSize = plannedHeapSize;
-				poolAlignment = plannedPoolAlignment;
-				break;
-			}
-			case AutoAliasPackingStrategy::BranchAndBound: {
-				auto [plannedPlacements, plannedHeapSize, plannedPoolAlignment, searchTruncated] = planWithBeamSearch();
-				placements = std::move(plannedPlacements);
-				heapSize = plannedHeapSize;
-				poolAlignment = plannedPoolAlignment;
-				if (aliasLoggingEnabled && searchTruncated) {
-					spdlog::info(
-						"RG alias beam search truncated: pool={} candidates={} resultingRequiredBytes={}",
-						poolID,
-						poolCandidateIndices.size(),
-						heapSize);
-				}
-				break;
-			}
-			default:
-				throw std::runtime_error("Unsupported alias packing strategy");
+			AliasPackingResult planned = PackAliasPool(packingStrategy, packingCandidates);
+			placements = std::move(planned.placements);
+			heapSize = planned.heapSize;
+			poolAlignment = planned.poolAlignment;
+			if (aliasLoggingEnabled && planned.searchTruncated) {
+				spdlog::info(
+					"RG alias beam search truncated: pool={} candidates={} resultingRequiredBytes={}",
+					poolID,
+					poolCandidateIndices.size(),
+					heapSize);
 			}
 
-			auto& cachedPlan = cachedAliasPlanByPoolID[poolID];
-			cachedPlan.signature = planSignature;
-			cachedPlan.requiredBytes = heapSize;
-			cachedPlan.poolAlignment = poolAlignment;
-			cachedPlan.placements.clear();
-			cachedPlan.placements.reserve(poolCandidateIndices.size());
-			for (size_t candidateIndex = 0; candidateIndex < poolCandidateIndices.size() && candidateIndex < placements.size(); ++candidateIndex) {
-				const auto& candidateInfo = getInfoByIndex(poolCandidateIndices[candidateIndex]);
-				const auto& placement = placements[candidateIndex];
-				cachedPlan.placements.push_back(rg::alias::CachedAliasPoolPlacement{
-					.resourceID = candidateInfo.resourceID,
-					.offset = placement.offset,
-					.sizeBytes = placement.sizeBytes,
-					.alignment = placement.alignment,
-					.firstUse = placement.firstUse,
-					.lastUse = placement.lastUse,
-				});
+			storeCachedPlan(cachedAliasPlanByPoolID[poolID], planSignature, placements, heapSize, poolAlignment);
+			if (persistAliasPlans && heapSize != 0) {
+				if (persistedAliasPlanByShapeSignature.size() >= kMaxPersistedAliasPlans
+					&& !persistedAliasPlanByShapeSignature.contains(shapeSignature)) {
+					persistedAliasPlanByShapeSignature.erase(persistedAliasPlanByShapeSignature.begin());
+				}
+				storeCachedPlan(persistedAliasPlanByShapeSignature[shapeSignature], shapeSignature, placements, heapSize, poolAlignment);
 			}
 		}
 		else if (aliasLoggingEnabled) {
@@ -1822,18 +1695,55 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 		autoAliasPlannerStats.pooledIndependentBytes += poolIndependentBytes;
 
 		auto& poolState = persistentAliasPools[poolID];
-		const bool needsInitialAllocation = !static_cast<bool>(poolState.allocation);
-		const bool needsLargerHeap = heapSize > poolState.capacityBytes;
-		const bool needsHigherAlignment = poolAlignment > poolState.alignment;
+		if (aliasPoolArbiter) {
+			// Shared heaps are sized for every graph using them, so they only grow; shrinking for
+			// this graph's mode change or budget pressure would take memory other graphs need.
+			if (poolState.allocation) {
+				releaseParkedBackingsForPool(poolID);
+				DeletionManager::GetInstance().MarkForDelete(std::move(poolState.allocation));
+			}
+			const auto lease = aliasPoolArbiter->AcquirePool(&rg, poolID, heapSize, poolAlignment, effectiveGrowthHeadroom);
+			if (lease.generation != poolState.sharedGeneration) {
+				if (poolState.IsShared()) {
+					releaseParkedBackingsForPool(poolID);
+				}
+				poolState.sharedGeneration = lease.generation;
+				poolState.generation = ++aliasPoolGenerationSerial;
+				if (aliasLoggingEnabled) {
+					spdlog::info(
+						"RG alias pool leased: pool={} capacity={} required={} alignment={} placements={} generation={}",
+						poolID,
+						lease.capacityBytes,
+						heapSize,
+						lease.alignment,
+						placements.size(),
+						poolState.generation);
+				}
+			}
+			poolState.sharedAllocation = lease.allocation;
+			poolState.capacityBytes = lease.capacityBytes;
+			poolState.alignment = lease.alignment;
+			poolState.evicted = false;
+		}
+		const bool needsInitialAllocation = !aliasPoolArbiter && !static_cast<bool>(poolState.allocation);
+		const bool needsLargerHeap = !aliasPoolArbiter && heapSize > poolState.capacityBytes;
+		const bool needsHigherAlignment = !aliasPoolArbiter && poolAlignment > poolState.alignment;
 		const bool shouldShrinkForModeOrStrategyChange =
+			!aliasPoolArbiter &&
 			(modeChanged || packingStrategyChanged) &&
 			!needsInitialAllocation &&
 			poolState.capacityBytes > heapSize;
+		// Only worth a reallocation when at least an eighth of the pool is unused.
+		const bool shouldShrinkForBudgetPressure =
+			!aliasPoolArbiter &&
+			underBudgetPressure &&
+			!needsInitialAllocation &&
+			poolState.capacityBytes - std::min(poolState.capacityBytes, heapSize) >= poolState.capacityBytes / 8;
 
-		if (needsInitialAllocation || needsLargerHeap || needsHigherAlignment || shouldShrinkForModeOrStrategyChange) {
+		if (needsInitialAllocation || needsLargerHeap || needsHigherAlignment || shouldShrinkForModeOrStrategyChange || shouldShrinkForBudgetPressure) {
 			uint64_t newCapacity = heapSize;
 			if (!needsInitialAllocation && needsLargerHeap && poolState.capacityBytes > 0) {
-				const double grownTarget = static_cast<double>(poolState.capacityBytes) * static_cast<double>(aliasPoolGrowthHeadroom);
+				const double grownTarget = static_cast<double>(poolState.capacityBytes) * static_cast<double>(effectiveGrowthHeadroom);
 				const uint64_t grownCapacity = std::max<uint64_t>(
 					heapSize,
 					static_cast<uint64_t>(std::ceil(grownTarget)));
@@ -1863,20 +1773,28 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			}
 
 			if (poolState.allocation) {
+				releaseParkedBackingsForPool(poolID);
 				DeletionManager::GetInstance().MarkForDelete(std::move(poolState.allocation));
 			}
+			else if (poolState.IsShared()) {
+				// The arbiter was detached; the shared heap was released with this graph's leases.
+				releaseParkedBackingsForPool(poolID);
+			}
 
 			poolState.allocation = std::move(newAliasPool);
+			poolState.sharedAllocation = nullptr;
+			poolState.sharedGeneration = 0;
+			poolState.evicted = false;
 			poolState.capacityBytes = newCapacity;
 			poolState.alignment = poolAlignment;
-			poolState.generation++;
+			poolState.generation = ++aliasPoolGenerationSerial;
 
 			if (aliasLoggingEnabled) {
 				spdlog::info(
 					"RG alias pool {}: pool={} capacity={} required={} alignment={} placements={} generation={}",
 					needsInitialAllocation
 						? "allocated"
-						: (shouldShrinkForModeOrStrategyChange ? "resized" : "grew"),
+						: (shouldShrinkForModeOrStrategyChange || shouldShrinkForBudgetPressure ? "resized" : "grew"),
 					poolID,
 					newCapacity,
 					heapSize,
@@ -1886,6 +1804,13 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			}
 		}
 
+		if (poolState.evicted) {
+			TrackedHandle* poolAllocation = &poolState.allocation;
+			if (!DeviceManager::GetInstance().ChangeResidency(DeviceManager::ResidencyOperation::MakeResident, std::span(&poolAllocation, 1))) {
+				spdlog::error("RG alias pool {}: failed to make the evicted pool resident.", poolID);
+			}
+			poolState.evicted = false;
+		}
 		poolState.usedThisFrame = true;
 		poolState.lastUsedFrame = aliasPoolPlanFrameIndex;
 		autoAliasPlannerStats.pooledActualBytes += heapSize;
@@ -1894,7 +1819,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			poolDebug.reservedBytes = poolState.capacityBytes;
 		}
 
-		auto* allocation = poolState.allocation.GetAllocation();
+		auto* allocation = poolState.GetAllocation();
 		if (!allocation) {
 			throw std::runtime_error("Failed to allocate alias pool memory");
 		}
@@ -1919,6 +1844,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 					.startByte = placement.offset,
 					.endByte = placement.offset + c.sizeBytes,
 					.sizeBytes = c.sizeBytes,
+					.alignment = c.alignment,
 					.firstUse = c.firstUse,
 					.lastUse = c.lastUse,
 					.overlapsByteRange = false
@@ -1931,6 +1857,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 					.allocation = allocation,
 					.offset = placement.offset,
 					.poolID = poolID,
+					.poolGeneration = poolState.generation,
 				};
 				aliasMaterializeOptionsByID[c.resourceID] = RenderGraph::ResourceMaterializeOptions(options);
 			}
@@ -1940,6 +1867,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 					.allocation = allocation,
 					.offset = placement.offset,
 					.poolID = poolID,
+					.poolGeneration = poolState.generation,
 				};
 				aliasMaterializeOptionsByID[c.resourceID] = RenderGraph::ResourceMaterializeOptions(options);
 			}
@@ -2028,7 +1956,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			});
 	}
 
-	if (aliasPoolRetireIdleFrames > 0) {
+	if (effectiveRetireIdleFrames > 0) {
 		for (auto itPool = persistentAliasPools.begin(); itPool != persistentAliasPools.end(); ) {
 			auto& poolState = itPool->second;
 			if (poolState.usedThisFrame) {
@@ -2039,7 +1967,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 			const uint64_t idleFrames = (aliasPoolPlanFrameIndex > poolState.lastUsedFrame)
 				? (aliasPoolPlanFrameIndex - poolState.lastUsedFrame)
 				: 0ull;
-			if (idleFrames < aliasPoolRetireIdleFrames) {
+			if (idleFrames < effectiveRetireIdleFrames) {
 				++itPool;
 				continue;
 			}
@@ -2072,10 +2000,14 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 				aliasPlacementPoolByID.erase(resourceID);
 				aliasPlacementSignatureByID.erase(resourceID);
 			}
+			releaseParkedBackingsForPool(retiredPoolID);
 
 			if (poolState.allocation) {
 				DeletionManager::GetInstance().MarkForDelete(std::move(poolState.allocation));
 			}
+			else if (poolState.IsShared() && aliasPoolArbiter) {
+				aliasPoolArbiter->ReleasePool(&rg, retiredPoolID);
+			}
 
 			if (aliasLoggingEnabled) {
 				spdlog::info(
@@ -2091,6 +2023,39 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 		}
 	}
 
+	// Pools idle past the residency window are paged out under budget pressure, and paged back in
+	// by the next frame that plans into them, so their parked backings stay valid for a rebind.
+	{
+		const bool residencyEvictionEnabled = rg.m_getResidencyEvictionEnabled && rg.m_getResidencyEvictionEnabled();
+		// Pools are bare heaps the built-in residency path cannot page.
+		const bool evictIdlePools = rg.IsUnderResidencyBudgetPressure() && DeviceManager::HasResidencyHook();
+		if (residencyEvictionEnabled && !DeviceManager::HasResidencyHook()) {
+			static std::once_flag warnOnce;
+			std::call_once(warnOnce, [] {
+				spdlog::warn("RenderGraph: no residency hook is installed; idle alias pools stay resident under budget pressure.");
+			});
+		}
+		const uint64_t residencyIdleFrames = rg.m_getResidencyEvictionIdleFrames ? rg.m_getResidencyEvictionIdleFrames() : 60u;
+		for (auto& [poolID, poolState] : persistentAliasPools) {
+			if (poolState.usedThisFrame || !poolState.allocation) {
+				continue;
+			}
+			TrackedHandle* poolAllocation = &poolState.allocation;
+			if (poolState.evicted && !residencyEvictionEnabled) {
+				DeviceManager::GetInstance().ChangeResidency(DeviceManager::ResidencyOperation::MakeResident, std::span(&poolAllocation, 1));
+				poolState.evicted = false;
+				continue;
+			}
+			if (poolState.evicted || !evictIdlePools || aliasPoolPlanFrameIndex - poolState.lastUsedFrame < residencyIdleFrames) {
+				continue;
+			}
+			poolState.evicted = DeviceManager::GetInstance().ChangeResidency(DeviceManager::ResidencyOperation::Evict, std::span(&poolAllocation, 1));
+			if (poolState.evicted && aliasLoggingEnabled) {
+				spdlog::info("RG alias pool evicted: pool={} capacity={}", poolID, poolState.capacityBytes);
+			}
+		}
+	}
+
 	for (uint64_t resourceID : previouslyAliasedResourceIDs) {
 		if (aliasPlacementPoolByID.contains(resourceID)) {
 			continue;
@@ -2100,12 +2065,12 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 		if (itRes != resourcesByID.end() && itRes->second) {
 			auto texture = std::dynamic_pointer_cast<PixelBuffer>(itRes->second);
 			if (texture && texture->IsMaterialized()) {
-				texture->Dematerialize();
+				texture->ParkAliasedBacking();
 			}
 
 			auto buffer = std::dynamic_pointer_cast<BufferBase>(itRes->second);
 			if (buffer && buffer->IsMaterialized()) {
-				buffer->Dematerialize();
+				buffer->ParkAliasedBacking();
 			}
 		}
 
@@ -2131,6 +2096,7 @@ void rg::alias::RenderGraphAliasingSubsystem::BuildAliasPlanFromAnalysis(RenderG
 		autoAliasPlannerStats.pooledIndependentBytes > autoAliasPlannerStats.pooledActualBytes
 		? (autoAliasPlannerStats.pooledIndependentBytes - autoAliasPlannerStats.pooledActualBytes)
 		: 0;
+	TracyPlot("RG.Alias.SubresourceEstimatedSavedBytes", static_cast<int64_t>(autoAliasPlannerStats.subresourceEstimatedSavedBytes));
 
 	if (collectAliasCacheDebugStats) {
 		size_t primaryMissCount = 0;
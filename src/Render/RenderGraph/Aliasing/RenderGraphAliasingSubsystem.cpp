@@ -1,9 +1,14 @@
 #include "Render/RenderGraph/Aliasing/RenderGraphAliasingSubsystem.h"
 
 #include <algorithm>
+#include <fstream>
+
+#include <spdlog/spdlog.h>
 
 #include "Render/RenderGraph/RenderGraph.h"
 #include "Managers/Singletons/DeletionManager.h"
+#include "Resources/Buffers/DynamicBufferBase.h"
+#include "Resources/PixelBuffer.h"
 
 rg::alias::AutoAliasDebugSnapshot rg::alias::RenderGraphAliasingSubsystem::BuildDebugSnapshot(
 	AutoAliasMode mode,
@@ -27,6 +32,11 @@ rg::alias::AutoAliasDebugSnapshot rg::alias::RenderGraphAliasingSubsystem::Build
 	out.pooledSavedBytes = plannerStats.pooledSavedBytes;
 	out.planCacheHits = plannerStats.planCacheHits;
 	out.planCacheMisses = plannerStats.planCacheMisses;
+	out.persistedPlanCacheHits = plannerStats.persistedPlanCacheHits;
+	out.subresourceTrackedTextures = plannerStats.subresourceTrackedTextures;
+	out.subresourceWholePeakBytes = plannerStats.subresourceWholePeakBytes;
+	out.subresourceGranularPeakBytes = plannerStats.subresourceGranularPeakBytes;
+	out.subresourceEstimatedSavedBytes = plannerStats.subresourceEstimatedSavedBytes;
 	out.primaryPlanCacheMissReason = plannerStats.primaryPlanCacheMissReason != nullptr
 		? plannerStats.primaryPlanCacheMissReason
 		: std::string{};
@@ -64,6 +74,16 @@ void rg::alias::RenderGraphAliasingSubsystem::ResetPersistentState(RenderGraph&
 	renderGraph.cachedAliasPlanByPoolID.clear();
 	renderGraph.m_aliasStaticInfoCacheByResourceID.clear();
 
+	for (auto& [resourceID, resource] : renderGraph.resourcesByID) {
+		(void)resourceID;
+		if (auto* texture = dynamic_cast<PixelBuffer*>(resource.get())) {
+			texture->ReleaseParkedBacking();
+		}
+		else if (auto* buffer = dynamic_cast<BufferBase*>(resource.get())) {
+			buffer->ReleaseParkedBacking();
+		}
+	}
+
 	for (auto& [poolID, poolState] : renderGraph.persistentAliasPools) {
 		(void)poolID;
 		if (poolState.allocation) {
@@ -71,5 +91,98 @@ void rg::alias::RenderGraphAliasingSubsystem::ResetPersistentState(RenderGraph&
 		}
 	}
 	renderGraph.persistentAliasPools.clear();
+	if (renderGraph.m_aliasPoolArbiter) {
+		renderGraph.m_aliasPoolArbiter->ReleaseOwner(&renderGraph);
+	}
 	renderGraph.aliasPoolPlanFrameIndex = 0;
 }
+
+namespace {
+	// File layout: magic, version, plan count, then per plan its shape signature, required bytes,
+	// pool alignment, placement count and each placement's offset. Sizes, alignments and lifetimes
+	// are implied by the shape signature, so only offsets are stored.
+	constexpr uint64_t kAliasPlanCacheMagic = 0x4e414c5041475230ull; // "0RGAPLAN"
+	constexpr uint32_t kAliasPlanCacheVersion = 2;
+	constexpr uint64_t kMaxPersistedPlacementsPerPlan = 1u << 20;
+
+	template<typename T>
+	void WriteAliasPlanValue(std::ofstream& out, const T& value) {
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template<typename T>
+	bool ReadAliasPlanValue(std::ifstream& in, T& value) {
+		in.read(reinterpret_cast<char*>(&value), sizeof(T));
+		return static_cast<bool>(in);
+	}
+}
+
+bool rg::alias::RenderGraphAliasingSubsystem::LoadPersistedAliasPlans(RenderGraph& renderGraph, const std::filesystem::path& path) const {
+	std::ifstream in(path, std::ios::binary);
+	if (!in) {
+		return false;
+	}
+
+	uint64_t magic = 0;
+	uint32_t version = 0;
+	uint64_t planCount = 0;
+	if (!ReadAliasPlanValue(in, magic) || !ReadAliasPlanValue(in, version) || !ReadAliasPlanValue(in, planCount)
+		|| magic != kAliasPlanCacheMagic || version != kAliasPlanCacheVersion) {
+		spdlog::warn("RG alias plan cache '{}' has an unknown format; ignoring it", path.string());
+		return false;
+	}
+
+	std::unordered_map<uint64_t, CachedAliasPoolPlan> plans;
+	plans.reserve(static_cast<size_t>(std::min<uint64_t>(planCount, 1024)));
+	for (uint64_t planIndex = 0; planIndex < planCount; ++planIndex) {
+		CachedAliasPoolPlan plan{};
+		uint64_t placementCount = 0;
+		if (!ReadAliasPlanValue(in, plan.signature)
+			|| !ReadAliasPlanValue(in, plan.requiredBytes)
+			|| !ReadAliasPlanValue(in, plan.poolAlignment)
+			|| !ReadAliasPlanValue(in, placementCount)
+			|| placementCount > kMaxPersistedPlacementsPerPlan) {
+			spdlog::warn("RG alias plan cache '{}' is truncated or corrupt; ignoring it", path.string());
+			return false;
+		}
+		plan.placements.resize(static_cast<size_t>(placementCount));
+		for (auto& placement : plan.placements) {
+			if (!ReadAliasPlanValue(in, placement.offset)) {
+				spdlog::warn("RG alias plan cache '{}' is truncated or corrupt; ignoring it", path.string());
+				return false;
+			}
+		}
+		plans[plan.signature] = std::move(plan);
+	}
+
+	renderGraph.persistedAliasPlanByShapeSignature = std::move(plans);
+	return true;
+}
+
+bool rg::alias::RenderGraphAliasingSubsystem::SavePersistedAliasPlans(const RenderGraph& renderGraph, const std::filesystem::path& path) const {
+	std::error_code ec;
+	if (path.has_parent_path()) {
+		std::filesystem::create_directories(path.parent_path(), ec);
+	}
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		spdlog::warn("RG alias plan cache '{}' could not be opened for writing", path.string());
+		return false;
+	}
+
+	const auto& plans = renderGraph.persistedAliasPlanByShapeSignature;
+	WriteAliasPlanValue(out, kAliasPlanCacheMagic);
+	WriteAliasPlanValue(out, kAliasPlanCacheVersion);
+	WriteAliasPlanValue(out, static_cast<uint64_t>(plans.size()));
+	for (const auto& [shapeSignature, plan] : plans) {
+		WriteAliasPlanValue(out, shapeSignature);
+		WriteAliasPlanValue(out, plan.requiredBytes);
+		WriteAliasPlanValue(out, plan.poolAlignment);
+		WriteAliasPlanValue(out, static_cast<uint64_t>(plan.placements.size()));
+		for (const auto& placement : plan.placements) {
+			WriteAliasPlanValue(out, placement.offset);
+		}
+	}
+	return static_cast<bool>(out);
+}
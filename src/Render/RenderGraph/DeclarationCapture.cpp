@@ -0,0 +1,345 @@
+#include "Render/RenderGraph/DeclarationCapture.h"
+
+#include <algorithm>
+#include <fstream>
+#include <type_traits>
+#include <unordered_set>
+#include <spdlog/spdlog.h>
+
+#include "Render/RenderGraph/RenderGraph.h"
+#include "Resources/DynamicResource.h"
+
+namespace {
+	// File layout: magic, version, frame serial, then the passes (name, type, queue preference,
+	// pinned slot, flags, requirements, internal transitions), the resources and the explicit
+	// edges, each list prefixed by its count. Strings are a length followed by the bytes.
+	constexpr uint64_t kDeclarationCaptureMagic = 0x54504143434c4447ull; // "GDLCCAPT"
+	constexpr uint32_t kDeclarationCaptureVersion = 1;
+	constexpr uint64_t kMaxCapturedListSize = 1u << 24;
+	constexpr uint64_t kMaxCapturedStringSize = 1u << 16;
+
+	template<typename T>
+	void WriteCaptureValue(std::ofstream& out, const T& value) {
+		static_assert(std::is_trivially_copyable_v<T>);
+		out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	template<typename T>
+	bool ReadCaptureValue(std::ifstream& in, T& value) {
+		static_assert(std::is_trivially_copyable_v<T>);
+		in.read(reinterpret_cast<char*>(&value), sizeof(T));
+		return static_cast<bool>(in);
+	}
+
+	void WriteCaptureString(std::ofstream& out, const std::string& value) {
+		WriteCaptureValue(out, static_cast<uint64_t>(value.size()));
+		out.write(value.data(), static_cast<std::streamsize>(value.size()));
+	}
+
+	bool ReadCaptureString(std::ifstream& in, std::string& value) {
+		uint64_t size = 0;
+		if (!ReadCaptureValue(in, size) || size > kMaxCapturedStringSize) {
+			return false;
+		}
+		value.resize(static_cast<size_t>(size));
+		in.read(value.data(), static_cast<std::streamsize>(size));
+		return static_cast<bool>(in);
+	}
+
+	bool ReadCaptureCount(std::ifstream& in, uint64_t& count) {
+		return ReadCaptureValue(in, count) && count <= kMaxCapturedListSize;
+	}
+
+	template<typename T>
+	void WriteCaptureOptional(std::ofstream& out, const std::optional<T>& value) {
+		WriteCaptureValue(out, static_cast<uint8_t>(value.has_value() ? 1 : 0));
+		WriteCaptureValue(out, value.value_or(T{}));
+	}
+
+	template<typename T>
+	bool ReadCaptureOptional(std::ifstream& in, std::optional<T>& value) {
+		uint8_t present = 0;
+		T stored{};
+		if (!ReadCaptureValue(in, present) || !ReadCaptureValue(in, stored)) {
+			return false;
+		}
+		value = present ? std::optional<T>(stored) : std::nullopt;
+		return true;
+	}
+
+	void WriteCaptureRequirements(std::ofstream& out, const std::vector<rg::capture::CapturedRequirement>& requirements) {
+		WriteCaptureValue(out, static_cast<uint64_t>(requirements.size()));
+		for (const auto& req : requirements) {
+			WriteCaptureValue(out, req.resourceID);
+			WriteCaptureValue(out, req.range);
+			WriteCaptureValue(out, req.state);
+		}
+	}
+
+	bool ReadCaptureRequirements(std::ifstream& in, std::vector<rg::capture::CapturedRequirement>& requirements) {
+		uint64_t count = 0;
+		if (!ReadCaptureCount(in, count)) {
+			return false;
+		}
+		requirements.resize(static_cast<size_t>(count));
+		for (auto& req : requirements) {
+			if (!ReadCaptureValue(in, req.resourceID) || !ReadCaptureValue(in, req.range) || !ReadCaptureValue(in, req.state)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	const Resource* UnwrapCapturedResource(const Resource* resource) {
+		while (auto* dynamicResource = dynamic_cast<const DynamicResource*>(resource)) {
+			resource = dynamicResource->GetResource().get();
+		}
+		return resource;
+	}
+}
+
+bool rg::capture::SaveFrameDeclarationCapture(const FrameDeclarationCapture& capture, const std::filesystem::path& path) {
+	std::error_code ec;
+	if (path.has_parent_path()) {
+		std::filesystem::create_directories(path.parent_path(), ec);
+	}
+
+	std::ofstream out(path, std::ios::binary | std::ios::trunc);
+	if (!out) {
+		spdlog::warn("RG declaration capture '{}' could not be opened for writing", path.string());
+		return false;
+	}
+
+	WriteCaptureValue(out, kDeclarationCaptureMagic);
+	WriteCaptureValue(out, kDeclarationCaptureVersion);
+	WriteCaptureValue(out, capture.frameSerial);
+
+	WriteCaptureValue(out, static_cast<uint64_t>(capture.passes.size()));
+	for (const auto& pass : capture.passes) {
+		WriteCaptureString(out, pass.name);
+		WriteCaptureValue(out, pass.type);
+		WriteCaptureValue(out, pass.preferredQueueKind);
+		WriteCaptureValue(out, pass.queueAssignmentPolicy);
+		WriteCaptureOptional(out, pass.pinnedQueueSlot);
+		WriteCaptureValue(out, static_cast<uint8_t>(pass.isGeometryPass ? 1 : 0));
+		WriteCaptureValue(out, static_cast<uint8_t>(pass.frameExtension ? 1 : 0));
+		WriteCaptureRequirements(out, pass.requirements);
+		WriteCaptureRequirements(out, pass.internalTransitions);
+	}
+
+	WriteCaptureValue(out, static_cast<uint64_t>(capture.resources.size()));
+	for (const auto& resource : capture.resources) {
+		WriteCaptureValue(out, resource.resourceID);
+		WriteCaptureString(out, resource.name);
+		WriteCaptureValue(out, resource.kind);
+		WriteCaptureValue(out, static_cast<uint8_t>(resource.allowAlias ? 1 : 0));
+		WriteCaptureOptional(out, resource.aliasingPoolID);
+		WriteCaptureValue(out, resource.width);
+		WriteCaptureValue(out, resource.height);
+		WriteCaptureValue(out, resource.mipLevels);
+		WriteCaptureValue(out, resource.arraySize);
+		WriteCaptureValue(out, resource.format);
+		const uint8_t textureFlags = (resource.isCubemap ? 1u : 0u) | (resource.hasRTV ? 2u : 0u)
+			| (resource.hasDSV ? 4u : 0u) | (resource.hasUAV ? 8u : 0u) | (resource.hasSRV ? 16u : 0u);
+		WriteCaptureValue(out, textureFlags);
+		WriteCaptureValue(out, resource.sizeBytes);
+		WriteCaptureValue(out, resource.heapType);
+		WriteCaptureValue(out, static_cast<uint8_t>(resource.unorderedAccess ? 1 : 0));
+	}
+
+	WriteCaptureValue(out, static_cast<uint64_t>(capture.explicitAfterEdges.size()));
+	for (const auto& [anchor, pass] : capture.explicitAfterEdges) {
+		WriteCaptureString(out, anchor);
+		WriteCaptureString(out, pass);
+	}
+	return static_cast<bool>(out);
+}
+
+bool rg::capture::LoadFrameDeclarationCapture(const std::filesystem::path& path, FrameDeclarationCapture& out) {
+	std::ifstream in(path, std::ios::binary);
+	if (!in) {
+		return false;
+	}
+
+	uint64_t magic = 0;
+	uint32_t version = 0;
+	FrameDeclarationCapture capture;
+	if (!ReadCaptureValue(in, magic) || !ReadCaptureValue(in, version)
+		|| magic != kDeclarationCaptureMagic || version != kDeclarationCaptureVersion) {
+		spdlog::warn("RG declaration capture '{}' has an unknown format; ignoring it", path.string());
+		return false;
+	}
+
+	auto corrupt = [&]() {
+		spdlog::warn("RG declaration capture '{}' is truncated or corrupt; ignoring it", path.string());
+		return false;
+	};
+
+	uint64_t passCount = 0;
+	if (!ReadCaptureValue(in, capture.frameSerial) || !ReadCaptureCount(in, passCount)) {
+		return corrupt();
+	}
+	capture.passes.resize(static_cast<size_t>(passCount));
+	for (auto& pass : capture.passes) {
+		uint8_t isGeometryPass = 0;
+		uint8_t frameExtension = 0;
+		if (!ReadCaptureString(in, pass.name)
+			|| !ReadCaptureValue(in, pass.type)
+			|| !ReadCaptureValue(in, pass.preferredQueueKind)
+			|| !ReadCaptureValue(in, pass.queueAssignmentPolicy)
+			|| !ReadCaptureOptional(in, pass.pinnedQueueSlot)
+			|| !ReadCaptureValue(in, isGeometryPass)
+			|| !ReadCaptureValue(in, frameExtension)
+			|| !ReadCaptureRequirements(in, pass.requirements)
+			|| !ReadCaptureRequirements(in, pass.internalTransitions)) {
+			return corrupt();
+		}
+		pass.isGeometryPass = isGeometryPass != 0;
+		pass.frameExtension = frameExtension != 0;
+	}
+
+	uint64_t resourceCount = 0;
+	if (!ReadCaptureCount(in, resourceCount)) {
+		return corrupt();
+	}
+	capture.resources.resize(static_cast<size_t>(resourceCount));
+	for (auto& resource : capture.resources) {
+		uint8_t allowAlias = 0;
+		uint8_t textureFlags = 0;
+		uint8_t unorderedAccess = 0;
+		if (!ReadCaptureValue(in, resource.resourceID)
+			|| !ReadCaptureString(in, resource.name)
+			|| !ReadCaptureValue(in, resource.kind)
+			|| !ReadCaptureValue(in, allowAlias)
+			|| !ReadCaptureOptional(in, resource.aliasingPoolID)
+			|| !ReadCaptureValue(in, resource.width)
+			|| !ReadCaptureValue(in, resource.height)
+			|| !ReadCaptureValue(in, resource.mipLevels)
+			|| !ReadCaptureValue(in, resource.arraySize)
+			|| !ReadCaptureValue(in, resource.format)
+			|| !ReadCaptureValue(in, textureFlags)
+			|| !ReadCaptureValue(in, resource.sizeBytes)
+			|| !ReadCaptureValue(in, resource.heapType)
+			|| !ReadCaptureValue(in, unorderedAccess)) {
+			return corrupt();
+		}
+		resource.allowAlias = allowAlias != 0;
+		resource.isCubemap = (textureFlags & 1u) != 0;
+		resource.hasRTV = (textureFlags & 2u) != 0;
+		resource.hasDSV = (textureFlags & 4u) != 0;
+		resource.hasUAV = (textureFlags & 8u) != 0;
+		resource.hasSRV = (textureFlags & 16u) != 0;
+		resource.unorderedAccess = unorderedAccess != 0;
+	}
+
+	uint64_t edgeCount = 0;
+	if (!ReadCaptureCount(in, edgeCount)) {
+		return corrupt();
+	}
+	capture.explicitAfterEdges.resize(static_cast<size_t>(edgeCount));
+	for (auto& [anchor, pass] : capture.explicitAfterEdges) {
+		if (!ReadCaptureString(in, anchor) || !ReadCaptureString(in, pass)) {
+			return corrupt();
+		}
+	}
+
+	out = std::move(capture);
+	return true;
+}
+
+rg::capture::FrameDeclarationCapture RenderGraph::BuildFrameDeclarationCapture(
+	const std::vector<std::pair<std::string, std::string>>& explicitAfterByName) const {
+	ZoneScopedN("RenderGraph::BuildFrameDeclarationCapture");
+	rg::capture::FrameDeclarationCapture capture;
+	capture.frameSerial = m_lastCompileTimings.compileFrameCount;
+	capture.explicitAfterEdges = explicitAfterByName;
+	capture.passes.reserve(m_framePasses.size());
+
+	std::unordered_set<uint64_t> capturedResourceIDs;
+	auto captureResource = [&](const ResourceRegistry::RegistryHandle& handle) {
+		const uint64_t resourceID = handle.GetGlobalResourceID();
+		if (!capturedResourceIDs.insert(resourceID).second) {
+			return;
+		}
+		const Resource* resource = _registry.Resolve(handle);
+		if (!resource) {
+			if (auto it = resourcesByID.find(resourceID); it != resourcesByID.end()) {
+				resource = it->second.get();
+			}
+		}
+
+		rg::capture::CapturedResource captured;
+		captured.resourceID = resourceID;
+		if (resource) {
+			captured.name = resource->GetName();
+		}
+		resource = UnwrapCapturedResource(resource);
+		if (auto* texture = dynamic_cast<const PixelBuffer*>(resource)) {
+			const auto& desc = texture->GetDescription();
+			captured.kind = rg::capture::CapturedResourceKind::Texture;
+			captured.allowAlias = desc.allowAlias;
+			captured.aliasingPoolID = desc.aliasingPoolID;
+			captured.width = texture->GetWidth();
+			captured.height = texture->GetHeight();
+			captured.mipLevels = texture->GetMipLevels();
+			captured.arraySize = texture->GetArraySize();
+			captured.format = desc.format;
+			captured.isCubemap = desc.isCubemap;
+			captured.hasRTV = desc.hasRTV;
+			captured.hasDSV = desc.hasDSV;
+			captured.hasUAV = desc.hasUAV;
+			captured.hasSRV = desc.hasSRV;
+		}
+		else if (auto* buffer = dynamic_cast<const BufferBase*>(resource)) {
+			captured.kind = rg::capture::CapturedResourceKind::Buffer;
+			captured.allowAlias = buffer->IsAliasingAllowed();
+			captured.aliasingPoolID = buffer->GetAliasingPoolHint();
+			captured.sizeBytes = buffer->GetBufferSize();
+			captured.heapType = buffer->GetAccessType();
+			captured.unorderedAccess = buffer->IsUnorderedAccessEnabled();
+		}
+		capture.resources.push_back(std::move(captured));
+	};
+
+	for (size_t passIndex = 0; passIndex < m_framePasses.size(); ++passIndex) {
+		const auto& pr = m_framePasses[passIndex];
+		rg::capture::CapturedPass captured;
+		captured.frameExtension = passIndex < m_framePassIsFrameExtension.size() && m_framePassIsFrameExtension[passIndex] != 0;
+		std::visit([&](const auto& p) {
+			using PassT = std::decay_t<decltype(p)>;
+			if constexpr (!std::is_same_v<PassT, std::monostate>) {
+				captured.name = p.name;
+				captured.preferredQueueKind = p.resources.preferredQueueKind;
+				captured.queueAssignmentPolicy = p.resources.queueAssignmentPolicy;
+				if (p.resources.pinnedQueueSlot) {
+					captured.pinnedQueueSlot = static_cast<uint8_t>(*p.resources.pinnedQueueSlot);
+				}
+				if constexpr (std::is_same_v<PassT, RenderPassAndResources>) {
+					captured.type = rg::capture::CapturedPassType::Render;
+					captured.isGeometryPass = p.resources.isGeometryPass;
+				}
+				else if constexpr (std::is_same_v<PassT, ComputePassAndResources>) {
+					captured.type = rg::capture::CapturedPassType::Compute;
+				}
+				else {
+					captured.type = rg::capture::CapturedPassType::Copy;
+				}
+				captured.requirements.reserve(GetFrameRequirementCount(p.resources));
+				ForEachFrameRequirement(p.resources, [&](const ResourceRequirement& req) {
+					captureResource(req.resourceHandleAndRange.resource);
+					captured.requirements.push_back({ req.resourceHandleAndRange.resource.GetGlobalResourceID(), req.resourceHandleAndRange.range, req.state });
+				});
+				for (const auto& [handleAndRange, state] : p.resources.internalTransitions) {
+					captureResource(handleAndRange.resource);
+					captured.internalTransitions.push_back({ handleAndRange.resource.GetGlobalResourceID(), handleAndRange.range, state });
+				}
+			}
+		}, pr.pass);
+		capture.passes.push_back(std::move(captured));
+	}
+
+	std::sort(capture.resources.begin(), capture.resources.end(), [](const auto& a, const auto& b) {
+		return a.resourceID < b.resourceID;
+	});
+	return capture;
+}
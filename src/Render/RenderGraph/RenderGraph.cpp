@@ -2,28 +2,37 @@
 
 #include <span>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <map>
+#include <mutex>
 #include <chrono>
 #include <filesystem>
 #include <fstream>
 #include <limits>
 #include <numeric>
 #include <optional>
+#include <queue>
 #include <sstream>
 #include <tracy/Tracy.hpp>
 #include <rhi_helpers.h>
 #include <rhi_debug.h>
 #include <random>
+#include <type_traits>
 
 #include "Render/PassExecutionContext.h"
 #include "Utilities/ORGUtilities.h"
+#include "Managers/Singletons/DebugDumpWriter.h"
 #include "Managers/Singletons/DeviceManager.h"
 #include "Managers/Singletons/DeletionManager.h"
 #include "Managers/Singletons/DescriptorHeapManager.h"
+#include "Managers/Singletons/FenceWaiter.h"
+#include "Managers/Singletons/FrameTraceWriter.h"
 #include "Managers/Singletons/UploadManager.h"
 #include "Managers/Singletons/StatisticsManager.h"
+#include "Managers/Singletons/TextureRecyclePool.h"
 #include "Render/PassBuilders.h"
+#include "RenderPasses/Base/TimeSlicedComputePass.h"
 #include "Resources/ResourceGroup.h"
 #include "Managers/CommandRecordingManager.h"
 #include "Interfaces/IHasMemoryMetadata.h"
@@ -163,17 +172,11 @@ namespace {
 	bool TryGetWholeResourceTrackerState(const SymbolicTracker& tracker, ResourceState& outState);
 
 	uint64_t HashCombine64(uint64_t seed, uint64_t value) noexcept {
-		seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
-		return seed;
+		return rg::util::HashMix64(seed, value);
 	}
 
 	uint64_t HashString64(std::string_view value) noexcept {
-		uint64_t hash = 0xcbf29ce484222325ull;
-		for (char c : value) {
-			hash ^= static_cast<uint8_t>(c);
-			hash *= 0x100000001b3ull;
-		}
-		return hash;
+		return rg::util::HashString64(value);
 	}
 
 	constexpr QueueKind DefaultPreferredQueueKind(RenderGraph::PassType type) noexcept {
@@ -342,6 +345,32 @@ namespace {
 		return true;
 	}
 
+	template<typename Flags, typename SupportsFn>
+	Flags MaskFlagsForQueue(QueueKind queue, Flags merged, Flags required, SupportsFn supports) {
+		using Bits = std::underlying_type_t<Flags>;
+		Bits kept = static_cast<Bits>(required);
+		for (Bits remaining = static_cast<Bits>(merged) & ~kept; remaining != 0; remaining &= remaining - 1) {
+			const Bits bit = remaining & (~remaining + 1);
+			if (supports(queue, static_cast<Flags>(bit))) {
+				kept |= bit;
+			}
+		}
+		return static_cast<Flags>(kept);
+	}
+
+	// Merged read runs span passes on every queue. Narrow the run's state to the bits the
+	// consuming pass's queue can transition to, keeping the pass's own requirement, so a compute
+	// or copy read never picks up graphics-only bits and falls back to the graphics queue.
+	// Returns false when nothing beyond the requirement survives.
+	bool TryMaskMergedReadStateForQueue(QueueKind queue, const ResourceState& required, ResourceState& merged) {
+		if (merged.layout != required.layout && !QueueSupportsLayout(queue, merged.layout)) {
+			return false;
+		}
+		merged.access = MaskFlagsForQueue(queue, merged.access, required.access, QueueSupportsAccessType);
+		merged.sync = MaskFlagsForQueue(queue, merged.sync, required.sync, QueueSupportsSyncState);
+		return !StatesExactlyEqual(merged, required);
+	}
+
 	const char* QueueKindToString(QueueKind queue) noexcept {
 		switch (queue) {
 		case QueueKind::Graphics: return "Graphics";
@@ -462,6 +491,7 @@ RenderGraph::AnyPassAndResources RenderGraph::MaterializeExternalPass(
 		par.pass = std::move(rp);
 		par.name = d.name;
 		par.techniquePath = d.techniquePath;
+		par.passId = AcquirePassId(d.name);
 		par.collectStatistics = d.collectStatistics;
 		{
 			RenderPassBuilder b(this, d.name);
@@ -484,16 +514,20 @@ RenderGraph::AnyPassAndResources RenderGraph::MaterializeExternalPass(
 					b.DeclaredResourceIds().size());
 			}
 			par.resources.staticResourceRequirements = b.GatherResourceRequirements();
-			par.resources.internalTransitions = b.params.internalTransitions;
-			par.resources.identifierSet = b.DeclaredResourceIds();
-			par.resources.autoDescriptorShaderResources = b.params.autoDescriptorShaderResources;
-			par.resources.autoDescriptorConstantBuffers = b.params.autoDescriptorConstantBuffers;
-			par.resources.autoDescriptorUnorderedAccessViews = b.params.autoDescriptorUnorderedAccessViews;
-			par.resources.activeFeatureDomains = b.params.activeFeatureDomains;
+			par.resources.internalTransitions = std::move(b.params.internalTransitions);
+			par.resources.fullOverwriteResources = std::move(b.params.fullOverwriteResources);
+			par.resources.identifierSet = std::move(b._declaredIds);
+			par.resources.autoDescriptorShaderResources = std::move(b.params.autoDescriptorShaderResources);
+			par.resources.autoDescriptorConstantBuffers = std::move(b.params.autoDescriptorConstantBuffers);
+			par.resources.autoDescriptorUnorderedAccessViews = std::move(b.params.autoDescriptorUnorderedAccessViews);
+			par.resources.activeFeatureDomains = std::move(b.params.activeFeatureDomains);
+			par.resources.predication = b.params.predication;
+			par.resources.memberFeatureDomains = std::move(b.params.memberFeatureDomains);
 			par.resources.isGeometryPass = b.params.isGeometryPass;
 			par.resources.preferredQueueKind = ResolveExternalPreferredQueueKind(d);
 			par.resources.queueAssignmentPolicy = ResolveExternalQueueAssignmentPolicy(d);
 			par.resources.pinnedQueueSlot = d.pinnedQueueSlot;
+			par.resources.latencyCritical = d.latencyCritical;
 			if (materializeReferencedResources) {
 				if (traceLifecycle) {
 					spdlog::info("RG materialize external render pass '{}' materialize referenced resources begin", d.name);
@@ -536,6 +570,7 @@ RenderGraph::AnyPassAndResources RenderGraph::MaterializeExternalPass(
 		par.pass = std::move(cp);
 		par.name = d.name;
 		par.techniquePath = d.techniquePath;
+		par.passId = AcquirePassId(d.name);
 		par.collectStatistics = d.collectStatistics;
 		{
 			ComputePassBuilder b(this, d.name);
@@ -557,15 +592,19 @@ RenderGraph::AnyPassAndResources RenderGraph::MaterializeExternalPass(
 					b.DeclaredResourceIds().size());
 			}
 			par.resources.staticResourceRequirements = b.GatherResourceRequirements();
-			par.resources.internalTransitions = b.params.internalTransitions;
-			par.resources.identifierSet = b.DeclaredResourceIds();
-			par.resources.autoDescriptorShaderResources = b.params.autoDescriptorShaderResources;
-			par.resources.autoDescriptorConstantBuffers = b.params.autoDescriptorConstantBuffers;
-			par.resources.autoDescriptorUnorderedAccessViews = b.params.autoDescriptorUnorderedAccessViews;
-			par.resources.activeFeatureDomains = b.params.activeFeatureDomains;
+			par.resources.internalTransitions = std::move(b.params.internalTransitions);
+			par.resources.fullOverwriteResources = std::move(b.params.fullOverwriteResources);
+			par.resources.identifierSet = std::move(b._declaredIds);
+			par.resources.autoDescriptorShaderResources = std::move(b.params.autoDescriptorShaderResources);
+			par.resources.autoDescriptorConstantBuffers = std::move(b.params.autoDescriptorConstantBuffers);
+			par.resources.autoDescriptorUnorderedAccessViews = std::move(b.params.autoDescriptorUnorderedAccessViews);
+			par.resources.activeFeatureDomains = std::move(b.params.activeFeatureDomains);
+			par.resources.predication = b.params.predication;
+			par.resources.memberFeatureDomains = std::move(b.params.memberFeatureDomains);
 			par.resources.preferredQueueKind = ResolveExternalPreferredQueueKind(d);
 			par.resources.queueAssignmentPolicy = ResolveExternalQueueAssignmentPolicy(d);
 			par.resources.pinnedQueueSlot = d.pinnedQueueSlot;
+			par.resources.latencyCritical = d.latencyCritical;
 			if (materializeReferencedResources) {
 				if (traceLifecycle) {
 					spdlog::info("RG materialize external compute pass '{}' materialize referenced resources begin", d.name);
@@ -608,6 +647,7 @@ RenderGraph::AnyPassAndResources RenderGraph::MaterializeExternalPass(
 		par.pass = std::move(cp);
 		par.name = d.name;
 		par.techniquePath = d.techniquePath;
+		par.passId = AcquirePassId(d.name);
 		par.collectStatistics = d.collectStatistics;
 		{
 			CopyPassBuilder b(this, d.name);
@@ -629,11 +669,13 @@ RenderGraph::AnyPassAndResources RenderGraph::MaterializeExternalPass(
 					b.DeclaredResourceIds().size());
 			}
 			par.resources.staticResourceRequirements = b.GatherResourceRequirements();
-			par.resources.internalTransitions = b.params.internalTransitions;
-			par.resources.identifierSet = b.DeclaredResourceIds();
+			par.resources.internalTransitions = std::move(b.params.internalTransitions);
+			par.resources.fullOverwriteResources = std::move(b.params.fullOverwriteResources);
+			par.resources.identifierSet = std::move(b._declaredIds);
 			par.resources.preferredQueueKind = ResolveExternalPreferredQueueKind(d);
 			par.resources.queueAssignmentPolicy = ResolveExternalQueueAssignmentPolicy(d);
 			par.resources.pinnedQueueSlot = d.pinnedQueueSlot;
+			par.resources.latencyCritical = d.latencyCritical;
 			if (materializeReferencedResources) {
 				if (traceLifecycle) {
 					spdlog::info("RG materialize external copy pass '{}' materialize referenced resources begin", d.name);
@@ -1210,7 +1252,6 @@ void RenderGraph::WriteCompiledGraphDebugDump(uint8_t frameIndex, const std::vec
 			dumpDir.clear();
 		}
 		dumpDir /= "rendergraph_dumps";
-		fs::create_directories(dumpDir, fsError);
 
 		std::random_device rd;
 
@@ -1221,14 +1262,10 @@ void RenderGraph::WriteCompiledGraphDebugDump(uint8_t frameIndex, const std::vec
 		
 		std::string nameStr = "rendergraph_compiled_state_" + std::to_string(distr(gen));
 
+		// The text reads live graph state, so it is built here; only the file I/O is deferred.
 		const fs::path dumpPath = dumpDir / nameStr;
-		std::ofstream outFile(dumpPath, std::ios::out | std::ios::trunc);
-		if (!outFile.is_open()) {
-			spdlog::warn("Failed to open render graph debug dump '{}'", dumpPath.string());
-			return;
-		}
-		outFile << dump.str();
-		outFile.close();
+		DebugDumpWriter::GetInstance().Submit(DebugDumpChannel::CompiledGraph, dumpPath,
+			[text = dump.str()]() mutable { return std::move(text); });
 
 		static bool announcedDumpPath = false;
 		if (!announcedDumpPath) {
@@ -1290,177 +1327,191 @@ void RenderGraph::WriteVramUsageDebugDump(uint8_t frameIndex) const
 
 		std::vector<rg::memory::ResourceMemoryRecord> memoryRecords;
 		m_memorySnapshotProvider.BuildSnapshot(memoryRecords);
+		const AutoAliasDebugSnapshot aliasSnapshot = GetAutoAliasDebugSnapshot();
 
-		std::unordered_map<std::string, DumpCategoryRow> categoriesByLabel;
-		categoriesByLabel.reserve(memoryRecords.size() * 2 + 8);
-		uint64_t totalBytes = 0;
-
-		for (const auto& record : memoryRecords) {
-			totalBytes += record.bytes;
-			const char* usage = record.usage.empty() ? "Unspecified" : record.usage.c_str();
-			std::string categoryLabel = std::string(majorCategory(record.resourceType)) + "/" + usage;
-			auto& category = categoriesByLabel[categoryLabel];
-			category.label = std::move(categoryLabel);
-			category.bytes += record.bytes;
-			category.resourceCount += 1;
-		}
-
-		std::vector<DumpCategoryRow> categories;
-		categories.reserve(categoriesByLabel.size());
-		for (auto& [label, row] : categoriesByLabel) {
-			(void)label;
-			categories.push_back(std::move(row));
-		}
-		std::sort(categories.begin(), categories.end(), [](const DumpCategoryRow& a, const DumpCategoryRow& b) {
-			if (a.bytes != b.bytes) {
-				return a.bytes > b.bytes;
-			}
-			return a.label < b.label;
-		});
+		// Only the snapshot is taken on the render thread; sorting and formatting run on the
+		// dump writer thread.
+		auto format = [frameIndex, memoryRecords = std::move(memoryRecords), aliasSnapshot, majorCategory, resourceTypeLabel, formatPct]() -> std::string {
+			std::unordered_map<std::string, DumpCategoryRow> categoriesByLabel;
+			categoriesByLabel.reserve(memoryRecords.size() * 2 + 8);
+			uint64_t totalBytes = 0;
+
+			for (const auto& record : memoryRecords) {
+				totalBytes += record.bytes;
+				const char* usage = record.usage.empty() ? "Unspecified" : record.usage.c_str();
+				std::string categoryLabel = std::string(majorCategory(record.resourceType)) + "/" + usage;
+				auto& category = categoriesByLabel[categoryLabel];
+				category.label = std::move(categoryLabel);
+				category.bytes += record.bytes;
+				category.resourceCount += 1;
+			}
+
+			std::vector<DumpCategoryRow> categories;
+			categories.reserve(categoriesByLabel.size());
+			for (auto& [label, row] : categoriesByLabel) {
+				(void)label;
+				categories.push_back(std::move(row));
+			}
+			std::sort(categories.begin(), categories.end(), [](const DumpCategoryRow& a, const DumpCategoryRow& b) {
+				if (a.bytes != b.bytes) {
+					return a.bytes > b.bytes;
+				}
+				return a.label < b.label;
+			});
 
-		std::vector<const rg::memory::ResourceMemoryRecord*> resources;
-		resources.reserve(memoryRecords.size());
-		for (const auto& record : memoryRecords) {
-			resources.push_back(&record);
-		}
-		std::sort(resources.begin(), resources.end(), [](const auto* a, const auto* b) {
-			if (a->bytes != b->bytes) {
-				return a->bytes > b->bytes;
+			std::vector<const rg::memory::ResourceMemoryRecord*> resources;
+			resources.reserve(memoryRecords.size());
+			for (const auto& record : memoryRecords) {
+				resources.push_back(&record);
 			}
-			if (a->resourceName != b->resourceName) {
-				return a->resourceName < b->resourceName;
-			}
-			return a->resourceID < b->resourceID;
-		});
+			std::sort(resources.begin(), resources.end(), [](const auto* a, const auto* b) {
+				if (a->bytes != b->bytes) {
+					return a->bytes > b->bytes;
+				}
+				if (a->resourceName != b->resourceName) {
+					return a->resourceName < b->resourceName;
+				}
+				return a->resourceID < b->resourceID;
+			});
 
-		const AutoAliasDebugSnapshot aliasSnapshot = GetAutoAliasDebugSnapshot();
 
-		auto modeLabel = [&](AutoAliasMode mode) -> const char* {
-			switch (mode) {
-			case AutoAliasMode::Off: return "Off";
-			case AutoAliasMode::Conservative: return "Conservative";
-			case AutoAliasMode::Balanced: return "Balanced";
-			case AutoAliasMode::Aggressive: return "Aggressive";
-			default: return "Unknown";
-			}
-		};
+			auto modeLabel = [](AutoAliasMode mode) -> const char* {
+				switch (mode) {
+				case AutoAliasMode::Off: return "Off";
+				case AutoAliasMode::Conservative: return "Conservative";
+				case AutoAliasMode::Balanced: return "Balanced";
+				case AutoAliasMode::Aggressive: return "Aggressive";
+				default: return "Unknown";
+				}
+			};
 
-		auto packingStrategyLabel = [&](AutoAliasPackingStrategy strategy) -> const char* {
-			switch (strategy) {
-			case AutoAliasPackingStrategy::GreedySweepLine: return "Greedy Sweep-Line";
-			case AutoAliasPackingStrategy::BranchAndBound: return "Beam Search (Near-Optimal)";
-			default: return "Unknown";
-			}
-		};
+			auto packingStrategyLabel = [](AutoAliasPackingStrategy strategy) -> const char* {
+				switch (strategy) {
+				case AutoAliasPackingStrategy::GreedySweepLine: return "Greedy Sweep-Line";
+				case AutoAliasPackingStrategy::BranchAndBound: return "Beam Search (Near-Optimal)";
+				case AutoAliasPackingStrategy::IntervalBestFit: return "Interval Best-Fit";
+				default: return "Unknown";
+				}
+			};
 
-		std::ostringstream dump;
-		dump << "RenderGraph VRAM Usage Dump\n";
-		dump << "frame_index=" << static_cast<unsigned int>(frameIndex) << "\n";
-		dump << "resource_count=" << memoryRecords.size()
-			 << " total_bytes=" << totalBytes
-			 << " category_count=" << categories.size()
-			 << " alias_pool_count=" << aliasSnapshot.poolDebug.size() << "\n\n";
+			std::ostringstream dump;
+			dump << "RenderGraph VRAM Usage Dump\n";
+			dump << "frame_index=" << static_cast<unsigned int>(frameIndex) << "\n";
+			dump << "resource_count=" << memoryRecords.size()
+				 << " total_bytes=" << totalBytes
+				 << " category_count=" << categories.size()
+				 << " alias_pool_count=" << aliasSnapshot.poolDebug.size() << "\n\n";
 
-		dump << "[Categories]\n";
-		if (categories.empty()) {
-			dump << "<none>\n";
-		}
-		else {
-			for (const auto& category : categories) {
-				dump << category.label
-					 << " bytes=" << category.bytes
-					 << " pct_total=" << formatPct(category.bytes, totalBytes)
-					 << " resources=" << category.resourceCount
-					 << "\n";
+			dump << "[Categories]\n";
+			if (categories.empty()) {
+				dump << "<none>\n";
+			}
+			else {
+				for (const auto& category : categories) {
+					dump << category.label
+						 << " bytes=" << category.bytes
+						 << " pct_total=" << formatPct(category.bytes, totalBytes)
+						 << " resources=" << category.resourceCount
+						 << "\n";
+				}
 			}
-		}
 
-		dump << "\n[Resources]\n";
-		if (resources.empty()) {
-			dump << "<none>\n";
-		}
-		else {
-			for (const auto* record : resources) {
-				const std::string categoryLabel = std::string(majorCategory(record->resourceType)) + "/" +
-					(record->usage.empty() ? "Unspecified" : record->usage);
-				dump << "id=" << record->resourceID
-					 << " bytes=" << record->bytes
-					 << " pct_total=" << formatPct(record->bytes, totalBytes)
-					 << " category=\"" << categoryLabel << "\""
-					 << " type=" << resourceTypeLabel(record->resourceType);
-				if (!record->resourceName.empty()) {
-					dump << " name=\"" << record->resourceName << "\"";
-				}
-				if (!record->identifier.empty()) {
-					dump << " identifier=\"" << record->identifier << "\"";
+			dump << "\n[Resources]\n";
+			if (resources.empty()) {
+				dump << "<none>\n";
+			}
+			else {
+				for (const auto* record : resources) {
+					const std::string categoryLabel = std::string(majorCategory(record->resourceType)) + "/" +
+						(record->usage.empty() ? "Unspecified" : record->usage);
+					dump << "id=" << record->resourceID
+						 << " bytes=" << record->bytes
+						 << " pct_total=" << formatPct(record->bytes, totalBytes)
+						 << " category=\"" << categoryLabel << "\""
+						 << " type=" << resourceTypeLabel(record->resourceType);
+					if (!record->resourceName.empty()) {
+						dump << " name=\"" << record->resourceName << "\"";
+					}
+					if (!record->identifier.empty()) {
+						dump << " identifier=\"" << record->identifier << "\"";
+					}
+					dump << "\n";
 				}
-				dump << "\n";
 			}
-		}
 
-		dump << "\n[Aliasing]\n";
-		dump << "mode=" << modeLabel(aliasSnapshot.mode)
-			 << " packing_strategy=" << packingStrategyLabel(aliasSnapshot.packingStrategy)
-			 << " candidates_seen=" << aliasSnapshot.candidatesSeen
-			 << " manual=" << aliasSnapshot.manuallyAssigned
-			 << " auto=" << aliasSnapshot.autoAssigned
-			 << " excluded=" << aliasSnapshot.excluded
-			 << " candidate_bytes=" << aliasSnapshot.candidateBytes
-			 << " auto_assigned_bytes=" << aliasSnapshot.autoAssignedBytes
-			 << " pooled_independent_bytes=" << aliasSnapshot.pooledIndependentBytes
-			 << " pooled_actual_bytes=" << aliasSnapshot.pooledActualBytes
-			 << " pooled_saved_bytes=" << aliasSnapshot.pooledSavedBytes
-			 << " plan_cache_hits=" << aliasSnapshot.planCacheHits
-			 << " plan_cache_misses=" << aliasSnapshot.planCacheMisses;
-		if (!aliasSnapshot.primaryPlanCacheMissReason.empty()) {
-			dump << " primary_plan_cache_miss_reason=\"" << aliasSnapshot.primaryPlanCacheMissReason << "\"";
-		}
-		dump
-			 << "\n";
+			dump << "\n[Aliasing]\n";
+			dump << "mode=" << modeLabel(aliasSnapshot.mode)
+				 << " packing_strategy=" << packingStrategyLabel(aliasSnapshot.packingStrategy)
+				 << " candidates_seen=" << aliasSnapshot.candidatesSeen
+				 << " manual=" << aliasSnapshot.manuallyAssigned
+				 << " auto=" << aliasSnapshot.autoAssigned
+				 << " excluded=" << aliasSnapshot.excluded
+				 << " candidate_bytes=" << aliasSnapshot.candidateBytes
+				 << " auto_assigned_bytes=" << aliasSnapshot.autoAssignedBytes
+				 << " pooled_independent_bytes=" << aliasSnapshot.pooledIndependentBytes
+				 << " pooled_actual_bytes=" << aliasSnapshot.pooledActualBytes
+				 << " pooled_saved_bytes=" << aliasSnapshot.pooledSavedBytes
+				 << " plan_cache_hits=" << aliasSnapshot.planCacheHits
+				 << " persisted_plan_cache_hits=" << aliasSnapshot.persistedPlanCacheHits
+				 << " plan_cache_misses=" << aliasSnapshot.planCacheMisses;
+			if (aliasSnapshot.subresourceTrackedTextures > 0) {
+				dump << " subresource_tracked_textures=" << aliasSnapshot.subresourceTrackedTextures
+					 << " subresource_whole_peak_bytes=" << aliasSnapshot.subresourceWholePeakBytes
+					 << " subresource_granular_peak_bytes=" << aliasSnapshot.subresourceGranularPeakBytes
+					 << " subresource_estimated_saved_bytes=" << aliasSnapshot.subresourceEstimatedSavedBytes;
+			}
+			if (!aliasSnapshot.primaryPlanCacheMissReason.empty()) {
+				dump << " primary_plan_cache_miss_reason=\"" << aliasSnapshot.primaryPlanCacheMissReason << "\"";
+			}
+			dump
+				 << "\n";
 
-		if (!aliasSnapshot.exclusionReasons.empty()) {
-			dump << "  exclusion_reasons:\n";
-			for (const auto& reason : aliasSnapshot.exclusionReasons) {
-				dump << "    - reason=\"" << reason.reason << "\" count=" << reason.count << "\n";
+			if (!aliasSnapshot.exclusionReasons.empty()) {
+				dump << "  exclusion_reasons:\n";
+				for (const auto& reason : aliasSnapshot.exclusionReasons) {
+					dump << "    - reason=\"" << reason.reason << "\" count=" << reason.count << "\n";
+				}
 			}
-		}
 
-		dump << "\n[AliasPools]\n";
-		if (aliasSnapshot.poolDebug.empty()) {
-			dump << "<none>\n";
-		}
-		else {
-			for (const auto& pool : aliasSnapshot.poolDebug) {
-				dump << "pool=" << pool.poolID
-					 << " required_bytes=" << pool.requiredBytes
-					 << " reserved_bytes=" << pool.reservedBytes
-					 << " resource_count=" << pool.ranges.size()
-					 << "\n";
+			dump << "\n[AliasPools]\n";
+			if (aliasSnapshot.poolDebug.empty()) {
+				dump << "<none>\n";
+			}
+			else {
+				for (const auto& pool : aliasSnapshot.poolDebug) {
+					dump << "pool=" << pool.poolID
+						 << " required_bytes=" << pool.requiredBytes
+						 << " reserved_bytes=" << pool.reservedBytes
+						 << " resource_count=" << pool.ranges.size()
+						 << "\n";
 
-				std::vector<const AutoAliasPoolRangeDebug*> ranges;
-				ranges.reserve(pool.ranges.size());
-				for (const auto& range : pool.ranges) {
-					ranges.push_back(&range);
-				}
-				std::sort(ranges.begin(), ranges.end(), [](const auto* a, const auto* b) {
-					if (a->startByte != b->startByte) {
-						return a->startByte < b->startByte;
+					std::vector<const AutoAliasPoolRangeDebug*> ranges;
+					ranges.reserve(pool.ranges.size());
+					for (const auto& range : pool.ranges) {
+						ranges.push_back(&range);
 					}
-					return a->resourceID < b->resourceID;
-				});
+					std::sort(ranges.begin(), ranges.end(), [](const auto* a, const auto* b) {
+						if (a->startByte != b->startByte) {
+							return a->startByte < b->startByte;
+						}
+						return a->resourceID < b->resourceID;
+					});
 
-				for (const auto* range : ranges) {
-					dump << "  - id=" << range->resourceID
-						 << " name=\"" << range->resourceName << "\""
-						 << " bytes=[" << range->startByte << ", " << range->endByte << ")"
-						 << " size=" << range->sizeBytes
-						 << " firstUse=" << range->firstUse
-						 << " lastUse=" << range->lastUse
-						 << " overlaps_byte_range=" << (range->overlapsByteRange ? "true" : "false")
-						 << "\n";
+					for (const auto* range : ranges) {
+						dump << "  - id=" << range->resourceID
+							 << " name=\"" << range->resourceName << "\""
+							 << " bytes=[" << range->startByte << ", " << range->endByte << ")"
+							 << " size=" << range->sizeBytes
+							 << " firstUse=" << range->firstUse
+							 << " lastUse=" << range->lastUse
+							 << " overlaps_byte_range=" << (range->overlapsByteRange ? "true" : "false")
+							 << "\n";
+					}
 				}
 			}
-		}
+
+			return dump.str();
+		};
 
 		namespace fs = std::filesystem;
 		std::error_code fsError;
@@ -1469,16 +1520,9 @@ void RenderGraph::WriteVramUsageDebugDump(uint8_t frameIndex) const
 			dumpDir.clear();
 		}
 		dumpDir /= "rendergraph_dumps";
-		fs::create_directories(dumpDir, fsError);
 
 		const fs::path dumpPath = dumpDir / "rendergraph_vram_usage_latest.txt";
-		std::ofstream outFile(dumpPath, std::ios::out | std::ios::trunc);
-		if (!outFile.is_open()) {
-			spdlog::warn("Failed to open render graph VRAM usage dump '{}'", dumpPath.string());
-			return;
-		}
-		outFile << dump.str();
-		outFile.close();
+		DebugDumpWriter::GetInstance().Submit(DebugDumpChannel::VramUsage, dumpPath, std::move(format));
 
 		static bool announcedDumpPath = false;
 		if (!announcedDumpPath) {
@@ -1511,10 +1555,9 @@ RenderGraph::PassView RenderGraph::GetPassView(const AnyPassAndResources& pr) {
 	return v;
 }
 
-std::vector<RenderGraph::Node> RenderGraph::BuildNodes(RenderGraph& rg) {
+void RenderGraph::BuildNodes(RenderGraph& rg, std::vector<Node>& nodes) {
 	ZoneScopedN("RenderGraph::BuildNodes");
 
-	std::vector<Node> nodes;
 	nodes.resize(rg.m_framePassAccessSummaries.size());
 	const size_t slotCount = rg.m_queueRegistry.SlotCount();
 	constexpr size_t passTypeCount = static_cast<size_t>(PassType::Copy) + 1;
@@ -1549,24 +1592,40 @@ std::vector<RenderGraph::Node> RenderGraph::BuildNodes(RenderGraph& rg) {
 		}
 	}
 
-	auto resolveCompatibleQueueSlotsForPass = [&queueCache, &passTypeIndex](const FramePassStaticAccessSummary& passAccess) -> std::vector<size_t> {
+	// Latency-critical passes keep only elevated-priority slots and other passes keep only normal
+	// ones, so bulk work never queues on a slot meant to preempt it. Either side falls back to the
+	// full list when the filter would leave nothing.
+	auto filterByPriority = [&rg](const std::vector<size_t>& slots, bool latencyCritical) -> std::vector<size_t> {
+		std::vector<size_t> filtered;
+		filtered.reserve(slots.size());
+		for (size_t slot : slots) {
+			if (slot < rg.m_queueRegistry.SlotCount()
+				&& rg.m_queueRegistry.IsElevatedPriority(static_cast<QueueSlotIndex>(static_cast<uint8_t>(slot))) == latencyCritical) {
+				filtered.push_back(slot);
+			}
+		}
+		return filtered.empty() ? slots : filtered;
+	};
+
+	auto resolveCompatibleQueueSlotsForPass = [&queueCache, &passTypeIndex, &filterByPriority](const FramePassStaticAccessSummary& passAccess) -> std::vector<size_t> {
 		if (passAccess.pinnedQueueSlot) {
 			return std::vector<size_t>{ static_cast<size_t>(static_cast<uint8_t>(*passAccess.pinnedQueueSlot)) };
 		}
 
 		if (passAccess.queueAssignmentPolicy == QueueAssignmentPolicy::Automatic) {
-			auto slots = queueCache.automaticByPassType[passTypeIndex(passAccess.type)];
+			const auto& slots = queueCache.automaticByPassType[passTypeIndex(passAccess.type)];
 				if (!slots.empty()) {
-					return slots;
+					return filterByPriority(slots, passAccess.latencyCritical);
 				}
 		}
 
-		return queueCache.fallbackByPreferredKind[QueueIndex(passAccess.preferredQueueKind)];
+		return filterByPriority(queueCache.fallbackByPreferredKind[QueueIndex(passAccess.preferredQueueKind)], passAccess.latencyCritical);
 	};
 
 	for (size_t i = 0; i < rg.m_framePassAccessSummaries.size(); ++i) {
 		const auto& passAccess = rg.m_framePassAccessSummaries[i];
-		Node n{};
+		Node& n = nodes[i];
+		n.Reset();
 		n.passIndex = i;
 		n.compatibleQueueSlots = resolveCompatibleQueueSlotsForPass(passAccess);
 		for (size_t slot : n.compatibleQueueSlots) {
@@ -1593,11 +1652,7 @@ std::vector<RenderGraph::Node> RenderGraph::BuildNodes(RenderGraph& rg) {
 		n.originalOrder = static_cast<uint32_t>(i);
 		n.touchedIDs = passAccess.touchedResourceIDs;
 		n.uavIDs = passAccess.uavResourceIDs;
-
-		nodes[i] = std::move(n);
 	}
-
-	return nodes;
 }
 
 std::vector<uint8_t> RenderGraph::PlanActiveQueueSlots(
@@ -1743,6 +1798,9 @@ std::vector<uint8_t> RenderGraph::PlanActiveQueueSlots(
 		if (kind == QueueKind::Compute && !allowAsyncCompute) {
 			targetCount = (std::min)(targetCount, size_t(1));
 		}
+		if (const uint8_t adaptiveLimit = rg.m_adaptiveQueueCount.limitByKind[kindIndex]; adaptiveLimit != 0) {
+			targetCount = (std::min)(targetCount, static_cast<size_t>(adaptiveLimit));
+		}
 		targetCount = (std::min)(targetCount, autoAssignableSlots.size());
 		targetCount = (std::max)(targetCount, pinnedSlots.size());
 
@@ -1776,6 +1834,412 @@ std::vector<uint8_t> RenderGraph::PlanActiveQueueSlots(
 	return activeSlots;
 }
 
+void RenderGraph::ApplyAdaptiveQueuePlacement(std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes)
+{
+	ZoneScopedN("RenderGraph::ApplyAdaptiveQueuePlacement");
+	auto& state = m_adaptiveQueuePlacement;
+	const bool enabled = m_statisticsService
+		&& m_getQueueSchedulingAdaptivePlacementEnabled
+		&& m_getQueueSchedulingAdaptivePlacementEnabled()
+		&& (m_getUseAsyncCompute ? m_getUseAsyncCompute() : true);
+	if (!enabled) {
+		state = {};
+		return;
+	}
+	const uint32_t windowFrames = m_getQueueSchedulingAdaptivePlacementWindowFrames ? m_getQueueSchedulingAdaptivePlacementWindowFrames() : 16u;
+	const double hysteresis = m_getQueueSchedulingAdaptivePlacementHysteresis ? static_cast<double>(m_getQueueSchedulingAdaptivePlacementHysteresis()) : 0.03;
+	const bool enableQueueSchedulingLogging = m_getQueueSchedulingEnableLogging ? m_getQueueSchedulingEnableLogging() : false;
+
+	constexpr uint8_t graphicsBit = static_cast<uint8_t>(1u << QueueIndex(QueueKind::Graphics));
+	constexpr uint8_t computeBit = static_cast<uint8_t>(1u << QueueIndex(QueueKind::Compute));
+	auto isEligible = [&](const Node& node) {
+		return node.queueAssignmentPolicy == QueueAssignmentPolicy::Automatic
+			&& (node.compatibleQueueKindMask & (graphicsBit | computeBit)) == (graphicsBit | computeBit)
+			&& node.passIndex < passes.size()
+			&& !passes[node.passIndex].name.empty();
+	};
+
+	// Estimated GPU frame time of the placement the previous frame ran: the busiest queue
+	// kind's summed pass time. Cross-queue waits are not visible in per-pass timestamps, so
+	// this is a lower bound, but it moves in the right direction when passes change queues.
+	const auto& passStats = m_statisticsService->GetPassStats();
+	std::array<double, static_cast<size_t>(QueueKind::Count)> busyMsByKind{};
+	bool haveTimings = false;
+	state.candidatePassKeys.clear();
+	for (const auto& node : nodes) {
+		if (node.passIndex >= passes.size()) {
+			continue;
+		}
+		const auto& pass = passes[node.passIndex];
+		if (pass.name.empty()) {
+			continue;
+		}
+		const uint64_t passKey = HashString64(pass.name);
+		if (isEligible(node)) {
+			state.candidatePassKeys.push_back(passKey);
+		}
+		const auto lastKindIt = state.lastScheduledKindByPass.find(passKey);
+		if (lastKindIt == state.lastScheduledKindByPass.end()) {
+			continue;
+		}
+		const int statisticsIndex = std::visit(
+			[](const auto& passEntry) -> int {
+				using T = std::decay_t<decltype(passEntry)>;
+				if constexpr (std::is_same_v<T, std::monostate>) {
+					return -1;
+				}
+				else {
+					return passEntry.statisticsIndex;
+				}
+			},
+			pass.pass);
+		if (statisticsIndex < 0 || static_cast<size_t>(statisticsIndex) >= passStats.size()) {
+			continue;
+		}
+		busyMsByKind[QueueIndex(lastKindIt->second)] += passStats[static_cast<size_t>(statisticsIndex)].gpuTimeEma;
+		haveTimings = true;
+	}
+	const double frameCostMs = *std::max_element(busyMsByKind.begin(), busyMsByKind.end());
+
+	++state.framesInWindow;
+	// gpuTimeEma lags a placement change, so only the second half of each window is sampled.
+	if (haveTimings && state.framesInWindow > windowFrames / 2) {
+		state.windowCostSum += frameCostMs;
+		++state.windowSamples;
+	}
+	if (state.framesInWindow >= windowFrames) {
+		const double windowCostMs = state.windowSamples > 0 ? state.windowCostSum / static_cast<double>(state.windowSamples) : 0.0;
+		if (state.trialActive) {
+			// The same margin is required to move a pass back, so placements only change on a
+			// clear win and do not oscillate on noise.
+			const bool improved = windowCostMs > 0.0
+				&& state.baselineCostMs > 0.0
+				&& windowCostMs < state.baselineCostMs * (1.0 - hysteresis);
+			if (improved) {
+				state.committedKindByPass[state.trialPassKey] = state.trialKind;
+				++state.trialsKept;
+			}
+			else {
+				++state.trialsReverted;
+			}
+			if (enableQueueSchedulingLogging) {
+				spdlog::info(
+					"RG adaptive queue placement: pass {:016x} -> {} {} (baseline={:.3f}ms trial={:.3f}ms)",
+					state.trialPassKey,
+					state.trialKind == QueueKind::Compute ? "compute" : "graphics",
+					improved ? "kept" : "reverted",
+					state.baselineCostMs,
+					windowCostMs);
+			}
+			state.trialActive = false;
+		}
+		else {
+			state.baselineCostMs = windowCostMs;
+			if (state.baselineCostMs > 0.0 && !state.candidatePassKeys.empty()) {
+				const uint64_t passKey = state.candidatePassKeys[state.nextCandidate++ % state.candidatePassKeys.size()];
+				QueueKind currentKind = QueueKind::Graphics;
+				if (auto committedIt = state.committedKindByPass.find(passKey); committedIt != state.committedKindByPass.end()) {
+					currentKind = committedIt->second;
+				}
+				else if (auto lastIt = state.lastScheduledKindByPass.find(passKey); lastIt != state.lastScheduledKindByPass.end()) {
+					currentKind = lastIt->second;
+				}
+				state.trialActive = true;
+				state.trialPassKey = passKey;
+				state.trialKind = currentKind == QueueKind::Compute ? QueueKind::Graphics : QueueKind::Compute;
+			}
+		}
+		state.framesInWindow = 0;
+		state.windowCostSum = 0.0;
+		state.windowSamples = 0;
+	}
+	TracyPlot("RG.AdaptivePlacement.EstimatedFrameMs", frameCostMs);
+	TracyPlot("RG.AdaptivePlacement.Committed", static_cast<int64_t>(state.committedKindByPass.size()));
+
+	for (auto& node : nodes) {
+		if (!isEligible(node)) {
+			continue;
+		}
+		const uint64_t passKey = HashString64(passes[node.passIndex].name);
+		QueueKind targetKind = QueueKind::Graphics;
+		AdaptiveQueuePlacementDecision decision = AdaptiveQueuePlacementDecision::None;
+		if (state.trialActive && passKey == state.trialPassKey) {
+			targetKind = state.trialKind;
+			decision = AdaptiveQueuePlacementDecision::Trial;
+		}
+		else if (auto committedIt = state.committedKindByPass.find(passKey); committedIt != state.committedKindByPass.end()) {
+			targetKind = committedIt->second;
+			decision = AdaptiveQueuePlacementDecision::Committed;
+		}
+		else {
+			continue;
+		}
+
+		std::vector<size_t> targetSlots;
+		for (size_t slot : node.compatibleQueueSlots) {
+			if (slot < m_queueRegistry.SlotCount()
+				&& m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(slot))) == targetKind) {
+				targetSlots.push_back(slot);
+			}
+		}
+		if (targetSlots.empty()) {
+			continue;
+		}
+		node.compatibleQueueSlots = std::move(targetSlots);
+		node.compatibleQueueKindMask = static_cast<uint8_t>(1u << QueueIndex(targetKind));
+		node.queueSlot = node.compatibleQueueSlots.front();
+		node.assignedQueueSlot = node.queueSlot;
+		node.adaptivePlacement = decision;
+	}
+}
+
+void RenderGraph::RecordAdaptiveQueuePlacement(const std::vector<AnyPassAndResources>& passes)
+{
+	auto& state = m_adaptiveQueuePlacement;
+	if (!m_getQueueSchedulingAdaptivePlacementEnabled || !m_getQueueSchedulingAdaptivePlacementEnabled()) {
+		return;
+	}
+	state.lastScheduledKindByPass.clear();
+	for (size_t passIndex = 0; passIndex < passes.size() && passIndex < m_assignedQueueSlotsByFramePass.size(); ++passIndex) {
+		const size_t slot = m_assignedQueueSlotsByFramePass[passIndex];
+		if (passes[passIndex].name.empty() || slot >= m_queueRegistry.SlotCount()) {
+			continue;
+		}
+		state.lastScheduledKindByPass[HashString64(passes[passIndex].name)] =
+			m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(slot)));
+	}
+}
+
+void RenderGraph::ApplyAdaptiveQueueCount()
+{
+	ZoneScopedN("RenderGraph::ApplyAdaptiveQueueCount");
+	auto& state = m_adaptiveQueueCount;
+	const bool enabled = m_statisticsService
+		&& m_getQueueSchedulingAdaptiveQueueCountEnabled
+		&& m_getQueueSchedulingAdaptiveQueueCountEnabled();
+	if (!enabled) {
+		state = {};
+		return;
+	}
+	const uint32_t windowFrames = m_getQueueSchedulingAdaptivePlacementWindowFrames ? m_getQueueSchedulingAdaptivePlacementWindowFrames() : 16u;
+	const double hysteresis = m_getQueueSchedulingAdaptivePlacementHysteresis ? static_cast<double>(m_getQueueSchedulingAdaptivePlacementHysteresis()) : 0.03;
+	const double waitCostMs = (m_getQueueSchedulingAdaptiveQueueCountWaitCostUs ? static_cast<double>(m_getQueueSchedulingAdaptiveQueueCountWaitCostUs()) : 15.0) / 1000.0;
+	const bool enableQueueSchedulingLogging = m_getQueueSchedulingEnableLogging ? m_getQueueSchedulingEnableLogging() : false;
+
+	const size_t slotCount = m_queueRegistry.SlotCount();
+	std::array<uint8_t, static_cast<size_t>(QueueKind::Count)> autoSlotsByKind{};
+	for (size_t slot = 0; slot < slotCount; ++slot) {
+		const auto slotIndex = static_cast<QueueSlotIndex>(static_cast<uint8_t>(slot));
+		if (m_queueRegistry.IsAutoAssignable(slotIndex)) {
+			++autoSlotsByKind[QueueIndex(m_queueRegistry.GetKind(slotIndex))];
+		}
+	}
+	const uint32_t maxQueues = m_getQueueSchedulingAdaptiveQueueCountMaxQueues ? m_getQueueSchedulingAdaptiveQueueCountMaxQueues() : 2u;
+	for (auto& count : autoSlotsByKind) {
+		count = static_cast<uint8_t>((std::min)(static_cast<uint32_t>(count), maxQueues));
+	}
+	for (size_t kindIndex = 0; kindIndex < autoSlotsByKind.size(); ++kindIndex) {
+		auto& limit = state.limitByKind[kindIndex];
+		const uint8_t available = (std::max)(uint8_t(1), autoSlotsByKind[kindIndex]);
+		limit = limit == 0 ? available : (std::min)(limit, available);
+	}
+	// Graphics work stays on the primary slot; only async kinds are trialled.
+	state.limitByKind[QueueIndex(QueueKind::Graphics)] = 0;
+
+	// Batch timings of the most recent frame that has resolved: batches run one after another and
+	// the queues of a batch overlap, so each batch costs its slowest queue's time.
+	const auto& batchStats = m_statisticsService->GetBatchStats();
+	uint64_t latestSampleFrame = 0;
+	for (const auto& entry : batchStats) {
+		latestSampleFrame = (std::max)(latestSampleFrame, entry.lastSampleFrame);
+	}
+	std::array<double, static_cast<size_t>(QueueKind::Count)> busyMsByKind{};
+	double batchCostMs = 0.0;
+	bool haveTimings = false;
+	const uint32_t slotLimit = static_cast<uint32_t>((std::min)(slotCount, static_cast<size_t>(rg::runtime::kStatisticsMaxQueueSlots)));
+	for (uint32_t batchIndex = 0; latestSampleFrame != 0 && batchIndex < rg::runtime::kStatisticsMaxBatches; ++batchIndex) {
+		double slowestMs = 0.0;
+		for (uint32_t slot = 0; slot < slotLimit; ++slot) {
+			const size_t statsIndex = rg::runtime::BatchQueueStatsIndex(batchIndex, slot);
+			if (statsIndex >= batchStats.size() || batchStats[statsIndex].lastSampleFrame != latestSampleFrame) {
+				continue;
+			}
+			const double ms = batchStats[statsIndex].gpuTimeEma;
+			busyMsByKind[QueueIndex(m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(slot))))] += ms;
+			slowestMs = (std::max)(slowestMs, ms);
+			haveTimings = true;
+		}
+		batchCostMs += slowestMs;
+	}
+	const double frameCostMs = batchCostMs + waitCostMs * static_cast<double>(state.lastFrameCrossQueueWaits);
+
+	++state.framesInWindow;
+	// Timings lag a slot count change by the frames in flight, so only the second half of each
+	// window is sampled, as in ApplyAdaptiveQueuePlacement.
+	if (haveTimings && state.framesInWindow > windowFrames / 2) {
+		state.windowCostSum += frameCostMs;
+		++state.windowSamples;
+	}
+	if (state.framesInWindow >= windowFrames) {
+		const double windowCostMs = state.windowSamples > 0 ? state.windowCostSum / static_cast<double>(state.windowSamples) : 0.0;
+		if (state.trialActive) {
+			const bool measured = windowCostMs > 0.0 && state.baselineCostMs > 0.0;
+			const bool kept = measured && (state.trialIncreased
+				? windowCostMs < state.baselineCostMs * (1.0 - hysteresis)
+				: windowCostMs <= state.baselineCostMs * (1.0 + hysteresis));
+			auto& limit = state.limitByKind[QueueIndex(state.trialKind)];
+			if (kept) {
+				++state.stats.trialsKept;
+			}
+			else {
+				limit = state.limitBeforeTrial;
+				++state.stats.trialsReverted;
+			}
+			if (enableQueueSchedulingLogging) {
+				spdlog::info(
+					"RG adaptive queue count: {} queues {} -> {} {} (baseline={:.3f}ms trial={:.3f}ms)",
+					state.trialKind == QueueKind::Compute ? "compute" : "copy",
+					state.limitBeforeTrial,
+					state.trialIncreased ? state.limitBeforeTrial + 1 : state.limitBeforeTrial - 1,
+					kept ? "kept" : "reverted",
+					state.baselineCostMs,
+					windowCostMs);
+			}
+			state.trialActive = false;
+		}
+		else {
+			state.baselineCostMs = windowCostMs;
+			constexpr std::array<QueueKind, 2> trialKinds = { QueueKind::Compute, QueueKind::Copy };
+			for (size_t attempt = 0; attempt < trialKinds.size() && state.baselineCostMs > 0.0; ++attempt) {
+				const QueueKind kind = trialKinds[state.nextKind++ % trialKinds.size()];
+				const uint8_t available = autoSlotsByKind[QueueIndex(kind)];
+				auto& limit = state.limitByKind[QueueIndex(kind)];
+				if (available <= 1) {
+					continue;
+				}
+				const bool increase = limit <= 1 || (limit < available && state.nextTrialIncreases);
+				state.nextTrialIncreases = !state.nextTrialIncreases;
+				state.trialActive = true;
+				state.trialKind = kind;
+				state.trialIncreased = increase;
+				state.limitBeforeTrial = limit;
+				limit = increase ? limit + 1 : limit - 1;
+				break;
+			}
+		}
+		state.framesInWindow = 0;
+		state.windowCostSum = 0.0;
+		state.windowSamples = 0;
+	}
+
+	state.stats.activeLimitByKind = state.limitByKind;
+	state.stats.busyMsByKind = busyMsByKind;
+	state.stats.estimatedFrameMs = frameCostMs;
+	state.stats.crossQueueWaits = state.lastFrameCrossQueueWaits;
+	TracyPlot("RG.AdaptiveQueueCount.EstimatedFrameMs", frameCostMs);
+	TracyPlot("RG.AdaptiveQueueCount.ComputeQueues", static_cast<int64_t>(state.limitByKind[QueueIndex(QueueKind::Compute)]));
+}
+
+size_t RenderGraph::BuildRenderPassMergeGroups()
+{
+	ZoneScopedN("RenderGraph::BuildRenderPassMergeGroups");
+	using AttachmentKey = std::pair<uint64_t, rg::Hash64>;
+	auto collect = [](std::vector<AttachmentKey>& out, std::initializer_list<const std::vector<ResourceHandleAndRange>*> lists) {
+		out.clear();
+		for (const auto* list : lists) {
+			for (const auto& entry : *list) {
+				out.emplace_back(entry.resource.GetGlobalResourceID(), HashValue(entry.range));
+			}
+		}
+		std::sort(out.begin(), out.end());
+		out.erase(std::unique(out.begin(), out.end()), out.end());
+	};
+	auto touchesAny = [](const std::vector<AttachmentKey>& attachments, const std::vector<ResourceHandleAndRange>& list) {
+		for (const auto& entry : list) {
+			const uint64_t id = entry.resource.GetGlobalResourceID();
+			auto it = std::lower_bound(attachments.begin(), attachments.end(), AttachmentKey{ id, 0 });
+			if (it != attachments.end() && it->first == id) {
+				return true;
+			}
+		}
+		return false;
+	};
+
+	std::vector<AttachmentKey> prevColor, prevDepth, prevDepthRead, nextColor, nextDepth, nextDepthRead, prevAll;
+	// A render pass can continue the previous one's native render pass when it binds exactly the
+	// same attachments, clears none of them, records no immediate commands or internal transitions
+	// in between, and does not otherwise access an attachment (no UAV/copy use, and no shader reads:
+	// the RHI has no subpass-local reads, so sampling an attachment still needs a store and barrier).
+	auto canContinue = [&](const RenderPassAndResources& prev, const RenderPassAndResources& next) {
+		const auto& p = prev.resources;
+		const auto& n = next.resources;
+		if (!n.renderTargetClearResources.empty() || !n.depthStencilClearResources.empty()) return false;
+		if (!p.internalTransitions.empty() || !n.internalTransitions.empty()) return false;
+		if (!p.presentResources.empty() || !n.presentResources.empty()) return false;
+		if ((next.run & PassRunMask::Immediate) != PassRunMask::None && !next.immediateBytecode.empty()) return false;
+
+		collect(prevColor, { &p.renderTargets, &p.renderTargetClearResources });
+		collect(prevDepth, { &p.depthReadWriteResources, &p.depthStencilClearResources });
+		collect(prevDepthRead, { &p.depthReadResources });
+		collect(nextColor, { &n.renderTargets });
+		collect(nextDepth, { &n.depthReadWriteResources });
+		collect(nextDepthRead, { &n.depthReadResources });
+		if (prevColor.empty() && prevDepth.empty() && prevDepthRead.empty()) return false;
+		if (prevColor != nextColor || prevDepth != nextDepth || prevDepthRead != nextDepthRead) return false;
+
+		prevAll.clear();
+		prevAll.insert(prevAll.end(), prevColor.begin(), prevColor.end());
+		prevAll.insert(prevAll.end(), prevDepth.begin(), prevDepth.end());
+		prevAll.insert(prevAll.end(), prevDepthRead.begin(), prevDepthRead.end());
+		std::sort(prevAll.begin(), prevAll.end());
+		for (const auto* params : { &p, &n }) {
+			if (touchesAny(prevAll, params->unorderedAccessViews)
+				|| touchesAny(prevAll, params->unorderedAccessClearViews)
+				|| touchesAny(prevAll, params->copySources)
+				|| touchesAny(prevAll, params->copyTargets)) {
+				return false;
+			}
+		}
+		return !touchesAny(prevAll, n.shaderResources);
+	};
+
+	const bool enabled = m_getRenderGraphRenderPassMergingEnabled && m_getRenderGraphRenderPassMergingEnabled();
+	size_t continuedPasses = 0;
+	std::vector<RenderPassAndResources*> group;
+	auto flushGroup = [&]() {
+		for (size_t i = 0; i < group.size(); ++i) {
+			group[i]->renderPassMerge = {};
+			group[i]->renderPassMerge.groupSize = static_cast<uint32_t>(group.size());
+			group[i]->renderPassMerge.indexInGroup = static_cast<uint32_t>(i);
+		}
+		continuedPasses += group.empty() ? 0 : group.size() - 1;
+		group.clear();
+	};
+
+	for (auto& batch : batches) {
+		for (auto& queuePasses : batch.queuePasses) {
+			for (auto& queued : queuePasses) {
+				auto** renderPass = std::get_if<RenderPassAndResources*>(&queued);
+				if (!renderPass) {
+					flushGroup();
+					continue;
+				}
+				if (!enabled) {
+					(*renderPass)->renderPassMerge = {};
+					continue;
+				}
+				if (!group.empty() && !canContinue(*group.back(), **renderPass)) {
+					flushGroup();
+				}
+				group.push_back(*renderPass);
+			}
+			flushGroup();
+		}
+	}
+	TracyPlot("RG.RenderPassMerge.ContinuedPasses", static_cast<int64_t>(continuedPasses));
+	return continuedPasses;
+}
+
 bool RenderGraph::AddEdgeDedup(
 	size_t from, size_t to,
 	std::vector<Node>& nodes,
@@ -1802,6 +2266,15 @@ bool RenderGraph::BuildDependencyGraph(
 	std::span<const std::pair<size_t, size_t>> explicitEdges)
 {
 	ZoneScopedN("RenderGraph::BuildDependencyGraph");
+	FrameTraceScope frameTraceScope("BuildDependencyGraph");
+	if (m_getRenderGraphIncrementalDependencyGraphEnabled && m_getRenderGraphIncrementalDependencyGraphEnabled()) {
+		return BuildDependencyGraphIncremental(nodes, explicitEdges);
+	}
+	m_incrementalDependencyGraphCache.valid = false;
+	if (m_taskService && m_getRenderGraphParallelDependencyGraphEnabled && m_getRenderGraphParallelDependencyGraphEnabled()) {
+		return BuildDependencyGraphParallel(nodes, explicitEdges);
+	}
+
 	std::vector<SeqState> seq(m_frameDAGResourceCount);
 
 	std::unordered_set<uint64_t> edgeSet;
@@ -1847,64 +2320,663 @@ bool RenderGraph::BuildDependencyGraph(
 	return FinalizeDependencyGraph(nodes);
 }
 
-bool RenderGraph::FinalizeDependencyGraph(std::vector<Node>& nodes)
+bool RenderGraph::BuildDependencyGraphIncremental(
+	std::vector<Node>& nodes,
+	std::span<const std::pair<size_t, size_t>> explicitEdges)
 {
-	// topo + criticality (longest path)
-	std::vector<uint32_t> indeg(nodes.size());
-	for (size_t i = 0; i < nodes.size(); ++i) indeg[i] = nodes[i].indegree;
-
-	auto originalOrderLess = [&](size_t lhs, size_t rhs) {
-		if (nodes[lhs].originalOrder != nodes[rhs].originalOrder) {
-			return nodes[lhs].originalOrder > nodes[rhs].originalOrder;
-		}
-		return lhs > rhs;
+	ZoneScopedN("RenderGraph::BuildDependencyGraphIncremental");
+	auto& cache = m_incrementalDependencyGraphCache;
+	auto& stats = m_lastIncrementalDependencyGraphStats;
+	stats = {};
+	const size_t resourceCount = m_frameDAGResourceCount;
+
+	auto accessesForNode = [&](size_t nodeIndex) -> const std::vector<NodeAccess>* {
+		const size_t passIndex = nodes[nodeIndex].passIndex;
+		return passIndex < m_framePassAccessSummaries.size()
+			? &m_framePassAccessSummaries[passIndex].dagAccesses
+			: nullptr;
 	};
 
-	std::priority_queue<size_t, std::vector<size_t>, decltype(originalOrderLess)> ready(originalOrderLess);
-	for (size_t i = 0; i < nodes.size(); ++i) {
-		if (indeg[i] == 0) {
-			ready.push(i);
+	// Key every pass by its DAG access list. Edges are expressed in node indices, so a pass is
+	// clean only if the access list at the same node index is identical to last frame's.
+	std::vector<uint64_t> passAccessKeys(nodes.size(), 0);
+	std::vector<uint32_t> passAccessOffsets(nodes.size() + 1, 0);
+	std::vector<uint64_t> passAccessResourceIDs;
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphIncremental::HashPassAccesses");
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			passAccessOffsets[i] = static_cast<uint32_t>(passAccessResourceIDs.size());
+			uint64_t key = 0x6461676163636573ull;
+			if (const auto* dagAccesses = accessesForNode(i)) {
+				for (const auto& access : *dagAccesses) {
+					if (access.resourceIndex >= resourceCount) {
+						continue;
+					}
+					const uint64_t resourceID = m_frameDAGResourceIDsByIndex[access.resourceIndex];
+					key = HashCombine64(key, resourceID);
+					key = HashCombine64(key, static_cast<uint64_t>(access.kind));
+					passAccessResourceIDs.push_back(resourceID);
+				}
+			}
+			passAccessKeys[i] = key;
 		}
+		passAccessOffsets[nodes.size()] = static_cast<uint32_t>(passAccessResourceIDs.size());
 	}
 
-	std::vector<size_t> topo;
-	topo.reserve(nodes.size());
-
-	while (!ready.empty()) {
-		size_t u = ready.top();
-		ready.pop();
-		topo.push_back(u);
-		for (size_t v : nodes[u].out) {
-			if (--indeg[v] == 0) {
-				ready.push(v);
+	const bool canReuse = cache.valid && cache.passAccessKeys.size() == nodes.size();
+	stats.fullRebuild = !canReuse;
+	std::vector<uint8_t> resourceDirty(resourceCount, canReuse ? 0 : 1);
+	if (canReuse) {
+		ZoneScopedN("RenderGraph::BuildDependencyGraphIncremental::MarkDirtyResources");
+		for (size_t i = 0; i < nodes.size(); ++i) {
+			if (passAccessKeys[i] == cache.passAccessKeys[i]) {
+				continue;
+			}
+			++stats.dirtyPassCount;
+			if (const auto* dagAccesses = accessesForNode(i)) {
+				for (const auto& access : *dagAccesses) {
+					if (access.resourceIndex < resourceCount) {
+						resourceDirty[access.resourceIndex] = 1;
+					}
+				}
+			}
+			// Resources the pass stopped touching lose edges, so they are dirty as well.
+			for (uint32_t entry = cache.passAccessOffsets[i]; entry < cache.passAccessOffsets[i + 1]; ++entry) {
+				auto it = m_frameDAGResourceIndexByID.find(cache.passAccessResourceIDs[entry]);
+				if (it != m_frameDAGResourceIndexByID.end() && it->second < resourceCount) {
+					resourceDirty[it->second] = 1;
+				}
 			}
 		}
 	}
+	else {
+		stats.dirtyPassCount = nodes.size();
+	}
 
-	if (topo.size() != nodes.size()) {
-		// cycle: invalid graph
-		return false;
+	// Per-resource access sequences in pass order, only for the resources that need a fresh walk.
+	std::vector<uint32_t> accessOffsetsByResource;
+	std::vector<DependencyEdgeRecord> accessesByResource;
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphIncremental::GatherDirtyResourceAccesses");
+		GatherResourceAccessSequences(nodes, &resourceDirty, accessOffsetsByResource, accessesByResource);
 	}
 
-	for (size_t rank = 0; rank < topo.size(); ++rank) {
-		nodes[topo[rank]].topoRank = rank;
+	std::vector<uint32_t> edgeOffsetsByResource(resourceCount + 1, 0);
+	std::vector<DependencyEdgeRecord> edges;
+	edges.reserve(canReuse ? cache.edges.size() : nodes.size() * 8);
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphIncremental::CollectResourceEdges");
+		std::vector<uint32_t> readsSinceWrite;
+		for (size_t r = 0; r < resourceCount; ++r) {
+			edgeOffsetsByResource[r] = static_cast<uint32_t>(edges.size());
+			if (!resourceDirty[r]) {
+				const uint64_t resourceID = m_frameDAGResourceIDsByIndex[r];
+				auto it = std::lower_bound(cache.resourceIDs.begin(), cache.resourceIDs.end(), resourceID);
+				if (it != cache.resourceIDs.end() && *it == resourceID) {
+					const size_t cachedIndex = static_cast<size_t>(std::distance(cache.resourceIDs.begin(), it));
+					const uint32_t first = cache.edgeOffsetsByResource[cachedIndex];
+					const uint32_t last = cache.edgeOffsetsByResource[cachedIndex + 1];
+					edges.insert(edges.end(), cache.edges.begin() + first, cache.edges.begin() + last);
+					stats.reusedEdgeCount += last - first;
+				}
+				++stats.reusedResourceCount;
+				continue;
+			}
+
+			++stats.dirtyResourceCount;
+			const size_t edgeCountBefore = edges.size();
+			AppendResourceDependencyEdges(
+				std::span<const DependencyEdgeRecord>(accessesByResource).subspan(
+					accessOffsetsByResource[r],
+					accessOffsetsByResource[r + 1] - accessOffsetsByResource[r]),
+				readsSinceWrite,
+				edges);
+			stats.rebuiltEdgeCount += edges.size() - edgeCountBefore;
+		}
+		edgeOffsetsByResource[resourceCount] = static_cast<uint32_t>(edges.size());
 	}
 
-	// reverse topo DP
-	for (auto& node : nodes) {
-		node.criticality = 0;
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphIncremental::MergeEdges");
+		std::vector<DependencyEdgeRecord> ordered = edges;
+		MergeDependencyEdges(nodes, ordered, explicitEdges);
 	}
-	for (auto it = topo.rbegin(); it != topo.rend(); ++it) {
-		size_t u = *it;
-		uint32_t best = 0;
-		for (size_t v : nodes[u].out)
-			best = std::max(best, uint32_t(1 + nodes[v].criticality));
+
+	cache.valid = true;
+	cache.passAccessKeys = std::move(passAccessKeys);
+	cache.passAccessOffsets = std::move(passAccessOffsets);
+	cache.passAccessResourceIDs = std::move(passAccessResourceIDs);
+	cache.resourceIDs = m_frameDAGResourceIDsByIndex;
+	cache.edgeOffsetsByResource = std::move(edgeOffsetsByResource);
+	cache.edges = std::move(edges);
+
+	TracyPlot("RG.IncrementalDAG.DirtyPasses", static_cast<int64_t>(stats.dirtyPassCount));
+	TracyPlot("RG.IncrementalDAG.DirtyResources", static_cast<int64_t>(stats.dirtyResourceCount));
+	TracyPlot("RG.IncrementalDAG.ReusedEdges", static_cast<int64_t>(stats.reusedEdgeCount));
+	TracyPlot("RG.IncrementalDAG.RebuiltEdges", static_cast<int64_t>(stats.rebuiltEdgeCount));
+
+	return FinalizeDependencyGraph(nodes);
+}
+
+bool RenderGraph::BuildDependencyGraphParallel(
+	std::vector<Node>& nodes,
+	std::span<const std::pair<size_t, size_t>> explicitEdges)
+{
+	ZoneScopedN("RenderGraph::BuildDependencyGraphParallel");
+	const size_t resourceCount = m_frameDAGResourceCount;
+
+	std::vector<uint32_t> accessOffsetsByResource;
+	std::vector<DependencyEdgeRecord> accessesByResource;
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphParallel::GatherResourceAccesses");
+		GatherResourceAccessSequences(nodes, nullptr, accessOffsetsByResource, accessesByResource);
+	}
+
+	// Every resource's edges depend only on its own access sequence, so shards of resources can
+	// be walked independently. Shards are balanced by access count rather than resource count,
+	// since a handful of heavily shared resources usually dominate the edge total.
+	constexpr size_t kTargetAccessesPerShard = 2048;
+	std::vector<uint32_t> shardFirstResource{ 0 };
+	{
+		size_t shardAccessCount = 0;
+		for (size_t r = 0; r < resourceCount; ++r) {
+			shardAccessCount += accessOffsetsByResource[r + 1] - accessOffsetsByResource[r];
+			if (shardAccessCount >= kTargetAccessesPerShard && r + 1 < resourceCount) {
+				shardFirstResource.push_back(static_cast<uint32_t>(r + 1));
+				shardAccessCount = 0;
+			}
+		}
+		shardFirstResource.push_back(static_cast<uint32_t>(resourceCount));
+	}
+
+	const size_t shardCount = shardFirstResource.size() - 1;
+	std::vector<std::vector<DependencyEdgeRecord>> edgesByShard(shardCount);
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphParallel::CollectResourceEdges");
+		ParallelForOptional("BuildDependencyGraph", shardCount, [&](size_t shard) {
+			auto& shardEdges = edgesByShard[shard];
+			std::vector<uint32_t> readsSinceWrite;
+			for (uint32_t r = shardFirstResource[shard]; r < shardFirstResource[shard + 1]; ++r) {
+				AppendResourceDependencyEdges(
+					std::span<const DependencyEdgeRecord>(accessesByResource).subspan(
+						accessOffsetsByResource[r],
+						accessOffsetsByResource[r + 1] - accessOffsetsByResource[r]),
+					readsSinceWrite,
+					shardEdges);
+			}
+		}, shardCount <= 1);
+	}
+
+	std::vector<DependencyEdgeRecord> edges;
+	{
+		ZoneScopedN("RenderGraph::BuildDependencyGraphParallel::MergeEdges");
+		size_t edgeCount = 0;
+		for (const auto& shardEdges : edgesByShard) {
+			edgeCount += shardEdges.size();
+		}
+		edges.reserve(edgeCount);
+		for (const auto& shardEdges : edgesByShard) {
+			edges.insert(edges.end(), shardEdges.begin(), shardEdges.end());
+		}
+		MergeDependencyEdges(nodes, edges, explicitEdges);
+	}
+
+	TracyPlot("RG.ParallelDAG.Shards", static_cast<int64_t>(shardCount));
+	TracyPlot("RG.ParallelDAG.Edges", static_cast<int64_t>(edges.size()));
+
+	return FinalizeDependencyGraph(nodes);
+}
+
+void RenderGraph::GatherResourceAccessSequences(
+	const std::vector<Node>& nodes,
+	const std::vector<uint8_t>* resourceFilter,
+	std::vector<uint32_t>& outOffsetsByResource,
+	std::vector<DependencyEdgeRecord>& outAccesses) const
+{
+	const size_t resourceCount = m_frameDAGResourceCount;
+	auto accessesForNode = [&](size_t nodeIndex) -> const std::vector<NodeAccess>* {
+		const size_t passIndex = nodes[nodeIndex].passIndex;
+		return passIndex < m_framePassAccessSummaries.size()
+			? &m_framePassAccessSummaries[passIndex].dagAccesses
+			: nullptr;
+	};
+	auto included = [&](size_t resourceIndex) {
+		return resourceIndex < resourceCount && (!resourceFilter || (*resourceFilter)[resourceIndex]);
+	};
+
+	outOffsetsByResource.assign(resourceCount + 1, 0);
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		if (const auto* dagAccesses = accessesForNode(i)) {
+			for (const auto& access : *dagAccesses) {
+				if (included(access.resourceIndex)) {
+					++outOffsetsByResource[access.resourceIndex + 1];
+				}
+			}
+		}
+	}
+	for (size_t r = 0; r < resourceCount; ++r) {
+		outOffsetsByResource[r + 1] += outOffsetsByResource[r];
+	}
+
+	outAccesses.resize(outOffsetsByResource[resourceCount]);
+	std::vector<uint32_t> cursor(outOffsetsByResource.begin(), outOffsetsByResource.end() - 1);
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		if (const auto* dagAccesses = accessesForNode(i)) {
+			for (size_t position = 0; position < dagAccesses->size(); ++position) {
+				const auto& access = (*dagAccesses)[position];
+				if (included(access.resourceIndex)) {
+					// "from" carries the access kind while gathering; real edges are emitted later.
+					outAccesses[cursor[access.resourceIndex]++] = DependencyEdgeRecord{
+						.to = static_cast<uint32_t>(i),
+						.accessPosition = static_cast<uint32_t>(position),
+						.from = static_cast<uint32_t>(access.kind),
+					};
+				}
+			}
+		}
+	}
+}
+
+void RenderGraph::AppendResourceDependencyEdges(
+	std::span<const DependencyEdgeRecord> accesses,
+	std::vector<uint32_t>& readsSinceWrite,
+	std::vector<DependencyEdgeRecord>& outEdges)
+{
+	std::optional<uint32_t> lastWriter;
+	readsSinceWrite.clear();
+	for (const auto& access : accesses) {
+		const auto kind = static_cast<AccessKind>(access.from);
+		if (lastWriter && *lastWriter != access.to) {
+			outEdges.push_back({ access.to, access.accessPosition, *lastWriter });
+		}
+		if (kind == AccessKind::Read) {
+			readsSinceWrite.push_back(access.to);
+		}
+		else {
+			for (uint32_t reader : readsSinceWrite) {
+				if (reader != access.to) {
+					outEdges.push_back({ access.to, access.accessPosition, reader });
+				}
+			}
+			readsSinceWrite.clear();
+			lastWriter = access.to;
+		}
+	}
+}
+
+void RenderGraph::MergeDependencyEdges(
+	std::vector<Node>& nodes,
+	std::vector<DependencyEdgeRecord>& edges,
+	std::span<const std::pair<size_t, size_t>> explicitEdges)
+{
+	// Emit edges in the order the serial walk discovers them: by consumer node, then by the
+	// consumer's access position, then producer. Keeping the first occurrence of each pair
+	// reproduces AddEdgeDedup() exactly, including in/out list ordering.
+	std::sort(edges.begin(), edges.end(), [](const DependencyEdgeRecord& lhs, const DependencyEdgeRecord& rhs) {
+		if (lhs.to != rhs.to) {
+			return lhs.to < rhs.to;
+		}
+		if (lhs.accessPosition != rhs.accessPosition) {
+			return lhs.accessPosition < rhs.accessPosition;
+		}
+		return lhs.from < rhs.from;
+	});
+	std::vector<uint32_t> lastConsumerByProducer(nodes.size(), std::numeric_limits<uint32_t>::max());
+	for (const auto& edge : edges) {
+		if (lastConsumerByProducer[edge.from] == edge.to) {
+			continue;
+		}
+		lastConsumerByProducer[edge.from] = edge.to;
+		nodes[edge.from].out.push_back(edge.to);
+		nodes[edge.to].in.push_back(edge.from);
+		nodes[edge.to].indegree++;
+	}
+
+	// Apply explicit edges (e.g. "After(passName)")
+	for (auto const& e : explicitEdges) {
+		if (e.first >= nodes.size() || e.second >= nodes.size() || e.first == e.second) continue;
+		auto& out = nodes[e.first].out;
+		if (std::find(out.begin(), out.end(), e.second) != out.end()) continue;
+		out.push_back(e.second);
+		nodes[e.second].in.push_back(e.first);
+		nodes[e.second].indegree++;
+	}
+}
+
+uint64_t RenderGraph::ComputeFrameStructureFingerprint(
+	const std::vector<Node>& nodes,
+	std::span<const std::pair<size_t, size_t>> explicitEdges) const
+{
+	ZoneScopedN("RenderGraph::ComputeFrameStructureFingerprint");
+	uint64_t fingerprint = HashCombine64(0x6672616d65666e70ull, nodes.size());
+	for (const auto& node : nodes) {
+		fingerprint = HashCombine64(fingerprint, node.originalOrder);
+		if (node.passIndex >= m_framePassAccessSummaries.size()) {
+			continue;
+		}
+		const auto& summary = m_framePassAccessSummaries[node.passIndex];
+		fingerprint = HashCombine64(fingerprint, summary.dagAccesses.size());
+		for (const auto& access : summary.dagAccesses) {
+			const uint64_t resourceID = access.resourceIndex < m_frameDAGResourceIDsByIndex.size()
+				? m_frameDAGResourceIDsByIndex[access.resourceIndex]
+				: std::numeric_limits<uint64_t>::max();
+			fingerprint = HashCombine64(fingerprint, resourceID);
+			fingerprint = HashCombine64(fingerprint, static_cast<uint64_t>(access.kind));
+		}
+	}
+	fingerprint = HashCombine64(fingerprint, explicitEdges.size());
+	for (const auto& [from, to] : explicitEdges) {
+		fingerprint = HashCombine64(fingerprint, (uint64_t(from) << 32) | uint64_t(to));
+	}
+	return fingerprint;
+}
+
+bool RenderGraph::TryReuseFrameDependencyGraph(std::vector<Node>& nodes, uint64_t fingerprint) const
+{
+	const auto& cache = m_frameDependencyGraphCache;
+	if (!cache.valid || cache.fingerprint != fingerprint || cache.outByNode.size() != nodes.size()) {
+		return false;
+	}
+
+	ZoneScopedN("RenderGraph::TryReuseFrameDependencyGraph");
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		auto& node = nodes[i];
+		node.out = cache.outByNode[i];
+		node.in = cache.inByNode[i];
+		node.indegree = cache.indegreeByNode[i];
+		node.topoRank = cache.topoRankByNode[i];
+		node.criticality = cache.criticalityByNode[i];
+	}
+	return true;
+}
+
+void RenderGraph::StoreFrameDependencyGraph(const std::vector<Node>& nodes, uint64_t fingerprint)
+{
+	ZoneScopedN("RenderGraph::StoreFrameDependencyGraph");
+	auto& cache = m_frameDependencyGraphCache;
+	cache.valid = true;
+	cache.fingerprint = fingerprint;
+	cache.outByNode.resize(nodes.size());
+	cache.inByNode.resize(nodes.size());
+	cache.indegreeByNode.resize(nodes.size());
+	cache.topoRankByNode.resize(nodes.size());
+	cache.criticalityByNode.resize(nodes.size());
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		const auto& node = nodes[i];
+		cache.outByNode[i] = node.out;
+		cache.inByNode[i] = node.in;
+		cache.indegreeByNode[i] = node.indegree;
+		cache.topoRankByNode[i] = node.topoRank;
+		cache.criticalityByNode[i] = node.criticality;
+	}
+}
+
+bool RenderGraph::FinalizeDependencyGraph(std::vector<Node>& nodes)
+{
+	// topo + criticality (longest path)
+	std::vector<uint32_t> indeg(nodes.size());
+	for (size_t i = 0; i < nodes.size(); ++i) indeg[i] = nodes[i].indegree;
+
+	auto originalOrderLess = [&](size_t lhs, size_t rhs) {
+		if (nodes[lhs].originalOrder != nodes[rhs].originalOrder) {
+			return nodes[lhs].originalOrder > nodes[rhs].originalOrder;
+		}
+		return lhs > rhs;
+	};
+
+	std::priority_queue<size_t, std::vector<size_t>, decltype(originalOrderLess)> ready(originalOrderLess);
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		if (indeg[i] == 0) {
+			ready.push(i);
+		}
+	}
+
+	std::vector<size_t> topo;
+	topo.reserve(nodes.size());
+
+	while (!ready.empty()) {
+		size_t u = ready.top();
+		ready.pop();
+		topo.push_back(u);
+		for (size_t v : nodes[u].out) {
+			if (--indeg[v] == 0) {
+				ready.push(v);
+			}
+		}
+	}
+
+	if (topo.size() != nodes.size()) {
+		// cycle: invalid graph
+		return false;
+	}
+
+	for (size_t rank = 0; rank < topo.size(); ++rank) {
+		nodes[topo[rank]].topoRank = rank;
+	}
+
+	// reverse topo DP
+	for (auto& node : nodes) {
+		node.criticality = 0;
+	}
+	for (auto it = topo.rbegin(); it != topo.rend(); ++it) {
+		size_t u = *it;
+		uint32_t best = 0;
+		for (size_t v : nodes[u].out)
+			best = std::max(best, uint32_t(1 + nodes[v].criticality));
 		nodes[u].criticality = best;
 	}
 
 	return true;
 }
 
+void RenderGraph::ComputeMeasuredCriticalPath(std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes)
+{
+	ZoneScopedN("RenderGraph::ComputeMeasuredCriticalPath");
+	m_frameMeasuredCriticalPathWeight = 0.0;
+	for (auto& node : nodes) {
+		node.measuredCriticalPath = 0.0f;
+	}
+	if (!m_statisticsService
+		|| !m_getQueueSchedulingMeasuredCriticalPathEnabled
+		|| !m_getQueueSchedulingMeasuredCriticalPathEnabled()) {
+		return;
+	}
+	const double weight = m_getQueueSchedulingCriticalPathWeight ? static_cast<double>(m_getQueueSchedulingCriticalPathWeight()) : 4.0;
+	if (weight <= 0.0) {
+		return;
+	}
+
+	const auto& passStats = m_statisticsService->GetPassStats();
+	std::vector<double> costByNode(nodes.size(), -1.0);
+	double measuredSum = 0.0;
+	size_t measuredCount = 0;
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		const size_t passIndex = nodes[i].passIndex;
+		if (passIndex >= passes.size()) {
+			continue;
+		}
+		const int statisticsIndex = std::visit(
+			[](const auto& passEntry) -> int {
+				using T = std::decay_t<decltype(passEntry)>;
+				if constexpr (std::is_same_v<T, std::monostate>) {
+					return -1;
+				}
+				else {
+					return passEntry.statisticsIndex;
+				}
+			},
+			passes[passIndex].pass);
+		if (statisticsIndex < 0 || static_cast<size_t>(statisticsIndex) >= passStats.size()) {
+			continue;
+		}
+		const double gpuTime = passStats[static_cast<size_t>(statisticsIndex)].gpuTimeEma;
+		if (gpuTime > 0.0) {
+			costByNode[i] = gpuTime;
+			measuredSum += gpuTime;
+			++measuredCount;
+		}
+	}
+	if (measuredCount == 0) {
+		// Nothing has been timed yet (first frames, or statistics collection off).
+		return;
+	}
+
+	// Passes without a sample get the frame mean so they neither dominate nor vanish from the path.
+	const double unmeasuredCost = measuredSum / static_cast<double>(measuredCount);
+	for (double& cost : costByNode) {
+		if (cost < 0.0) {
+			cost = unmeasuredCost;
+		}
+	}
+
+	std::vector<size_t> reverseTopo(nodes.size());
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		reverseTopo[i] = i;
+	}
+	std::sort(reverseTopo.begin(), reverseTopo.end(), [&](size_t lhs, size_t rhs) {
+		return nodes[lhs].topoRank > nodes[rhs].topoRank;
+	});
+
+	std::vector<double> pathByNode(nodes.size(), 0.0);
+	double longestPath = 0.0;
+	for (size_t u : reverseTopo) {
+		double best = 0.0;
+		for (size_t v : nodes[u].out) {
+			best = (std::max)(best, pathByNode[v]);
+		}
+		pathByNode[u] = costByNode[u] + best;
+		longestPath = (std::max)(longestPath, pathByNode[u]);
+	}
+	TracyPlot("RG.MeasuredCriticalPathMs", longestPath);
+	if (longestPath <= 0.0) {
+		return;
+	}
+
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		nodes[i].measuredCriticalPath = static_cast<float>(pathByNode[i] / longestPath);
+	}
+	m_frameMeasuredCriticalPathWeight = weight;
+}
+
+void RenderGraph::ComputePresentCriticalPasses(std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes)
+{
+	ZoneScopedN("RenderGraph::ComputePresentCriticalPasses");
+	m_framePresentCriticalNodeCount = 0;
+	for (auto& node : nodes) {
+		node.presentCritical = false;
+	}
+	m_lastPresentLatencyStats.presentCriticalPasses = 0;
+	m_lastPresentLatencyStats.deferredPasses = 0;
+	if (!m_getRenderGraphPresentLatencyModeEnabled || !m_getRenderGraphPresentLatencyModeEnabled()) {
+		return;
+	}
+
+	// Everything a present pass transitively depends on, through any edge: data, explicit
+	// After() and alias reuse alike. The set is closed under predecessors, so while any of it is
+	// unscheduled at least one member is ready.
+	std::vector<size_t> stack;
+	for (size_t i = 0; i < nodes.size(); ++i) {
+		const size_t passIndex = nodes[i].passIndex;
+		const auto* renderPass = passIndex < passes.size() ? std::get_if<RenderPassAndResources>(&passes[passIndex].pass) : nullptr;
+		if (renderPass && !renderPass->resources.presentResources.empty()) {
+			nodes[i].presentCritical = true;
+			stack.push_back(i);
+		}
+	}
+	while (!stack.empty()) {
+		const size_t u = stack.back();
+		stack.pop_back();
+		for (size_t pred : nodes[u].in) {
+			if (!nodes[pred].presentCritical) {
+				nodes[pred].presentCritical = true;
+				stack.push_back(pred);
+			}
+		}
+	}
+	for (const auto& node : nodes) {
+		m_framePresentCriticalNodeCount += node.presentCritical ? 1u : 0u;
+	}
+	m_lastPresentLatencyStats.presentCriticalPasses = m_framePresentCriticalNodeCount;
+	m_lastPresentLatencyStats.deferredPasses = nodes.size() - m_framePresentCriticalNodeCount;
+	TracyPlot("RG.PresentLatency.DeferredPasses", static_cast<int64_t>(m_lastPresentLatencyStats.deferredPasses));
+}
+
+double RenderGraph::CriticalPathSchedulingScore(const Node& node, size_t queueSlot) const
+{
+	return CriticalPathSchedulingScore(node.presentCritical, node.criticality, node.measuredCriticalPath, queueSlot);
+}
+
+double RenderGraph::CriticalPathSchedulingScore(bool presentCritical, uint32_t criticality, float measuredCriticalPath, size_t queueSlot) const
+{
+	// Present-latency mode: work feeding the present outranks every packing heuristic.
+	const double presentBonus = presentCritical ? 1000.0 : 0.0;
+	if (m_frameMeasuredCriticalPathWeight <= 0.0) {
+		// Static tie-break: hop count to the furthest sink.
+		return presentBonus + 0.05 * double(criticality);
+	}
+
+	// Longest remaining measured path first. Compute-queue work on that path gets the bonus
+	// twice so async passes that gate the frame start as early as their dependencies allow.
+	double score = presentBonus + m_frameMeasuredCriticalPathWeight * double(measuredCriticalPath);
+	if (queueSlot < m_queueRegistry.SlotCount()
+		&& m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(queueSlot))) == QueueKind::Compute) {
+		score += m_frameMeasuredCriticalPathWeight * double(measuredCriticalPath);
+	}
+	return score;
+}
+
+void RenderGraph::SchedulerNodeTable::Build(const std::vector<Node>& nodes, const std::vector<AnyPassAndResources>& passes)
+{
+	ZoneScopedN("RenderGraph::SchedulerNodeTable::Build");
+	const size_t nodeCount = nodes.size();
+	passIndex.resize(nodeCount);
+	assignedQueueSlot.resize(nodeCount);
+	compatibleQueueKindMask.resize(nodeCount);
+	presentCritical.resize(nodeCount);
+	automaticCompute.resize(nodeCount);
+	indegree.resize(nodeCount);
+	criticality.resize(nodeCount);
+	measuredCriticalPath.resize(nodeCount);
+	originalOrder.resize(nodeCount);
+	inOffsets.resize(nodeCount + 1);
+	outOffsets.resize(nodeCount + 1);
+	compatibleSlotOffsets.resize(nodeCount + 1);
+	inNodes.clear();
+	outNodes.clear();
+	compatibleSlots.clear();
+
+	for (size_t i = 0; i < nodeCount; ++i) {
+		const Node& node = nodes[i];
+		passIndex[i] = static_cast<uint32_t>(node.passIndex);
+		assignedQueueSlot[i] = static_cast<uint16_t>(node.assignedQueueSlot.value_or(node.queueSlot));
+		compatibleQueueKindMask[i] = node.compatibleQueueKindMask;
+		presentCritical[i] = node.presentCritical ? 1 : 0;
+		automaticCompute[i] = node.passIndex < passes.size()
+			&& passes[node.passIndex].type == PassType::Compute
+			&& node.queueAssignmentPolicy == QueueAssignmentPolicy::Automatic;
+		indegree[i] = node.indegree;
+		criticality[i] = node.criticality;
+		measuredCriticalPath[i] = node.measuredCriticalPath;
+		originalOrder[i] = node.originalOrder;
+
+		inOffsets[i] = static_cast<uint32_t>(inNodes.size());
+		for (size_t pred : node.in) {
+			inNodes.push_back(static_cast<uint32_t>(pred));
+		}
+		outOffsets[i] = static_cast<uint32_t>(outNodes.size());
+		for (size_t succ : node.out) {
+			outNodes.push_back(static_cast<uint32_t>(succ));
+		}
+		compatibleSlotOffsets[i] = static_cast<uint32_t>(compatibleSlots.size());
+		for (size_t slot : node.compatibleQueueSlots) {
+			compatibleSlots.push_back(static_cast<uint16_t>(slot));
+		}
+	}
+	inOffsets[nodeCount] = static_cast<uint32_t>(inNodes.size());
+	outOffsets[nodeCount] = static_cast<uint32_t>(outNodes.size());
+	compatibleSlotOffsets[nodeCount] = static_cast<uint32_t>(compatibleSlots.size());
+}
+
 bool RenderGraph::AddCurrentFrameAliasSchedulingEdges(std::vector<Node>& nodes)
 {
 	ZoneScopedN("RenderGraph::AddCurrentFrameAliasSchedulingEdges");
@@ -1953,6 +3025,39 @@ bool RenderGraph::AddCurrentFrameAliasSchedulingEdges(std::vector<Node>& nodes)
 		}
 	}
 
+	// An existing dependency path from the earlier resource's last use to the later one's first
+	// use already orders them, on one queue or through the cross-queue wait the scheduler emits
+	// for that path, so the alias hazard needs no extra edge. Extra edges are exactly what pins
+	// async compute behind unrelated graphics work. Every edge goes from a lower to a higher
+	// topological rank, so the search only walks nodes ranked below the target.
+	std::vector<uint32_t> visitedEpoch(nodes.size(), 0);
+	uint32_t currentEpoch = 0;
+	std::vector<size_t> searchStack;
+	auto isAlreadyOrdered = [&](size_t fromNode, size_t toNode) {
+		const size_t targetRank = nodes[toNode].topoRank;
+		++currentEpoch;
+		searchStack.clear();
+		searchStack.push_back(fromNode);
+		visitedEpoch[fromNode] = currentEpoch;
+		while (!searchStack.empty()) {
+			const size_t node = searchStack.back();
+			searchStack.pop_back();
+			for (size_t next : nodes[node].out) {
+				if (next == toNode) {
+					return true;
+				}
+				if (visitedEpoch[next] == currentEpoch || nodes[next].topoRank >= targetRank) {
+					continue;
+				}
+				visitedEpoch[next] = currentEpoch;
+				searchStack.push_back(next);
+			}
+		}
+		return false;
+	};
+	uint64_t impliedEdgeCount = 0;
+	uint64_t addedEdgeCount = 0;
+
 	for (size_t i = 0; i < resourceIDs.size(); ++i) {
 		const uint64_t lhsResourceID = resourceIDs[i];
 		const auto* lhs = TryGetAliasPlacementRange(lhsResourceID);
@@ -2011,10 +3116,19 @@ bool RenderGraph::AddCurrentFrameAliasSchedulingEdges(std::vector<Node>& nodes)
 				continue;
 			}
 
-			AddEdgeDedup(fromNodeIt->second, toNodeIt->second, nodes, edgeSet);
+			if (isAlreadyOrdered(fromNodeIt->second, toNodeIt->second)) {
+				++impliedEdgeCount;
+				continue;
+			}
+			if (AddEdgeDedup(fromNodeIt->second, toNodeIt->second, nodes, edgeSet)) {
+				++addedEdgeCount;
+			}
 		}
 	}
 
+	TracyPlot("RG.AliasSchedulingEdges.Implied", static_cast<int64_t>(impliedEdgeCount));
+	TracyPlot("RG.AliasSchedulingEdges.Added", static_cast<int64_t>(addedEdgeCount));
+
 	return FinalizeDependencyGraph(nodes);
 }
 
@@ -2025,8 +3139,8 @@ void RenderGraph::CommitPassToBatch(
 
 	unsigned int currentBatchIndex,
 	PassBatch& currentBatch,
-	std::unordered_set<uint64_t>& scratchTransitioned,
-	std::unordered_set<size_t>& scratchFallback,
+	DenseResourceIndexSet& scratchTransitioned,
+	DenseResourceIndexSet& scratchFallback,
 	std::vector<ResourceTransition>& scratchTransitions)
 {
 	ZoneScopedN("RenderGraph::CommitPassToBatch");
@@ -2037,12 +3151,13 @@ void RenderGraph::CommitPassToBatch(
 	const size_t queueCount = currentBatch.QueueCount();
 	const size_t gfxSlot = QueueIndex(QueueKind::Graphics);
 	const auto& passSummary = rg.m_framePassSchedulingSummaries[node.passIndex];
-	scratchTransitioned.clear();
+	scratchTransitioned.Clear();
 	auto& resourcesTransitionedThisPass = scratchTransitioned;
 
-	scratchFallback.clear();
+	scratchFallback.Clear();
 	auto& fallbackResourceIndices = scratchFallback;
 	rg.ProcessResourceRequirements(
+		node.passIndex,
 		passQueueSlot,
 		passSummary.requirements,
 		pr.name,
@@ -2108,8 +3223,8 @@ void RenderGraph::CommitPassToBatch(
 				compileResourceState.fastState.state = exit.second;
 			}
 			else {
-				compileResourceState.fastState.valid = false;
-				compileResourceState.fastState.wholeResourceOnly = false;
+				compileResourceState.fastState.valid = TryGetWholeResourceTrackerState(compileResourceState.tracker, compileResourceState.fastState.state);
+				compileResourceState.fastState.wholeResourceOnly = compileResourceState.fastState.valid;
 			}
 			SortedInsert(currentBatch.internallyTransitionedResources, denseTransition.resourceID);
 		}
@@ -2138,6 +3253,14 @@ void RenderGraph::CommitPassToBatch(
 				for (const auto& wait : pass.resources.externalWaitsBeforeTransitions) {
 					currentBatch.AddExternalWaitBeforeTransitions(passQueueSlot, wait);
 				}
+				if (!rg.m_frameExternalReadyPoints.empty()) {
+					// Imported textures: wait for the producer's write before this pass's transitions.
+					for (const auto& requirement : passSummary.requirements) {
+						if (const auto* readyPoint = rg.FindFrameExternalReadyPoint(requirement.resourceIndex)) {
+							currentBatch.AddExternalWaitBeforeTransitions(passQueueSlot, *readyPoint);
+						}
+					}
+				}
 				applyInternalTransitions(pass);
 				recordRequirementHistory();
 
@@ -2165,9 +3288,12 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 	std::vector<Node>& nodes)
 {
 	ZoneScopedN("RenderGraph::AutoScheduleAndBuildBatches");
+	FrameTraceScope frameTraceScope("AutoScheduleAndBuildBatches");
+	auto& table = rg.m_schedulerNodeTable;
+	table.Build(nodes, passes);
+
 	// Working indegrees
-	std::vector<uint32_t> indeg(nodes.size());
-	for (size_t i = 0; i < nodes.size(); ++i) indeg[i] = nodes[i].indegree;
+	std::vector<uint32_t> indeg(table.indegree);
 
 	std::vector<size_t> ready;
 	ready.reserve(nodes.size());
@@ -2176,7 +3302,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 
 	auto openNewBatch = [&]() -> PassBatch {
 		const size_t queueCount = rg.m_queueRegistry.SlotCount();
-		PassBatch b(queueCount);
+		PassBatch b = rg.AcquirePassBatch(queueCount);
 		b.passBatchTrackersByResourceIndex.assign(rg.m_frameSchedulingResourceCount, nullptr);
 		for (size_t qi = 0; qi < queueCount; ++qi) {
 			b.SetQueueSignalFenceValue(RenderGraph::BatchSignalPhase::AfterTransitions, qi, rg.GetNextQueueFenceValue(qi));
@@ -2195,8 +3321,8 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 	batchBuildState.Initialize(nodes.size(), queueCount, rg.m_frameSchedulingResourceCount);
 
 	// Scratch sets reused across CommitPassToBatch calls to avoid per-call allocation
-	std::unordered_set<uint64_t> scratchTransitioned;
-	std::unordered_set<size_t> scratchFallback;
+	DenseResourceIndexSet scratchTransitioned(rg.m_frameSchedulingResourceCount);
+	DenseResourceIndexSet scratchFallback(rg.m_frameSchedulingResourceCount);
 	std::vector<ResourceTransition> scratchTransitions;
 	const double autoGraphicsBias = rg.m_getQueueSchedulingAutoGraphicsBias ? static_cast<double>(rg.m_getQueueSchedulingAutoGraphicsBias()) : 2.5;
 	const double asyncOverlapBonus = rg.m_getQueueSchedulingAsyncOverlapBonus ? static_cast<double>(rg.m_getQueueSchedulingAsyncOverlapBonus()) : 3.0;
@@ -2267,6 +3393,18 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 
 	size_t remaining = nodes.size();
 	bool closedBatchBeforeNextCommit = false;
+	size_t presentCriticalRemaining = rg.m_framePresentCriticalNodeCount;
+	// The last present-critical pass ends its batch, so the present queue signals before any
+	// deferred work is submitted behind it.
+	auto notePresentCriticalCommitted = [&](const Node& committedNode) {
+		if (!committedNode.presentCritical || presentCriticalRemaining == 0) {
+			return;
+		}
+		if (--presentCriticalRemaining == 0) {
+			closeBatch();
+			closedBatchBeforeNextCommit = true;
+		}
+	};
 
 	while (remaining > 0) {
 		// Collect "fits" and pick best by heuristic
@@ -2286,7 +3424,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 
 		size_t readyGraphicsCapableCount = 0;
 		for (size_t ni : ready) {
-			if ((nodes[ni].compatibleQueueKindMask & static_cast<uint8_t>(1u << QueueIndex(QueueKind::Graphics))) != 0) {
+			if ((table.compatibleQueueKindMask[ni] & static_cast<uint8_t>(1u << QueueIndex(QueueKind::Graphics))) != 0) {
 				++readyGraphicsCapableCount;
 			}
 		}
@@ -2296,10 +3434,14 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 		for (int ri = 0; ri < (int)ready.size(); ++ri) {
 			size_t ni = ready[ri];
 
-			auto& n = nodes[ni];
-			const auto& passSummary = rg.m_framePassSchedulingSummaries[n.passIndex];
+			// Present-latency mode holds everything else back until the present work is placed.
+			if (presentCriticalRemaining > 0 && !table.presentCritical[ni]) {
+				continue;
+			}
+			const uint32_t passIndex = table.passIndex[ni];
+			const auto& passSummary = rg.m_framePassSchedulingSummaries[passIndex];
 
-			for (size_t nodeQueueSlot : n.compatibleQueueSlots) {
+			for (size_t nodeQueueSlot : table.CompatibleSlots(ni)) {
 				++candidateChecks;
 				if (nodeQueueSlot >= queueCount) {
 					continue;
@@ -2312,12 +3454,11 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 				// A node can only join the current batch on a slot if every in-batch
 				// predecessor is already assigned to that same slot.
 				bool hasCrossQueuePredInBatch = false;
-				for (size_t pred : n.in) {
+				for (uint32_t pred : table.In(ni)) {
 					if (!batchBuildState.ContainsNode(pred)) {
 						continue;
 					}
-					const size_t predQueueSlot = nodes[pred].assignedQueueSlot.value_or(nodes[pred].queueSlot);
-					if (predQueueSlot != nodeQueueSlot) {
+					if (table.assignedQueueSlot[pred] != nodeQueueSlot) {
 						hasCrossQueuePredInBatch = true;
 						break;
 					}
@@ -2331,7 +3472,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 					passSummary,
 					currentBatch.passBatchTrackersByResourceIndex,
 					batchBuildState,
-					passes[n.passIndex].name,
+					passes[passIndex].name,
 					currentBatchIndex,
 					nodeQueueSlot))
 				{
@@ -2352,25 +3493,23 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 				// Encourage spreading compatible work across less-populated queues.
 				score -= 0.25 * double(currentBatch.Passes(nodeQueueSlot).size());
 
-				// Tie-break
-				score += 0.05 * double(n.criticality);
+				// Tie-break (or measured critical path, when GPU timings are available)
+				score += rg.CriticalPathSchedulingScore(table.presentCritical[ni] != 0, table.criticality[ni], table.measuredCriticalPath[ni], nodeQueueSlot);
 
-				if (passes[n.passIndex].type == PassType::Compute
-					&& n.queueAssignmentPolicy == QueueAssignmentPolicy::Automatic) {
+				if (table.automaticCompute[ni]) {
 					const QueueKind candidateKind = rg.m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(nodeQueueSlot)));
 					const uint8_t candidateKindMask = static_cast<uint8_t>(1u << QueueIndex(candidateKind));
 					size_t predecessorCrossQueueCount = 0;
-					for (size_t pred : n.in) {
-						const size_t predSlot = nodes[pred].assignedQueueSlot.value_or(nodes[pred].queueSlot);
-						const QueueKind predKind = rg.m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(predSlot)));
+					for (uint32_t pred : table.In(ni)) {
+						const QueueKind predKind = rg.m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(table.assignedQueueSlot[pred])));
 						if (predKind != candidateKind) {
 							++predecessorCrossQueueCount;
 						}
 					}
 
 					size_t successorCrossQueueCount = 0;
-					for (size_t succ : n.out) {
-						if ((nodes[succ].compatibleQueueKindMask & candidateKindMask) == 0) {
+					for (uint32_t succ : table.Out(ni)) {
+						if ((table.compatibleQueueKindMask[succ] & candidateKindMask) == 0) {
 							++successorCrossQueueCount;
 						}
 					}
@@ -2381,7 +3520,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 						score += autoGraphicsBias;
 					}
 					else if (candidateKind == QueueKind::Compute) {
-						const bool candidateCanAlsoRunOnGraphics = (n.compatibleQueueKindMask & static_cast<uint8_t>(1u << QueueIndex(QueueKind::Graphics))) != 0;
+						const bool candidateCanAlsoRunOnGraphics = (table.compatibleQueueKindMask[ni] & static_cast<uint8_t>(1u << QueueIndex(QueueKind::Graphics))) != 0;
 						const size_t otherReadyGraphicsCandidates = readyGraphicsCapableCount > 0
 							? readyGraphicsCapableCount - (candidateCanAlsoRunOnGraphics ? 1u : 0u)
 							: 0u;
@@ -2395,7 +3534,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 				}
 
 				// Deterministic tie-break: prefer earlier original order slightly
-				score += 1e-6 * double(nodes.size() - n.originalOrder);
+				score += 1e-6 * double(nodes.size() - table.originalOrder[ni]);
 
 				if (score > bestScore) {
 					bestScore = score;
@@ -2421,7 +3560,13 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 				ZoneScopedN("RenderGraph::AutoScheduleAndBuildBatches::CommitFallbackPass");
 				// Should be rare; fall back by forcing one ready pass in.
 				// If this happens, IsNewBatchNeeded is likely too strict on empty batch.
-				size_t ni = ready.front();
+				size_t fallbackIdxInReady = 0;
+				while (presentCriticalRemaining > 0
+					&& fallbackIdxInReady + 1 < ready.size()
+					&& !table.presentCritical[ready[fallbackIdxInReady]]) {
+					++fallbackIdxInReady;
+				}
+				size_t ni = ready[fallbackIdxInReady];
 				auto& n = nodes[ni];
 				if (!passes[n.passIndex].name.empty()) {
 					ZoneText(passes[n.passIndex].name.data(), passes[n.passIndex].name.size());
@@ -2434,6 +3579,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 					}
 				}
 				n.assignedQueueSlot = fallbackSlot;
+				table.assignedQueueSlot[ni] = static_cast<uint16_t>(fallbackSlot);
 				if (n.passIndex < rg.m_assignedQueueSlotsByFramePass.size()) {
 					rg.m_assignedQueueSlotsByFramePass[n.passIndex] = *n.assignedQueueSlot;
 				}
@@ -2452,6 +3598,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 					.candidateChecks = candidateChecks,
 					.isNewBatchNeededChecks = isNewBatchNeededChecks,
 					.fallbackCommit = true,
+					.adaptivePlacement = n.adaptivePlacement,
 				});
 				closedBatchBeforeNextCommit = false;
 				CommitPassToBatch(
@@ -2467,12 +3614,13 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 					closeBatch();
 					closedBatchBeforeNextCommit = true;
 				}
+				notePresentCriticalCommitted(n);
 
 				// Pop from ready
-				ready[0] = ready.back();
+				ready[fallbackIdxInReady] = ready.back();
 				ready.pop_back();
 
-				for (size_t v : nodes[ni].out) {
+				for (uint32_t v : table.Out(ni)) {
 					if (--indeg[v] == 0) ready.push_back(v);
 				}
 				--remaining;
@@ -2492,6 +3640,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 				ZoneText(passes[chosen.passIndex].name.data(), passes[chosen.passIndex].name.size());
 			}
 			chosen.assignedQueueSlot = bestQueueSlot;
+			table.assignedQueueSlot[chosenNodeIndex] = static_cast<uint16_t>(bestQueueSlot);
 			if (chosen.passIndex < rg.m_assignedQueueSlotsByFramePass.size()) {
 				rg.m_assignedQueueSlotsByFramePass[chosen.passIndex] = bestQueueSlot;
 			}
@@ -2510,6 +3659,7 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 				.candidateChecks = candidateChecks,
 				.isNewBatchNeededChecks = isNewBatchNeededChecks,
 				.fallbackCommit = false,
+				.adaptivePlacement = chosen.adaptivePlacement,
 			});
 			closedBatchBeforeNextCommit = false;
 			CommitPassToBatch(
@@ -2526,13 +3676,14 @@ void RenderGraph::AutoScheduleAndBuildBatches(
 		}
 
 		batchBuildState.MarkNode(chosenNodeIndex);
+		notePresentCriticalCommitted(chosen);
 
 		// Remove from ready
 		ready[bestIdxInReady] = ready.back();
 		ready.pop_back();
 
 		// Release successors
-		for (size_t v : chosen.out) {
+		for (uint32_t v : table.Out(chosenNodeIndex)) {
 			if (--indeg[v] == 0) ready.push_back(v);
 		}
 
@@ -2733,15 +3884,96 @@ void RenderGraph::CoalesceQueueWaitsAndSignals(std::vector<PassBatch>& batchesTo
 	}
 }
 
-void RenderGraph::AssignQueueSignalFenceValuesInSubmissionOrder(std::vector<PassBatch>& batchesToAssign)
+size_t RenderGraph::ReduceTransitiveQueueWaits(std::vector<PassBatch>& batchesToReduce) const
 {
-	ZoneScopedN("RenderGraph::AssignQueueSignalFenceValuesInSubmissionOrder");
+	ZoneScopedN("RenderGraph::ReduceTransitiveQueueWaits");
 	const size_t slotCount = m_queueRegistry.SlotCount();
-	std::vector<std::unordered_map<UINT64, UINT64>> remappedFenceValuesByQueue(slotCount);
+	using QueueOrdering = std::vector<UINT64>;
+
+	// known[q][s]: highest fence value of queue s that queue q is already ordered after at the
+	// current point of its timeline, through its own waits and everything those waits imply.
+	std::vector<QueueOrdering> known(slotCount, QueueOrdering(slotCount, 0));
+	// What each signalling queue was ordered after when it signalled, keyed by fence value. Only
+	// this frame's signals are recorded; waits on anything else contribute just their own value.
+	std::vector<std::unordered_map<UINT64, QueueOrdering>> orderingAtSignal(slotCount);
+
+	struct PendingWait {
+		size_t src = 0;
+		UINT64 value = 0;
+		const QueueOrdering* implies = nullptr;
+		bool kept = true;
+	};
+	auto merge = [](QueueOrdering& into, const PendingWait& wait) {
+		into[wait.src] = std::max(into[wait.src], wait.value);
+		if (wait.implies) {
+			for (size_t q = 0; q < into.size(); ++q) {
+				into[q] = std::max(into[q], (*wait.implies)[q]);
+			}
+		}
+	};
 
-	for (auto& batch : batchesToAssign) {
+	std::vector<PendingWait> waits;
+	QueueOrdering candidate(slotCount, 0);
+	size_t removedWaits = 0;
+	for (auto& batch : batchesToReduce) {
 		const size_t queueCount = std::min(batch.QueueCount(), slotCount);
-		for (size_t qi = 0; qi < queueCount; ++qi) {
+		// Wait phase i precedes signal phase i on every queue's timeline within a batch.
+		for (size_t stage = 0; stage < PassBatch::kWaitPhaseCount; ++stage) {
+			const auto waitPhase = static_cast<BatchWaitPhase>(stage);
+			for (size_t dst = 0; dst < queueCount; ++dst) {
+				waits.clear();
+				for (size_t src = 0; src < queueCount; ++src) {
+					if (src == dst || !batch.HasQueueWait(waitPhase, dst, src)) {
+						continue;
+					}
+					const UINT64 value = batch.GetQueueWaitFenceValue(waitPhase, dst, src);
+					auto it = orderingAtSignal[src].find(value);
+					waits.push_back({ src, value, it != orderingAtSignal[src].end() ? &it->second : nullptr, true });
+				}
+
+				// A wait is redundant when the queue's prior ordering, plus whatever the other kept
+				// waits of this phase imply, already covers the awaited value.
+				for (size_t i = 0; i < waits.size(); ++i) {
+					candidate = known[dst];
+					for (size_t j = 0; j < waits.size(); ++j) {
+						if (j != i && waits[j].kept) {
+							merge(candidate, waits[j]);
+						}
+					}
+					if (candidate[waits[i].src] >= waits[i].value) {
+						waits[i].kept = false;
+						batch.ClearQueueWait(waitPhase, dst, waits[i].src);
+						++removedWaits;
+					}
+				}
+				for (const auto& wait : waits) {
+					merge(known[dst], wait);
+				}
+			}
+
+			const auto signalPhase = static_cast<BatchSignalPhase>(stage);
+			for (size_t qi = 0; qi < queueCount; ++qi) {
+				if (!batch.HasQueueSignal(signalPhase, qi)) {
+					continue;
+				}
+				const UINT64 value = batch.GetQueueSignalFenceValue(signalPhase, qi);
+				known[qi][qi] = std::max(known[qi][qi], value);
+				orderingAtSignal[qi][value] = known[qi];
+			}
+		}
+	}
+	return removedWaits;
+}
+
+void RenderGraph::AssignQueueSignalFenceValuesInSubmissionOrder(std::vector<PassBatch>& batchesToAssign)
+{
+	ZoneScopedN("RenderGraph::AssignQueueSignalFenceValuesInSubmissionOrder");
+	const size_t slotCount = m_queueRegistry.SlotCount();
+	std::vector<std::unordered_map<UINT64, UINT64>> remappedFenceValuesByQueue(slotCount);
+
+	for (auto& batch : batchesToAssign) {
+		const size_t queueCount = std::min(batch.QueueCount(), slotCount);
+		for (size_t qi = 0; qi < queueCount; ++qi) {
 			for (size_t phaseIndex = 0; phaseIndex < PassBatch::kSignalPhaseCount; ++phaseIndex) {
 				const auto phase = static_cast<BatchSignalPhase>(phaseIndex);
 				if (!batch.HasQueueSignal(phase, qi)) {
@@ -2783,14 +4015,24 @@ void RenderGraph::AddTransition(
 	size_t passQueueSlot,
 	std::string_view passName,
 	const DenseRequirementSummary& requirement,
-	std::unordered_set<uint64_t>& outTransitionedResourceIDs,
-	std::unordered_set<size_t>& outFallbackResourceIndices,
+	DenseResourceIndexSet& outTransitionedResourceIndices,
+	DenseResourceIndexSet& outFallbackResourceIndices,
 	std::vector<ResourceTransition>& scratchTransitions)
 {
 	ZoneScopedN("RenderGraph::AddTransition");
 	const QueueKind passQueue = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(passQueueSlot));
 	const ResourceState requiredState = NormalizeStateForQueue(passQueue, requirement.state);
 
+	if (requirement.resourceIndex < m_frameFirstUseByResourceIndex.size()
+		&& !m_frameFirstUseByResourceIndex[requirement.resourceIndex].recorded) {
+		m_frameFirstUseByResourceIndex[requirement.resourceIndex] = FrameFirstUse{
+			.recorded = true,
+			.wholeResource = IsWholeResourceRange(requirement.range, requirement.resource),
+			.range = requirement.range,
+			.state = requiredState,
+		};
+	}
+
 	if (TryAddTransitionFastNoOp(batchIndex, currentBatch, passQueueSlot, requirement, requiredState)) {
 		return;
 	}
@@ -2802,7 +4044,7 @@ void RenderGraph::AddTransition(
 		passName,
 		requirement,
 		requiredState,
-		outTransitionedResourceIDs,
+		outTransitionedResourceIndices,
 		outFallbackResourceIndices,
 		scratchTransitions);
 }
@@ -2827,13 +4069,13 @@ bool RenderGraph::TryAddTransitionFastNoOp(
 		return false;
 	}
 
+	// The shadow records the state of every subresource when the whole resource is uniform, so any
+	// requirement (whole or partial range) that asks for that state is satisfied without touching
+	// the tracker.
 	auto& entry = m_frameCompileResources[requirement.resourceIndex];
 	if (!entry.fastState.valid || !entry.fastState.wholeResourceOnly) {
 		return false;
 	}
-	if (!IsWholeResourceRange(requirement.range, requirement.resource)) {
-		return false;
-	}
 	if (!StatesExactlyEqual(entry.fastState.state, requiredState)) {
 		return false;
 	}
@@ -2849,8 +4091,8 @@ void RenderGraph::AddTransitionSlowPath(
 	std::string_view passName,
 	const DenseRequirementSummary& requirement,
 	ResourceState requiredState,
-	std::unordered_set<uint64_t>& outTransitionedResourceIDs,
-	std::unordered_set<size_t>& outFallbackResourceIndices,
+	DenseResourceIndexSet& outTransitionedResourceIndices,
+	DenseResourceIndexSet& outFallbackResourceIndices,
 	std::vector<ResourceTransition>& scratchTransitions)
 {
 	ZoneScopedN("RenderGraph::AddTransitionSlowPath");
@@ -2982,7 +4224,31 @@ void RenderGraph::AddTransitionSlowPath(
 		m_aliasActivationPendingByResourceIndex[requirement.resourceIndex] = 0;
 	}
 	else {
-		compileTracker.Apply(requirement.range, pRes, requiredState, transitions);
+		ResourceState trackedBeforeState{};
+		// A pass that overwrites the whole texture does not need its old contents, so the layout
+		// change can discard them, the same way alias activation initializes a placed texture.
+		if (requirement.fullOverwrite
+			&& isWholeResourceRequirement
+			&& pRes && pRes->HasLayout()
+			&& TryGetWholeResourceTrackerState(compileTracker, trackedBeforeState)
+			&& !StatesExactlyEqual(trackedBeforeState, requiredState)) {
+			transitions.emplace_back(
+				pRes,
+				requirement.range,
+				trackedBeforeState.access,
+				requiredState.access,
+				trackedBeforeState.layout,
+				requiredState.layout,
+				trackedBeforeState.sync,
+				requiredState.sync,
+				true);
+			std::vector<ResourceTransition> ignored;
+			compileTracker.Apply(requirement.range, pRes, requiredState, ignored);
+			++m_transitionPlacementStats.fullOverwriteDiscardCount;
+		}
+		else {
+			compileTracker.Apply(requirement.range, pRes, requiredState, transitions);
+		}
 	}
 
 	if (isWholeResourceRequirement) {
@@ -2991,8 +4257,10 @@ void RenderGraph::AddTransitionSlowPath(
 		fastState.state = requiredState;
 	}
 	else {
-		fastState.valid = false;
-		fastState.wholeResourceOnly = false;
+		// A partial-range requirement can still leave the resource uniform (e.g. the last
+		// mismatched subresources catching up), so re-derive the shadow instead of dropping it.
+		fastState.valid = TryGetWholeResourceTrackerState(compileTracker, fastState.state);
+		fastState.wholeResourceOnly = fastState.valid;
 	}
 
 	if (debugStats) {
@@ -3003,7 +4271,7 @@ void RenderGraph::AddTransitionSlowPath(
 	}
 
 	if (!transitions.empty()) {
-		outTransitionedResourceIDs.insert(requirement.resourceID);
+		outTransitionedResourceIndices.Insert(requirement.resourceIndex);
 	}
 
 	currentBatch.passBatchTrackersByResourceIndex[requirement.resourceIndex] = &compileTracker; // We will need to check subsequent passes against this
@@ -3026,6 +4294,14 @@ void RenderGraph::AddTransitionSlowPath(
 	const size_t gfxSlot = QueueIndex(QueueKind::Graphics);
 	const size_t transitionSlot = (passQueue != QueueKind::Graphics && needsGraphicsQueueForTransitions)
 		? gfxSlot : passQueueSlot;
+	if (transitionSlot != passQueueSlot && !m_queueRegistry.IsOnPrimaryAdapter(static_cast<QueueSlotIndex>(passQueueSlot))) {
+		// The fallback graphics queue is on the primary adapter and cannot touch this adapter's lists.
+		throw std::runtime_error(fmt::format(
+			"Pass '{}' on queue slot {} (adapter {}) needs a transition its queue cannot record; pin it to a graphics slot on that adapter",
+			passName,
+			passQueueSlot,
+			m_queueRegistry.GetAdapter(static_cast<QueueSlotIndex>(passQueueSlot))));
+	}
 
 	unsigned int lastUseBatch = 0;
 	uint64_t lastUseQueueMask = 0;
@@ -3100,6 +4376,36 @@ void RenderGraph::AddTransitionSlowPath(
 		});
 	}
 
+	// Split barriers: begin layout transitions right after the last use and end them right
+	// before this pass, so the layout change overlaps the batches in between. Both halves stay
+	// on the consuming queue, which is also the only queue that touched the resource since.
+	const bool splitBarriersEnabled = m_getRenderGraphSplitBarriersEnabled && m_getRenderGraphSplitBarriersEnabled();
+	if (splitBarriersEnabled
+		&& !isAliasActivation
+		&& !requiresCrossQueuePlacementCoordination
+		&& !needsGraphicsQueueForTransitions
+		&& lastUseBatch > 0
+		&& lastUseBatch + 1 < batchIndex) {
+		PassBatch& beginBatch = batches[lastUseBatch];
+		size_t splitCount = 0;
+		for (auto& transition : transitions) {
+			if (!IsSplitBarrierCandidate(transition)) {
+				currentBatch.Transitions(passQueueSlot, BatchTransitionPhase::BeforePasses).push_back(transition);
+				continue;
+			}
+			auto [beginHalf, endHalf] = SplitTransition(transition);
+			beginBatch.Transitions(passQueueSlot, BatchTransitionPhase::AfterPasses).push_back(std::move(beginHalf));
+			currentBatch.Transitions(passQueueSlot, BatchTransitionPhase::BeforePasses).push_back(std::move(endHalf));
+			++splitCount;
+		}
+		if (debugStats) {
+			debugStats->beforePassTransitionCount += transitions.size();
+		}
+		m_transitionPlacementStats.splitBarrierCount += splitCount;
+		m_transitionPlacementStats.canonicalBeforePassCount += transitions.size() - splitCount;
+		return;
+	}
+
 	const auto transitionPlacementMode = m_getTransitionPlacementMode
 		? m_getTransitionPlacementMode()
 		: rg::runtime::TransitionPlacementMode::InlineEarlyPlacement;
@@ -3112,7 +4418,7 @@ void RenderGraph::AddTransitionSlowPath(
 				debugStats->beforePassTransitionCount += transitions.size();
 				debugStats->graphicsFallbackTransitionCount += transitions.size();
 			}
-			outFallbackResourceIndices.insert(requirement.resourceIndex);
+			outFallbackResourceIndices.Insert(requirement.resourceIndex);
 		}
 		else {
 			for (auto& transition : transitions) {
@@ -3167,7 +4473,7 @@ void RenderGraph::AddTransitionSlowPath(
 			debugStats->beforePassTransitionCount += transitions.size();
 			debugStats->graphicsFallbackTransitionCount += transitions.size();
 		}
-		outFallbackResourceIndices.insert(requirement.resourceIndex);
+		outFallbackResourceIndices.Insert(requirement.resourceIndex);
 	}
 	else {
 		for (auto& transition : transitions) {
@@ -3181,18 +4487,43 @@ void RenderGraph::AddTransitionSlowPath(
 }
 
 void RenderGraph::ProcessResourceRequirements(
+	size_t passIndex,
 	size_t passQueueSlot,
 	const std::vector<DenseRequirementSummary>& resourceRequirements,
 	std::string_view passName,
 	unsigned int batchIndex,
-	PassBatch& currentBatch, std::unordered_set<uint64_t>& outTransitionedResourceIDs,
-	std::unordered_set<size_t>& outFallbackResourceIndices,
+	PassBatch& currentBatch, DenseResourceIndexSet& outTransitionedResourceIndices,
+	DenseResourceIndexSet& outFallbackResourceIndices,
 	std::vector<ResourceTransition>& scratchTransitions) {
 	ZoneScopedN("RenderGraph::ProcessResourceRequirements");
 	const bool enableReadOnlyUniformTransitionElision =
 		m_getReadOnlyUniformTransitionElisionEnabled && m_getReadOnlyUniformTransitionElisionEnabled();
+	const QueueKind passQueue = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(passQueueSlot));
+	const FrameMergedReadState* mergedReadStates = nullptr;
+	if (passIndex < m_frameMergedReadStatesByPass.size() && !m_frameMergedReadStatesByPass[passIndex].empty()) {
+		mergedReadStates = m_frameMergedReadStatesByPass[passIndex].data();
+	}
+
+	for (size_t requirementIndex = 0; requirementIndex < resourceRequirements.size(); ++requirementIndex) {
+		const auto& resourceRequirement = resourceRequirements[requirementIndex];
+		if (mergedReadStates && mergedReadStates[requirementIndex].valid) {
+			DenseRequirementSummary mergedRequirement = resourceRequirement;
+			mergedRequirement.state = mergedReadStates[requirementIndex].state;
+			if (TryMaskMergedReadStateForQueue(passQueue, resourceRequirement.state, mergedRequirement.state)) {
+				const bool alreadyTransitioned = outTransitionedResourceIndices.Contains(resourceRequirement.resourceIndex);
+				const bool alreadyFellBack = outFallbackResourceIndices.Contains(resourceRequirement.resourceIndex);
+				AddTransition(batchIndex, currentBatch, passQueueSlot, passName, mergedRequirement, outTransitionedResourceIndices, outFallbackResourceIndices, scratchTransitions);
+				// Without merging, a later read in a different state would have transitioned here.
+				// A merge that forced a graphics fallback saved nothing.
+				if (!alreadyTransitioned
+					&& !outTransitionedResourceIndices.Contains(resourceRequirement.resourceIndex)
+					&& (alreadyFellBack || !outFallbackResourceIndices.Contains(resourceRequirement.resourceIndex))) {
+					++m_transitionPlacementStats.readStateMergeSavedCount;
+				}
+				continue;
+			}
+		}
 
-	for (const auto& resourceRequirement : resourceRequirements) {
 		const bool isReadOnlyUniform =
 			enableReadOnlyUniformTransitionElision
 			&&
@@ -3208,7 +4539,7 @@ void RenderGraph::ProcessResourceRequirements(
 				resource,
 				resourceRequirement.resourceID);
 			if (!compileResourceState.readOnlyUniformTransitionChecked) {
-				AddTransition(batchIndex, currentBatch, passQueueSlot, passName, resourceRequirement, outTransitionedResourceIDs, outFallbackResourceIndices, scratchTransitions);
+				AddTransition(batchIndex, currentBatch, passQueueSlot, passName, resourceRequirement, outTransitionedResourceIndices, outFallbackResourceIndices, scratchTransitions);
 				compileResourceState.readOnlyUniformTransitionChecked = true;
 			}
 			else {
@@ -3216,7 +4547,7 @@ void RenderGraph::ProcessResourceRequirements(
 			}
 		}
 		else {
-			AddTransition(batchIndex, currentBatch, passQueueSlot, passName, resourceRequirement, outTransitionedResourceIDs, outFallbackResourceIndices, scratchTransitions);
+			AddTransition(batchIndex, currentBatch, passQueueSlot, passName, resourceRequirement, outTransitionedResourceIndices, outFallbackResourceIndices, scratchTransitions);
 		}
 
 		if (AccessTypeIsWriteType(resourceRequirement.state.access)) {
@@ -3289,6 +4620,8 @@ RenderGraph::RenderGraph(rhi::Device device) {
 				if (!ResolveFirstMipSlice(r, range, mip, slice)) return false;
 
 				out.shaderVisible = gir->GetUAVShaderVisibleInfo(mip, slice).slot;
+				// The stored heap handle predates any growth of the shader-visible heap.
+				out.shaderVisible.heap = DescriptorHeapManager::GetInstance().GetSRVDescriptorHeap().GetHandle();
 				out.cpuVisible = gir->GetUAVNonShaderVisibleInfo(mip, slice).slot;
 
 				out.resource = gir->GetAPIResource();
@@ -3315,24 +4648,52 @@ RenderGraph::RenderGraph(rhi::Device device) {
 	if (!m_renderGraphSettingsService) {
 		m_renderGraphSettingsService = rg::runtime::CreateDefaultRenderGraphSettingsService();
 	}
+	if (!m_taskService) {
+		m_taskService = m_renderGraphSettingsService->GetParallelTaskServiceEnabled()
+			? rg::runtime::CreateDefaultTaskService()
+			: rg::runtime::CreateSerialTaskService();
+	}
+	m_uploadService->SetTaskService(m_taskService);
+	m_queueRegistry.SetTaskService(m_taskService);
+	m_descriptorIndexTable = std::make_unique<ResourceDescriptorIndexTable>(_registry);
+	_registry.SetDescriptorIndexTable(m_descriptorIndexTable.get());
+	m_frameConstantAllocator = std::make_unique<FrameConstantAllocator>();
 }
 
 RenderGraph::~RenderGraph() {
+	if (!m_aliasPlanCachePath.empty()) {
+		SaveAliasPlanCache(m_aliasPlanCachePath);
+	}
 	if (m_pCommandRecordingManager) {
 		m_pCommandRecordingManager->ShutdownThreadLocal(); // Clears thread-local storage
 	}
 	ShutdownOwnedState();
 }
 
+bool RenderGraph::LoadAliasPlanCache(const std::filesystem::path& path) {
+	m_aliasPlanCachePath = path;
+	return m_aliasingSubsystem.LoadPersistedAliasPlans(*this, path);
+}
+
+bool RenderGraph::SaveAliasPlanCache(const std::filesystem::path& path) const {
+	return m_aliasingSubsystem.SavePersistedAliasPlans(*this, path);
+}
+
 void RenderGraph::ShutdownRuntime() {
+	// Waiters hold timelines, so they go before the device.
+	FenceWaiter::GetInstance().Cleanup();
 	StatisticsManager::GetInstance().ClearAll();
+	TextureRecyclePool::GetInstance().Clear();
 	DeletionManager::GetInstance().DrainAll();
 	DeletionManager::GetInstance().Cleanup();
 	DeviceManager::GetInstance().Cleanup();
 }
 
 void RenderGraph::ShutdownOwnedState() {
+	StopBackgroundMaterializationWorker();
 	batches.clear();
+	m_recycledPassBatches.clear();
+	m_frameNodes.clear();
 	initialTransitions.clear();
 	trackers.clear();
 	m_frameCompileResources.clear();
@@ -3343,6 +4704,10 @@ void RenderGraph::ShutdownOwnedState() {
 	m_framePassIsFrameExtension.clear();
 	m_framePassDeclarationRefreshedThisFrame.clear();
 	m_framePassAccessSummaryCache.clear();
+	m_incrementalDependencyGraphCache = {};
+	m_frameDependencyGraphCache = {};
+	m_adaptiveQueuePlacement = {};
+	m_lastCulledPassNames.clear();
 	m_assignedQueueSlotsByFramePass.clear();
 	m_activeQueueSlotsThisFrame.clear();
 	renderPassesByName.clear();
@@ -3354,6 +4719,8 @@ void RenderGraph::ShutdownOwnedState() {
 	m_transientFrameResourcesByName.clear();
 	resourceBackingGenerationByID.clear();
 	resourceIdleFrameCounts.clear();
+	m_residencyLastUsedFrameByID.clear();
+	m_evictedBackingGenerationByID.clear();
 	compiledResourceGenerationByID.clear();
 	aliasMaterializeOptionsByID.clear();
 	aliasPlacementSignatureByID.clear();
@@ -3393,7 +4760,16 @@ void RenderGraph::ShutdownOwnedState() {
 	_providerMap.clear();
 	_providers.clear();
 	_resolverMap.clear();
-	_registry = ResourceRegistry();
+	_registry.SetDescriptorIndexTable(nullptr);
+	m_descriptorIndexTable.reset();
+	m_frameConstantAllocator.reset();
+	if (m_aliasPoolArbiter) {
+		m_aliasPoolArbiter->ReleaseOwner(this);
+		m_aliasPoolArbiter.reset();
+	}
+	m_inFlightPresentDependencies.clear();
+	m_externalWaitedValueByTimelineByQueue.clear();
+	_registry.Clear();
 
 	m_pCommandRecordingManager.reset();
 	m_queueRegistry.Clear();
@@ -3515,6 +4891,8 @@ void RenderGraph::RebuildFrameCompileResources() {
 	ZoneScopedN("RenderGraph::RebuildFrameCompileResources");
 	m_frameCompileResources.clear();
 	m_frameCompileResources.resize(m_frameSchedulingResourceCount);
+	m_frameFirstUseByResourceIndex.assign(m_frameSchedulingResourceCount, FrameFirstUse{});
+	m_frameExternalReadyPoints.clear();
 
 	std::vector<uint64_t> preferredDynamicStableIDByIndex(m_frameSchedulingResourceCount, 0);
 	for (const auto& [stableID, resource] : m_dynamicResourcesByStableID) {
@@ -3557,10 +4935,116 @@ void RenderGraph::RebuildFrameCompileResources() {
 				&& HasLiveCompileResourceBacking(entry.resource)
 				&& StatesExactlyEqual(entry.fastState.state, accessSummary.uniformState);
 		}
+		if (auto* externalTexture = dynamic_cast<ExternalTextureResource*>(entry.resource);
+			externalTexture && externalTexture->HasReadyPoint()) {
+			m_frameExternalReadyPoints.emplace_back(resourceIndex, externalTexture->GetReadyPoint());
+		}
+	}
+	std::sort(m_frameExternalReadyPoints.begin(), m_frameExternalReadyPoints.end(), [](const auto& a, const auto& b) {
+		return a.first < b.first;
+	});
+}
+
+const ExternalTimelinePoint* RenderGraph::FindFrameExternalReadyPoint(size_t resourceIndex) const {
+	auto it = std::lower_bound(
+		m_frameExternalReadyPoints.begin(),
+		m_frameExternalReadyPoints.end(),
+		resourceIndex,
+		[](const auto& entry, size_t index) { return entry.first < index; });
+	if (it == m_frameExternalReadyPoints.end() || it->first != resourceIndex) {
+		return nullptr;
+	}
+	return &it->second;
+}
+
+void RenderGraph::PredictCrossFrameEndStates() {
+	ZoneScopedN("RenderGraph::PredictCrossFrameEndStates");
+	const bool enabled = m_getRenderGraphCrossFrameEndStatePredictionEnabled && m_getRenderGraphCrossFrameEndStatePredictionEnabled();
+	if (!enabled) {
+		m_previousFrameFirstUseStateByResourceID.clear();
+		return;
+	}
+
+	std::unordered_map<uint64_t, ResourceState> firstUseStateByResourceID;
+	firstUseStateByResourceID.reserve(m_frameFirstUseByResourceIndex.size());
+	std::vector<ResourceTransition> transitions;
+	const unsigned int batchCount = static_cast<unsigned int>(batches.size());
+	const size_t resourceCount = std::min(m_frameFirstUseByResourceIndex.size(), m_frameCompileResources.size());
+	for (size_t resourceIndex = 0; resourceIndex < resourceCount; ++resourceIndex) {
+		const auto& firstUse = m_frameFirstUseByResourceIndex[resourceIndex];
+		auto& compileResourceState = m_frameCompileResources[resourceIndex];
+		if (!firstUse.recorded || !firstUse.wholeResource || !compileResourceState.trackerInitialized) {
+			continue;
+		}
+		const uint64_t resourceID = compileResourceState.resourceID;
+		firstUseStateByResourceID.emplace(resourceID, firstUse.state);
+
+		// Only first uses that held for two frames in a row; a wrong guess costs a transition.
+		auto previous = m_previousFrameFirstUseStateByResourceID.find(resourceID);
+		if (previous == m_previousFrameFirstUseStateByResourceID.end() || !StatesExactlyEqual(previous->second, firstUse.state)) {
+			continue;
+		}
+
+		// Persistent resources only: aliased memory is reinitialized by its activation, and
+		// internal transitions or legacy/present states are owned by someone else.
+		Resource* resource = compileResourceState.resource;
+		if (!resource || !HasLiveCompileResourceBacking(resource) || aliasPlacementRangesByID.contains(resourceID)) {
+			continue;
+		}
+		if (resourceIndex < m_frameResourceAccessSummaries.size()) {
+			const auto& accessSummary = m_frameResourceAccessSummaries[resourceIndex];
+			if (accessSummary.hasAliasActivation || accessSummary.hasInternalTransition) {
+				continue;
+			}
+		}
+		ResourceState endState{};
+		if (!TryGetWholeResourceTrackerState(compileResourceState.tracker, endState) || StatesExactlyEqual(endState, firstUse.state)) {
+			continue;
+		}
+		if (endState.access == rhi::ResourceAccessType::Present
+			|| endState.access == rhi::ResourceAccessType::Common
+			|| firstUse.state.access == rhi::ResourceAccessType::Common) {
+			continue;
+		}
+
+		// Append to the resource's last use when a single queue had it, so the transition is
+		// ordered after that use without new waits.
+		const auto [lastUseBatch, lastUseQueueMask] = GetFrameResourceLastEventBeforeBatch(resourceIndex, batchCount);
+		if (lastUseBatch == 0 || lastUseQueueMask == 0 || (lastUseQueueMask & (lastUseQueueMask - 1)) != 0) {
+			continue;
+		}
+		size_t queueSlot = 0;
+		while ((lastUseQueueMask & (uint64_t{ 1 } << queueSlot)) == 0) {
+			++queueSlot;
+		}
+		const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueSlot));
+		const ResourceState predictedState = NormalizeStateForQueue(queueKind, firstUse.state);
+
+		SymbolicTracker predictedTracker = compileResourceState.tracker;
+		transitions.clear();
+		predictedTracker.Apply(firstUse.range, resource, predictedState, transitions);
+		if (transitions.empty()
+			|| !std::all_of(transitions.begin(), transitions.end(), [&](const ResourceTransition& transition) { return QueueSupportsTransition(queueKind, transition); })) {
+			continue;
+		}
+
+		PassBatch& lastUse = batches[lastUseBatch];
+		auto& afterPasses = lastUse.Transitions(queueSlot, BatchTransitionPhase::AfterPasses);
+		afterPasses.insert(afterPasses.end(), transitions.begin(), transitions.end());
+		lastUse.MarkQueueSignal(BatchSignalPhase::AfterCompletion, queueSlot);
+		RecordFrameQueueTransitionBatch(queueSlot, resourceIndex, lastUseBatch);
+
+		compileResourceState.tracker = std::move(predictedTracker);
+		compileResourceState.fastState.valid = TryGetWholeResourceTrackerState(compileResourceState.tracker, compileResourceState.fastState.state);
+		compileResourceState.fastState.wholeResourceOnly = compileResourceState.fastState.valid;
+		m_transitionPlacementStats.crossFrameEndStateCount += transitions.size();
+		m_transitionPlacementStats.emittedTransitionCount += transitions.size();
 	}
+	m_previousFrameFirstUseStateByResourceID = std::move(firstUseStateByResourceID);
+	TracyPlot("RG.CrossFrameEndStateTransitions", static_cast<int64_t>(m_transitionPlacementStats.crossFrameEndStateCount));
 }
 
-void RenderGraph::CaptureCompileTrackersForExecution(const std::unordered_set<uint64_t>& resourceIDs) {
+void RenderGraph::CaptureCompileTrackersForExecution(std::span<const uint64_t> resourceIDs) {
 	ZoneScopedN("RenderGraph::CaptureCompileTrackersForExecution");
 	trackers.clear();
 	trackers.reserve(resourceIDs.size());
@@ -3664,7 +5148,7 @@ void RenderGraph::ResetFrameQueueBatchHistoryTables() {
 	}
 }
 
-void RenderGraph::RebuildFrameSchedulingResourceIndex(const std::unordered_set<uint64_t>& resourceIDs) {
+void RenderGraph::RebuildFrameSchedulingResourceIndex(std::span<const uint64_t> resourceIDs) {
 	ZoneScopedN("RenderGraph::RebuildFrameSchedulingResourceIndex");
 	m_frameSchedulingResourceIndexByID.clear();
 	m_frameSchedulingResourceIndexByID.reserve(resourceIDs.size() * 2);
@@ -3677,9 +5161,8 @@ void RenderGraph::RebuildFrameSchedulingResourceIndex(const std::unordered_set<u
 		}
 	};
 
-	std::vector<uint64_t> sortedResourceIDs(resourceIDs.begin(), resourceIDs.end());
-	std::sort(sortedResourceIDs.begin(), sortedResourceIDs.end());
-	for (uint64_t resourceID : sortedResourceIDs) {
+	// resourceIDs is already sorted and unique, so index assignment stays deterministic.
+	for (uint64_t resourceID : resourceIDs) {
 		registerResourceID(resourceID);
 		auto equivalentIDs = GetSchedulingEquivalentIDsCached(resourceID);
 		std::vector<uint64_t> sortedEquivalentIDs(equivalentIDs.begin(), equivalentIDs.end());
@@ -3794,6 +5277,7 @@ void RenderGraph::RebuildFramePassSchedulingSummaries() {
 			denseRequirement.range = req.range;
 			denseRequirement.state = req.state;
 			denseRequirement.isUAV = req.isUAV;
+			denseRequirement.fullOverwrite = req.fullOverwrite;
 			if (*resourceIndex < m_equivalentResourceIndicesByResourceIndex.size()) {
 				denseRequirement.equivalentResourceIndices = &m_equivalentResourceIndicesByResourceIndex[*resourceIndex];
 			}
@@ -3922,6 +5406,106 @@ void RenderGraph::RebuildFrameResourceAccessSummaries(const std::vector<Node>& n
 			!accessSummary.hasMultipleRequiredStates &&
 			accessSummary.uniformStateInitialized;
 	}
+
+	RebuildFrameMergedReadStates();
+}
+
+void RenderGraph::RebuildFrameMergedReadStates() {
+	ZoneScopedN("RenderGraph::RebuildFrameMergedReadStates");
+	m_frameMergedReadStatesByPass.resize(m_framePassSchedulingSummaries.size());
+	for (auto& mergedStates : m_frameMergedReadStatesByPass) {
+		mergedStates.clear();
+	}
+	if (!m_getReadStateMergingEnabled || !m_getReadStateMergingEnabled()) {
+		return;
+	}
+
+	// Frame passes are in a valid execution order, and every read between two writes of a
+	// resource is ordered after the first write and before the second whatever batch it lands
+	// in, so the union of those reads' states is safe for all of them. ProcessResourceRequirements
+	// narrows the union to each consuming pass's queue.
+	struct ReadRun {
+		ResourceState state{};
+		bool distinctStates = false;
+		bool layoutsDiffer = false;
+	};
+	constexpr uint32_t kNoRun = UINT32_MAX;
+	std::vector<ReadRun> runs;
+	std::vector<uint32_t> openRunByResourceIndex(m_frameResourceAccessSummaries.size(), kNoRun);
+	std::vector<std::vector<uint32_t>> runByRequirement(m_framePassSchedulingSummaries.size());
+
+	auto isMergeableRead = [&](const DenseRequirementSummary& requirement) {
+		const auto access = requirement.state.access;
+		const auto& accessSummary = m_frameResourceAccessSummaries[requirement.resourceIndex];
+		return !requirement.isUAV
+			&& !AccessTypeIsWriteType(access)
+			&& access != rhi::ResourceAccessType::None
+			&& access != rhi::ResourceAccessType::Common // Legacy-barrier handoff, keep it exact
+			&& !accessSummary.readOnlyUniform
+			&& !accessSummary.hasInternalTransition
+			&& !accessSummary.hasAliasActivation
+			&& IsWholeResourceRange(requirement.range, requirement.resource);
+	};
+
+	for (size_t passIndex = 0; passIndex < m_framePassSchedulingSummaries.size(); ++passIndex) {
+		const auto& requirements = m_framePassSchedulingSummaries[passIndex].requirements;
+		auto& passRuns = runByRequirement[passIndex];
+		passRuns.assign(requirements.size(), kNoRun);
+		for (size_t requirementIndex = 0; requirementIndex < requirements.size(); ++requirementIndex) {
+			const auto& requirement = requirements[requirementIndex];
+			if (requirement.resourceIndex >= openRunByResourceIndex.size()) {
+				continue;
+			}
+			uint32_t& openRun = openRunByResourceIndex[requirement.resourceIndex];
+			if (!isMergeableRead(requirement)) {
+				openRun = kNoRun;
+				continue;
+			}
+			if (openRun == kNoRun) {
+				openRun = static_cast<uint32_t>(runs.size());
+				runs.push_back(ReadRun{ .state = requirement.state });
+			}
+			else {
+				ReadRun& run = runs[openRun];
+				if (!StatesExactlyEqual(run.state, requirement.state)) {
+					run.distinctStates = true;
+					run.layoutsDiffer = run.layoutsDiffer || run.state.layout != requirement.state.layout;
+					run.state.access = run.state.access | requirement.state.access;
+					run.state.sync = run.state.sync | requirement.state.sync;
+				}
+			}
+			passRuns[requirementIndex] = openRun;
+		}
+	}
+
+	// Buffers and same-layout reads keep their layout. Otherwise the common layout is the one that
+	// every queue can both sample and copy from; other read mixes (depth reads, ...) stay unmerged.
+	constexpr auto kCommonLayoutReads = rhi::ResourceAccessType::ShaderResource | rhi::ResourceAccessType::CopySource;
+	for (auto& run : runs) {
+		if (!run.distinctStates || !run.layoutsDiffer) {
+			continue;
+		}
+		if ((run.state.access | kCommonLayoutReads) != kCommonLayoutReads) {
+			run.distinctStates = false;
+			continue;
+		}
+		run.state.layout = rhi::ResourceLayout::Common;
+	}
+
+	for (size_t passIndex = 0; passIndex < runByRequirement.size(); ++passIndex) {
+		const auto& passRuns = runByRequirement[passIndex];
+		auto& mergedStates = m_frameMergedReadStatesByPass[passIndex];
+		for (size_t requirementIndex = 0; requirementIndex < passRuns.size(); ++requirementIndex) {
+			const uint32_t runIndex = passRuns[requirementIndex];
+			if (runIndex == kNoRun || !runs[runIndex].distinctStates) {
+				continue;
+			}
+			if (mergedStates.empty()) {
+				mergedStates.resize(passRuns.size());
+			}
+			mergedStates[requirementIndex] = FrameMergedReadState{ .valid = true, .state = runs[runIndex].state };
+		}
+	}
 }
 
 bool RenderGraph::ValidateSchedulingDecisionTrace(
@@ -4271,21 +5855,21 @@ std::vector<std::shared_ptr<Resource>> RenderGraph::CaptureRetainedAnonymousKeep
 	return keepAlive;
 }
 
-void RenderGraph::CollectFrameResourceIDs(std::unordered_set<uint64_t>& used) const {
+void RenderGraph::CollectFrameResourceIDs(std::vector<uint64_t>& used) const {
 	ZoneScopedN("RenderGraph::CollectFrameResourceIDs");
 	used.clear();
 	used.reserve(m_framePasses.size() * 4);
 
 	auto insertHandleResourceIDs = [&](const ResourceRegistry::RegistryHandle& handle) {
-		used.insert(handle.GetGlobalResourceID());
+		used.push_back(handle.GetGlobalResourceID());
 		Resource* resource = handle.IsEphemeral()
 			? handle.GetEphemeralPtr()
 			: const_cast<Resource*>(_registry.Resolve(handle));
 		if (auto* dynamicResource = dynamic_cast<DynamicResource*>(resource)) {
-			used.insert(dynamicResource->GetDynamicWrapperGlobalResourceID());
-			used.insert(dynamicResource->GetGlobalResourceID());
+			used.push_back(dynamicResource->GetDynamicWrapperGlobalResourceID());
+			used.push_back(dynamicResource->GetGlobalResourceID());
 			if (auto backing = dynamicResource->GetResource()) {
-				used.insert(backing->GetGlobalResourceID());
+				used.push_back(backing->GetGlobalResourceID());
 			}
 		}
 	};
@@ -4303,9 +5887,12 @@ void RenderGraph::CollectFrameResourceIDs(std::unordered_set<uint64_t>& used) co
 			}
 		}, pr.pass);
 	}
+
+	std::sort(used.begin(), used.end());
+	used.erase(std::unique(used.begin(), used.end()), used.end());
 }
 
-void RenderGraph::ApplyIdleDematerializationPolicy(const std::unordered_set<uint64_t>& usedResourceIDs) {
+void RenderGraph::ApplyIdleDematerializationPolicy(std::span<const uint64_t> usedResourceIDs) {
 	ZoneScopedN("RenderGraph::ApplyIdleDematerializationPolicy");
 	for (auto& [id, resource] : resourcesByID) {
 		if (!resource) {
@@ -4316,8 +5903,11 @@ void RenderGraph::ApplyIdleDematerializationPolicy(const std::unordered_set<uint
 		if (!texture || !texture->IsIdleDematerializationEnabled()) {
 			continue;
 		}
+		if (!m_backgroundMaterializationRequests.empty() && IsBackgroundMaterializationInFlight(id)) {
+			continue;
+		}
 
-		if (usedResourceIDs.find(id) != usedResourceIDs.end()) {
+		if (std::binary_search(usedResourceIDs.begin(), usedResourceIDs.end(), id)) {
 			resourceIdleFrameCounts[id] = 0;
 			continue;
 		}
@@ -4326,13 +5916,106 @@ void RenderGraph::ApplyIdleDematerializationPolicy(const std::unordered_set<uint
 		idleFrames++;
 
 		if (texture->IsMaterialized() && idleFrames >= texture->GetIdleDematerializationThreshold()) {
-			texture->Dematerialize();
+			// Alias-placed textures only hold pool memory, so keep the API object for a cheap rebind.
+			texture->ParkAliasedBacking();
 			resourceBackingGenerationByID[id] = texture->GetBackingGeneration();
 		}
 	}
 }
 
-void RenderGraph::SnapshotCompiledResourceGenerations(const std::unordered_set<uint64_t>& usedResourceIDs) {
+bool RenderGraph::IsUnderResidencyBudgetPressure() const {
+	if (!m_getResidencyEvictionEnabled || !m_getResidencyEvictionEnabled() || !m_statisticsService) {
+		return false;
+	}
+	const auto budget = m_statisticsService->GetMemoryBudgetStats();
+	if (!budget.valid || budget.budgetBytes == 0) {
+		return false;
+	}
+	const float pressureThreshold = m_getResidencyBudgetPressureThreshold
+		? m_getResidencyBudgetPressureThreshold()
+		: 0.9f;
+	return static_cast<double>(budget.usageBytes)
+		>= static_cast<double>(budget.budgetBytes) * static_cast<double>(pressureThreshold);
+}
+
+// Middle tier between keeping an idle resource and dematerializing it: under budget pressure,
+// committed resources the graph has not used for residencyEvictionIdleFrames frames are evicted,
+// and the frame that next uses one makes it resident again before it records anything. The idle
+// window is never shorter than the frames in flight, so nothing evicted is still in use on the GPU.
+// Resources touched outside declared pass requirements are not tracked and must not rely on this.
+void RenderGraph::ApplyResidencyPolicy(std::span<const uint64_t> usedResourceIDs) {
+	ZoneScopedN("RenderGraph::ApplyResidencyPolicy");
+	++m_residencyFrameIndex;
+	auto& deviceManager = DeviceManager::GetInstance();
+	const bool enabled = m_getResidencyEvictionEnabled && m_getResidencyEvictionEnabled();
+
+	std::vector<TrackedHandle*> makeResident;
+	for (auto it = m_evictedBackingGenerationByID.begin(); it != m_evictedBackingGenerationByID.end(); ) {
+		const uint64_t id = it->first;
+		auto itResource = resourcesByID.find(id);
+		auto* backedResource = itResource != resourcesByID.end() && itResource->second
+			? TryGetBackedResource(itResource->second.get())
+			: nullptr;
+		TrackedHandle* allocation = backedResource && backedResource->GetBackingGeneration() == it->second
+			? backedResource->GetCommittedAllocation()
+			: nullptr;
+		if (!allocation) {
+			it = m_evictedBackingGenerationByID.erase(it);
+			continue;
+		}
+		if (!enabled || std::binary_search(usedResourceIDs.begin(), usedResourceIDs.end(), id)) {
+			makeResident.push_back(allocation);
+			it = m_evictedBackingGenerationByID.erase(it);
+			continue;
+		}
+		++it;
+	}
+	if (!makeResident.empty() && !deviceManager.ChangeResidency(DeviceManager::ResidencyOperation::MakeResident, makeResident)) {
+		spdlog::error("RenderGraph::ApplyResidencyPolicy: failed to make {} evicted resources resident.", makeResident.size());
+	}
+
+	if (!enabled) {
+		m_residencyLastUsedFrameByID.clear();
+		return;
+	}
+
+	for (uint64_t id : usedResourceIDs) {
+		m_residencyLastUsedFrameByID[id] = m_residencyFrameIndex;
+	}
+	if (!IsUnderResidencyBudgetPressure()) {
+		TracyPlot("RG.Residency.EvictedResources", static_cast<int64_t>(m_evictedBackingGenerationByID.size()));
+		return;
+	}
+
+	const uint64_t idleFrameThreshold = m_getResidencyEvictionIdleFrames ? m_getResidencyEvictionIdleFrames() : 60u;
+	std::vector<TrackedHandle*> evict;
+	std::vector<std::pair<uint64_t, uint64_t>> evictedGenerations;
+	for (auto& [id, resource] : resourcesByID) {
+		if (!resource || m_evictedBackingGenerationByID.contains(id)) {
+			continue;
+		}
+		// A resource the policy has not seen yet starts its idle window now.
+		auto [itLastUsed, inserted] = m_residencyLastUsedFrameByID.try_emplace(id, m_residencyFrameIndex);
+		if (inserted || m_residencyFrameIndex - itLastUsed->second < idleFrameThreshold) {
+			continue;
+		}
+		auto* backedResource = TryGetBackedResource(resource.get());
+		TrackedHandle* allocation = backedResource ? backedResource->GetCommittedAllocation() : nullptr;
+		if (!allocation) {
+			continue;
+		}
+		evict.push_back(allocation);
+		evictedGenerations.emplace_back(id, backedResource->GetBackingGeneration());
+	}
+	if (!evict.empty() && deviceManager.ChangeResidency(DeviceManager::ResidencyOperation::Evict, evict)) {
+		for (const auto& [id, generation] : evictedGenerations) {
+			m_evictedBackingGenerationByID[id] = generation;
+		}
+	}
+	TracyPlot("RG.Residency.EvictedResources", static_cast<int64_t>(m_evictedBackingGenerationByID.size()));
+}
+
+void RenderGraph::SnapshotCompiledResourceGenerations(std::span<const uint64_t> usedResourceIDs) {
 	compiledResourceGenerationByID.clear();
 	compiledResourceGenerationByID.reserve(usedResourceIDs.size());
 
@@ -4429,6 +6112,7 @@ void RenderGraph::ResetForRebuild()
 	// Clear any existing compile state
 	m_masterPassList.clear();
 	m_retainedDeclarationRefreshCandidateMasterIndices.clear();
+	m_staticDeclarationStatsByPassName.clear();
 	m_framePasses.clear();
 	trackers.clear();
 	ResetCompileFrameState();
@@ -4442,6 +6126,8 @@ void RenderGraph::ResetForRebuild()
 	m_transientFrameResourcesByName.clear();
 	resourceBackingGenerationByID.clear();
 	resourceIdleFrameCounts.clear();
+	m_residencyLastUsedFrameByID.clear();
+	m_evictedBackingGenerationByID.clear();
 	m_aliasingSubsystem.ResetPersistentState(*this);
 	m_lastProducerByResourceAcrossFrames.clear();
 	m_lastAliasPlacementProducersByPoolAcrossFrames.clear();
@@ -4456,7 +6142,7 @@ void RenderGraph::ResetForRebuild()
 	_providerMap.clear();
 	_providers.clear();
 	_resolverMap.clear();
-	_registry = ResourceRegistry();
+	_registry.Clear();
 
 	// Notify extensions that the registry was replaced
 	for (auto& ext : m_extensions) {
@@ -4464,8 +6150,26 @@ void RenderGraph::ResetForRebuild()
 	}
 }
 
-void RenderGraph::ResetCompileFrameState() {
+RenderGraph::PassBatch RenderGraph::AcquirePassBatch(size_t queueCount) {
+	if (m_recycledPassBatches.empty()) {
+		return PassBatch(queueCount);
+	}
+	PassBatch batch = std::move(m_recycledPassBatches.back());
+	m_recycledPassBatches.pop_back();
+	batch.Reset(queueCount);
+	return batch;
+}
+
+void RenderGraph::RecyclePassBatches() {
+	m_recycledPassBatches.reserve(m_recycledPassBatches.size() + batches.size());
+	for (auto& batch : batches) {
+		m_recycledPassBatches.push_back(std::move(batch));
+	}
 	batches.clear();
+}
+
+void RenderGraph::ResetCompileFrameState() {
+	RecyclePassBatches();
 	compiledResourceGenerationByID.clear();
 	m_transientFrameResourcesByID.clear();
 	m_transientFrameResourcesByName.clear();
@@ -4502,42 +6206,115 @@ void RenderGraph::ResetStructuralBuildState() {
 	m_passBuilderOrder.clear();
 	m_passNamesSeenThisReset.clear();
 	m_framePassAccessSummaryCache.clear();
+	m_incrementalDependencyGraphCache = {};
+	m_frameDependencyGraphCache = {};
 	m_retainedDeclarationRefreshCandidateMasterIndices.clear();
+	m_structuralPassProvidersByExtensionId.clear();
+	m_structuralEdit = {};
 }
 
 void RenderGraph::ResetForFrame() {
 	ZoneScopedN("RenderGraph::ResetForFrame");
 	_registry.ReclaimExpiredAnonymous();
+	_registry.CollectRetiredBindings();
 	m_aliasingSubsystem.ResetPerFrameState(*this);
 	ResetCompileFrameState();
 }
 
-void RenderGraph::CompileStructural() {
-	// Register resource providers from pass builders
+const char* RenderGraph::CompileTimings::PhaseName(Phase phase) noexcept {
+	switch (phase) {
+	case Phase::Reset: return "reset";
+	case Phase::RefreshDeclarations: return "refreshDeclarations";
+	case Phase::ImmediateRecording: return "immediateRecording";
+	case Phase::FrameExtensions: return "frameExtensions";
+	case Phase::PassAccess: return "passAccess";
+	case Phase::DependencyGraph: return "dependencyGraph";
+	case Phase::Aliasing: return "aliasing";
+	case Phase::QueueAssignment: return "queueAssignment";
+	case Phase::Materialize: return "materialize";
+	case Phase::Replay: return "replay";
+	case Phase::Schedule: return "schedule";
+	case Phase::QueueSync: return "queueSync";
+	case Phase::Diagnostics: return "diagnostics";
+	case Phase::Count: break;
+	}
+	return "unknown";
+}
 
-	std::vector<unsigned int> empty;
-	// Go backwards to build skip list
-	for (int i = static_cast<int>(m_passBuilderOrder.size()) - 1; i >= 0; i--) {
-		auto ptr = m_passBuilderOrder[i];
-		auto prov = ptr->ResourceProvider();
-		if (!prov) {
-			empty.push_back(i); // This pass was not built
-			continue;
-		}
-		EnsureProviderRegistered(prov);
-	}
-	unsigned int i = 0;
-	for (auto ptr : m_passBuilderOrder) {
-		if (!empty.empty() && empty.back() == i) {
-			empty.pop_back();
-			continue;
-		}
-		ptr->Finalize();
-		i++;
-	}
+std::string RenderGraph::CompileTimings::ToJson() const {
+	std::ostringstream oss;
+	oss << std::fixed;
+	oss.precision(4);
+	oss << "{\"frame\":" << compileFrameCount
+		<< ",\"structuralMs\":" << structuralMs
+		<< ",\"compileFrameMs\":" << compileFrameMs
+		<< ",\"executeMs\":" << executeMs
+		<< ",\"phasesMs\":{";
+	for (size_t i = 0; i < phaseMs.size(); ++i) {
+		oss << (i ? "," : "") << '"' << PhaseName(static_cast<Phase>(i)) << "\":" << phaseMs[i];
+	}
+	oss << "},\"replayAttempted\":" << (replayAttempted ? "true" : "false")
+		<< ",\"replayUsed\":" << (replayUsed ? "true" : "false")
+		<< ",\"replaySegments\":" << replaySegments
+		<< ",\"replayPasses\":" << replayPasses
+		<< ",\"passes\":" << passCount
+		<< ",\"batches\":" << batchCount << '}';
+	return oss.str();
+}
 
-	batches.clear();
+std::string RenderGraph::CompileMetrics::ToJson() const {
+	std::ostringstream oss;
+	oss << "{\"timings\":" << timings.ToJson()
+		<< ",\"culledPasses\":" << culledPassCount
+		<< ",\"skippedPasses\":" << skippedPassCount
+		<< ",\"transitions\":" << transitionCount
+		<< ",\"queueWaits\":" << queueWaitCount
+		<< ",\"externalWaits\":" << externalWaitCount
+		<< ",\"queueSignals\":" << queueSignalCount
+		<< ",\"declarationRefreshRequested\":" << declarationRefreshRequested
+		<< ",\"declarationRefreshEquivalent\":" << declarationRefreshEquivalent
+		<< ",\"staticDeclarationHits\":" << staticDeclarationHits
+		<< ",\"staticDeclarationMisses\":" << staticDeclarationMisses
+		<< ",\"replayDynamicGapPasses\":" << replayDynamicGapPasses
+		<< ",\"replayCacheSegments\":" << replayCacheSegments
+		<< ",\"replayCacheEntries\":" << replayCacheEntries
+		<< ",\"replaySegmentLookupHits\":" << replaySegmentLookupHits
+		<< ",\"replaySegmentLookupMisses\":" << replaySegmentLookupMisses
+		<< ",\"replaySelectedSegments\":" << replaySelectedSegments
+		<< ",\"replaySkipped\":{\"ineligible\":" << replaySkippedIneligible
+		<< ",\"traceRange\":" << replaySkippedTraceRange
+		<< ",\"passHash\":" << replaySkippedPassHash
+		<< ",\"lookupMiss\":" << replaySkippedLookupMiss << '}'
+		<< ",\"regions\":{\"candidate\":" << candidateRegions
+		<< ",\"accepted\":" << acceptedRegions
+		<< ",\"rejected\":" << rejectedRegions
+		<< ",\"coveredPasses\":" << regionCoveredPasses
+		<< ",\"estimatedSavedAddTransitionCalls\":" << estimatedSavedAddTransitionCalls
+		<< ",\"estimatedSavedIsNewBatchNeededCalls\":" << estimatedSavedIsNewBatchNeededCalls << '}'
+		<< ",\"transitionPlacement\":{\"candidates\":" << transitionPlacementCandidates
+		<< ",\"canonicalBeforePass\":" << canonicalBeforePassTransitions
+		<< ",\"inlineEarly\":" << inlineEarlyPlacedTransitions
+		<< ",\"graphicsFallback\":" << graphicsFallbackTransitions
+		<< ",\"aliasActivation\":" << aliasActivationTransitions
+		<< ",\"splitBarriers\":" << splitBarriers
+		<< ",\"readStateMergeSaved\":" << readStateMergeSavedTransitions
+		<< ",\"crossFrameEndStates\":" << crossFrameEndStateTransitions
+		<< ",\"fullOverwriteDiscards\":" << fullOverwriteDiscardTransitions << '}'
+		<< ",\"aliasing\":{\"candidates\":" << aliasCandidates
+		<< ",\"autoAssigned\":" << aliasAutoAssigned
+		<< ",\"excluded\":" << aliasExcluded
+		<< ",\"pooledActualBytes\":" << aliasPooledActualBytes
+		<< ",\"pooledSavedBytes\":" << aliasPooledSavedBytes
+		<< ",\"planCacheHits\":" << aliasPlanCacheHits
+		<< ",\"planCacheMisses\":" << aliasPlanCacheMisses
+		<< ",\"persistedPlanCacheHits\":" << aliasPersistedPlanCacheHits << '}'
+		<< ",\"materializedResources\":" << materializedResources << '}';
+	return oss.str();
+}
 
+void RenderGraph::MergeStructuralPasses(std::vector<AnyPassAndResources> base, std::span<const size_t> extensionIndices) {
+	// Base passes keep their relative order; structural passes gathered from the listed
+	// extensions are merged around them by their insert points.
 	struct Pending {
 		AnyPassAndResources pr;
 
@@ -4581,11 +6358,6 @@ void RenderGraph::CompileStructural() {
 		uint32_t indeg = 0;
 	};
 
-	// Keep base passes
-	auto base = std::move(m_masterPassList);
-	m_masterPassList.clear();
-	m_structuralExplicitAfterByName.clear();
-
 	// Gather extension passes into ExtItem list
 	std::vector<ExtItem> extItems;
 	extItems.reserve(64);
@@ -4597,8 +6369,9 @@ void RenderGraph::CompileStructural() {
 		return "__rg_ext_" + std::to_string(n);
 		};
 
-	for (int ei = 0; ei < (int)m_extensions.size(); ++ei) {
-		auto& ext = m_extensions[ei];
+	for (size_t extensionIndex : extensionIndices) {
+		const int ei = static_cast<int>(extensionIndex);
+		auto& ext = m_extensions[extensionIndex];
 		if (!ext) continue;
 
 		std::vector<ExternalPassDesc> local;
@@ -4655,6 +6428,7 @@ void RenderGraph::CompileStructural() {
 			// Store prevKey for later chaining edges (we apply chaining even if explicit where)
 			// (We don't add edges here because we haven't built node indices yet.)
 			// We'll reconstruct chaining using extIndex/extLocalOrder + keepExtensionOrder below.
+			m_structuralPassProvidersByExtensionId[m_extensionRegistrationIds[extensionIndex]].push_back(StructuralPassProvider(it.pr));
 			extItems.push_back(std::move(it));
 			prevKey = extItems.back().key;
 		}
@@ -4745,15 +6519,20 @@ void RenderGraph::CompileStructural() {
 
 	// Apply external constraints + extension chaining
 	// Build per-extension ordering list (by extLocalOrder)
-	std::unordered_map<int, std::vector<std::pair<int, size_t>>> extOrder; // extIndex -> [(localOrder, nodeIdx)]
+	struct ExtOrderEntry {
+		int localOrder = 0;
+		size_t nodeIdx = 0;
+		size_t itemIdx = 0;
+	};
+	std::unordered_map<int, std::vector<ExtOrderEntry>> extOrder; // extIndex -> entries by localOrder
 	extOrder.reserve(m_extensions.size());
 
 	for (size_t i = 0; i < extItems.size(); ++i) {
-		extOrder[extItems[i].extIndex].push_back({ extItems[i].extLocalOrder, extIdx[i] });
+		extOrder[extItems[i].extIndex].push_back({ extItems[i].extLocalOrder, extIdx[i], i });
 	}
 
 	for (auto& [ei, v] : extOrder) {
-		std::sort(v.begin(), v.end(), [](auto& a, auto& b) { return a.first < b.first; });
+		std::sort(v.begin(), v.end(), [](auto& a, auto& b) { return a.localOrder < b.localOrder; });
 	}
 
 	// Now attach constraints and chain edges
@@ -4808,19 +6587,9 @@ void RenderGraph::CompileStructural() {
 	// Extension chaining edges: prev -> next (if keepExtensionOrder on the *next* pass)
 	for (auto& [ei, v] : extOrder) {
 		for (size_t j = 1; j < v.size(); ++j) {
-			// Find the extItems entry for this node to check keepExtensionOrder
-			// (We can check by key because keys are unique.)
-			const size_t prevNode = v[j - 1].second;
-			const size_t nextNode = v[j].second;
-
-			const std::string& nextKey = nodes[nextNode].key;
-
-			// locate corresponding ext item (small N; linear is fine)
-			bool keep = true;
-			for (auto& e : extItems) {
-				if (e.key == nextKey) { keep = e.where.keepExtensionOrder; break; }
+			if (extItems[v[j].itemIdx].where.keepExtensionOrder) {
+				addEdge(v[j - 1].nodeIdx, v[j].nodeIdx);
 			}
-			if (keep) addEdge(prevNode, nextNode);
 		}
 	}
 
@@ -4828,26 +6597,27 @@ void RenderGraph::CompileStructural() {
 	std::vector<uint32_t> indeg(nodes.size());
 	for (size_t n = 0; n < nodes.size(); ++n) indeg[n] = nodes[n].indeg;
 
-	std::vector<size_t> ready;
-	ready.reserve(nodes.size());
-	for (size_t n = 0; n < nodes.size(); ++n) if (indeg[n] == 0) ready.push_back(n);
-
-	auto better = [&](size_t a, size_t b) {
-		if (nodes[a].priority != nodes[b].priority) return nodes[a].priority < nodes[b].priority;
-		return nodes[a].order < nodes[b].order;
+	// Min-heap on (priority, order); orders are unique, so the result does not depend on the
+	// order nodes become ready in.
+	auto later = [&](size_t a, size_t b) {
+		if (nodes[a].priority != nodes[b].priority) return nodes[a].priority > nodes[b].priority;
+		return nodes[a].order > nodes[b].order;
 		};
+	std::vector<size_t> readyStorage;
+	readyStorage.reserve(nodes.size());
+	std::priority_queue<size_t, std::vector<size_t>, decltype(later)> ready(later, std::move(readyStorage));
+	for (size_t n = 0; n < nodes.size(); ++n) if (indeg[n] == 0) ready.push(n);
 
 	std::vector<size_t> topo;
 	topo.reserve(nodes.size());
 
 	while (!ready.empty()) {
-		auto it = std::min_element(ready.begin(), ready.end(), [&](size_t a, size_t b) { return better(a, b); });
-		size_t u = *it;
-		ready.erase(it);
+		size_t u = ready.top();
+		ready.pop();
 
 		topo.push_back(u);
 		for (size_t vtx : nodes[u].out) {
-			if (--indeg[vtx] == 0) ready.push_back(vtx);
+			if (--indeg[vtx] == 0) ready.push(vtx);
 		}
 	}
 
@@ -4866,25 +6636,569 @@ void RenderGraph::CompileStructural() {
 		}
 		m_masterPassList.push_back(std::move(nodes[u].pass));
 	}
-	RebuildRetainedDeclarationRefreshCandidates();
 }
 
+void RenderGraph::CompileStructural() {
+	const auto structuralStart = std::chrono::steady_clock::now();
+	// Register resource providers from pass builders
 
-static ResourceRegistry::RegistryHandle ResolveByIdThunk(void* user, ResourceIdentifier const& id, bool allowFailure) {
-	return static_cast<RenderGraph*>(user)->RequestResourceHandle(id, allowFailure);
-}
+	std::vector<unsigned int> empty;
+	// Go backwards to build skip list
+	for (int i = static_cast<int>(m_passBuilderOrder.size()) - 1; i >= 0; i--) {
+		auto ptr = m_passBuilderOrder[i];
+		auto prov = ptr->ResourceProvider();
+		if (!prov) {
+			empty.push_back(i); // This pass was not built
+			continue;
+		}
+		EnsureProviderRegistered(prov);
+	}
+	unsigned int i = 0;
+	for (auto ptr : m_passBuilderOrder) {
+		if (!empty.empty() && empty.back() == i) {
+			empty.pop_back();
+			continue;
+		}
+		ptr->Finalize();
+		i++;
+	}
 
-static ResourceRegistry::RegistryHandle ResolveByPtrThunk(void* user, Resource* ptr, bool allowFailure) {
-	return static_cast<RenderGraph*>(user)->RequestResourceHandle(ptr, allowFailure);
+	batches.clear();
+
+	// Keep base passes
+	auto base = std::move(m_masterPassList);
+	m_masterPassList.clear();
+	m_structuralExplicitAfterByName.clear();
+	m_structuralPassProvidersByExtensionId.clear();
+
+	std::vector<size_t> extensionIndices(m_extensions.size());
+	std::iota(extensionIndices.begin(), extensionIndices.end(), size_t(0));
+	MergeStructuralPasses(std::move(base), extensionIndices);
+	RebuildRetainedDeclarationRefreshCandidates();
+	m_lastCompileTimings.structuralMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - structuralStart).count();
+}
+
+
+IResourceProvider* RenderGraph::StructuralPassProvider(const AnyPassAndResources& pass) noexcept {
+	return std::visit([](auto const& p) -> IResourceProvider* {
+		using T = std::decay_t<decltype(p)>;
+		if constexpr (std::is_same_v<T, std::monostate>) {
+			return nullptr;
+		}
+		else {
+			return p.pass.get();
+		}
+	}, pass.pass);
+}
+
+void RenderGraph::ReleaseStructuralPassProvider(
+	IResourceProvider* provider,
+	std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher>& releasedKeys)
+{
+	if (!provider) {
+		return;
+	}
+	auto providerIt = std::find(_providers.begin(), _providers.end(), provider);
+	if (providerIt == _providers.end()) {
+		return;
+	}
+	_providers.erase(providerIt);
+	for (const auto& key : provider->GetSupportedKeys()) {
+		if (auto it = _providerMap.find(key); it != _providerMap.end() && it->second == provider) {
+			_providerMap.erase(it);
+			releasedKeys.insert(key);
+		}
+	}
+	for (const auto& key : provider->GetSupportedResolverKeys()) {
+		if (_resolverMap.erase(key) != 0) {
+			releasedKeys.insert(key);
+		}
+	}
+}
+
+size_t RenderGraph::DropReplaySegmentsContainingPasses(const std::unordered_set<uint64_t>& passNameHashes) {
+	if (passNameHashes.empty()) {
+		return 0;
+	}
+	auto containsPass = [&](const CachedReplaySegment& segment) {
+		for (const auto& batchTemplate : segment.batchTemplates) {
+			for (const auto& queuedPass : batchTemplate.queuedPasses) {
+				if (passNameHashes.contains(queuedPass.passNameHash)) {
+					return true;
+				}
+			}
+		}
+		return false;
+	};
+
+	size_t dropped = 0;
+	auto& segments = m_regionCache.replaySegments;
+	const size_t segmentCount = segments.size();
+	segments.erase(std::remove_if(segments.begin(), segments.end(), containsPass), segments.end());
+	dropped += segmentCount - segments.size();
+
+	auto& entries = m_regionCache.replaySegmentEntries;
+	for (auto& entry : entries) {
+		const size_t variantCount = entry.variants.size();
+		entry.variants.erase(
+			std::remove_if(entry.variants.begin(), entry.variants.end(), [&](const CachedReplaySegmentVariant& variant) {
+				return containsPass(variant.segment);
+			}),
+			entry.variants.end());
+		dropped += variantCount - entry.variants.size();
+	}
+	entries.erase(
+		std::remove_if(entries.begin(), entries.end(), [](const ReplaySegmentCacheEntry& entry) {
+			return entry.variants.empty();
+		}),
+		entries.end());
+	return dropped;
+}
+
+void RenderGraph::BeginStructuralEdit(std::string insertBefore) {
+	if (m_structuralEdit.active) {
+		throw std::runtime_error("BeginStructuralEdit called while a structural edit is already open");
+	}
+	m_structuralEdit = {};
+	m_structuralEdit.active = true;
+	m_structuralEdit.insertBefore = std::move(insertBefore);
+	m_structuralEdit.builderOrderSizeAtBegin = m_passBuilderOrder.size();
+	m_structuralEdit.extensionCountAtBegin = m_extensions.size();
+}
+
+void RenderGraph::ReplacePass(std::string const& name) {
+	if (!m_structuralEdit.active) {
+		throw std::runtime_error("ReplacePass requires an open structural edit");
+	}
+	auto builderIt = m_passBuildersByName.find(name);
+	const bool inGraph = std::any_of(m_masterPassList.begin(), m_masterPassList.end(), [&](const AnyPassAndResources& pass) {
+		return pass.name == name;
+	});
+	if (builderIt == m_passBuildersByName.end() || !inGraph) {
+		throw std::runtime_error("ReplacePass: no builder-declared pass named " + name);
+	}
+	if (!m_structuralEdit.replacedPassNames.insert(name).second) {
+		return;
+	}
+	m_structuralEdit.reloadedPassNames.erase(name);
+
+	// The next Build*Pass(name) constructs a fresh pass object and is re-appended to the order.
+	auto orderIt = std::find(m_passBuilderOrder.begin(), m_passBuilderOrder.end(), builderIt->second.get());
+	if (orderIt != m_passBuilderOrder.end()) {
+		if (static_cast<size_t>(orderIt - m_passBuilderOrder.begin()) < m_structuralEdit.builderOrderSizeAtBegin) {
+			--m_structuralEdit.builderOrderSizeAtBegin;
+		}
+		m_passBuilderOrder.erase(orderIt);
+	}
+	m_passNamesSeenThisReset.erase(name);
+	builderIt->second->Reset();
+}
+
+void RenderGraph::ReloadPass(std::string const& name) {
+	if (!m_structuralEdit.active) {
+		throw std::runtime_error("ReloadPass requires an open structural edit");
+	}
+	auto builderIt = m_passBuildersByName.find(name);
+	if (builderIt == m_passBuildersByName.end() || !builderIt->second->ResourceProvider()) {
+		throw std::runtime_error("ReloadPass: no builder-declared pass named " + name + " (use ReloadExtension for extension passes)");
+	}
+	if (m_structuralEdit.replacedPassNames.contains(name) || m_structuralEdit.removedPassNames.contains(name)) {
+		return;
+	}
+	m_structuralEdit.reloadedPassNames.insert(name);
+}
+
+void RenderGraph::RemovePass(std::string const& name) {
+	if (!m_structuralEdit.active) {
+		throw std::runtime_error("RemovePass requires an open structural edit");
+	}
+	const bool inGraph = std::any_of(m_masterPassList.begin(), m_masterPassList.end(), [&](const AnyPassAndResources& pass) {
+		return pass.name == name;
+	});
+	if (name.empty() || !inGraph) {
+		throw std::runtime_error("RemovePass: no pass named " + name);
+	}
+	m_structuralEdit.replacedPassNames.erase(name);
+	m_structuralEdit.reloadedPassNames.erase(name);
+	m_structuralEdit.removedPassNames.insert(name);
+
+	if (auto builderIt = m_passBuildersByName.find(name); builderIt != m_passBuildersByName.end()) {
+		auto orderIt = std::find(m_passBuilderOrder.begin(), m_passBuilderOrder.end(), builderIt->second.get());
+		if (orderIt != m_passBuilderOrder.end()) {
+			if (static_cast<size_t>(orderIt - m_passBuilderOrder.begin()) < m_structuralEdit.builderOrderSizeAtBegin) {
+				--m_structuralEdit.builderOrderSizeAtBegin;
+			}
+			m_passBuilderOrder.erase(orderIt);
+		}
+	}
+}
+
+void RenderGraph::ReloadExtension(std::string_view id) {
+	if (!m_structuralEdit.active) {
+		throw std::runtime_error("ReloadExtension requires an open structural edit");
+	}
+	const auto it = std::find(m_extensionRegistrationIds.begin(), m_extensionRegistrationIds.end(), id);
+	if (it == m_extensionRegistrationIds.end()) {
+		throw std::runtime_error("ReloadExtension: no extension registered as " + std::string(id));
+	}
+	if (!m_structuralEdit.removedExtensionIds.contains(*it)) {
+		m_structuralEdit.reloadedExtensionIds.insert(*it);
+	}
+}
+
+void RenderGraph::RemoveExtension(std::string_view id) {
+	if (!m_structuralEdit.active) {
+		throw std::runtime_error("RemoveExtension requires an open structural edit");
+	}
+	const auto it = std::find(m_extensionRegistrationIds.begin(), m_extensionRegistrationIds.end(), id);
+	if (it == m_extensionRegistrationIds.end()) {
+		throw std::runtime_error("RemoveExtension: no extension registered as " + std::string(id));
+	}
+	m_structuralEdit.reloadedExtensionIds.erase(*it);
+	m_structuralEdit.removedExtensionIds.insert(*it);
+}
+
+void RenderGraph::CommitStructuralEdit() {
+	ZoneScopedN("RenderGraph::CommitStructuralEdit");
+	if (!m_structuralEdit.active) {
+		throw std::runtime_error("CommitStructuralEdit without BeginStructuralEdit");
+	}
+	const auto commitStart = std::chrono::steady_clock::now();
+	StructuralEditState edit = std::move(m_structuralEdit);
+	m_structuralEdit = {};
+	StructuralEditStats stats;
+
+	std::unordered_set<std::string> touchedPassNames;
+	std::unordered_set<IResourceProvider*> droppedProviders;
+	std::unordered_set<ResourceIdentifier, ResourceIdentifier::Hasher> releasedKeys;
+
+	// Extensions that are removed or gathered again give up their structural passes.
+	auto dropExtensionPasses = [&](std::string const& extensionId) {
+		auto it = m_structuralPassProvidersByExtensionId.find(extensionId);
+		if (it == m_structuralPassProvidersByExtensionId.end()) {
+			return;
+		}
+		for (IResourceProvider* provider : it->second) {
+			droppedProviders.insert(provider);
+			ReleaseStructuralPassProvider(provider, releasedKeys);
+		}
+		m_structuralPassProvidersByExtensionId.erase(it);
+	};
+	for (auto const& extensionId : edit.removedExtensionIds) {
+		dropExtensionPasses(extensionId);
+	}
+	for (auto const& extensionId : edit.reloadedExtensionIds) {
+		dropExtensionPasses(extensionId);
+	}
+	for (auto& pass : m_masterPassList) {
+		if (pass.name.empty()) {
+			continue;
+		}
+		if (edit.removedPassNames.contains(pass.name) || edit.replacedPassNames.contains(pass.name)) {
+			ReleaseStructuralPassProvider(StructuralPassProvider(pass), releasedKeys);
+			if (edit.removedPassNames.contains(pass.name)) {
+				droppedProviders.insert(StructuralPassProvider(pass));
+			}
+		}
+	}
+
+	// Untouched passes that declared a key the edit took away declare again; extension passes do
+	// that by having their extension gather again, which may release further keys.
+	auto declaresReleasedKey = [&](const AnyPassAndResources& pass) {
+		return std::visit([&](auto const& p) {
+			using T = std::decay_t<decltype(p)>;
+			if constexpr (std::is_same_v<T, std::monostate>) {
+				return false;
+			}
+			else {
+				for (auto const& id : p.resources.identifierSet) {
+					if (releasedKeys.contains(id)) {
+						return true;
+					}
+				}
+				return false;
+			}
+		}, pass.pass);
+	};
+	auto extensionIdForProvider = [&](IResourceProvider* provider) -> const std::string* {
+		for (auto const& [extensionId, providers] : m_structuralPassProvidersByExtensionId) {
+			if (std::find(providers.begin(), providers.end(), provider) != providers.end()) {
+				return &extensionId;
+			}
+		}
+		return nullptr;
+	};
+	for (bool changed = !releasedKeys.empty(); changed; ) {
+		changed = false;
+		for (auto& pass : m_masterPassList) {
+			IResourceProvider* provider = StructuralPassProvider(pass);
+			if (!provider || droppedProviders.contains(provider)
+				|| edit.replacedPassNames.contains(pass.name) || edit.reloadedPassNames.contains(pass.name)
+				|| !declaresReleasedKey(pass)) {
+				continue;
+			}
+			if (auto builderIt = m_passBuildersByName.find(pass.name);
+				!pass.name.empty() && builderIt != m_passBuildersByName.end() && builderIt->second->ResourceProvider() == provider) {
+				edit.reloadedPassNames.insert(pass.name);
+				++stats.dependentPassesRedeclared;
+			}
+			else if (const std::string* extensionId = extensionIdForProvider(provider)) {
+				const std::string id = *extensionId;
+				edit.reloadedExtensionIds.insert(id);
+				dropExtensionPasses(id);
+				++stats.dependentPassesRedeclared;
+				changed = true;
+			}
+		}
+	}
+
+	// Carve out the edited entries; replaced and reloaded passes keep their slot.
+	std::vector<AnyPassAndResources> kept;
+	kept.reserve(m_masterPassList.size());
+	std::unordered_map<std::string, size_t> slotByName;
+	for (auto& pass : m_masterPassList) {
+		IResourceProvider* provider = StructuralPassProvider(pass);
+		if (droppedProviders.contains(provider)) {
+			if (!pass.name.empty()) {
+				touchedPassNames.insert(pass.name);
+			}
+			++stats.passesRemoved;
+			continue;
+		}
+		if (!pass.name.empty() && (edit.replacedPassNames.contains(pass.name) || edit.reloadedPassNames.contains(pass.name))) {
+			slotByName.emplace(pass.name, kept.size());
+			touchedPassNames.insert(pass.name);
+		}
+		kept.push_back(std::move(pass));
+	}
+	m_masterPassList = std::move(kept);
+	for (auto& [extensionId, providers] : m_structuralPassProvidersByExtensionId) {
+		(void)extensionId;
+		std::erase_if(providers, [&](IResourceProvider* provider) { return droppedProviders.contains(provider); });
+	}
+
+	// Finalize the builders the edit touched: passes built during the edit (new or replaced)
+	// followed by reloaded ones. Providers first, like CompileStructural, so declarations can see
+	// resources other edited passes provide.
+	std::vector<IPassBuilder*> editBuilders(
+		m_passBuilderOrder.begin() + static_cast<std::ptrdiff_t>(edit.builderOrderSizeAtBegin),
+		m_passBuilderOrder.end());
+	for (auto const& name : edit.reloadedPassNames) {
+		if (auto it = m_passBuildersByName.find(name); it != m_passBuildersByName.end()) {
+			editBuilders.push_back(it->second.get());
+		}
+	}
+	std::erase_if(editBuilders, [](IPassBuilder* builder) { return builder->ResourceProvider() == nullptr; });
+	for (IPassBuilder* builder : editBuilders) {
+		IResourceProvider* provider = builder->ResourceProvider();
+		EnsureProviderRegistered(provider);
+		// EnsureProviderRegistered keeps a registry binding that already exists, which for a
+		// released key still points at the old pass's resource.
+		for (auto const& key : provider->GetSupportedKeys()) {
+			if (releasedKeys.contains(key)) {
+				if (auto resource = provider->ProvideResource(key)) {
+					RegisterResource(key, resource, provider);
+				}
+			}
+		}
+	}
+	const size_t appendStart = m_masterPassList.size();
+	for (IPassBuilder* builder : editBuilders) {
+		builder->Finalize();
+	}
+
+	std::vector<AnyPassAndResources> inserted;
+	std::vector<size_t> declaredSlots;
+	for (size_t i = appendStart; i < m_masterPassList.size(); ++i) {
+		auto& pass = m_masterPassList[i];
+		touchedPassNames.insert(pass.name);
+		if (auto slotIt = slotByName.find(pass.name); slotIt != slotByName.end()) {
+			m_masterPassList[slotIt->second] = std::move(pass);
+			declaredSlots.push_back(slotIt->second);
+			slotByName.erase(slotIt);
+		}
+		else {
+			inserted.push_back(std::move(pass));
+		}
+	}
+	m_masterPassList.resize(appendStart);
+	stats.passesDeclared = declaredSlots.size() + inserted.size();
+
+	// Replaced passes that were not built again are removed.
+	if (!slotByName.empty()) {
+		std::vector<uint8_t> removeSlot(m_masterPassList.size(), 0);
+		for (auto const& [name, slot] : slotByName) {
+			removeSlot[slot] = 1;
+			edit.removedPassNames.insert(name);
+			++stats.passesRemoved;
+		}
+		std::vector<AnyPassAndResources> remaining;
+		remaining.reserve(m_masterPassList.size());
+		std::vector<size_t> remap(m_masterPassList.size(), SIZE_MAX);
+		for (size_t i = 0; i < m_masterPassList.size(); ++i) {
+			if (!removeSlot[i]) {
+				remap[i] = remaining.size();
+				remaining.push_back(std::move(m_masterPassList[i]));
+			}
+		}
+		m_masterPassList = std::move(remaining);
+		for (auto& slot : declaredSlots) {
+			slot = remap[slot];
+		}
+	}
+
+	std::vector<IResourceProvider*> setupProviders;
+	for (size_t slot : declaredSlots) {
+		setupProviders.push_back(StructuralPassProvider(m_masterPassList[slot]));
+	}
+	if (!inserted.empty()) {
+		size_t insertAt = m_masterPassList.size();
+		auto anchorIt = std::find_if(m_masterPassList.begin(), m_masterPassList.end(), [&](const AnyPassAndResources& pass) {
+			return !edit.insertBefore.empty() && pass.name == edit.insertBefore;
+		});
+		if (anchorIt != m_masterPassList.end()) {
+			insertAt = static_cast<size_t>(anchorIt - m_masterPassList.begin());
+		}
+		else {
+			// Where a full rebuild would put it: after the base passes, ahead of unanchored
+			// extension passes.
+			for (size_t i = m_masterPassList.size(); i > 0; --i) {
+				auto builderIt = m_passBuildersByName.find(m_masterPassList[i - 1].name);
+				if (builderIt != m_passBuildersByName.end()
+					&& builderIt->second->ResourceProvider() == StructuralPassProvider(m_masterPassList[i - 1])) {
+					insertAt = i;
+					break;
+				}
+			}
+		}
+		for (auto& pass : inserted) {
+			setupProviders.push_back(StructuralPassProvider(pass));
+		}
+		m_masterPassList.insert(
+			m_masterPassList.begin() + static_cast<std::ptrdiff_t>(insertAt),
+			std::make_move_iterator(inserted.begin()),
+			std::make_move_iterator(inserted.end()));
+	}
+
+	// Removed extensions leave; extensions registered during the edit are initialized like Setup()
+	// does, then they and the reloaded ones gather their structural passes into the current list.
+	for (size_t i = m_extensions.size(); i > 0; --i) {
+		if (edit.removedExtensionIds.contains(m_extensionRegistrationIds[i - 1])) {
+			m_extensions.erase(m_extensions.begin() + static_cast<std::ptrdiff_t>(i - 1));
+			m_extensionRegistrationIds.erase(m_extensionRegistrationIds.begin() + static_cast<std::ptrdiff_t>(i - 1));
+			if (i - 1 < edit.extensionCountAtBegin) {
+				--edit.extensionCountAtBegin;
+			}
+		}
+	}
+	std::vector<size_t> gatherExtensions;
+	for (size_t ei = 0; ei < m_extensions.size(); ++ei) {
+		if (ei < edit.extensionCountAtBegin && !edit.reloadedExtensionIds.contains(m_extensionRegistrationIds[ei])) {
+			continue;
+		}
+		if (!m_extensions[ei]) {
+			continue;
+		}
+		if (ei >= edit.extensionCountAtBegin) {
+			m_extensions[ei]->Initialize(*this);
+			ResizeQueueParallelVectors();
+		}
+		m_extensions[ei]->PrepareForBuild(*this);
+		gatherExtensions.push_back(ei);
+	}
+	if (!gatherExtensions.empty()) {
+		std::unordered_set<IResourceProvider*> beforeGather;
+		for (auto const& pass : m_masterPassList) {
+			beforeGather.insert(StructuralPassProvider(pass));
+		}
+		auto base = std::move(m_masterPassList);
+		m_masterPassList.clear();
+		MergeStructuralPasses(std::move(base), gatherExtensions);
+		for (auto const& pass : m_masterPassList) {
+			IResourceProvider* provider = StructuralPassProvider(pass);
+			if (beforeGather.contains(provider)) {
+				continue;
+			}
+			for (auto const& key : provider->GetSupportedKeys()) {
+				if (releasedKeys.contains(key)) {
+					if (auto resource = provider->ProvideResource(key)) {
+						RegisterResource(key, resource, provider);
+					}
+				}
+			}
+			if (!pass.name.empty()) {
+				touchedPassNames.insert(pass.name);
+			}
+			setupProviders.push_back(provider);
+			++stats.passesDeclared;
+		}
+		stats.extensionsGathered = gatherExtensions.size();
+	}
+
+	// Builders of removed passes go away; the builder order follows the merged pass order so a
+	// later CompileStructural sees the same base sequence.
+	for (auto const& name : edit.removedPassNames) {
+		if (auto it = m_passBuildersByName.find(name); it != m_passBuildersByName.end()) {
+			it->second->Reset();
+			m_passBuildersByName.erase(it);
+		}
+		m_passNamesSeenThisReset.erase(name);
+		renderPassesByName.erase(name);
+		computePassesByName.erase(name);
+	}
+	m_passBuilderOrder.clear();
+	for (auto const& pass : m_masterPassList) {
+		if (auto it = m_passBuildersByName.find(pass.name);
+			it != m_passBuildersByName.end() && it->second->ResourceProvider() == StructuralPassProvider(pass)) {
+			m_passBuilderOrder.push_back(it->second.get());
+		}
+	}
+	std::erase_if(m_structuralExplicitAfterByName, [&](auto const& edge) {
+		return edit.removedPassNames.contains(edge.first) || edit.removedPassNames.contains(edge.second);
+	});
+
+	MaterializeUnmaterializedResources();
+	for (auto& pass : m_masterPassList) {
+		if (std::find(setupProviders.begin(), setupProviders.end(), StructuralPassProvider(pass)) != setupProviders.end()) {
+			SetupMasterPass(pass);
+		}
+	}
+
+	// Cached state keyed by pass content (access summaries, retained declarations) stays valid for
+	// untouched passes. Replay segments containing a touched pass cannot match again, and the
+	// dependency graph caches describe the old pass sequence.
+	std::unordered_set<uint64_t> touchedPassHashes;
+	for (auto const& name : touchedPassNames) {
+		touchedPassHashes.insert(HashString64(name));
+		m_staticDeclarationStatsByPassName.erase(name);
+	}
+	stats.replaySegmentsDropped = DropReplaySegmentsContainingPasses(touchedPassHashes);
+	m_incrementalDependencyGraphCache = {};
+	m_frameDependencyGraphCache = {};
+	++m_regionCache.structuralGeneration;
+	RebuildRetainedDeclarationRefreshCandidates();
+
+	stats.commitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - commitStart).count();
+	m_lastCompileTimings.structuralMs = stats.commitMs;
+	m_lastStructuralEditStats = stats;
+	if (m_getRenderGraphBatchTraceEnabled && m_getRenderGraphBatchTraceEnabled()) {
+		spdlog::info(
+			"RG structural edit committed declared={} removed={} dependents={} extensions={} droppedReplaySegments={} ms={:.3f}",
+			stats.passesDeclared,
+			stats.passesRemoved,
+			stats.dependentPassesRedeclared,
+			stats.extensionsGathered,
+			stats.replaySegmentsDropped,
+			stats.commitMs);
+	}
+}
+
+static ResourceRegistry::RegistryHandle ResolveByIdThunk(void* user, ResourceIdentifier const& id, bool allowFailure) {
+	return static_cast<RenderGraph*>(user)->RequestResourceHandle(id, allowFailure);
 }
 
-static bool Overlap(SubresourceRange a, SubresourceRange b) {
-	auto aMipEnd = a.firstMip + a.mipCount;
-	auto bMipEnd = b.firstMip + b.mipCount;
-	auto aSlEnd = a.firstSlice + a.sliceCount;
-	auto bSlEnd = b.firstSlice + b.sliceCount;
-	return (a.firstMip < bMipEnd && b.firstMip < aMipEnd) &&
-		(a.firstSlice < bSlEnd && b.firstSlice < aSlEnd);
+static ResourceRegistry::RegistryHandle ResolveByPtrThunk(void* user, Resource* ptr, bool allowFailure) {
+	return static_cast<RenderGraph*>(user)->RequestResourceHandle(ptr, allowFailure);
 }
 
 static bool RequirementsConflict(
@@ -4901,19 +7215,18 @@ static bool RequirementsConflict(
 	}
 
 	for (auto const& ra : retained) {
-		auto res = ra.resourceHandleAndRange.resource;
-		uint64_t rid = res.GetGlobalResourceID();
+		uint64_t rid = ra.resourceHandleAndRange.resource.GetGlobalResourceID();
 		auto it = immediateByID.find(rid);
 		if (it == immediateByID.end()) continue;
 
-		auto a = ResolveRangeSpec(ra.resourceHandleAndRange.range, res.GetNumMipLevels(), res.GetArraySize());
+		const SubresourceRange& a = ra.resolvedRange;
 		if (a.isEmpty()) continue;
 
 		for (auto const* ib : it->second) {
-			auto b = ResolveRangeSpec(ib->resourceHandleAndRange.range, res.GetNumMipLevels(), res.GetArraySize());
+			const SubresourceRange& b = ib->resolvedRange;
 			if (b.isEmpty()) continue;
 
-			if (Overlap(a, b) && !(ra.state == ib->state)) {
+			if (Overlaps(a, b) && !(ra.state == ib->state)) {
 				return true;
 			}
 		}
@@ -4958,7 +7271,7 @@ bool RenderGraph::RefreshRetainedDeclarationsForFrame(RenderPassAndResources& p,
 	if (traceLifecycle) {
 		spdlog::info("RG frame {} refresh render pass '{}' declare complete requirements={} transitions={}", frameIndex, p.name, b.GatherResourceRequirements().size(), b.params.internalTransitions.size());
 	}
-	const auto& refreshedRequirements = b.GatherResourceRequirements();
+	auto refreshedRequirements = b.GatherResourceRequirements();
 	TracyPlot("ORG.RefreshRetained.Render.Requirements", static_cast<int64_t>(refreshedRequirements.size()));
 	TracyPlot("ORG.RefreshRetained.Render.InternalTransitions", static_cast<int64_t>(b.params.internalTransitions.size()));
 	TracyPlot("ORG.RefreshRetained.Render.DeclaredIds", static_cast<int64_t>(b.DeclaredResourceIds().size()));
@@ -4966,17 +7279,20 @@ bool RenderGraph::RefreshRetainedDeclarationsForFrame(RenderPassAndResources& p,
 	// Update the frame view used by scheduling
 	{
 		ZoneScopedN("RenderGraph::RefreshRetainedDeclarationsForFrame(Render)::StoreRequirements");
-		p.resources.staticResourceRequirements = refreshedRequirements;
+		p.resources.staticResourceRequirements = std::move(refreshedRequirements);
 		p.resources.mergedFrameRequirementsDirty = true;
 
 		// Internal transitions also affect scheduling
-		p.resources.internalTransitions = b.params.internalTransitions;
+		p.resources.internalTransitions = std::move(b.params.internalTransitions);
+		p.resources.fullOverwriteResources = std::move(b.params.fullOverwriteResources);
 
-		p.resources.identifierSet = b.DeclaredResourceIds();
-		p.resources.autoDescriptorShaderResources = b.params.autoDescriptorShaderResources;
-		p.resources.autoDescriptorConstantBuffers = b.params.autoDescriptorConstantBuffers;
-		p.resources.autoDescriptorUnorderedAccessViews = b.params.autoDescriptorUnorderedAccessViews;
-		p.resources.activeFeatureDomains = b.params.activeFeatureDomains;
+		p.resources.identifierSet = std::move(b._declaredIds);
+		p.resources.autoDescriptorShaderResources = std::move(b.params.autoDescriptorShaderResources);
+		p.resources.autoDescriptorConstantBuffers = std::move(b.params.autoDescriptorConstantBuffers);
+		p.resources.autoDescriptorUnorderedAccessViews = std::move(b.params.autoDescriptorUnorderedAccessViews);
+		p.resources.activeFeatureDomains = std::move(b.params.activeFeatureDomains);
+		p.resources.predication = b.params.predication;
+		p.resources.memberFeatureDomains = std::move(b.params.memberFeatureDomains);
 	}
 	if (traceLifecycle) {
 		spdlog::info("RG frame {} refresh render pass '{}' materialize referenced resources begin", frameIndex, p.name);
@@ -5055,21 +7371,24 @@ bool RenderGraph::RefreshRetainedDeclarationsForFrame(ComputePassAndResources& p
 	if (traceLifecycle) {
 		spdlog::info("RG frame {} refresh compute pass '{}' declare complete requirements={} transitions={}", frameIndex, p.name, b.GatherResourceRequirements().size(), b.params.internalTransitions.size());
 	}
-	const auto& refreshedRequirements = b.GatherResourceRequirements();
+	auto refreshedRequirements = b.GatherResourceRequirements();
 	TracyPlot("ORG.RefreshRetained.Compute.Requirements", static_cast<int64_t>(refreshedRequirements.size()));
 	TracyPlot("ORG.RefreshRetained.Compute.InternalTransitions", static_cast<int64_t>(b.params.internalTransitions.size()));
 	TracyPlot("ORG.RefreshRetained.Compute.DeclaredIds", static_cast<int64_t>(b.DeclaredResourceIds().size()));
 
 	{
 		ZoneScopedN("RenderGraph::RefreshRetainedDeclarationsForFrame(Compute)::StoreRequirements");
-		p.resources.staticResourceRequirements = refreshedRequirements;
+		p.resources.staticResourceRequirements = std::move(refreshedRequirements);
 		p.resources.mergedFrameRequirementsDirty = true;
-		p.resources.internalTransitions = b.params.internalTransitions;
-		p.resources.identifierSet = b.DeclaredResourceIds();
-		p.resources.autoDescriptorShaderResources = b.params.autoDescriptorShaderResources;
-		p.resources.autoDescriptorConstantBuffers = b.params.autoDescriptorConstantBuffers;
-		p.resources.autoDescriptorUnorderedAccessViews = b.params.autoDescriptorUnorderedAccessViews;
-		p.resources.activeFeatureDomains = b.params.activeFeatureDomains;
+		p.resources.internalTransitions = std::move(b.params.internalTransitions);
+		p.resources.fullOverwriteResources = std::move(b.params.fullOverwriteResources);
+		p.resources.identifierSet = std::move(b._declaredIds);
+		p.resources.autoDescriptorShaderResources = std::move(b.params.autoDescriptorShaderResources);
+		p.resources.autoDescriptorConstantBuffers = std::move(b.params.autoDescriptorConstantBuffers);
+		p.resources.autoDescriptorUnorderedAccessViews = std::move(b.params.autoDescriptorUnorderedAccessViews);
+		p.resources.activeFeatureDomains = std::move(b.params.activeFeatureDomains);
+		p.resources.predication = b.params.predication;
+		p.resources.memberFeatureDomains = std::move(b.params.memberFeatureDomains);
 	}
 	if (traceLifecycle) {
 		spdlog::info("RG frame {} refresh compute pass '{}' materialize referenced resources begin", frameIndex, p.name);
@@ -5148,17 +7467,18 @@ bool RenderGraph::RefreshRetainedDeclarationsForFrame(CopyPassAndResources& p, u
 	if (traceLifecycle) {
 		spdlog::info("RG frame {} refresh copy pass '{}' declare complete requirements={} transitions={}", frameIndex, p.name, b.GatherResourceRequirements().size(), b.params.internalTransitions.size());
 	}
-	const auto& refreshedRequirements = b.GatherResourceRequirements();
+	auto refreshedRequirements = b.GatherResourceRequirements();
 	TracyPlot("ORG.RefreshRetained.Copy.Requirements", static_cast<int64_t>(refreshedRequirements.size()));
 	TracyPlot("ORG.RefreshRetained.Copy.InternalTransitions", static_cast<int64_t>(b.params.internalTransitions.size()));
 	TracyPlot("ORG.RefreshRetained.Copy.DeclaredIds", static_cast<int64_t>(b.DeclaredResourceIds().size()));
 
 	{
 		ZoneScopedN("RenderGraph::RefreshRetainedDeclarationsForFrame(Copy)::StoreRequirements");
-		p.resources.staticResourceRequirements = refreshedRequirements;
+		p.resources.staticResourceRequirements = std::move(refreshedRequirements);
 		p.resources.mergedFrameRequirementsDirty = true;
-		p.resources.internalTransitions = b.params.internalTransitions;
-		p.resources.identifierSet = b.DeclaredResourceIds();
+		p.resources.internalTransitions = std::move(b.params.internalTransitions);
+		p.resources.fullOverwriteResources = std::move(b.params.fullOverwriteResources);
+		p.resources.identifierSet = std::move(b._declaredIds);
 	}
 	if (traceLifecycle) {
 		spdlog::info("RG frame {} refresh copy pass '{}' materialize referenced resources begin", frameIndex, p.name);
@@ -5204,7 +7524,7 @@ bool RenderGraph::RefreshRetainedDeclarationsForFrame(CopyPassAndResources& p, u
 std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 	const ComputePassAndResources& pass,
 	size_t sourceQueueSlot,
-	std::unordered_set<uint64_t> const& resourcesTransitionedThisPass)
+	DenseResourceIndexSet const& resourcesTransitionedThisPass)
 {
 	ZoneScopedN("RenderGraph::GetBatchesToWaitOn(Compute)");
 	if (!pass.name.empty()) {
@@ -5228,13 +7548,12 @@ std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 		processResource(req.resourceHandleAndRange.resource);
 	});
 
-	for (auto& transitionID : resourcesTransitionedThisPass) { // We only need to wait on the latest usage for resources that will be transitioned in this batch
-		for (auto rid : GetSchedulingEquivalentIDsCached(transitionID)) {
-			auto resourceIndex = TryGetFrameSchedulingResourceIndex(rid);
-			if (!resourceIndex.has_value()) {
-				continue;
+	for (size_t transitionIndex : resourcesTransitionedThisPass) { // We only need to wait on the latest usage for resources that will be transitioned in this batch
+		latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, transitionIndex));
+		if (transitionIndex < m_equivalentResourceIndicesByResourceIndex.size()) {
+			for (size_t resourceIndex : m_equivalentResourceIndicesByResourceIndex[transitionIndex]) {
+				latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, resourceIndex));
 			}
-			latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, *resourceIndex));
 		}
 	}
 
@@ -5244,7 +7563,7 @@ std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 	const RenderPassAndResources& pass,
 	size_t sourceQueueSlot,
-	std::unordered_set<uint64_t> const& resourcesTransitionedThisPass)
+	DenseResourceIndexSet const& resourcesTransitionedThisPass)
 {
 	ZoneScopedN("RenderGraph::GetBatchesToWaitOn(Render)");
 	if (!pass.name.empty()) {
@@ -5268,13 +7587,12 @@ std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 		processResource(req.resourceHandleAndRange.resource);
 	});
 
-	for (auto& transitionID : resourcesTransitionedThisPass) { // We only need to wait on the latest usage for resources that will be transitioned in this batch
-		for (auto rid : GetSchedulingEquivalentIDsCached(transitionID)) {
-			auto resourceIndex = TryGetFrameSchedulingResourceIndex(rid);
-			if (!resourceIndex.has_value()) {
-				continue;
+	for (size_t transitionIndex : resourcesTransitionedThisPass) { // We only need to wait on the latest usage for resources that will be transitioned in this batch
+		latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, transitionIndex));
+		if (transitionIndex < m_equivalentResourceIndicesByResourceIndex.size()) {
+			for (size_t resourceIndex : m_equivalentResourceIndicesByResourceIndex[transitionIndex]) {
+				latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, resourceIndex));
 			}
-			latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, *resourceIndex));
 		}
 	}
 
@@ -5284,7 +7602,7 @@ std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 	const CopyPassAndResources& pass,
 	size_t sourceQueueSlot,
-	std::unordered_set<uint64_t> const& resourcesTransitionedThisPass)
+	DenseResourceIndexSet const& resourcesTransitionedThisPass)
 {
 	ZoneScopedN("RenderGraph::GetBatchesToWaitOn(Copy)");
 	if (!pass.name.empty()) {
@@ -5308,24 +7626,23 @@ std::tuple<int, int, int> RenderGraph::GetBatchesToWaitOn(
 		processResource(req.resourceHandleAndRange.resource);
 	});
 
-	for (auto& transitionID : resourcesTransitionedThisPass) {
-		for (auto rid : GetSchedulingEquivalentIDsCached(transitionID)) {
-			auto resourceIndex = TryGetFrameSchedulingResourceIndex(rid);
-			if (!resourceIndex.has_value()) {
-				continue;
+	for (size_t transitionIndex : resourcesTransitionedThisPass) {
+		latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, transitionIndex));
+		if (transitionIndex < m_equivalentResourceIndicesByResourceIndex.size()) {
+			for (size_t resourceIndex : m_equivalentResourceIndicesByResourceIndex[transitionIndex]) {
+				latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, resourceIndex));
 			}
-			latestUsage = std::max(latestUsage, (int)GetFrameQueueHistoryValue(m_frameQueueLastUsageBatch, sourceQueueSlot, *resourceIndex));
 		}
 	}
 
 	return { latestTransition, latestProducer, latestUsage };
 }
 
-void RenderGraph::MaterializeUnmaterializedResources(const std::unordered_set<uint64_t>* onlyResourceIDs) {
+void RenderGraph::MaterializeUnmaterializedResources(const std::vector<uint64_t>* onlyResourceIDs) {
 	ZoneScopedN("RenderGraph::MaterializeUnmaterializedResources");
 	// Returns the backing generation if the resource was materialized (or already materialized), or nullopt if skipped.
 	auto materializeOne = [&](uint64_t id, Resource* resource) -> std::optional<uint64_t> {
-		if (onlyResourceIDs && onlyResourceIDs->find(id) == onlyResourceIDs->end()) {
+		if (onlyResourceIDs && !std::binary_search(onlyResourceIDs->begin(), onlyResourceIDs->end(), id)) {
 			return std::nullopt;
 		}
 		if (!resource) {
@@ -5335,6 +7652,10 @@ void RenderGraph::MaterializeUnmaterializedResources(const std::unordered_set<ui
 		if (!resource) {
 			return std::nullopt;
 		}
+		// Owned by the background worker until it finishes; passes using it were skipped or waited.
+		if (!m_backgroundMaterializationRequests.empty() && IsBackgroundMaterializationInFlight(resource->GetGlobalResourceID())) {
+			return std::nullopt;
+		}
 
 		auto texture = dynamic_cast<PixelBuffer*>(resource);
 		if (texture) {
@@ -5503,6 +7824,12 @@ void RenderGraph::MaterializeUnmaterializedResources(const std::unordered_set<ui
 	};
 	std::vector<GenerationResult> genResults(items.size());
 
+	// Views land in the shader-visible heap in one ordered batch instead of from every worker.
+	const bool deferDescriptorWrites = m_descriptorService
+		&& m_getDeferShaderVisibleDescriptorWrites && m_getDeferShaderVisibleDescriptorWrites();
+	if (deferDescriptorWrites) {
+		m_descriptorService->BeginDeferredDescriptorWrites();
+	}
 	ParallelForOptional("Materialize", items.size(), [&](size_t i) {
 		auto [id, resource] = items[i];
 		auto gen = materializeOne(id, resource);
@@ -5510,15 +7837,45 @@ void RenderGraph::MaterializeUnmaterializedResources(const std::unordered_set<ui
 			genResults[i] = { id, gen.value(), true };
 		}
 	}, true); // Disable or now, resource creation creates flecs entities in renderer
+	if (m_descriptorService && m_descriptorService->GetDeferredSubresourceViewTargetCount() > 0) {
+		EnsureDeclaredSubresourceViews();
+	}
+	if (deferDescriptorWrites) {
+		m_descriptorService->FlushDeferredDescriptorWrites();
+	}
 
 	// Merge generation results
 	for (auto& r : genResults) {
 		if (r.valid) {
-			resourceBackingGenerationByID[r.id] = r.generation;
+			auto [it, inserted] = resourceBackingGenerationByID.try_emplace(r.id, r.generation);
+			if (inserted || it->second != r.generation) {
+				it->second = r.generation;
+				++m_lastCompileMetrics.materializedResources;
+			}
 		}
 	}
 }
 
+void RenderGraph::EnsureDeclaredSubresourceViews() {
+	ZoneScopedN("RenderGraph::EnsureDeclaredSubresourceViews");
+	auto ensure = [&](const ResourceRequirement& req) {
+		const auto& handle = req.resourceHandleAndRange.resource;
+		Resource* resource = handle.IsEphemeral() ? handle.GetEphemeralPtr() : _registry.Resolve(handle);
+		resource = resource ? UnwrapDynamicResource(resource) : nullptr;
+		auto* target = dynamic_cast<GloballyIndexedResource*>(resource);
+		if (target && target->GetDeferredSubresourceViews()) {
+			m_descriptorService->EnsureSubresourceViews(*target, req.resolvedRange);
+		}
+	};
+	for (const auto& pr : m_framePasses) {
+		std::visit([&](const auto& p) {
+			if constexpr (requires { p.resources; }) {
+				ForEachFrameRequirement(p.resources, ensure);
+			}
+		}, pr.pass);
+	}
+}
+
 void RenderGraph::ResizeQueueParallelVectors() {
 	const size_t qc = m_queueRegistry.SlotCount();
 	m_compiledLastProducerBatchByResourceByQueue.resize(qc);
@@ -5549,7 +7906,12 @@ void RenderGraph::EnsureMinimumAutomaticSchedulingQueues() {
 
 	for (size_t kindIndex = 0; kindIndex < static_cast<size_t>(QueueKind::Count); ++kindIndex) {
 		const QueueKind kind = static_cast<QueueKind>(kindIndex);
-		const uint8_t minimumQueueCount = m_minAutomaticSchedulingQueuesByKind[kindIndex];
+		uint8_t minimumQueueCount = m_minAutomaticSchedulingQueuesByKind[kindIndex];
+		if (kind != QueueKind::Graphics && m_getQueueSchedulingAdaptiveQueueCountEnabled && m_getQueueSchedulingAdaptiveQueueCountEnabled()) {
+			// The adaptive queue count only enables and disables slots, so they must all exist up front.
+			const uint32_t maxQueues = m_getQueueSchedulingAdaptiveQueueCountMaxQueues ? m_getQueueSchedulingAdaptiveQueueCountMaxQueues() : 2u;
+			minimumQueueCount = (std::max)(minimumQueueCount, static_cast<uint8_t>(maxQueues));
+		}
 		uint8_t currentAutoQueueCount = autoAssignableCountForKind(kind);
 		while (currentAutoQueueCount < minimumQueueCount) {
 			std::string queueName = std::string(queueNamePrefix(kind)) + std::to_string(currentAutoQueueCount);
@@ -5581,6 +7943,7 @@ bool RenderGraph::RetainedDeclarationMayNeedRefresh(const AnyPassAndResources& p
 			else {
 				const auto& cache = passAndResources.declarationCache;
 				return cache.dynamicInterface != nullptr
+					|| cache.staticInterface != nullptr
 					|| !passAndResources.resolverSnapshots.empty()
 					|| cache.requiresStaleHandleValidation;
 			}
@@ -5671,6 +8034,9 @@ void RenderGraph::Setup() {
 	m_getReadOnlyUniformTransitionElisionEnabled = [this]() {
 		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetReadOnlyUniformTransitionElisionEnabled() : false;
 	};
+	m_getReadStateMergingEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetReadStateMergingEnabled() : false;
+	};
 
 	m_getAutoAliasMode = [this]() {
 		const auto mode = m_renderGraphSettingsService
@@ -5742,76 +8108,188 @@ void RenderGraph::Setup() {
 	m_getRenderGraphRegionShadowStrictBatchMatch = [this]() {
 		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRegionShadowStrictBatchMatch() : false;
 	};
+	m_getRenderGraphRegionValidationIntervalFrames = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRegionValidationIntervalFrames() : 1u;
+	};
+	m_getRenderGraphRegionValidationSegmentsPerFrame = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRegionValidationSegmentsPerFrame() : 0u;
+	};
+	m_getRenderGraphRegionAdaptiveBoundariesEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRegionAdaptiveBoundariesEnabled() : false;
+	};
+	m_getRenderGraphRegionVolatilityWindowFrames = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRegionVolatilityWindowFrames() : 32u;
+	};
+	m_getRenderGraphRegionVolatilityThreshold = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRegionVolatilityThreshold() : 0.2f;
+	};
 	m_getAutoAliasPoolRetireIdleFrames = [this]() {
 		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetAutoAliasPoolRetireIdleFrames() : 120u;
 	};
 	m_getAutoAliasPoolGrowthHeadroom = [this]() {
 		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetAutoAliasPoolGrowthHeadroom() : 1.5f;
 	};
+	m_getRenderGraphIncrementalDependencyGraphEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphIncrementalDependencyGraphEnabled() : false;
+	};
+	m_getRenderGraphParallelDependencyGraphEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphParallelDependencyGraphEnabled() : false;
+	};
+	m_getQueueSchedulingMeasuredCriticalPathEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingMeasuredCriticalPathEnabled() : false;
+	};
+	m_getQueueSchedulingCriticalPathWeight = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingCriticalPathWeight() : 4.0f;
+	};
+	m_getQueueSchedulingAdaptivePlacementEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingAdaptivePlacementEnabled() : false;
+	};
+	m_getQueueSchedulingAdaptivePlacementWindowFrames = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingAdaptivePlacementWindowFrames() : 16u;
+	};
+	m_getQueueSchedulingAdaptivePlacementHysteresis = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingAdaptivePlacementHysteresis() : 0.03f;
+	};
+	m_getQueueSchedulingAdaptiveQueueCountEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingAdaptiveQueueCountEnabled() : false;
+	};
+	m_getQueueSchedulingAdaptiveQueueCountMaxQueues = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingAdaptiveQueueCountMaxQueues() : 2u;
+	};
+	m_getQueueSchedulingAdaptiveQueueCountWaitCostUs = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetQueueSchedulingAdaptiveQueueCountWaitCostUs() : 15.0f;
+	};
+	m_getRenderGraphSplitBarriersEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphSplitBarriersEnabled() : false;
+	};
+	m_getRenderGraphGlobalBufferBarrierThreshold = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphGlobalBufferBarrierThreshold() : 0u;
+	};
+	m_getRenderGraphDeadPassCullingEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphDeadPassCullingEnabled() : false;
+	};
+	m_getRenderGraphRenderPassMergingEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphRenderPassMergingEnabled() : false;
+	};
+	m_getRenderGraphStreamingSubmissionEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphStreamingSubmissionEnabled() : false;
+	};
+	m_getRenderGraphTransitiveWaitReductionEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphTransitiveWaitReductionEnabled() : true;
+	};
+	m_getRenderGraphCrossFrameOverlapEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphCrossFrameOverlapEnabled() : false;
+	};
+	m_getRenderGraphCrossFrameEndStatePredictionEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphCrossFrameEndStatePredictionEnabled() : false;
+	};
+	m_getRenderGraphPresentLatencyModeEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphPresentLatencyModeEnabled() : false;
+	};
+	m_getRenderGraphPresentLatencyMaxQueuedFrames = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetRenderGraphPresentLatencyMaxQueuedFrames() : 1u;
+	};
+	m_getAutoAliasPoolBudgetAwareEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetAutoAliasPoolBudgetAwareEnabled() : false;
+	};
+	m_getAutoAliasPoolBudgetPressureThreshold = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetAutoAliasPoolBudgetPressureThreshold() : 0.9f;
+	};
+	m_getAutoAliasSubresourceLifetimesEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetAutoAliasSubresourceLifetimesEnabled() : false;
+	};
+	m_getDeferShaderVisibleDescriptorWrites = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetDeferShaderVisibleDescriptorWrites() : false;
+	};
+	m_getImmediateBytecodeOptimizationEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetImmediateBytecodeOptimizationEnabled() : true;
+	};
+	m_getImmediateParallelReplayMinOps = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetImmediateParallelReplayMinOps() : 0;
+	};
+	m_getImmediateParallelReplayMaxCommandLists = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetImmediateParallelReplayMaxCommandLists() : 4;
+	};
+	m_getResidencyEvictionEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetResidencyEvictionEnabled() : false;
+	};
+	m_getResidencyEvictionIdleFrames = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetResidencyEvictionIdleFrames() : 60u;
+	};
+	m_getResidencyBudgetPressureThreshold = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetResidencyBudgetPressureThreshold() : 0.9f;
+	};
+	m_getBackgroundMaterializationEnabled = [this]() {
+		return m_renderGraphSettingsService ? m_renderGraphSettingsService->GetBackgroundMaterializationEnabled() : false;
+	};
 	MaterializeUnmaterializedResources();
 	// Pass setup is intentionally serial. Many passes touch shared ECS/flecs world state
 	// and singleton managers during Setup(), and iterating flecs queries from our task
 	// worker threads can corrupt flecs iterator stack state.
 	ParallelForOptional("PassSetup", m_masterPassList.size(), [this](size_t i) {
-		const bool traceLifecycle = m_getRenderGraphBatchTraceEnabled && m_getRenderGraphBatchTraceEnabled();
-		auto& pass = m_masterPassList[i];
-		switch (pass.type) {
-		case PassType::Render: {
-			auto& renderPass = std::get<RenderPassAndResources>(pass.pass);
-			if (traceLifecycle) {
-				spdlog::info("RG setup render pass '{}' begin", renderPass.name);
-			}
-			renderPass.pass->SetResourceRegistryView(
-				std::make_unique<ResourceRegistryView>(_registry, renderPass.resources.identifierSet),
-				renderPass.resources.activeFeatureDomains,
-				renderPass.resources.autoDescriptorShaderResources,
-				renderPass.resources.autoDescriptorConstantBuffers,
-				renderPass.resources.autoDescriptorUnorderedAccessViews);
-			renderPass.pass->Setup();
-			if (traceLifecycle) {
-				spdlog::info("RG setup render pass '{}' complete", renderPass.name);
-			}
-			break;
-		}
-		case PassType::Compute: {
-			auto& computePass = std::get<ComputePassAndResources>(pass.pass);
-			if (traceLifecycle) {
-				spdlog::info("RG setup compute pass '{}' begin", computePass.name);
-			}
-			computePass.pass->SetResourceRegistryView(
-				std::make_unique<ResourceRegistryView>(_registry, computePass.resources.identifierSet),
-				computePass.resources.activeFeatureDomains,
-				computePass.resources.autoDescriptorShaderResources,
-				computePass.resources.autoDescriptorConstantBuffers,
-				computePass.resources.autoDescriptorUnorderedAccessViews);
-			computePass.pass->Setup();
-			if (traceLifecycle) {
-				spdlog::info("RG setup compute pass '{}' complete", computePass.name);
-			}
-			break;
-		}
-		case PassType::Copy: {
-			auto& copyPass = std::get<CopyPassAndResources>(pass.pass);
-			if (traceLifecycle) {
-				spdlog::info("RG setup copy pass '{}' begin", copyPass.name);
-			}
-			copyPass.pass->SetResourceRegistryView(std::make_unique<ResourceRegistryView>(_registry, copyPass.resources.identifierSet));
-			copyPass.pass->Setup();
-			if (traceLifecycle) {
-				spdlog::info("RG setup copy pass '{}' complete", copyPass.name);
-			}
-			break;
-		}
-		}
+		SetupMasterPass(m_masterPassList[i]);
 	}, true);
 }
 
+void RenderGraph::SetupMasterPass(AnyPassAndResources& pass) {
+	const bool traceLifecycle = m_getRenderGraphBatchTraceEnabled && m_getRenderGraphBatchTraceEnabled();
+	switch (pass.type) {
+	case PassType::Render: {
+		auto& renderPass = std::get<RenderPassAndResources>(pass.pass);
+		if (traceLifecycle) {
+			spdlog::info("RG setup render pass '{}' begin", renderPass.name);
+		}
+		renderPass.pass->SetResourceRegistryView(
+			std::make_unique<ResourceRegistryView>(_registry, renderPass.resources.identifierSet),
+			renderPass.resources.activeFeatureDomains,
+			renderPass.resources.autoDescriptorShaderResources,
+			renderPass.resources.autoDescriptorConstantBuffers,
+			renderPass.resources.autoDescriptorUnorderedAccessViews);
+		renderPass.pass->Setup();
+		if (traceLifecycle) {
+			spdlog::info("RG setup render pass '{}' complete", renderPass.name);
+		}
+		break;
+	}
+	case PassType::Compute: {
+		auto& computePass = std::get<ComputePassAndResources>(pass.pass);
+		if (traceLifecycle) {
+			spdlog::info("RG setup compute pass '{}' begin", computePass.name);
+		}
+		computePass.pass->SetResourceRegistryView(
+			std::make_unique<ResourceRegistryView>(_registry, computePass.resources.identifierSet),
+			computePass.resources.activeFeatureDomains,
+			computePass.resources.autoDescriptorShaderResources,
+			computePass.resources.autoDescriptorConstantBuffers,
+			computePass.resources.autoDescriptorUnorderedAccessViews);
+		computePass.pass->Setup();
+		if (traceLifecycle) {
+			spdlog::info("RG setup compute pass '{}' complete", computePass.name);
+		}
+		break;
+	}
+	case PassType::Copy: {
+		auto& copyPass = std::get<CopyPassAndResources>(pass.pass);
+		if (traceLifecycle) {
+			spdlog::info("RG setup copy pass '{}' begin", copyPass.name);
+		}
+		copyPass.pass->SetResourceRegistryView(std::make_unique<ResourceRegistryView>(_registry, copyPass.resources.identifierSet));
+		copyPass.pass->Setup();
+		if (traceLifecycle) {
+			spdlog::info("RG setup copy pass '{}' complete", copyPass.name);
+		}
+		break;
+	}
+	}
+}
+
 void RenderGraph::AddRenderPass(std::shared_ptr<RenderPass> pass, RenderPassParameters& resources, std::string name, std::vector<ResolverSnapshot> resolverSnapshots) {
 	RenderPassAndResources passAndResources;
 	passAndResources.pass = pass;
 	passAndResources.resources = resources;
 	passAndResources.name = name;
 	passAndResources.techniquePath = GetTechniquePathForPassName(name);
+	passAndResources.passId = AcquirePassId(name);
 	passAndResources.retainedAnonymousKeepAlive = CaptureRetainedAnonymousKeepAlive(
 		passAndResources.resources.staticResourceRequirements,
 		passAndResources.resources.internalTransitions);
@@ -5837,6 +8315,7 @@ void RenderGraph::AddComputePass(std::shared_ptr<ComputePass> pass, ComputePassP
 	passAndResources.resources = resources;
 	passAndResources.name = name;
 	passAndResources.techniquePath = GetTechniquePathForPassName(name);
+	passAndResources.passId = AcquirePassId(name);
 	passAndResources.retainedAnonymousKeepAlive = CaptureRetainedAnonymousKeepAlive(
 		passAndResources.resources.staticResourceRequirements,
 		passAndResources.resources.internalTransitions);
@@ -5862,6 +8341,7 @@ void RenderGraph::AddCopyPass(std::shared_ptr<CopyPass> pass, CopyPassParameters
 	passAndResources.resources = resources;
 	passAndResources.name = name;
 	passAndResources.techniquePath = GetTechniquePathForPassName(name);
+	passAndResources.passId = AcquirePassId(name);
 	passAndResources.retainedAnonymousKeepAlive = CaptureRetainedAnonymousKeepAlive(
 		passAndResources.resources.staticResourceRequirements,
 		passAndResources.resources.internalTransitions);
@@ -5904,6 +8384,17 @@ std::string RenderGraph::GetTechniquePathForPassName(std::string_view passName)
 	return it->second;
 }
 
+PassId RenderGraph::AcquirePassId(std::string_view passName) {
+	if (passName.empty()) {
+		return PassId{ m_nextPassId++ };
+	}
+	auto [it, inserted] = m_passIdsByName.try_emplace(std::string(passName), PassId{ m_nextPassId });
+	if (inserted) {
+		++m_nextPassId;
+	}
+	return it->second;
+}
+
 void RenderGraph::AddResource(std::shared_ptr<Resource> resource, bool transition) {
 	const uint64_t resourceID = resource->GetGlobalResourceID();
 	if (auto dynamicResource = std::dynamic_pointer_cast<DynamicResource>(resource)) {
@@ -6022,13 +8513,65 @@ std::shared_ptr<ComputePass> RenderGraph::GetComputePassByName(const std::string
 	}
 }
 
+void RenderGraph::WaitForPresentLatencyBudget() {
+	ZoneScopedN("RenderGraph::WaitForPresentLatencyBudget");
+	m_presentLatencyWaitedThisFrame = true;
+	m_lastPresentLatencyStats.lastThrottleWaitMs = 0.0;
+	if (!m_getRenderGraphPresentLatencyModeEnabled || !m_getRenderGraphPresentLatencyModeEnabled()) {
+		m_inFlightPresentDependencies.clear();
+		return;
+	}
+
+	const size_t maxQueuedFrames = (std::max)(1u, m_getRenderGraphPresentLatencyMaxQueuedFrames ? m_getRenderGraphPresentLatencyMaxQueuedFrames() : 1u);
+	const auto waitStart = std::chrono::steady_clock::now();
+	bool waited = false;
+	while (!m_inFlightPresentDependencies.empty()) {
+		const PresentDependency& oldest = m_inFlightPresentDependencies.front();
+		const size_t slot = static_cast<size_t>(static_cast<uint8_t>(oldest.queueSlot));
+		if (slot >= m_queueRegistry.SlotCount()) {
+			m_inFlightPresentDependencies.pop_front();
+			continue;
+		}
+		auto& fence = m_queueRegistry.GetFence(oldest.queueSlot);
+		const UINT64 completed = fence.GetCompletedValue();
+		// UINT64_MAX is a lost device; there is nothing left to wait for.
+		if (completed == UINT64_MAX || completed >= oldest.wait.value) {
+			m_inFlightPresentDependencies.pop_front();
+			continue;
+		}
+		if (m_inFlightPresentDependencies.size() <= maxQueuedFrames) {
+			break;
+		}
+		const rhi::Result result = fence.HostWait(oldest.wait.value);
+		if (rhi::Failed(result)) {
+			spdlog::warn("RenderGraph::WaitForPresentLatencyBudget: host wait for fence {} failed: {}", oldest.wait.value, rhi::ResultName(result));
+		}
+		waited = true;
+		m_inFlightPresentDependencies.pop_front();
+	}
+	if (waited) {
+		++m_lastPresentLatencyStats.throttledFrames;
+		m_lastPresentLatencyStats.lastThrottleWaitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - waitStart).count();
+	}
+	TracyPlot("RG.PresentLatency.ThrottleMs", m_lastPresentLatencyStats.lastThrottleWaitMs);
+}
+
 void RenderGraph::Update(const UpdateExecutionContext& context, rhi::Device device) {
 	ZoneScopedN("RenderGraph::Update");
+	FrameTraceScope frameTraceScope("Update");
 	const bool traceLifecycle = m_getRenderGraphBatchTraceEnabled && m_getRenderGraphBatchTraceEnabled();
+	if (!m_presentLatencyWaitedThisFrame) {
+		WaitForPresentLatencyBudget();
+	}
+	m_presentLatencyWaitedThisFrame = false;
 	{
 		ZoneScopedN("RenderGraph::Update::ResetForFrame");
 		ResetForFrame();
 	}
+	// Before pass updates, so transient uploads and Update-time allocations land in this frame.
+	if (m_frameConstantAllocator) {
+		m_frameConstantAllocator->BeginFrame();
+	}
 
 	// Poll readback completions early so that passes (e.g. CLod streaming)
 	// can react to GPU-produced data from the previous frame immediately,
@@ -6069,11 +8612,26 @@ void RenderGraph::Update(const UpdateExecutionContext& context, rhi::Device devi
 						obj.statisticsIndex = -1;
 					}
 					else if (m_statisticsService && obj.statisticsIndex < 0) {
+						if (!obj.passId) {
+							obj.passId = AcquirePassId(obj.name);
+						}
 						if constexpr (std::is_same_v<T, RenderPassAndResources>) {
-							obj.statisticsIndex = static_cast<int>(m_statisticsService->RegisterPass(obj.name, obj.resources.isGeometryPass, obj.techniquePath));
+							m_statisticsService->RegisterPass(obj.passId, obj.name, obj.resources.isGeometryPass, obj.techniquePath);
 						}
 						else {
-							obj.statisticsIndex = static_cast<int>(m_statisticsService->RegisterPass(obj.name, false, obj.techniquePath));
+							m_statisticsService->RegisterPass(obj.passId, obj.name, false, obj.techniquePath);
+						}
+						obj.statisticsIndex = static_cast<int>(obj.passId.index);
+					}
+
+					if constexpr (std::is_same_v<T, ComputePassAndResources>) {
+						if (m_statisticsService && obj.statisticsIndex >= 0) {
+							if (auto* timeSliced = dynamic_cast<TimeSlicedComputePass*>(obj.pass.get())) {
+								const auto& passStats = m_statisticsService->GetPassStats();
+								if (static_cast<size_t>(obj.statisticsIndex) < passStats.size()) {
+									timeSliced->ReportMeasuredGpuTime(passStats[obj.statisticsIndex].gpuTimeEma);
+								}
+							}
 						}
 					}
 
@@ -6092,12 +8650,94 @@ void RenderGraph::Update(const UpdateExecutionContext& context, rhi::Device devi
 		}
 	}
 
+	AllocateTransientUploads(context);
+
 	{
 		ZoneScopedN("RenderGraph::Update::CompileFrame");
 		CompileFrame(device, context.frameIndex, context.hostData);
 	}
 }
 
+void RenderGraph::AllocateTransientUploads(const UpdateExecutionContext& context) {
+	m_transientUploadsByPass.clear();
+	if (!m_frameConstantAllocator) {
+		return;
+	}
+	struct WriterJob {
+		const TransientUploadDecl* decl = nullptr;
+		FrameConstantAllocation allocation;
+	};
+	std::vector<WriterJob> jobs;
+	std::vector<std::pair<const void*, std::span<const TransientUploadDecl>>> passes;
+	for (auto& pr : m_masterPassList) {
+		std::visit([&](auto& obj) {
+			using T = std::decay_t<decltype(obj)>;
+			if constexpr (std::is_same_v<T, RenderPassAndResources> || std::is_same_v<T, ComputePassAndResources>) {
+				if (!obj.resources.transientUploads.empty()) {
+					passes.emplace_back(obj.pass.get(), obj.resources.transientUploads);
+				}
+			}
+		}, pr.pass);
+	}
+	if (passes.empty()) {
+		return;
+	}
+
+	ZoneScopedN("RenderGraph::Update::TransientUploads");
+	for (const auto& [pass, decls] : passes) {
+		auto& allocations = m_transientUploadsByPass[pass];
+		allocations.reserve(decls.size());
+		for (const auto& decl : decls) {
+			FrameConstantAllocation allocation = m_frameConstantAllocator->Allocate(decl.sizeBytes);
+			if (!allocation) {
+				spdlog::error("RenderGraph: transient upload '{}' ({} bytes) could not be allocated", decl.name, decl.sizeBytes);
+			}
+			else if (decl.writer) {
+				jobs.push_back(WriterJob{ &decl, allocation });
+			}
+			allocations.push_back(allocation);
+		}
+	}
+	// Writers only touch their own allocation, so they run in parallel.
+	ParallelForOptional("TransientUploadWriters", jobs.size(), [&](size_t i) {
+		const auto& job = jobs[i];
+		job.decl->writer(std::span<std::byte>(job.allocation.cpu, static_cast<size_t>(job.allocation.size)), context);
+	});
+}
+
+void RenderGraph::UpdateGraphs(
+	std::span<RenderGraph* const> graphs,
+	std::span<const UpdateExecutionContext> contexts,
+	rhi::Device device,
+	rg::runtime::ITaskService& taskService)
+{
+	ZoneScopedN("RenderGraph::UpdateGraphs");
+	if (graphs.size() != contexts.size()) {
+		throw std::runtime_error("RenderGraph::UpdateGraphs needs one update context per graph");
+	}
+	if (graphs.size() == 1) {
+		graphs[0]->Update(contexts[0], device);
+		return;
+	}
+	taskService.ParallelFor("RenderGraph::UpdateGraphs", graphs.size(), [&](size_t i) {
+		if (graphs[i]) {
+			graphs[i]->Update(contexts[i], device);
+		}
+	});
+}
+
+void RenderGraph::SetAliasPoolArbiter(std::shared_ptr<rg::alias::AliasPoolArbiter> arbiter) {
+	if (arbiter == m_aliasPoolArbiter) {
+		return;
+	}
+	if (m_aliasPoolArbiter) {
+		m_aliasPoolArbiter->ReleaseOwner(this);
+	}
+	// The planner sees the lease or local allocation change on the next compile and rebinds the
+	// pool's resources through the bumped pool generation.
+	m_aliasPoolArbiter = std::move(arbiter);
+}
+
 #define IFDEBUG(x) 
 
 namespace {
@@ -6114,11 +8754,57 @@ namespace {
 		return !outRange.isEmpty();
 	}
 
+	// Buffers have no layout, so a phase's buffer barriers can be folded into one global barrier
+	// with the union of their sync and access masks once there are at least `threshold` of them.
+	// That over-synchronizes unrelated memory but lets the driver resolve a single barrier instead
+	// of hundreds. Split halves and discards keep their per-resource barriers, as do barriers from
+	// or to no access, which cannot be merged with real access bits.
+	void CollapseBufferBarriers(rhi::helpers::OwnedBarrierBatch& batch, uint32_t threshold) {
+		if (threshold == 0 || batch.buffers.size() < threshold) {
+			return;
+		}
+		auto collapsible = [](const rhi::BufferBarrier& bb) {
+			constexpr auto kNoSync = rhi::ResourceSyncState::None;
+			return !bb.discard
+				&& bb.beforeSync != kNoSync
+				&& bb.afterSync != kNoSync
+				&& (bb.beforeSync & rhi::ResourceSyncState::SyncSplit) == kNoSync
+				&& (bb.afterSync & rhi::ResourceSyncState::SyncSplit) == kNoSync
+				&& bb.beforeAccess != rhi::ResourceAccessType::None
+				&& bb.afterAccess != rhi::ResourceAccessType::None;
+		};
+		const size_t collapsibleCount = static_cast<size_t>(std::count_if(batch.buffers.begin(), batch.buffers.end(), collapsible));
+		if (collapsibleCount < threshold) {
+			return;
+		}
+
+		rhi::GlobalBarrier global{};
+		global.beforeSync = rhi::ResourceSyncState::None;
+		global.afterSync = rhi::ResourceSyncState::None;
+		global.beforeAccess = rhi::ResourceAccessType::None;
+		global.afterAccess = rhi::ResourceAccessType::None;
+		bool first = true;
+		std::erase_if(batch.buffers, [&](const rhi::BufferBarrier& bb) {
+			if (!collapsible(bb)) {
+				return false;
+			}
+			global.beforeSync = first ? bb.beforeSync : (global.beforeSync | bb.beforeSync);
+			global.afterSync = first ? bb.afterSync : (global.afterSync | bb.afterSync);
+			global.beforeAccess = first ? bb.beforeAccess : (global.beforeAccess | bb.beforeAccess);
+			global.afterAccess = first ? bb.afterAccess : (global.afterAccess | bb.afterAccess);
+			first = false;
+			return true;
+		});
+		batch.globals.push_back(global);
+		TracyPlot("RG.CollapsedBufferBarriers", static_cast<int64_t>(collapsibleCount));
+	}
+
 	// ExecuteTransitions: applies state-tracker bookkeeping AND records
 	// barriers.  Used only in the non-parallel fallback path.
 	void ExecuteTransitions(std::vector<ResourceTransition>& transitions,
 		CommandRecordingManager* crm,
 		QueueKind queueKind,
+		uint32_t globalBufferBarrierThreshold,
 		rhi::CommandList& commandList) {
 		rhi::helpers::OwnedBarrierBatch batch;
 		for (auto& transition : transitions) {
@@ -6127,10 +8813,13 @@ namespace {
 				continue;
 			}
 
-			std::vector<ResourceTransition> dummy;
-			transition.pResource->GetStateTracker()->Apply(
-				transition.range, transition.pResource,
-				{ transition.newAccessType, transition.newLayout, transition.newSyncState }, dummy);
+			// A split barrier's resource is only in its new state once the end half has run.
+			if (transition.split != TransitionSplit::Begin) {
+				std::vector<ResourceTransition> dummy;
+				transition.pResource->GetStateTracker()->Apply(
+					transition.range, transition.pResource,
+					{ transition.newAccessType, transition.newLayout, transition.newSyncState }, dummy);
+			}
 			auto bg = transition.pResource->GetEnhancedBarrierGroup(
 				transition.range, transition.prevAccessType, transition.newAccessType,
 				transition.prevLayout, transition.newLayout,
@@ -6147,6 +8836,7 @@ namespace {
 				}
 			}
 		}
+		CollapseBufferBarriers(batch, globalBufferBarrierThreshold);
 		if (!batch.Empty()) {
 			commandList.Barriers(batch.View());
 		}
@@ -6154,6 +8844,7 @@ namespace {
 
 	// RecordTransitionBarriers: records barrier commands into a CL
 	void RecordTransitionBarriers(std::vector<ResourceTransition>& transitions,
+		uint32_t globalBufferBarrierThreshold,
 		rhi::CommandList& commandList) {
 		if (transitions.empty()) return;
 
@@ -6196,6 +8887,7 @@ namespace {
 			}
 		}
 
+		CollapseBufferBarriers(batch, globalBufferBarrierThreshold);
 		if (!batch.Empty()) {
 			commandList.Barriers(batch.View());
 		}
@@ -6533,12 +9225,47 @@ namespace {
 		throw std::runtime_error(oss.str());
 	}
 
+	// Hands the statistics service the cross-queue waits (latest fence per source slot, over all
+	// wait phases) and the completion signal of one batch entry, for its GPU timeline markers.
+	void ReportBatchQueueSync(
+		rg::runtime::IStatisticsService& statisticsService,
+		const RenderGraph::PassBatch& batch,
+		size_t queueSlot,
+		size_t batchIndex,
+		unsigned frameIndex)
+	{
+		std::array<rg::runtime::BatchQueueWait, rg::runtime::kStatisticsMaxQueueSlots> waits{};
+		size_t waitCount = 0;
+		for (size_t srcIndex = 0; srcIndex < batch.QueueCount() && waitCount < waits.size(); ++srcIndex) {
+			UINT64 value = 0;
+			for (auto phase : { RenderGraph::BatchWaitPhase::BeforeTransitions, RenderGraph::BatchWaitPhase::BeforeExecution, RenderGraph::BatchWaitPhase::BeforeAfterPasses }) {
+				if (batch.HasQueueWait(phase, queueSlot, srcIndex)) {
+					value = std::max(value, batch.GetQueueWaitFenceValue(phase, queueSlot, srcIndex));
+				}
+			}
+			if (value != 0) {
+				waits[waitCount++] = { static_cast<uint32_t>(srcIndex), value };
+			}
+		}
+		statisticsService.SetBatchQueueSync(
+			static_cast<unsigned>(batchIndex),
+			static_cast<unsigned>(queueSlot),
+			frameIndex,
+			std::span<const rg::runtime::BatchQueueWait>(waits.data(), waitCount),
+			batch.GetQueueSignalFenceValue(RenderGraph::BatchSignalPhase::AfterCompletion, queueSlot));
+	}
+
+	// waitedValueByTimeline is the highest value of each external timeline this queue has already
+	// waited for. Queue waits are ordered and timelines only move forward, so a wait at or below
+	// it is already satisfied for everything submitted later, in this frame or any after it.
 	void WaitExternalFencesBeforeTransitions(
 		rhi::Queue queue,
 		const RenderGraph::PassBatch& batch,
 		size_t queueSlot,
 		size_t batchIndex,
-		unsigned frameIndex)
+		unsigned frameIndex,
+		std::unordered_map<uint64_t, uint64_t>& waitedValueByTimeline,
+		RenderGraph::ExternalWaitStats& stats)
 	{
 		const auto& waits = batch.ExternalWaitsBeforeTransitions(queueSlot);
 		for (const auto& wait : waits) {
@@ -6551,6 +9278,18 @@ namespace {
 					wait.value);
 				throw std::runtime_error("RenderGraph external wait was invalid");
 			}
+			auto [waitedIt, firstWait] = waitedValueByTimeline.try_emplace(PackTimelineSignalKey(wait.timeline.GetHandle()), 0);
+			if (!firstWait && waitedIt->second >= wait.value) {
+				++stats.elidedCovered;
+				continue;
+			}
+			waitedIt->second = wait.value;
+			const uint64_t completed = wait.timeline.GetCompletedValue();
+			if (completed != UINT64_MAX && completed >= wait.value) {
+				++stats.elidedCompleted;
+				continue;
+			}
+			++stats.issued;
 			const rhi::Result waitResult = queue.Wait({ wait.timeline.GetHandle(), wait.value });
 			if (waitResult != rhi::Result::Ok) {
 				throw std::runtime_error(fmt::format(
@@ -6563,6 +9302,189 @@ namespace {
 		}
 	}
 
+	// Narrows a pass's compile-time merge group to the neighbours actually recorded this frame, so
+	// a neighbour that skips execution never leaves the other side suspended.
+	RenderPassMergeInfo ResolveRecordedRenderPassMerge(
+		const std::vector<RenderGraph::PassBatch::QueuedPass>& passes,
+		size_t passIndex)
+	{
+		auto* const* self = std::get_if<RenderGraph::RenderPassAndResources*>(&passes[passIndex]);
+		if (!self || (*self)->renderPassMerge.groupSize <= 1) {
+			return {};
+		}
+		auto recordedGroupMember = [&](size_t index) {
+			auto* const* other = std::get_if<RenderGraph::RenderPassAndResources*>(&passes[index]);
+			return other && (*other)->renderPassMerge.groupSize > 1 && (*other)->pass->IsInvalidated();
+		};
+		RenderPassMergeInfo info = (*self)->renderPassMerge;
+		info.continuesPrevious = info.indexInGroup > 0 && passIndex > 0 && recordedGroupMember(passIndex - 1);
+		info.continuesIntoNext = info.indexInGroup + 1 < info.groupSize && passIndex + 1 < passes.size() && recordedGroupMember(passIndex + 1);
+		return info;
+	}
+
+	struct ParallelImmediateReplayOptions {
+		rg::runtime::ITaskService* taskService = nullptr;
+		uint32_t minOpsPerCommandList = 0; // 0 disables the split
+		uint32_t maxCommandLists = 0;
+	};
+
+	// Replays a long immediate stream on several command lists recorded at once. The open list is
+	// ended and queued as a leading list of clIndex, each independent range of the stream gets a
+	// list of its own after it, and recording carries on in a fresh preallocatedCLs[clIndex]. The
+	// leading lists submit in order ahead of that list, in the same Submit.
+	bool TryReplayImmediateInParallel(
+		QueueBatchSchedule& sched,
+		uint8_t clIndex,
+		CommandListPool& pool,
+		std::span<const std::byte> bytecode,
+		const rg::imm::ImmediateDispatch& dispatch,
+		const ParallelImmediateReplayOptions& options,
+		const char* passName,
+		rhi::CommandList& commandList)
+	{
+		if (!options.taskService || options.minOpsPerCommandList == 0 || options.maxCommandLists < 2) {
+			return false;
+		}
+		ZoneScopedN("RenderGraph::ReplayImmediateInParallel");
+		const auto ranges = rg::imm::SplitIndependentRanges(bytecode, options.maxCommandLists, options.minOpsPerCommandList);
+		if (ranges.size() < 2) {
+			return false;
+		}
+
+		auto& leading = sched.leadingCLs[clIndex];
+		commandList.End();
+		leading.push_back(std::move(sched.preallocatedCLs[clIndex]));
+
+		const size_t firstPart = leading.size();
+		for (size_t i = 0; i < ranges.size(); ++i) {
+			leading.push_back(pool.Request(QueueBatchSchedule::kPassRecordingWeight));
+		}
+		options.taskService->ParallelFor("ReplayImmediateInParallel", ranges.size(), [&](size_t i) {
+			rhi::CommandList part = leading[firstPart + i].list.Get();
+			{
+				rhi::debug::Scope scope(part, rhi::colors::Mint, passName);
+				rg::imm::Replay(ranges[i], part, dispatch);
+			}
+			part.End();
+		});
+		TracyPlot("ORG.Immediate.ParallelReplayLists", static_cast<int64_t>(ranges.size()));
+
+		sched.preallocatedCLs[clIndex] = pool.Request(sched.clSizeHints[clIndex]);
+		commandList = sched.preallocatedCLs[clIndex].list.Get();
+		return true;
+	}
+
+	// Without a predication hook a predicated pass records like any other, keeping its parallel
+	// replay, since its commands would run unconditionally anyway.
+	template<class PassAndResources>
+	const PassPredication* GetPassPredication(const PassAndResources& pr) {
+		if constexpr (requires { pr.resources.predication; }) {
+			if (pr.resources.predication && !DeviceManager::HasPredicationHook()) {
+				static std::once_flag warnOnce;
+				std::call_once(warnOnce, [] {
+					spdlog::warn("RenderGraph: no predication hook is installed; predicated passes run unconditionally.");
+				});
+				return nullptr;
+			}
+			return pr.resources.predication ? &*pr.resources.predication : nullptr;
+		}
+		else {
+			return nullptr;
+		}
+	}
+
+	// Predication state belongs to one command list, so a predicated pass records on a single list
+	// and this returns false when its commands will run unconditionally.
+	bool BeginPassPredication(ResourceRegistry& registry, const PassPredication& predication, rhi::CommandList& commandList) {
+		Resource* buffer = predication.buffer.IsEphemeral() ? predication.buffer.GetEphemeralPtr() : registry.Resolve(predication.buffer);
+		if (!buffer) {
+			return false;
+		}
+		return DeviceManager::GetInstance().BeginPredication(commandList, buffer->GetAPIResource(), predication.offset, predication.op);
+	}
+
+	// IParallelPassRecorder for the retained pass being recorded on preallocatedCLs[clIndex]. Like
+	// a parallel immediate replay, a split ends the open list and queues it as a leading list,
+	// gives each part a list of its own after it, and carries on in a fresh preallocatedCLs[clIndex].
+	// The pass's debug scope is closed across the split and reopened on the new list. Statistics
+	// queries must begin and end on one list, so measured passes record their parts serially.
+	class ParallelPassRecorder final : public IParallelPassRecorder {
+	public:
+		ParallelPassRecorder(
+			QueueBatchSchedule& sched,
+			uint8_t clIndex,
+			CommandListPool& pool,
+			rg::runtime::ITaskService* taskService,
+			bool serialOnly,
+			rhi::CommandList& commandList,
+			std::optional<rhi::debug::Scope>& scope)
+			: m_sched(sched), m_clIndex(clIndex), m_pool(pool), m_taskService(taskService),
+			m_serialOnly(serialOnly), m_commandList(commandList), m_scope(scope) {}
+
+		void Record(
+			PassExecutionContext& context,
+			uint32_t partCount,
+			const std::function<void(PassExecutionContext& part, uint32_t partIndex)>& recordPart) override
+		{
+			if (m_serialOnly || !m_taskService || partCount < 2) {
+				for (uint32_t partIndex = 0; partIndex < partCount; ++partIndex) {
+					recordPart(context, partIndex);
+				}
+				return;
+			}
+			ZoneScopedN("RenderGraph::RecordPassInParallel");
+			const char* passName = context.currentPassName ? context.currentPassName : "<unnamed>";
+			m_scope.reset();
+			(void)rhi::debug::SetInstrumentationContext(m_commandList, nullptr, nullptr);
+			m_commandList.End();
+
+			auto& leading = m_sched.leadingCLs[m_clIndex];
+			leading.push_back(std::move(m_sched.preallocatedCLs[m_clIndex]));
+			const size_t firstPart = leading.size();
+			for (uint32_t partIndex = 0; partIndex < partCount; ++partIndex) {
+				leading.push_back(m_pool.Request(QueueBatchSchedule::kPassRecordingWeight));
+			}
+			m_taskService->ParallelFor("RecordPassInParallel", partCount, [&](size_t partIndex) {
+				PassExecutionContext part = context;
+				part.commandList = leading[firstPart + partIndex].list.Get();
+				part.parallelRecorder = nullptr;
+				{
+					rhi::debug::Scope scope(part.commandList, rhi::colors::Mint, passName);
+					(void)rhi::debug::SetInstrumentationContext(part.commandList, context.currentPassName, context.currentTechniquePath);
+					recordPart(part, static_cast<uint32_t>(partIndex));
+					(void)rhi::debug::SetInstrumentationContext(part.commandList, nullptr, nullptr);
+				}
+				part.commandList.End();
+			});
+			TracyPlot("ORG.Pass.ParallelRecordingLists", static_cast<int64_t>(partCount));
+
+			m_sched.preallocatedCLs[m_clIndex] = m_pool.Request(m_sched.clSizeHints[m_clIndex]);
+			m_commandList = m_sched.preallocatedCLs[m_clIndex].list.Get();
+			context.commandList = m_commandList;
+			m_scope.emplace(m_commandList, rhi::colors::Mint, passName);
+			(void)rhi::debug::SetInstrumentationContext(m_commandList, context.currentPassName, context.currentTechniquePath);
+		}
+
+	private:
+		QueueBatchSchedule& m_sched;
+		uint8_t m_clIndex;
+		CommandListPool& m_pool;
+		rg::runtime::ITaskService* m_taskService;
+		bool m_serialOnly;
+		rhi::CommandList& m_commandList;
+		std::optional<rhi::debug::Scope>& m_scope;
+	};
+
+	using TransientUploadsByPass = std::unordered_map<const void*, std::vector<FrameConstantAllocation>>;
+
+	std::span<const FrameConstantAllocation> FindTransientUploads(const TransientUploadsByPass& uploads, const void* pass) {
+		if (uploads.empty()) {
+			return {};
+		}
+		const auto it = uploads.find(pass);
+		return it == uploads.end() ? std::span<const FrameConstantAllocation>{} : std::span<const FrameConstantAllocation>(it->second);
+	}
+
 	struct ExecuteQueueBatchArgs {
 		QueueBatchSchedule& sched;
 		RenderGraph::PassBatch& batch;
@@ -6578,6 +9500,12 @@ namespace {
 		std::vector<PassReturn>& outExternalFences;
 		std::unordered_map<ExternalFenceSignalKey, ExternalFenceSignalOrigin, ExternalFenceSignalKeyHash>& queuedExternalFenceOrigins;
 		UINT64& lastSignaledOnTimeline;
+		std::unordered_map<uint64_t, uint64_t>& externalWaitedValueByTimeline;
+		RenderGraph::ExternalWaitStats& externalWaitStats;
+		const ParallelImmediateReplayOptions& immediateReplay;
+		ResourceRegistry& registry;     // resolves predication buffers
+		const TransientUploadsByPass& transientUploadsByPass;
+		uint32_t globalBufferBarrierThreshold; // 0 keeps per-buffer barriers
 		bool batchTraceEnabled;
 	};
 
@@ -6596,13 +9524,34 @@ namespace {
 
 		uint8_t clIndex = 0; // index into preallocatedCLs
 
+		// Submits the open CL behind the lists a parallel immediate replay queued ahead of it,
+		// then recycles those against the same fence value as the CL itself.
+		auto submitCurrent = [&](rhi::CommandList& current) {
+			auto& leading = sched.leadingCLs[clIndex];
+			std::vector<rhi::CommandList> lists;
+			lists.reserve(leading.size() + 1);
+			for (auto& pair : leading) {
+				lists.push_back(pair.list.Get());
+			}
+			lists.push_back(current);
+			rhiQueue.Submit({ lists.data(), static_cast<uint32_t>(lists.size()) }, {});
+		};
+		auto recycleLeading = [&](UINT64 fenceValue) {
+			for (auto& pair : sched.leadingCLs[clIndex]) {
+				pool.Recycle(std::move(pair), fenceValue);
+			}
+			sched.leadingCLs[clIndex].clear();
+		};
+
 		// Waits: BeforeTransitions
 		WaitExternalFencesBeforeTransitions(
 			rhiQueue,
 			batch,
 			qi,
 			args.batchIndex,
-			static_cast<unsigned>(args.context.frameIndex));
+			static_cast<unsigned>(args.context.frameIndex),
+			args.externalWaitedValueByTimeline,
+			args.externalWaitStats);
 		for (size_t srcIndex = 0; srcIndex < batch.QueueCount(); ++srcIndex) {
 			if (!batch.HasQueueWait(RenderGraph::BatchWaitPhase::BeforeTransitions, qi, srcIndex))
 				continue;
@@ -6614,9 +9563,13 @@ namespace {
 		// Open first CL and record pre-transitions
 		auto& cl0 = sched.preallocatedCLs[clIndex];
 		rhi::CommandList commandList = cl0.list.Get();
+		if (args.statisticsService) {
+			ReportBatchQueueSync(*args.statisticsService, batch, qi, args.batchIndex, args.context.frameIndex);
+			args.statisticsService->BeginBatchQuery(static_cast<unsigned>(args.batchIndex), static_cast<unsigned>(qi), args.context.frameIndex, rhiQueue, commandList);
+		}
 
 		auto& preTransitions = batch.Transitions(qi, RenderGraph::BatchTransitionPhase::BeforePasses);
-		ExecuteTransitions(preTransitions, /*crm=*/nullptr, queue, commandList);
+		ExecuteTransitions(preTransitions, /*crm=*/nullptr, queue, args.globalBufferBarrierThreshold, commandList);
 
 		// Waits: BeforeExecution
 		for (size_t srcIndex = 0; srcIndex < batch.QueueCount(); ++srcIndex) {
@@ -6632,7 +9585,7 @@ namespace {
 			UINT64 signalValue = fenceOffset + batch.GetQueueSignalFenceValue(
 				RenderGraph::BatchSignalPhase::AfterTransitions, qi);
 			commandList.End();
-			rhiQueue.Submit({ &commandList, 1 }, {});
+			submitCurrent(commandList);
 			SignalQueueFenceOrThrow(
 				rhiQueue,
 				args.fenceTimeline,
@@ -6669,15 +9622,27 @@ namespace {
 							args.batchIndex,
 							passName);
 					}
-				rhi::debug::Scope scope(commandList, rhi::colors::Mint, std::string(passName).c_str());
+				const bool hasStatistics = args.statisticsService && pr.statisticsIndex >= 0;
+				const PassPredication* predication = GetPassPredication(pr);
+				const bool singleList = hasStatistics || predication != nullptr;
+				const auto cpuStart = std::chrono::steady_clock::now();
+				// Statistics queries and predication must begin and end on one list, so those passes replay serially.
+				const bool replayedInParallel = (pr.run & PassRunMask::Immediate) != PassRunMask::None && !singleList
+					&& TryReplayImmediateInParallel(sched, clIndex, pool, pr.immediateBytecode, *args.context.immediateDispatch, args.immediateReplay, std::string(passName).c_str(), commandList);
+				if (replayedInParallel)
+					args.context.commandList = commandList;
+				std::optional<rhi::debug::Scope> scope;
+				scope.emplace(commandList, rhi::colors::Mint, std::string(passName).c_str());
 				args.context.currentPassName = passName.data();
 				args.context.currentTechniquePath = techniquePath;
+				args.context.transientUploads = FindTransientUploads(args.transientUploadsByPass, pr.pass.get());
 				(void)rhi::debug::SetInstrumentationContext(commandList, args.context.currentPassName, args.context.currentTechniquePath);
-				const bool hasStatistics = args.statisticsService && pr.statisticsIndex >= 0;
-				const auto cpuStart = std::chrono::steady_clock::now();
+				ParallelPassRecorder parallelRecorder(sched, clIndex, pool, args.immediateReplay.taskService, singleList, commandList, scope);
+				args.context.parallelRecorder = &parallelRecorder;
 				if (hasStatistics)
 					args.statisticsService->BeginQuery(pr.statisticsIndex, args.context.frameIndex, rhiQueue, commandList);
-				if ((pr.run & PassRunMask::Immediate) != PassRunMask::None)
+				const bool predicationActive = predication && BeginPassPredication(args.registry, *predication, commandList);
+				if ((pr.run & PassRunMask::Immediate) != PassRunMask::None && !replayedInParallel)
 					rg::imm::Replay(pr.immediateBytecode, commandList, *args.context.immediateDispatch);
 				pr.immediateKeepAlive.reset();
 				if ((pr.run & PassRunMask::Retained) != PassRunMask::None) {
@@ -6697,6 +9662,8 @@ namespace {
 						args.outExternalFences.push_back(passReturn);
 					}
 				}
+				if (predicationActive)
+					DeviceManager::GetInstance().EndPredication(commandList);
 				if (hasStatistics)
 					args.statisticsService->EndQuery(pr.statisticsIndex, args.context.frameIndex, rhiQueue, commandList);
 				if (hasStatistics) {
@@ -6707,6 +9674,8 @@ namespace {
 				(void)rhi::debug::SetInstrumentationContext(commandList, nullptr, nullptr);
 				args.context.currentPassName = nullptr;
 				args.context.currentTechniquePath = nullptr;
+				args.context.parallelRecorder = nullptr;
+				args.context.transientUploads = {};
 					if (args.batchTraceEnabled) {
 						spdlog::info(
 							"RenderGraph: frame {} queue {} slot {} batch {} end pass {}",
@@ -6721,6 +9690,8 @@ namespace {
 				(void)rhi::debug::SetInstrumentationContext(commandList, nullptr, nullptr);
 				args.context.currentPassName = nullptr;
 				args.context.currentTechniquePath = nullptr;
+				args.context.parallelRecorder = nullptr;
+				args.context.transientUploads = {};
 				std::ostringstream oss;
 				oss << "RenderGraph::ExecuteQueueBatch failed while executing pass '"
 					<< passName
@@ -6740,18 +9711,19 @@ namespace {
 			}
 		};
 
-		for (auto& passVariant : batch.Passes(qi)) {
-			std::visit([&](auto* passEntry) { executeOne(*passEntry); }, passVariant);
+		const auto& queuedPasses = batch.Passes(qi);
+		for (size_t passIndex = 0; passIndex < queuedPasses.size(); ++passIndex) {
+			args.context.renderPassMerge = ResolveRecordedRenderPassMerge(queuedPasses, passIndex);
+			std::visit([&](auto* passEntry) { executeOne(*passEntry); }, queuedPasses[passIndex]);
 		}
-		if (args.statisticsService)
-			args.statisticsService->ResolveQueries(args.context.frameIndex, rhiQueue, commandList);
+		args.context.renderPassMerge = {};
 
 		// Split after execution if needed
 		if (sched.splitAfterExecution) {
 			UINT64 signalValue = fenceOffset + batch.GetQueueSignalFenceValue(
 				RenderGraph::BatchSignalPhase::AfterExecution, qi);
 			commandList.End();
-			rhiQueue.Submit({ &commandList, 1 }, {});
+			submitCurrent(commandList);
 			SignalQueueFenceOrThrow(
 				rhiQueue,
 				args.fenceTimeline,
@@ -6762,6 +9734,7 @@ namespace {
 				"AfterExecution",
 				static_cast<unsigned>(args.context.frameIndex));
 			args.lastSignaledOnTimeline = std::max(args.lastSignaledOnTimeline, signalValue);
+			recycleLeading(signalValue);
 			pool.Recycle(std::move(sched.preallocatedCLs[clIndex]), signalValue);
 
 			++clIndex;
@@ -6781,13 +9754,17 @@ namespace {
 		// Record post-transitions
 		auto& postTransitions = batch.Transitions(qi, RenderGraph::BatchTransitionPhase::AfterPasses);
 		if (!postTransitions.empty())
-			ExecuteTransitions(postTransitions, /*crm=*/nullptr, queue, commandList);
+			ExecuteTransitions(postTransitions, /*crm=*/nullptr, queue, args.globalBufferBarrierThreshold, commandList);
+		if (args.statisticsService) {
+			args.statisticsService->EndBatchQuery(static_cast<unsigned>(args.batchIndex), static_cast<unsigned>(qi), args.context.frameIndex, rhiQueue, commandList);
+			args.statisticsService->ResolveQueries(args.context.frameIndex, rhiQueue, commandList);
+		}
 
 		// Final submit + recycle signal. Active queues always submit a final CL,
 		// so always use the batch's reserved AfterCompletion fence value.
 		{
 			commandList.End();
-			rhiQueue.Submit({ &commandList, 1 }, {});
+			submitCurrent(commandList);
 
 			UINT64 recycleFence = fenceOffset + batch.GetQueueSignalFenceValue(
 				RenderGraph::BatchSignalPhase::AfterCompletion, qi);
@@ -6810,6 +9787,7 @@ namespace {
 				"AfterCompletion",
 				static_cast<unsigned>(args.context.frameIndex));
 			args.lastSignaledOnTimeline = std::max(args.lastSignaledOnTimeline, recycleFence);
+			recycleLeading(recycleFence);
 			pool.Recycle(std::move(sched.preallocatedCLs[clIndex]), recycleFence);
 		}
 	}
@@ -6824,9 +9802,14 @@ namespace {
 		QueueKind queue;
 		size_t queueSlot;
 		rhi::Queue& rhiQueue;           // needed for statistics Begin/EndQuery
+		CommandListPool& pool;          // parallel immediate replay requests its lists here
 		PassExecutionContext context;    // COPY: each task gets its own
 		rg::runtime::IStatisticsService* statisticsService;
 		std::unordered_map<ExternalFenceSignalKey, ExternalFenceSignalOrigin, ExternalFenceSignalKeyHash>& queuedExternalFenceOrigins;
+		const ParallelImmediateReplayOptions& immediateReplay;
+		ResourceRegistry& registry;     // resolves predication buffers
+		const TransientUploadsByPass& transientUploadsByPass;
+		uint32_t globalBufferBarrierThreshold; // 0 keeps per-buffer barriers
 		bool batchTraceEnabled;
 	};
 
@@ -6853,10 +9836,14 @@ namespace {
 
 		uint8_t clIndex = 0;
 		rhi::CommandList commandList = sched.preallocatedCLs[clIndex].list.Get();
+		if (args.statisticsService) {
+			ReportBatchQueueSync(*args.statisticsService, batch, qi, args.batchIndex, args.context.frameIndex);
+			args.statisticsService->BeginBatchQuery(static_cast<unsigned>(args.batchIndex), static_cast<unsigned>(qi), args.context.frameIndex, args.rhiQueue, commandList, sched.queryRecordingContext);
+		}
 
 		// Record pre-transitions
 		auto& preTransitions = batch.Transitions(qi, RenderGraph::BatchTransitionPhase::BeforePasses);
-		RecordTransitionBarriers(preTransitions, commandList);
+		RecordTransitionBarriers(preTransitions, args.globalBufferBarrierThreshold, commandList);
 
 		// Split after transitions?
 		if (sched.splitAfterTransitions) {
@@ -6894,15 +9881,27 @@ namespace {
 						qi,
 						passName);
 				}
-				rhi::debug::Scope scope(commandList, rhi::colors::Mint, std::string(passName).c_str());
+				const bool hasStatistics = args.statisticsService && pr.statisticsIndex >= 0;
+				const PassPredication* predication = GetPassPredication(pr);
+				const bool singleList = hasStatistics || predication != nullptr;
+				const auto cpuStart = std::chrono::steady_clock::now();
+				// Statistics queries and predication must begin and end on one list, so those passes replay serially.
+				const bool replayedInParallel = (pr.run & PassRunMask::Immediate) != PassRunMask::None && !singleList
+					&& TryReplayImmediateInParallel(sched, clIndex, args.pool, pr.immediateBytecode, *args.context.immediateDispatch, args.immediateReplay, std::string(passName).c_str(), commandList);
+				if (replayedInParallel)
+					args.context.commandList = commandList;
+				std::optional<rhi::debug::Scope> scope;
+				scope.emplace(commandList, rhi::colors::Mint, std::string(passName).c_str());
 				args.context.currentPassName = passName.data();
 				args.context.currentTechniquePath = techniquePath;
+				args.context.transientUploads = FindTransientUploads(args.transientUploadsByPass, pr.pass.get());
 				(void)rhi::debug::SetInstrumentationContext(commandList, args.context.currentPassName, args.context.currentTechniquePath);
-				const bool hasStatistics = args.statisticsService && pr.statisticsIndex >= 0;
-				const auto cpuStart = std::chrono::steady_clock::now();
+				ParallelPassRecorder parallelRecorder(sched, clIndex, args.pool, args.immediateReplay.taskService, singleList, commandList, scope);
+				args.context.parallelRecorder = &parallelRecorder;
 				if (hasStatistics)
 					args.statisticsService->BeginQuery(pr.statisticsIndex, args.context.frameIndex, args.rhiQueue, commandList, sched.queryRecordingContext);
-				if ((pr.run & PassRunMask::Immediate) != PassRunMask::None)
+				const bool predicationActive = predication && BeginPassPredication(args.registry, *predication, commandList);
+				if ((pr.run & PassRunMask::Immediate) != PassRunMask::None && !replayedInParallel)
 					rg::imm::Replay(pr.immediateBytecode, commandList, *args.context.immediateDispatch);
 				pr.immediateKeepAlive.reset();
 				if ((pr.run & PassRunMask::Retained) != PassRunMask::None) {
@@ -6921,6 +9920,8 @@ namespace {
 						sched.externalFences.push_back(passReturn);
 					}
 				}
+				if (predicationActive)
+					DeviceManager::GetInstance().EndPredication(commandList);
 				if (hasStatistics)
 					args.statisticsService->EndQuery(pr.statisticsIndex, args.context.frameIndex, args.rhiQueue, commandList, sched.queryRecordingContext);
 				if (hasStatistics) {
@@ -6931,6 +9932,8 @@ namespace {
 				(void)rhi::debug::SetInstrumentationContext(commandList, nullptr, nullptr);
 				args.context.currentPassName = nullptr;
 				args.context.currentTechniquePath = nullptr;
+				args.context.parallelRecorder = nullptr;
+				args.context.transientUploads = {};
 				if (args.batchTraceEnabled) {
 					spdlog::info(
 						"RenderGraph: frame {} batch {} queue {} slot {} end pass {}",
@@ -6945,6 +9948,8 @@ namespace {
 				(void)rhi::debug::SetInstrumentationContext(commandList, nullptr, nullptr);
 				args.context.currentPassName = nullptr;
 				args.context.currentTechniquePath = nullptr;
+				args.context.parallelRecorder = nullptr;
+				args.context.transientUploads = {};
 				std::ostringstream oss;
 				oss << "RenderGraph::RecordQueueBatch failed while recording pass '"
 					<< passName
@@ -6964,11 +9969,12 @@ namespace {
 			}
 		};
 
-		for (auto& passVariant : batch.Passes(qi)) {
-			std::visit([&](auto* passEntry) { executeOne(*passEntry); }, passVariant);
+		const auto& queuedPasses = batch.Passes(qi);
+		for (size_t passIndex = 0; passIndex < queuedPasses.size(); ++passIndex) {
+			args.context.renderPassMerge = ResolveRecordedRenderPassMerge(queuedPasses, passIndex);
+			std::visit([&](auto* passEntry) { executeOne(*passEntry); }, queuedPasses[passIndex]);
 		}
-		if (args.statisticsService)
-			args.statisticsService->ResolveQueries(args.context.frameIndex, args.rhiQueue, commandList, sched.queryRecordingContext);
+		args.context.renderPassMerge = {};
 
 		// Split after execution?
 		if (sched.splitAfterExecution) {
@@ -6989,7 +9995,11 @@ namespace {
 		// Record post-transitions (barriers only).
 		auto& postTransitions = batch.Transitions(qi, RenderGraph::BatchTransitionPhase::AfterPasses);
 		if (!postTransitions.empty())
-			RecordTransitionBarriers(postTransitions, commandList);
+			RecordTransitionBarriers(postTransitions, args.globalBufferBarrierThreshold, commandList);
+		if (args.statisticsService) {
+			args.statisticsService->EndBatchQuery(static_cast<unsigned>(args.batchIndex), static_cast<unsigned>(qi), args.context.frameIndex, args.rhiQueue, commandList, sched.queryRecordingContext);
+			args.statisticsService->ResolveQueries(args.context.frameIndex, args.rhiQueue, commandList, sched.queryRecordingContext);
+		}
 
 		// End the last CL.
 		if (args.batchTraceEnabled) {
@@ -7432,22 +10442,64 @@ void RenderGraph::BuildExecutionSchedule() {
 			qs.numCLs = 1
 				+ static_cast<uint8_t>(qs.splitAfterTransitions)
 				+ static_cast<uint8_t>(qs.splitAfterExecution);
+
+			// CL layout: [pre-transitions | split] passes [split | post-transitions].
+			const uint64_t preSize = batch.Transitions(qi, BatchTransitionPhase::BeforePasses).size();
+			const uint64_t passSize = batch.Passes(qi).size() * QueueBatchSchedule::kPassRecordingWeight;
+			const uint64_t postSize = batch.Transitions(qi, BatchTransitionPhase::AfterPasses).size();
+			qs.clSizeHints = {};
+			uint8_t cl = 0;
+			qs.clSizeHints[cl] += preSize;
+			if (qs.splitAfterTransitions) {
+				++cl;
+			}
+			qs.clSizeHints[cl] += passSize;
+			if (qs.splitAfterExecution) {
+				++cl;
+			}
+			qs.clSizeHints[cl] += postSize;
 		}
 	}
 }
 
 void RenderGraph::Execute(PassExecutionContext& context) {
 	ZoneScopedN("RenderGraph::Execute");
+	FrameTraceScope frameTraceScope("Execute");
+	const auto executeStart = std::chrono::steady_clock::now();
 	m_lastPresentDependency.reset();
 	{
 		ZoneScopedN("RenderGraph::Execute::ValidateCompiledResourceGenerations");
 		ValidateCompiledResourceGenerations();
 	}
 	context.immediateDispatch = &m_immediateDispatch;
+	if (m_descriptorIndexTable) {
+		m_descriptorIndexTable->Update(context.frameIndex);
+	}
+	context.constantAllocator = m_frameConstantAllocator.get();
+	if (m_aliasPoolArbiter) {
+		// Another graph's last frame on the shared heaps may still be running on any of its queues.
+		ZoneScopedN("RenderGraph::Execute::WaitSharedAliasPools");
+		const auto fences = m_aliasPoolArbiter->BeginExecute(this);
+		for (const auto& fence : fences) {
+			const uint64_t completed = fence.timeline.GetCompletedValue();
+			if (completed != UINT64_MAX && completed >= fence.value) {
+				continue;
+			}
+			for (size_t qi = 0; qi < m_queueRegistry.SlotCount(); ++qi) {
+				if (!m_queueRegistry.IsOnPrimaryAdapter(static_cast<QueueSlotIndex>(qi))) {
+					continue; // Alias pools live on the primary adapter
+				}
+				const rhi::Result waitResult = SlotQueue(qi).Wait({ fence.timeline.GetHandle(), fence.value });
+				if (rhi::Failed(waitResult)) {
+					spdlog::error("RenderGraph: shared alias pool wait failed on queue slot {}: {}", qi, rhi::ResultName(waitResult));
+				}
+			}
+		}
+	}
 
 	const bool heavyDebug = m_getHeavyDebug ? m_getHeavyDebug() : false;
 	const bool batchTraceEnabled = m_getRenderGraphBatchTraceEnabled ? m_getRenderGraphBatchTraceEnabled() : false;
-	auto& manager = DeviceManager::GetInstance();
+	const uint32_t globalBufferBarrierThreshold = m_getRenderGraphGlobalBufferBarrierThreshold ? m_getRenderGraphGlobalBufferBarrierThreshold() : 0u;
 	const size_t slotCount = m_queueRegistry.SlotCount();
 	if (batchTraceEnabled) {
 		spdlog::info(
@@ -7458,20 +10510,19 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 			heavyDebug);
 	}
 
-	// Create CRM from the primary queue slots in the registry.
-	CommandRecordingManager::Init init{
-		.graphicsQ = &manager.GetGraphicsQueue(),
-		.graphicsF = &m_queueRegistry.GetFence(static_cast<QueueSlotIndex>(0)),
-		.graphicsPool = m_queueRegistry.GetPool(static_cast<QueueSlotIndex>(0)),
-
-		.computeQ = &manager.GetComputeQueue(),
-		.computeF = &m_queueRegistry.GetFence(static_cast<QueueSlotIndex>(1)),
-		.computePool = m_queueRegistry.GetPool(static_cast<QueueSlotIndex>(1)),
-
-		.copyQ = &manager.GetCopyQueue(),
-		.copyF = &m_queueRegistry.GetFence(static_cast<QueueSlotIndex>(2)),
-		.copyPool = m_queueRegistry.GetPool(static_cast<QueueSlotIndex>(2)),
-	};
+	// Create CRM over every queue slot in the registry, so out-of-graph work can use secondary queues too.
+	CommandRecordingManager::Init init;
+	init.queues.reserve(slotCount);
+	for (size_t qi = 0; qi < slotCount; ++qi) {
+		const auto slot = static_cast<QueueSlotIndex>(qi);
+		rhi::QueueKind listType = rhi::QueueKind::Graphics;
+		switch (m_queueRegistry.GetKind(slot)) {
+		case QueueKind::Compute: listType = rhi::QueueKind::Compute; break;
+		case QueueKind::Copy: listType = rhi::QueueKind::Copy; break;
+		default: break;
+		}
+		init.queues.push_back({ m_queueRegistry.GetQueue(slot), &m_queueRegistry.GetFence(slot), m_queueRegistry.GetPool(slot), listType });
+	}
 
 	{
 		ZoneScopedN("RenderGraph::Execute::CreateCommandRecordingManager");
@@ -7503,7 +10554,17 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 				absoluteFenceValue,
 				reason));
 		}
-		auto& srcFence = SlotFence(srcSlot);
+		// On another adapter the source fence is waited on through its copy opened on the dst device.
+		const AdapterIndex dstAdapter = m_queueRegistry.GetAdapter(static_cast<QueueSlotIndex>(dstSlot));
+		if (!m_queueRegistry.HasWaitFence(static_cast<QueueSlotIndex>(srcSlot), dstAdapter)) {
+			throw std::runtime_error(fmt::format(
+				"WaitOnSlot: queue slot {} has no fence opened on adapter {} for dstSlot={} reason='{}'",
+				srcSlot,
+				dstAdapter,
+				dstSlot,
+				reason));
+		}
+		auto& srcFence = m_queueRegistry.GetWaitFence(static_cast<QueueSlotIndex>(srcSlot), dstAdapter);
 		const auto srcFenceHandle = srcFence.GetHandle();
 		const UINT64 completedFenceValue = srcFence.GetCompletedValue();
 		if (completedFenceValue == UINT64_MAX) {
@@ -7567,14 +10628,73 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 		spdlog::info("RenderGraph::Execute frame={} completed frame-start waits", static_cast<unsigned>(context.frameIndex));
 	}
 
+	// Cross-frame overlap publishes, per resource, the completion signal of the last batch on the
+	// producing queue that touches it (the write or any later same-queue access), rather than the
+	// queue's final signal. The next frame then only waits for the work it actually depends on.
+	const bool crossFrameOverlap = m_getRenderGraphCrossFrameOverlapEnabled && m_getRenderGraphCrossFrameOverlapEnabled();
+	std::vector<std::unordered_map<uint64_t, unsigned int>> crossFrameRetireBatchByQueue(crossFrameOverlap ? slotCount : 0);
+	if (crossFrameOverlap) {
+		ZoneScopedN("RenderGraph::Execute::FindCrossFrameRetireBatches");
+		for (unsigned int batchIndex = 1; batchIndex < static_cast<unsigned int>(batches.size()); ++batchIndex) {
+			for (size_t queueIndex = 0; queueIndex < slotCount && queueIndex < m_compiledLastProducerBatchByResourceByQueue.size(); ++queueIndex) {
+				const auto& producers = m_compiledLastProducerBatchByResourceByQueue[queueIndex];
+				if (producers.empty()) continue;
+				for (auto& passVariant : batches[batchIndex].Passes(queueIndex)) {
+					std::visit([&](const auto* passEntry) {
+						ForEachFrameRequirement(passEntry->resources, [&](const auto& req) {
+							const uint64_t resourceID = req.resourceHandleAndRange.resource.GetGlobalResourceID();
+							if (producers.contains(resourceID)) {
+								crossFrameRetireBatchByQueue[queueIndex][resourceID] = batchIndex;
+							}
+						});
+					}, passVariant);
+				}
+			}
+		}
+	}
+
+	auto passDeclaresPresent = [](const PassBatch::QueuedPass& queuedPass) -> bool {
+		return std::visit([](auto* passAndResources) -> bool {
+			using PassPtr = std::decay_t<decltype(passAndResources)>;
+			if constexpr (std::is_same_v<PassPtr, RenderPassAndResources*>) {
+				return passAndResources && !passAndResources->resources.presentResources.empty();
+			} else {
+				return false;
+			}
+		}, queuedPass);
+	};
+
+	// The last batch and queue that present.
+	std::optional<size_t> presentBatchIndex;
+	size_t presentQueueIndex = 0;
+	for (size_t bi = 0; bi < batches.size(); ++bi) {
+		const auto& batch = batches[bi];
+		for (size_t qi = 0; qi < batch.QueueCount(); ++qi) {
+			const auto& queuedPasses = batch.queuePasses[qi];
+			if (std::any_of(queuedPasses.begin(), queuedPasses.end(), passDeclaresPresent)) {
+				presentBatchIndex = bi;
+				presentQueueIndex = qi;
+			}
+		}
+	}
+	const bool presentLatencyMode = m_getRenderGraphPresentLatencyModeEnabled && m_getRenderGraphPresentLatencyModeEnabled();
+
 	{
 		ZoneScopedN("RenderGraph::Execute::MarkCompletionSignals");
+		if (presentLatencyMode && presentBatchIndex && *presentBatchIndex > 0) {
+			batches[*presentBatchIndex].MarkQueueSignal(BatchSignalPhase::AfterCompletion, presentQueueIndex);
+		}
 		// Cross-frame waits only need a monotonic signal that is guaranteed to fire
 		// after the queue's final work for the frame. Marking every producer batch
 		// forces extra submissions in the parallel path.
 		for (size_t queueIndex = 0; queueIndex < slotCount; ++queueIndex) {
 			if (queueIndex >= m_compiledLastProducerBatchByResourceByQueue.size()) continue;
 			if (m_compiledLastProducerBatchByResourceByQueue[queueIndex].empty()) continue;
+			if (crossFrameOverlap) {
+				for (const auto& [resourceID, retireBatch] : crossFrameRetireBatchByQueue[queueIndex]) {
+					batches[retireBatch].MarkQueueSignal(BatchSignalPhase::AfterCompletion, queueIndex);
+				}
+			}
 
 			const unsigned int signalBatch = lastCrossFrameSignalBatchByQueue[queueIndex];
 			if (signalBatch > 0 && signalBatch < batches.size()) {
@@ -7845,7 +10965,7 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 							ci,
 							qs.numCLs);
 					}
-					qs.preallocatedCLs[ci] = SlotPool(qi)->Request();
+					qs.preallocatedCLs[ci] = SlotPool(qi)->Request(qs.clSizeHints[ci]);
 					if (qs.preallocatedCLs[ci].list) {
 						const auto queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(qi));
 						const auto debugName = MakeRenderGraphCommandListName(
@@ -7904,6 +11024,21 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 		lastSignaledPerSlot[qi] = nextFenceValue > 0 ? nextFenceValue - 1 : 0;
 	}
 
+	// Queue slots are rebuilt together, so a changed count means the waits recorded so far belong
+	// to queues that no longer exist.
+	if (m_externalWaitedValueByTimelineByQueue.size() != slotCount) {
+		m_externalWaitedValueByTimelineByQueue.clear();
+		m_externalWaitedValueByTimelineByQueue.resize(slotCount);
+	}
+	m_lastExternalWaitStats = {};
+	m_lastSubmitStats = {};
+
+	const ParallelImmediateReplayOptions immediateReplay{
+		.taskService = m_taskService.get(),
+		.minOpsPerCommandList = m_getImmediateParallelReplayMinOps ? m_getImmediateParallelReplayMinOps() : 0u,
+		.maxCommandLists = m_getImmediateParallelReplayMaxCommandLists ? m_getImmediateParallelReplayMaxCommandLists() : 4u,
+	};
+
 	// Execution, two paths: heavyDebug (serial) or normal (parallel).
 	if (heavyDebug) {
 		ZoneScopedN("RenderGraph::Execute::HeavyDebugPath");
@@ -7934,6 +11069,12 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 					.outExternalFences = slotExternalFences[qi],
 					.queuedExternalFenceOrigins = queuedExternalFenceOriginsThisFrame,
 					.lastSignaledOnTimeline = lastSignaledPerSlot[qi],
+					.externalWaitedValueByTimeline = m_externalWaitedValueByTimelineByQueue[qi],
+					.externalWaitStats = m_lastExternalWaitStats,
+					.immediateReplay = immediateReplay,
+					.registry = _registry,
+					.transientUploadsByPass = m_transientUploadsByPass,
+					.globalBufferBarrierThreshold = globalBufferBarrierThreshold,
 					.batchTraceEnabled = batchTraceEnabled,
 				};
 				ExecuteQueueBatch(args, WaitOnSlot);
@@ -8032,31 +11173,380 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 			}
 		}
 
-		{
-			ZoneScopedN("RenderGraph::Execute::ParallelPath::RecordAllBatches");
-			if (batchTraceEnabled) {
-				spdlog::info(
-					"RenderGraph::Execute frame={} record-all-batches begin taskCount={} (serialBypass={})",
-					static_cast<unsigned>(context.frameIndex),
-					tasks.size(),
-					true);
+		// Submission state is shared by both submission modes: in order on this thread once
+		// everything is recorded, or streamed from the recording tasks (see drainRecordedSubmissions).
+		struct PendingQueueSubmission {
+			std::vector<rhi::CommandList> pendingCommandLists;
+			std::vector<CommandListPair> pendingPairs;
+			std::vector<CommandListPair> submittedPairsAwaitingRecycle;
+
+			bool HasPendingCommandLists() const {
+				return !pendingCommandLists.empty();
 			}
-			ParallelForOptional("RecordAllBatches", tasks.size(), [&](size_t taskIdx) {
-				auto& task = tasks[taskIdx];
-				auto& qs = m_executionSchedule.batches[task.batchIndex].queues[task.queueIndex];
-				auto rhiQ = SlotQueue(task.queueIndex);
-				const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(task.queueIndex));
-				try {
-					RecordQueueBatchArgs args{
-						.sched = qs,
-						.batch = batches[task.batchIndex],
+
+			bool HasOutstandingWork() const {
+				return !pendingPairs.empty() || !submittedPairsAwaitingRecycle.empty();
+			}
+		};
+
+		std::vector<PendingQueueSubmission> pendingSubmissions(slotCount);
+
+		// Highest value each queue has waited on from each other queue this frame, [dst * slotCount + src].
+		std::vector<UINT64> waitedFenceBySlotPair(slotCount * slotCount, 0);
+		auto queueWaitIsCovered = [&](size_t dstIndex, size_t srcIndex, UINT64 value) {
+			if (dstIndex == srcIndex || waitedFenceBySlotPair[dstIndex * slotCount + srcIndex] >= value) {
+				return true;
+			}
+			const UINT64 completed = SlotFence(srcIndex).GetCompletedValue();
+			return completed != UINT64_MAX && completed >= value;
+		};
+
+		// Only waits that will actually reach the queue end the pending submission; covered ones
+		// let the batch's lists join the previous batch's Submit.
+		auto batchHasWaitsForQueue = [&](const PassBatch& batch, size_t queueIndex) {
+			const auto& waitedValueByTimeline = m_externalWaitedValueByTimelineByQueue[queueIndex];
+			for (const auto& wait : batch.ExternalWaitsBeforeTransitions(queueIndex)) {
+				if (!wait.timeline.IsValid()) {
+					return true;
+				}
+				auto waitedIt = waitedValueByTimeline.find(PackTimelineSignalKey(wait.timeline.GetHandle()));
+				if (waitedIt != waitedValueByTimeline.end() && waitedIt->second >= wait.value) {
+					continue;
+				}
+				const uint64_t completed = wait.timeline.GetCompletedValue();
+				if (completed == UINT64_MAX || completed < wait.value) {
+					return true;
+				}
+			}
+			for (size_t waitPhaseIndex = 0; waitPhaseIndex < PassBatch::kWaitPhaseCount; ++waitPhaseIndex) {
+				const auto waitPhase = static_cast<BatchWaitPhase>(waitPhaseIndex);
+				for (size_t srcIndex = 0; srcIndex < batch.QueueCount(); ++srcIndex) {
+					if (batch.HasQueueWait(waitPhase, queueIndex, srcIndex)
+						&& !queueWaitIsCovered(queueIndex, srcIndex, batch.GetQueueWaitFenceValue(waitPhase, queueIndex, srcIndex))) {
+						return true;
+					}
+				}
+			}
+			return false;
+		};
+
+		auto submitPendingWithoutSignal = [&](size_t queueIndex, size_t batchIndex, const char* reason) {
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitPendingWithoutSignal");
+			ZoneText(reason, std::strlen(reason));
+			auto& pending = pendingSubmissions[queueIndex];
+			if (!pending.HasPendingCommandLists()) {
+				return;
+			}
+
+			auto rhiQueue = SlotQueue(queueIndex);
+			const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueIndex));
+			ZoneText(QueueKindToString(queueKind), std::strlen(QueueKindToString(queueKind)));
+			if (batchTraceEnabled) {
+				spdlog::info(
+					"RenderGraph::Execute frame={} submit pending queue {} slot {} batch {} reason={} clCount={}",
+					static_cast<unsigned>(context.frameIndex),
+					QueueKindToString(queueKind),
+					queueIndex,
+					batchIndex,
+					reason,
+					pending.pendingCommandLists.size());
+			}
+
+			rhiQueue.Submit({ pending.pendingCommandLists.data(), static_cast<uint32_t>(pending.pendingCommandLists.size()) }, {});
+			++m_lastSubmitStats.submitCalls;
+			m_lastSubmitStats.submittedCommandLists += pending.pendingCommandLists.size();
+			for (auto& pair : pending.pendingPairs) {
+				pending.submittedPairsAwaitingRecycle.push_back(std::move(pair));
+			}
+			pending.pendingPairs.clear();
+			pending.pendingCommandLists.clear();
+		};
+
+		auto signalAndRecycleQueue = [&](size_t queueIndex, size_t batchIndex, UINT64 signalValue, const char* reason) {
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::SignalAndRecycleQueue");
+			ZoneText(reason, std::strlen(reason));
+			auto& pending = pendingSubmissions[queueIndex];
+			if (!pending.HasOutstandingWork()) {
+				return;
+			}
+
+			if (pending.HasPendingCommandLists()) {
+				submitPendingWithoutSignal(queueIndex, batchIndex, reason);
+			}
+
+			auto rhiQueue = SlotQueue(queueIndex);
+			auto& fenceTimeline = SlotFence(queueIndex);
+			auto* pool = SlotPool(queueIndex);
+			const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueIndex));
+			ZoneText(QueueKindToString(queueKind), std::strlen(QueueKindToString(queueKind)));
+
+			if (signalValue == 0) {
+				spdlog::error(
+					"RenderGraph::Execute frame={} queue {} slot {} batch {} encountered zero signal for reason={} and is falling back to a monotonic recycle signal.",
+					static_cast<unsigned>(context.frameIndex),
+					QueueKindToString(queueKind),
+					queueIndex,
+					batchIndex,
+					reason);
+				if (lastSignaledPerSlot[queueIndex] == UINT64_MAX) {
+					throw std::runtime_error(fmt::format(
+						"RenderGraph::Execute cannot allocate fallback signal for slot {} batch {} reason {} because lastSignaled is UINT64_MAX",
+						queueIndex,
+						batchIndex,
+						reason));
+				}
+				signalValue = lastSignaledPerSlot[queueIndex] + 1;
+			}
+
+			if (signalValue == UINT64_MAX) {
+				throw std::runtime_error(fmt::format(
+					"RenderGraph::Execute rejected terminal queue signal value: slot={} batch={} reason={}",
+					queueIndex,
+					batchIndex,
+					reason));
+			}
+
+			if (batchTraceEnabled) {
+				spdlog::info(
+					"RenderGraph::Execute frame={} signal queue {} slot {} batch {} reason={} fence={} pendingPairs={}",
+					static_cast<unsigned>(context.frameIndex),
+					QueueKindToString(queueKind),
+					queueIndex,
+					batchIndex,
+					reason,
+					signalValue,
+					pending.submittedPairsAwaitingRecycle.size());
+			}
+
+			const rhi::Result signalResult = rhiQueue.Signal({ fenceTimeline.GetHandle(), signalValue });
+			if (signalResult != rhi::Result::Ok) {
+				throw std::runtime_error(fmt::format(
+					"RenderGraph::Execute queue signal failed: slot={} batch={} reason={} value={} result={}",
+					queueIndex,
+					batchIndex,
+					reason,
+					signalValue,
+					rhi::ResultName(signalResult)));
+			}
+			lastSignaledPerSlot[queueIndex] = std::max(lastSignaledPerSlot[queueIndex], signalValue);
+			auto [slotSignalIt, insertedSlotSignal] = m_lastExternalSignalValueByTimeline.try_emplace(
+				PackTimelineSignalKey(fenceTimeline.GetHandle()),
+				0);
+			slotSignalIt->second = std::max(slotSignalIt->second, signalValue);
+
+			if (pool) {
+				ZoneScopedN("RenderGraph::Execute::ParallelPath::SignalAndRecycleQueue::RecyclePairs");
+				for (auto& pair : pending.submittedPairsAwaitingRecycle) {
+					pool->Recycle(std::move(pair), signalValue);
+				}
+			}
+			pending.submittedPairsAwaitingRecycle.clear();
+		};
+
+		auto flushExternalFencesForQueue = [&](size_t queueIndex, size_t batchIndex, std::vector<PassReturn>& externalFences) {
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::FlushExternalFencesForQueue");
+			if (externalFences.empty()) {
+				return;
+			}
+
+			submitPendingWithoutSignal(queueIndex, batchIndex, "ExternalFences");
+			auto rhiQueue = SlotQueue(queueIndex);
+			SignalExternalFences(
+				rhiQueue,
+				m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueIndex)),
+				&SlotFence(queueIndex),
+				queueIndex,
+				batchIndex,
+				static_cast<unsigned>(context.frameIndex),
+				queueSlotFenceTimelineKeys,
+				seenExternalFenceSignalsThisFrame,
+				m_lastExternalSignalValueByTimeline,
+				externalFences);
+		};
+
+		auto queueRecordedCommandList = [&](size_t queueIndex, CommandListPair&& pair) {
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::QueueRecordedCommandList");
+			auto& pending = pendingSubmissions[queueIndex];
+			pending.pendingCommandLists.push_back(pair.list.Get());
+			pending.pendingPairs.push_back(std::move(pair));
+		};
+
+		// Queues one scheduled CL behind the lists a parallel immediate replay recorded ahead of it.
+		auto queueScheduledCommandLists = [&](size_t queueIndex, QueueBatchSchedule& qs, uint8_t clIndex) {
+			for (auto& pair : qs.leadingCLs[clIndex]) {
+				queueRecordedCommandList(queueIndex, std::move(pair));
+			}
+			qs.leadingCLs[clIndex].clear();
+			queueRecordedCommandList(queueIndex, std::move(qs.preallocatedCLs[clIndex]));
+		};
+
+		auto applyBatchWaitPhase = [&](const PassBatch& batch, size_t batchIndex, size_t queueIndex, BatchWaitPhase waitPhase) {
+			const char* waitPhaseLabel = "Unknown";
+			switch (waitPhase) {
+			case BatchWaitPhase::BeforeTransitions:
+				waitPhaseLabel = "BeforeTransitions";
+				break;
+			case BatchWaitPhase::BeforeExecution:
+				waitPhaseLabel = "BeforeExecution";
+				break;
+			case BatchWaitPhase::BeforeAfterPasses:
+				waitPhaseLabel = "BeforeAfterPasses";
+				break;
+			default:
+				break;
+			}
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::ApplyBatchWaitPhase");
+			ZoneText(waitPhaseLabel, std::strlen(waitPhaseLabel));
+			if (waitPhase == BatchWaitPhase::BeforeTransitions) {
+				WaitExternalFencesBeforeTransitions(
+					SlotQueue(queueIndex),
+					batch,
+					queueIndex,
+					batchIndex,
+					static_cast<unsigned>(context.frameIndex),
+					m_externalWaitedValueByTimelineByQueue[queueIndex],
+					m_lastExternalWaitStats);
+			}
+			for (size_t srcIndex = 0; srcIndex < batch.QueueCount(); ++srcIndex) {
+				if (!batch.HasQueueWait(waitPhase, queueIndex, srcIndex)) {
+					continue;
+				}
+				const UINT64 waitValue = batch.GetQueueWaitFenceValue(waitPhase, queueIndex, srcIndex);
+				if (srcIndex != queueIndex && waitValue != 0 && waitValue != UINT64_MAX && queueWaitIsCovered(queueIndex, srcIndex, waitValue)) {
+					++m_lastSubmitStats.queueWaitsElided;
+					continue;
+				}
+				waitedFenceBySlotPair[queueIndex * slotCount + srcIndex] = std::max(waitedFenceBySlotPair[queueIndex * slotCount + srcIndex], waitValue);
+				WaitOnSlot(
+					queueIndex,
+					srcIndex,
+					waitValue,
+					fmt::format(
+						"BatchWait frame={} batch={} phase={} dstQueue={} srcQueue={}",
+						static_cast<unsigned>(context.frameIndex),
+						batchIndex,
+						waitPhaseLabel,
+						queueIndex,
+						srcIndex));
+			}
+		};
+
+		auto submitQueueBatch = [&](size_t bi, size_t qi) {
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitQueue");
+			auto& batch = batches[bi];
+			auto& qs = m_executionSchedule.batches[bi].queues[qi];
+			const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(qi));
+			ZoneText(QueueKindToString(queueKind), std::strlen(QueueKindToString(queueKind)));
+
+			if (batchHasWaitsForQueue(batch, qi)) {
+				submitPendingWithoutSignal(qi, bi, "BeforeQueueWaits");
+			}
+
+			uint8_t clIndex = 0;
+			{
+				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::ApplyBeforeTransitionWaits");
+				applyBatchWaitPhase(batch, bi, qi, BatchWaitPhase::BeforeTransitions);
+			}
+			if (qs.splitAfterTransitions) {
+				queueScheduledCommandLists(qi, qs, clIndex);
+				signalAndRecycleQueue(
+					qi,
+					bi,
+					batch.GetQueueSignalFenceValue(BatchSignalPhase::AfterTransitions, qi),
+					"AfterTransitions");
+				++clIndex;
+			}
+
+			applyBatchWaitPhase(batch, bi, qi, BatchWaitPhase::BeforeExecution);
+
+			if (qs.splitAfterExecution) {
+				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::ApplyAfterExecutionWaits");
+				queueScheduledCommandLists(qi, qs, clIndex);
+				signalAndRecycleQueue(
+					qi,
+					bi,
+					batch.GetQueueSignalFenceValue(BatchSignalPhase::AfterExecution, qi),
+					"AfterExecution");
+				++clIndex;
+			}
+
+			{
+				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::ApplyBeforeAfterPassesWaits");
+				applyBatchWaitPhase(batch, bi, qi, BatchWaitPhase::BeforeAfterPasses);
+				queueScheduledCommandLists(qi, qs, clIndex);
+			}
+			if (qs.signalAfterCompletion) {
+				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::SignalAfterCompletion");
+				signalAndRecycleQueue(
+					qi,
+					bi,
+					batch.GetQueueSignalFenceValue(BatchSignalPhase::AfterCompletion, qi),
+					"AfterCompletion");
+			}
+
+			{
+				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::FlushExternalFences");
+				flushExternalFencesForQueue(qi, bi, qs.externalFences);
+			}
+		};
+
+		// Streaming submission: a recorded (batch, queue) task is submitted as soon as every earlier
+		// task on the same queue slot has been, while later batches are still recording. Cross-queue
+		// waits may then reach the GPU before the matching signal is submitted, which timeline
+		// fences allow. The submission helpers above are only ever entered under the mutex.
+		const bool streamingSubmission = m_getRenderGraphStreamingSubmissionEnabled && m_getRenderGraphStreamingSubmissionEnabled();
+		std::mutex streamingSubmitMutex;
+		std::atomic<bool> streamingRecordFailed{ false };
+		auto taskRecorded = std::make_unique<std::atomic<uint8_t>[]>(tasks.size());
+		std::vector<std::vector<size_t>> taskIndicesBySlot(slotCount);
+		std::vector<size_t> nextTaskBySlot(slotCount, 0);
+		if (streamingSubmission) {
+			for (size_t taskIdx = 0; taskIdx < tasks.size(); ++taskIdx) {
+				taskIndicesBySlot[tasks[taskIdx].queueIndex].push_back(taskIdx);
+			}
+		}
+		auto drainRecordedSubmissions = [&](size_t queueIndex) {
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::DrainRecordedSubmissions");
+			const auto& order = taskIndicesBySlot[queueIndex];
+			auto& next = nextTaskBySlot[queueIndex];
+			while (next < order.size() && taskRecorded[order[next]].load(std::memory_order_acquire) != 0) {
+				const auto& task = tasks[order[next]];
+				submitQueueBatch(task.batchIndex, task.queueIndex);
+				++next;
+			}
+		};
+
+		{
+			ZoneScopedN("RenderGraph::Execute::ParallelPath::RecordAllBatches");
+			FrameTraceScope frameTraceScope("RecordAllBatches");
+			if (batchTraceEnabled) {
+				spdlog::info(
+					"RenderGraph::Execute frame={} record-all-batches begin taskCount={} (serialBypass={})",
+					static_cast<unsigned>(context.frameIndex),
+					tasks.size(),
+					true);
+			}
+			ParallelForOptional("RecordAllBatches", tasks.size(), [&](size_t taskIdx) {
+				auto& task = tasks[taskIdx];
+				auto& qs = m_executionSchedule.batches[task.batchIndex].queues[task.queueIndex];
+				auto rhiQ = SlotQueue(task.queueIndex);
+				const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(task.queueIndex));
+				try {
+					RecordQueueBatchArgs args{
+						.sched = qs,
+						.batch = batches[task.batchIndex],
 						.batchIndex = task.batchIndex,
 						.queue = queueKind,
 						.queueSlot = task.queueIndex,
 						.rhiQueue = rhiQ,
+						.pool = *SlotPool(task.queueIndex),
 						.context = context,
 						.statisticsService = statisticsService,
 						.queuedExternalFenceOrigins = queuedExternalFenceOriginsThisFrame,
+						.immediateReplay = immediateReplay,
+						.registry = _registry,
+						.transientUploadsByPass = m_transientUploadsByPass,
+						.globalBufferBarrierThreshold = globalBufferBarrierThreshold,
 						.batchTraceEnabled = batchTraceEnabled,
 					};
 					RecordQueueBatch(args);
@@ -8080,8 +11570,17 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 						oss << " with passes [" << passNames << "]";
 					}
 					oss << ": " << ex.what();
+					// Nothing more is streamed once a task fails; the frame is abandoned either way.
+					streamingRecordFailed.store(true, std::memory_order_release);
 					throw std::runtime_error(oss.str());
 				}
+				if (streamingSubmission) {
+					taskRecorded[taskIdx].store(1, std::memory_order_release);
+					std::lock_guard submitLock(streamingSubmitMutex);
+					if (!streamingRecordFailed.load(std::memory_order_acquire)) {
+						drainRecordedSubmissions(task.queueIndex);
+					}
+				}
 				}, false); // Toggle to true to force serial recording for easier debugging and validation
 			if (batchTraceEnabled) {
 				spdlog::info("RenderGraph::Execute frame={} record-all-batches complete", static_cast<unsigned>(context.frameIndex));
@@ -8105,288 +11604,29 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 			}
 		}
 
-		// Sequential submission on the main thread.
+		// Submission on the main thread (everything, or what streaming left behind).
 		{
 			ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitAllBatches");
 			if (batchTraceEnabled) {
 				spdlog::info("RenderGraph::Execute frame={} submit-all-batches begin", static_cast<unsigned>(context.frameIndex));
 			}
 
-			struct PendingQueueSubmission {
-				std::vector<rhi::CommandList> pendingCommandLists;
-				std::vector<CommandListPair> pendingPairs;
-				std::vector<CommandListPair> submittedPairsAwaitingRecycle;
-
-				bool HasPendingCommandLists() const {
-					return !pendingCommandLists.empty();
-				}
-
-				bool HasOutstandingWork() const {
-					return !pendingPairs.empty() || !submittedPairsAwaitingRecycle.empty();
-				}
-			};
-
-			std::vector<PendingQueueSubmission> pendingSubmissions(slotCount);
-
-			auto batchHasWaitsForQueue = [&](const PassBatch& batch, size_t queueIndex) {
-				if (!batch.ExternalWaitsBeforeTransitions(queueIndex).empty()) {
-					return true;
-				}
-				for (size_t waitPhaseIndex = 0; waitPhaseIndex < PassBatch::kWaitPhaseCount; ++waitPhaseIndex) {
-					const auto waitPhase = static_cast<BatchWaitPhase>(waitPhaseIndex);
-					for (size_t srcIndex = 0; srcIndex < batch.QueueCount(); ++srcIndex) {
-						if (batch.HasQueueWait(waitPhase, queueIndex, srcIndex)) {
-							return true;
+			if (!streamingSubmission) {
+				for (size_t bi = 0; bi < batches.size(); ++bi) {
+					ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch");
+					auto& batchSched = m_executionSchedule.batches[bi];
+					for (size_t qi = 0; qi < batchSched.queues.size(); ++qi) {
+						if (batchSched.queues[qi].active) {
+							submitQueueBatch(bi, qi);
 						}
 					}
 				}
-				return false;
-			};
-
-			auto submitPendingWithoutSignal = [&](size_t queueIndex, size_t batchIndex, const char* reason) {
-				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitPendingWithoutSignal");
-				ZoneText(reason, std::strlen(reason));
-				auto& pending = pendingSubmissions[queueIndex];
-				if (!pending.HasPendingCommandLists()) {
-					return;
-				}
-
-				auto rhiQueue = SlotQueue(queueIndex);
-				const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueIndex));
-				ZoneText(QueueKindToString(queueKind), std::strlen(QueueKindToString(queueKind)));
-				if (batchTraceEnabled) {
-					spdlog::info(
-						"RenderGraph::Execute frame={} submit pending queue {} slot {} batch {} reason={} clCount={}",
-						static_cast<unsigned>(context.frameIndex),
-						QueueKindToString(queueKind),
-						queueIndex,
-						batchIndex,
-						reason,
-						pending.pendingCommandLists.size());
-				}
-
-				rhiQueue.Submit({ pending.pendingCommandLists.data(), static_cast<uint32_t>(pending.pendingCommandLists.size()) }, {});
-				for (auto& pair : pending.pendingPairs) {
-					pending.submittedPairsAwaitingRecycle.push_back(std::move(pair));
-				}
-				pending.pendingPairs.clear();
-				pending.pendingCommandLists.clear();
-			};
-
-			auto signalAndRecycleQueue = [&](size_t queueIndex, size_t batchIndex, UINT64 signalValue, const char* reason) {
-				ZoneScopedN("RenderGraph::Execute::ParallelPath::SignalAndRecycleQueue");
-				ZoneText(reason, std::strlen(reason));
-				auto& pending = pendingSubmissions[queueIndex];
-				if (!pending.HasOutstandingWork()) {
-					return;
-				}
-
-				if (pending.HasPendingCommandLists()) {
-					submitPendingWithoutSignal(queueIndex, batchIndex, reason);
-				}
-
-				auto rhiQueue = SlotQueue(queueIndex);
-				auto& fenceTimeline = SlotFence(queueIndex);
-				auto* pool = SlotPool(queueIndex);
-				const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueIndex));
-				ZoneText(QueueKindToString(queueKind), std::strlen(QueueKindToString(queueKind)));
-
-				if (signalValue == 0) {
-					spdlog::error(
-						"RenderGraph::Execute frame={} queue {} slot {} batch {} encountered zero signal for reason={} and is falling back to a monotonic recycle signal.",
-						static_cast<unsigned>(context.frameIndex),
-						QueueKindToString(queueKind),
-						queueIndex,
-						batchIndex,
-						reason);
-					if (lastSignaledPerSlot[queueIndex] == UINT64_MAX) {
-						throw std::runtime_error(fmt::format(
-							"RenderGraph::Execute cannot allocate fallback signal for slot {} batch {} reason {} because lastSignaled is UINT64_MAX",
-							queueIndex,
-							batchIndex,
-							reason));
-					}
-					signalValue = lastSignaledPerSlot[queueIndex] + 1;
-				}
-
-				if (signalValue == UINT64_MAX) {
-					throw std::runtime_error(fmt::format(
-						"RenderGraph::Execute rejected terminal queue signal value: slot={} batch={} reason={}",
-						queueIndex,
-						batchIndex,
-						reason));
-				}
-
-				if (batchTraceEnabled) {
-					spdlog::info(
-						"RenderGraph::Execute frame={} signal queue {} slot {} batch {} reason={} fence={} pendingPairs={}",
-						static_cast<unsigned>(context.frameIndex),
-						QueueKindToString(queueKind),
-						queueIndex,
-						batchIndex,
-						reason,
-						signalValue,
-						pending.submittedPairsAwaitingRecycle.size());
-				}
-
-				const rhi::Result signalResult = rhiQueue.Signal({ fenceTimeline.GetHandle(), signalValue });
-				if (signalResult != rhi::Result::Ok) {
-					throw std::runtime_error(fmt::format(
-						"RenderGraph::Execute queue signal failed: slot={} batch={} reason={} value={} result={}",
-						queueIndex,
-						batchIndex,
-						reason,
-						signalValue,
-						rhi::ResultName(signalResult)));
-				}
-				lastSignaledPerSlot[queueIndex] = std::max(lastSignaledPerSlot[queueIndex], signalValue);
-				auto [slotSignalIt, insertedSlotSignal] = m_lastExternalSignalValueByTimeline.try_emplace(
-					PackTimelineSignalKey(fenceTimeline.GetHandle()),
-					0);
-				slotSignalIt->second = std::max(slotSignalIt->second, signalValue);
-
-				if (pool) {
-					ZoneScopedN("RenderGraph::Execute::ParallelPath::SignalAndRecycleQueue::RecyclePairs");
-					for (auto& pair : pending.submittedPairsAwaitingRecycle) {
-						pool->Recycle(std::move(pair), signalValue);
-					}
-				}
-				pending.submittedPairsAwaitingRecycle.clear();
-			};
-
-			auto flushExternalFencesForQueue = [&](size_t queueIndex, size_t batchIndex, std::vector<PassReturn>& externalFences) {
-				ZoneScopedN("RenderGraph::Execute::ParallelPath::FlushExternalFencesForQueue");
-				if (externalFences.empty()) {
-					return;
-				}
-
-				submitPendingWithoutSignal(queueIndex, batchIndex, "ExternalFences");
-				auto rhiQueue = SlotQueue(queueIndex);
-				SignalExternalFences(
-					rhiQueue,
-					m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(queueIndex)),
-					&SlotFence(queueIndex),
-					queueIndex,
-					batchIndex,
-					static_cast<unsigned>(context.frameIndex),
-					queueSlotFenceTimelineKeys,
-					seenExternalFenceSignalsThisFrame,
-					m_lastExternalSignalValueByTimeline,
-					externalFences);
-			};
-
-			auto queueRecordedCommandList = [&](size_t queueIndex, CommandListPair&& pair) {
-				ZoneScopedN("RenderGraph::Execute::ParallelPath::QueueRecordedCommandList");
-				auto& pending = pendingSubmissions[queueIndex];
-				pending.pendingCommandLists.push_back(pair.list.Get());
-				pending.pendingPairs.push_back(std::move(pair));
-			};
-
-			auto applyBatchWaitPhase = [&](const PassBatch& batch, size_t batchIndex, size_t queueIndex, BatchWaitPhase waitPhase) {
-				const char* waitPhaseLabel = "Unknown";
-				switch (waitPhase) {
-				case BatchWaitPhase::BeforeTransitions:
-					waitPhaseLabel = "BeforeTransitions";
-					break;
-				case BatchWaitPhase::BeforeExecution:
-					waitPhaseLabel = "BeforeExecution";
-					break;
-				case BatchWaitPhase::BeforeAfterPasses:
-					waitPhaseLabel = "BeforeAfterPasses";
-					break;
-				default:
-					break;
-				}
-				ZoneScopedN("RenderGraph::Execute::ParallelPath::ApplyBatchWaitPhase");
-				ZoneText(waitPhaseLabel, std::strlen(waitPhaseLabel));
-				if (waitPhase == BatchWaitPhase::BeforeTransitions) {
-					WaitExternalFencesBeforeTransitions(
-						SlotQueue(queueIndex),
-						batch,
-						queueIndex,
-						batchIndex,
-						static_cast<unsigned>(context.frameIndex));
-				}
-				for (size_t srcIndex = 0; srcIndex < batch.QueueCount(); ++srcIndex) {
-					if (!batch.HasQueueWait(waitPhase, queueIndex, srcIndex)) {
-						continue;
-					}
-					WaitOnSlot(
-						queueIndex,
-						srcIndex,
-						batch.GetQueueWaitFenceValue(waitPhase, queueIndex, srcIndex),
-						fmt::format(
-							"BatchWait frame={} batch={} phase={} dstQueue={} srcQueue={}",
-							static_cast<unsigned>(context.frameIndex),
-							batchIndex,
-							waitPhaseLabel,
-							queueIndex,
-							srcIndex));
-				}
-			};
-
-			for (size_t bi = 0; bi < batches.size(); ++bi) {
-				ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch");
-				auto& batch = batches[bi];
-				auto& batchSched = m_executionSchedule.batches[bi];
-
-				for (size_t qi = 0; qi < batchSched.queues.size(); ++qi) {
-					ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitQueue");
-					auto& qs = batchSched.queues[qi];
-					if (!qs.active) continue;
-					const QueueKind queueKind = m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(qi));
-					ZoneText(QueueKindToString(queueKind), std::strlen(QueueKindToString(queueKind)));
-
-					if (batchHasWaitsForQueue(batch, qi)) {
-						submitPendingWithoutSignal(qi, bi, "BeforeQueueWaits");
-					}
-
-					uint8_t clIndex = 0;
-					{
-						ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::ApplyBeforeTransitionWaits");
-						applyBatchWaitPhase(batch, bi, qi, BatchWaitPhase::BeforeTransitions);
-					}
-					if (qs.splitAfterTransitions) {
-						queueRecordedCommandList(qi, std::move(qs.preallocatedCLs[clIndex]));
-						signalAndRecycleQueue(
-							qi,
-							bi,
-							batch.GetQueueSignalFenceValue(BatchSignalPhase::AfterTransitions, qi),
-							"AfterTransitions");
-						++clIndex;
-					}
-
-					applyBatchWaitPhase(batch, bi, qi, BatchWaitPhase::BeforeExecution);
-
-					if (qs.splitAfterExecution) {
-						ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::ApplyAfterExecutionWaits");
-						queueRecordedCommandList(qi, std::move(qs.preallocatedCLs[clIndex]));
-						signalAndRecycleQueue(
-							qi,
-							bi,
-							batch.GetQueueSignalFenceValue(BatchSignalPhase::AfterExecution, qi),
-							"AfterExecution");
-						++clIndex;
-					}
-
-					{
-						ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::ApplyBeforeAfterPassesWaits");
-						applyBatchWaitPhase(batch, bi, qi, BatchWaitPhase::BeforeAfterPasses);
-						queueRecordedCommandList(qi, std::move(qs.preallocatedCLs[clIndex]));
-					}
-					if (qs.signalAfterCompletion) {
-						ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::SignalAfterCompletion");
-						signalAndRecycleQueue(
-							qi,
-							bi,
-							batch.GetQueueSignalFenceValue(BatchSignalPhase::AfterCompletion, qi),
-							"AfterCompletion");
-					}
-
-					{
-						ZoneScopedN("RenderGraph::Execute::ParallelPath::SubmitBatch::FlushExternalFences");
-						flushExternalFencesForQueue(qi, bi, qs.externalFences);
-					}
+			}
+			else {
+				// Every task drains its own slot after recording, so this only catches stragglers.
+				std::lock_guard submitLock(streamingSubmitMutex);
+				for (size_t qi = 0; qi < slotCount; ++qi) {
+					drainRecordedSubmissions(qi);
 				}
 			}
 
@@ -8412,31 +11652,21 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 		}
 	}
 
-	auto passDeclaresPresent = [](const PassBatch::QueuedPass& queuedPass) -> bool {
-		return std::visit([](auto* passAndResources) -> bool {
-			using PassPtr = std::decay_t<decltype(passAndResources)>;
-			if constexpr (std::is_same_v<PassPtr, RenderPassAndResources*>) {
-				return passAndResources && !passAndResources->resources.presentResources.empty();
-			} else {
-				return false;
-			}
-		}, queuedPass);
-	};
-
-	for (size_t bi = 0; bi < batches.size(); ++bi) {
-		const auto& batch = batches[bi];
-		for (size_t qi = 0; qi < batch.QueueCount(); ++qi) {
-			const auto& queuedPasses = batch.queuePasses[qi];
-			if (std::any_of(queuedPasses.begin(), queuedPasses.end(), passDeclaresPresent)) {
-				const auto queueSlot = static_cast<QueueSlotIndex>(static_cast<uint8_t>(qi));
-				m_lastPresentDependency = PresentDependency{
-					.queue = SlotQueue(qi),
-					.wait = { SlotFence(qi).GetHandle(), lastSignaledPerSlot[qi] },
-					.queueSlot = queueSlot,
-					.batchIndex = bi,
-					.valid = lastSignaledPerSlot[qi] != 0,
-				};
-			}
+	if (presentBatchIndex) {
+		const size_t qi = presentQueueIndex;
+		// In latency mode the present batch signals on its own, ahead of the deferred work.
+		const UINT64 presentSignal = presentLatencyMode
+			? batches[*presentBatchIndex].GetQueueSignalFenceValue(BatchSignalPhase::AfterCompletion, qi)
+			: lastSignaledPerSlot[qi];
+		m_lastPresentDependency = PresentDependency{
+			.queue = SlotQueue(qi),
+			.wait = { SlotFence(qi).GetHandle(), presentSignal },
+			.queueSlot = static_cast<QueueSlotIndex>(static_cast<uint8_t>(qi)),
+			.batchIndex = *presentBatchIndex,
+			.valid = presentSignal != 0 && presentSignal <= lastSignaledPerSlot[qi],
+		};
+		if (presentLatencyMode && m_lastPresentDependency->valid) {
+			m_inFlightPresentDependencies.push_back(*m_lastPresentDependency);
 		}
 	}
 	if (batchTraceEnabled && m_lastPresentDependency) {
@@ -8501,9 +11731,21 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 			for (const auto& [resourceID, producerBatch] : m_compiledLastProducerBatchByResourceByQueue[queueIndex]) {
 				if (producerBatch == 0 || producerBatch >= batches.size()) continue;
 
+				uint64_t producerFenceValue = fenceValue;
+				if (crossFrameOverlap) {
+					auto itRetire = crossFrameRetireBatchByQueue[queueIndex].find(resourceID);
+					if (itRetire != crossFrameRetireBatchByQueue[queueIndex].end()) {
+						const uint64_t retireFenceValue =
+							batches[itRetire->second].GetQueueSignalFenceValue(BatchSignalPhase::AfterCompletion, queueIndex);
+						if (retireFenceValue != 0 && retireFenceValue <= fenceValue) {
+							producerFenceValue = retireFenceValue;
+						}
+					}
+				}
+
 				LastProducerAcrossFrames producer{
 					.queueSlot = queueIndex,
-					.fenceValue = fenceValue,
+					.fenceValue = producerFenceValue,
 					.publishSerial = publishSerial,
 					.anonymous = isAnonymousTrackedResource(resourceID),
 				};
@@ -8570,11 +11812,10 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 	}
 
 	// Sync CRM signal tracking with values we signaled directly.
-	// Capped at primary queue count: CRM only tracks the 3 primary queues (Graphics/Compute/Copy).
-	for (size_t qi = 0; qi < std::min(slotCount, static_cast<size_t>(QueueKind::Count)); ++qi) {
+	for (size_t qi = 0; qi < std::min(slotCount, crm->SlotCount()); ++qi) {
 		UINT64 val = lastSignaledPerSlot[qi];
 		if (val > 0) {
-			crm->EnsureMinSignaledValue(static_cast<QueueKind>(qi), val);
+			crm->EnsureMinSignaledValue(static_cast<QueueSlotIndex>(qi), val);
 		}
 	}
 
@@ -8583,15 +11824,17 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 		if (batchTraceEnabled) {
 			spdlog::info("RenderGraph::Execute frame={} finalizing CRM", static_cast<unsigned>(context.frameIndex));
 		}
-		crm->Flush(QueueKind::Graphics, { false, 0 });
-		crm->Flush(QueueKind::Compute, { false, 0 });
-		crm->Flush(QueueKind::Copy, { false, 0 });
+		crm->FlushAll();
 		PublishCompiledTrackerStates();
 		crm->EndFrame();
 	}
+	if (m_readbackService) {
+		// Every capture fence of the frame is submitted now.
+		m_readbackService->OnFrameSubmitted();
+	}
 
 	{
-		ZoneScopedN("RenderGraph::Execute::PublishDescriptorRetirementFences");
+		ZoneScopedN("RenderGraph::Execute::PublishRetirementFences");
 		std::vector<DescriptorHeapManager::QueueFenceSnapshotPoint> fenceSnapshot;
 		fenceSnapshot.reserve(slotCount);
 		for (size_t qi = 0; qi < slotCount; ++qi) {
@@ -8605,6 +11848,50 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 			});
 		}
 		DescriptorHeapManager::GetInstance().PublishQueueFenceSnapshot(std::move(fenceSnapshot));
+
+		// Slots without a signal this frame keep their previous fence in the deletion manager.
+		std::vector<DeletionManager::QueueFencePoint> retirementFences(slotCount);
+		for (size_t qi = 0; qi < slotCount; ++qi) {
+			const UINT64 value = lastSignaledPerSlot[qi];
+			if (value != 0 && value != UINT64_MAX) {
+				retirementFences[qi] = DeletionManager::QueueFencePoint{ .timeline = SlotFence(qi), .value = value };
+			}
+		}
+		DeletionManager::GetInstance().PublishRetirementFences(retirementFences);
+		if (m_frameConstantAllocator) {
+			std::vector<FrameConstantAllocator::FencePoint> constantFences(slotCount);
+			for (size_t qi = 0; qi < slotCount; ++qi) {
+				constantFences[qi] = FrameConstantAllocator::FencePoint{ .timeline = retirementFences[qi].timeline, .value = retirementFences[qi].value };
+			}
+			m_frameConstantAllocator->EndFrame(constantFences);
+		}
+		if (m_aliasPoolArbiter) {
+			std::vector<rg::alias::AliasPoolArbiter::FencePoint> aliasFences(slotCount);
+			for (size_t qi = 0; qi < slotCount; ++qi) {
+				aliasFences[qi] = rg::alias::AliasPoolArbiter::FencePoint{ .timeline = retirementFences[qi].timeline, .value = retirementFences[qi].value };
+			}
+			m_aliasPoolArbiter->EndExecute(this, aliasFences);
+		}
+		// Frame boundary: the old heap is retired against the snapshot just published.
+		DescriptorHeapManager::GetInstance().GrowShaderVisibleHeapIfNeeded();
+	}
+
+	if (m_getQueueSchedulingAdaptiveQueueCountEnabled && m_getQueueSchedulingAdaptiveQueueCountEnabled()) {
+		// Input to the next ApplyAdaptiveQueueCount; timestamps only measure work, not the gaps
+		// between a signal and the wait it releases.
+		uint64_t crossQueueWaits = 0;
+		for (const auto& batch : batches) {
+			for (size_t dst = 0; dst < batch.QueueCount(); ++dst) {
+				for (size_t src = 0; src < batch.QueueCount(); ++src) {
+					for (size_t phase = 0; phase < PassBatch::kWaitPhaseCount; ++phase) {
+						if (src != dst && batch.HasQueueWait(static_cast<BatchWaitPhase>(phase), dst, src)) {
+							++crossQueueWaits;
+						}
+					}
+				}
+			}
+		}
+		m_adaptiveQueueCount.lastFrameCrossQueueWaits = crossQueueWaits;
 	}
 
 	{
@@ -8620,6 +11907,7 @@ void RenderGraph::Execute(PassExecutionContext& context) {
 			}
 		}
 	}
+	m_lastCompileTimings.executeMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - executeStart).count();
 	if (batchTraceEnabled) {
 		spdlog::info("RenderGraph::Execute end frame={}", static_cast<unsigned>(context.frameIndex));
 	}
@@ -8952,6 +12240,7 @@ ComputePassBuilder& RenderGraph::GetOrCreateComputePassBuilder(std::string const
 		if (it->second->Kind() != PassBuilderKind::Compute) {
 			throw std::runtime_error("Pass builder name collision (render/compute/copy): " + name);
 		}
+		m_passNamesSeenThisReset.insert(name);
 		m_passBuilderOrder.push_back(it->second.get());
 		return static_cast<ComputePassBuilder&>(*(it->second));
 	}
@@ -8969,6 +12258,7 @@ RenderPassBuilder& RenderGraph::GetOrCreateRenderPassBuilder(std::string const&
 		if (it->second->Kind() != PassBuilderKind::Render) {
 			throw std::runtime_error("Pass builder name collision (render/compute/copy): " + name);
 		}
+		m_passNamesSeenThisReset.insert(name);
 		m_passBuilderOrder.push_back(it->second.get());
 		return static_cast<RenderPassBuilder&>(*(it->second));
 	}
@@ -8987,6 +12277,7 @@ CopyPassBuilder& RenderGraph::GetOrCreateCopyPassBuilder(std::string const& name
 		if (it->second->Kind() != PassBuilderKind::Copy) {
 			throw std::runtime_error("Pass builder name collision (render/compute/copy): " + name);
 		}
+		m_passNamesSeenThisReset.insert(name);
 		m_passBuilderOrder.push_back(it->second.get());
 		return static_cast<CopyPassBuilder&>(*(it->second));
 	}
@@ -9022,7 +12313,143 @@ QueueSlotIndex RenderGraph::CreateQueue(QueueKind kind, const char* name, QueueA
 		if (m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(i))) == kind)
 			++instance;
 	}
-	return m_queueRegistry.Register({ kind, instance }, queue, device, autoAssignmentPolicy, true);
+	const QueueSlotIndex slot = m_queueRegistry.Register({ kind, instance }, queue, device, autoAssignmentPolicy, true);
+	OpenPeerFences(slot);
+	return slot;
+}
+
+QueueSlotIndex RenderGraph::RegisterQueue(QueueKind kind, rhi::Queue queue, QueuePriority priority, QueueAutoAssignmentPolicy autoAssignmentPolicy) {
+	if (!queue) {
+		throw std::runtime_error(fmt::format("Cannot register a null queue for kind {}", static_cast<int>(kind)));
+	}
+	auto device = DeviceManager::GetInstance().GetDevice();
+	uint8_t instance = 0;
+	for (size_t i = 0; i < m_queueRegistry.SlotCount(); ++i) {
+		if (m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(i))) == kind)
+			++instance;
+	}
+	const QueueSlotIndex slot = m_queueRegistry.Register({ kind, instance }, queue, device, autoAssignmentPolicy, false);
+	m_queueRegistry.SetPriority(slot, priority);
+	OpenPeerFences(slot);
+	return slot;
+}
+
+QueueSlotIndex RenderGraph::RegisterAdapterQueue(AdapterIndex adapter, QueueKind kind, rhi::Queue queue, QueuePriority priority) {
+	constexpr auto kNoSlot = static_cast<QueueSlotIndex>(0xFF);
+	if (!queue) {
+		throw std::runtime_error(fmt::format("Cannot register a null queue for kind {} on adapter {}", static_cast<int>(kind), adapter));
+	}
+	auto& deviceManager = DeviceManager::GetInstance();
+	if (adapter >= deviceManager.GetAdapterCount()) {
+		throw std::runtime_error(fmt::format("Cannot register a queue on unknown adapter {}", adapter));
+	}
+	if (adapter == kPrimaryAdapter) {
+		return RegisterQueue(kind, queue, priority, QueueAutoAssignmentPolicy::ManualOnly);
+	}
+	if (!DeviceManager::HasSharedTimelineHook()) {
+		spdlog::warn(
+			"RenderGraph::RegisterAdapterQueue: no queue registered on adapter {}; cross-adapter waits need DeviceManager::SetSharedTimelineHook",
+			adapter);
+		return kNoSlot;
+	}
+
+	// The pool and fence come from the adapter's own device. Every fence is opened on the other
+	// side before the slot exists, so a failed open leaves the registry as it was.
+	auto device = deviceManager.GetAdapterDevice(adapter);
+	rhi::TimelinePtr fence;
+	device.CreateTimeline(fence);
+	std::vector<std::pair<AdapterIndex, rhi::TimelinePtr>> ownPeers;
+	std::vector<std::pair<QueueSlotIndex, rhi::TimelinePtr>> otherPeers;
+	for (size_t i = 0; i < m_queueRegistry.SlotCount(); ++i) {
+		const auto other = static_cast<QueueSlotIndex>(static_cast<uint8_t>(i));
+		const AdapterIndex otherAdapter = m_queueRegistry.GetAdapter(other);
+		if (otherAdapter == adapter) {
+			continue;
+		}
+		bool opened = true;
+		if (std::ranges::none_of(ownPeers, [&](const auto& entry) { return entry.first == otherAdapter; })) {
+			rhi::TimelinePtr peer;
+			opened = deviceManager.OpenTimelineOnDevice(fence.Get(), deviceManager.GetAdapterDevice(otherAdapter), peer);
+			if (opened) {
+				ownPeers.emplace_back(otherAdapter, std::move(peer));
+			}
+		}
+		if (opened && !m_queueRegistry.HasWaitFence(other, adapter)) {
+			rhi::TimelinePtr peer;
+			opened = deviceManager.OpenTimelineOnDevice(m_queueRegistry.GetFence(other), device, peer);
+			if (opened) {
+				otherPeers.emplace_back(other, std::move(peer));
+			}
+		}
+		if (!opened) {
+			spdlog::warn(
+				"RenderGraph::RegisterAdapterQueue: no queue registered on adapter {}; the shared timeline hook could not open queue slot {}'s fence across adapters {} and {}",
+				adapter,
+				ToUnderlying(other),
+				otherAdapter,
+				adapter);
+			return kNoSlot;
+		}
+	}
+
+	uint8_t instance = 0;
+	for (size_t i = 0; i < m_queueRegistry.SlotCount(); ++i) {
+		if (m_queueRegistry.GetKind(static_cast<QueueSlotIndex>(static_cast<uint8_t>(i))) == kind)
+			++instance;
+	}
+	const QueueSlotIndex slot = m_queueRegistry.Register(
+		{ kind, instance }, queue, std::move(fence), m_queueRegistry.CreatePool(device, kind), QueueAutoAssignmentPolicy::ManualOnly, false);
+	m_queueRegistry.SetPriority(slot, priority);
+	m_queueRegistry.SetAdapter(slot, adapter);
+	for (auto& [waitingAdapter, peer] : ownPeers) {
+		m_queueRegistry.SetPeerFence(slot, waitingAdapter, std::move(peer));
+	}
+	for (auto& [other, peer] : otherPeers) {
+		m_queueRegistry.SetPeerFence(other, adapter, std::move(peer));
+	}
+	return slot;
+}
+
+void RenderGraph::OpenPeerFences(QueueSlotIndex slot) {
+	if (!m_queueRegistry.HasSecondaryAdapterSlots()) {
+		return;
+	}
+	auto& deviceManager = DeviceManager::GetInstance();
+	auto openOn = [&](QueueSlotIndex fenceSlot, AdapterIndex waitingAdapter) {
+		if (m_queueRegistry.HasWaitFence(fenceSlot, waitingAdapter)) {
+			return;
+		}
+		rhi::TimelinePtr peer;
+		if (!deviceManager.OpenTimelineOnDevice(m_queueRegistry.GetFence(fenceSlot), deviceManager.GetAdapterDevice(waitingAdapter), peer)) {
+			// Only a wait between these two slots needs this fence; WaitOnSlot reports it if one comes up.
+			spdlog::error(
+				"RenderGraph: the shared timeline hook could not open queue slot {}'s fence (adapter {}) on adapter {}",
+				ToUnderlying(fenceSlot),
+				m_queueRegistry.GetAdapter(fenceSlot),
+				waitingAdapter);
+			return;
+		}
+		m_queueRegistry.SetPeerFence(fenceSlot, waitingAdapter, std::move(peer));
+	};
+
+	const AdapterIndex adapter = m_queueRegistry.GetAdapter(slot);
+	for (size_t i = 0; i < m_queueRegistry.SlotCount(); ++i) {
+		const auto other = static_cast<QueueSlotIndex>(static_cast<uint8_t>(i));
+		const AdapterIndex otherAdapter = m_queueRegistry.GetAdapter(other);
+		if (otherAdapter == adapter) {
+			continue;
+		}
+		openOn(slot, otherAdapter);
+		openOn(other, adapter);
+	}
+}
+
+bool RenderGraph::SupportsPassPredication() {
+	return DeviceManager::HasPredicationHook();
+}
+
+bool RenderGraph::SupportsAliasPoolEviction() {
+	return DeviceManager::HasResidencyHook();
 }
 
 void RenderGraph::SetMinimumAutomaticSchedulingQueues(QueueKind kind, uint8_t count) {
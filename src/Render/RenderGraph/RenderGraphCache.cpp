@@ -2,23 +2,78 @@
 
 #include <span>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <limits>
 #include <numeric>
 #include <optional>
 #include <sstream>
+#include <stdexcept>
 #include <tracy/Tracy.hpp>
 
 #include "Interfaces/IDynamicDeclaredResources.h"
+#include "Interfaces/IStaticDeclaredResources.h"
 #include "Resources/DynamicResource.h"
 #include "Resources/BackedResource.h"
 #include "Resources/ExternalTextureResource.h"
+#include "Managers/Singletons/DebugDumpWriter.h"
+#include "Managers/Singletons/DeviceManager.h"
+#include "Managers/Singletons/ECSManager.h"
+#include "Managers/Singletons/FrameTraceWriter.h"
+#include "Utilities/ORGUtilities.h"
 
 namespace {
 	constexpr size_t QueueIndex(QueueKind queue) noexcept {
 		return static_cast<size_t>(queue);
 	}
 
+	// The default tracking hook creates flecs entities on whichever thread allocates, which is
+	// only safe off the main thread while entity creation is batched. Host hooks are their own.
+	bool BackgroundMaterializationIsThreadSafe() {
+		return !DeviceManager::UsesDefaultTrackingHooks()
+			|| rg::runtime::GetOpenRenderGraphSettings().trackedAllocationEntityBatchingEnabled;
+	}
+
+	// Charges the time between consecutive Enter() calls to the phase entered first, and the
+	// whole lifetime to compileFrameMs. CompileFrame's phases run back to back, so checkpoints
+	// at their boundaries cover the call without nesting.
+	class CompilePhaseClock {
+	public:
+		using Phase = RenderGraph::CompileTimings::Phase;
+
+		explicit CompilePhaseClock(RenderGraph::CompileTimings& timings)
+			: m_timings(timings), m_start(Clock::now()), m_phaseStart(m_start) {
+			m_timings.phaseMs.fill(0.0);
+		}
+		~CompilePhaseClock() {
+			const auto now = Clock::now();
+			Charge(now);
+			m_timings.compileFrameMs = std::chrono::duration<double, std::milli>(now - m_start).count();
+			++m_timings.compileFrameCount;
+		}
+		CompilePhaseClock(const CompilePhaseClock&) = delete;
+		CompilePhaseClock& operator=(const CompilePhaseClock&) = delete;
+
+		void Enter(Phase phase) {
+			const auto now = Clock::now();
+			Charge(now);
+			m_phase = phase;
+			m_phaseStart = now;
+		}
+
+	private:
+		using Clock = std::chrono::steady_clock;
+
+		void Charge(Clock::time_point now) {
+			m_timings.phaseMs[static_cast<size_t>(m_phase)] += std::chrono::duration<double, std::milli>(now - m_phaseStart).count();
+		}
+
+		RenderGraph::CompileTimings& m_timings;
+		Clock::time_point m_start;
+		Clock::time_point m_phaseStart;
+		Phase m_phase = Phase::Reset;
+	};
+
 	Resource* UnwrapDynamicResource(Resource* resource) noexcept {
 		auto* current = resource;
 		while (auto* dynamicResource = dynamic_cast<DynamicResource*>(current)) {
@@ -47,17 +102,11 @@ namespace {
 	}
 
 	uint64_t HashCombine64(uint64_t seed, uint64_t value) noexcept {
-		seed ^= value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
-		return seed;
+		return rg::util::HashMix64(seed, value);
 	}
 
 	uint64_t HashString64(std::string_view value) noexcept {
-		uint64_t hash = 0xcbf29ce484222325ull;
-		for (char c : value) {
-			hash ^= static_cast<uint8_t>(c);
-			hash *= 0x100000001b3ull;
-		}
-		return hash;
+		return rg::util::HashString64(value);
 	}
 
 	uint64_t HashResolverSnapshots(std::span<const ResolverSnapshot> resolverSnapshots) noexcept {
@@ -68,6 +117,17 @@ namespace {
 		return hash;
 	}
 
+	// Changes whenever a static immediate recording may no longer match what the pass would record:
+	// its inputs, its declarations, or the current content of resolvers it declared through.
+	template<class PassAndResources>
+	uint64_t BuildStaticImmediateRecordingKey(const PassAndResources& passAndResources) noexcept {
+		uint64_t key = HashCombine64(passAndResources.pass->CompileKey(), passAndResources.declarationCache.declarationGeneration);
+		for (const auto& snapshot : passAndResources.resolverSnapshots) {
+			key = HashCombine64(key, snapshot.resolver ? snapshot.resolver->GetContentVersion() : 0);
+		}
+		return key;
+	}
+
 	struct CachedHandleValidationInfo {
 		bool containsEphemeralOrAnonymousHandles = false;
 		bool requiresStaleHandleValidation = false;
@@ -99,18 +159,8 @@ namespace {
 		return info;
 	}
 
-	uint64_t HashBoundForDeclaration(uint64_t seed, const Bound& bound) noexcept {
-		seed = HashCombine64(seed, static_cast<uint64_t>(bound.type));
-		seed = HashCombine64(seed, bound.value);
-		return seed;
-	}
-
 	uint64_t HashRangeForDeclaration(uint64_t seed, const RangeSpec& range) noexcept {
-		seed = HashBoundForDeclaration(seed, range.mipLower);
-		seed = HashBoundForDeclaration(seed, range.mipUpper);
-		seed = HashBoundForDeclaration(seed, range.sliceLower);
-		seed = HashBoundForDeclaration(seed, range.sliceUpper);
-		return seed;
+		return rg::util::HashPod64(range, seed);
 	}
 
 	uint64_t HashStateForDeclaration(uint64_t seed, const ResourceState& state) noexcept {
@@ -163,6 +213,7 @@ namespace {
 		key = HashCombine64(key, passAndResources.resources.pinnedQueueSlot
 			? static_cast<uint64_t>(static_cast<uint8_t>(*passAndResources.resources.pinnedQueueSlot)) + 1ull
 			: 0ull);
+		key = HashCombine64(key, passAndResources.resources.latencyCritical ? 1ull : 0ull);
 		key = HashCombine64(key, 0x57a71c5a77cacc01ull);
 		key = HashCombine64(key, passAndResources.declarationCache.declarationGeneration);
 		key = HashCombine64(key, passAndResources.declarationCache.declarationFingerprint);
@@ -200,6 +251,7 @@ namespace {
 		key = HashCombine64(key, passAndResources.resources.pinnedQueueSlot
 			? static_cast<uint64_t>(static_cast<uint8_t>(*passAndResources.resources.pinnedQueueSlot)) + 1ull
 			: 0ull);
+		key = HashCombine64(key, passAndResources.resources.latencyCritical ? 1ull : 0ull);
 		key = HashCombine64(key, passAndResources.declarationCache.declarationFingerprint);
 
 		uint64_t requirementsHash = 0xf12e5e71f12e5e71ull;
@@ -228,11 +280,15 @@ namespace {
 		std::string_view name,
 		PassAndResources& passAndResources)
 	{
-		auto* dynamicInterface = dynamic_cast<IDynamicDeclaredResources*>(passAndResources.pass.get());
+		auto* staticInterface = dynamic_cast<IStaticDeclaredResources*>(passAndResources.pass.get());
+		auto* dynamicInterface = staticInterface ? nullptr : dynamic_cast<IDynamicDeclaredResources*>(passAndResources.pass.get());
 		const CachedHandleValidationInfo handleValidation = AnalyzeCachedHandleValidation(registry, passAndResources.resources);
 		auto& declarationCache = passAndResources.declarationCache;
 		declarationCache.hasDynamicDeclaredResources = dynamicInterface != nullptr;
 		declarationCache.dynamicInterface = dynamicInterface;
+		declarationCache.staticInterface = staticInterface;
+		declarationCache.pipelineInterface = dynamic_cast<IPipelineDependentPass*>(passAndResources.pass.get());
+		declarationCache.staticInvalidationToken = staticInterface ? staticInterface->GetDeclarationInvalidationToken() : 0;
 		declarationCache.containsEphemeralOrAnonymousHandles = handleValidation.containsEphemeralOrAnonymousHandles;
 		declarationCache.requiresStaleHandleValidation = handleValidation.requiresStaleHandleValidation;
 		declarationCache.resolverSnapshotHash = HashResolverSnapshots(passAndResources.resolverSnapshots);
@@ -396,15 +452,6 @@ namespace {
 		return static_cast<RenderGraph*>(user)->RequestResourceHandle(ptr, allowFailure);
 	}
 
-	bool Overlap(SubresourceRange a, SubresourceRange b) {
-		auto aMipEnd = a.firstMip + a.mipCount;
-		auto bMipEnd = b.firstMip + b.mipCount;
-		auto aSliceEnd = a.firstSlice + a.sliceCount;
-		auto bSliceEnd = b.firstSlice + b.sliceCount;
-		return (a.firstMip < bMipEnd && b.firstMip < aMipEnd) &&
-			(a.firstSlice < bSliceEnd && b.firstSlice < aSliceEnd);
-	}
-
 	bool RequirementsConflict(
 		std::span<const ResourceRequirement> retained,
 		std::span<const ResourceRequirement> immediate)
@@ -420,31 +467,24 @@ namespace {
 		}
 
 		for (auto const& retainedRequirement : retained) {
-			auto resource = retainedRequirement.resourceHandleAndRange.resource;
-			const uint64_t resourceID = resource.GetGlobalResourceID();
+			const uint64_t resourceID = retainedRequirement.resourceHandleAndRange.resource.GetGlobalResourceID();
 			auto it = immediateByID.find(resourceID);
 			if (it == immediateByID.end()) {
 				continue;
 			}
 
-			auto retainedRange = ResolveRangeSpec(
-				retainedRequirement.resourceHandleAndRange.range,
-				resource.GetNumMipLevels(),
-				resource.GetArraySize());
+			const SubresourceRange& retainedRange = retainedRequirement.resolvedRange;
 			if (retainedRange.isEmpty()) {
 				continue;
 			}
 
 			for (auto const* immediateRequirement : it->second) {
-				auto immediateRange = ResolveRangeSpec(
-					immediateRequirement->resourceHandleAndRange.range,
-					resource.GetNumMipLevels(),
-					resource.GetArraySize());
+				const SubresourceRange& immediateRange = immediateRequirement->resolvedRange;
 				if (immediateRange.isEmpty()) {
 					continue;
 				}
 
-				if (Overlap(retainedRange, immediateRange) && !(retainedRequirement.state == immediateRequirement->state)) {
+				if (Overlaps(retainedRange, immediateRange) && !(retainedRequirement.state == immediateRequirement->state)) {
 					return true;
 				}
 			}
@@ -465,12 +505,11 @@ void RenderGraph::UpdateRetainedDeclarationCache(PassType type, std::string_view
 	UpdateRetainedDeclarationCacheImpl(_registry, type, name, passAndResources);
 }
 
-void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>& outUsedResourceIDs) {
+void RenderGraph::RebuildFramePassAccessSummaries() {
 	ZoneScopedN("RenderGraph::RebuildFramePassAccessSummaries");
 	ZoneValue(m_framePasses.size());
 	{
 		ZoneScopedN("RGPassAccess::Initialize");
-		outUsedResourceIDs.clear();
 		m_framePassAccessSummaries.clear();
 		m_framePassAccessSummaries.resize(m_framePasses.size());
 	}
@@ -535,6 +574,7 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 				key = HashCombine64(key, passAndResources.resources.pinnedQueueSlot
 					? static_cast<uint64_t>(static_cast<uint8_t>(*passAndResources.resources.pinnedQueueSlot)) + 1ull
 					: 0ull);
+				key = HashCombine64(key, passAndResources.resources.latencyCritical ? 1ull : 0ull);
 				if (retainedDeclarationFullyStatic(passAndResources)) {
 					key = HashCombine64(key, 0x57a71c5a77cacc01ull);
 					key = HashCombine64(key, passAndResources.declarationCache.declarationGeneration);
@@ -594,8 +634,16 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 			pass.pass);
 	};
 
+	enum class PassAccessKeySource : uint8_t {
+		None,
+		StaticPrecomputed,
+		RetainedPrecomputed,
+		Dynamic,
+	};
+
 	struct PassAccessWorkItem {
 		uint64_t cacheKey = 0;
+		PassAccessKeySource keySource = PassAccessKeySource::None;
 		bool cacheable = false;
 		bool cacheHit = false;
 		const CachedFramePassAccessSummary* cachedSummary = nullptr;
@@ -623,64 +671,78 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 	size_t estimatedUsedResourceIDCount = 0;
 	{
 		ZoneScopedN("RGPassAccess::BuildKeysAndLoadCacheHits");
-		uint64_t cacheablePassCount = 0;
-		uint64_t staticPrecomputedKeyCount = 0;
-		uint64_t dynamicKeyBuildCount = 0;
-		uint64_t cacheHitCount = 0;
-		uint64_t cacheMissCount = 0;
-		uint64_t nonCacheablePassCount = 0;
-		uint64_t retainedPrecomputedKeyCount = 0;
-		uint64_t estimatedCacheHitResourceIDs = 0;
-		uint64_t estimatedCacheHitRequirements = 0;
-		uint64_t estimatedCacheHitTransitions = 0;
-		for (size_t passIndex = 0; passIndex < m_framePasses.size(); ++passIndex) {
+		// Keys are built and looked up per pass in parallel (the cache is not modified until
+		// PublishSummariesAndCacheMisses); the counters are summed afterwards in pass order.
+		auto buildKeyAndLookup = [&](size_t passIndex) {
 			auto& workItem = workItems[passIndex];
 			{
 				ZoneScopedN("RGPassAccess::CheckCacheable");
 				workItem.cacheable = passAccessSummaryCacheable(passIndex, m_framePasses[passIndex]);
 			}
-			if (workItem.cacheable) {
-				++cacheablePassCount;
-				{
-					ZoneScopedN("RGPassAccess::TryPrecomputedStaticKey");
-					workItem.cacheKey = tryGetPrecomputedStaticPassAccessKey(m_framePasses[passIndex]);
-				}
-				if (workItem.cacheKey == 0) {
-					ZoneScopedN("RGPassAccess::TryPrecomputedRetainedKey");
-					workItem.cacheKey = tryGetPrecomputedRetainedPassAccessKey(m_framePasses[passIndex]);
-					if (workItem.cacheKey != 0) {
-						++retainedPrecomputedKeyCount;
-					}
-				}
-				else {
-					++staticPrecomputedKeyCount;
-				}
-				if (workItem.cacheKey == 0) {
-					++dynamicKeyBuildCount;
-					ZoneScopedN("RGPassAccess::BuildDynamicAccessKey");
-					workItem.cacheKey = buildPassAccessKey(m_framePasses[passIndex]);
-				}
+			if (!workItem.cacheable) {
+				workItem.cacheKey = 0;
+				return;
+			}
+			{
+				ZoneScopedN("RGPassAccess::TryPrecomputedStaticKey");
+				workItem.cacheKey = tryGetPrecomputedStaticPassAccessKey(m_framePasses[passIndex]);
+			}
+			if (workItem.cacheKey != 0) {
+				workItem.keySource = PassAccessKeySource::StaticPrecomputed;
 			}
 			else {
-				++nonCacheablePassCount;
-				workItem.cacheKey = 0;
+				ZoneScopedN("RGPassAccess::TryPrecomputedRetainedKey");
+				workItem.cacheKey = tryGetPrecomputedRetainedPassAccessKey(m_framePasses[passIndex]);
+				if (workItem.cacheKey != 0) {
+					workItem.keySource = PassAccessKeySource::RetainedPrecomputed;
+				}
+			}
+			if (workItem.cacheKey == 0) {
+				ZoneScopedN("RGPassAccess::BuildDynamicAccessKey");
+				workItem.cacheKey = buildPassAccessKey(m_framePasses[passIndex]);
+				workItem.keySource = PassAccessKeySource::Dynamic;
 			}
-			if (workItem.cacheable) {
+			{
 				ZoneScopedN("RGPassAccess::LookupAccessSummaryCache");
 				auto cacheIt = m_framePassAccessSummaryCache.find(workItem.cacheKey);
 				if (cacheIt != m_framePassAccessSummaryCache.end()) {
 					workItem.cacheHit = true;
 					workItem.cachedSummary = &cacheIt->second;
-					estimatedUsedResourceIDCount += cacheIt->second.usedResourceIDs.size();
-					estimatedCacheHitResourceIDs += cacheIt->second.usedResourceIDs.size();
-					estimatedCacheHitRequirements += cacheIt->second.summary.requirementSummaries.size();
-					estimatedCacheHitTransitions += cacheIt->second.summary.internalTransitionSummaries.size();
-					++cacheHitCount;
-				}
-				else {
-					++cacheMissCount;
 				}
 			}
+		};
+		ParallelForOptional("RGPrecompilePassAccessKeys", workItems.size(), buildKeyAndLookup);
+
+		uint64_t cacheablePassCount = 0;
+		uint64_t staticPrecomputedKeyCount = 0;
+		uint64_t dynamicKeyBuildCount = 0;
+		uint64_t cacheHitCount = 0;
+		uint64_t cacheMissCount = 0;
+		uint64_t nonCacheablePassCount = 0;
+		uint64_t retainedPrecomputedKeyCount = 0;
+		uint64_t estimatedCacheHitResourceIDs = 0;
+		uint64_t estimatedCacheHitRequirements = 0;
+		uint64_t estimatedCacheHitTransitions = 0;
+		for (const auto& workItem : workItems) {
+			if (!workItem.cacheable) {
+				++nonCacheablePassCount;
+				continue;
+			}
+			++cacheablePassCount;
+			staticPrecomputedKeyCount += workItem.keySource == PassAccessKeySource::StaticPrecomputed ? 1u : 0u;
+			retainedPrecomputedKeyCount += workItem.keySource == PassAccessKeySource::RetainedPrecomputed ? 1u : 0u;
+			dynamicKeyBuildCount += workItem.keySource == PassAccessKeySource::Dynamic ? 1u : 0u;
+			if (workItem.cacheHit) {
+				const auto& cached = *workItem.cachedSummary;
+				estimatedUsedResourceIDCount += cached.usedResourceIDs.size();
+				estimatedCacheHitResourceIDs += cached.usedResourceIDs.size();
+				estimatedCacheHitRequirements += cached.summary.requirementSummaries.size();
+				estimatedCacheHitTransitions += cached.summary.internalTransitionSummaries.size();
+				++cacheHitCount;
+			}
+			else {
+				++cacheMissCount;
+			}
 		}
 		ZoneValue(cacheablePassCount);
 		TracyPlot("RGPassAccess.CacheablePasses", static_cast<int64_t>(cacheablePassCount));
@@ -723,18 +785,21 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 			summary.preferredQueueKind = passResources.preferredQueueKind;
 			summary.queueAssignmentPolicy = passResources.queueAssignmentPolicy;
 			summary.pinnedQueueSlot = passResources.pinnedQueueSlot;
+			summary.latencyCritical = passResources.latencyCritical;
 		}
 		else if (pass.type == PassType::Compute) {
 			const auto& passResources = std::get<ComputePassAndResources>(pass.pass).resources;
 			summary.preferredQueueKind = passResources.preferredQueueKind;
 			summary.queueAssignmentPolicy = passResources.queueAssignmentPolicy;
 			summary.pinnedQueueSlot = passResources.pinnedQueueSlot;
+			summary.latencyCritical = passResources.latencyCritical;
 		}
 		else if (pass.type == PassType::Copy) {
 			const auto& passResources = std::get<CopyPassAndResources>(pass.pass).resources;
 			summary.preferredQueueKind = passResources.preferredQueueKind;
 			summary.queueAssignmentPolicy = passResources.queueAssignmentPolicy;
 			summary.pinnedQueueSlot = passResources.pinnedQueueSlot;
+			summary.latencyCritical = passResources.latencyCritical;
 		}
 
 		if (!view.reqs.empty()) {
@@ -753,6 +818,7 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 					.state = req.state,
 					.isUAV = isUAV,
 					.isWrite = isWrite,
+					.fullOverwrite = req.fullOverwrite,
 				});
 			}
 		}
@@ -814,12 +880,6 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 			std::unique(flattenedResourceIDs.begin(), flattenedResourceIDs.end()),
 			flattenedResourceIDs.end());
 
-		outUsedResourceIDs.clear();
-		outUsedResourceIDs.reserve(flattenedResourceIDs.size());
-		for (uint64_t resourceID : flattenedResourceIDs) {
-			outUsedResourceIDs.insert(resourceID);
-		}
-
 		{
 			ZoneScopedN("RGPassAccess::BuildDAGResourceIndex");
 			m_frameDAGResourceIndexByID.clear();
@@ -835,21 +895,30 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 	std::vector<uint8_t> resourcesWrittenThisFrame(m_frameDAGResourceCount, 0);
 	{
 		ZoneScopedN("RGPassAccess::MarkWrittenDAGResources");
-		for (const auto& summary : m_framePassAccessSummaries) {
-			for (const auto& req : summary.requirementSummaries) {
-				if (!req.isWrite) {
-					continue;
-				}
-				auto dagResourceIt = m_frameDAGResourceIndexByID.find(req.resourceID);
+		// Lookups run per pass in parallel; the flags are set afterwards so no two threads store
+		// to the same byte.
+		std::vector<std::vector<uint32_t>> writtenDAGIndicesByPass(m_framePassAccessSummaries.size());
+		ParallelForOptional("RGMarkWrittenDAGResources", m_framePassAccessSummaries.size(), [&](size_t passIndex) {
+			const auto& summary = m_framePassAccessSummaries[passIndex];
+			auto& written = writtenDAGIndicesByPass[passIndex];
+			auto markWritten = [&](uint64_t resourceID) {
+				auto dagResourceIt = m_frameDAGResourceIndexByID.find(resourceID);
 				if (dagResourceIt != m_frameDAGResourceIndexByID.end() && dagResourceIt->second < resourcesWrittenThisFrame.size()) {
-					resourcesWrittenThisFrame[dagResourceIt->second] = 1;
+					written.push_back(static_cast<uint32_t>(dagResourceIt->second));
+				}
+			};
+			for (const auto& req : summary.requirementSummaries) {
+				if (req.isWrite) {
+					markWritten(req.resourceID);
 				}
 			}
 			for (const auto& transition : summary.internalTransitionSummaries) {
-				auto dagResourceIt = m_frameDAGResourceIndexByID.find(transition.resourceID);
-				if (dagResourceIt != m_frameDAGResourceIndexByID.end() && dagResourceIt->second < resourcesWrittenThisFrame.size()) {
-					resourcesWrittenThisFrame[dagResourceIt->second] = 1;
-				}
+				markWritten(transition.resourceID);
+			}
+		});
+		for (const auto& written : writtenDAGIndicesByPass) {
+			for (uint32_t dagResourceIndex : written) {
+				resourcesWrittenThisFrame[dagResourceIndex] = 1;
 			}
 		}
 	}
@@ -930,7 +999,420 @@ void RenderGraph::RebuildFramePassAccessSummaries(std::unordered_set<uint64_t>&
 	}
 }
 
-void RenderGraph::RebuildSchedulingEquivalentIDCache(const std::unordered_set<uint64_t>& resourceIDs) {
+namespace {
+	void AppendCullingRootResourceIDs(const Resource& resource, std::vector<uint64_t>& out) {
+		out.push_back(resource.GetGlobalResourceID());
+		// Pass declarations refer to dynamic resources through their wrapper ID.
+		if (const auto* dynamicResource = dynamic_cast<const DynamicResource*>(&resource)) {
+			out.push_back(dynamicResource->GetDynamicWrapperGlobalResourceID());
+		}
+	}
+}
+
+void RenderGraph::AddCullingRootResource(const Resource& resource) {
+	std::vector<uint64_t> resourceIDs;
+	AppendCullingRootResourceIDs(resource, resourceIDs);
+	m_cullingRootResourceIDs.insert(resourceIDs.begin(), resourceIDs.end());
+}
+
+void RenderGraph::RemoveCullingRootResource(const Resource& resource) {
+	std::vector<uint64_t> resourceIDs;
+	AppendCullingRootResourceIDs(resource, resourceIDs);
+	for (uint64_t resourceID : resourceIDs) {
+		m_cullingRootResourceIDs.erase(resourceID);
+	}
+}
+
+size_t RenderGraph::CullUnreachableFramePasses(std::vector<std::pair<std::string, std::string>>& explicitAfterByName) {
+	ZoneScopedN("RenderGraph::CullUnreachableFramePasses");
+	m_lastCulledPassNames.clear();
+	const size_t passCount = m_framePasses.size();
+	if (passCount == 0 || m_framePassAccessSummaries.size() != passCount) {
+		return 0;
+	}
+
+	std::vector<uint8_t> isRootResource(m_frameDAGResourceCount, 0);
+	for (uint64_t resourceID : m_cullingRootResourceIDs) {
+		auto it = m_frameDAGResourceIndexByID.find(resourceID);
+		if (it != m_frameDAGResourceIndexByID.end() && it->second < isRootResource.size()) {
+			isRootResource[it->second] = 1;
+		}
+	}
+
+	auto passPresents = [](const AnyPassAndResources& pr) {
+		const auto* renderPass = std::get_if<RenderPassAndResources>(&pr.pass);
+		return renderPass && !renderPass->resources.presentResources.empty();
+	};
+
+	std::vector<uint8_t> isRootPass(passCount, 0);
+	for (size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		bool writes = false;
+		bool writesRoot = false;
+		for (const auto& access : m_framePassAccessSummaries[passIndex].dagAccesses) {
+			if (access.kind != AccessKind::Write) {
+				continue;
+			}
+			writes = true;
+			writesRoot = writesRoot || (access.resourceIndex < isRootResource.size() && isRootResource[access.resourceIndex]);
+		}
+		// A pass without tracked writes only has effects the graph cannot see (readbacks,
+		// CPU-visible results), so it is always kept.
+		isRootPass[passIndex] = (!writes || writesRoot || passPresents(m_framePasses[passIndex])) ? 1 : 0;
+	}
+
+	// Explicit After() constraints stand in for dependencies the declarations do not show,
+	// so the anchor of a live pass is kept alive too.
+	std::vector<std::vector<size_t>> anchorsByPass(passCount);
+	if (!explicitAfterByName.empty()) {
+		std::unordered_map<std::string_view, size_t> passIndexByName;
+		passIndexByName.reserve(passCount);
+		for (size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+			if (!m_framePasses[passIndex].name.empty()) {
+				passIndexByName[m_framePasses[passIndex].name] = passIndex;
+			}
+		}
+		for (const auto& [anchorName, passName] : explicitAfterByName) {
+			auto anchorIt = passIndexByName.find(anchorName);
+			auto passIt = passIndexByName.find(passName);
+			if (anchorIt != passIndexByName.end() && passIt != passIndexByName.end()) {
+				anchorsByPass[passIt->second].push_back(anchorIt->second);
+			}
+		}
+	}
+
+	// Walk passes backwards, keeping a pass if it is a root or writes something a kept later
+	// pass touches. Anchors that come after their dependent pass need another sweep.
+	std::vector<uint8_t> live(passCount, 0);
+	std::vector<uint8_t> forced(passCount, 0);
+	std::vector<uint8_t> needed(m_frameDAGResourceCount, 0);
+	bool sweepAgain = true;
+	while (sweepAgain) {
+		sweepAgain = false;
+		std::fill(needed.begin(), needed.end(), 0);
+		for (size_t passIndex = passCount; passIndex-- > 0;) {
+			const auto& accesses = m_framePassAccessSummaries[passIndex].dagAccesses;
+			bool isLive = isRootPass[passIndex] || forced[passIndex];
+			for (size_t i = 0; !isLive && i < accesses.size(); ++i) {
+				isLive = accesses[i].kind == AccessKind::Write
+					&& accesses[i].resourceIndex < needed.size()
+					&& needed[accesses[i].resourceIndex];
+			}
+			if (!isLive) {
+				continue;
+			}
+			live[passIndex] = 1;
+			// Writes count as uses too: a read-modify-write or partial write still needs its producer.
+			for (const auto& access : accesses) {
+				if (access.resourceIndex < needed.size()) {
+					needed[access.resourceIndex] = 1;
+				}
+			}
+			for (size_t anchorIndex : anchorsByPass[passIndex]) {
+				if (forced[anchorIndex]) {
+					continue;
+				}
+				forced[anchorIndex] = 1;
+				sweepAgain = sweepAgain || (anchorIndex > passIndex && !live[anchorIndex]);
+			}
+		}
+	}
+
+	const size_t liveCount = static_cast<size_t>(std::count(live.begin(), live.end(), uint8_t{ 1 }));
+	TracyPlot("RG.CulledPasses", static_cast<int64_t>(passCount - liveCount));
+	if (liveCount == passCount) {
+		return 0;
+	}
+
+	return RemoveFramePasses(live, explicitAfterByName, m_lastCulledPassNames);
+}
+
+size_t RenderGraph::RemoveFramePasses(
+	const std::vector<uint8_t>& keep,
+	std::vector<std::pair<std::string, std::string>>& explicitAfterByName,
+	std::vector<std::string>& outRemovedNames) {
+	const size_t passCount = m_framePasses.size();
+	std::unordered_set<std::string> removedNames;
+	size_t writeIndex = 0;
+	for (size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		if (!keep[passIndex]) {
+			const auto& name = m_framePasses[passIndex].name;
+			outRemovedNames.push_back(name.empty() ? ("<unnamed #" + std::to_string(passIndex) + ">") : name);
+			if (!name.empty()) {
+				removedNames.insert(name);
+			}
+			continue;
+		}
+		if (writeIndex != passIndex) {
+			m_framePasses[writeIndex] = std::move(m_framePasses[passIndex]);
+			m_framePassIsFrameExtension[writeIndex] = m_framePassIsFrameExtension[passIndex];
+			m_framePassDeclarationRefreshedThisFrame[writeIndex] = m_framePassDeclarationRefreshedThisFrame[passIndex];
+			if (passIndex < m_framePassVolatile.size()) {
+				m_framePassVolatile[writeIndex] = m_framePassVolatile[passIndex];
+			}
+		}
+		++writeIndex;
+	}
+	m_framePasses.resize(writeIndex);
+	m_framePassIsFrameExtension.resize(writeIndex);
+	m_framePassDeclarationRefreshedThisFrame.resize(writeIndex);
+	m_framePassVolatile.resize(std::min(m_framePassVolatile.size(), writeIndex));
+
+	// Constraints on removed passes would otherwise be reported as dangling every frame.
+	std::erase_if(explicitAfterByName, [&](const auto& edge) {
+		return removedNames.contains(edge.first) || removedNames.contains(edge.second);
+	});
+	return passCount - writeIndex;
+}
+
+void RenderGraph::RequestBackgroundMaterialization(const std::shared_ptr<Resource>& resource, PendingMaterializationPolicy policy) {
+	if (!resource) {
+		return;
+	}
+	m_backgroundMaterializationRequests[resource->GetGlobalResourceID()] = BackgroundMaterializationRequest{ resource, policy };
+}
+
+void RenderGraph::CancelBackgroundMaterialization(const Resource& resource) {
+	// A job already handed to the worker still runs; the resource is simply treated as ready after.
+	m_backgroundMaterializationRequests.erase(resource.GetGlobalResourceID());
+}
+
+bool RenderGraph::IsBackgroundMaterializationInFlight(uint64_t backedResourceID) {
+	std::scoped_lock lock(m_backgroundMaterializationMutex);
+	return m_backgroundMaterializationInFlight.contains(backedResourceID);
+}
+
+void RenderGraph::BackgroundMaterializationWorkerMain() {
+	tracy::SetThreadName("ORG Background Materialize");
+	std::unique_lock lock(m_backgroundMaterializationMutex);
+	while (true) {
+		m_backgroundMaterializationCv.wait(lock, [this] {
+			return m_backgroundMaterializationQuit || !m_backgroundMaterializationQueue.empty();
+		});
+		if (m_backgroundMaterializationQuit) {
+			return;
+		}
+		auto [id, resource] = std::move(m_backgroundMaterializationQueue.front());
+		m_backgroundMaterializationQueue.pop_front();
+		lock.unlock();
+
+		bool failed = false;
+		{
+			ZoneScopedN("RenderGraph::BackgroundMaterialize");
+			try {
+				if (!BackgroundMaterializationIsThreadSafe()) {
+					// Batching was turned off after this job was queued; the frame materializes it.
+					throw std::logic_error("tracked allocation entity batching is off");
+				}
+				if (auto* texture = dynamic_cast<PixelBuffer*>(resource.get())) {
+					texture->Materialize();
+				}
+				else if (auto* buffer = dynamic_cast<BufferBase*>(resource.get())) {
+					buffer->Materialize();
+				}
+			}
+			catch (const std::exception& e) {
+				spdlog::error("RG background materialize failed: id={} name='{}': {}", id, resource->GetName(), e.what());
+				failed = true;
+			}
+		}
+		resource.reset();
+
+		lock.lock();
+		m_backgroundMaterializationInFlight.erase(id);
+		if (failed) {
+			m_backgroundMaterializationFailed.insert(id);
+		}
+		m_backgroundMaterializationCv.notify_all();
+	}
+}
+
+void RenderGraph::StopBackgroundMaterializationWorker() {
+	{
+		std::scoped_lock lock(m_backgroundMaterializationMutex);
+		m_backgroundMaterializationQuit = true;
+		m_backgroundMaterializationQueue.clear();
+	}
+	m_backgroundMaterializationCv.notify_all();
+	if (m_backgroundMaterializationThread.joinable()) {
+		m_backgroundMaterializationThread.join();
+	}
+	std::scoped_lock lock(m_backgroundMaterializationMutex);
+	m_backgroundMaterializationInFlight.clear();
+	m_backgroundMaterializationFailed.clear();
+	m_backgroundMaterializationQuit = false;
+	m_backgroundMaterializationRequests.clear();
+	m_lastPendingMaterializationSkippedPassNames.clear();
+}
+
+size_t RenderGraph::SkipPassesOnPendingMaterializations(std::vector<std::pair<std::string, std::string>>& explicitAfterByName) {
+	m_lastPendingMaterializationSkippedPassNames.clear();
+	if (m_backgroundMaterializationRequests.empty()
+		|| !m_getBackgroundMaterializationEnabled || !m_getBackgroundMaterializationEnabled()) {
+		return 0;
+	}
+	if (!BackgroundMaterializationIsThreadSafe()) {
+		static std::once_flag warnOnce;
+		std::call_once(warnOnce, [] {
+			spdlog::warn("RenderGraph: background materialization needs trackedAllocationEntityBatchingEnabled "
+				"with the default tracking hooks; requested resources materialize in the frame instead.");
+		});
+		return 0;
+	}
+	ZoneScopedN("RenderGraph::SkipPassesOnPendingMaterializations");
+
+	std::vector<uint8_t> isPendingResource(m_frameDAGResourceCount, 0);
+	bool anyPendingUsed = false;
+	std::unique_lock lock(m_backgroundMaterializationMutex);
+	for (auto it = m_backgroundMaterializationRequests.begin(); it != m_backgroundMaterializationRequests.end();) {
+		auto requested = it->second.resource.lock();
+		Resource* backed = requested ? UnwrapDynamicResource(requested.get()) : nullptr;
+		if (!backed) {
+			it = m_backgroundMaterializationRequests.erase(it);
+			continue;
+		}
+		const uint64_t backedID = backed->GetGlobalResourceID();
+		if (m_backgroundMaterializationFailed.erase(backedID) > 0) {
+			// Leave it to the frame, which materializes synchronously and surfaces the error.
+			it = m_backgroundMaterializationRequests.erase(it);
+			continue;
+		}
+
+		auto* texture = dynamic_cast<PixelBuffer*>(backed);
+		auto* buffer = texture ? nullptr : dynamic_cast<BufferBase*>(backed);
+		const bool mayAlias = texture ? texture->GetDescription().allowAlias : (buffer && buffer->IsAliasingAllowed());
+		if ((!texture && !buffer) || mayAlias) {
+			++it;
+			continue;
+		}
+		if (!m_backgroundMaterializationInFlight.contains(backedID)) {
+			if (texture ? texture->IsMaterialized() : buffer->IsMaterialized()) {
+				++it;
+				continue;
+			}
+			if (!m_backgroundMaterializationThread.joinable()) {
+				m_backgroundMaterializationThread = std::thread([this] { BackgroundMaterializationWorkerMain(); });
+			}
+			m_backgroundMaterializationInFlight.insert(backedID);
+			m_backgroundMaterializationQueue.emplace_back(backedID, std::shared_ptr<Resource>(requested, backed));
+			m_backgroundMaterializationCv.notify_all();
+		}
+
+		std::vector<uint64_t> declaredIDs;
+		AppendCullingRootResourceIDs(*requested, declaredIDs);
+		declaredIDs.push_back(backedID);
+		std::vector<size_t> dagIndices;
+		for (uint64_t declaredID : declaredIDs) {
+			auto itIndex = m_frameDAGResourceIndexByID.find(declaredID);
+			if (itIndex != m_frameDAGResourceIndexByID.end() && itIndex->second < isPendingResource.size()) {
+				dagIndices.push_back(itIndex->second);
+			}
+		}
+		if (!dagIndices.empty() && it->second.policy == PendingMaterializationPolicy::Wait) {
+			ZoneScopedN("RenderGraph::WaitForBackgroundMaterialization");
+			m_backgroundMaterializationCv.wait(lock, [&] { return !m_backgroundMaterializationInFlight.contains(backedID); });
+			++it;
+			continue;
+		}
+		for (size_t dagIndex : dagIndices) {
+			isPendingResource[dagIndex] = 1;
+			anyPendingUsed = true;
+		}
+		++it;
+	}
+	lock.unlock();
+	if (!anyPendingUsed) {
+		return 0;
+	}
+
+	// Only direct users are dropped; a later pass reading what a skipped pass would have written
+	// sees the previous contents, which is the fallback this policy accepts.
+	const size_t passCount = m_framePasses.size();
+	std::vector<uint8_t> keep(passCount, 1);
+	for (size_t passIndex = 0; passIndex < passCount && passIndex < m_framePassAccessSummaries.size(); ++passIndex) {
+		for (const auto& access : m_framePassAccessSummaries[passIndex].dagAccesses) {
+			if (access.resourceIndex < isPendingResource.size() && isPendingResource[access.resourceIndex]) {
+				keep[passIndex] = 0;
+				break;
+			}
+		}
+	}
+	const size_t skipped = RemoveFramePasses(keep, explicitAfterByName, m_lastPendingMaterializationSkippedPassNames);
+	TracyPlot("RG.PendingMaterializationSkippedPasses", static_cast<int64_t>(skipped));
+	return skipped;
+}
+
+size_t RenderGraph::SkipPassesInDisabledFeatureDomains(std::vector<std::pair<std::string, std::string>>& explicitAfterByName) {
+	m_lastFeatureDomainSkippedPassNames.clear();
+	const auto& registry = FeatureDomainRegistry::Get();
+	if (!registry.HasDisabledDomains()) {
+		return 0;
+	}
+	ZoneScopedN("RenderGraph::SkipPassesInDisabledFeatureDomains");
+
+	const size_t passCount = m_framePasses.size();
+	std::vector<uint8_t> keep(passCount, 1);
+	bool anySkipped = false;
+	for (size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		std::visit([&](const auto& p) {
+			if constexpr (requires { p.resources.memberFeatureDomains; }) {
+				for (const auto& domain : p.resources.memberFeatureDomains) {
+					if (!registry.IsDomainEnabled(domain)) {
+						keep[passIndex] = 0;
+						anySkipped = true;
+						return;
+					}
+				}
+			}
+		}, m_framePasses[passIndex].pass);
+	}
+	if (!anySkipped) {
+		return 0;
+	}
+	const size_t skipped = RemoveFramePasses(keep, explicitAfterByName, m_lastFeatureDomainSkippedPassNames);
+	TracyPlot("RG.FeatureDomainSkippedPasses", static_cast<int64_t>(skipped));
+	return skipped;
+}
+
+size_t RenderGraph::SkipPassesWithPendingPipelines(std::vector<std::pair<std::string, std::string>>& explicitAfterByName) {
+	m_lastPipelinePendingSkippedPassNames.clear();
+	ZoneScopedN("RenderGraph::SkipPassesWithPendingPipelines");
+
+	const size_t passCount = m_framePasses.size();
+	std::vector<uint8_t> keep(passCount, 1);
+	bool anySkipped = false;
+	for (size_t passIndex = 0; passIndex < passCount; ++passIndex) {
+		std::visit([&](const auto& p) {
+			if constexpr (requires { p.declarationCache.pipelineInterface; }) {
+				const auto* pipelineInterface = p.declarationCache.pipelineInterface;
+				if (!pipelineInterface) {
+					return;
+				}
+				const auto readiness = pipelineInterface->GetPipelineReadiness();
+				const auto& name = m_framePasses[passIndex].name;
+				if (readiness == rg::runtime::PipelineReadiness::Ready) {
+					if (!m_pipelineFailureWarnedPassNames.empty()) {
+						m_pipelineFailureWarnedPassNames.erase(name);
+					}
+					return;
+				}
+				keep[passIndex] = 0;
+				anySkipped = true;
+				// A failed pipeline stays skipped until the pass requests it again; say so once.
+				if (readiness == rg::runtime::PipelineReadiness::Failed && m_pipelineFailureWarnedPassNames.insert(name).second) {
+					spdlog::warn("RenderGraph: skipping pass '{}', its pipeline failed to compile", name);
+				}
+			}
+		}, m_framePasses[passIndex].pass);
+	}
+	if (!anySkipped) {
+		return 0;
+	}
+	const size_t skipped = RemoveFramePasses(keep, explicitAfterByName, m_lastPipelinePendingSkippedPassNames);
+	TracyPlot("RG.PipelinePendingSkippedPasses", static_cast<int64_t>(skipped));
+	return skipped;
+}
+
+void RenderGraph::RebuildSchedulingEquivalentIDCache(std::span<const uint64_t> resourceIDs) {
 	ZoneScopedN("RenderGraph::RebuildSchedulingEquivalentIDCache");
 	m_schedulingEquivalentIDsCache.clear();
 	m_schedulingEquivalentIDsCache.reserve(resourceIDs.size());
@@ -951,6 +1433,51 @@ const std::vector<uint64_t>& RenderGraph::GetSchedulingEquivalentIDsCached(uint6
 	return insertedIt->second;
 }
 
+void RenderGraph::UpdatePassVolatility() {
+	m_framePassVolatile.assign(m_framePasses.size(), 0);
+	const bool enabled = m_getRenderGraphRegionAdaptiveBoundariesEnabled && m_getRenderGraphRegionAdaptiveBoundariesEnabled();
+	if (!enabled) {
+		m_passVolatilityByName.clear();
+		return;
+	}
+
+	const uint32_t windowFrames = std::max(1u,
+		m_getRenderGraphRegionVolatilityWindowFrames ? m_getRenderGraphRegionVolatilityWindowFrames() : 32u);
+	const float threshold = m_getRenderGraphRegionVolatilityThreshold ? m_getRenderGraphRegionVolatilityThreshold() : 0.2f;
+	const float weight = 1.0f / static_cast<float>(windowFrames);
+	const uint64_t frameSerial = ++m_passVolatilityFrameSerial;
+	for (size_t passIndex = 0; passIndex < m_framePasses.size(); ++passIndex) {
+		const auto& passName = m_framePasses[passIndex].name;
+		if (passName.empty()) {
+			continue;
+		}
+		auto& volatility = m_passVolatilityByName[passName];
+		const float changed = m_framePassDeclarationRefreshedThisFrame[passIndex] != 0 ? 1.0f : 0.0f;
+		// Frames the pass was absent from count as unchanged.
+		if (volatility.lastSeenFrame != 0 && frameSerial - volatility.lastSeenFrame > 1) {
+			const float missed = static_cast<float>(std::min<uint64_t>(frameSerial - volatility.lastSeenFrame - 1, windowFrames));
+			volatility.score *= std::pow(1.0f - weight, missed);
+		}
+		volatility.score += (changed - volatility.score) * weight;
+		volatility.lastSeenFrame = frameSerial;
+		// Hysteresis keeps the boundaries, and with them the cached segments, from flapping.
+		if (volatility.isVolatile) {
+			volatility.isVolatile = volatility.score >= threshold * 0.5f;
+		}
+		else {
+			volatility.isVolatile = volatility.score >= threshold;
+		}
+		m_framePassVolatile[passIndex] = volatility.isVolatile ? 1 : 0;
+	}
+
+	if (m_passVolatilityByName.size() > 2 * m_framePasses.size() + 64) {
+		const uint64_t staleAfter = 4ull * windowFrames;
+		std::erase_if(m_passVolatilityByName, [&](const auto& entry) {
+			return frameSerial - entry.second.lastSeenFrame > staleAfter;
+		});
+	}
+}
+
 void RenderGraph::ExtractScheduleRegionsFromAuthoritativeCompile(
 	const std::vector<Node>& nodes,
 	const std::vector<AnyPassAndResources>& framePasses,
@@ -1032,6 +1559,7 @@ void RenderGraph::ExtractScheduleRegionsFromAuthoritativeCompile(
 		case RegionRejectReason::GraphicsFallbackTransition: return "graphics_fallback_transition";
 		case RegionRejectReason::UnsupportedSubresourceState: return "unsupported_subresource_state";
 		case RegionRejectReason::BatchHazardBoundary: return "batch_hazard_boundary";
+		case RegionRejectReason::VolatilePass: return "volatile_pass";
 		case RegionRejectReason::Count: return "accepted";
 		default: return "unknown";
 		}
@@ -1179,6 +1707,10 @@ void RenderGraph::ExtractScheduleRegionsFromAuthoritativeCompile(
 			outReason = RegionRejectReason::FrameExtensionPass;
 			return true;
 		}
+		if (passIndex < m_framePassVolatile.size() && m_framePassVolatile[passIndex] != 0) {
+			outReason = RegionRejectReason::VolatilePass;
+			return true;
+		}
 		return false;
 	};
 
@@ -3484,7 +4016,7 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 	(void)authoritativeTrace;
 
 	auto openNewBatch = [&]() -> PassBatch {
-		PassBatch batch(queueCount);
+		PassBatch batch = AcquirePassBatch(queueCount);
 		batch.passBatchTrackersByResourceIndex.assign(m_frameSchedulingResourceCount, nullptr);
 		for (size_t queueIndex = 0; queueIndex < queueCount; ++queueIndex) {
 			batch.SetQueueSignalFenceValue(BatchSignalPhase::AfterTransitions, queueIndex, GetNextQueueFenceValue(queueIndex));
@@ -3519,8 +4051,8 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 		return nodeIt->second;
 	};
 
-	std::unordered_set<uint64_t> scratchTransitioned;
-	std::unordered_set<size_t> scratchFallback;
+	DenseResourceIndexSet scratchTransitioned(m_frameSchedulingResourceCount);
+	DenseResourceIndexSet scratchFallback(m_frameSchedulingResourceCount);
 	std::vector<ResourceTransition> scratchTransitions;
 	std::vector<ResourceTransition> ignoredTransitions;
 	std::vector<uint64_t> latestSignalFenceByQueue(queueCount, 0);
@@ -3556,8 +4088,8 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 		}
 	};
 
-	batches.clear();
-	batches.emplace_back(queueCount);
+	RecyclePassBatches();
+	batches.push_back(AcquirePassBatch(queueCount));
 	m_schedulingDecisionTrace.clear();
 	m_transitionPlacementCandidates.clear();
 	m_transitionPlacementStats = {};
@@ -3638,8 +4170,8 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 			compileResourceState.fastState.state = state;
 		}
 		else {
-			compileResourceState.fastState.valid = false;
-			compileResourceState.fastState.wholeResourceOnly = false;
+			compileResourceState.fastState.valid = TryGetWholeResourceTrackerState(compileResourceState.tracker, compileResourceState.fastState.state);
+			compileResourceState.fastState.wholeResourceOnly = compileResourceState.fastState.valid;
 		}
 		return &compileResourceState.tracker;
 	};
@@ -3654,6 +4186,18 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 					for (const auto& wait : pass.resources.externalWaitsBeforeTransitions) {
 						batch.AddExternalWaitBeforeTransitions(queueSlot, wait);
 					}
+					if (!m_frameExternalReadyPoints.empty()) {
+						ForEachFrameRequirement(pass.resources, [&](const ResourceRequirement& requirement) {
+							auto resourceIndex = TryGetFrameSchedulingResourceIndex(
+								requirement.resourceHandleAndRange.resource.GetGlobalResourceID());
+							if (!resourceIndex) {
+								return;
+							}
+							if (const auto* readyPoint = FindFrameExternalReadyPoint(*resourceIndex)) {
+								batch.AddExternalWaitBeforeTransitions(queueSlot, *readyPoint);
+							}
+						});
+					}
 					appended = true;
 				}
 			},
@@ -3702,8 +4246,8 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 	auto ensureSegmentInputs = [&](const CachedReplaySegment& segment) -> bool {
 		ZoneScopedN("RenderGraph::Replay::EnsureSegmentInputs");
 		pendingSegmentInputWaits.clear();
-		scratchTransitioned.clear();
-		scratchFallback.clear();
+		scratchTransitioned.Clear();
+		scratchFallback.Clear();
 		if (segment.contract.inputRequirements.empty()) {
 			return true;
 		}
@@ -4000,6 +4544,7 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 					.candidateChecks = 0,
 					.isNewBatchNeededChecks = 0,
 					.fallbackCommit = false,
+					.adaptivePlacement = node.adaptivePlacement,
 				});
 				if (!appendPassPointer(batch, queuedPass.queueSlot, framePasses[passIndex])) {
 					return recomputeTemplateBatch(batchTemplate, "template_pass_empty_variant");
@@ -4793,7 +5338,7 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 						score += 2.0;
 					}
 					score -= 0.25 * double(currentBatch.Passes(nodeQueueSlot).size());
-					score += 0.05 * double(n.criticality);
+					score += CriticalPathSchedulingScore(n, nodeQueueSlot);
 
 					if (framePasses[n.passIndex].type == PassType::Compute
 						&& n.queueAssignmentPolicy == QueueAssignmentPolicy::Automatic) {
@@ -4911,6 +5456,7 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 				.candidateChecks = candidateChecks,
 				.isNewBatchNeededChecks = isNewBatchNeededChecks,
 				.fallbackCommit = true,
+				.adaptivePlacement = chosen.adaptivePlacement,
 			});
 			closedBatchBeforeNextCommit = false;
 			CommitPassToBatch(
@@ -5008,6 +5554,9 @@ RenderGraph::ReplaySegmentVerificationReport RenderGraph::ReplayCurrentFrameSegm
 
 void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHostExecutionData* hostData) {
 	ZoneScopedN("RenderGraph::CompileFrame");
+	FrameTraceScope frameTraceScope("CompileFrame");
+	CompilePhaseClock phaseClock(m_lastCompileTimings);
+	m_lastCompileMetrics = {};
 	const bool traceLifecycle = m_getRenderGraphBatchTraceEnabled && m_getRenderGraphBatchTraceEnabled();
 	auto traceCompileStep = [&](const char* step) {
 		if (traceLifecycle) {
@@ -5032,11 +5581,59 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		m_aliasingSubsystem.ResetPerFrameState(*this);
 	}
 
+	// IStaticDeclaredResources: the retained declaration holds while the pass's token, its versioned
+	// resolvers and the generations of every registry handle it declared still match.
+	auto staticDeclarationNeedsRefresh = [&](auto& p) -> bool {
+		ZoneScopedN("RenderGraph::CompileFrame::RefreshRetainedDeclarations::NeedsRefresh::StaticDeclaration");
+		auto& stats = m_staticDeclarationStatsByPassName[p.name];
+		const auto& cache = p.declarationCache;
+		if (cache.staticInterface->GetDeclarationInvalidationToken() != cache.staticInvalidationToken) {
+			++stats.misses;
+			++m_lastCompileMetrics.staticDeclarationMisses;
+			++stats.invalidationTokenMisses;
+			return true;
+		}
+		for (const auto& snap : p.resolverSnapshots) {
+			const uint64_t cv = snap.resolver->GetContentVersion();
+			if (cv != 0 && cv != snap.version) {
+				++stats.misses;
+				++m_lastCompileMetrics.staticDeclarationMisses;
+				++stats.resolverVersionMisses;
+				return true;
+			}
+		}
+		auto isStale = [&](const ResourceRegistry::RegistryHandle& handle) {
+			return !handle.IsEphemeral() && !_registry.IsValid(handle);
+		};
+		for (const auto& req : p.resources.staticResourceRequirements) {
+			if (isStale(req.resourceHandleAndRange.resource)) {
+				++stats.misses;
+				++m_lastCompileMetrics.staticDeclarationMisses;
+				++stats.handleGenerationMisses;
+				return true;
+			}
+		}
+		for (const auto& transition : p.resources.internalTransitions) {
+			if (isStale(transition.first.resource)) {
+				++stats.misses;
+				++m_lastCompileMetrics.staticDeclarationMisses;
+				++stats.handleGenerationMisses;
+				return true;
+			}
+		}
+		++stats.hits;
+		++m_lastCompileMetrics.staticDeclarationHits;
+		return false;
+	};
+
 	auto needsRefresh = [&](auto& p) -> bool {
 		ZoneScopedN("RenderGraph::CompileFrame::RefreshRetainedDeclarations::NeedsRefresh");
 		if (!p.name.empty()) {
 			ZoneText(p.name.data(), p.name.size());
 		}
+		if (p.declarationCache.staticInterface) {
+			return staticDeclarationNeedsRefresh(p);
+		}
 		// Check if any stored resolver's content version has changed
 		{
 			ZoneScopedN("RenderGraph::CompileFrame::RefreshRetainedDeclarations::NeedsRefresh::ResolverSnapshots");
@@ -5102,6 +5699,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		}
 		};
 
+	phaseClock.Enter(CompilePhaseClock::Phase::RefreshDeclarations);
 	std::unordered_set<std::string> declarationRefreshedPassNames;
 	std::unordered_set<std::string> frameExtensionPassNames;
 	{
@@ -5223,13 +5821,15 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		TracyPlot("ORG.RefreshRetained.RefreshEquivalent", static_cast<int64_t>(equivalentRefreshCount));
 	}
 
+	phaseClock.Enter(CompilePhaseClock::Phase::ImmediateRecording);
 	{
 		ZoneScopedN("RenderGraph::CompileFrame::InitFramePassState");
-		batches.clear();
-		batches.emplace_back(m_queueRegistry.SlotCount()); // Dummy batch 0 for pre-first-pass transitions
+		RecyclePassBatches();
+		batches.push_back(AcquirePassBatch(m_queueRegistry.SlotCount())); // Dummy batch 0 for pre-first-pass transitions
 		m_framePasses.clear(); // Combined retained + immediate-mode passes for this frame
 		m_framePassIsFrameExtension.clear();
 		m_framePassDeclarationRefreshedThisFrame.clear();
+		m_framePassVolatile.clear();
 	}
 
 	ImmediateExecutionContext renderImmediateContext{ device,
@@ -5259,13 +5859,80 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 	auto getImmediateModeCommands = [](auto* pass) -> IHasImmediateModeCommands* {
 		return dynamic_cast<IHasImmediateModeCommands*>(pass);
 	};
-	auto prepareImmediateContext = [&](ImmediateExecutionContext& context) -> ImmediateExecutionContext& {
+	const bool optimizeImmediateBytecode = m_getImmediateBytecodeOptimizationEnabled ? m_getImmediateBytecodeOptimizationEnabled() : true;
+	// Immediate commands replay before the pass's Execute, so clears of ranges the pass promised to
+	// overwrite in full are dropped while recording.
+	auto prepareImmediateContext = [&](ImmediateExecutionContext& context, const std::vector<ResourceHandleAndRange>& fullOverwriteResources) -> ImmediateExecutionContext& {
 		context.frameIndex = frameIndex;
 		context.hostData = hostData;
 		context.list.Reset();
+		context.list.SetOptimizeBytecode(optimizeImmediateBytecode);
+		context.list.SetFullOverwriteRanges(fullOverwriteResources);
 		return context;
 	};
 
+	// Static immediate passes record once; later frames take a copy of the cached stream while its
+	// key holds and every handle it references is still live in the registry. Other passes record
+	// as usual, and reuse the cached requirements when they record the same stream again.
+	size_t staticImmediateReplayCount = 0;
+	size_t immediateRequirementsReuseCount = 0;
+	size_t immediateOpsEliminated = 0;
+	auto takeStaticImmediateRecording = [&](auto& p, IHasImmediateModeCommands* immediateModeCommands) -> std::optional<rg::imm::FrameData> {
+		if (!immediateModeCommands->ImmediateCommandsAreStatic() || !p.immediateRecording
+			|| p.immediateRecording->key != BuildStaticImmediateRecordingKey(p)) {
+			return std::nullopt;
+		}
+		for (const auto& req : p.immediateRecording->requirements) {
+			if (!_registry.IsValid(req.resourceHandleAndRange.resource)) {
+				p.immediateRecording.reset();
+				return std::nullopt;
+			}
+		}
+		++staticImmediateReplayCount;
+		rg::imm::FrameData frameData;
+		frameData.bytecode = p.immediateRecording->bytecode;
+		frameData.requirements = p.immediateRecording->requirements;
+		return frameData;
+	};
+	auto finalizeImmediateRecording = [&](auto& p, rg::imm::ImmediateCommandList& list) -> rg::imm::FrameData {
+		if (!list.HasRecordedWork()) {
+			return {};
+		}
+		if (!p.immediateRecording) {
+			auto frameData = list.Finalize();
+			immediateOpsEliminated += frameData.optimization.Eliminated();
+			return frameData;
+		}
+		auto frameData = list.Finalize(p.immediateRecording->bytecode, p.immediateRecording->requirements);
+		if (frameData.requirementsReused) {
+			++immediateRequirementsReuseCount;
+		}
+		immediateOpsEliminated += frameData.optimization.Eliminated();
+		return frameData;
+	};
+	auto storeImmediateRecording = [&](auto& p, const rg::imm::FrameData& frameData) {
+		const uint64_t key = BuildStaticImmediateRecordingKey(p);
+		if (frameData.requirementsReused && !frameData.keepAlive) {
+			p.immediateRecording->key = key;
+			return;
+		}
+		// Pinned wrappers only live for the frame, and ephemeral handles may name a different
+		// resource next frame.
+		bool cacheable = !frameData.keepAlive;
+		for (const auto& req : frameData.requirements) {
+			cacheable = cacheable && !req.resourceHandleAndRange.resource.IsEphemeral();
+		}
+		if (!cacheable) {
+			p.immediateRecording.reset();
+			return;
+		}
+		auto recording = std::make_shared<RenderGraph::CachedImmediateRecording>();
+		recording->key = key;
+		recording->bytecode = frameData.bytecode;
+		recording->requirements = frameData.requirements;
+		p.immediateRecording = std::move(recording);
+	};
+
 	// Record immediate-mode commands + access for each pass and fold into per-frame requirements
 	for (auto& pr : m_masterPassList) {
 
@@ -5283,43 +5950,47 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			p.immediateKeepAlive.reset();
 			ClearImmediateFrameRequirements(p.resources);
 
-			auto& c = prepareImmediateContext(computeImmediateContext);
+			auto immediateFrameData = takeStaticImmediateRecording(p, immediateModeCommands);
+			if (!immediateFrameData) {
+				auto& c = prepareImmediateContext(computeImmediateContext, p.resources.fullOverwriteResources);
 
-			// Record immediate-mode commands
-			{
-				ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
-				if (!p.name.empty()) {
-					ZoneText(p.name.data(), p.name.size());
-				}
-				if (traceLifecycle) {
-					spdlog::info("RG frame {} compute pass '{}' RecordImmediateCommands begin", frameIndex, p.name);
-				}
-				immediateModeCommands->RecordImmediateCommands(c);
-				if (traceLifecycle) {
-					spdlog::info("RG frame {} compute pass '{}' RecordImmediateCommands complete", frameIndex, p.name);
+				// Record immediate-mode commands
+				{
+					ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
+					if (!p.name.empty()) {
+						ZoneText(p.name.data(), p.name.size());
+					}
+					if (traceLifecycle) {
+						spdlog::info("RG frame {} compute pass '{}' RecordImmediateCommands begin", frameIndex, p.name);
+					}
+					immediateModeCommands->RecordImmediateCommands(c);
+					if (traceLifecycle) {
+						spdlog::info("RG frame {} compute pass '{}' RecordImmediateCommands complete", frameIndex, p.name);
+					}
 				}
-			}
 
-			if (!c.list.HasRecordedWork()) {
+				immediateFrameData = finalizeImmediateRecording(p, c.list);
+				storeImmediateRecording(p, *immediateFrameData);
+			}
+			if (immediateFrameData->bytecode.empty()) {
 				p.run = PassRunMask::Retained;
 				m_framePasses.push_back(pr);
 				continue;
 			}
-
-			auto immediateFrameData = c.list.Finalize();
 			// If there is a conflict between retained and immediate requirements, split the pass
 			bool conflict = RequirementsConflict(
 				p.resources.staticResourceRequirements,
-				immediateFrameData.requirements);
+				immediateFrameData->requirements);
 			if (conflict) {
 				// Create new PassAndResources for the immediate requirements
 				ComputePassAndResources immediatePassAndResources;
 				immediatePassAndResources.pass = p.pass;
-				SetImmediateFrameRequirements(immediatePassAndResources.resources, std::move(immediateFrameData.requirements));
+				SetImmediateFrameRequirements(immediatePassAndResources.resources, std::move(immediateFrameData->requirements));
 				immediatePassAndResources.resources.preferredQueueKind = p.resources.preferredQueueKind;
 				immediatePassAndResources.resources.pinnedQueueSlot = p.resources.pinnedQueueSlot;
-				immediatePassAndResources.immediateBytecode = std::move(immediateFrameData.bytecode);
-				immediatePassAndResources.immediateKeepAlive = std::move(immediateFrameData.keepAlive);
+				immediatePassAndResources.resources.latencyCritical = p.resources.latencyCritical;
+				immediatePassAndResources.immediateBytecode = std::move(immediateFrameData->bytecode);
+				immediatePassAndResources.immediateKeepAlive = std::move(immediateFrameData->keepAlive);
 				immediatePassAndResources.run = PassRunMask::Immediate;
 				AnyPassAndResources immediateAnyPassAndResources;
 				immediateAnyPassAndResources.type = PassType::Compute;
@@ -5329,9 +6000,9 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				m_framePasses.push_back(pr); // Retained pass
 			}
 			else {
-				p.immediateBytecode = std::move(immediateFrameData.bytecode);
-				p.immediateKeepAlive = std::move(immediateFrameData.keepAlive);
-				SetImmediateFrameRequirements(p.resources, std::move(immediateFrameData.requirements));
+				p.immediateBytecode = std::move(immediateFrameData->bytecode);
+				p.immediateKeepAlive = std::move(immediateFrameData->keepAlive);
+				SetImmediateFrameRequirements(p.resources, std::move(immediateFrameData->requirements));
 				p.run = p.immediateBytecode.empty() ? PassRunMask::Retained : PassRunMask::Both;
 				m_framePasses.push_back(pr);
 			}
@@ -5349,40 +6020,45 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			p.immediateKeepAlive.reset();
 			ClearImmediateFrameRequirements(p.resources);
 
-			auto& c = prepareImmediateContext(renderImmediateContext);
-			{
-				ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
-				if (!p.name.empty()) {
-					ZoneText(p.name.data(), p.name.size());
-				}
-				if (traceLifecycle) {
-					spdlog::info("RG frame {} render pass '{}' RecordImmediateCommands begin", frameIndex, p.name);
-				}
-				immediateModeCommands->RecordImmediateCommands(c);
-				if (traceLifecycle) {
-					spdlog::info("RG frame {} render pass '{}' RecordImmediateCommands complete", frameIndex, p.name);
+			auto immediateFrameData = takeStaticImmediateRecording(p, immediateModeCommands);
+			if (!immediateFrameData) {
+				auto& c = prepareImmediateContext(renderImmediateContext, p.resources.fullOverwriteResources);
+				{
+					ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
+					if (!p.name.empty()) {
+						ZoneText(p.name.data(), p.name.size());
+					}
+					if (traceLifecycle) {
+						spdlog::info("RG frame {} render pass '{}' RecordImmediateCommands begin", frameIndex, p.name);
+					}
+					immediateModeCommands->RecordImmediateCommands(c);
+					if (traceLifecycle) {
+						spdlog::info("RG frame {} render pass '{}' RecordImmediateCommands complete", frameIndex, p.name);
+					}
 				}
+				immediateFrameData = finalizeImmediateRecording(p, c.list);
+				storeImmediateRecording(p, *immediateFrameData);
 			}
-			if (!c.list.HasRecordedWork()) {
+			if (immediateFrameData->bytecode.empty()) {
 				p.run = PassRunMask::Retained;
 				m_framePasses.push_back(pr);
 				continue;
 			}
-			auto immediateFrameData = c.list.Finalize();
 
 			bool conflict = RequirementsConflict(
 				p.resources.staticResourceRequirements,
-				immediateFrameData.requirements);
+				immediateFrameData->requirements);
 
 			if (conflict) {
 				// Create new PassAndResources for the immediate requirements
 				RenderPassAndResources immediatePassAndResources;
 				immediatePassAndResources.pass = p.pass;
-				SetImmediateFrameRequirements(immediatePassAndResources.resources, std::move(immediateFrameData.requirements));
+				SetImmediateFrameRequirements(immediatePassAndResources.resources, std::move(immediateFrameData->requirements));
 				immediatePassAndResources.resources.preferredQueueKind = p.resources.preferredQueueKind;
 				immediatePassAndResources.resources.pinnedQueueSlot = p.resources.pinnedQueueSlot;
-				immediatePassAndResources.immediateBytecode = std::move(immediateFrameData.bytecode);
-				immediatePassAndResources.immediateKeepAlive = std::move(immediateFrameData.keepAlive);
+				immediatePassAndResources.resources.latencyCritical = p.resources.latencyCritical;
+				immediatePassAndResources.immediateBytecode = std::move(immediateFrameData->bytecode);
+				immediatePassAndResources.immediateKeepAlive = std::move(immediateFrameData->keepAlive);
 				immediatePassAndResources.run = PassRunMask::Immediate;
 				AnyPassAndResources immediateAnyPassAndResources;
 				immediateAnyPassAndResources.type = PassType::Render;
@@ -5392,9 +6068,9 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				m_framePasses.push_back(pr); // Retained pass
 			}
 			else {
-				p.immediateBytecode = std::move(immediateFrameData.bytecode);
-				p.immediateKeepAlive = std::move(immediateFrameData.keepAlive);
-				SetImmediateFrameRequirements(p.resources, std::move(immediateFrameData.requirements));
+				p.immediateBytecode = std::move(immediateFrameData->bytecode);
+				p.immediateKeepAlive = std::move(immediateFrameData->keepAlive);
+				SetImmediateFrameRequirements(p.resources, std::move(immediateFrameData->requirements));
 				p.run = p.immediateBytecode.empty() ? PassRunMask::Retained : PassRunMask::Both;
 				m_framePasses.push_back(pr);
 			}
@@ -5412,40 +6088,45 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			p.immediateKeepAlive.reset();
 			ClearImmediateFrameRequirements(p.resources);
 
-			auto& c = prepareImmediateContext(copyImmediateContext);
+			auto immediateFrameData = takeStaticImmediateRecording(p, immediateModeCommands);
+			if (!immediateFrameData) {
+				auto& c = prepareImmediateContext(copyImmediateContext, p.resources.fullOverwriteResources);
 
-			{
-				ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
-				if (!p.name.empty()) {
-					ZoneText(p.name.data(), p.name.size());
-				}
-				if (traceLifecycle) {
-					spdlog::info("RG frame {} copy pass '{}' RecordImmediateCommands begin", frameIndex, p.name);
-				}
-				immediateModeCommands->RecordImmediateCommands(c);
-				if (traceLifecycle) {
-					spdlog::info("RG frame {} copy pass '{}' RecordImmediateCommands complete", frameIndex, p.name);
+				{
+					ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
+					if (!p.name.empty()) {
+						ZoneText(p.name.data(), p.name.size());
+					}
+					if (traceLifecycle) {
+						spdlog::info("RG frame {} copy pass '{}' RecordImmediateCommands begin", frameIndex, p.name);
+					}
+					immediateModeCommands->RecordImmediateCommands(c);
+					if (traceLifecycle) {
+						spdlog::info("RG frame {} copy pass '{}' RecordImmediateCommands complete", frameIndex, p.name);
+					}
 				}
+				immediateFrameData = finalizeImmediateRecording(p, c.list);
+				storeImmediateRecording(p, *immediateFrameData);
 			}
-			if (!c.list.HasRecordedWork()) {
+			if (immediateFrameData->bytecode.empty()) {
 				p.run = PassRunMask::Retained;
 				m_framePasses.push_back(pr);
 				continue;
 			}
-			auto immediateFrameData = c.list.Finalize();
 
 			bool conflict = RequirementsConflict(
 				p.resources.staticResourceRequirements,
-				immediateFrameData.requirements);
+				immediateFrameData->requirements);
 
 			if (conflict) {
 				CopyPassAndResources immediatePassAndResources;
 				immediatePassAndResources.pass = p.pass;
-				SetImmediateFrameRequirements(immediatePassAndResources.resources, std::move(immediateFrameData.requirements));
+				SetImmediateFrameRequirements(immediatePassAndResources.resources, std::move(immediateFrameData->requirements));
 				immediatePassAndResources.resources.preferredQueueKind = p.resources.preferredQueueKind;
 				immediatePassAndResources.resources.pinnedQueueSlot = p.resources.pinnedQueueSlot;
-				immediatePassAndResources.immediateBytecode = std::move(immediateFrameData.bytecode);
-				immediatePassAndResources.immediateKeepAlive = std::move(immediateFrameData.keepAlive);
+				immediatePassAndResources.resources.latencyCritical = p.resources.latencyCritical;
+				immediatePassAndResources.immediateBytecode = std::move(immediateFrameData->bytecode);
+				immediatePassAndResources.immediateKeepAlive = std::move(immediateFrameData->keepAlive);
 				immediatePassAndResources.run = PassRunMask::Immediate;
 				AnyPassAndResources immediateAnyPassAndResources;
 				immediateAnyPassAndResources.type = PassType::Copy;
@@ -5455,15 +6136,20 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				m_framePasses.push_back(pr);
 			}
 			else {
-				p.immediateBytecode = std::move(immediateFrameData.bytecode);
-				p.immediateKeepAlive = std::move(immediateFrameData.keepAlive);
-				SetImmediateFrameRequirements(p.resources, std::move(immediateFrameData.requirements));
+				p.immediateBytecode = std::move(immediateFrameData->bytecode);
+				p.immediateKeepAlive = std::move(immediateFrameData->keepAlive);
+				SetImmediateFrameRequirements(p.resources, std::move(immediateFrameData->requirements));
 				p.run = p.immediateBytecode.empty() ? PassRunMask::Retained : PassRunMask::Both;
 				m_framePasses.push_back(pr);
 			}
 		}
 	}
 
+	TracyPlot("ORG.StaticImmediate.Replayed", static_cast<int64_t>(staticImmediateReplayCount));
+	TracyPlot("ORG.Immediate.RequirementsReused", static_cast<int64_t>(immediateRequirementsReuseCount));
+	TracyPlot("ORG.Immediate.OpsEliminated", static_cast<int64_t>(immediateOpsEliminated));
+
+	phaseClock.Enter(CompilePhaseClock::Phase::FrameExtensions);
 	// Per-frame extension passes (ephemeral)
 	// These are injected into the per-frame pass list (not m_masterPassList) so they do not accumulate.
 	std::vector<ExternalPassDesc> frameExt;
@@ -5494,7 +6180,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				p.immediateKeepAlive.reset();
 				ClearImmediateFrameRequirements(p.resources);
 
-				auto& c = prepareImmediateContext(computeImmediateContext);
+				auto& c = prepareImmediateContext(computeImmediateContext, p.resources.fullOverwriteResources);
 
 				{
 					ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
@@ -5530,7 +6216,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				p.immediateKeepAlive.reset();
 				ClearImmediateFrameRequirements(p.resources);
 
-				auto& c = prepareImmediateContext(copyImmediateContext);
+				auto& c = prepareImmediateContext(copyImmediateContext, p.resources.fullOverwriteResources);
 
 				{
 					ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
@@ -5566,7 +6252,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				p.immediateKeepAlive.reset();
 				ClearImmediateFrameRequirements(p.resources);
 
-				auto& c = prepareImmediateContext(renderImmediateContext);
+				auto& c = prepareImmediateContext(renderImmediateContext, p.resources.fullOverwriteResources);
 
 				{
 					ZoneScopedN("RenderGraph::CompileFrame::RecordImmediateCommands");
@@ -5736,6 +6422,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			m_framePassDeclarationRefreshedThisFrame[passIndex] = declarationRefreshedPassNames.contains(passName) ? 1 : 0;
 		}
 	}
+	UpdatePassVolatility();
 
 	// Register/refresh pass statistics indices for this frame's concrete pass list.
 	// This supports transient passes and per-frame retained/immediate splits.
@@ -5753,7 +6440,11 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 					p.name = "RenderPass#" + std::to_string(i);
 				}
 				any.name = p.name;
-				p.statisticsIndex = static_cast<int>(m_statisticsService->RegisterPass(p.name, p.resources.isGeometryPass, p.techniquePath));
+				if (!p.passId) {
+					p.passId = AcquirePassId(p.name);
+				}
+				m_statisticsService->RegisterPass(p.passId, p.name, p.resources.isGeometryPass, p.techniquePath);
+				p.statisticsIndex = static_cast<int>(p.passId.index);
 			}
 			else if (any.type == PassType::Compute) {
 				auto& p = std::get<ComputePassAndResources>(any.pass);
@@ -5765,7 +6456,11 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 					p.name = "ComputePass#" + std::to_string(i);
 				}
 				any.name = p.name;
-				p.statisticsIndex = static_cast<int>(m_statisticsService->RegisterPass(p.name, false, p.techniquePath));
+				if (!p.passId) {
+					p.passId = AcquirePassId(p.name);
+				}
+				m_statisticsService->RegisterPass(p.passId, p.name, false, p.techniquePath);
+				p.statisticsIndex = static_cast<int>(p.passId.index);
 			}
 			else if (any.type == PassType::Copy) {
 				auto& p = std::get<CopyPassAndResources>(any.pass);
@@ -5777,14 +6472,54 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 					p.name = "CopyPass#" + std::to_string(i);
 				}
 				any.name = p.name;
-				p.statisticsIndex = static_cast<int>(m_statisticsService->RegisterPass(p.name, false, p.techniquePath));
+				if (!p.passId) {
+					p.passId = AcquirePassId(p.name);
+				}
+				m_statisticsService->RegisterPass(p.passId, p.name, false, p.techniquePath);
+				p.statisticsIndex = static_cast<int>(p.passId.index);
 			}
 		}
 
 		m_statisticsService->SetupQueryHeap();
 	}
 
-	std::unordered_set<uint64_t> usedResourceIDs;
+	// Sorted, de-duplicated global IDs referenced this frame; published by RebuildFramePassAccessSummaries.
+	const std::vector<uint64_t>& usedResourceIDs = m_frameDAGResourceIDsByIndex;
+
+	phaseClock.Enter(CompilePhaseClock::Phase::PassAccess);
+	// Reused across frames; BuildNodes resets every node but keeps its vector capacity.
+	std::vector<Node>& nodes = m_frameNodes;
+	{
+		// Before the summaries, so passes of disabled domains cost nothing past this point.
+		traceCompileStep("SkipPassesInDisabledFeatureDomains");
+		SkipPassesInDisabledFeatureDomains(explicitAfterByName);
+	}
+	{
+		traceCompileStep("SkipPassesWithPendingPipelines");
+		SkipPassesWithPendingPipelines(explicitAfterByName);
+	}
+	{
+		traceCompileStep("RebuildFramePassAccessSummaries");
+		ZoneScopedN("RenderGraph::CompileFrame::RebuildFramePassAccessSummaries");
+		RebuildFramePassAccessSummaries();
+	}
+	{
+		traceCompileStep("SkipPassesOnPendingMaterializations");
+		if (SkipPassesOnPendingMaterializations(explicitAfterByName) > 0) {
+			RebuildFramePassAccessSummaries();
+		}
+	}
+	if (m_getRenderGraphDeadPassCullingEnabled && m_getRenderGraphDeadPassCullingEnabled()) {
+		traceCompileStep("CullUnreachableFramePasses");
+		ZoneScopedN("RenderGraph::CompileFrame::CullUnreachableFramePasses");
+		if (CullUnreachableFramePasses(explicitAfterByName) > 0) {
+			// Summaries of the surviving passes are cache hits; this only re-indexes them.
+			RebuildFramePassAccessSummaries();
+		}
+	}
+	else {
+		m_lastCulledPassNames.clear();
+	}
 
 	// Convert explicit After(anchorName)->(passName) constraints into node-index edges.
 	std::vector<std::pair<size_t, size_t>> explicitEdges;
@@ -5808,12 +6543,6 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		}
 	}
 
-	std::vector<Node> nodes;
-	{
-		traceCompileStep("RebuildFramePassAccessSummaries");
-		ZoneScopedN("RenderGraph::CompileFrame::RebuildFramePassAccessSummaries");
-		RebuildFramePassAccessSummaries(usedResourceIDs);
-	}
 	{
 		traceCompileStep("ApplyIdleDematerializationPolicy");
 		ZoneScopedN("RenderGraph::CompileFrame::ApplyIdleDematerializationPolicy");
@@ -5829,18 +6558,37 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		ZoneScopedN("RenderGraph::CompileFrame::RebuildFrameSchedulingResourceIndex");
 		RebuildFrameSchedulingResourceIndex(usedResourceIDs);
 	}
+	phaseClock.Enter(CompilePhaseClock::Phase::DependencyGraph);
 	{
 		traceCompileStep("BuildNodes");
 		ZoneScopedN("RenderGraph::CompileFrame::BuildNodes");
-		nodes = BuildNodes(*this);
+		BuildNodes(*this, nodes);
 	}
 	{
 		traceCompileStep("BuildDependencyGraph");
 		ZoneScopedN("RenderGraph::CompileFrame::BuildDependencyGraph");
-		if (!BuildDependencyGraph(nodes, explicitEdges)) {
-			// Cycle detected
-			spdlog::error("Render graph contains a dependency cycle! Render graph compilation failed.");
-			throw std::runtime_error("Render graph contains a dependency cycle");
+		// Steady-state frames in ReplayAuthoritative mode are usually structurally identical to
+		// the previous one; a matching fingerprint lets the finalized graph be copied verbatim.
+		const bool frameFingerprintReuseEnabled = m_getRenderGraphRegionMode
+			&& static_cast<uint8_t>(m_getRenderGraphRegionMode()) >= static_cast<uint8_t>(rg::runtime::RenderGraphRegionMode::ReplayAuthoritative);
+		const uint64_t frameStructureFingerprint = frameFingerprintReuseEnabled
+			? ComputeFrameStructureFingerprint(nodes, explicitEdges)
+			: 0;
+		const bool reusedDependencyGraph = frameFingerprintReuseEnabled
+			&& TryReuseFrameDependencyGraph(nodes, frameStructureFingerprint);
+		TracyPlot("RG.FrameFingerprint.Hit", static_cast<int64_t>(reusedDependencyGraph ? 1 : 0));
+		if (!reusedDependencyGraph) {
+			if (!BuildDependencyGraph(nodes, explicitEdges)) {
+				// Cycle detected
+				spdlog::error("Render graph contains a dependency cycle! Render graph compilation failed.");
+				throw std::runtime_error("Render graph contains a dependency cycle");
+			}
+			if (frameFingerprintReuseEnabled) {
+				StoreFrameDependencyGraph(nodes, frameStructureFingerprint);
+			}
+			else {
+				m_frameDependencyGraphCache.valid = false;
+			}
 		}
 	}
 
@@ -5857,6 +6605,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		});
 	}
 
+	phaseClock.Enter(CompilePhaseClock::Phase::Aliasing);
 	rg::alias::FrameAliasAnalysis aliasAnalysis;
 	{
 		traceCompileStep("BuildAliasFrameAnalysis");
@@ -5881,6 +6630,17 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			throw std::runtime_error("Render graph alias scheduling introduced a dependency cycle");
 		}
 	}
+	phaseClock.Enter(CompilePhaseClock::Phase::QueueAssignment);
+	{
+		traceCompileStep("ComputeMeasuredCriticalPath");
+		ZoneScopedN("RenderGraph::CompileFrame::ComputeMeasuredCriticalPath");
+		ComputeMeasuredCriticalPath(nodes, m_framePasses);
+	}
+	{
+		traceCompileStep("ComputePresentCriticalPasses");
+		ZoneScopedN("RenderGraph::CompileFrame::ComputePresentCriticalPasses");
+		ComputePresentCriticalPasses(nodes, m_framePasses);
+	}
 	{
 		traceCompileStep("RebuildSchedulingEquivalentIDCache");
 		ZoneScopedN("RenderGraph::CompileFrame::RebuildSchedulingEquivalentIDCache");
@@ -5901,6 +6661,8 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 	{
 		traceCompileStep("PlanActiveQueueSlots");
 		ZoneScopedN("RenderGraph::CompileFrame::PlanActiveQueueSlots");
+		ApplyAdaptiveQueuePlacement(nodes, m_framePasses);
+		ApplyAdaptiveQueueCount();
 		m_activeQueueSlotsThisFrame = PlanActiveQueueSlots(*this, m_framePasses, nodes);
 	}
 	{
@@ -5921,6 +6683,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			}
 		}
 	}
+	phaseClock.Enter(CompilePhaseClock::Phase::Materialize);
 	{
 		traceCompileStep("RebuildFrameResourceAccessSummaries");
 		ZoneScopedN("RenderGraph::CompileFrame::RebuildFrameResourceAccessSummaries");
@@ -5930,6 +6693,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		traceCompileStep("MaterializeUnmaterializedResources");
 		ZoneScopedN("RenderGraph::CompileFrame::MaterializeUnmaterializedResources");
 		MaterializeUnmaterializedResources(&usedResourceIDs);
+		ECSManager::GetInstance().FlushQueuedTrackedEntities();
 	}
 	{
 		traceCompileStep("RebuildFrameCompileResources");
@@ -5941,7 +6705,13 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		ZoneScopedN("RenderGraph::CompileFrame::SnapshotCompiledResourceGenerations");
 		SnapshotCompiledResourceGenerations(usedResourceIDs);
 	}
+	{
+		traceCompileStep("ApplyResidencyPolicy");
+		ZoneScopedN("RenderGraph::CompileFrame::ApplyResidencyPolicy");
+		ApplyResidencyPolicy(usedResourceIDs);
+	}
 
+	phaseClock.Enter(CompilePhaseClock::Phase::Replay);
 	const std::unordered_set<uint64_t> aliasActivationPendingBeforeAuthoritativeCompile = aliasActivationPending;
 	const std::vector<uint8_t> aliasActivationPendingByResourceIndexBeforeAuthoritativeCompile = m_aliasActivationPendingByResourceIndex;
 	const auto regionMode = m_getRenderGraphRegionMode
@@ -6126,8 +6896,8 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				m_lastAuthoritativeReplayFailure = replayReport.firstFailure.empty()
 					? "fast_replay_failed"
 					: replayReport.firstFailure;
-				batches.clear();
-				batches.emplace_back(m_queueRegistry.SlotCount());
+				RecyclePassBatches();
+				batches.push_back(AcquirePassBatch(m_queueRegistry.SlotCount()));
 				m_schedulingDecisionTrace.clear();
 				m_transitionPlacementCandidates.clear();
 				m_transitionPlacementStats = {};
@@ -6242,6 +7012,7 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		}
 	}
 
+	phaseClock.Enter(CompilePhaseClock::Phase::Schedule);
 	if (!fastReplaySucceeded)
 	{
 		traceCompileStep("AutoScheduleAndBuildBatches");
@@ -6646,6 +7417,8 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 				replayCacheFrameSerial);
 			cacheUpdateStats.lookupHits = replaySelectionHits;
 			cacheUpdateStats.lookupMisses = replaySelectionMisses;
+			m_lastCompileMetrics.replaySegmentLookupHits = replaySelectionHits;
+			m_lastCompileMetrics.replaySegmentLookupMisses = replaySelectionMisses;
 			cacheUpdateStats.olderVariantHits = replayOlderVariantHits;
 			cacheUpdateStats.oldestHitAge = replayOldestVariantHitAge;
 			cacheUpdateStats.firstMiss = firstReplaySelectionMiss;
@@ -6730,8 +7503,8 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 						? replayReport.firstFailure
 						: semanticReport.firstFailure;
 
-					batches.clear();
-					batches.emplace_back(m_queueRegistry.SlotCount());
+					RecyclePassBatches();
+					batches.push_back(AcquirePassBatch(m_queueRegistry.SlotCount()));
 					m_schedulingDecisionTrace.clear();
 					m_transitionPlacementCandidates.clear();
 					m_transitionPlacementStats = {};
@@ -6784,17 +7557,29 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			}
 		}
 	}
+	RecordAdaptiveQueuePlacement(m_framePasses);
+	{
+		traceCompileStep("BuildRenderPassMergeGroups");
+		ZoneScopedN("RenderGraph::CompileFrame::BuildRenderPassMergeGroups");
+		BuildRenderPassMergeGroups();
+	}
 	{
 		traceCompileStep("ApplyAliasQueueSynchronization");
 		ZoneScopedN("RenderGraph::CompileFrame::ApplyAliasQueueSynchronization");
 		m_aliasingSubsystem.ApplyAliasQueueSynchronization(*this);
 	}
+	{
+		traceCompileStep("PredictCrossFrameEndStates");
+		ZoneScopedN("RenderGraph::CompileFrame::PredictCrossFrameEndStates");
+		PredictCrossFrameEndStates();
+	}
 	{
 		traceCompileStep("CaptureCompileTrackersForExecution");
 		ZoneScopedN("RenderGraph::CompileFrame::CaptureCompileTrackersForExecution");
 		CaptureCompileTrackersForExecution(usedResourceIDs);
 	}
 
+	phaseClock.Enter(CompilePhaseClock::Phase::QueueSync);
 	{
 		traceCompileStep("PlanCrossFrameQueueWaits");
 		ZoneScopedN("RenderGraph::CompileFrame::PlanCrossFrameQueueWaits");
@@ -6808,10 +7593,33 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		uint64_t overlapSampleCurrentResourceId = 0;
 		uint64_t overlapSamplePreviousResourceId = 0;
 
+		// Cross-frame overlap places each wait on the consuming pass's own batch instead of the
+		// queue's frame start, so early batches only wait for previous-frame work they touch.
+		const bool crossFrameOverlap = m_getRenderGraphCrossFrameOverlapEnabled && m_getRenderGraphCrossFrameOverlapEnabled();
+		std::unordered_map<const void*, size_t> batchIndexByPassEntry;
+		if (crossFrameOverlap) {
+			for (size_t batchIndex = 0; batchIndex < batches.size(); ++batchIndex) {
+				for (const auto& queuePasses : batches[batchIndex].queuePasses) {
+					for (const auto& queued : queuePasses) {
+						std::visit([&](const auto* passEntry) { batchIndexByPassEntry[passEntry] = batchIndex; }, queued);
+					}
+				}
+			}
+		}
+		PassBatch* currentPassBatch = nullptr;
+		uint32_t batchPlacedCrossFrameWaitCount = 0;
+
 		auto markCrossFrameWait = [&](size_t dstSlot, size_t srcSlot, uint64_t fenceValue) {
 			if (dstSlot == srcSlot) {
 				return;
 			}
+			if (crossFrameOverlap) {
+				if (currentPassBatch) {
+					currentPassBatch->AddQueueWait(BatchWaitPhase::BeforeTransitions, dstSlot, srcSlot, fenceValue);
+					++batchPlacedCrossFrameWaitCount;
+				}
+				return;
+			}
 			auto& enabled = m_hasPendingFrameStartQueueWait[dstSlot][srcSlot];
 			auto& maxFence = m_pendingFrameStartQueueWaitFenceValue[dstSlot][srcSlot];
 			enabled = true;
@@ -6875,6 +7683,10 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			std::visit([&](auto const& passAndResources) {
 				using T = std::decay_t<decltype(passAndResources)>;
 				if constexpr (!std::is_same_v<T, std::monostate>) {
+					if (crossFrameOverlap) {
+						auto itBatch = batchIndexByPassEntry.find(&passAndResources);
+						currentPassBatch = itBatch != batchIndexByPassEntry.end() ? &batches[itBatch->second] : nullptr;
+					}
 					const size_t fallbackQueueSlot = passAndResources.resources.pinnedQueueSlot
 						? static_cast<size_t>(static_cast<uint8_t>(*passAndResources.resources.pinnedQueueSlot))
 						: QueueIndex(passAndResources.resources.preferredQueueKind);
@@ -6891,6 +7703,8 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			}, pr.pass);
 		}
 
+		TracyPlot("RG.CrossFrameOverlap.BatchWaits", static_cast<int64_t>(batchPlacedCrossFrameWaitCount));
+
 		//if (overlapTriggeredWaitCount > 0) {
 		//	spdlog::info(
 		//		"RG cross-frame overlap waits: hits={} sampleCurrentResourceId={} samplePreviousResourceId={}",
@@ -6935,6 +7749,13 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		}
 	}
 
+	if (m_getRenderGraphTransitiveWaitReductionEnabled && m_getRenderGraphTransitiveWaitReductionEnabled()) {
+		traceCompileStep("ReduceTransitiveQueueWaits");
+		ZoneScopedN("RenderGraph::CompileFrame::ReduceTransitiveQueueWaits");
+		const size_t removedWaits = ReduceTransitiveQueueWaits(batches);
+		TracyPlot("RG.TransitiveQueueWaitsRemoved", static_cast<int64_t>(removedWaits));
+	}
+
 	{
 		traceCompileStep("PruneUnusedQueueSignals");
 		ZoneScopedN("RenderGraph::CompileFrame::PruneUnusedQueueSignals");
@@ -7004,6 +7825,77 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 		}
 	}
 
+	m_lastCompileTimings.replayAttempted = m_lastAuthoritativeReplayAttempted;
+	m_lastCompileTimings.replayUsed = m_lastAuthoritativeReplaySucceeded && m_lastAuthoritativeReplaySegments != 0;
+	m_lastCompileTimings.replaySegments = m_lastCompileTimings.replayUsed ? m_lastAuthoritativeReplaySegments : 0;
+	m_lastCompileTimings.replayPasses = m_lastCompileTimings.replayUsed ? m_lastAuthoritativeReplayPasses : 0;
+	m_lastCompileTimings.passCount = static_cast<uint64_t>(nodes.size());
+	m_lastCompileTimings.batchCount = static_cast<uint64_t>(batches.size() > 0 ? batches.size() - 1 : 0);
+	phaseClock.Enter(CompilePhaseClock::Phase::Diagnostics);
+	{
+		ZoneScopedN("RenderGraph::CompileFrame::CollectMetrics");
+		auto& metrics = m_lastCompileMetrics;
+		metrics.culledPassCount = m_lastCulledPassNames.size();
+		metrics.skippedPassCount = m_lastFeatureDomainSkippedPassNames.size()
+			+ m_lastPendingMaterializationSkippedPassNames.size()
+			+ m_lastPipelinePendingSkippedPassNames.size();
+		for (const auto& batch : batches) {
+			for (const auto& transitionsByQueue : batch.queueTransitions) {
+				for (const auto& transitions : transitionsByQueue) {
+					metrics.transitionCount += transitions.size();
+				}
+			}
+			for (const auto& waits : batch.externalWaitsBeforeTransitions) {
+				metrics.externalWaitCount += waits.size();
+			}
+			for (const auto& waitsByDst : batch.queueWaitEnabled) {
+				for (const auto& waitsBySrc : waitsByDst) {
+					metrics.queueWaitCount += static_cast<uint64_t>(std::count(waitsBySrc.begin(), waitsBySrc.end(), uint8_t{ 1 }));
+				}
+			}
+			for (const auto& signals : batch.queueSignalEnabled) {
+				metrics.queueSignalCount += static_cast<uint64_t>(std::count(signals.begin(), signals.end(), uint8_t{ 1 }));
+			}
+		}
+
+		metrics.declarationRefreshRequested = m_frameDeclarationRefreshRequestedCount;
+		metrics.declarationRefreshEquivalent = m_frameDeclarationRefreshEquivalentCount;
+
+		metrics.replayDynamicGapPasses = m_lastCompileTimings.replayUsed ? m_lastAuthoritativeReplayDynamicGapPasses : 0;
+		metrics.replayCacheSegments = lightweightReplayCacheSegments;
+		metrics.replayCacheEntries = lightweightReplayCacheEntries;
+		metrics.replaySelectedSegments = lightweightReplaySelectedSegments;
+		metrics.replaySkippedIneligible = lightweightReplaySelectionSkippedIneligible;
+		metrics.replaySkippedTraceRange = lightweightReplaySelectionSkippedTraceRange;
+		metrics.replaySkippedPassHash = lightweightReplaySelectionSkippedPassHash;
+		metrics.replaySkippedLookupMiss = lightweightReplaySelectionSkippedLookupMiss;
+
+		metrics.candidateRegions = m_lastRegionStats.candidateRegionCount;
+		metrics.acceptedRegions = m_lastRegionStats.acceptedRegionCount;
+		metrics.rejectedRegions = m_lastRegionStats.rejectedRegionCount;
+		metrics.regionCoveredPasses = m_lastRegionStats.coveredPassCount;
+		metrics.estimatedSavedAddTransitionCalls = m_lastRegionStats.estimatedSavedAddTransitionCalls;
+		metrics.estimatedSavedIsNewBatchNeededCalls = m_lastRegionStats.estimatedSavedIsNewBatchNeededCalls;
+
+		metrics.transitionPlacementCandidates = m_transitionPlacementStats.candidateCount;
+		metrics.canonicalBeforePassTransitions = m_transitionPlacementStats.canonicalBeforePassCount;
+		metrics.inlineEarlyPlacedTransitions = m_transitionPlacementStats.inlineEarlyPlacedCount;
+		metrics.graphicsFallbackTransitions = m_transitionPlacementStats.graphicsFallbackCount;
+		metrics.aliasActivationTransitions = m_transitionPlacementStats.aliasActivationCount;
+		metrics.splitBarriers = m_transitionPlacementStats.splitBarrierCount;
+		metrics.readStateMergeSavedTransitions = m_transitionPlacementStats.readStateMergeSavedCount;
+		metrics.crossFrameEndStateTransitions = m_transitionPlacementStats.crossFrameEndStateCount;
+		metrics.fullOverwriteDiscardTransitions = m_transitionPlacementStats.fullOverwriteDiscardCount;
+
+		metrics.aliasCandidates = autoAliasPlannerStats.candidatesSeen;
+		metrics.aliasAutoAssigned = autoAliasPlannerStats.autoAssigned;
+		metrics.aliasExcluded = autoAliasPlannerStats.excluded;
+		metrics.aliasPooledActualBytes = autoAliasPlannerStats.pooledActualBytes;
+		metrics.aliasPooledSavedBytes = autoAliasPlannerStats.pooledSavedBytes;
+		metrics.aliasPlanCacheHits = autoAliasPlannerStats.planCacheHits;
+		metrics.aliasPlanCacheMisses = autoAliasPlannerStats.planCacheMisses;
+		metrics.aliasPersistedPlanCacheHits = autoAliasPlannerStats.persistedPlanCacheHits;
+	}
 	{
 		traceCompileStep("RegionCompileSummary");
 		ZoneScopedN("RenderGraph::CompileFrame::RegionCompileSummary");
@@ -7039,16 +7931,26 @@ void RenderGraph::CompileFrame(rhi::Device device, uint8_t frameIndex, const IHo
 			m_lastAuthoritativeReplayFailure);
 	}
 
-	if (m_getRenderGraphCompileDumpEnabled && m_getRenderGraphCompileDumpEnabled()) {
+	if (m_getRenderGraphCompileDumpEnabled && m_getRenderGraphCompileDumpEnabled()
+		&& DebugDumpWriter::GetInstance().ShouldCapture(DebugDumpChannel::CompiledGraph)) {
 		traceCompileStep("WriteCompiledGraphDebugDump");
 		ZoneScopedN("RenderGraph::CompileFrame::WriteCompiledGraphDebugDump");
 		WriteCompiledGraphDebugDump(frameIndex, nodes);
 	}
-	if (m_getRenderGraphVramDumpEnabled && m_getRenderGraphVramDumpEnabled()) {
+	if (m_getRenderGraphVramDumpEnabled && m_getRenderGraphVramDumpEnabled()
+		&& DebugDumpWriter::GetInstance().ShouldCapture(DebugDumpChannel::VramUsage)) {
 		traceCompileStep("WriteVramUsageDebugDump");
 		ZoneScopedN("RenderGraph::CompileFrame::WriteVramUsageDebugDump");
 		WriteVramUsageDebugDump(frameIndex);
 	}
+	if (!m_pendingDeclarationCapturePath.empty()) {
+		traceCompileStep("WriteDeclarationCapture");
+		ZoneScopedN("RenderGraph::CompileFrame::WriteDeclarationCapture");
+		if (rg::capture::SaveFrameDeclarationCapture(BuildFrameDeclarationCapture(explicitAfterByName), m_pendingDeclarationCapturePath)) {
+			spdlog::info("RG frame {} declarations captured to '{}'", static_cast<unsigned int>(frameIndex), m_pendingDeclarationCapturePath.string());
+		}
+		m_pendingDeclarationCapturePath.clear();
+	}
 	traceCompileStep("complete");
 
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
@@ -7559,7 +8461,7 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 		"RG compile validation M2 frame={} status=observed\n"
 		"  transition_mode={}\n"
 		"  candidates={} emitted={} old_inline_eligible={} inline_early_placed={} consumer_before_pass={}\n"
-		"  graphics_fallback={} alias_activation={} cross_queue_coordination_blocked={}\n"
+		"  graphics_fallback={} alias_activation={} cross_queue_coordination_blocked={} split_barriers={}\n"
 		"  placement_candidates_recorded={}\n"
 		"  final_tracker_fingerprint=0x{:016x} initialized_trackers={} tracker_segments={}\n"
 		"  emitted_transition_fingerprint=0x{:016x} emitted_transitions_in_batches={}",
@@ -7573,6 +8475,7 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 		m_transitionPlacementStats.graphicsFallbackCount,
 		m_transitionPlacementStats.aliasActivationCount,
 		m_transitionPlacementStats.crossQueueCoordinationBlockedCount,
+		m_transitionPlacementStats.splitBarrierCount,
 		m_transitionPlacementCandidates.size(),
 		finalTrackerFingerprint,
 		initializedTrackerCount,
@@ -7621,23 +8524,81 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 		const auto& replaySegmentsForDiagnostics = preserveAuthoritativeReplayCache
 			? diagnosticReplaySegments
 			: m_regionCache.replaySegments;
-		const ReplaySegmentValidationStats segmentValidation = ValidateCachedSegmentsAgainstCurrentFrame(
-			previousReplaySegments,
-			replaySegmentsForDiagnostics);
-		const ReplaySegmentVerificationReport semanticVerification = VerifyAuthoritativeScheduleSemantics(
-			nodes,
-			m_framePasses,
-			batches);
-		const ReplaySegmentVerificationReport replayMetadataVerification = VerifyReplayScheduleSemanticCorrectness(
-			replaySegmentsForDiagnostics);
+		// ValidateOnly and ShadowReplay may sample: full validation every intervalFrames frames, and
+		// a rotating window of cached segments in between. The schedule-wide verifier and the shadow
+		// replay only run on full frames. Other modes always validate in full.
+		const bool samplingApplies =
+			regionMode == rg::runtime::RenderGraphRegionMode::ValidateOnly
+			|| regionMode == rg::runtime::RenderGraphRegionMode::ShadowReplay;
+		const uint32_t validationIntervalFrames = std::max(1u,
+			m_getRenderGraphRegionValidationIntervalFrames ? m_getRenderGraphRegionValidationIntervalFrames() : 1u);
+		const uint32_t validationSegmentsPerFrame =
+			m_getRenderGraphRegionValidationSegmentsPerFrame ? m_getRenderGraphRegionValidationSegmentsPerFrame() : 0u;
+		auto& sampling = m_regionValidationSampling;
+		const uint64_t validationFrameSerial = sampling.frameSerial++;
+		const bool declarationsChanged = m_frameDeclarationRefreshRequestedCount != m_frameDeclarationRefreshEquivalentCount;
+		bool fullValidation = !samplingApplies
+			|| validationIntervalFrames == 1
+			|| validationFrameSerial % validationIntervalFrames == 0;
+		if (!fullValidation && declarationsChanged) {
+			fullValidation = true;
+			++sampling.forcedFullValidations;
+		}
+		const char* validationSamplingName = "full";
+
+		ReplaySegmentValidationStats segmentValidation{};
+		ReplaySegmentVerificationReport semanticVerification{};
+		ReplaySegmentVerificationReport replayMetadataVerification{};
 		ReplaySegmentVerificationReport shadowReplayVerification{};
-		if (static_cast<uint8_t>(regionMode) >= static_cast<uint8_t>(rg::runtime::RenderGraphRegionMode::ShadowReplay)) {
-			shadowReplayVerification = BuildShadowReplayScheduleFromCachedSegments(
+		uint64_t validatedPreviousSegments = previousReplaySegments.size();
+		if (!fullValidation && validationSegmentsPerFrame > 0 && !previousReplaySegments.empty()) {
+			// Window over the previous frame's segments, each looked up in the full current set, so
+			// the window does not cause misses of its own.
+			const size_t count = previousReplaySegments.size();
+			const size_t first = sampling.segmentCursor < count ? sampling.segmentCursor : 0;
+			const size_t windowSize = std::min<size_t>(validationSegmentsPerFrame, count - first);
+			sampling.segmentCursor = first + windowSize;
+			const std::span<const CachedReplaySegment> window(previousReplaySegments.data() + first, windowSize);
+			segmentValidation = ValidateCachedSegmentsAgainstCurrentFrame(window, replaySegmentsForDiagnostics);
+			segmentValidation.previousSegmentCount = count;
+			replayMetadataVerification = VerifyReplayScheduleSemanticCorrectness(window);
+			validatedPreviousSegments = windowSize;
+			validationSamplingName = "sampled";
+			if (segmentValidation.misses != 0 || !replayMetadataVerification.valid) {
+				fullValidation = true;
+				++sampling.forcedFullValidations;
+			}
+			else {
+				++sampling.sampledValidations;
+			}
+		}
+		else if (!fullValidation) {
+			validatedPreviousSegments = 0;
+			validationSamplingName = "skipped";
+			++sampling.skippedValidations;
+		}
+		if (fullValidation) {
+			segmentValidation = ValidateCachedSegmentsAgainstCurrentFrame(
 				previousReplaySegments,
 				replaySegmentsForDiagnostics);
+			semanticVerification = VerifyAuthoritativeScheduleSemantics(
+				nodes,
+				m_framePasses,
+				batches);
+			replayMetadataVerification = VerifyReplayScheduleSemanticCorrectness(
+				replaySegmentsForDiagnostics);
+			if (static_cast<uint8_t>(regionMode) >= static_cast<uint8_t>(rg::runtime::RenderGraphRegionMode::ShadowReplay)) {
+				shadowReplayVerification = BuildShadowReplayScheduleFromCachedSegments(
+					previousReplaySegments,
+					replaySegmentsForDiagnostics);
+			}
+			validatedPreviousSegments = previousReplaySegments.size();
+			validationSamplingName = "full";
+			++sampling.fullValidations;
 		}
 		const ReplayAuthoritativeReadinessReport authoritativeReplayReadiness =
-			static_cast<uint8_t>(regionMode) >= static_cast<uint8_t>(rg::runtime::RenderGraphRegionMode::ShadowReplay)
+			fullValidation
+			&& static_cast<uint8_t>(regionMode) >= static_cast<uint8_t>(rg::runtime::RenderGraphRegionMode::ShadowReplay)
 				? CheckReplayAuthoritativeReadiness(
 					segmentValidation,
 					semanticVerification,
@@ -7660,6 +8621,8 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 			case RegionRejectReason::GraphicsFallbackTransition: return "graphics_fallback_transition";
 			case RegionRejectReason::UnsupportedSubresourceState: return "unsupported_subresource_state";
 			case RegionRejectReason::BatchHazardBoundary: return "batch_hazard_boundary";
+			case RegionRejectReason::VolatilePass: return "volatile_pass";
+		case RegionRejectReason::VolatilePass: return "volatile_pass";
 			default: return "unknown";
 			}
 		};
@@ -7821,11 +8784,21 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 		if (static_cast<uint8_t>(regionMode) >= static_cast<uint8_t>(rg::runtime::RenderGraphRegionMode::ValidateOnly)) {
 			spdlog::info(
 				"RG compile validation R2 segment_validation frame={} status=observed\n"
+				"  sampling={} validated_previous_segments={} interval_frames={} segments_per_frame={}\n"
+				"  sampling_totals: full={} forced_full={} sampled={} skipped={}\n"
 				"  previous_segments={} current_segments={} hits={} misses={} allowed_template_state_divergences={} invalidations=[{}]\n"
 				"  transition_shape_diffs: resource={} range={} after_state={} queue={} phase={} discard={}\n"
 				"  first_miss=\"{}\"\n"
 				"  first_transition_shape_diff=\"{}\"",
 				static_cast<unsigned int>(frameIndex),
+				validationSamplingName,
+				validatedPreviousSegments,
+				validationIntervalFrames,
+				validationSegmentsPerFrame,
+				sampling.fullValidations,
+				sampling.forcedFullValidations,
+				sampling.sampledValidations,
+				sampling.skippedValidations,
 				segmentValidation.previousSegmentCount,
 				segmentValidation.currentSegmentCount,
 				segmentValidation.hits,
@@ -7847,7 +8820,7 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 			"  checked_passes={} checked_edges={} checked_requirements={} checked_syncs={} failures={}\n"
 			"  replay_metadata_status={} replay_metadata_failures={} first_failure=\"{}\"",
 			static_cast<unsigned int>(frameIndex),
-			semanticVerification.valid ? "ok" : "failed",
+			!fullValidation ? "sampled" : semanticVerification.valid ? "ok" : "failed",
 			semanticVerification.checkedPasses,
 			semanticVerification.checkedEdges,
 			semanticVerification.checkedRequirements,
@@ -7879,7 +8852,7 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 				"  failures={} first_failure=\"{}\"\n"
 				"  authoritative_execution=unchanged",
 				static_cast<unsigned int>(frameIndex),
-				shadowReplayVerification.valid ? "ok" : "failed",
+				!fullValidation ? "skipped" : shadowReplayVerification.valid ? "ok" : "failed",
 				shadowReplayVerification.matchedSegments,
 				replaySegmentsForDiagnostics.size(),
 				shadowReplayVerification.replayedPasses,
@@ -7898,7 +8871,7 @@ void RenderGraph::LogRegionCompileSummary(uint8_t frameIndex, const std::vector<
 				"  requested={} attempted={} committed={} execution_path={} matched_cached_segments={} replayable_passes={} dynamic_gap_passes={}\n"
 				"  inserted_input_transitions={} blockers={} blocker_summary=[{}] first_failure=\"{}\"",
 				static_cast<unsigned int>(frameIndex),
-				authoritativeReplayReadiness.ready ? "ready" : "blocked",
+				!fullValidation ? "skipped" : authoritativeReplayReadiness.ready ? "ready" : "blocked",
 				replayAuthoritativeRequested ? 1 : 0,
 				m_lastAuthoritativeReplayAttempted ? 1 : 0,
 				m_lastAuthoritativeReplaySucceeded ? 1 : 0,
@@ -0,0 +1,213 @@
+#include "Render/ResourceDescriptorIndexTable.h"
+
+#include <algorithm>
+#include <bit>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Render/Runtime/OpenRenderGraphSettings.h"
+#include "Resources/Buffers/Buffer.h"
+#include "Resources/DynamicResource.h"
+
+namespace {
+	constexpr uint32_t kMinTableCapacity = 256;
+
+	std::shared_ptr<Buffer> CreateTableBuffer(uint32_t capacity) {
+		const rhi::HeapType heapType = BufferBase::ResolveCpuWritableHeapType(static_cast<uint64_t>(capacity) * sizeof(uint32_t));
+		auto buffer = Buffer::CreateUnmaterializedStructuredBuffer(capacity, sizeof(uint32_t), false, false, false, heapType);
+		buffer->SetName("RG Descriptor Index Table");
+		buffer->Materialize();
+		return buffer;
+	}
+}
+
+size_t ResourceDescriptorIndexTable::SlotKeyHasher::operator()(const SlotKey& key) const noexcept {
+	const auto& a = key.accessor;
+	uint64_t h = (static_cast<uint64_t>(key.registryKey) << 32) | key.generation;
+	uint64_t view = static_cast<uint64_t>(a.type)
+		| (static_cast<uint64_t>(a.hasSRVViewType ? static_cast<int>(a.SRVType) + 1 : 0) << 4)
+		| (static_cast<uint64_t>(a.hasUAVViewType ? static_cast<int>(a.UAVType) + 1 : 0) << 12)
+		| (static_cast<uint64_t>(a.mip) << 20)
+		| (static_cast<uint64_t>(a.slice) << 36);
+	h ^= view + 0x9e3779b97f4a7c15ull + (h << 6) + (h >> 2);
+	return static_cast<size_t>(h);
+}
+
+ResourceDescriptorIndexTable::ResourceDescriptorIndexTable(ResourceRegistry& registry)
+	: m_registry(registry) {
+	m_frameCopies.resize(std::max<uint32_t>(1u, rg::runtime::GetOpenRenderGraphSettings().numFramesInFlight));
+}
+
+ResourceDescriptorIndexTable::~ResourceDescriptorIndexTable() = default;
+
+uint32_t ResourceDescriptorIndexTable::AcquireSlot(const ResourceRegistry::RegistryHandle& handle, const DescriptorAccessor& accessor) {
+	if (handle.IsEphemeral() || handle.GetGeneration() == 0) {
+		return kInvalidSlot;
+	}
+	std::lock_guard<std::mutex> lock(m_mutex);
+	const SlotKey key{ handle.GetKey().idx, handle.GetGeneration(), accessor };
+	if (auto it = m_slotByKey.find(key); it != m_slotByKey.end()) {
+		return it->second;
+	}
+
+	uint32_t slot = 0;
+	if (!m_freeSlots.empty()) {
+		slot = m_freeSlots.back();
+		m_freeSlots.pop_back();
+	}
+	else {
+		slot = static_cast<uint32_t>(m_entries.size());
+		m_entries.emplace_back();
+		m_indices.push_back(kInvalidDescriptorIndex);
+	}
+	auto& entry = m_entries[slot];
+	entry = SlotEntry{ .handle = handle, .accessor = accessor, .live = true };
+	m_slotByKey.emplace(key, slot);
+	if (!Refresh(entry, slot)) {
+		WriteIndex(slot, kInvalidDescriptorIndex);
+	}
+	++m_stats.liveSlots;
+	return slot;
+}
+
+bool ResourceDescriptorIndexTable::Refresh(SlotEntry& entry, uint32_t slot) {
+	Resource* resource = m_registry.Resolve(entry.handle);
+	if (!resource) {
+		return false;
+	}
+	if (resource != entry.resource) {
+		entry.resource = resource;
+		entry.isDynamic = dynamic_cast<DynamicGloballyIndexedResource*>(resource) != nullptr;
+		entry.backing = nullptr;
+		entry.descriptorSlotVersion = 0;
+		if (!entry.isDynamic) {
+			const auto* backing = dynamic_cast<const GloballyIndexedResource*>(resource);
+			if (!backing) {
+				WriteIndex(slot, kInvalidDescriptorIndex);
+				return true; // Wrong resource type; keep the slot so the handle stays mapped
+			}
+			entry.backing = backing;
+			entry.descriptorSlotVersion = backing->GetDescriptorSlotVersion() + 1; // Force a write below
+		}
+	}
+
+	const GloballyIndexedResource* backing = entry.backing;
+	if (entry.isDynamic) {
+		backing = static_cast<DynamicGloballyIndexedResource*>(resource)->GetResource().get();
+	}
+	if (!backing) {
+		WriteIndex(slot, kInvalidDescriptorIndex);
+		return true;
+	}
+	const uint64_t version = backing->GetDescriptorSlotVersion();
+	if (backing == entry.backing && version == entry.descriptorSlotVersion) {
+		return true;
+	}
+	entry.backing = backing;
+	entry.descriptorSlotVersion = version;
+
+	uint32_t index = kInvalidDescriptorIndex;
+	try {
+		index = ResolveDescriptorIndex(*backing, entry.accessor);
+	}
+	catch (const std::exception& e) {
+		spdlog::debug("ResourceDescriptorIndexTable: slot {} ('{}') has no view for its accessor: {}", slot, resource->GetName(), e.what());
+	}
+	WriteIndex(slot, index);
+	return true;
+}
+
+void ResourceDescriptorIndexTable::WriteIndex(uint32_t slot, uint32_t index) {
+	if (m_indices[slot] == index) {
+		return;
+	}
+	m_indices[slot] = index;
+	m_pendingChanges.push_back(slot);
+}
+
+void ResourceDescriptorIndexTable::Update(uint8_t frameIndex) {
+	ZoneScopedN("ResourceDescriptorIndexTable::Update");
+	std::lock_guard<std::mutex> lock(m_mutex);
+	m_stats.slotsReleasedLastUpdate = 0;
+	for (uint32_t slot = 0; slot < m_entries.size(); ++slot) {
+		auto& entry = m_entries[slot];
+		if (!entry.live || Refresh(entry, slot)) {
+			continue;
+		}
+		// The handle went stale; the passes that held it re-declare and acquire a new slot.
+		m_slotByKey.erase(SlotKey{ entry.handle.GetKey().idx, entry.handle.GetGeneration(), entry.accessor });
+		entry = {};
+		WriteIndex(slot, kInvalidDescriptorIndex);
+		m_freeSlots.push_back(slot);
+		--m_stats.liveSlots;
+		++m_stats.slotsReleasedLastUpdate;
+	}
+
+	m_stats.slotsChangedLastUpdate = m_pendingChanges.size();
+	if (!m_pendingChanges.empty()) {
+		m_changeLog.emplace_back(++m_changeSerial, std::move(m_pendingChanges));
+		m_pendingChanges = {};
+	}
+
+	m_stats.bytesWrittenLastUpdate = 0;
+	m_currentCopy = frameIndex % m_frameCopies.size();
+	if (!m_indices.empty()) {
+		SyncFrameCopy(m_frameCopies[m_currentCopy]);
+	}
+
+	uint64_t oldestSynced = m_changeSerial;
+	for (const auto& copy : m_frameCopies) {
+		if (copy.buffer) {
+			oldestSynced = std::min(oldestSynced, copy.syncedSerial);
+		}
+	}
+	while (!m_changeLog.empty() && m_changeLog.front().first <= oldestSynced) {
+		m_changeLog.pop_front();
+	}
+	m_stats.capacity = m_frameCopies[m_currentCopy].capacity;
+	TracyPlot("RG.DescriptorIndexTable.ChangedSlots", static_cast<int64_t>(m_stats.slotsChangedLastUpdate));
+}
+
+void ResourceDescriptorIndexTable::SyncFrameCopy(FrameCopy& copy) {
+	const bool fullWrite = !copy.buffer || copy.capacity < m_indices.size();
+	if (!fullWrite && copy.syncedSerial == m_changeSerial) {
+		return;
+	}
+	if (fullWrite && copy.capacity < m_indices.size()) {
+		copy.capacity = std::max(kMinTableCapacity, std::bit_ceil(static_cast<uint32_t>(m_indices.size())));
+		copy.buffer = CreateTableBuffer(copy.capacity);
+		++m_stats.growCount;
+	}
+
+	uint32_t* mapped = nullptr;
+	auto apiResource = copy.buffer->GetAPIResource();
+	apiResource.Map(reinterpret_cast<void**>(&mapped), 0, static_cast<uint64_t>(copy.capacity) * sizeof(uint32_t));
+	if (!mapped) {
+		spdlog::error("ResourceDescriptorIndexTable: failed to map table buffer");
+		return;
+	}
+	if (fullWrite) {
+		std::copy(m_indices.begin(), m_indices.end(), mapped);
+		std::fill(mapped + m_indices.size(), mapped + copy.capacity, kInvalidDescriptorIndex);
+		m_stats.bytesWrittenLastUpdate += static_cast<uint64_t>(copy.capacity) * sizeof(uint32_t);
+	}
+	else {
+		for (const auto& [serial, slots] : m_changeLog) {
+			if (serial <= copy.syncedSerial) {
+				continue;
+			}
+			for (const uint32_t slot : slots) {
+				mapped[slot] = m_indices[slot];
+			}
+			m_stats.bytesWrittenLastUpdate += slots.size() * sizeof(uint32_t);
+		}
+	}
+	apiResource.Unmap(0, 0);
+	copy.syncedSerial = m_changeSerial;
+}
+
+uint32_t ResourceDescriptorIndexTable::GetTableDescriptorIndex() const {
+	const auto& copy = m_frameCopies[m_currentCopy];
+	return copy.buffer ? copy.buffer->GetSRVInfo(0).slot.index : kInvalidDescriptorIndex;
+}
@@ -35,6 +35,24 @@ public:
         DescriptorHeapManager::GetInstance().UpdateDescriptorContents(target, apiResource, req);
     }
 
+    void EnsureSubresourceViews(
+        GloballyIndexedResource& target,
+        const SubresourceRange& range) override {
+        DescriptorHeapManager::GetInstance().EnsureSubresourceViews(target, range);
+    }
+
+    uint64_t GetDeferredSubresourceViewTargetCount() const override {
+        return DescriptorHeapManager::GetInstance().GetDeferredSubresourceViewTargetCount();
+    }
+
+    void BeginDeferredDescriptorWrites() override {
+        DescriptorHeapManager::GetInstance().BeginDeferredDescriptorWrites();
+    }
+
+    void FlushDeferredDescriptorWrites() override {
+        DescriptorHeapManager::GetInstance().FlushDeferredDescriptorWrites();
+    }
+
     rhi::DescriptorHeap GetSRVDescriptorHeap() const override {
         return DescriptorHeapManager::GetInstance().GetSRVDescriptorHeap();
     }
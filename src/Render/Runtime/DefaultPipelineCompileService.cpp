@@ -0,0 +1,129 @@
+#include "Render/Runtime/IPipelineCompileService.h"
+
+#include <chrono>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+namespace rg::runtime {
+
+namespace {
+
+class DefaultPipelineCompileService final : public IPipelineCompileService {
+public:
+    void SetTaskService(std::shared_ptr<ITaskService> service) override {
+        std::shared_ptr<ITaskService> previous;
+        {
+            std::scoped_lock lock(m_state->mutex);
+            previous = m_taskService;
+        }
+        // Compiles queued on the old service finish before requests move to the new one.
+        if (previous && previous != service) {
+            previous->WaitForBackgroundIdle();
+        }
+        std::scoped_lock lock(m_state->mutex);
+        m_taskService = std::move(service);
+    }
+
+    std::shared_ptr<PendingPipeline> RequestPipeline(const PipelineCompileKey& key, std::function<PipelineState()> create) override {
+        std::shared_ptr<PendingPipeline> pending;
+        std::shared_ptr<ITaskService> taskService;
+        {
+            std::scoped_lock lock(m_state->mutex);
+            ++m_state->stats.requests;
+            auto it = m_cache.find(key);
+            if (it != m_cache.end() && it->second->GetReadiness() != PipelineReadiness::Failed) {
+                ++m_state->stats.cacheHits;
+                return it->second;
+            }
+            // A failed entry is retried: the usual cause is a shader being edited.
+            pending = std::make_shared<PendingPipeline>();
+            m_cache[key] = pending;
+            ++m_state->stats.pending;
+            taskService = m_taskService;
+        }
+
+        // Fails the request if a task service destroys the job without running it, so it cannot
+        // stay Pending; RequestPipeline retries Failed entries.
+        auto dropGuard = std::make_shared<DroppedCompileGuard>(pending);
+        auto job = [state = m_state, pending, dropGuard, create = std::move(create)]() {
+            dropGuard->ran = true;
+            ZoneScopedN("PipelineCompileService::Compile");
+            const auto start = std::chrono::steady_clock::now();
+            bool succeeded = false;
+            try {
+                pending->Complete(create());
+                succeeded = true;
+            }
+            catch (const std::exception& e) {
+                spdlog::error("Pipeline compile failed: {}", e.what());
+                pending->Fail(e.what());
+            }
+            catch (...) {
+                pending->Fail("unknown error");
+            }
+            const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            std::scoped_lock lock(state->mutex);
+            --state->stats.pending;
+            ++(succeeded ? state->stats.compiled : state->stats.failed);
+            state->stats.compileMsTotal += ms;
+        };
+        if (taskService) {
+            taskService->SubmitBackground("PipelineCompile", std::move(job));
+        }
+        else {
+            job();
+        }
+        return pending;
+    }
+
+    void Evict(const PipelineCompileKey& key) override {
+        std::scoped_lock lock(m_state->mutex);
+        m_cache.erase(key);
+    }
+
+    void Clear() override {
+        std::scoped_lock lock(m_state->mutex);
+        m_cache.clear();
+    }
+
+    PipelineCompileStats GetStats() const override {
+        std::scoped_lock lock(m_state->mutex);
+        return m_state->stats;
+    }
+
+private:
+    struct DroppedCompileGuard {
+        explicit DroppedCompileGuard(std::shared_ptr<PendingPipeline> inPending)
+            : pending(std::move(inPending)) {
+        }
+        ~DroppedCompileGuard() {
+            if (!ran) {
+                pending->Fail("compile job was dropped by the task service");
+            }
+        }
+        std::shared_ptr<PendingPipeline> pending;
+        bool ran = false;
+    };
+
+    // Queued compiles keep this alive, so the service can go away before its jobs finish.
+    struct SharedState {
+        mutable std::mutex mutex;
+        PipelineCompileStats stats{};
+    };
+
+    std::shared_ptr<SharedState> m_state = std::make_shared<SharedState>();
+    std::shared_ptr<ITaskService> m_taskService;
+    std::unordered_map<PipelineCompileKey, std::shared_ptr<PendingPipeline>, PipelineCompileKey::Hasher> m_cache;
+};
+
+}
+
+std::shared_ptr<IPipelineCompileService> CreateDefaultPipelineCompileService() {
+    return std::make_shared<DefaultPipelineCompileService>();
+}
+
+}
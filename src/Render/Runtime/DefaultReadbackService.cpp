@@ -15,6 +15,18 @@ public:
         ReadbackManager::GetInstance().RequestReadbackCapture(passName, resource, range, std::move(callback), preferredQueueKind);
     }
 
+    void RequestReadbackReduction(const std::string& passName, Resource* resource, const RangeSpec& range, const ReadbackReductionDesc& reduction, ReadbackCaptureCallback callback, QueueKind preferredQueueKind = QueueKind::Graphics) override {
+        ReadbackManager::GetInstance().RequestReadbackReduction(passName, resource, range, reduction, std::move(callback), preferredQueueKind);
+    }
+
+    void RegisterReadbackReducer(std::shared_ptr<IReadbackReducer> reducer) override {
+        ReadbackManager::GetInstance().RegisterReadbackReducer(std::move(reducer));
+    }
+
+    std::shared_ptr<IReadbackReducer> GetReadbackReducer(ReadbackReductionKind kind) override {
+        return ReadbackManager::GetInstance().GetReadbackReducer(kind);
+    }
+
     std::vector<rg::runtime::ReadbackCaptureInfo> ConsumeCaptureRequests() override {
         auto captures = ReadbackManager::GetInstance().ConsumeCaptureRequests();
         std::vector<rg::runtime::ReadbackCaptureInfo> out;
@@ -26,7 +38,8 @@ public:
                 .resourceId = capture.resourceId,
                 .range = capture.range,
                 .callback = std::move(capture.callback),
-                .preferredQueueKind = capture.preferredQueueKind
+                .preferredQueueKind = capture.preferredQueueKind,
+                .reduction = capture.reduction
                 });
         }
         return out;
@@ -37,10 +50,23 @@ public:
         return { token.id };
     }
 
+    rg::runtime::ReadbackCaptureToken EnqueueCaptureBatch(std::vector<ReadbackCaptureRequest>&& requests) override {
+        auto token = ReadbackManager::GetInstance().EnqueueCaptureBatch(std::move(requests));
+        return { token.id };
+    }
+
     void FinalizeCapture(rg::runtime::ReadbackCaptureToken token, QueueKind queueKind, std::shared_ptr<rhi::TimelinePtr> signalFenceOwner, uint64_t fenceValue) override {
         ReadbackManager::GetInstance().FinalizeCapture({ token.id }, queueKind, std::move(signalFenceOwner), fenceValue);
     }
 
+    void OnFrameSubmitted() override {
+        ReadbackManager::GetInstance().OnFrameSubmitted();
+    }
+
+    ReadbackAllocation AllocateReadback(QueueKind queueKind, uint64_t size, uint64_t alignment, uint32_t shareCount = 1) override {
+        return ReadbackManager::GetInstance().AllocateReadback(queueKind, size, alignment, shareCount);
+    }
+
     uint64_t GetNextReadbackFenceValue(QueueKind queueKind) override {
         return ReadbackManager::GetInstance().GetNextReadbackFenceValue(queueKind);
     }
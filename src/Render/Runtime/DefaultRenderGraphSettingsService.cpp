@@ -7,6 +7,10 @@ namespace rg::runtime {
 namespace {
 class DefaultRenderGraphSettingsService final : public IRenderGraphSettingsService {
 public:
+    uint64_t GetSettingsGeneration() const override {
+        return GetOpenRenderGraphSettingsGeneration();
+    }
+
     bool GetUseAsyncCompute() const override {
         return GetOpenRenderGraphSettings().useAsyncCompute;
     }
@@ -31,6 +35,10 @@ public:
         return GetOpenRenderGraphSettings().readOnlyUniformTransitionElisionEnabled;
     }
 
+    bool GetReadStateMergingEnabled() const override {
+        return GetOpenRenderGraphSettings().readStateMergingEnabled;
+    }
+
     uint8_t GetAutoAliasMode() const override {
         return GetOpenRenderGraphSettings().autoAliasMode;
     }
@@ -119,6 +127,26 @@ public:
         return GetOpenRenderGraphSettings().renderGraphRegionShadowStrictBatchMatch;
     }
 
+    uint32_t GetRenderGraphRegionValidationIntervalFrames() const override {
+        return GetOpenRenderGraphSettings().renderGraphRegionValidationIntervalFrames;
+    }
+
+    uint32_t GetRenderGraphRegionValidationSegmentsPerFrame() const override {
+        return GetOpenRenderGraphSettings().renderGraphRegionValidationSegmentsPerFrame;
+    }
+
+    bool GetRenderGraphRegionAdaptiveBoundariesEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphRegionAdaptiveBoundariesEnabled;
+    }
+
+    uint32_t GetRenderGraphRegionVolatilityWindowFrames() const override {
+        return GetOpenRenderGraphSettings().renderGraphRegionVolatilityWindowFrames;
+    }
+
+    float GetRenderGraphRegionVolatilityThreshold() const override {
+        return GetOpenRenderGraphSettings().renderGraphRegionVolatilityThreshold;
+    }
+
     uint32_t GetRenderGraphReplaySegmentCacheMaxEntries() const override {
         return GetOpenRenderGraphSettings().renderGraphReplaySegmentCacheMaxEntries;
     }
@@ -139,6 +167,214 @@ public:
         return GetOpenRenderGraphSettings().renderGraphReplayRelaxAliasPlacement;
     }
 
+    bool GetRenderGraphIncrementalDependencyGraphEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphIncrementalDependencyGraphEnabled;
+    }
+
+    bool GetRenderGraphParallelDependencyGraphEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphParallelDependencyGraphEnabled;
+    }
+
+    bool GetQueueSchedulingMeasuredCriticalPathEnabled() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingMeasuredCriticalPathEnabled;
+    }
+
+    float GetQueueSchedulingCriticalPathWeight() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingCriticalPathWeight;
+    }
+
+    bool GetQueueSchedulingAdaptivePlacementEnabled() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingAdaptivePlacementEnabled;
+    }
+
+    uint32_t GetQueueSchedulingAdaptivePlacementWindowFrames() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingAdaptivePlacementWindowFrames;
+    }
+
+    float GetQueueSchedulingAdaptivePlacementHysteresis() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingAdaptivePlacementHysteresis;
+    }
+
+    bool GetQueueSchedulingAdaptiveQueueCountEnabled() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingAdaptiveQueueCountEnabled;
+    }
+
+    uint32_t GetQueueSchedulingAdaptiveQueueCountMaxQueues() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingAdaptiveQueueCountMaxQueues;
+    }
+
+    float GetQueueSchedulingAdaptiveQueueCountWaitCostUs() const override {
+        return GetOpenRenderGraphSettings().queueSchedulingAdaptiveQueueCountWaitCostUs;
+    }
+
+    bool GetRenderGraphSplitBarriersEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphSplitBarriersEnabled;
+    }
+
+    uint32_t GetRenderGraphGlobalBufferBarrierThreshold() const override {
+        return GetOpenRenderGraphSettings().renderGraphGlobalBufferBarrierThreshold;
+    }
+
+    bool GetRenderGraphDeadPassCullingEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphDeadPassCullingEnabled;
+    }
+
+    bool GetRenderGraphRenderPassMergingEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphRenderPassMergingEnabled;
+    }
+
+    bool GetRenderGraphStreamingSubmissionEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphStreamingSubmissionEnabled;
+    }
+
+    bool GetRenderGraphTransitiveWaitReductionEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphTransitiveWaitReductionEnabled;
+    }
+
+    bool GetRenderGraphCrossFrameOverlapEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphCrossFrameOverlapEnabled;
+    }
+
+    bool GetRenderGraphCrossFrameEndStatePredictionEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphCrossFrameEndStatePredictionEnabled;
+    }
+
+    bool GetRenderGraphPresentLatencyModeEnabled() const override {
+        return GetOpenRenderGraphSettings().renderGraphPresentLatencyModeEnabled;
+    }
+
+    uint32_t GetRenderGraphPresentLatencyMaxQueuedFrames() const override {
+        return GetOpenRenderGraphSettings().renderGraphPresentLatencyMaxQueuedFrames;
+    }
+
+    bool GetAutoAliasPoolBudgetAwareEnabled() const override {
+        return GetOpenRenderGraphSettings().autoAliasPoolBudgetAwareEnabled;
+    }
+
+    float GetAutoAliasPoolBudgetPressureThreshold() const override {
+        return GetOpenRenderGraphSettings().autoAliasPoolBudgetPressureThreshold;
+    }
+
+    bool GetAutoAliasSubresourceLifetimesEnabled() const override {
+        return GetOpenRenderGraphSettings().autoAliasSubresourceLifetimesEnabled;
+    }
+
+    uint64_t GetStreamingUploadFrameBudgetBytes() const override {
+        return GetOpenRenderGraphSettings().streamingUploadFrameBudgetBytes;
+    }
+
+    bool GetCpuVisibleDeviceLocalHeapSupported() const override {
+        return GetOpenRenderGraphSettings().cpuVisibleDeviceLocalHeapSupported;
+    }
+
+    uint64_t GetCpuVisibleDeviceLocalMaxBufferBytes() const override {
+        return GetOpenRenderGraphSettings().cpuVisibleDeviceLocalMaxBufferBytes;
+    }
+
+    uint64_t GetUploadParallelCopyThresholdBytes() const override {
+        return GetOpenRenderGraphSettings().uploadParallelCopyThresholdBytes;
+    }
+
+    UploadTelemetryLevel GetUploadTelemetryLevel() const override {
+        return GetOpenRenderGraphSettings().uploadTelemetryLevel;
+    }
+
+    uint64_t GetResourceCopyQueueMinBytes() const override {
+        return GetOpenRenderGraphSettings().resourceCopyQueueMinBytes;
+    }
+
+    ReadbackCallbackDispatch GetReadbackCallbackDispatch() const override {
+        return GetOpenRenderGraphSettings().readbackCallbackDispatch;
+    }
+
+    bool GetDeferShaderVisibleDescriptorWrites() const override {
+        return GetOpenRenderGraphSettings().deferShaderVisibleDescriptorWrites;
+    }
+
+    uint32_t GetShaderVisibleDescriptorHeapInitialCapacity() const override {
+        return GetOpenRenderGraphSettings().shaderVisibleDescriptorHeapInitialCapacity;
+    }
+
+    uint32_t GetShaderVisibleDescriptorHeapMaxCapacity() const override {
+        return GetOpenRenderGraphSettings().shaderVisibleDescriptorHeapMaxCapacity;
+    }
+
+    bool GetLazySubresourceDescriptorViews() const override {
+        return GetOpenRenderGraphSettings().lazySubresourceDescriptorViews;
+    }
+
+    bool GetImmediateBytecodeOptimizationEnabled() const override {
+        return GetOpenRenderGraphSettings().immediateBytecodeOptimizationEnabled;
+    }
+
+    uint32_t GetImmediateParallelReplayMinOps() const override {
+        return GetOpenRenderGraphSettings().immediateParallelReplayMinOps;
+    }
+
+    uint32_t GetImmediateParallelReplayMaxCommandLists() const override {
+        return GetOpenRenderGraphSettings().immediateParallelReplayMaxCommandLists;
+    }
+
+    PassStatisticsMode GetPassStatisticsMode() const override {
+        return GetOpenRenderGraphSettings().passStatisticsMode;
+    }
+
+    uint32_t GetPassStatisticsSampledPassesPerFrame() const override {
+        return GetOpenRenderGraphSettings().passStatisticsSampledPassesPerFrame;
+    }
+
+    bool GetExportTracyGpuZones() const override {
+        return GetOpenRenderGraphSettings().exportTracyGpuZones;
+    }
+
+    uint32_t GetPipelineStatisticsSampleIntervalFrames() const override {
+        return GetOpenRenderGraphSettings().pipelineStatisticsSampleIntervalFrames;
+    }
+
+    uint32_t GetPipelineStatisticsSampledPassesPerFrame() const override {
+        return GetOpenRenderGraphSettings().pipelineStatisticsSampledPassesPerFrame;
+    }
+
+    bool GetResidencyEvictionEnabled() const override {
+        return GetOpenRenderGraphSettings().residencyEvictionEnabled;
+    }
+
+    uint32_t GetResidencyEvictionIdleFrames() const override {
+        return GetOpenRenderGraphSettings().residencyEvictionIdleFrames;
+    }
+
+    float GetResidencyBudgetPressureThreshold() const override {
+        return GetOpenRenderGraphSettings().residencyBudgetPressureThreshold;
+    }
+
+    uint64_t GetTextureRecyclePoolMaxBytes() const override {
+        return GetOpenRenderGraphSettings().textureRecyclePoolMaxBytes;
+    }
+
+    uint32_t GetTextureRecyclePoolMaxIdleFrames() const override {
+        return GetOpenRenderGraphSettings().textureRecyclePoolMaxIdleFrames;
+    }
+
+    bool GetTrackedAllocationEntityBatchingEnabled() const override {
+        return GetOpenRenderGraphSettings().trackedAllocationEntityBatchingEnabled;
+    }
+
+    bool GetBackgroundMaterializationEnabled() const override {
+        return GetOpenRenderGraphSettings().backgroundMaterializationEnabled;
+    }
+
+    bool GetParallelTaskServiceEnabled() const override {
+        return GetOpenRenderGraphSettings().parallelTaskServiceEnabled;
+    }
+
+    bool GetBackgroundDeletionEnabled() const override {
+        return GetOpenRenderGraphSettings().backgroundDeletionEnabled;
+    }
+
+    uint32_t GetBackgroundDeletionMaxQueuedBatches() const override {
+        return GetOpenRenderGraphSettings().backgroundDeletionMaxQueuedBatches;
+    }
+
     bool GetHeavyDebug() const override {
         return GetOpenRenderGraphSettings().heavyDebug;
     }
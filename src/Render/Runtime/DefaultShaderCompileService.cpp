@@ -0,0 +1,406 @@
+#include "Render/Runtime/IShaderCompileService.h"
+
+#include <array>
+#include <chrono>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+#include <slang.h>
+#include <slang-com-ptr.h>
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Utilities/ORGUtilities.h"
+
+namespace rg::runtime {
+
+namespace {
+
+// File layout: magic, version, key, bytecode size and bytes, reflection size and bytes. The key
+// is repeated inside the file so a renamed or truncated file is rejected rather than misused.
+constexpr uint64_t kShaderCacheMagic = 0x4e44414853475230ull; // "0RGSHADN"
+constexpr uint32_t kShaderCacheVersion = 1;
+constexpr uint64_t kMaxCachedBlobBytes = 256ull << 20;
+
+template<typename T>
+void WriteShaderCacheValue(std::ofstream& out, const T& value) {
+    out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template<typename T>
+bool ReadShaderCacheValue(std::ifstream& in, T& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(T));
+    return static_cast<bool>(in);
+}
+
+void AppendKeyField(std::string& out, std::string_view value) {
+    const uint64_t size = value.size();
+    out.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    out.append(value);
+}
+
+void AppendDiagnostics(std::string& out, slang::IBlob* blob) {
+    if (blob && blob->getBufferSize() > 0) {
+        out.append(static_cast<const char*>(blob->getBufferPointer()), blob->getBufferSize());
+    }
+}
+
+SlangStage ToSlangStage(ShaderStage stage) {
+    switch (stage) {
+    case ShaderStage::Vertex: return SLANG_STAGE_VERTEX;
+    case ShaderStage::Pixel: return SLANG_STAGE_PIXEL;
+    case ShaderStage::Geometry: return SLANG_STAGE_GEOMETRY;
+    case ShaderStage::Hull: return SLANG_STAGE_HULL;
+    case ShaderStage::Domain: return SLANG_STAGE_DOMAIN;
+    case ShaderStage::Compute: return SLANG_STAGE_COMPUTE;
+    case ShaderStage::Amplification: return SLANG_STAGE_AMPLIFICATION;
+    case ShaderStage::Mesh: return SLANG_STAGE_MESH;
+    case ShaderStage::FromAttribute: break;
+    }
+    return SLANG_STAGE_NONE;
+}
+
+// A global session must not be shared between threads, and creating one is expensive, so each
+// worker keeps its own for the life of the thread.
+slang::IGlobalSession* GetThreadGlobalSession() {
+    thread_local Slang::ComPtr<slang::IGlobalSession> session;
+    if (!session && SLANG_FAILED(slang::createGlobalSession(session.writeRef()))) {
+        return nullptr;
+    }
+    return session.get();
+}
+
+void CompileWithSlang(const ShaderCompileRequest& request, CompiledShader& out) {
+    ZoneScopedN("ShaderCompileService::CompileWithSlang");
+    slang::IGlobalSession* globalSession = GetThreadGlobalSession();
+    if (!globalSession) {
+        out.diagnostics = "createGlobalSession failed\n";
+        return;
+    }
+
+    std::vector<slang::PreprocessorMacroDesc> macros;
+    macros.reserve(request.defines.size());
+    for (const auto& [name, value] : request.defines) {
+        macros.push_back({ name.c_str(), value.c_str() });
+    }
+    std::vector<const char*> searchPaths;
+    searchPaths.reserve(request.searchPaths.size());
+    for (const auto& path : request.searchPaths) {
+        searchPaths.push_back(path.c_str());
+    }
+
+    slang::TargetDesc targetDesc = {};
+    targetDesc.format = request.target == ShaderTarget::SPIRV ? SLANG_SPIRV : SLANG_DXIL;
+    targetDesc.profile = globalSession->findProfile(request.profile.c_str());
+
+    slang::SessionDesc sessionDesc = {};
+    sessionDesc.targets = &targetDesc;
+    sessionDesc.targetCount = 1;
+    sessionDesc.preprocessorMacros = macros.data();
+    sessionDesc.preprocessorMacroCount = static_cast<SlangInt>(macros.size());
+    sessionDesc.searchPaths = searchPaths.data();
+    sessionDesc.searchPathCount = static_cast<SlangInt>(searchPaths.size());
+
+    Slang::ComPtr<slang::ISession> session;
+    if (SLANG_FAILED(globalSession->createSession(sessionDesc, session.writeRef()))) {
+        out.diagnostics = "createSession failed\n";
+        return;
+    }
+
+    // The session is private to this compile, so the module name only has to be readable.
+    const std::string modulePath = request.modulePath.empty() ? std::string("shader.slang") : request.modulePath;
+    const std::string moduleName = std::filesystem::path(modulePath).stem().string();
+    Slang::ComPtr<slang::IModule> module;
+    {
+        Slang::ComPtr<slang::IBlob> diagBlob;
+        module = session->loadModuleFromSourceString(moduleName.c_str(), modulePath.c_str(), request.source.c_str(), diagBlob.writeRef());
+        AppendDiagnostics(out.diagnostics, diagBlob);
+        if (!module) {
+            return;
+        }
+    }
+
+    Slang::ComPtr<slang::IEntryPoint> entryPoint;
+    if (request.stage == ShaderStage::FromAttribute) {
+        module->findEntryPointByName(request.entryPoint.c_str(), entryPoint.writeRef());
+    }
+    else {
+        Slang::ComPtr<slang::IBlob> diagBlob;
+        module->findAndCheckEntryPoint(request.entryPoint.c_str(), ToSlangStage(request.stage), entryPoint.writeRef(), diagBlob.writeRef());
+        AppendDiagnostics(out.diagnostics, diagBlob);
+    }
+    if (!entryPoint) {
+        out.diagnostics += fmt::format("entry point '{}' not found\n", request.entryPoint);
+        return;
+    }
+
+    Slang::ComPtr<slang::IComponentType> linkedProgram;
+    {
+        std::array<slang::IComponentType*, 2> parts = { module.get(), entryPoint.get() };
+        Slang::ComPtr<slang::IComponentType> composed;
+        Slang::ComPtr<slang::IBlob> diagBlob;
+        SlangResult result = session->createCompositeComponentType(parts.data(), parts.size(), composed.writeRef(), diagBlob.writeRef());
+        AppendDiagnostics(out.diagnostics, diagBlob);
+        if (SLANG_FAILED(result)) {
+            return;
+        }
+        Slang::ComPtr<slang::IBlob> linkDiagBlob;
+        result = composed->link(linkedProgram.writeRef(), linkDiagBlob.writeRef());
+        AppendDiagnostics(out.diagnostics, linkDiagBlob);
+        if (SLANG_FAILED(result)) {
+            return;
+        }
+    }
+
+    Slang::ComPtr<slang::IBlob> code;
+    {
+        Slang::ComPtr<slang::IBlob> diagBlob;
+        const SlangResult result = linkedProgram->getEntryPointCode(0, 0, code.writeRef(), diagBlob.writeRef());
+        AppendDiagnostics(out.diagnostics, diagBlob);
+        if (SLANG_FAILED(result) || !code) {
+            return;
+        }
+    }
+    const auto* codeBytes = static_cast<const std::byte*>(code->getBufferPointer());
+    out.bytecode.assign(codeBytes, codeBytes + code->getBufferSize());
+
+    if (slang::ProgramLayout* layout = linkedProgram->getLayout(0)) {
+        Slang::ComPtr<slang::IBlob> json;
+        if (SLANG_SUCCEEDED(layout->toJson(json.writeRef())) && json) {
+            out.reflectionJson.assign(static_cast<const char*>(json->getBufferPointer()), json->getBufferSize());
+        }
+    }
+    out.succeeded = true;
+}
+
+class DefaultShaderCompileService final : public IShaderCompileService {
+public:
+    DefaultShaderCompileService()
+        : m_compilerTag(spGetBuildTagString()) {}
+
+    void SetTaskService(std::shared_ptr<ITaskService> service) override {
+        std::scoped_lock lock(m_mutex);
+        m_taskService = std::move(service);
+    }
+
+    void SetCacheDirectory(std::filesystem::path directory) override {
+        std::scoped_lock lock(m_mutex);
+        m_cacheDirectory = std::move(directory);
+    }
+
+    ShaderCacheKey ComputeKey(const ShaderCompileRequest& request) const override {
+        std::string keyBytes;
+        keyBytes.reserve(request.source.size() + 256);
+        AppendKeyField(keyBytes, m_compilerTag);
+        AppendKeyField(keyBytes, request.source);
+        AppendKeyField(keyBytes, request.modulePath);
+        AppendKeyField(keyBytes, request.entryPoint);
+        AppendKeyField(keyBytes, request.profile);
+        const std::array<uint64_t, 4> scalars = {
+            kShaderCacheVersion,
+            static_cast<uint64_t>(request.stage),
+            static_cast<uint64_t>(request.target),
+            request.dependencyHash,
+        };
+        keyBytes.append(reinterpret_cast<const char*>(scalars.data()), sizeof(scalars));
+        for (const auto& [name, value] : request.defines) {
+            AppendKeyField(keyBytes, name);
+            AppendKeyField(keyBytes, value);
+        }
+        for (const auto& path : request.searchPaths) {
+            AppendKeyField(keyBytes, path);
+        }
+        const auto hash = rg::util::HashBytes128(keyBytes.data(), keyBytes.size());
+        return ShaderCacheKey{ hash.lo, hash.hi };
+    }
+
+    std::shared_ptr<const CompiledShader> Compile(const ShaderCompileRequest& request) override {
+        return CompileBatch(std::span<const ShaderCompileRequest>(&request, 1)).front();
+    }
+
+    std::vector<std::shared_ptr<const CompiledShader>> CompileBatch(std::span<const ShaderCompileRequest> requests) override {
+        ZoneScopedN("ShaderCompileService::CompileBatch");
+        std::vector<std::shared_ptr<const CompiledShader>> results(requests.size());
+        std::vector<ShaderCacheKey> keys(requests.size());
+        for (size_t i = 0; i < requests.size(); ++i) {
+            keys[i] = ComputeKey(requests[i]);
+        }
+
+        // First request index of each key that missed in memory.
+        std::vector<size_t> misses;
+        std::unordered_map<ShaderCacheKey, size_t, ShaderCacheKey::Hasher> missSlotByKey;
+        std::shared_ptr<ITaskService> taskService;
+        std::filesystem::path cacheDirectory;
+        {
+            std::scoped_lock lock(m_mutex);
+            m_stats.requests += requests.size();
+            for (size_t i = 0; i < requests.size(); ++i) {
+                if (auto it = m_memoryCache.find(keys[i]); it != m_memoryCache.end()) {
+                    results[i] = it->second;
+                    ++m_stats.memoryHits;
+                }
+                else if (missSlotByKey.try_emplace(keys[i], misses.size()).second) {
+                    misses.push_back(i);
+                }
+            }
+            taskService = m_taskService;
+            cacheDirectory = m_cacheDirectory;
+        }
+        if (misses.empty()) {
+            return results;
+        }
+
+        std::vector<std::shared_ptr<CompiledShader>> resolved(misses.size());
+        std::vector<double> compileMs(misses.size(), 0.0);
+        auto resolveMiss = [&](size_t slot) {
+            const size_t requestIndex = misses[slot];
+            auto shader = std::make_shared<CompiledShader>();
+            shader->key = keys[requestIndex];
+            if (!cacheDirectory.empty() && LoadFromDisk(cacheDirectory, *shader)) {
+                shader->fromDisk = true;
+            }
+            else {
+                const auto start = std::chrono::steady_clock::now();
+                CompileWithSlang(requests[requestIndex], *shader);
+                compileMs[slot] = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+                if (!shader->succeeded) {
+                    spdlog::error("Shader compile failed: '{}' entry '{}':\n{}", requests[requestIndex].modulePath, requests[requestIndex].entryPoint, shader->diagnostics);
+                }
+                else if (!cacheDirectory.empty()) {
+                    StoreToDisk(cacheDirectory, *shader);
+                }
+            }
+            resolved[slot] = std::move(shader);
+        };
+        if (taskService && misses.size() > 1) {
+            taskService->ParallelFor("ShaderCompile", misses.size(), resolveMiss);
+        }
+        else {
+            for (size_t slot = 0; slot < misses.size(); ++slot) {
+                resolveMiss(slot);
+            }
+        }
+
+        std::scoped_lock lock(m_mutex);
+        for (size_t slot = 0; slot < misses.size(); ++slot) {
+            const auto& shader = resolved[slot];
+            if (shader->fromDisk) {
+                ++m_stats.diskHits;
+            }
+            else {
+                ++(shader->succeeded ? m_stats.compiled : m_stats.failed);
+                m_stats.compileMsTotal += compileMs[slot];
+            }
+            if (shader->succeeded) {
+                m_memoryCache[shader->key] = shader;
+            }
+        }
+        for (size_t i = 0; i < requests.size(); ++i) {
+            if (!results[i]) {
+                results[i] = resolved[missSlotByKey.at(keys[i])];
+            }
+        }
+        return results;
+    }
+
+    void ClearMemoryCache() override {
+        std::scoped_lock lock(m_mutex);
+        m_memoryCache.clear();
+    }
+
+    ShaderCompileStats GetStats() const override {
+        std::scoped_lock lock(m_mutex);
+        return m_stats;
+    }
+
+private:
+    static std::filesystem::path CachePath(const std::filesystem::path& directory, const ShaderCacheKey& key) {
+        return directory / fmt::format("{:016x}{:016x}.orgshader", key.hi, key.lo);
+    }
+
+    static bool LoadFromDisk(const std::filesystem::path& directory, CompiledShader& shader) {
+        ZoneScopedN("ShaderCompileService::LoadFromDisk");
+        std::ifstream in(CachePath(directory, shader.key), std::ios::binary);
+        if (!in) {
+            return false;
+        }
+        uint64_t magic = 0;
+        uint32_t version = 0;
+        ShaderCacheKey storedKey{};
+        uint64_t bytecodeSize = 0;
+        if (!ReadShaderCacheValue(in, magic) || !ReadShaderCacheValue(in, version)
+            || !ReadShaderCacheValue(in, storedKey.lo) || !ReadShaderCacheValue(in, storedKey.hi)
+            || magic != kShaderCacheMagic || version != kShaderCacheVersion || storedKey != shader.key
+            || !ReadShaderCacheValue(in, bytecodeSize) || bytecodeSize > kMaxCachedBlobBytes) {
+            return false;
+        }
+        shader.bytecode.resize(static_cast<size_t>(bytecodeSize));
+        in.read(reinterpret_cast<char*>(shader.bytecode.data()), static_cast<std::streamsize>(bytecodeSize));
+        uint64_t reflectionSize = 0;
+        if (!in || !ReadShaderCacheValue(in, reflectionSize) || reflectionSize > kMaxCachedBlobBytes) {
+            shader.bytecode.clear();
+            return false;
+        }
+        shader.reflectionJson.resize(static_cast<size_t>(reflectionSize));
+        in.read(shader.reflectionJson.data(), static_cast<std::streamsize>(reflectionSize));
+        if (!in) {
+            shader.bytecode.clear();
+            shader.reflectionJson.clear();
+            return false;
+        }
+        shader.succeeded = true;
+        return true;
+    }
+
+    // Writes to a per-thread temporary and renames it into place, so concurrent writers of the
+    // same key (other workers, other processes) never expose a partial file.
+    static void StoreToDisk(const std::filesystem::path& directory, const CompiledShader& shader) {
+        ZoneScopedN("ShaderCompileService::StoreToDisk");
+        std::error_code ec;
+        std::filesystem::create_directories(directory, ec);
+        const auto finalPath = CachePath(directory, shader.key);
+        auto tempPath = finalPath;
+        tempPath += fmt::format(".{:x}.tmp", std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        {
+            std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+            if (!out) {
+                spdlog::warn("Shader cache '{}' could not be opened for writing", tempPath.string());
+                return;
+            }
+            WriteShaderCacheValue(out, kShaderCacheMagic);
+            WriteShaderCacheValue(out, kShaderCacheVersion);
+            WriteShaderCacheValue(out, shader.key.lo);
+            WriteShaderCacheValue(out, shader.key.hi);
+            WriteShaderCacheValue(out, static_cast<uint64_t>(shader.bytecode.size()));
+            out.write(reinterpret_cast<const char*>(shader.bytecode.data()), static_cast<std::streamsize>(shader.bytecode.size()));
+            WriteShaderCacheValue(out, static_cast<uint64_t>(shader.reflectionJson.size()));
+            out.write(shader.reflectionJson.data(), static_cast<std::streamsize>(shader.reflectionJson.size()));
+            if (!out) {
+                out.close();
+                std::filesystem::remove(tempPath, ec);
+                return;
+            }
+        }
+        std::filesystem::rename(tempPath, finalPath, ec);
+        if (ec) {
+            std::filesystem::remove(tempPath, ec);
+        }
+    }
+
+    const std::string m_compilerTag;
+    mutable std::mutex m_mutex;
+    std::shared_ptr<ITaskService> m_taskService;
+    std::filesystem::path m_cacheDirectory;
+    std::unordered_map<ShaderCacheKey, std::shared_ptr<const CompiledShader>, ShaderCacheKey::Hasher> m_memoryCache;
+    ShaderCompileStats m_stats{};
+};
+
+}
+
+std::shared_ptr<IShaderCompileService> CreateDefaultShaderCompileService() {
+    return std::make_shared<DefaultShaderCompileService>();
+}
+
+}
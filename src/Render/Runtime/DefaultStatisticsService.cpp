@@ -1,5 +1,6 @@
 #include "Render/Runtime/IStatisticsService.h"
 
+#include "Managers/Singletons/FrameTraceWriter.h"
 #include "Managers/Singletons/StatisticsManager.h"
 
 namespace rg::runtime {
@@ -19,8 +20,8 @@ public:
         StatisticsManager::GetInstance().ClearAll();
     }
 
-    unsigned RegisterPass(const std::string& passName, bool isGeometryPass, std::string_view techniquePath = {}) override {
-        return StatisticsManager::GetInstance().RegisterPass(passName, isGeometryPass, techniquePath);
+    void RegisterPass(PassId passId, std::string_view passName, bool isGeometryPass, std::string_view techniquePath = {}) override {
+        StatisticsManager::GetInstance().RegisterPass(passId, passName, isGeometryPass, techniquePath);
     }
 
     void RegisterQueue(rhi::QueueKind queueKind) override {
@@ -59,6 +60,26 @@ public:
         StatisticsManager::GetInstance().MergePendingResolves(queueKind, frameIndex, ctx);
     }
 
+    void BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList) override {
+        StatisticsManager::GetInstance().BeginBatchQuery(batchIndex, queueSlot, frameIndex, queue, cmdList);
+    }
+
+    void EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList) override {
+        StatisticsManager::GetInstance().EndBatchQuery(batchIndex, queueSlot, frameIndex, queue, cmdList);
+    }
+
+    void BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx) override {
+        StatisticsManager::GetInstance().BeginBatchQuery(batchIndex, queueSlot, frameIndex, queue, cmdList, ctx);
+    }
+
+    void EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx) override {
+        StatisticsManager::GetInstance().EndBatchQuery(batchIndex, queueSlot, frameIndex, queue, cmdList, ctx);
+    }
+
+    void SetBatchQueueSync(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, std::span<const BatchQueueWait> waits, uint64_t signalValue) override {
+        StatisticsManager::GetInstance().SetBatchQueueSync(batchIndex, queueSlot, frameIndex, waits, signalValue);
+    }
+
     void OnFrameComplete(unsigned frameIndex, rhi::Queue& queue) override {
         StatisticsManager::GetInstance().OnFrameComplete(frameIndex, queue);
     }
@@ -87,6 +108,22 @@ public:
         return StatisticsManager::GetInstance().GetMeshStats();
     }
 
+    bool StartFrameTrace(const std::string& path, uint32_t maxQueuedFrames) override {
+        return FrameTraceWriter::GetInstance().Start(path, maxQueuedFrames);
+    }
+
+    void StopFrameTrace() override {
+        FrameTraceWriter::GetInstance().Stop();
+    }
+
+    bool IsFrameTraceActive() const override {
+        return FrameTraceWriter::GetInstance().IsCapturing();
+    }
+
+    const std::vector<BatchQueueStats>& GetBatchStats() const override {
+        return StatisticsManager::GetInstance().GetBatchStats();
+    }
+
     MemoryBudgetStats GetMemoryBudgetStats() const override {
         return StatisticsManager::GetInstance().GetMemoryBudgetStats();
     }
@@ -0,0 +1,350 @@
+#include "Render/Runtime/ITaskService.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <mutex>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <spdlog/spdlog.h>
+
+#include <tracy/Tracy.hpp>
+
+namespace rg::runtime {
+
+namespace {
+
+// Set on pool workers, and on a caller while it runs its own share. Nested ParallelFor calls run
+// inline instead of waiting on a pool that is already busy with their parent.
+thread_local bool t_insideTaskService = false;
+
+constexpr size_t kChunksPerWorker = 4;
+constexpr int kWorkerSpinIterations = 64;
+
+// [begin, end) of chunk indices packed into one word so the owning worker (pop front) and thieves
+// (split off the back half) can both claim work with a single CAS. Chunk indices never repeat
+// within a job, so a drained range can't reappear and the CAS is ABA-safe.
+constexpr uint64_t PackRange(uint32_t begin, uint32_t end) { return (uint64_t(end) << 32) | begin; }
+constexpr uint32_t RangeBegin(uint64_t packed) { return static_cast<uint32_t>(packed); }
+constexpr uint32_t RangeEnd(uint64_t packed) { return static_cast<uint32_t>(packed >> 32); }
+
+struct alignas(64) WorkerSlot {
+    std::atomic<uint64_t> range{ 0 };
+    std::binary_semaphore wake{ 0 };
+};
+
+class DefaultTaskService final : public ITaskService {
+public:
+    // workerCount fork-join threads besides the caller; 0 makes ParallelFor serial.
+    explicit DefaultTaskService(uint32_t workerCount) {
+        m_slotCount = workerCount + 1; // Slot 0 belongs to whichever thread submits the job
+        m_slots = std::make_unique<WorkerSlot[]>(m_slotCount);
+        m_threads.reserve(workerCount);
+        for (uint32_t slot = 1; slot < m_slotCount; ++slot) {
+            m_threads.emplace_back([this, slot] { WorkerLoop(slot); });
+        }
+    }
+
+    ~DefaultTaskService() override {
+        {
+            // Jobs still queued run before the threads exit: a dropped job would leave whatever
+            // it was going to complete (a PendingPipeline, say) pending forever.
+            std::scoped_lock lock(m_backgroundMutex);
+            m_backgroundStop = true;
+        }
+        m_backgroundCv.notify_all();
+        for (auto& thread : m_backgroundThreads) {
+            thread.join();
+        }
+        m_stop.store(true, std::memory_order_release);
+        for (uint32_t slot = 1; slot < m_slotCount; ++slot) {
+            m_slots[slot].wake.release();
+        }
+        for (auto& thread : m_threads) {
+            thread.join();
+        }
+    }
+
+    void SubmitBackground(std::string_view taskName, std::function<void()> job) override {
+        {
+            std::scoped_lock lock(m_backgroundMutex);
+            // Started on first use and kept apart from the fork-join workers, so a long job never
+            // delays a frame's ParallelFor. Half the workers: background work shares the cores.
+            if (m_backgroundThreads.empty()) {
+                const uint32_t backgroundCount = std::max<uint32_t>(1, (m_slotCount - 1) / 2);
+                m_backgroundThreads.reserve(backgroundCount);
+                for (uint32_t i = 0; i < backgroundCount; ++i) {
+                    m_backgroundThreads.emplace_back([this] { BackgroundLoop(); });
+                }
+            }
+            m_backgroundJobs.push_back(BackgroundJob{ std::string(taskName), std::move(job) });
+        }
+        m_backgroundCv.notify_one();
+    }
+
+    void WaitForBackgroundIdle() override {
+        std::unique_lock lock(m_backgroundMutex);
+        m_backgroundIdleCv.wait(lock, [this] { return m_backgroundJobs.empty() && m_backgroundRunning == 0; });
+    }
+
+    void ParallelFor(std::string_view taskName, size_t itemCount, std::function<void(size_t)> func) override {
+        ParallelForChunked(taskName, itemCount, {}, [&func](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                func(i);
+            }
+        });
+    }
+
+    void ParallelForRange(std::string_view taskName, size_t itemCount, const TaskRangeOptions& options, TaskRangeBody body) override {
+        if (itemCount == 0) {
+            return;
+        }
+        uint32_t participants = m_slotCount;
+        if (options.maxWorkers != 0) {
+            participants = std::min(participants, options.maxWorkers);
+        }
+        if (t_insideTaskService || participants <= 1 || itemCount == 1) {
+            body(0, itemCount);
+            return;
+        }
+        // One job owns the pool at a time; a concurrent caller would only queue behind it.
+        std::unique_lock submitLock(m_submitMutex, std::try_to_lock);
+        if (!submitLock.owns_lock()) {
+            body(0, itemCount);
+            return;
+        }
+
+        ZoneScopedN("DefaultTaskService::ParallelFor");
+        ZoneText(taskName.data(), taskName.size());
+
+        size_t grain = options.grainSize;
+        if (grain == 0) {
+            grain = std::max<size_t>(1, itemCount / (size_t(participants) * kChunksPerWorker));
+        }
+        constexpr size_t kMaxChunks = std::numeric_limits<uint32_t>::max();
+        if ((itemCount + grain - 1) / grain > kMaxChunks) {
+            grain = (itemCount + kMaxChunks - 1) / kMaxChunks;
+        }
+        const uint32_t chunkCount = static_cast<uint32_t>((itemCount + grain - 1) / grain);
+        participants = std::min(participants, chunkCount);
+        if (participants <= 1) {
+            body(0, itemCount);
+            return;
+        }
+
+        m_body = body;
+        m_itemCount = itemCount;
+        m_grain = grain;
+        m_participants = participants;
+        m_failed.store(false, std::memory_order_relaxed);
+        m_error = nullptr;
+        m_remainingChunks.store(chunkCount, std::memory_order_relaxed);
+        m_activeWorkers.store(participants - 1, std::memory_order_relaxed);
+        for (uint32_t slot = 0; slot < m_slotCount; ++slot) {
+            uint64_t range = PackRange(0, 0);
+            if (slot < participants) {
+                if (options.stableAffinity) {
+                    range = PackRange(
+                        static_cast<uint32_t>(uint64_t(chunkCount) * slot / participants),
+                        static_cast<uint32_t>(uint64_t(chunkCount) * (slot + 1) / participants));
+                }
+                else if (slot == 0) {
+                    range = PackRange(0, chunkCount); // Everything starts with the caller; workers steal
+                }
+            }
+            m_slots[slot].range.store(range, std::memory_order_relaxed);
+        }
+        for (uint32_t slot = 1; slot < participants; ++slot) {
+            m_slots[slot].wake.release();
+        }
+
+        t_insideTaskService = true;
+        RunChunks(0);
+        while (m_remainingChunks.load(std::memory_order_acquire) != 0
+            || m_activeWorkers.load(std::memory_order_acquire) != 0) {
+            std::this_thread::yield();
+        }
+        t_insideTaskService = false;
+
+        if (m_error) {
+            std::rethrow_exception(std::exchange(m_error, nullptr));
+        }
+    }
+
+private:
+    struct BackgroundJob {
+        std::string name;
+        std::function<void()> job;
+    };
+
+    void BackgroundLoop() {
+        t_insideTaskService = true;
+        for (;;) {
+            BackgroundJob next;
+            {
+                std::unique_lock lock(m_backgroundMutex);
+                m_backgroundCv.wait(lock, [this] { return m_backgroundStop || !m_backgroundJobs.empty(); });
+                if (m_backgroundJobs.empty()) {
+                    return; // Stopped with nothing left
+                }
+                next = std::move(m_backgroundJobs.front());
+                m_backgroundJobs.pop_front();
+                ++m_backgroundRunning;
+            }
+            ZoneScopedN("DefaultTaskService::Background");
+            ZoneText(next.name.data(), next.name.size());
+            try {
+                next.job();
+            }
+            catch (const std::exception& e) {
+                spdlog::error("Background task '{}' threw: {}", next.name, e.what());
+            }
+            catch (...) {
+                spdlog::error("Background task '{}' threw a non-standard exception", next.name);
+            }
+            {
+                std::scoped_lock lock(m_backgroundMutex);
+                --m_backgroundRunning;
+            }
+            m_backgroundIdleCv.notify_all();
+        }
+    }
+
+    void WorkerLoop(uint32_t slot) {
+        t_insideTaskService = true;
+        WorkerSlot& self = m_slots[slot];
+        for (;;) {
+            // Spin briefly before sleeping so back-to-back ParallelFor calls in one frame don't
+            // pay a full OS wake-up each time.
+            bool woken = false;
+            for (int spin = 0; spin < kWorkerSpinIterations && !woken; ++spin) {
+                woken = self.wake.try_acquire();
+                if (!woken) {
+                    std::this_thread::yield();
+                }
+            }
+            if (!woken) {
+                self.wake.acquire();
+            }
+            if (m_stop.load(std::memory_order_acquire)) {
+                return;
+            }
+            RunChunks(slot);
+            m_activeWorkers.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    }
+
+    void RunChunks(uint32_t slot) {
+        uint32_t chunk = 0;
+        for (;;) {
+            if (PopOwn(slot, chunk)) {
+                ExecuteChunk(chunk);
+                continue;
+            }
+            // Nothing left anywhere once a full steal sweep fails; chunks a thief took but has not
+            // published yet are run by that thief.
+            if (!Steal(slot)) {
+                return;
+            }
+        }
+    }
+
+    bool PopOwn(uint32_t slot, uint32_t& chunk) {
+        auto& range = m_slots[slot].range;
+        uint64_t packed = range.load(std::memory_order_acquire);
+        for (;;) {
+            const uint32_t begin = RangeBegin(packed);
+            if (begin >= RangeEnd(packed)) {
+                return false;
+            }
+            if (range.compare_exchange_weak(packed, PackRange(begin + 1, RangeEnd(packed)), std::memory_order_acq_rel)) {
+                chunk = begin;
+                return true;
+            }
+        }
+    }
+
+    bool Steal(uint32_t thiefSlot) {
+        for (uint32_t offset = 1; offset < m_participants; ++offset) {
+            const uint32_t victim = (thiefSlot + offset) % m_participants;
+            auto& range = m_slots[victim].range;
+            uint64_t packed = range.load(std::memory_order_acquire);
+            for (;;) {
+                const uint32_t begin = RangeBegin(packed);
+                const uint32_t end = RangeEnd(packed);
+                if (begin >= end) {
+                    break;
+                }
+                const uint32_t mid = end - (end - begin + 1) / 2;
+                if (range.compare_exchange_weak(packed, PackRange(begin, mid), std::memory_order_acq_rel)) {
+                    m_slots[thiefSlot].range.store(PackRange(mid, end), std::memory_order_release);
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+
+    void ExecuteChunk(uint32_t chunk) {
+        if (!m_failed.load(std::memory_order_relaxed)) {
+            const size_t begin = size_t(chunk) * m_grain;
+            try {
+                m_body(begin, std::min(m_itemCount, begin + m_grain));
+            }
+            catch (...) {
+                std::lock_guard lock(m_errorMutex);
+                if (!m_error) {
+                    m_error = std::current_exception();
+                }
+                m_failed.store(true, std::memory_order_relaxed);
+            }
+        }
+        m_remainingChunks.fetch_sub(1, std::memory_order_acq_rel);
+    }
+
+    uint32_t m_slotCount = 1;
+    std::unique_ptr<WorkerSlot[]> m_slots;
+    std::vector<std::thread> m_threads;
+    std::atomic<bool> m_stop{ false };
+    std::mutex m_submitMutex;
+
+    // Current job; written by the submitting thread before workers are woken.
+    TaskRangeBody m_body{};
+    size_t m_itemCount = 0;
+    size_t m_grain = 1;
+    uint32_t m_participants = 0;
+    std::atomic<uint32_t> m_remainingChunks{ 0 };
+    std::atomic<uint32_t> m_activeWorkers{ 0 };
+    std::atomic<bool> m_failed{ false };
+    std::mutex m_errorMutex;
+    std::exception_ptr m_error;
+
+    std::mutex m_backgroundMutex;
+    std::condition_variable m_backgroundCv;
+    std::condition_variable m_backgroundIdleCv;
+    std::deque<BackgroundJob> m_backgroundJobs;
+    uint32_t m_backgroundRunning = 0;
+    std::vector<std::thread> m_backgroundThreads;
+    bool m_backgroundStop = false;
+};
+}
+
+std::shared_ptr<ITaskService> CreateDefaultTaskService(uint32_t workerCount) {
+    if (workerCount == 0) {
+        const uint32_t hardwareThreads = std::thread::hardware_concurrency();
+        workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+    }
+    return std::make_shared<DefaultTaskService>(workerCount);
+}
+
+std::shared_ptr<ITaskService> CreateSerialTaskService() {
+    return std::make_shared<DefaultTaskService>(0);
+}
+
+}
@@ -1,6 +1,8 @@
 #include "Render/Runtime/IUploadService.h"
 
 #include "Managers/Singletons/DeletionManager.h"
+#include "Managers/Singletons/ECSManager.h"
+#include "Managers/Singletons/TextureRecyclePool.h"
 #include "Managers/Singletons/UploadManager.h"
 
 namespace rg::runtime {
@@ -20,6 +22,14 @@ public:
         return UploadManager::GetInstance().GetUploadPass();
     }
 
+    std::shared_ptr<CopyPass> GetResourceCopyPass() override {
+        return UploadManager::GetInstance().GetResourceCopyPass();
+    }
+
+    void SetTaskService(std::shared_ptr<ITaskService> taskService) override {
+        UploadManager::GetInstance().SetTaskService(std::move(taskService));
+    }
+
 #if BUILD_TYPE == BUILD_TYPE_DEBUG
     void UploadData(const void* data, size_t size, UploadTarget resourceToUpdate, size_t dataBufferOffset, const char* file, int line) override {
         UploadManager::GetInstance().UploadData(data, size, std::move(resourceToUpdate), dataBufferOffset, file, line);
@@ -50,6 +60,10 @@ public:
             file,
             line);
     }
+
+    UploadReservation ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size, const char* file, int line) override {
+        return UploadManager::GetInstance().ReserveUpload(std::move(resourceToUpdate), dataBufferOffset, size, file, line);
+    }
 #else
     void UploadData(const void* data, size_t size, UploadTarget resourceToUpdate, size_t dataBufferOffset) override {
         UploadManager::GetInstance().UploadData(data, size, std::move(resourceToUpdate), dataBufferOffset);
@@ -76,8 +90,16 @@ public:
             srcSubresources,
             srcCount);
     }
+
+    UploadReservation ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size) override {
+        return UploadManager::GetInstance().ReserveUpload(std::move(resourceToUpdate), dataBufferOffset, size);
+    }
 #endif
 
+    void CommitUpload(UploadReservation&& reservation) override {
+        UploadManager::GetInstance().CommitUpload(std::move(reservation));
+    }
+
     void QueueResourceCopy(const std::shared_ptr<Resource>& destination, const std::shared_ptr<Resource>& source, size_t size) override {
         UploadManager::GetInstance().QueueResourceCopy(destination, source, size);
     }
@@ -85,22 +107,116 @@ public:
     void ProcessDeferredReleases(uint8_t frameIndex) override {
         UploadManager::GetInstance().ProcessDeferredReleases(frameIndex);
         DeletionManager::GetInstance().ProcessDeletions();
+        TextureRecyclePool::GetInstance().ProcessFrame();
+        ECSManager::GetInstance().FlushQueuedTrackedEntities();
     }
 
     void QueueStreamingUpload(const void* data, size_t size,
                               std::shared_ptr<Resource> destination,
-                              size_t dstOffset) override {
-        UploadManager::GetInstance().QueueStreamingUpload(data, size, std::move(destination), dstOffset);
+                              size_t dstOffset,
+                              StreamingUploadPriority priority) override {
+        UploadManager::GetInstance().QueueStreamingUpload(data, size, std::move(destination), dstOffset, priority);
+    }
+
+    void QueueStreamingTextureUpload(std::shared_ptr<Resource> destination,
+                                     rhi::Format fmt,
+                                     uint32_t baseWidth,
+                                     uint32_t baseHeight,
+                                     uint32_t depthOrLayers,
+                                     uint32_t mipLevels,
+                                     uint32_t arraySize,
+                                     const rhi::helpers::SubresourceData* srcSubresources,
+                                     uint32_t srcCount,
+                                     StreamingUploadPriority priority) override {
+        UploadManager::GetInstance().QueueStreamingTextureUpload(
+            std::move(destination),
+            fmt,
+            baseWidth,
+            baseHeight,
+            depthOrLayers,
+            mipLevels,
+            arraySize,
+            srcSubresources,
+            srcCount,
+            priority);
+    }
+
+    std::shared_ptr<StreamingUploadTicket> QueueStreamingFileUpload(
+        const StreamingFileSource& source,
+        std::shared_ptr<Resource> destination,
+        size_t dstOffset,
+        StreamingUploadPriority priority) override {
+        return UploadManager::GetInstance().QueueStreamingFileUpload(source, std::move(destination), dstOffset, priority);
+    }
+
+    std::shared_ptr<StreamingUploadTicket> QueueStreamingFileTextureUpload(
+        const StreamingFileSource& source,
+        std::shared_ptr<Resource> destination,
+        std::vector<StreamingTextureFootprint> footprints,
+        StreamingUploadPriority priority) override {
+        return UploadManager::GetInstance().QueueStreamingFileTextureUpload(
+            source, std::move(destination), std::move(footprints), priority);
     }
 
     std::vector<StreamingUploadDescriptor> ConsumeStreamingUploads() override {
         return UploadManager::GetInstance().ConsumeStreamingUploads();
     }
 
+    StreamingUploadStats GetStreamingUploadStats() const override {
+        return UploadManager::GetInstance().GetStreamingUploadStats();
+    }
+
+    void CloseStreamingUploadRegion(uint64_t copyFenceValue) override {
+        UploadManager::GetInstance().CloseStreamingUploadRegion(copyFenceValue);
+    }
+
+    void ReclaimStreamingPagePool(uint64_t completedCopyFenceValue) override {
+        UploadManager::GetInstance().ReclaimStreamingPagePool(completedCopyFenceValue);
+    }
+
     void ResetStreamingPagePool() override {
         UploadManager::GetInstance().ResetStreamingPagePool();
     }
 
+    void RegisterStreamingDecompressor(std::shared_ptr<IStreamingDecompressor> decompressor) override {
+        UploadManager::GetInstance().RegisterStreamingDecompressor(std::move(decompressor));
+    }
+
+    void QueueStreamingCompressedUpload(uint32_t codec,
+                                        const void* data, size_t compressedSize, size_t uncompressedSize,
+                                        std::shared_ptr<Resource> destination, size_t dstOffset) override {
+        UploadManager::GetInstance().QueueStreamingCompressedUpload(
+            codec, data, compressedSize, uncompressedSize, std::move(destination), dstOffset);
+    }
+
+    std::vector<StreamingDecompressionJob> ConsumeStreamingDecompressionJobs() override {
+        return UploadManager::GetInstance().ConsumeStreamingDecompressionJobs();
+    }
+
+    std::vector<std::shared_ptr<IStreamingDecompressor>> GetStreamingDecompressors() const override {
+        return UploadManager::GetInstance().GetStreamingDecompressors();
+    }
+
+    StreamingDecompressionStats GetStreamingDecompressionStats() const override {
+        return UploadManager::GetInstance().GetStreamingDecompressionStats();
+    }
+
+    void RegisterMipGenerator(std::shared_ptr<IMipGenerator> generator) override {
+        UploadManager::GetInstance().RegisterMipGenerator(std::move(generator));
+    }
+
+    void QueueMipGeneration(UploadTarget target, uint32_t sourceMip, uint32_t mipCount, uint32_t firstSlice, uint32_t sliceCount) override {
+        UploadManager::GetInstance().QueueMipGeneration(std::move(target), sourceMip, mipCount, firstSlice, sliceCount);
+    }
+
+    std::vector<MipGenerationJob> ConsumeMipGenerationJobs() override {
+        return UploadManager::GetInstance().ConsumeMipGenerationJobs();
+    }
+
+    std::shared_ptr<IMipGenerator> GetMipGenerator() const override {
+        return UploadManager::GetInstance().GetMipGenerator();
+    }
+
     void Cleanup() override {
         UploadManager::GetInstance().Cleanup();
     }
@@ -0,0 +1,392 @@
+#include "Render/TextureMipStreamer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Render/Runtime/IReadbackService.h"
+#include "Render/Runtime/UploadServiceAccess.h"
+#include "Resources/Buffers/Buffer.h"
+#include "Resources/DynamicResource.h"
+#include "Resources/PixelBuffer.h"
+
+namespace {
+	// A feedback readback that never lands (its pass was culled or renamed) is re-requested after
+	// this many intervals.
+	constexpr uint64_t kFeedbackTimeoutIntervals = 8;
+
+	uint64_t FootprintBytes(const StreamingTextureFootprint& fp) {
+		return static_cast<uint64_t>(fp.footprint.rowPitch) * fp.footprint.height * fp.footprint.depth;
+	}
+
+	// Description of a backing that holds mips [firstMip, mipCount) of every slice.
+	TextureDescription MakeMipRangeDescription(const TextureDescription& full, const std::vector<StreamingTextureFootprint>& footprints, uint32_t firstMip, uint32_t mipCount, uint32_t sliceCount) {
+		TextureDescription desc = full;
+		desc.generateMipMaps = false;
+		desc.padInternalResolution = false;
+		desc.allowAlias = false;
+		desc.aliasingPoolID.reset();
+		desc.imageDimensions.clear();
+		desc.imageDimensions.reserve(static_cast<size_t>(mipCount - firstMip) * sliceCount);
+		const bool perSubresource = full.imageDimensions.size() == static_cast<size_t>(mipCount) * sliceCount;
+		const uint32_t baseWidth = full.imageDimensions.empty() ? 1u : full.imageDimensions[0].width;
+		const uint32_t baseHeight = full.imageDimensions.empty() ? 1u : full.imageDimensions[0].height;
+		for (uint32_t slice = 0; slice < sliceCount; ++slice) {
+			for (uint32_t mip = firstMip; mip < mipCount; ++mip) {
+				if (perSubresource) {
+					desc.imageDimensions.push_back(full.imageDimensions[static_cast<size_t>(slice) * mipCount + mip]);
+					continue;
+				}
+				ImageDimensions dims{
+					.width = (std::max)(1u, baseWidth >> mip),
+					.height = (std::max)(1u, baseHeight >> mip),
+				};
+				for (const auto& fp : footprints) {
+					if (fp.mip == mip && fp.slice == slice) {
+						dims.rowPitch = fp.footprint.rowPitch;
+						dims.slicePitch = static_cast<uint64_t>(fp.footprint.rowPitch) * fp.footprint.height;
+						break;
+					}
+				}
+				desc.imageDimensions.push_back(dims);
+			}
+		}
+		return desc;
+	}
+}
+
+TextureMipStreamer::TextureMipStreamer(uint32_t maxTextures, Settings settings)
+	: m_settings(settings)
+	, m_feedbackInbox(std::make_shared<FeedbackInbox>()) {
+	m_feedbackBuffer = Buffer::CreateUnmaterializedStructuredBuffer((std::max)(1u, maxTextures), sizeof(uint32_t), true);
+	m_feedbackBuffer->SetName("RG Mip Streaming Feedback");
+	m_feedbackBuffer->Materialize();
+	m_entries.reserve(maxTextures);
+	m_freeIDs.reserve(maxTextures);
+	for (uint32_t id = maxTextures; id > 0; --id) {
+		m_freeIDs.push_back(id - 1);
+	}
+	m_entries.resize(maxTextures);
+}
+
+TextureMipStreamer::~TextureMipStreamer() = default;
+
+TextureMipStreamer::TextureID TextureMipStreamer::Register(TextureSource source) {
+	if (m_freeIDs.empty() || source.footprints.empty()) {
+		return kInvalidTexture;
+	}
+
+	uint32_t mipCount = 1;
+	uint32_t sliceCount = 1;
+	for (const auto& fp : source.footprints) {
+		mipCount = (std::max)(mipCount, fp.mip + 1);
+		sliceCount = (std::max)(sliceCount, fp.slice + 1);
+	}
+
+	std::lock_guard<std::mutex> lock(m_reportMutex);
+	const TextureID id = m_freeIDs.back();
+	Entry& entry = m_entries[id];
+	entry = Entry{};
+	entry.mipCount = mipCount;
+	entry.sliceCount = sliceCount;
+	entry.tailMip = mipCount - std::clamp(source.residentTailMips, 1u, mipCount);
+	entry.bytesFromMip.assign(mipCount, 0);
+	for (const auto& fp : source.footprints) {
+		for (uint32_t mip = 0; mip <= fp.mip; ++mip) {
+			entry.bytesFromMip[mip] += FootprintBytes(fp);
+		}
+	}
+	entry.source = std::move(source);
+	entry.residentMip = entry.tailMip;
+	entry.desiredMip = entry.tailMip;
+
+	// The tail backing is the handle's from the start, so there is always something to sample; its
+	// load completes like any other.
+	if (!StartLoad(entry, entry.tailMip, StreamingUploadPriority::High)) {
+		entry = Entry{};
+		return kInvalidTexture;
+	}
+	entry.handle = std::make_shared<DynamicGloballyIndexedResource>(entry.pending.texture);
+	entry.live = true;
+	m_freeIDs.pop_back();
+	m_residentBytes += entry.bytesFromMip[entry.tailMip];
+	m_projectedBytes += entry.bytesFromMip[entry.tailMip];
+	++m_stats.registeredTextures;
+	return id;
+}
+
+void TextureMipStreamer::Unregister(TextureID id) {
+	if (id >= m_entries.size() || !m_entries[id].live) {
+		return;
+	}
+	std::lock_guard<std::mutex> lock(m_reportMutex);
+	Entry& entry = m_entries[id];
+	m_residentBytes -= entry.bytesFromMip[entry.residentMip];
+	m_projectedBytes -= ProjectedBytes(entry);
+	if (entry.hasPending) {
+		--m_loadsInFlight;
+	}
+	entry = Entry{};
+	m_freeIDs.push_back(id);
+	--m_stats.registeredTextures;
+}
+
+std::shared_ptr<DynamicGloballyIndexedResource> TextureMipStreamer::GetTexture(TextureID id) const {
+	return id < m_entries.size() ? m_entries[id].handle : nullptr;
+}
+
+uint32_t TextureMipStreamer::GetResidentMip(TextureID id) const {
+	return id < m_entries.size() ? m_entries[id].residentMip : 0;
+}
+
+void TextureMipStreamer::ReportDesiredMip(TextureID id, uint32_t mip) {
+	std::lock_guard<std::mutex> lock(m_reportMutex);
+	if (id < m_entries.size() && m_entries[id].live) {
+		m_entries[id].reportedMip = (std::min)(m_entries[id].reportedMip, mip);
+	}
+}
+
+uint64_t TextureMipStreamer::ProjectedBytes(const Entry& entry) const {
+	return entry.bytesFromMip[entry.hasPending ? entry.pending.mip : entry.residentMip];
+}
+
+bool TextureMipStreamer::StartLoad(Entry& entry, uint32_t mip, StreamingUploadPriority priority) {
+	const auto& source = entry.source;
+
+	// Only the file range holding the selected mips is read; footprints are rebased onto it.
+	std::vector<StreamingTextureFootprint> footprints;
+	uint64_t rangeBegin = UINT64_MAX;
+	uint64_t rangeEnd = 0;
+	for (const auto& fp : source.footprints) {
+		if (fp.mip < mip) {
+			continue;
+		}
+		rangeBegin = (std::min)(rangeBegin, fp.footprint.offset);
+		rangeEnd = (std::max)(rangeEnd, fp.footprint.offset + FootprintBytes(fp));
+		footprints.push_back(fp);
+	}
+	if (footprints.empty()) {
+		return false;
+	}
+	for (auto& fp : footprints) {
+		fp.mip -= mip;
+		fp.footprint.offset -= rangeBegin;
+	}
+	StreamingFileSource file = source.file;
+	file.offset += rangeBegin;
+	file.size = rangeEnd - rangeBegin;
+
+	std::shared_ptr<PixelBuffer> texture;
+	try {
+		texture = PixelBuffer::CreateShared(MakeMipRangeDescription(source.desc, source.footprints, mip, entry.mipCount, entry.sliceCount));
+	}
+	catch (const std::exception& e) {
+		spdlog::warn("TextureMipStreamer: failed to create a backing from mip {}: {}", mip, e.what());
+		++m_stats.loadsFailed;
+		return false;
+	}
+	const std::string baseName = entry.handle ? entry.handle->GetName() : std::string("RG Streamed Texture");
+	texture->SetName(baseName);
+
+	entry.pending = PendingLoad{
+		.texture = texture,
+		.ticket = rg::runtime::QueueStreamingFileTextureUploadDispatch(file, texture, std::move(footprints), priority),
+		.mip = mip,
+	};
+	entry.hasPending = true;
+	++m_loadsInFlight;
+	++m_stats.loadsStarted;
+	return true;
+}
+
+void TextureMipStreamer::RequestFeedbackReadback(const UpdateContext& context) {
+	if (!context.readbackService || !context.feedbackPassName) {
+		return;
+	}
+	const uint64_t interval = (std::max)(1u, m_settings.feedbackIntervalFrames);
+	if (context.frameSerial < m_lastFeedbackRequestFrame + interval) {
+		return;
+	}
+	if (m_feedbackReadbackInFlight && context.frameSerial < m_lastFeedbackRequestFrame + interval * kFeedbackTimeoutIntervals) {
+		return;
+	}
+	std::weak_ptr<FeedbackInbox> weakInbox = m_feedbackInbox;
+	context.readbackService->RequestReadbackCapture(context.feedbackPassName, m_feedbackBuffer.get(), RangeSpec{}, [weakInbox](ReadbackCaptureResult&& result) {
+		auto inbox = weakInbox.lock();
+		if (!inbox) {
+			return;
+		}
+		const auto bytes = result.Bytes();
+		std::lock_guard<std::mutex> lock(inbox->mutex);
+		inbox->values.resize(bytes.size() / sizeof(uint32_t));
+		std::memcpy(inbox->values.data(), bytes.data(), inbox->values.size() * sizeof(uint32_t));
+		inbox->ready = true;
+	});
+	m_feedbackReadbackInFlight = true;
+	m_lastFeedbackRequestFrame = context.frameSerial;
+}
+
+void TextureMipStreamer::Update(const UpdateContext& context) {
+	ZoneScopedN("TextureMipStreamer::Update");
+
+	// Feedback: the GPU readback and CPU reports both lower the desired mip; a texture nobody has
+	// asked about for evictAfterFrames falls back to its tail.
+	std::vector<uint32_t> gpuFeedback;
+	{
+		std::lock_guard<std::mutex> lock(m_feedbackInbox->mutex);
+		if (m_feedbackInbox->ready) {
+			gpuFeedback = std::move(m_feedbackInbox->values);
+			m_feedbackInbox->values = {};
+			m_feedbackInbox->ready = false;
+			m_feedbackReadbackInFlight = false;
+			++m_stats.feedbackReadbacks;
+		}
+	}
+	{
+		std::lock_guard<std::mutex> lock(m_reportMutex);
+		for (TextureID id = 0; id < m_entries.size(); ++id) {
+			Entry& entry = m_entries[id];
+			if (!entry.live) {
+				continue;
+			}
+			uint32_t reported = entry.reportedMip;
+			entry.reportedMip = kNoFeedback;
+			if (id < gpuFeedback.size()) {
+				reported = (std::min)(reported, gpuFeedback[id]);
+			}
+			if (reported != kNoFeedback) {
+				entry.desiredMip = (std::min)(reported, entry.tailMip);
+				entry.lastWantedFrame = context.frameSerial;
+			}
+			else if (context.frameSerial > entry.lastWantedFrame + m_settings.evictAfterFrames) {
+				entry.desiredMip = entry.tailMip;
+			}
+		}
+	}
+	RequestFeedbackReadback(context);
+
+	// Swap in backings whose uploads have landed.
+	for (Entry& entry : m_entries) {
+		if (!entry.live || !entry.hasPending) {
+			continue;
+		}
+		auto& pending = entry.pending;
+		if (pending.ticket->HasFailed()) {
+			m_projectedBytes -= entry.bytesFromMip[pending.mip];
+			m_projectedBytes += entry.bytesFromMip[entry.residentMip];
+			++m_stats.loadsFailed;
+		}
+		else if (pending.ticket->IsComplete(context.completedCopyFenceValue)) {
+			entry.handle->SetResource(pending.texture);
+			m_residentBytes -= entry.bytesFromMip[entry.residentMip];
+			m_residentBytes += entry.bytesFromMip[pending.mip];
+			entry.residentMip = pending.mip;
+			++m_stats.loadsCompleted;
+		}
+		else {
+			continue;
+		}
+		entry.pending = {};
+		entry.hasPending = false;
+		--m_loadsInFlight;
+	}
+
+	// Loads land over later frames, so memory is judged at the size every texture is headed for.
+	auto beginLoad = [&](Entry& entry, uint32_t mip, StreamingUploadPriority priority) {
+		const uint64_t before = ProjectedBytes(entry);
+		if (!StartLoad(entry, mip, priority)) {
+			return false;
+		}
+		m_projectedBytes = m_projectedBytes - before + entry.bytesFromMip[mip];
+		return true;
+	};
+
+	std::vector<TextureID> upgrades;
+	std::vector<TextureID> coarsenable;
+	for (TextureID id = 0; id < m_entries.size(); ++id) {
+		const Entry& entry = m_entries[id];
+		if (!entry.live || entry.hasPending) {
+			continue;
+		}
+		if (entry.desiredMip < entry.residentMip) {
+			upgrades.push_back(id);
+		}
+		else if (entry.residentMip < entry.tailMip) {
+			coarsenable.push_back(id);
+		}
+	}
+	auto priorityOf = [&](const Entry& entry) {
+		return static_cast<float>(entry.residentMip - entry.desiredMip) * entry.source.priorityBias;
+	};
+	std::sort(upgrades.begin(), upgrades.end(), [&](TextureID a, TextureID b) {
+		return priorityOf(m_entries[a]) > priorityOf(m_entries[b]);
+	});
+	// Textures holding more than they want go first, then the least recently wanted.
+	std::sort(coarsenable.begin(), coarsenable.end(), [&](TextureID a, TextureID b) {
+		const Entry& ea = m_entries[a];
+		const Entry& eb = m_entries[b];
+		const bool overA = ea.desiredMip > ea.residentMip;
+		const bool overB = eb.desiredMip > eb.residentMip;
+		if (overA != overB) {
+			return overA;
+		}
+		return ea.lastWantedFrame < eb.lastWantedFrame;
+	});
+
+	size_t nextCoarsen = 0;
+	auto coarsenOne = [&](bool onlyOverResident) {
+		while (nextCoarsen < coarsenable.size() && m_loadsInFlight < m_settings.maxLoadsInFlight) {
+			Entry& victim = m_entries[coarsenable[nextCoarsen]];
+			const bool overResident = victim.desiredMip > victim.residentMip;
+			if (onlyOverResident && !overResident) {
+				return false;
+			}
+			++nextCoarsen;
+			const uint32_t target = overResident ? victim.desiredMip : victim.residentMip + 1;
+			if (beginLoad(victim, target, StreamingUploadPriority::Low)) {
+				++m_stats.coarsenings;
+				return true;
+			}
+		}
+		return false;
+	};
+
+	while (m_projectedBytes > m_settings.budgetBytes && coarsenOne(false)) {
+	}
+
+	for (const TextureID id : upgrades) {
+		if (m_loadsInFlight >= m_settings.maxLoadsInFlight) {
+			break;
+		}
+		Entry& entry = m_entries[id];
+		// The finest level that fits, at least one mip better than what is resident.
+		bool started = false;
+		for (uint32_t mip = entry.desiredMip; mip < entry.residentMip && !started; ++mip) {
+			const uint64_t projected = m_projectedBytes - ProjectedBytes(entry) + entry.bytesFromMip[mip];
+			if (projected > m_settings.budgetBytes) {
+				continue;
+			}
+			const auto priority = entry.residentMip == entry.tailMip ? StreamingUploadPriority::High : StreamingUploadPriority::Normal;
+			started = beginLoad(entry, mip, priority);
+		}
+		if (!started) {
+			++m_stats.upgradesDeferredForBudget;
+			// Make room for a later frame from textures that hold more than they want.
+			coarsenOne(true);
+		}
+	}
+
+	m_stats.budgetBytes = m_settings.budgetBytes;
+	m_stats.residentBytes = m_residentBytes;
+	m_stats.projectedBytes = m_projectedBytes;
+	m_stats.loadsInFlight = m_loadsInFlight;
+	TracyPlot("RG.MipStreaming.ResidentMB", static_cast<double>(m_residentBytes) / (1024.0 * 1024.0));
+	TracyPlot("RG.MipStreaming.LoadsInFlight", static_cast<int64_t>(m_loadsInFlight));
+}
+
+TextureMipStreamer::Stats TextureMipStreamer::GetStats() const {
+	return m_stats;
+}
@@ -0,0 +1,114 @@
+#include "Resources/Buffers/BufferDefragmenter.h"
+
+#include <algorithm>
+
+#include <spdlog/spdlog.h>
+#include <tracy/Tracy.hpp>
+
+#include "Resources/Buffers/DynamicBufferBase.h"
+
+BufferDefragmenter::BufferDefragmenter(Settings settings)
+    : m_settings(settings)
+{
+}
+
+void BufferDefragmenter::Register(const std::shared_ptr<BufferBase>& buffer) {
+    if (!buffer) {
+        return;
+    }
+    const BufferBase* key = buffer.get();
+    const bool known = std::any_of(m_entries.begin(), m_entries.end(), [&](const Entry& entry) {
+        return entry.key == key && !entry.buffer.expired();
+    });
+    if (!known) {
+        m_entries.push_back(Entry{ .buffer = buffer, .key = key });
+    }
+}
+
+void BufferDefragmenter::Unregister(const BufferBase* buffer) {
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        if (m_entries[i].key != buffer) {
+            continue;
+        }
+        m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(i));
+        if (m_cursor > i) {
+            --m_cursor;
+        }
+        return;
+    }
+}
+
+void BufferDefragmenter::BeginSweep() {
+    if (!m_sweepActive) {
+        ++m_stats.sweepsStarted;
+    }
+    m_sweepActive = true;
+    m_cursor = 0;
+}
+
+void BufferDefragmenter::Update(uint64_t frameSerial) {
+    m_stats.relocationsLastFrame = 0;
+    m_stats.bytesRelocatedLastFrame = 0;
+
+    if (!m_sweepActive && m_settings.sweepIntervalFrames > 0 && frameSerial >= m_lastSweepStartFrame + m_settings.sweepIntervalFrames) {
+        BeginSweep();
+    }
+    if (!m_sweepActive) {
+        return;
+    }
+    if (m_cursor == 0) {
+        m_lastSweepStartFrame = frameSerial;
+    }
+
+    ZoneScopedN("BufferDefragmenter::Update");
+    BufferBase::ScopedBackingMutation backingMutation;
+    uint64_t bytesThisFrame = 0;
+    while (m_cursor < m_entries.size()) {
+        Entry& entry = m_entries[m_cursor];
+        auto buffer = entry.buffer.lock();
+        if (!buffer) {
+            m_entries.erase(m_entries.begin() + static_cast<std::ptrdiff_t>(m_cursor));
+            continue;
+        }
+
+        const uint64_t size = buffer->GetBufferSize();
+        const bool movedRecently = entry.moved && frameSerial < entry.lastMovedFrame + m_settings.minFramesBetweenMoves;
+        if (size < m_settings.minBufferBytes || movedRecently || !buffer->CanRelocateBacking()) {
+            ++m_stats.skippedIneligible;
+            ++m_cursor;
+            continue;
+        }
+        // Always make progress, even on a buffer larger than the whole budget.
+        if (bytesThisFrame > 0 && bytesThisFrame + size > m_settings.bytesPerFrame) {
+            break;
+        }
+
+        if (buffer->RelocateBacking()) {
+            entry.moved = true;
+            entry.lastMovedFrame = frameSerial;
+            bytesThisFrame += size;
+            ++m_stats.relocations;
+            m_stats.bytesRelocated += size;
+            ++m_stats.relocationsLastFrame;
+            m_stats.bytesRelocatedLastFrame += size;
+        }
+        else {
+            ++m_stats.skippedIneligible;
+        }
+        ++m_cursor;
+    }
+
+    if (m_cursor >= m_entries.size()) {
+        m_sweepActive = false;
+        m_cursor = 0;
+        ++m_stats.sweepsCompleted;
+        spdlog::debug("BufferDefragmenter: sweep completed, {} relocations / {} bytes in total", m_stats.relocations, m_stats.bytesRelocated);
+    }
+    TracyPlot("RG.Defrag.BytesRelocated", static_cast<int64_t>(bytesThisFrame));
+}
+
+BufferDefragmenter::Stats BufferDefragmenter::GetStats() const {
+    Stats stats = m_stats;
+    stats.registeredBuffers = m_entries.size();
+    return stats;
+}
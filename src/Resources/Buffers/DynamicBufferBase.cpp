@@ -1,10 +1,14 @@
 #include "Resources/Buffers/DynamicBufferBase.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
 #include <stdexcept>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <utility>
 
 #include <spdlog/spdlog.h>
 
@@ -14,9 +18,13 @@
 #include "Resources/ExternalBackingResource.h"
 #include "Render/Runtime/UploadServiceAccess.h"
 #include "Render/Runtime/UploadPolicyServiceAccess.h"
+#include "Render/Runtime/OpenRenderGraphSettings.h"
 
 namespace {
     thread_local uint32_t g_backingMutationScopeDepth = 0;
+    std::atomic_size_t g_directWriteBufferCount{ 0 };
+    std::atomic_uint64_t g_totalResizeCount{ 0 };
+    std::atomic_uint64_t g_totalResizeBytesCopied{ 0 };
 
     const char* HeapTypeToString(rhi::HeapType heapType) {
         switch (heapType) {
@@ -100,6 +108,9 @@ BufferBase::BufferBase(
 }
 
 BufferBase::~BufferBase() {
+    if (m_directWriteRegistered) {
+        g_directWriteBufferCount.fetch_sub(1, std::memory_order_relaxed);
+    }
     UnregisterUploadPolicyClient();
 }
 
@@ -156,6 +167,7 @@ void BufferBase::ConfigureBacking(
     m_accessType = accessType;
     m_bufferSize = bufferSize;
     m_unorderedAccess = unorderedAccess;
+    RefreshDirectWriteRegistration();
 }
 
 bool BufferBase::IsMaterialized() const {
@@ -178,6 +190,13 @@ uint64_t BufferBase::GetBackingGeneration() const {
     return m_backingGeneration;
 }
 
+TrackedHandle* BufferBase::GetCommittedAllocation() {
+    if (!m_dataBuffer || m_backingAliasPlacement.has_value() || m_dataBuffer->m_accessType != rhi::HeapType::DeviceLocal) {
+        return nullptr;
+    }
+    return &m_dataBuffer->m_bufferAllocation;
+}
+
 void BufferBase::Materialize(const MaterializeOptions* options) {
     if (m_dataBuffer) {
         return;
@@ -186,6 +205,21 @@ void BufferBase::Materialize(const MaterializeOptions* options) {
         throw std::runtime_error("Cannot materialize a zero-sized buffer");
     }
 
+    if (m_parkedBacking) {
+        if (options && options->aliasPlacement.has_value() && options->aliasPlacement.value() == m_parkedAliasPlacement) {
+            m_dataBuffer = std::move(m_parkedBacking);
+            m_backingAliasPlacement = m_parkedAliasPlacement;
+            if (std::exchange(m_parkedDescriptorsStale, false)) {
+                RefreshDescriptorContents();
+            }
+            ++m_backingGeneration;
+            OnBackingMaterialized();
+            return;
+        }
+        m_parkedBacking.reset();
+        m_parkedDescriptorsStale = false;
+    }
+
     if (options && options->aliasPlacement.has_value()) {
         m_dataBuffer = GpuBufferBacking::CreateUnique(
             m_accessType,
@@ -193,6 +227,7 @@ void BufferBase::Materialize(const MaterializeOptions* options) {
             GetGlobalResourceID(),
             options->aliasPlacement.value(),
             m_unorderedAccess);
+        m_backingAliasPlacement = options->aliasPlacement;
     }
     else {
         m_dataBuffer = GpuBufferBacking::CreateUnique(
@@ -200,6 +235,7 @@ void BufferBase::Materialize(const MaterializeOptions* options) {
             m_bufferSize,
             GetGlobalResourceID(),
             m_unorderedAccess);
+        m_backingAliasPlacement.reset();
     }
 
     ProbeVirtualShadowBufferStep(GetName(), "after backing create");
@@ -211,17 +247,51 @@ void BufferBase::Materialize(const MaterializeOptions* options) {
 }
 
 void BufferBase::Dematerialize() {
+    m_parkedBacking.reset();
+    m_parkedDescriptorsStale = false;
     if (!m_dataBuffer) {
         return;
     }
     m_dataBuffer.reset();
+    m_backingAliasPlacement.reset();
     ++m_backingGeneration;
 }
 
+void BufferBase::ParkAliasedBacking() {
+    if (!m_dataBuffer) {
+        return;
+    }
+    if (m_backingAliasPlacement.has_value()) {
+        m_parkedBacking = std::move(m_dataBuffer);
+        m_parkedAliasPlacement = m_backingAliasPlacement.value();
+        m_parkedDescriptorsStale = false;
+    }
+    else {
+        m_dataBuffer.reset();
+    }
+    m_backingAliasPlacement.reset();
+    ++m_backingGeneration;
+}
+
+void BufferBase::ReleaseParkedBacking() {
+    m_parkedBacking.reset();
+    m_parkedDescriptorsStale = false;
+}
+
+std::optional<BufferAliasPlacement> BufferBase::GetParkedAliasPlacement() const {
+    if (!m_parkedBacking) {
+        return std::nullopt;
+    }
+    return m_parkedAliasPlacement;
+}
+
 void BufferBase::SetDescriptorRequirements(const DescriptorRequirements& requirements) {
     m_descriptorRequirements = requirements;
 
     EnsureVirtualDescriptorSlotsAllocated();
+    if (m_parkedBacking) {
+        m_parkedDescriptorsStale = true;
+    }
     if (m_dataBuffer) {
         RefreshDescriptorContents();
     }
@@ -300,6 +370,7 @@ bool BufferBase::IsAliasingAllowed() const {
 void BufferBase::SetUploadPolicyTag(rg::runtime::UploadPolicyTag tag) {
     m_uploadPolicyTag = tag;
     RefreshUploadPolicyRegistration();
+    RefreshDirectWriteRegistration();
 }
 
 rg::runtime::UploadPolicyTag BufferBase::GetUploadPolicyTag() const {
@@ -310,6 +381,48 @@ bool BufferBase::IsUploadPolicyImmediate() const {
     return m_uploadPolicyTag == rg::runtime::UploadPolicyTag::Immediate;
 }
 
+rhi::HeapType BufferBase::ResolvePlacementHeapType(BufferPlacement placement, uint64_t bufferSize) {
+    if (placement != BufferPlacement::CpuVisibleDeviceLocal) {
+        return rhi::HeapType::DeviceLocal;
+    }
+    const auto settings = rg::runtime::GetOpenRenderGraphSettings();
+    if (!settings.cpuVisibleDeviceLocalHeapSupported || bufferSize > settings.cpuVisibleDeviceLocalMaxBufferBytes) {
+        return rhi::HeapType::DeviceLocal;
+    }
+    return kCpuVisibleDeviceLocalHeapType;
+}
+
+rhi::HeapType BufferBase::ResolveCpuWritableHeapType(uint64_t bufferSize) {
+    const rhi::HeapType heapType = ResolvePlacementHeapType(BufferPlacement::CpuVisibleDeviceLocal, bufferSize);
+    return heapType == rhi::HeapType::DeviceLocal ? rhi::HeapType::Upload : heapType;
+}
+
+bool BufferBase::IsCpuVisibleDeviceLocal() const {
+    return m_accessType == kCpuVisibleDeviceLocalHeapType;
+}
+
+bool BufferBase::IsDirectWriteEnabled() const {
+    return m_uploadPolicyTag == rg::runtime::UploadPolicyTag::DirectWrite && IsCpuVisibleDeviceLocal();
+}
+
+size_t BufferBase::GetDirectWriteBufferCount() {
+    return g_directWriteBufferCount.load(std::memory_order_relaxed);
+}
+
+void BufferBase::RefreshDirectWriteRegistration() {
+    const bool enabled = IsDirectWriteEnabled();
+    if (enabled == m_directWriteRegistered) {
+        return;
+    }
+    m_directWriteRegistered = enabled;
+    if (enabled) {
+        g_directWriteBufferCount.fetch_add(1, std::memory_order_relaxed);
+    }
+    else {
+        g_directWriteBufferCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
 void BufferBase::EnsureUploadPolicyRegistration() {
     if (m_uploadPolicyRegistered) {
         return;
@@ -402,6 +515,14 @@ void BufferBase::QueueResourceCopyFromOldBacking(uint64_t bytesToCopy) {
     if (!m_dataBuffer) {
         return;
     }
+    if (m_bytesUsedHighWater.has_value()) {
+        bytesToCopy = (std::min)(bytesToCopy, *m_bytesUsedHighWater);
+    }
+    if (bytesToCopy == 0) {
+        return;
+    }
+    m_resizeStats.bytesCopied += bytesToCopy;
+    g_totalResizeBytesCopied.fetch_add(bytesToCopy, std::memory_order_relaxed);
 
     auto oldBackingResource = ExternalBackingResource::CreateShared(std::move(m_dataBuffer));
     if (auto* uploadService = rg::runtime::GetActiveUploadService()) {
@@ -409,6 +530,112 @@ void BufferBase::QueueResourceCopyFromOldBacking(uint64_t bytesToCopy) {
     }
 }
 
+bool BufferBase::GrowBacking(uint64_t newBufferSize) {
+    if (newBufferSize <= m_bufferSize) {
+        return false;
+    }
+
+    ++m_resizeStats.resizeCount;
+    g_totalResizeCount.fetch_add(1, std::memory_order_relaxed);
+    if (!m_dataBuffer) {
+        ReleaseParkedBacking();
+        ConfigureBacking(m_accessType, newBufferSize, m_unorderedAccess);
+        return true;
+    }
+
+    QueueResourceCopyFromOldBacking(m_bufferSize);
+    m_backingAliasPlacement.reset();
+    ConfigureBacking(m_accessType, newBufferSize, m_unorderedAccess);
+    CreateAndSetBacking(m_accessType, newBufferSize, m_unorderedAccess);
+    return true;
+}
+
+bool BufferBase::CanRelocateBacking() const {
+    return m_dataBuffer
+        && !m_backingAliasPlacement.has_value()
+        && !m_parkedBacking
+        && !m_allowAlias
+        && m_accessType == rhi::HeapType::DeviceLocal
+        && m_bufferSize > 0;
+}
+
+bool BufferBase::RelocateBacking() {
+    if (!CanRelocateBacking()) {
+        return false;
+    }
+    auto* uploadService = rg::runtime::GetActiveUploadService();
+    if (!uploadService) {
+        return false;
+    }
+    if (!IsBackingMutationAllowedOnThisThread()) {
+        spdlog::error("BufferBase::RelocateBacking: '{}' relocated outside a backing mutation scope", GetName());
+        return false;
+    }
+
+    auto newBacking = GpuBufferBacking::CreateUnique(
+        m_accessType,
+        m_bufferSize,
+        GetGlobalResourceID(),
+        m_unorderedAccess);
+
+    // Frames in flight keep reading the old descriptors and backing until their fences pass.
+    if (HasAnyDescriptorSlots()) {
+        DescriptorHeapManager::GetInstance().RetireDescriptorSlots(DetachDescriptorSlotsForDeferredRelease());
+    }
+    const uint64_t bytesToCopy = (std::min)(m_bufferSize, m_bytesUsedHighWater.value_or(m_bufferSize));
+    auto oldBackingResource = ExternalBackingResource::CreateShared(std::move(m_dataBuffer));
+
+    m_dataBuffer = std::move(newBacking);
+    RefreshDescriptorContents();
+    ++m_backingGeneration;
+    OnBackingMaterialized();
+
+    if (bytesToCopy > 0) {
+        uploadService->QueueResourceCopy(shared_from_this(), oldBackingResource, bytesToCopy);
+    }
+    return true;
+}
+
+void BufferBase::SetGrowthPolicy(const GrowthPolicy& policy) {
+    m_growthPolicy = policy;
+    m_growthPolicy.growthFactor = (std::max)(1.0f, policy.growthFactor);
+}
+
+const BufferBase::GrowthPolicy& BufferBase::GetGrowthPolicy() const {
+    return m_growthPolicy;
+}
+
+uint64_t BufferBase::ComputeGrowthCapacity(uint64_t requiredBytes) const {
+    if (requiredBytes <= m_bufferSize) {
+        return m_bufferSize;
+    }
+    const auto grown = static_cast<uint64_t>(std::ceil(static_cast<double>(m_bufferSize) * static_cast<double>(m_growthPolicy.growthFactor)));
+    return (std::max)({ requiredBytes, grown, m_bufferSize + m_growthPolicy.minimumGrowthBytes });
+}
+
+void BufferBase::NoteBytesUsed(uint64_t endByte) {
+    m_bytesUsedHighWater = (std::max)(m_bytesUsedHighWater.value_or(0), (std::min)(endByte, m_bufferSize));
+}
+
+void BufferBase::ResetBytesUsed() {
+    m_bytesUsedHighWater.reset();
+}
+
+std::optional<uint64_t> BufferBase::GetBytesUsedHighWater() const {
+    return m_bytesUsedHighWater;
+}
+
+const BufferBase::ResizeStats& BufferBase::GetResizeStats() const {
+    return m_resizeStats;
+}
+
+BufferBase::ResizeStats BufferBase::GetTotalResizeStats() {
+    return ResizeStats{
+        .resizeCount = g_totalResizeCount.load(std::memory_order_relaxed),
+        .bytesCopied = g_totalResizeBytesCopied.load(std::memory_order_relaxed),
+    };
+}
+
 void BufferBase::ApplyMetadataToBacking(const EntityComponentBundle& bundle) {
     if (m_dataBuffer) {
         m_dataBuffer->ApplyMetadataComponentBundle(bundle);
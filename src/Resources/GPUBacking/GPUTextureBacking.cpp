@@ -164,10 +164,8 @@ void GpuTextureBacking::initialize(const TextureDescription& desc,
 		allocationBundle.Set<MemoryStatisticsComponents::ResourceName>({ name });
 	}
 
-	auto device = DeviceManager::GetInstance().GetDevice();
-
-	rhi::ResourceAllocationInfo allocInfo;
-	device.GetResourceAllocationInfo(&textureDesc, 1, &allocInfo);
+	rhi::ResourceAllocationInfo allocInfo = DeviceManager::GetInstance().GetResourceAllocationInfo(textureDesc);
+	m_allocationSizeBytes = allocInfo.sizeInBytes;
 
 	allocationBundle
 		.Set<MemoryStatisticsComponents::MemSizeBytes>({ allocInfo.sizeInBytes })
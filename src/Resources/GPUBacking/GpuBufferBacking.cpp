@@ -22,10 +22,8 @@ GpuBufferBacking::GpuBufferBacking(
         desc.resourceFlags |= rhi::ResourceFlags::RF_AllowUnorderedAccess;
     }
     desc.heapType = accessType;
-    auto device = DeviceManager::GetInstance().GetDevice();
 
-    rhi::ResourceAllocationInfo allocInfo;
-    device.GetResourceAllocationInfo(&desc, 1, &allocInfo);
+    rhi::ResourceAllocationInfo allocInfo = DeviceManager::GetInstance().GetResourceAllocationInfo(desc);
 
     AllocationTrackDesc trackDesc(owningResourceID);
     EntityComponentBundle allocationBundle;
@@ -5,6 +5,7 @@
 #include <stdexcept>
 
 #include "Managers/Singletons/DescriptorHeapManager.h"
+#include "Managers/Singletons/TextureRecyclePool.h"
 #include "Resources/GPUBacking/GPUTextureBacking.h"
 #include "Utilities/ORGUtilities.h"
 
@@ -100,7 +101,11 @@ PixelBuffer::PixelBuffer(const TextureDescription& desc, bool materialize)
     }
 }
 
-PixelBuffer::~PixelBuffer() = default;
+PixelBuffer::~PixelBuffer() {
+    if (m_backing && !m_backingAliasPlacement.has_value()) {
+        TextureRecyclePool::GetInstance().Retire(std::move(m_backing));
+    }
+}
 
 rhi::Resource PixelBuffer::GetAPIResource() {
     std::scoped_lock lock(m_materializationMutex);
@@ -136,6 +141,14 @@ bool PixelBuffer::HasValidBackingResource() const {
     return m_backing && m_backing->HasValidResource();
 }
 
+TrackedHandle* PixelBuffer::GetCommittedAllocation() {
+    std::scoped_lock lock(m_materializationMutex);
+    if (!m_backing || m_backingAliasPlacement.has_value()) {
+        return nullptr;
+    }
+    return &m_backing->GetAllocationHandle();
+}
+
 void PixelBuffer::ApplyMetadataComponentBundle(const EntityComponentBundle& bundle) const {
     std::scoped_lock lock(m_materializationMutex);
     m_metadataBundles.emplace_back(bundle);
@@ -157,6 +170,19 @@ void PixelBuffer::Materialize(const MaterializeOptions* options) {
         return;
     }
 
+    if (m_parkedBacking) {
+        // Same bytes of the same pool allocation: the parked API resource and the descriptors that
+        // still point at it are valid as-is. Contents are undefined either way; the graph
+        // re-activates the alias on first use.
+        if (options && options->aliasPlacement.has_value() && options->aliasPlacement.value() == m_parkedAliasPlacement) {
+            m_backing = std::move(m_parkedBacking);
+            m_backingAliasPlacement = m_parkedAliasPlacement;
+            ++m_backingGeneration;
+            return;
+        }
+        m_parkedBacking.reset();
+    }
+
     EnsureVirtualDescriptorSlotsAllocatedLocked();
 
     auto newDesc = m_desc;
@@ -169,9 +195,22 @@ void PixelBuffer::Materialize(const MaterializeOptions* options) {
 
     if (options && options->aliasPlacement.has_value()) {
         m_backing = GpuTextureBacking::CreateUnique(newDesc, GetGlobalResourceID(), options->aliasPlacement.value(), name.empty() ? nullptr : name.c_str());
+        m_backingAliasPlacement = options->aliasPlacement;
     }
     else {
-        m_backing = GpuTextureBacking::CreateUnique(newDesc, GetGlobalResourceID(), name.empty() ? nullptr : name.c_str());
+        m_backing = TextureRecyclePool::GetInstance().Acquire(newDesc);
+        if (m_backing) {
+            m_backing->ApplyMetadataComponentBundle(
+                EntityComponentBundle().Set<MemoryStatisticsComponents::ResourceID>({ GetGlobalResourceID() })
+            );
+            if (!name.empty()) {
+                m_backing->SetName(name.c_str());
+            }
+        }
+        else {
+            m_backing = GpuTextureBacking::CreateUnique(newDesc, GetGlobalResourceID(), name.empty() ? nullptr : name.c_str());
+        }
+        m_backingAliasPlacement.reset();
     }
 
     m_mipLevels = m_backing->GetMipLevels();
@@ -197,15 +236,52 @@ void PixelBuffer::Materialize(const MaterializeOptions* options) {
 }
 
 void PixelBuffer::Dematerialize() {
+    std::scoped_lock lock(m_materializationMutex);
+    m_parkedBacking.reset();
+    if (!m_backing) {
+        return;
+    }
+
+    if (m_backingAliasPlacement.has_value()) {
+        m_backing.reset();
+    }
+    else {
+        TextureRecyclePool::GetInstance().Retire(std::move(m_backing));
+    }
+    m_backingAliasPlacement.reset();
+    ++m_backingGeneration;
+}
+
+void PixelBuffer::ParkAliasedBacking() {
     std::scoped_lock lock(m_materializationMutex);
     if (!m_backing) {
         return;
     }
 
-    m_backing.reset();
+    if (m_backingAliasPlacement.has_value()) {
+        m_parkedBacking = std::move(m_backing);
+        m_parkedAliasPlacement = m_backingAliasPlacement.value();
+    }
+    else {
+        TextureRecyclePool::GetInstance().Retire(std::move(m_backing));
+    }
+    m_backingAliasPlacement.reset();
     ++m_backingGeneration;
 }
 
+void PixelBuffer::ReleaseParkedBacking() {
+    std::scoped_lock lock(m_materializationMutex);
+    m_parkedBacking.reset();
+}
+
+std::optional<TextureAliasPlacement> PixelBuffer::GetParkedAliasPlacement() const {
+    std::scoped_lock lock(m_materializationMutex);
+    if (!m_parkedBacking) {
+        return std::nullopt;
+    }
+    return m_parkedAliasPlacement;
+}
+
 void PixelBuffer::EnsureVirtualDescriptorSlotsAllocated() {
     std::scoped_lock lock(m_materializationMutex);
     EnsureVirtualDescriptorSlotsAllocatedLocked();
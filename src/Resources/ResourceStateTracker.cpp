@@ -1,7 +1,8 @@
 #include "Resources/ResourceStateTracker.h"
+#include <array>
 #include <optional>
 #include <algorithm>
-#include <unordered_map>
+#include <functional>
 
 #include "Resources/Resource.h"
 
@@ -134,20 +135,20 @@ static bool isEmpty(RangeSpec const &r) {
     return false;
 }
 
-// subtract the (assumed nonempty) 'cut' from 'orig', returning up to 4 remainders
-static std::vector<RangeSpec> subtract(RangeSpec orig, RangeSpec cut) {
-    std::vector<RangeSpec> out;
+// subtract the (assumed nonempty) 'cut' from 'orig', writing up to 4 remainders; returns the count
+static size_t subtract(RangeSpec orig, RangeSpec cut, std::array<RangeSpec, 4>& out) {
+    size_t count = 0;
     // left strip: all mips below cut.mipLower
     if (boundLower(orig.mipLower) < boundLower(cut.mipLower)) {
         RangeSpec r = orig;
         r.mipUpper = { BoundType::UpTo, boundLower(cut.mipLower) - 1 };
-        if (!isEmpty(r)) out.push_back(r);
+        if (!isEmpty(r)) out[count++] = r;
     }
     // right strip: all mips above cut.mipUpper
     if (boundUpper(orig.mipUpper) > boundUpper(cut.mipUpper)) {
         RangeSpec r = orig;
         r.mipLower = { BoundType::From, boundUpper(cut.mipUpper) + 1 };
-        if (!isEmpty(r)) out.push_back(r);
+        if (!isEmpty(r)) out[count++] = r;
     }
     // now the middle in the mip dimension
     RangeSpec mid = orig;
@@ -158,16 +159,16 @@ static std::vector<RangeSpec> subtract(RangeSpec orig, RangeSpec cut) {
     if (boundLower(orig.sliceLower) < boundLower(cut.sliceLower)) {
         RangeSpec r = mid;
         r.sliceUpper = { BoundType::UpTo, boundLower(cut.sliceLower) - 1 };
-        if (!isEmpty(r)) out.push_back(r);
+        if (!isEmpty(r)) out[count++] = r;
     }
     // bottom strip: slices above cut.sliceUpper
     if (boundUpper(orig.sliceUpper) > boundUpper(cut.sliceUpper)) {
         RangeSpec r = mid;
         r.sliceLower = { BoundType::From, boundUpper(cut.sliceUpper) + 1 };
-        if (!isEmpty(r)) out.push_back(r);
+        if (!isEmpty(r)) out[count++] = r;
     }
 
-    return out;
+    return count;
 }
 
 static RangeSpec intersect(RangeSpec A, RangeSpec B) {
@@ -240,7 +241,10 @@ static std::optional<Segment> tryMerge(Segment const &A, Segment const &B) {
     return std::nullopt;
 }
 
-static void mergeSymbolic(std::vector<Segment> &segs) {
+static void mergeSymbolic(SegmentList &segs) {
+    if (segs.size() <= 1) {
+        return;
+    }
     // sort by (sliceLower, sliceUpper, mipLower, mipUpper) numeric order
     std::sort(segs.begin(), segs.end(),
         [](auto const &L, auto const &R){
@@ -259,19 +263,16 @@ static void mergeSymbolic(std::vector<Segment> &segs) {
             return tL < tR;
         });
 
-    // sweep & merge
-    std::vector<Segment> out;
-    out.reserve(segs.size());
-    for (auto &seg : segs) {
-        if (!out.empty()) {
-            if (auto m = tryMerge(out.back(), seg)) {
-                out.back() = *m;
-                continue;
-            }
+    // sweep & merge in place; the write cursor never passes the read cursor
+    size_t written = 1;
+    for (size_t i = 1; i < segs.size(); ++i) {
+        if (auto m = tryMerge(segs[written - 1], segs[i])) {
+            segs[written - 1] = *m;
+            continue;
         }
-        out.push_back(seg);
+        segs[written++] = segs[i];
     }
-    segs.swap(out);
+    segs.resize_down(written);
 }
 
 
@@ -280,16 +281,57 @@ void SymbolicTracker::Apply(const RangeSpec& want,
     ResourceState newState,
     std::vector<ResourceTransition>& out)
 {
-    std::vector<Segment> next;
+    // Whole-resource requirement: every segment is covered, so emit one transition per
+    // differing segment and collapse to a single segment without splitting or re-merging.
+    if (IsWholeRangeSpec(want)) {
+        for (auto const &seg : _segs) {
+            if (seg.state == newState) {
+                continue;
+            }
+            out.push_back({
+                pRes, // resource
+                intersect(seg.rangeSpec, want),
+                seg.state.access,
+                newState.access,
+                seg.state.layout,
+                newState.layout,
+                seg.state.sync,
+                newState.sync
+                });
+        }
+        _segs.clear();
+        _segs.push_back({ want, newState });
+        return;
+    }
+
+    SegmentList next;
+    std::array<RangeSpec, 4> remainders;
     for (auto &seg : _segs) {
+        if (seg.rangeSpec == want) {
+            // Same range as an existing segment: it is replaced outright, nothing to split.
+            if (!(seg.state == newState)) {
+                out.push_back({
+                    pRes, // resource
+                    want,
+                    seg.state.access,
+                    newState.access,
+                    seg.state.layout,
+                    newState.layout,
+                    seg.state.sync,
+                    newState.sync
+                    });
+            }
+            continue;
+        }
         auto cut = intersect(seg.rangeSpec, want);
         if (isEmpty(cut)) {
             // no overlap: keep seg as-is
             next.push_back(seg);
         } else {
             // split seg by cut
-            for (auto &rem : subtract(seg.rangeSpec, cut))
-                next.push_back({ rem, seg.state });
+            const size_t remainderCount = subtract(seg.rangeSpec, cut, remainders);
+            for (size_t i = 0; i < remainderCount; ++i)
+                next.push_back({ remainders[i], seg.state });
 
             // record a transition over 'cut' if state differs
             if (!(seg.state == newState)) {
@@ -312,10 +354,13 @@ void SymbolicTracker::Apply(const RangeSpec& want,
 
     // merge back any adjacent segments with identical state & identical RangeSpec
     mergeSymbolic(next);
-    _segs.swap(next);
+    _segs = std::move(next);
 }
 
 bool SymbolicTracker::WouldModify(const RangeSpec& want, const ResourceState& newState) const {
+    if (_segs.size() == 1 && IsWholeRangeSpec(_segs[0].rangeSpec)) {
+        return !isEmpty(want) && !(_segs[0].state == newState);
+    }
     for (auto const &seg : _segs) {
         auto cut = intersect(seg.rangeSpec, want);
         if (!isEmpty(cut) && !(seg.state == newState))
@@ -334,147 +379,100 @@ std::vector<Segment> SymbolicTracker::Flatten(ResourceState const& skipState, bo
     return out;
 }
 
-const std::vector<Segment>& SymbolicTracker::GetSegments() const noexcept {
-	return _segs;
+std::span<const Segment> SymbolicTracker::GetSegments() const noexcept {
+	return { _segs.data(), _segs.size() };
 }
 
 void SymbolicTracker::CopyFrom(const SymbolicTracker& other) {
 	_segs = other._segs;
 }
 
+bool IsSplitBarrierCandidate(const ResourceTransition& transition) {
+    return transition.split == TransitionSplit::None
+        && transition.pResource != nullptr
+        && transition.pResource->HasLayout()
+        && transition.prevLayout != transition.newLayout;
+}
+
+std::pair<ResourceTransition, ResourceTransition> SplitTransition(const ResourceTransition& transition) {
+    ResourceTransition begin = transition;
+    begin.split = TransitionSplit::Begin;
+    begin.newSyncState = rhi::ResourceSyncState::SyncSplit;
+
+    ResourceTransition end = transition;
+    end.split = TransitionSplit::End;
+    end.prevSyncState = rhi::ResourceSyncState::SyncSplit;
+    return { begin, end };
+}
+
 bool ValidateNoConflictingTransitions(
     std::span<const ResourceTransition> transitions,
     TransitionConflict* outFirstConflict)
 {
-    // Group transition indices by resource pointer.
-    std::unordered_map<Resource*, std::vector<size_t>> perRes;
-    perRes.reserve(transitions.size());
-
-    for (size_t i = 0; i < transitions.size(); ++i) {
-        Resource* r = transitions[i].pResource;
-        if (!r) continue;
-        perRes[r].push_back(i);
-    }
-
-    auto emitConflict = [&](Resource* r, uint32_t mip, uint32_t slice, size_t a, size_t b) -> bool {
-        if (outFirstConflict) {
-            outFirstConflict->resource = r;
-            outFirstConflict->mip = mip;
-            outFirstConflict->slice = slice;
-            outFirstConflict->firstIdx = a;
-            outFirstConflict->secondIdx = b;
-        }
-        return false;
-        };
-
-    // Threshold: if totalMips * totalSlices is "reasonable", do exact cell-marking.
-    // Otherwise fall back to per-mip interval sweeping (still exact, but without big O(mips*slices) memory).
-    constexpr size_t kMaxDenseCells = 1u << 20; // ~1,048,576
+    // Expand every transition into one slice interval per mip it touches, sort the intervals by
+    // (resource, mip, first slice), and scan each (resource, mip) run for an interval that starts
+    // before the previous one ends. O(n log n) in the number of rows, with no per-resource
+    // allocation and no dense cell array, so it stays cheap on very large batches.
+    struct Row {
+        Resource* resource;
+        uint32_t  mip;
+        uint32_t  slice0;
+        uint32_t  slice1;
+        size_t    idx;
+    };
+    std::vector<Row> rows;
+    rows.reserve(transitions.size());
 
-    for (auto& [res, idxs] : perRes)
+    for (size_t ti = 0; ti < transitions.size(); ++ti)
     {
-        // You likely already have these; if not, adapt accordingly.
-        uint32_t totalMips = res->GetMipLevels();
-        uint32_t totalSlices = res->GetArraySize();
+        const auto& t = transitions[ti];
+        Resource* res = t.pResource;
+        if (!res) continue;
 
         // Defensive: treat 0 as 1 (buffers, etc.)
+        uint32_t totalMips = res->GetMipLevels();
+        uint32_t totalSlices = res->GetArraySize();
         totalMips = (totalMips == 0) ? 1u : totalMips;
         totalSlices = (totalSlices == 0) ? 1u : totalSlices;
 
-        // Pre-resolve all rectangles once.
-        struct Rect { uint32_t mip0, mip1, slice0, slice1; size_t idx; };
-        std::vector<Rect> rects;
-        rects.reserve(idxs.size());
-
-        for (size_t ti : idxs)
-        {
-            const auto& t = transitions[ti];
-            auto sr = ResolveRangeSpec(t.range, totalMips, totalSlices);
-            if (sr.mipCount == 0 || sr.sliceCount == 0) continue;
-
-            Rect r{};
-            r.mip0 = sr.firstMip;
-            r.mip1 = sr.firstMip + sr.mipCount - 1;
-            r.slice0 = sr.firstSlice;
-            r.slice1 = sr.firstSlice + sr.sliceCount - 1;
-            r.idx = ti;
-            rects.push_back(r);
-        }
-
-        // Nothing to validate.
-        if (rects.size() <= 1) continue;
-
-        // Try dense marking if small enough.
-        const size_t cells = size_t(totalMips) * size_t(totalSlices);
-        if (cells != 0 && cells <= kMaxDenseCells)
-        {
-            constexpr size_t kInvalid = (std::numeric_limits<size_t>::max)();
-            std::vector<size_t> owner(cells, kInvalid);
-
-            for (const Rect& r : rects)
-            {
-                for (uint32_t mip = r.mip0; mip <= r.mip1; ++mip)
-                {
-                    const size_t base = size_t(mip) * size_t(totalSlices);
-                    for (uint32_t slice = r.slice0; slice <= r.slice1; ++slice)
-                    {
-                        const size_t cell = base + size_t(slice);
-                        size_t& o = owner[cell];
-                        if (o == kInvalid) {
-                            o = r.idx;
-                        }
-                        else if (o != r.idx) {
-                            return emitConflict(res, mip, slice, o, r.idx);
-                        }
-                    }
-                }
-            }
+        auto sr = ResolveRangeSpec(t.range, totalMips, totalSlices);
+        if (sr.mipCount == 0 || sr.sliceCount == 0) continue;
 
-            continue; // no conflicts for this resource
+        const uint32_t slice1 = sr.firstSlice + sr.sliceCount - 1;
+        for (uint32_t mip = sr.firstMip; mip < sr.firstMip + sr.mipCount; ++mip) {
+            rows.push_back({ res, mip, sr.firstSlice, slice1, ti });
         }
+    }
 
-        // Fallback: per-mip interval sweep (no big dense array).
-        struct Interval { uint32_t lo, hi; size_t idx; };
-        std::vector<Interval> intervals;
-        intervals.reserve(rects.size());
-
-        for (uint32_t mip = 0; mip < totalMips; ++mip)
-        {
-            intervals.clear();
-
-            for (const Rect& r : rects) {
-                if (mip < r.mip0 || mip > r.mip1) continue;
-                intervals.push_back({ r.slice0, r.slice1, r.idx });
-            }
-
-            if (intervals.size() <= 1) continue;
+    if (rows.size() <= 1) return true;
 
-            std::sort(intervals.begin(), intervals.end(),
-                [](const Interval& a, const Interval& b) {
-                    if (a.lo != b.lo) return a.lo < b.lo;
-                    if (a.hi != b.hi) return a.hi < b.hi;
-                    return a.idx < b.idx;
-                });
+    std::sort(rows.begin(), rows.end(),
+        [](const Row& a, const Row& b) {
+            if (a.resource != b.resource) return std::less<Resource*>{}(a.resource, b.resource);
+            if (a.mip != b.mip) return a.mip < b.mip;
+            if (a.slice0 != b.slice0) return a.slice0 < b.slice0;
+            if (a.slice1 != b.slice1) return a.slice1 < b.slice1;
+            return a.idx < b.idx;
+        });
 
-            uint32_t curLo = intervals[0].lo;
-            uint32_t curHi = intervals[0].hi;
-            size_t   curIdx = intervals[0].idx;
-
-            for (size_t i = 1; i < intervals.size(); ++i)
-            {
-                const auto& in = intervals[i];
-                if (in.lo <= curHi) {
-                    // Overlap at mip; pick a concrete overlapping slice.
-                    uint32_t overlapSlice = (std::max)(curLo, in.lo);
-                    return emitConflict(res, mip, overlapSlice, curIdx, in.idx);
-                }
-
-                curLo = in.lo;
-                curHi = in.hi;
-                curIdx = in.idx;
+    // Within a run, any accepted interval ends before the next one starts, so the previous row
+    // always holds the furthest slice reached so far.
+    for (size_t i = 1; i < rows.size(); ++i)
+    {
+        const Row& prev = rows[i - 1];
+        const Row& cur = rows[i];
+        if (cur.resource != prev.resource || cur.mip != prev.mip) continue;
+        if (cur.slice0 <= prev.slice1) {
+            if (outFirstConflict) {
+                outFirstConflict->resource = cur.resource;
+                outFirstConflict->mip = cur.mip;
+                outFirstConflict->slice = cur.slice0; // first shared slice, since prev.slice0 <= cur.slice0
+                outFirstConflict->firstIdx = prev.idx;
+                outFirstConflict->secondIdx = cur.idx;
             }
+            return false;
         }
     }
 
     return true;
-}
\ No newline at end of file
+}
@@ -0,0 +1,50 @@
+#include "Resources/Sampler.h"
+
+#include "Render/Runtime/DescriptorServiceAccess.h"
+
+SamplerCache Sampler::m_samplerCache;
+
+namespace {
+rhi::SamplerDesc DefaultSamplerDesc()
+{
+    // Filtering and addressing keep rhi::SamplerDesc defaults
+    rhi::SamplerDesc desc{};
+    desc.maxAnisotropy = 16;
+    return desc;
+}
+
+rhi::SamplerDesc DefaultShadowSamplerDesc()
+{
+    rhi::SamplerDesc desc{};
+    desc.addressU = rhi::AddressMode::Border;
+    desc.addressV = rhi::AddressMode::Border;
+    desc.addressW = rhi::AddressMode::Border;
+    desc.borderPreset = rhi::BorderPreset::Custom;
+    desc.borderColor[0] = desc.borderColor[1] = desc.borderColor[2] = desc.borderColor[3] = 1.0f;
+    desc.compareEnable = true;
+    desc.compareOp = rhi::CompareOp::LessEqual;
+    return desc;
+}
+}
+
+Sampler::Sampler(rhi::SamplerDesc samplerDesc)
+    : m_index(rg::runtime::CreateIndexedSamplerFromActiveDescriptorService(samplerDesc))
+    , m_samplerDesc(samplerDesc) {
+}
+
+std::shared_ptr<Sampler> Sampler::CreateSampler(rhi::SamplerDesc samplerDesc)
+{
+    return m_samplerCache.FindOrCreate(samplerDesc, [&] {
+        return std::shared_ptr<Sampler>(new Sampler(samplerDesc));
+    });
+}
+
+std::shared_ptr<Sampler> Sampler::GetDefaultSampler()
+{
+    return CreateSampler(DefaultSamplerDesc());
+}
+
+std::shared_ptr<Sampler> Sampler::GetDefaultShadowSampler()
+{
+    return CreateSampler(DefaultShadowSamplerDesc());
+}
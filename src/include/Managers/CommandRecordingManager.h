@@ -1,6 +1,6 @@
 #pragma once
-#include <array>
 #include <cstdint>
+#include <vector>
 #include <rhi.h>
 #include "Render/CommandListPool.h"
 #include "Render/QueueKind.h"
@@ -12,64 +12,77 @@ struct Signal {
 
 class CommandRecordingManager {
 public:
-    struct Init {
-        rhi::Queue* graphicsQ = nullptr;
-        rhi::Timeline* graphicsF = nullptr;
-        CommandListPool* graphicsPool = nullptr; // pool created with DIRECT
-
-        rhi::Queue* computeQ = nullptr;
-        rhi::Timeline* computeF = nullptr;
-        CommandListPool* computePool = nullptr; // pool created with COMPUTE
+    // One entry per registered queue slot, indexed by QueueSlotIndex. The primary queues occupy
+    // slots 0, 1, 2 (Graphics, Compute, Copy), so the QueueKind overloads address those.
+    struct QueueInit {
+        rhi::Queue queue{};
+        rhi::Timeline* fence = nullptr;
+        CommandListPool* pool = nullptr;
+        rhi::QueueKind listType = rhi::QueueKind::Graphics;
+    };
 
-        rhi::Queue* copyQ = nullptr;
-        rhi::Timeline* copyF = nullptr;
-        CommandListPool* copyPool = nullptr; // pool created with COPY
+    struct Init {
+        std::vector<QueueInit> queues;
     };
 
     explicit CommandRecordingManager(const Init& init);
 
-    // Get an open list for 'qk'. Creates one if needed, bound to 'frameEpoch'.
-    rhi::CommandList EnsureOpen(QueueKind qk, uint32_t frameEpoch);
+    size_t SlotCount() const noexcept { return m_bind.size(); }
+
+    // Get an open list for 'slot'. Creates one if needed, bound to 'frameEpoch'.
+    rhi::CommandList EnsureOpen(QueueSlotIndex slot, uint32_t frameEpoch);
+    rhi::CommandList EnsureOpen(QueueKind qk, uint32_t frameEpoch) { return EnsureOpen(PrimarySlot(qk), frameEpoch); }
 
     // Close + Execute current list if dirty; optionally Signal. Returns the signaled value (or 0).
-    uint64_t Flush(QueueKind qk, Signal sig = {});
+    uint64_t Flush(QueueSlotIndex slot, Signal sig = {});
+    uint64_t Flush(QueueKind qk, Signal sig = {}) { return Flush(PrimarySlot(qk), sig); }
+
+    // Flush every slot this thread has an open list on.
+    void FlushAll();
 
     // Recycle allocators whose fences have completed (once per frame).
     void EndFrame();
 
-    rhi::Timeline* Fence(QueueKind qk) const;
-    rhi::Queue* Queue(QueueKind qk) const;
+    rhi::Timeline* Fence(QueueSlotIndex slot) const;
+    rhi::Timeline* Fence(QueueKind qk) const { return Fence(PrimarySlot(qk)); }
+    rhi::Queue* Queue(QueueSlotIndex slot);
+    rhi::Queue* Queue(QueueKind qk) { return Queue(PrimarySlot(qk)); }
 
-    // Last value signaled by this CRM on the given logical queue.
-    uint64_t LastSignaledValue(QueueKind qk) const {
-        return m_lastSignaledValue[static_cast<size_t>(qk)];
+    // Last value signaled by this CRM on the given queue slot.
+    uint64_t LastSignaledValue(QueueSlotIndex slot) const {
+        return m_lastSignaledValue[static_cast<size_t>(slot)];
     }
+    uint64_t LastSignaledValue(QueueKind qk) const { return LastSignaledValue(PrimarySlot(qk)); }
 
     // Raise the tracked last-signaled value for a queue so that subsequent
     // auto-generated signals (e.g. cleanup Flush) start above this floor.
     // Does NOT issue a GPU signal; only adjusts the CRM's bookkeeping.
-    void EnsureMinSignaledValue(QueueKind qk, uint64_t minValue) {
-        const size_t idx = static_cast<size_t>(qk);
+    void EnsureMinSignaledValue(QueueSlotIndex slot, uint64_t minValue) {
+        const size_t idx = static_cast<size_t>(slot);
         if (minValue > m_lastSignaledValue[idx])
             m_lastSignaledValue[idx] = minValue;
     }
+    void EnsureMinSignaledValue(QueueKind qk, uint64_t minValue) { EnsureMinSignaledValue(PrimarySlot(qk), minValue); }
 
     void ShutdownThreadLocal();
 
 private:
     struct QueueBinding {
-        rhi::Queue* queue = nullptr;
+        rhi::Queue queue{};
         rhi::Timeline* fence = nullptr;
         CommandListPool* pool = nullptr;
         rhi::QueueKind listType = rhi::QueueKind::Graphics;
-        bool valid() const { return queue && fence && pool; }
+        bool valid() const { return fence && pool; }
     };
 
-    // One per process; alias compute -> graphics in AliasToGraphics mode dynamically
-    std::array<QueueBinding, static_cast<size_t>(QueueKind::Count)> m_bind{};
+    static constexpr QueueSlotIndex PrimarySlot(QueueKind qk) noexcept {
+        return static_cast<QueueSlotIndex>(static_cast<uint8_t>(qk));
+    }
+
+    std::vector<QueueBinding> m_bind;
 
-    // Last value signaled by this manager per logical queue.
-    std::array<uint64_t, static_cast<size_t>(QueueKind::Count)> m_lastSignaledValue{};
+    // Last value signaled by this manager per queue slot.
+    std::vector<uint64_t> m_lastSignaledValue;
 
     //Per-thread recording state
     struct PerQueueCtx {
@@ -81,10 +94,12 @@ private:
     };
 
     struct ThreadState {
-        std::array<PerQueueCtx, static_cast<size_t>(QueueKind::Count)> ctxs{};
+        std::vector<PerQueueCtx> ctxs; // Indexed by slot, grown on first use
         uint32_t cachedEpoch = ~0u; // to force rebind at new frame
     };
 
+    static PerQueueCtx& ThreadContext(size_t slot);
+
     static thread_local ThreadState s_tls;
 
 };
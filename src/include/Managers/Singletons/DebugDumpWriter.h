@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+
+enum class DebugDumpChannel : uint8_t {
+	CompiledGraph = 0,
+	VramUsage,
+	Count,
+};
+
+// Formats and writes render graph debug dumps on a background thread, so they can stay enabled
+// in long soak runs without the frame ever waiting on disk.
+//
+// The render thread calls ShouldCapture before snapshotting anything. It returns false while the
+// channel's previous dump is younger than renderGraphDebugDumpMinIntervalMs or is still waiting
+// to be written, so a slow disk costs skipped dumps rather than frame time. Submit then hands a
+// snapshot to the writer thread as a function returning the file contents. Each channel holds at
+// most one queued dump and a newer one replaces it, which bounds the queue by the channel count;
+// the files are "latest state" dumps, so nothing but the newest is worth writing.
+class DebugDumpWriter {
+public:
+	using Formatter = std::function<std::string()>;
+
+	struct Stats {
+		uint64_t written = 0;
+		uint64_t skipped = 0;  // Rate-limited, or the previous dump was still queued
+		uint64_t replaced = 0; // Queued dumps superseded before they were written
+		uint64_t failed = 0;
+	};
+
+	static DebugDumpWriter& GetInstance();
+	~DebugDumpWriter() { Stop(); }
+
+	bool ShouldCapture(DebugDumpChannel channel);
+	// 'format' runs on the writer thread; it must own everything it reads.
+	void Submit(DebugDumpChannel channel, std::filesystem::path path, Formatter format);
+	// Blocks until every queued dump has been written.
+	void Flush();
+	// Writes the queued dumps and joins the writer thread.
+	void Stop();
+
+	Stats GetStats() const;
+
+private:
+	using Clock = std::chrono::steady_clock;
+
+	struct PendingDump {
+		std::filesystem::path path;
+		Formatter format;
+	};
+
+	DebugDumpWriter() = default;
+
+	void WriterMain();
+	bool WriteDump(PendingDump& dump);
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_queueCv;
+	std::condition_variable m_idleCv;
+	std::array<std::optional<PendingDump>, static_cast<size_t>(DebugDumpChannel::Count)> m_pending{};
+	std::array<std::optional<Clock::time_point>, static_cast<size_t>(DebugDumpChannel::Count)> m_lastCapture{};
+	bool m_writing = false;
+	bool m_quit = false;
+	std::thread m_writerThread;
+	Stats m_stats{};
+};
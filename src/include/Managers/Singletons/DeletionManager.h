@@ -1,119 +1,152 @@
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <memory>
 #include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <variant>
 #include <vector>
 
+#include <rhi.h>
 #include <rhi_allocator.h>
 #include <rhi_helpers.h>
 
 #include "Render/Runtime/OpenRenderGraphSettings.h"
 #include "Resources/TrackedAllocation.h"
 
+// Objects marked for delete are released once the GPU has passed every queue's last signal of
+// the frame they were marked in. The render graph publishes those signals at the end of each
+// Execute; until a host publishes any, retirement falls back to numFramesInFlight + 1 calls to
+// ProcessDeletions.
+//
+// MarkForDelete is lock-free and callable from any thread. With backgroundDeletionEnabled,
+// completed batches are destroyed on a low-priority thread; tracked-allocation entities are
+// still destroyed by ProcessDeletions, since the ECS world belongs to the render thread.
 class DeletionManager {
 public:
+	struct QueueFencePoint {
+		rhi::Timeline timeline;
+		uint64_t value = 0;
+	};
+
+	struct Stats {
+		uint64_t batchesDestroyedInline = 0;
+		uint64_t batchesDestroyedInBackground = 0;
+		uint64_t backpressureBatches = 0; // Destroyed inline because the background queue was full
+		uint64_t queuedBackgroundBatches = 0;
+	};
+
 	static DeletionManager& GetInstance();
 
 	bool IsInitialized() const {
-		std::scoped_lock lock(m_mutex);
-		return IsInitializedUnlocked();
+		return m_numFramesInFlight.load(std::memory_order_acquire) != 0;
 	}
 
 	void Initialize() {
 		std::scoped_lock lock(m_mutex);
-		m_numFramesInFlight = rg::runtime::GetOpenRenderGraphSettings().numFramesInFlight;
-		const size_t retirementSlotCount = static_cast<size_t>(m_numFramesInFlight) + 1u;
-		m_deletionQueue.resize(retirementSlotCount);
-		m_allocationDeletionQueue.resize(retirementSlotCount);
-		m_trackedAllocationDeletionQueue.resize(retirementSlotCount);
+		m_numFramesInFlight.store(rg::runtime::GetOpenRenderGraphSettings().numFramesInFlight, std::memory_order_release);
 	}
 
 	void MarkForDelete(rhi::helpers::AnyObjectPtr ptr) {
-		std::scoped_lock lock(m_mutex);
-		if (!IsInitializedUnlocked()) {
-			return;
+		if (IsInitialized()) {
+			PushPending(std::move(ptr));
 		}
-		m_deletionQueue[0].push_back(std::move(ptr));
 	}
 
 	void MarkForDelete(rhi::ma::AllocationPtr ptr) {
-		std::scoped_lock lock(m_mutex);
-		if (!IsInitializedUnlocked()) {
-			return;
+		if (IsInitialized()) {
+			PushPending(std::move(ptr));
 		}
-		m_allocationDeletionQueue[0].push_back(std::move(ptr));
 	}
 
 	void MarkForDelete(TrackedHandle&& alloc) {
-		std::scoped_lock lock(m_mutex);
-		if (!IsInitializedUnlocked()) {
+		if (!IsInitialized()) {
 			alloc.Reset();
 			return;
 		}
-		m_trackedAllocationDeletionQueue[0].push_back(std::move(alloc));
+		PushPending(std::move(alloc));
 	}
 
-	void ProcessDeletions() {
-		std::scoped_lock lock(m_mutex);
-		if (!IsInitializedUnlocked()) {
-			return;
-		}
-		m_deletionQueue.back().clear();
-		for (int i = static_cast<int>(m_deletionQueue.size()) - 1; i >= 1; --i) {
-			m_deletionQueue[i].swap(m_deletionQueue[i - 1]);
-		}
+	// Called after a frame's last submissions, indexed by queue slot. Everything marked so far
+	// waits for these values. A slot without a new signal (value 0) keeps its previous value,
+	// since earlier work on that queue may still reference what was marked.
+	void PublishRetirementFences(std::span<const QueueFencePoint> fencesBySlot);
+	void ProcessDeletions();
+	// Destroys everything immediately, including batches queued for the background thread.
+	void DrainAll();
+	void Cleanup();
 
-		m_allocationDeletionQueue.back().clear();
-		for (int i = static_cast<int>(m_allocationDeletionQueue.size()) - 1; i >= 1; --i) {
-			m_allocationDeletionQueue[i].swap(m_allocationDeletionQueue[i - 1]);
-		}
-
-		m_trackedAllocationDeletionQueue.back().clear();
-		for (int i = static_cast<int>(m_trackedAllocationDeletionQueue.size()) - 1; i >= 1; --i) {
-			m_trackedAllocationDeletionQueue[i].swap(m_trackedAllocationDeletionQueue[i - 1]);
-		}
-	}
+	Stats GetStats() const;
 
-	void DrainAll() {
-		std::scoped_lock lock(m_mutex);
-		if (!IsInitializedUnlocked()) {
-			return;
-		}
-
-		for (auto& queue : m_deletionQueue) {
-			queue.clear();
-		}
-		for (auto& queue : m_allocationDeletionQueue) {
-			queue.clear();
-		}
-		for (auto& queue : m_trackedAllocationDeletionQueue) {
-			queue.clear();
+private:
+	struct RetirementBatch {
+		std::vector<rhi::helpers::AnyObjectPtr> objects;
+		std::vector<rhi::ma::AllocationPtr> allocations;
+		std::vector<TrackedHandle> trackedAllocations;
+		std::shared_ptr<const std::vector<QueueFencePoint>> requiredFences;
+		uint32_t processCalls = 0; // Frame-count fallback only
+
+		bool Empty() const noexcept {
+			return objects.empty() && allocations.empty() && trackedAllocations.empty();
 		}
-	}
-
-	void Cleanup() {
-		std::scoped_lock lock(m_mutex);
-		m_deletionQueue.clear();
-		m_allocationDeletionQueue.clear();
-		m_trackedAllocationDeletionQueue.clear();
-		m_numFramesInFlight = 0;
-	}
+	};
+
+	// Intrusive stack node. Producers push with one CAS and the render thread takes the whole
+	// stack with one exchange, so nothing is ever popped singly and there is no ABA. Nodes come
+	// from chunks that live as long as the manager: the render thread hands collected nodes back
+	// to a shared free stack as one chain, and each producer thread takes that whole stack into a
+	// thread-local cache, so retiring an object does not allocate once the pool has warmed up.
+	struct PendingNode {
+		std::variant<rhi::helpers::AnyObjectPtr, rhi::ma::AllocationPtr, TrackedHandle> item;
+		PendingNode* next = nullptr;
+	};
 
-private:
-	uint8_t m_numFramesInFlight = 0;
 	DeletionManager() = default;
-
-	bool IsInitializedUnlocked() const noexcept {
-		return m_numFramesInFlight != 0 &&
-			!m_deletionQueue.empty() &&
-			!m_allocationDeletionQueue.empty() &&
-			!m_trackedAllocationDeletionQueue.empty();
+	~DeletionManager();
+
+	template<class T>
+	void PushPending(T&& item) {
+		PendingNode* node = AcquireNode();
+		node->item.template emplace<std::decay_t<T>>(std::forward<T>(item));
+		node->next = m_pendingHead.load(std::memory_order_relaxed);
+		while (!m_pendingHead.compare_exchange_weak(node->next, node, std::memory_order_release, std::memory_order_relaxed)) {
+		}
 	}
+	PendingNode* AcquireNode();
+	// Returns the chain first..last to the free stack with one CAS.
+	void ReleaseNodes(PendingNode* first, PendingNode* last);
+	void CollectPendingUnlocked();
+	static bool FencesComplete(const RetirementBatch& batch);
+	void DestroyBatches(std::vector<RetirementBatch>& batches);
+	void DestructionLoop();
+	void StopDestructionThread();
+
+	std::atomic<uint8_t> m_numFramesInFlight{ 0 };
+	std::atomic<PendingNode*> m_pendingHead{ nullptr };
+	std::atomic<PendingNode*> m_freeHead{ nullptr };
+	std::mutex m_nodeChunkMutex;
+	std::vector<std::unique_ptr<PendingNode[]>> m_nodeChunks;
 
 	mutable std::mutex m_mutex;
-	std::vector<std::vector<rhi::helpers::AnyObjectPtr>> m_deletionQueue;
-	std::vector<std::vector<rhi::ma::AllocationPtr>> m_allocationDeletionQueue;
-	std::vector<std::vector<TrackedHandle>> m_trackedAllocationDeletionQueue;
+	RetirementBatch m_openBatch;                  // Marked since the last published fences
+	std::deque<RetirementBatch> m_sealedBatches;  // In publish order
+	std::vector<QueueFencePoint> m_latestFencesBySlot;
+	bool m_fenceDriven = false;
+
+	// Background destruction. m_destructionMutex is never taken while m_mutex is held.
+	mutable std::mutex m_destructionMutex;
+	std::condition_variable m_destructionCv;
+	std::condition_variable m_destructionIdleCv;
+	std::deque<RetirementBatch> m_destructionQueue;
+	std::thread m_destructionThread;
+	bool m_destructionStop = false;
+	bool m_destructionBusy = false;
+	Stats m_stats{};
 };
 
 inline DeletionManager& DeletionManager::GetInstance() {
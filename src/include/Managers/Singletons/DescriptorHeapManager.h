@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
 #include <memory>
 #include <mutex>
+#include <shared_mutex>
 #include <variant>
 #include <vector>
 
@@ -10,9 +13,28 @@
 #include "Render/DescriptorHeap.h"
 #include "Render/Runtime/DescriptorServiceTypes.h"
 #include "Resources/GPUBacking/GpuBufferBacking.h"
+#include "Resources/ResourceStateTracker.h"
 
 class GloballyIndexedResource;
 
+// Per-mip and per-slice texture views whose slots are reserved but not yet written, held by the
+// target while OpenRenderGraphSettings::lazySubresourceDescriptorViews is on. Dropped once every
+// view is written or the target gets new contents.
+struct DeferredSubresourceViews {
+	DeferredSubresourceViews() { liveCount.fetch_add(1, std::memory_order_relaxed); }
+	~DeferredSubresourceViews() { liveCount.fetch_sub(1, std::memory_order_relaxed); }
+	DeferredSubresourceViews(const DeferredSubresourceViews&) = delete;
+	DeferredSubresourceViews& operator=(const DeferredSubresourceViews&) = delete;
+
+	rhi::ResourceHandle resource;
+	rg::runtime::DescriptorViewRequirements::TextureViews views;
+	std::vector<uint8_t> srvWritten;         // [srvSlice * mipLevels + mip] of the default SRV grid
+	std::vector<uint8_t> subresourceWritten; // [arraySlice * mipLevels + mip]: UAV, RTV, DSV, face SRV
+	uint32_t remaining = 0;
+
+	static inline std::atomic<uint64_t> liveCount{ 0 };
+};
+
 class DescriptorHeapManager {
 public:
 	using ViewRequirements = rg::runtime::DescriptorViewRequirements;
@@ -39,6 +61,18 @@ public:
 		rhi::Resource& apiResource,
 		const ViewRequirements& req);
 
+	// Writes the deferred per-subresource views of target that range (mips and array slices)
+	// covers. No-op for targets without deferred views.
+	void EnsureSubresourceViews(GloballyIndexedResource& target, const SubresourceRange& range);
+	// Targets still holding deferred views, so callers can skip the per-requirement walk.
+	uint64_t GetDeferredSubresourceViewTargetCount() const;
+
+	// While deferred, shader-visible CBV/SRV/UAV writes are queued instead of written, and
+	// FlushDeferredDescriptorWrites writes them from one thread in heap order. Slots are assigned
+	// immediately either way; only their contents wait for the flush.
+	void BeginDeferredDescriptorWrites();
+	void FlushDeferredDescriptorWrites();
+
 	void RetireDescriptorSlots(std::vector<std::pair<std::shared_ptr<DescriptorHeap>, UINT>> slots);
 	void RetireBufferBacking(std::unique_ptr<GpuBufferBacking> backing);
 	struct QueueFenceSnapshotPoint {
@@ -47,6 +81,10 @@ public:
 	};
 	void PublishQueueFenceSnapshot(std::vector<QueueFenceSnapshotPoint> fenceSnapshot);
 	void ProcessDeferredReleases(uint8_t frameIndex);
+	// Called once per frame. When the shader-visible heap is three-quarters used and below the
+	// configured max capacity, doubles it, re-creates the live views at their same indices and
+	// retires the old heap through the deferred releases.
+	void GrowShaderVisibleHeapIfNeeded();
 
 	rhi::DescriptorHeap GetSRVDescriptorHeap() const;
 	rhi::DescriptorHeap GetSamplerDescriptorHeap() const;
@@ -70,17 +108,59 @@ private:
 		rhi::Resource& apiResource,
 		const ViewRequirements& req);
 
+	using PendingViewDesc = DescriptorHeap::ViewDesc;
+	struct PendingDescriptorWrite {
+		UINT index = 0; // The heap is resolved at flush time, after any grow
+		rhi::ResourceHandle resource;
+		PendingViewDesc desc;
+	};
+	static void CreateView(rhi::Device& device, const rhi::DescriptorSlot& slot, rhi::ResourceHandle resource, const PendingViewDesc& desc);
+	void WriteShaderVisibleView(rhi::Device& device, const rhi::DescriptorSlot& slot, rhi::ResourceHandle resource, const PendingViewDesc& desc);
+	void WriteTextureSRVGridView(
+		rhi::Device& device,
+		GloballyIndexedResource& target,
+		rhi::ResourceHandle resource,
+		const ViewRequirements::TextureViews& tex,
+		uint32_t mip,
+		uint32_t srvSlice);
+	void WriteTextureSubresourceViews(
+		rhi::Device& device,
+		GloballyIndexedResource& target,
+		rhi::ResourceHandle resource,
+		const ViewRequirements::TextureViews& tex,
+		uint32_t mip,
+		uint32_t slice);
+
 	std::shared_ptr<DescriptorHeap> m_cbvSrvUavHeap;
 	std::shared_ptr<DescriptorHeap> m_samplerHeap;
 	std::shared_ptr<DescriptorHeap> m_rtvHeap;
 	std::shared_ptr<DescriptorHeap> m_dsvHeap;
 	std::shared_ptr<DescriptorHeap> m_nonShaderVisibleHeap;
+	uint32_t m_cbvSrvUavHeapMaxCapacity = 0;
+	using QueueFenceSnapshot = std::shared_ptr<const std::vector<QueueFenceSnapshotPoint>>;
+	// Everything retired while one snapshot was the latest. Snapshots are published once per frame
+	// with non-decreasing fence values, so the queue is in fence order and only its completed
+	// prefix is ever examined.
 	struct DeferredRelease {
 		std::vector<std::pair<std::shared_ptr<DescriptorHeap>, UINT>> descriptorSlots;
 		std::vector<std::unique_ptr<GpuBufferBacking>> bufferBackings;
-		std::vector<QueueFenceSnapshotPoint> requiredFences;
+		std::vector<rhi::DescriptorHeapPtr> descriptorHeaps; // Replaced by a grown heap
+		QueueFenceSnapshot requiredFences;
 	};
-	std::vector<DeferredRelease> m_deferredReleases;
-	std::vector<QueueFenceSnapshotPoint> m_latestQueueFenceSnapshot;
+	DeferredRelease& CurrentDeferredReleaseUnlocked();
+	static void ExecuteDeferredRelease(DeferredRelease& release);
+	void GrowShaderVisibleHeapIfNeededUnlocked();
+
+	std::deque<DeferredRelease> m_deferredReleases;
+	QueueFenceSnapshot m_latestQueueFenceSnapshot;
+	// Guards the deferred releases and fence snapshot. Slot allocation needs no lock here:
+	// DescriptorHeap synchronises it, and each target is materialized by one thread.
 	std::mutex m_descriptorMutationMutex;
+	// Shared by writers from the heap handle read through RecordView and the write itself; held
+	// exclusively while the shader-visible heap grows and its views are migrated, so no write can
+	// land in the retired heap after the snapshot.
+	std::shared_mutex m_shaderVisibleHeapMutex;
+	std::atomic<bool> m_deferShaderVisibleWrites{ false };
+	std::vector<PendingDescriptorWrite> m_pendingDescriptorWrites;
+	std::mutex m_pendingDescriptorWriteMutex;
 };
@@ -5,10 +5,13 @@
 #include <mutex>
 #include <optional>
 #include <functional>
+#include <span>
+#include <vector>
 
 #include <rhi.h>
 #include <rhi_allocator.h>
 #include "Resources/TrackedAllocation.h"
+#include "Render/PassPredication.h"
 
 class DeviceManager {
 public:
@@ -20,10 +23,88 @@ public:
 
 	static void SetTrackingHooks(TrackingHooks hooks) {
 		s_trackingHooks = std::move(hooks);
+		s_defaultTrackingHooks = false;
 	}
 
 	static void ResetTrackingHooks() {
 		s_trackingHooks = {};
+		s_defaultTrackingHooks = false;
+	}
+
+	// True while allocations are tracked by the hook Initialize installs. It creates flecs entities
+	// on the allocating thread unless trackedAllocationEntityBatchingEnabled queues them instead.
+	static bool UsesDefaultTrackingHooks() {
+		return s_defaultTrackingHooks;
+	}
+
+	// Answers placement size queries in place of the device. Benchmarks and headless runs install
+	// one so aliasing and pool sizing are deterministic regardless of the driver behind the device.
+	using ResourceAllocationInfoHook = std::function<rhi::ResourceAllocationInfo(const rhi::ResourceDesc& desc)>;
+
+	static void SetResourceAllocationInfoHook(ResourceAllocationInfoHook hook) {
+		s_resourceAllocationInfoHook = std::move(hook);
+	}
+
+	static void ResetResourceAllocationInfoHook() {
+		s_resourceAllocationInfoHook = {};
+	}
+
+	enum class ResidencyOperation : uint8_t {
+		Evict,
+		MakeResident,
+	};
+
+	// Pages allocations out of or back into video memory in place of the built-in D3D12 path, which
+	// only reaches allocations that own a resource. Install one for other backends, or to page bare
+	// heaps such as alias pools. Returns false when nothing was changed.
+	using ResidencyHook = std::function<bool(ResidencyOperation operation, std::span<TrackedHandle* const> allocations)>;
+
+	static void SetResidencyHook(ResidencyHook hook) {
+		s_residencyHook = std::move(hook);
+	}
+
+	static void ResetResidencyHook() {
+		s_residencyHook = {};
+	}
+
+	// The built-in path pages only allocations with a native D3D12 resource, so without a hook
+	// alias pools and other backends stay resident.
+	static bool HasResidencyHook() {
+		return static_cast<bool>(s_residencyHook);
+	}
+
+	// Sets (buffer non-null) or clears (null) predication on a command list. The RHI has no
+	// predication call, so backends that support it install one; without it, or when it returns
+	// false, predicated passes run unconditionally.
+	using PredicationHook = std::function<bool(rhi::CommandList& commandList, const rhi::Resource* buffer, uint64_t offset, PredicationOp op)>;
+
+	static void SetPredicationHook(PredicationHook hook) {
+		s_predicationHook = std::move(hook);
+	}
+
+	static void ResetPredicationHook() {
+		s_predicationHook = {};
+	}
+
+	static bool HasPredicationHook() {
+		return static_cast<bool>(s_predicationHook);
+	}
+
+	// Opens `timeline`, created on another adapter's device, on `device` so that device's queues
+	// can wait on it (on D3D12, a shared fence handle opened with OpenSharedHandle). Install one
+	// before RenderGraph::RegisterAdapterQueue; until then that call logs and registers nothing.
+	using SharedTimelineHook = std::function<bool(const rhi::Timeline& timeline, rhi::Device device, rhi::TimelinePtr& outTimeline)>;
+
+	static void SetSharedTimelineHook(SharedTimelineHook hook) {
+		s_sharedTimelineHook = std::move(hook);
+	}
+
+	static void ResetSharedTimelineHook() {
+		s_sharedTimelineHook = {};
+	}
+
+	static bool HasSharedTimelineHook() {
+		return static_cast<bool>(s_sharedTimelineHook);
 	}
 
 	void Initialize(rhi::Device device);
@@ -44,10 +125,41 @@ public:
 		return m_copyQueue;
 	}
 
+	// Explicit multi-adapter: further devices whose queues the render graph can schedule pinned
+	// passes on. Adapter 0 is the device passed to Initialize. The caller creates and owns the
+	// others and keeps them alive until after Cleanup; resources and allocations still come from
+	// adapter 0 only.
+	uint8_t AddAdapter(rhi::Device device);
+	rhi::Device GetAdapterDevice(uint8_t adapter);
+	size_t GetAdapterCount() const {
+		return 1 + m_secondaryAdapters.size();
+	}
+
+	// Returns false when no hook is installed or it could not open the timeline.
+	bool OpenTimelineOnDevice(const rhi::Timeline& timeline, rhi::Device device, rhi::TimelinePtr& outTimeline);
+
 	rhi::ma::Allocator* GetAllocator() {
 		return m_allocator;
 	}
 
+	// Size and alignment of a placed resource; goes through the allocation info hook when one is set.
+	rhi::ResourceAllocationInfo GetResourceAllocationInfo(const rhi::ResourceDesc& desc) {
+		if (s_resourceAllocationInfoHook) {
+			return s_resourceAllocationInfoHook(desc);
+		}
+		rhi::ResourceAllocationInfo info{};
+		m_device->GetResourceAllocationInfo(&desc, 1, &info);
+		return info;
+	}
+
+	// The caller must make sure the GPU is done with allocations it evicts. MakeResident returns
+	// once the allocations are usable. Returns false when the residency could not be changed.
+	bool ChangeResidency(ResidencyOperation operation, std::span<TrackedHandle* const> allocations);
+
+	// Returns false when the commands recorded until EndPredication will run unconditionally.
+	bool BeginPredication(rhi::CommandList& commandList, const rhi::Resource& buffer, uint64_t offset, PredicationOp op);
+	void EndPredication(rhi::CommandList& commandList);
+
 	// Create a resource and track its allocation with an entity.
 	rhi::Result CreateResourceTracked(
 		const rhi::ma::AllocationDesc& allocDesc,
@@ -81,8 +193,14 @@ private:
 	rhi::Queue m_computeQueue;
 	rhi::Queue m_copyQueue;
 	rhi::ma::Allocator* m_allocator = nullptr;
+	std::vector<rhi::Device> m_secondaryAdapters; // Adapter i + 1; not owned
 	mutable std::mutex m_resourceCreationMutex;
 	inline static TrackingHooks s_trackingHooks{};
+	inline static bool s_defaultTrackingHooks = false;
+	inline static ResourceAllocationInfoHook s_resourceAllocationInfoHook{};
+	inline static ResidencyHook s_residencyHook{};
+	inline static PredicationHook s_predicationHook{};
+	inline static SharedTimelineHook s_sharedTimelineHook{};
 
 };
 
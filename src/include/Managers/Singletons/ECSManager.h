@@ -1,6 +1,13 @@
 #pragma once
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include <flecs.h>
+#include <tracy/Tracy.hpp>
+
+#include "Resources/TrackedAllocation.h"
 
 class ECSManager {
 public:
@@ -18,12 +25,96 @@ public:
 		return true;
 	}
 
+	// Tracked-allocation entities are created in batches rather than one world.entity() per
+	// allocation under the resource creation lock: the caller gets a deferred token queued on its
+	// own thread, and bundles attached before the flush are held on the token until then.
+	TrackedEntityToken CreateQueuedTrackedEntity();
+	// Creates every queued entity inside one deferred world scope and applies its pending bundles.
+	// Main thread only, at a point where nothing else is writing to the world.
+	void FlushQueuedTrackedEntities();
+
 private:
+	struct TrackedEntityQueue {
+		std::mutex mutex;
+		std::vector<std::shared_ptr<TrackedEntityToken::DeferredState>> pending;
+	};
+
 	ECSManager() = default;
+	TrackedEntityQueue& GetThreadTrackedEntityQueue();
+
 	flecs::world m_world;
+	std::mutex m_trackedEntityQueuesMutex;
+	std::vector<std::shared_ptr<TrackedEntityQueue>> m_trackedEntityQueues; // One per thread that has queued
 };
 
 inline ECSManager& ECSManager::GetInstance() {
 	static ECSManager instance;
 	return instance;
 }
+
+inline ECSManager::TrackedEntityQueue& ECSManager::GetThreadTrackedEntityQueue() {
+	// Queues stay registered after their thread exits so anything still pending is flushed.
+	thread_local std::shared_ptr<TrackedEntityQueue> queue;
+	if (!queue) {
+		queue = std::make_shared<TrackedEntityQueue>();
+		std::scoped_lock lock(m_trackedEntityQueuesMutex);
+		m_trackedEntityQueues.push_back(queue);
+	}
+	return *queue;
+}
+
+inline TrackedEntityToken ECSManager::CreateQueuedTrackedEntity() {
+	TrackedEntityToken token = TrackedEntityToken::CreateDeferred();
+	auto& queue = GetThreadTrackedEntityQueue();
+	std::scoped_lock lock(queue.mutex);
+	queue.pending.push_back(token.deferredState);
+	return token;
+}
+
+inline void ECSManager::FlushQueuedTrackedEntities() {
+	std::vector<std::shared_ptr<TrackedEntityToken::DeferredState>> batch;
+	{
+		std::scoped_lock lock(m_trackedEntityQueuesMutex);
+		for (auto& queue : m_trackedEntityQueues) {
+			std::scoped_lock queueLock(queue->mutex);
+			if (batch.empty()) {
+				batch.swap(queue->pending);
+			}
+			else {
+				batch.insert(batch.end(), queue->pending.begin(), queue->pending.end());
+				queue->pending.clear();
+			}
+		}
+	}
+	if (batch.empty()) {
+		return;
+	}
+
+	ZoneScopedN("ECSManager::FlushQueuedTrackedEntities");
+	std::vector<std::function<void(flecs::entity)>> pendingOps;
+	m_world.defer_begin();
+	for (auto& state : batch) {
+		// A released allocation leaves its state destroy-requested; skip it without an entity.
+		{
+			std::scoped_lock lock(state->mutex);
+			if (state->destroyRequested || state->destroyed) {
+				continue;
+			}
+		}
+
+		flecs::entity entity = m_world.entity();
+		TrackedEntityToken view;
+		view.deferredState = std::move(state);
+		bool destroyRequested = false;
+		const bool resolved = view.Resolve(m_world, entity.id(), pendingOps, destroyRequested);
+		view.deferredState.reset(); // The view does not own the entity
+		if (!resolved) {
+			entity.destruct();
+			continue;
+		}
+		for (auto& op : pendingOps) {
+			op(entity);
+		}
+	}
+	m_world.defer_end();
+}
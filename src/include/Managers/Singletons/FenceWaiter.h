@@ -0,0 +1,78 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include <rhi.h>
+
+// Shared host wait on timeline values. Instead of polling GetCompletedValue every frame, a
+// subsystem registers the value it is waiting for and is called back exactly when the timeline
+// reaches it. One worker thread, started on first use, serves every timeline: it releases the
+// waits that have completed, then blocks in HostWait on the oldest one left, so nothing spins
+// while the GPU is busy and the thread count does not grow with the number of timelines.
+//
+// Only register values that have already been submitted: a worker cannot be woken from HostWait,
+// so a value that is never signalled would hold it forever. Waits are served in registration
+// order, which is submission order when that contract holds. Cleanup cancels every wait the
+// worker has not started, then joins it once its current (submitted) HostWait returns.
+//
+// Callbacks run on the worker thread, or inline if the value was already reached; `reached` is
+// false when the wait failed, the device was lost or Cleanup cancelled it.
+class FenceWaiter {
+public:
+	using Callback = std::function<void(bool reached)>;
+
+	static FenceWaiter& GetInstance();
+	~FenceWaiter() { Cleanup(); }
+
+	void WhenReached(rhi::Timeline timeline, uint64_t value, Callback callback);
+	std::shared_future<bool> WaitAsync(rhi::Timeline timeline, uint64_t value);
+
+	struct Stats {
+		uint64_t registeredWaits = 0;
+		uint64_t completedInline = 0;
+		uint64_t hostWaits = 0;
+		uint64_t failedWaits = 0;
+		uint64_t cancelledWaits = 0;
+	};
+	Stats GetStats() const;
+
+	void Cleanup();
+
+private:
+	FenceWaiter() = default;
+
+	struct PendingWait {
+		rhi::Timeline timeline;
+		uint64_t value = 0;
+		Callback callback;
+	};
+
+	void WorkerMain();
+
+	mutable std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::deque<PendingWait> m_waits; // Registration order
+	std::thread m_thread;
+	bool m_quit = false;
+	Stats m_stats{};
+
+	// Static pointer to hold the instance
+	static std::unique_ptr<FenceWaiter> instance;
+	// Static initialization flag
+	static bool initialized;
+};
+
+inline FenceWaiter& FenceWaiter::GetInstance() {
+	if (!initialized) {
+		instance = std::unique_ptr<FenceWaiter>(new FenceWaiter());
+		initialized = true;
+	}
+	return *instance;
+}
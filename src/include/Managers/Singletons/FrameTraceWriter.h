@@ -0,0 +1,128 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <rhi.h>
+
+enum class FrameTraceCounter : uint8_t {
+	UploadBytes = 0,
+	StreamedUploadBytes,
+	ReadbackBytes,
+	Count,
+};
+
+// Writes frame timelines as Chrome trace-event JSON, which chrome://tracing and the Perfetto UI
+// open directly, for captures on machines without a profiler attached.
+//
+// Producers add events to the current frame from any thread; EndFrame hands the frame to a
+// writer thread that serializes and writes it. At most maxQueuedFrames frames wait for that
+// thread: a frame that finds the queue full is dropped, never waited for, and the drop is noted
+// in the trace. Every producer is a relaxed load and a return while no capture is running.
+//
+// GPU spans come from read-back timestamps. Each queue's timeline is anchored by the first span
+// it reports, at the CPU time that span was read back, so GPU spans trail the CPU by that
+// frame's readback latency.
+class FrameTraceWriter {
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static FrameTraceWriter& GetInstance();
+	~FrameTraceWriter() { Stop(); }
+
+	// Returns false if a capture is already running or the file cannot be opened.
+	bool Start(const std::string& path, uint32_t maxQueuedFrames);
+	// Writes the queued frames, closes the JSON document and joins the writer thread.
+	void Stop();
+	bool IsCapturing() const noexcept { return m_capturing.load(std::memory_order_relaxed); }
+
+	void CpuSpan(const char* name, Clock::time_point begin, Clock::time_point end);
+	void GpuSpan(rhi::QueueKind queue, std::string name, uint64_t beginTicks, uint64_t endTicks, uint64_t ticksPerSecond);
+	void GpuInstant(rhi::QueueKind queue, std::string name, uint64_t ticks, uint64_t ticksPerSecond);
+	void AddToCounter(FrameTraceCounter counter, uint64_t value) {
+		if (IsCapturing()) {
+			m_counters[static_cast<size_t>(counter)].fetch_add(value, std::memory_order_relaxed);
+		}
+	}
+	// Closes the current frame: adds its span and counters and queues it for the writer thread.
+	void EndFrame(uint64_t frameSerial);
+
+private:
+	FrameTraceWriter() = default;
+
+	struct Event {
+		std::string name;
+		double timestampUs = 0.0;
+		double durationUs = 0.0;
+		int64_t value = 0;  // Counter events
+		uint32_t pid = 0;
+		uint32_t tid = 0;
+		char phase = 'X';   // 'X' span, 'i' instant, 'C' counter
+	};
+
+	struct GpuAnchor {
+		bool valid = false;
+		uint64_t ticks = 0;
+		double timestampUs = 0.0;
+	};
+
+	double ToTraceUs(Clock::time_point time) const;
+	double GpuToTraceUs(rhi::QueueKind queue, uint64_t ticks, uint64_t ticksPerSecond);
+	void Push(Event&& event);
+	void WriterMain();
+	void WriteEvent(const Event& event);
+
+	static constexpr uint32_t kCpuPid = 1;
+	static constexpr uint32_t kGpuPid = 2;
+
+	std::atomic<bool> m_capturing = false;
+	Clock::time_point m_captureStart{};
+	Clock::time_point m_frameStart{};
+	std::array<std::atomic<uint64_t>, static_cast<size_t>(FrameTraceCounter::Count)> m_counters{};
+	std::array<GpuAnchor, 3> m_gpuAnchors{}; // Indexed by rhi::QueueKind
+	std::atomic<uint32_t> m_nextThreadId = 1;
+
+	std::mutex m_frameMutex; // Guards m_frameEvents and m_gpuAnchors
+	std::vector<Event> m_frameEvents;
+
+	std::mutex m_queueMutex;
+	std::condition_variable m_queueCv;
+	std::deque<std::vector<Event>> m_queuedFrames;
+	uint32_t m_maxQueuedFrames = 0;
+	uint64_t m_droppedFrames = 0;
+	bool m_quit = false;
+	std::thread m_writerThread;
+
+	// Writer thread only
+	std::ofstream m_out;
+	bool m_firstEvent = true;
+};
+
+// Adds a CPU span for the enclosing scope to the frame trace while a capture is running.
+class FrameTraceScope {
+public:
+	explicit FrameTraceScope(const char* name)
+		: m_name(FrameTraceWriter::GetInstance().IsCapturing() ? name : nullptr) {
+		if (m_name) {
+			m_begin = FrameTraceWriter::Clock::now();
+		}
+	}
+	~FrameTraceScope() {
+		if (m_name) {
+			FrameTraceWriter::GetInstance().CpuSpan(m_name, m_begin, FrameTraceWriter::Clock::now());
+		}
+	}
+	FrameTraceScope(const FrameTraceScope&) = delete;
+	FrameTraceScope& operator=(const FrameTraceScope&) = delete;
+
+private:
+	const char* m_name;
+	FrameTraceWriter::Clock::time_point m_begin{};
+};
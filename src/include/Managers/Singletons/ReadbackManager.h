@@ -2,12 +2,18 @@
 #include <memory>
 #include <vector>
 #include <atomic>
+#include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <rhi.h>
 
 #include "Render/QueueKind.h"
 #include "Resources/ReadbackRequest.h"
+#include "Managers/ReadbackPagePool.h"
+#include "Render/Runtime/IReadbackReducer.h"
+#include "Render/Runtime/OpenRenderGraphSettings.h"
 
 class Resource;
 
@@ -18,6 +24,7 @@ struct ReadbackCaptureInfo {
 	RangeSpec range{};
 	ReadbackCaptureCallback callback;
 	QueueKind preferredQueueKind = QueueKind::Graphics;
+	ReadbackReductionDesc reduction{};
 };
 
 struct ReadbackCaptureToken {
@@ -27,12 +34,14 @@ struct ReadbackCaptureToken {
 class ReadbackManager {
 public:
 	static ReadbackManager& GetInstance();
+	~ReadbackManager() { StopCallbackWorker(); }
 
 	void Initialize(rhi::Timeline graphicsReadbackFence, rhi::Timeline copyReadbackFence) {
 		m_graphicsReadbackFence = graphicsReadbackFence;
 		m_copyReadbackFence = copyReadbackFence;
 		m_initialized = m_graphicsReadbackFence.IsValid() || m_copyReadbackFence.IsValid();
 		m_warnedUninitializedUse = false;
+		m_callbackDispatch = rg::runtime::GetOpenRenderGraphSettings().readbackCallbackDispatch;
 	}
 
 	void RequestReadbackCapture(
@@ -42,10 +51,32 @@ public:
 		ReadbackCaptureCallback callback,
 		QueueKind preferredQueueKind = QueueKind::Graphics);
 
+	// Throws if `reduction` needs a reducer that is not registered, or is Texel on a buffer.
+	void RequestReadbackReduction(
+		const std::string& passName,
+		Resource* resource,
+		const RangeSpec& range,
+		const ReadbackReductionDesc& reduction,
+		ReadbackCaptureCallback callback,
+		QueueKind preferredQueueKind = QueueKind::Graphics);
+
+	void RegisterReadbackReducer(std::shared_ptr<rg::runtime::IReadbackReducer> reducer);
+	std::shared_ptr<rg::runtime::IReadbackReducer> GetReadbackReducer(ReadbackReductionKind kind);
+
 	std::vector<ReadbackCaptureInfo> ConsumeCaptureRequests();
 
 	ReadbackCaptureToken EnqueueCapture(ReadbackCaptureRequest&& request);
+	// One token covers every request of the batch, so a single FinalizeCapture signals them all.
+	ReadbackCaptureToken EnqueueCaptureBatch(std::vector<ReadbackCaptureRequest>&& requests);
 	void FinalizeCapture(ReadbackCaptureToken token, QueueKind queueKind, std::shared_ptr<rhi::TimelinePtr> signalFenceOwner, uint64_t fenceValue);
+	// Hands the fences finalized since the last call to the fence waiter; they are only waited
+	// on once the command lists that signal them are submitted.
+	void OnFrameSubmitted();
+
+	// Sub-allocates from the readback page ring for `queueKind`. The allocation is released
+	// once ProcessReadbackRequests has delivered the capture that carries it.
+	// `shareCount` captures of a batch may share one allocation; each releases its share.
+	ReadbackAllocation AllocateReadback(QueueKind queueKind, uint64_t size, uint64_t alignment, uint32_t shareCount = 1);
 
 	uint64_t GetNextReadbackFenceValue(QueueKind queueKind);
 	rhi::Timeline GetReadbackFence(QueueKind queueKind) const;
@@ -53,14 +84,19 @@ public:
 	void ProcessReadbackRequests();
 
 	void Cleanup() {
+		StopCallbackWorker();
 		m_queuedCaptures.clear();
+		m_readbackReducers.clear();
 		m_readbackCaptureRequests.clear();
+		m_unsubmittedFenceWaits.clear();
 		m_graphicsReadbackFence.Reset();
 		m_copyReadbackFence.Reset();
 		m_initialized = false;
 		m_warnedUninitializedUse = false;
 		m_captureFenceValueGraphics.store(0, std::memory_order_relaxed);
 		m_captureFenceValueCopy.store(0, std::memory_order_relaxed);
+		m_graphicsReadbackPages.Cleanup();
+		m_copyReadbackPages.Cleanup();
 	}
 
 private:
@@ -74,6 +110,23 @@ private:
 		return NormalizeQueueKind(queueKind) == QueueKind::Copy ? m_copyReadbackFence : m_graphicsReadbackFence;
 	}
 
+	ReadbackPagePool& ResolveReadbackPages(QueueKind queueKind) {
+		return NormalizeQueueKind(queueKind) == QueueKind::Copy ? m_copyReadbackPages : m_graphicsReadbackPages;
+	}
+
+	void ReleaseReadback(const ReadbackCaptureRequest& request);
+	// Caller holds readbackRequestsMutex.
+	void DeliverCompletedCapturesLocked(bool workerDispatchOnly);
+
+	struct PendingCallback {
+		ReadbackCaptureCallback callback;
+		ReadbackCaptureResult result;
+	};
+
+	void DispatchToCallbackWorker(PendingCallback&& pending);
+	void CallbackWorkerMain();
+	void StopCallbackWorker();
+
 	rhi::Timeline m_graphicsReadbackFence;
 	rhi::Timeline m_copyReadbackFence;
 	bool m_initialized = false;
@@ -81,12 +134,34 @@ private:
 	std::mutex readbackRequestsMutex;
 	std::vector<ReadbackCaptureRequest> m_readbackCaptureRequests;
 
+	struct UnsubmittedFenceWait {
+		std::shared_ptr<rhi::TimelinePtr> signalFenceOwner;
+		rhi::Timeline timeline;
+		uint64_t value = 0;
+	};
+	std::vector<UnsubmittedFenceWait> m_unsubmittedFenceWaits; // Guarded by readbackRequestsMutex
+
 	std::mutex m_captureQueueMutex;
 	std::vector<ReadbackCaptureInfo> m_queuedCaptures;
+	std::vector<std::shared_ptr<rg::runtime::IReadbackReducer>> m_readbackReducers; // Guarded by m_captureQueueMutex
 	std::atomic<uint64_t> m_captureTokenCounter = 0;
 	std::atomic<uint64_t> m_captureFenceValueGraphics = 0;
 	std::atomic<uint64_t> m_captureFenceValueCopy = 0;
 
+	// Pages are reclaimed per capture once its fence has completed, so each ring only
+	// needs to outlive the captures recorded on its queue.
+	ReadbackPagePool m_graphicsReadbackPages;
+	ReadbackPagePool m_copyReadbackPages;
+
+	// Readback worker for ReadbackCallbackDispatch::Worker, started on first use. It drains
+	// everything queued before it exits.
+	rg::runtime::ReadbackCallbackDispatch m_callbackDispatch = rg::runtime::ReadbackCallbackDispatch::Inline;
+	std::mutex m_callbackMutex;
+	std::condition_variable m_callbackCv;
+	std::deque<PendingCallback> m_pendingCallbacks;
+	std::thread m_callbackThread;
+	bool m_callbackQuit = false;
+
 	// Static pointer to hold the instance
 	static std::unique_ptr<ReadbackManager> instance;
 	// Static initialization flag
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+#include <memory>
 #include <vector>
 #include <string>
 #include <string_view>
@@ -9,13 +11,18 @@
 #include <functional>
 #include <limits>
 #include <mutex>
+#include <span>
 #include <rhi.h>
+#include "Render/PassId.h"
+#include "Render/Runtime/OpenRenderGraphSettings.h"
 #include "Render/Runtime/StatisticsTypes.h"
+#include "Managers/TracyGpuTimeline.h"
 
 using QueryRecordingContext = rg::runtime::QueryRecordingContext;
 
 using PassStats = rg::runtime::PassStats;
 using MeshPipelineStats = rg::runtime::MeshPipelineStats;
+using BatchQueueStats = rg::runtime::BatchQueueStats;
 
 class StatisticsManager {
 public:
@@ -23,13 +30,13 @@ public:
 
 	void Initialize();
 
-	void RegisterPasses(const std::vector<std::string>& passNames);
-    
-	unsigned RegisterPass(const std::string& passName, bool isGeometryPass = false, std::string_view techniquePath = {});
+	// Per-pass data is indexed by passId.index, which the graph hands out densely and keeps stable
+	// across rebuilds. Registering an ID again only adds the geometry flag or a missing technique path.
+	void RegisterPass(PassId passId, std::string_view passName, bool isGeometryPass = false, std::string_view techniquePath = {});
 
 	void BeginFrame();
 
-	void MarkGeometryPass(const std::string& passName);
+	void MarkGeometryPass(PassId passId);
 
 	void RegisterQueue(rhi::QueueKind queue);
 
@@ -57,8 +64,19 @@ public:
 	void ResolveQueries(unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx);
 	void MergePendingResolves(rhi::QueueKind queueKind, unsigned frameIndex, QueryRecordingContext& ctx);
 
+	// Timestamps around one queue slot's part of a batch, kept apart from the pass queries.
+	void BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList);
+	void EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList);
+	void BeginBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx);
+	void EndBatchQuery(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmdList, QueryRecordingContext& ctx);
+	// Waits and signal of a batch entry, shown as markers on the Tracy GPU timeline. Writes only
+	// that entry's slot, so recording tasks may call it for their own entries concurrently.
+	void SetBatchQueueSync(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, std::span<const rg::runtime::BatchQueueWait> waits, uint64_t signalValue);
+
 	void OnFrameComplete(unsigned frameIndex,
 		rhi::Queue& queue);
+	// Lock-free: samples go to the calling thread's accumulator and reach PassStats when the
+	// accumulators are merged in BeginFrame or OnFrameComplete, as one EMA sample per frame.
 	void RecordCpuUpdateTime(unsigned passIndex, double milliseconds);
 	void RecordCpuExecuteTime(unsigned passIndex, double milliseconds);
 
@@ -72,20 +90,111 @@ public:
 	const std::vector<std::string>&        GetPassTechniquePaths() const { return m_passTechniquePaths; }
 	const std::vector<PassStats>&          GetPassStats() const { return m_stats; }
 	const std::vector<MeshPipelineStats>&  GetMeshStats() const { return m_meshStatsEma; }
+	const std::vector<BatchQueueStats>&    GetBatchStats() const { return m_batchStats; }
 	rg::runtime::MemoryBudgetStats GetMemoryBudgetStats() const { return m_memoryBudgetStats; }
 
 private:
 	StatisticsManager() = default;
 	~StatisticsManager() = default;
 
-	void EnsureQueueBuffers(rhi::QueueKind queueKind);
+	// Per queue kind query state; recordedQueries and pendingResolves are indexed by frame.
+	// Keyed by kind rather than queue slot because IStatisticsService only receives rhi::Queue.
+	// All slots of one kind share an entry: their query indices never collide (one pair per pass,
+	// and per batch and slot for batch entries), the graph merges each slot's pending resolves
+	// into its kind, and OnFrameComplete reads a kind's frame once.
+	// The readback buffers form a ring with one region per frame in flight (TimestampFrameBase)
+	// and stay mapped for their lifetime; a region is only read in OnFrameComplete for its frame,
+	// numFramesInFlight frames after its resolves were recorded, so reading needs no wait or Map.
+	struct QueueData {
+		bool registered = false;
+		rhi::ResourcePtr timestampBuffer;
+		rhi::ResourcePtr meshStatsBuffer;
+		const uint8_t* timestampMapped = nullptr;
+		const uint8_t* meshStatsMapped = nullptr;
+		std::vector<std::vector<uint32_t>> recordedQueries;
+		std::vector<std::vector<std::pair<uint32_t, uint32_t>>> pendingResolves;
+	};
+	static constexpr size_t kQueueKindCount = 3; // Graphics, Compute, Copy
+
+	// CPU time recorded by one thread since the last merge, indexed by pass.
+	struct CpuTimingSample {
+		double updateMs = 0.0;
+		double executeMs = 0.0;
+		uint32_t updateCount = 0;
+		uint32_t executeCount = 0;
+	};
+	struct BatchQueueSync {
+		std::array<rg::runtime::BatchQueueWait, rg::runtime::kStatisticsMaxQueueSlots> waits{};
+		uint32_t waitCount = 0;
+		uint64_t signalValue = 0;
+	};
+
+	// Only its own thread and MergeCpuTimings take the mutex, so recording never contends with
+	// another recording thread, and a merge that overlaps recording cannot tear a sample.
+	struct CpuTimingAccumulator {
+		std::mutex mutex;
+		std::vector<CpuTimingSample> samples;
+		bool dirty = false;
+	};
+
+	QueueData* FindQueue(rhi::QueueKind queueKind);
+	template<class T>
+	static T& FrameEntry(std::vector<T>& perFrame, unsigned frameIndex) {
+		if (frameIndex >= perFrame.size()) {
+			perFrame.resize(frameIndex + 1);
+		}
+		return perFrame[frameIndex];
+	}
+
+	void EnsureQueueBuffers(QueueData& queueData);
+	// Maps both readback buffers once; OnFrameComplete skips a queue whose mapping failed.
+	void MapQueueBuffers(QueueData& queueData);
+	// Unmaps and hands the buffers to the deletion manager, as frames in flight may still resolve into them.
+	void ReleaseQueueBuffers(QueueData& queueData);
 	void RecordCpuTimeSample(unsigned passIndex, double milliseconds, bool isUpdate);
+	CpuTimingAccumulator& ThreadCpuTimingAccumulator();
+	void MergeCpuTimings();
+	// In Sampled mode, whether the pass is in this frame's timing window. Passes whose pipeline
+	// statistics are sampled this frame are always timed, since their readback follows the timestamps.
+	bool IsPassSampled(unsigned passIndex) const;
+	// Picks this frame's pipeline statistics passes: every pipelineStatisticsSampleIntervalFrames
+	// frames, the next pipelineStatisticsSampledPassesPerFrame geometry passes (0 = all of them).
+	void RebuildPipelineStatsSample();
+	bool SamplesPipelineStats(unsigned passIndex) const {
+		return passIndex < m_pipelineStatsSampled.size() && m_pipelineStatsSampled[passIndex] != 0;
+	}
+	bool PipelineStatsRecorded(unsigned frameIndex, unsigned passIndex) const {
+		return frameIndex < m_pipelineStatsRecorded.size() && passIndex < m_pipelineStatsRecorded[frameIndex].size()
+			&& m_pipelineStatsRecorded[frameIndex][passIndex] != 0;
+	}
+	// Writes the begin (0) or end (1) timestamp of a batch entry; returns false when not recorded.
+	bool WriteBatchTimestamp(unsigned batchIndex, unsigned queueSlot, unsigned frameIndex, rhi::Queue& queue, rhi::CommandList& cmd, uint32_t which, uint32_t& outIndex);
+	// Sends one read-back timestamp pair, and its batch's sync markers, to the Tracy GPU timeline
+	// and the frame trace, whichever are enabled.
+	void ExportGpuTimelineEntry(rhi::QueueKind queueKind, unsigned frameIndex, uint32_t entry, uint64_t t0, uint64_t t1, bool toTracy, bool toFrameTrace);
+	// Timestamp entries per frame: one per pass of capacity, then the batch entries.
+	uint32_t TimestampFrameBase(unsigned frameIndex) const { return frameIndex * (m_queryPoolPassCapacity + kBatchQueryEntries); }
 
 	bool m_collectPassStatistics = true;
 	std::function<bool()> m_getCollectPassStatistics;
 	bool m_collectPipelineStatistics = false;
 	std::function<bool()> m_getCollectPipelineStatistics;
-	std::mutex m_cpuStatsMutex;
+	rg::runtime::PassStatisticsMode m_passStatisticsMode = rg::runtime::PassStatisticsMode::Sampled;
+	uint32_t m_sampledPassesPerFrame = 8;
+	uint32_t m_sampleWindowBegin = 0; // First pass of the rotating window; advanced in BeginFrame
+	uint32_t m_pipelineStatsIntervalFrames = 1;
+	uint32_t m_pipelineStatsPassesPerFrame = 0;
+	uint32_t m_pipelineStatsCursor = 0; // Next pass the pipeline statistics rotation considers
+	// Per pass, whether BeginQuery opens a pipeline statistics query this frame. uint8_t rather than
+	// bool so recording tasks can touch distinct passes concurrently.
+	std::vector<uint8_t> m_pipelineStatsSampled;
+	// Per frame in flight and pass, whether a pipeline statistics query was recorded, so resolve and
+	// readback follow what was recorded even if the sample or the settings changed since.
+	std::vector<std::vector<uint8_t>> m_pipelineStatsRecorded;
+	std::mutex m_cpuAccumulatorRegistryMutex; // Taken once per recording thread, to register its accumulator
+	std::vector<std::unique_ptr<CpuTimingAccumulator>> m_cpuAccumulators;
+	std::vector<CpuTimingSample> m_cpuTimingMergeScratch; // Per pass sums of one merge
+	static thread_local CpuTimingAccumulator* s_cpuAccumulator;
 
 	rhi::QueryPoolPtr m_timestampPool;
 	rhi::QueryPoolPtr m_pipelineStatsPool;
@@ -94,15 +203,12 @@ private:
 	std::vector<rhi::PipelineStatsFieldDesc> m_pipelineStatsFields;
 	rhi::PipelineStatsLayout m_pipelineStatsLayout;
 
-	std::unordered_map<rhi::QueueKind, rhi::ResourcePtr> m_timestampBuffers;
-	std::unordered_map<rhi::QueueKind, rhi::ResourcePtr> m_meshStatsBuffers;
+	std::array<QueueData, kQueueKindCount> m_queues;
 
 	UINT64    m_gpuTimestampFreq = 0;
 	unsigned  m_numPasses = 0;
 	unsigned  m_numFramesInFlight = 0;
 	unsigned  m_queryPoolPassCapacity = 0;
-	uint64_t  m_unnamedPassCounter = 0;
-	std::unordered_map<std::string, unsigned> m_passNameToIndex;
 	uint64_t  m_frameSerial = 0;
 	static constexpr uint64_t kNeverSeenFrame = (std::numeric_limits<uint64_t>::max)();
 	uint64_t  m_defaultMaxStaleFrames = 240;
@@ -119,9 +225,13 @@ private:
 	std::vector<MeshPipelineStats>  m_meshStatsEma;
 	rg::runtime::MemoryBudgetStats m_memoryBudgetStats{};
 
-	// Recording helpers per queue/frame
-	std::unordered_map<rhi::QueueKind,
-		std::unordered_map<unsigned, std::vector<unsigned>>> m_recordedQueries;
-	std::unordered_map<rhi::QueueKind,
-		std::unordered_map<unsigned, std::vector<std::pair<unsigned,unsigned>>>> m_pendingResolves;
+	// Per batch and queue slot data
+	static constexpr uint32_t kBatchQueryEntries = rg::runtime::kStatisticsMaxBatches * rg::runtime::kStatisticsMaxQueueSlots;
+	std::vector<BatchQueueStats>    m_batchStats = std::vector<BatchQueueStats>(kBatchQueryEntries);
+
+	// GPU timeline export to Tracy and the frame trace; m_batchSync is indexed by frame, then
+	// BatchQueueStatsIndex, and only allocated once either export is used.
+	bool m_exportTracyGpuZones = false;
+	std::vector<std::vector<BatchQueueSync>> m_batchSync;
+	TracyGpuTimeline m_tracyGpuTimeline;
 };
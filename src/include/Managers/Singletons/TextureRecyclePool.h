@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "Resources/TextureDescription.h"
+
+class GpuTextureBacking;
+
+// Keeps the committed backings that PixelBuffers let go of, so a later Materialize with an
+// equivalent description reuses the API resource instead of creating a new one.
+//
+// A retired backing may still be referenced by frames in flight, so it only becomes reusable after
+// the same numFramesInFlight + 1 frame ticks DeletionManager waits before freeing. It is destroyed
+// once it has sat unused for textureRecyclePoolMaxIdleFrames more ticks, or earlier (oldest first)
+// when the pool would grow past textureRecyclePoolMaxBytes.
+class TextureRecyclePool {
+public:
+	struct Stats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+		uint64_t pooledBytes = 0;
+		size_t pooledBackings = 0;
+	};
+
+	static TextureRecyclePool& GetInstance();
+
+	// Takes ownership of a committed backing; with the pool disabled the backing is destroyed.
+	void Retire(std::unique_ptr<GpuTextureBacking> backing);
+	// A fence-safe retired backing created from an equivalent description, or null.
+	std::unique_ptr<GpuTextureBacking> Acquire(const TextureDescription& desc);
+	// Advances the retirement clock; called once per frame next to DeletionManager::ProcessDeletions.
+	void ProcessFrame();
+	void Clear();
+
+	Stats GetStats() const;
+
+private:
+	struct Entry {
+		std::unique_ptr<GpuTextureBacking> backing;
+		uint64_t retiredFrame = 0;
+		uint64_t sizeBytes = 0;
+	};
+
+	TextureRecyclePool() = default;
+
+	void EvictOldestLocked();
+
+	mutable std::mutex m_mutex;
+	std::unordered_map<uint64_t, std::deque<Entry>> m_entriesByShape; // Oldest first per shape
+	uint64_t m_frame = 0;
+	Stats m_stats{};
+};
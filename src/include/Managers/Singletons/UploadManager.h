@@ -14,11 +14,15 @@
 #include "Render/ResourceRegistry.h"
 #include "Interfaces/IDynamicDeclaredResources.h"
 #include "RenderPasses/Base/RenderPass.h"
+#include "RenderPasses/Base/CopyPass.h"
 #include "Resources/Buffers/Buffer.h"
 #include "Render/ImmediateExecution/ImmediateCommandList.h"
 #include "Render/Runtime/UploadTypes.h"
 #include "Render/Runtime/StreamingUploadTypes.h"
+#include "Render/Runtime/IStreamingDecompressor.h"
+#include "Render/Runtime/IMipGenerator.h"
 #include "Managers/AsyncCopyPagePool.h"
+#include "Managers/StreamingFileReader.h"
 #include "Managers/UploadInstance.h"
 
 class Buffer;
@@ -31,14 +35,15 @@ struct ResourceCopy {
 	size_t size;
 	uint64_t sourceGlobalResourceId = 0;
 	uint64_t destinationGlobalResourceId = 0;
-	std::string sourceDebugName;
-	std::string destinationDebugName;
+	const std::string* sourceDebugName = nullptr;      // Interned; see UploadInstance::InternDebugName
+	const std::string* destinationDebugName = nullptr;
 };
 
 class UploadManager {
 public:
 	using UploadResolveContext = rg::runtime::UploadResolveContext;
 	using UploadTarget = rg::runtime::UploadTarget;
+	using UploadReservation = rg::runtime::UploadReservation;
 
 	static UploadManager& GetInstance();
 	void Initialize();
@@ -69,32 +74,127 @@ public:
 		const rhi::helpers::SubresourceData* srcSubresources,
 		uint32_t srcCount);
 #endif	
+#if BUILD_TYPE == BUILD_TYPE_DEBUG
+	UploadReservation ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size, const char* file, int line);
+#else
+	UploadReservation ReserveUpload(UploadTarget resourceToUpdate, size_t dataBufferOffset, size_t size);
+#endif
+	void CommitUpload(UploadReservation&& reservation);
 	void ProcessUploads(uint8_t frameIndex, rg::imm::ImmediateCommandList& commandList);
 	void QueueResourceCopy(const std::shared_ptr<Resource>& destination, const std::shared_ptr<Resource>& source, size_t size);
 	void ExecuteResourceCopies(uint8_t frameIndex, rg::imm::ImmediateCommandList& commandList);
 	void ProcessDeferredReleases(uint8_t frameIndex);
 	void SetUploadResolveContext(UploadResolveContext ctx);
+	void SetTaskService(std::shared_ptr<rg::runtime::ITaskService> taskService);
 	std::shared_ptr<RenderPass> GetUploadPass() const { return m_uploadPass; }
+	/// Copy-queue pass for resource copies of at least resourceCopyQueueMinBytes.
+	/// Copies only route to it once it has been fetched, and the host must add
+	/// it to the graph ahead of the upload pass so the graph orders both writers
+	/// of a grown buffer correctly. Returns null while the threshold is 0.
+	std::shared_ptr<CopyPass> GetResourceCopyPass();
 	std::string DescribeQueuedTargetByGlobalResourceId(uint64_t globalResourceId);
 
 	// ── Streaming upload API (copy-queue path) ──────────────────────────
 	/// Queue a streaming upload that will be executed on the copy queue
-	/// via StreamingUploadPass. The data is copied into a dedicated
-	/// upload-heap page pool (AsyncCopyPagePool) immediately.
+	/// via StreamingUploadPass. The data is copied into the streaming
+	/// page pool (AsyncCopyPagePool) immediately; its page stays pinned
+	/// while the upload waits in the backlog.
 	/// Thread-safe.
 	void QueueStreamingUpload(const void* data, size_t size,
 	                          std::shared_ptr<Resource> destination,
-	                          size_t dstOffset = 0);
+	                          size_t dstOffset = 0,
+	                          StreamingUploadPriority priority = StreamingUploadPriority::Normal);
+
+	/// Texture counterpart of QueueStreamingUpload: the subresources are laid
+	/// out in copyable footprints and copied on the copy queue, one
+	/// descriptor per subresource. Thread-safe.
+	void QueueStreamingTextureUpload(std::shared_ptr<Resource> destination,
+	                                 rhi::Format fmt,
+	                                 uint32_t baseWidth,
+	                                 uint32_t baseHeight,
+	                                 uint32_t depthOrLayers,
+	                                 uint32_t mipLevels,
+	                                 uint32_t arraySize,
+	                                 const rhi::helpers::SubresourceData* srcSubresources,
+	                                 uint32_t srcCount,
+	                                 StreamingUploadPriority priority = StreamingUploadPriority::Normal);
 
-	/// Drain all pending streaming uploads. Returns the descriptors to be
-	/// fed into a StreamingUploadPass. Called once per frame by the
-	/// extension that creates the pass.
+	/// File-backed streaming uploads: the range is read on a background
+	/// thread straight into the streaming page pool (no CPU staging copy)
+	/// and queued like QueueStreamingUpload once the read lands. The ticket
+	/// reports the read and, after CloseStreamingUploadRegion, the copy
+	/// fence value to wait on. Thread-safe.
+	std::shared_ptr<StreamingUploadTicket> QueueStreamingFileUpload(
+	    const StreamingFileSource& source,
+	    std::shared_ptr<Resource> destination,
+	    size_t dstOffset = 0,
+	    StreamingUploadPriority priority = StreamingUploadPriority::Normal);
+	/// Texture variant; the file range is already in footprint layout.
+	/// source.offset + each footprint.offset must be 512-byte aligned.
+	std::shared_ptr<StreamingUploadTicket> QueueStreamingFileTextureUpload(
+	    const StreamingFileSource& source,
+	    std::shared_ptr<Resource> destination,
+	    std::vector<StreamingTextureFootprint> footprints,
+	    StreamingUploadPriority priority = StreamingUploadPriority::Normal);
+
+	/// Take this frame's streaming uploads, to be fed into a
+	/// StreamingUploadPass. Called once per frame by the extension that
+	/// creates the pass. With streamingUploadFrameBudgetBytes set, uploads
+	/// are picked by priority up to the budget and the rest stay queued.
 	std::vector<StreamingUploadDescriptor> ConsumeStreamingUploads();
+	StreamingUploadStats GetStreamingUploadStats();
+
+	/// Tag the pages read by the uploads consumed since the last call with
+	/// the copy-queue fence value signaled after their StreamingUploadPass.
+	void CloseStreamingUploadRegion(uint64_t copyFenceValue);
 
-	/// Reset the streaming page pool for the next frame. Should be called
-	/// once the GPU is done with the previous frame's streaming uploads.
+	/// Recycle streaming pages whose copies have completed and trim pages
+	/// that have been idle a long time. Call once per frame.
+	void ReclaimStreamingPagePool(uint64_t completedCopyFenceValue);
+
+	/// Reclaim everything already consumed, for callers that have waited
+	/// for the copy queue to idle and have no fence values to hand.
 	void ResetStreamingPagePool() { m_streamingPagePool.ResetForFrame(); }
 
+	// ── GPU decompression of streaming uploads ──────────────────────────
+	/// Decoders are supplied by the application, one per codec ID; a later
+	/// registration for the same codec replaces the earlier one.
+	void RegisterStreamingDecompressor(std::shared_ptr<rg::runtime::IStreamingDecompressor> decompressor);
+
+	/// Copy `compressedSize` bytes into the streaming page pool for the
+	/// registered decompressor to expand into `destination` (a UAV buffer)
+	/// at `dstOffset`. Throws if no decompressor is registered for `codec`.
+	/// Thread-safe.
+	void QueueStreamingCompressedUpload(uint32_t codec,
+	                                    const void* data, size_t compressedSize, size_t uncompressedSize,
+	                                    std::shared_ptr<Resource> destination, size_t dstOffset = 0);
+
+	/// Take this frame's decompression jobs, grouped by codec, to be fed
+	/// into a StreamingDecompressionPass. Their pages are covered by the
+	/// next CloseStreamingUploadRegion, so the fence value passed there must
+	/// also cover the decompression pass.
+	std::vector<StreamingDecompressionJob> ConsumeStreamingDecompressionJobs();
+	std::vector<std::shared_ptr<rg::runtime::IStreamingDecompressor>> GetStreamingDecompressors();
+	StreamingDecompressionStats GetStreamingDecompressionStats();
+
+	// ── GPU mip generation ───────────────────────────────────────────────
+	/// The single-pass downsampler is supplied by the application; a later
+	/// registration replaces the earlier one.
+	void RegisterMipGenerator(std::shared_ptr<rg::runtime::IMipGenerator> generator);
+
+	/// Build mips [sourceMip + 1, sourceMip + mipCount] of `target` once its
+	/// queued uploads have run; UINT32_MAX counts extend to the end of the
+	/// chain or array. Throws if no generator is registered. Thread-safe.
+	void QueueMipGeneration(UploadTarget target, uint32_t sourceMip = 0, uint32_t mipCount = UINT32_MAX,
+	                        uint32_t firstSlice = 0, uint32_t sliceCount = UINT32_MAX);
+
+	/// Take this frame's mip generation jobs, resolved against their
+	/// textures, to be split with BuildMipGenerationBatches into
+	/// MipGenerationPasses recorded after the upload pass. Jobs whose
+	/// target no longer resolves are dropped.
+	std::vector<rg::runtime::MipGenerationJob> ConsumeMipGenerationJobs();
+	std::shared_ptr<rg::runtime::IMipGenerator> GetMipGenerator();
+
 	void Cleanup();
 private:
 
@@ -137,29 +237,91 @@ private:
 
 	};
 
+	// Runs the large resource copies on the copy queue; the graph inserts the
+	// handoff to whichever queue next uses each destination.
+	class ResourceCopyPass : public CopyPass, public IDynamicDeclaredResources, public IHasImmediateModeCommands {
+	public:
+		void DeclareResourceUsages(CopyPassBuilder* builder) override {
+			GetInstance().DeclareResourceCopyPassResourceUsages(builder);
+		}
+
+		void Setup() override {}
+
+		void RecordImmediateCommands(ImmediateExecutionContext& context) override {
+			GetInstance().ExecuteCopyQueueResourceCopies(context.list);
+		}
+
+		PassReturn Execute(PassExecutionContext& context) override {
+			return {};
+		}
+
+		void Cleanup() override {}
+
+		bool DeclaredResourcesChanged() const override {
+			return m_declaredResourcesDirty.exchange(false);
+		}
+
+		void MarkDeclaredResourcesDirty() {
+			m_declaredResourcesDirty.store(true);
+		}
+
+	private:
+		mutable std::atomic_bool m_declaredResourcesDirty = true;
+	};
+
 	UploadManager() {
 		m_uploadPass = std::make_shared<UploadPass>();
 	}
 	void MarkUploadPassDirty();
+	void MarkResourceCopyPassDirty();
 	void DeclareUploadPassResourceUsages(RenderPassBuilder* builder);
-	void CaptureResourceCopyTelemetry(ResourceCopy& copy);
-	void RefreshQueuedCopyTelemetryLocked();
+	void DeclareResourceCopyPassResourceUsages(CopyPassBuilder* builder);
+	void ExecuteCopyQueueResourceCopies(rg::imm::ImmediateCommandList& commandList);
+	static void RecordResourceCopies(std::vector<ResourceCopy>& copies, rg::imm::ImmediateCommandList& commandList);
+	void CaptureResourceCopyTelemetry(ResourceCopy& copy, bool withNames);
+	void RefreshQueuedCopyTelemetryLocked(bool withNames);
 	bool IsUploadTargetValid(const UploadTarget& target, const char* reason, const char* file, int line);
-	void CaptureUploadTargetTelemetry(const UploadTarget& target, uint64_t& outId, std::string& outName);
+	void CaptureUploadTargetTelemetry(const UploadTarget& target, uint64_t& outId, const std::string** outName);
+	StreamingFileReader& GetStreamingFileReaderLocked();
+	void QueueStreamingDescriptorsLocked(std::vector<StreamingUploadDescriptor>&& descs);
 
 	uint8_t m_numFramesInFlight = 0;
+	bool m_captureNamesOnQueue = false;
 
 	std::vector<ResourceCopy> queuedResourceCopies;
+	std::vector<ResourceCopy> m_copyQueueResourceCopies; // Routed to m_resourceCopyPass
+	uint64_t m_resourceCopyQueueMinBytes = 0;
 	std::mutex m_uploadQueueMutex;
 
 	UploadResolveContext m_ctx{};
+	std::shared_ptr<rg::runtime::ITaskService> m_taskService;
 	std::shared_ptr<UploadPass> m_uploadPass;
+	std::shared_ptr<ResourceCopyPass> m_resourceCopyPass;
 	std::unique_ptr<UploadInstance> m_uploadInstance;
 
 	// ── Streaming upload (copy-queue) state ─────────────────────────────
 	AsyncCopyPagePool                     m_streamingPagePool;
 	std::mutex                            m_streamingMutex;
 	std::vector<StreamingUploadDescriptor> m_pendingStreamingUploads;
+	uint64_t                              m_nextStreamingSequence = 0;
+	std::unique_ptr<StreamingFileReader>  m_streamingFileReader;
+	std::vector<std::shared_ptr<StreamingUploadTicket>> m_ticketsAwaitingFence;
+	StreamingUploadStats                  m_lastStreamingStats{};
+	std::vector<std::shared_ptr<rg::runtime::IStreamingDecompressor>> m_streamingDecompressors;
+	std::vector<StreamingDecompressionJob> m_pendingDecompressionJobs;
+	uint64_t                              m_decompressionStagingMicroseconds = 0;
+	StreamingDecompressionStats           m_lastDecompressionStats{};
+
+	struct PendingMipGeneration {
+		UploadTarget target;
+		uint32_t sourceMip = 0;
+		uint32_t mipCount = 0;
+		uint32_t firstSlice = 0;
+		uint32_t sliceCount = 0;
+	};
+	std::mutex                            m_mipGenerationMutex;
+	std::shared_ptr<rg::runtime::IMipGenerator> m_mipGenerator;
+	std::vector<PendingMipGeneration>     m_pendingMipGenerations;
 
 };
 
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "Managers/AsyncCopyPagePool.h"
+#include "Render/Runtime/StreamingUploadTypes.h"
+
+// Reads file ranges straight into AsyncCopyPagePool pages on a background thread, so streamed
+// asset data never passes through a CPU staging buffer. Reads are unbuffered: the range is widened
+// to kReadAlignment on both ends and read into a page allocation with the same alignment.
+//
+// The RHI has no GPU-direct storage entry point yet; when it gains one, it slots in here in place
+// of ReadRange.
+class StreamingFileReader {
+public:
+	static constexpr size_t kReadAlignment = 4096;
+
+	// `dataOffset` is where the first requested byte landed in `allocation.buffer`. On failure the
+	// reader has already released the allocation.
+	using Completion = std::function<void(bool succeeded, const AsyncCopyPagePool::Allocation& allocation, size_t dataOffset)>;
+
+	explicit StreamingFileReader(AsyncCopyPagePool& pool);
+	~StreamingFileReader();
+
+	StreamingFileReader(const StreamingFileReader&) = delete;
+	StreamingFileReader& operator=(const StreamingFileReader&) = delete;
+
+	// `submitCount` is forwarded to AsyncCopyPagePool::Allocate. Thread-safe.
+	void Enqueue(StreamingFileSource source, uint32_t submitCount, Completion completion);
+
+	// Finishes the read in flight, fails the rest and joins the thread.
+	void Stop();
+
+private:
+	struct Request {
+		StreamingFileSource source;
+		uint32_t submitCount = 1;
+		Completion completion;
+	};
+
+	void WorkerMain();
+	void Execute(Request& request);
+	bool ReadRange(const StreamingFileSource& source, uint64_t fileOffset, size_t size, uint8_t* destination);
+	void* OpenCached(const std::filesystem::path& path);
+	void CloseCached();
+
+	AsyncCopyPagePool& m_pool;
+	std::mutex m_mutex;
+	std::condition_variable m_cv;
+	std::deque<Request> m_requests;
+	std::thread m_thread;
+	bool m_quit = false;
+
+	// Worker-thread only: the last file opened by path stays open for the next request.
+	std::filesystem::path m_cachedPath;
+	void* m_cachedHandle = nullptr;
+};
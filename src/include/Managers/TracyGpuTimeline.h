@@ -0,0 +1,55 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+#include <rhi.h>
+
+// Sends GPU zones read back from timestamp queries to Tracy, on one GPU context per queue kind.
+// Zones are added when their frame's timestamps are read back, a few frames after recording, so
+// the whole frame of one queue goes out at once in Submit. Tracy places each zone by its GPU
+// time; the context is anchored to the CPU clock by its first submitted timestamp, so the GPU
+// timeline trails the CPU one by the readback latency of that first frame.
+class TracyGpuTimeline {
+public:
+    // False when Tracy is compiled out; callers can skip building zones entirely.
+    static constexpr bool Available() noexcept {
+#ifdef TRACY_ENABLE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void SetTimestampFrequency(uint64_t ticksPerSecond) noexcept { m_ticksPerSecond = ticksPerSecond; }
+
+    // One pass or batch zone. Zones of a frame may be added in any order.
+    void AddZone(std::string name, uint64_t beginTicks, uint64_t endTicks);
+    // A zero-length zone, used for cross-queue waits and signals.
+    void AddMarker(std::string name, uint64_t ticks) { AddZone(std::move(name), ticks, ticks); }
+
+    // Emits the zones added since the last Submit on queueKind's context, nested by time.
+    void Submit(rhi::QueueKind queueKind);
+
+    // Drops unsubmitted zones. The Tracy contexts stay alive; Tracy cannot destroy them.
+    void Reset() { m_zones.clear(); }
+
+private:
+    struct Zone {
+        std::string name;
+        uint64_t begin = 0;
+        uint64_t end = 0;
+    };
+
+    struct Context {
+        bool created = false;
+        uint8_t id = 0;
+        uint16_t nextQueryId = 0;
+    };
+
+    uint64_t m_ticksPerSecond = 0;
+    std::vector<Zone> m_zones;
+    std::vector<uint64_t> m_openEnds; // Scratch for Submit's nesting
+    std::array<Context, 3> m_contexts{}; // Indexed by rhi::QueueKind
+};